@@ -12,10 +12,25 @@
 // Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/assets/ChVisualSystem.h"
+#include "chrono/assets/ChVisualModel.h"
+#include "chrono/assets/ChVisualShape.h"
 
 namespace chrono {
 
+// Flag marking the middle triple-buffer slot as holding a snapshot not yet seen by the render thread.
+static const unsigned int SNAP_FRESH = 1 << 2;
+
+ChVisualSystem::ChVisualSystem()
+    : m_render_signature(0),
+      m_snapshots_enabled(false),
+      m_snap_mid(1),
+      m_snap_back(0),
+      m_snap_front(2),
+      m_snap_front_valid(false) {}
+
 ChVisualSystem ::~ChVisualSystem() {
     for (auto s : m_systems)
         s->visual_system = nullptr;
@@ -48,4 +63,134 @@ double ChVisualSystem::GetSimulationTime() const {
     return m_systems[0]->GetChTime();
 }
 
+size_t ChVisualSystem::ComputeRenderTableSignature() const {
+    // Mix the identity of every item carrying a visual model, its model object, and the shape and
+    // clone counts. Any topology change (item or shape added/removed, model swapped) changes the
+    // signature; pure motion does not.
+    size_t sig = m_systems.size();
+    auto mix = [&sig](size_t v) { sig = sig * 31 + v; };
+    auto mix_item = [&](const ChPhysicsItem* item) {
+        const auto& model = item->GetVisualModel();
+        if (!model)
+            return;
+        mix(reinterpret_cast<size_t>(item));
+        mix(reinterpret_cast<size_t>(model.get()));
+        mix((size_t)model->GetNumShapes());
+        mix((size_t)item->GetNumVisualModelClones());
+    };
+    for (auto sys : m_systems) {
+        for (const auto& body : sys->Get_bodylist())
+            mix_item(body.get());
+        for (const auto& link : sys->Get_linklist())
+            mix_item(link.get());
+        for (const auto& item : sys->Get_otherphysicslist())
+            mix_item(item.get());
+    }
+    return sig;
+}
+
+void ChVisualSystem::RefreshRenderItemTable() {
+    size_t sig = ComputeRenderTableSignature();
+
+    if (sig != m_render_signature) {
+        // Topology changed: rebuild the flattened tables from the visual model graphs.
+        m_render_signature = sig;
+        m_render_items.clear();
+        m_render_frames.clear();
+        m_render_materials.clear();
+        m_render_owners.clear();
+
+        std::unordered_map<ChVisualMaterial*, int> mat_index;
+
+        auto process = [&](const std::shared_ptr<ChPhysicsItem>& item) {
+            auto model = item->GetVisualModel();
+            if (!model)
+                return;
+            unsigned int nclones = std::max(1u, item->GetNumVisualModelClones());
+            for (unsigned int ic = 0; ic < nclones; ic++) {
+                int f = (int)m_render_owners.size();
+                m_render_owners.push_back({item.get(), ic});
+                for (const auto& shape_instance : model->GetShapes()) {
+                    ChVisualShape* shape = shape_instance.first.get();
+                    int mat = -1;
+                    if (shape->GetNumMaterials() > 0) {
+                        auto* mat0 = shape->GetMaterial(0).get();
+                        auto res = mat_index.insert({mat0, (int)m_render_materials.size()});
+                        if (res.second)
+                            m_render_materials.push_back(mat0);
+                        mat = res.first->second;
+                    }
+                    m_render_items.push_back({shape, item.get(), mat, f, shape_instance.second});
+                }
+            }
+        };
+
+        for (auto sys : m_systems) {
+            for (const auto& body : sys->Get_bodylist())
+                process(body);
+            for (const auto& link : sys->Get_linklist())
+                process(link);
+            for (const auto& item : sys->Get_otherphysicslist())
+                process(item);
+        }
+
+        m_render_frames.resize(m_render_owners.size());
+    }
+
+    // Per-frame work: a contiguous refresh of the model instance transforms.
+    for (size_t i = 0; i < m_render_owners.size(); i++)
+        m_render_frames[i] = m_render_owners[i].item->GetVisualModelFrame(m_render_owners[i].clone);
+}
+
+void ChVisualSystem::PublishPoseSnapshot() {
+    if (!m_snapshots_enabled)
+        return;
+
+    auto& snap = m_snapshots[m_snap_back];
+    snap.time = GetSimulationTime();
+    snap.poses.clear();
+
+    // Collect the visual model frames of all bodies and other physics items carrying a visual model.
+    // The item-to-index map is rebuilt only when the set of items changed since this slot was last filled.
+    bool rebuild_map = false;
+    for (const auto& sys : m_systems) {
+        for (const auto& body : sys->Get_bodylist()) {
+            if (snap.indices.find(body.get()) == snap.indices.end())
+                rebuild_map = true;
+            snap.poses.push_back(body->GetVisualModelFrame());
+        }
+        for (const auto& item : sys->Get_otherphysicslist()) {
+            if (!item->GetVisualModel())
+                continue;
+            if (snap.indices.find(item.get()) == snap.indices.end())
+                rebuild_map = true;
+            snap.poses.push_back(item->GetVisualModelFrame());
+        }
+    }
+
+    if (rebuild_map || snap.indices.size() != snap.poses.size()) {
+        snap.indices.clear();
+        int index = 0;
+        for (const auto& sys : m_systems) {
+            for (const auto& body : sys->Get_bodylist())
+                snap.indices[body.get()] = index++;
+            for (const auto& item : sys->Get_otherphysicslist()) {
+                if (item->GetVisualModel())
+                    snap.indices[item.get()] = index++;
+            }
+        }
+    }
+
+    // Swap the filled slot with the middle one, marking it as fresh
+    m_snap_back = m_snap_mid.exchange(m_snap_back | SNAP_FRESH) & 3;
+}
+
+const ChVisualSystem::PoseSnapshot* ChVisualSystem::GetLatestPoseSnapshot() {
+    if (m_snap_mid.load() & SNAP_FRESH) {
+        m_snap_front = m_snap_mid.exchange(m_snap_front) & 3;
+        m_snap_front_valid = true;
+    }
+    return m_snap_front_valid ? &m_snapshots[m_snap_front] : nullptr;
+}
+
 }  // namespace chrono
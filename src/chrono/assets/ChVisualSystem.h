@@ -15,6 +15,9 @@
 #ifndef CH_VISUAL_SYSTEM_H
 #define CH_VISUAL_SYSTEM_H
 
+#include <array>
+#include <atomic>
+#include <unordered_map>
 #include <vector>
 
 #include "chrono/core/ChApiCE.h"
@@ -149,6 +152,61 @@ class ChApi ChVisualSystem {
     /// Set the speed of the shown mode (only if some ChModalAssembly is found).
     virtual void SetModalSpeed(double val) {}
 
+    /// Compact snapshot of visual model poses.
+    /// Published by the physics thread at its own rate and consumed by a render thread at a different rate
+    /// (see EnablePoseSnapshots).
+    struct PoseSnapshot {
+        double time;                                             ///< simulation time at publication
+        std::vector<ChFrame<double>> poses;                      ///< visual model frame of each item
+        std::unordered_map<const ChPhysicsItem*, int> indices;   ///< map from physics item to index in 'poses'
+    };
+
+    /// Enable decoupling of the rendering rate from the physics rate (default: false).
+    /// When enabled, the physics thread publishes at the end of each step a compact snapshot with the visual
+    /// model poses of all bodies and other physics items carrying a visual model, into a triple buffer; a
+    /// render thread running concurrently picks up the most recent complete snapshot, wait-free on both sides,
+    /// through GetLatestPoseSnapshot(). A concrete visualization system may or may not consume the snapshots
+    /// (those that do not keep reading the live state).
+    void EnablePoseSnapshots(bool enable) { m_snapshots_enabled = enable; }
+
+    /// Return true if pose snapshot publication is enabled.
+    bool PoseSnapshotsEnabled() const { return m_snapshots_enabled; }
+
+    /// Get the most recent published pose snapshot (to be called from the render thread only).
+    /// Return null if nothing was published yet. The returned snapshot is owned by the render thread and is
+    /// not touched by the physics thread until the next call to this function.
+    const PoseSnapshot* GetLatestPoseSnapshot();
+
+    /// Flattened render item: one visual shape instance in the scene.
+    /// The items form a contiguous table built by RefreshRenderItemTable(); the world transform of
+    /// the owning model instance lives in a parallel frame table, referenced by index, so per-frame
+    /// pose updates touch only that contiguous array.
+    struct RenderItem {
+        ChVisualShape* shape;        ///< visual shape (owned by the visual model)
+        const ChPhysicsItem* owner;  ///< physics item carrying the model instance
+        int material;                ///< index into the material table (-1: shape has no material)
+        int frame_index;             ///< index of the model instance transform in the frame table
+        ChFrame<> shape_frame;       ///< shape frame relative to the model instance frame
+    };
+
+    /// Refresh the flattened render item table.
+    /// The table is rebuilt from the shared_ptr shape graphs only when the scene topology changed
+    /// (items or shapes added/removed, models swapped); otherwise this call reduces to a contiguous
+    /// refresh of the model instance transforms in the frame table. Concrete visualization systems
+    /// should call this once per rendered frame and then iterate GetRenderItems() for submission,
+    /// instead of walking the per-item visual models. FEA visualization shapes are not included in
+    /// the table (they regenerate their geometry every frame and are best handled separately).
+    void RefreshRenderItemTable();
+
+    /// Get the flattened render item table (see RefreshRenderItemTable).
+    const std::vector<RenderItem>& GetRenderItems() const { return m_render_items; }
+
+    /// Get the world transforms of the visual model instances, indexed by RenderItem::frame_index.
+    const std::vector<ChFrame<>>& GetRenderFrames() const { return m_render_frames; }
+
+    /// Get the deduplicated material table, indexed by RenderItem::material.
+    const std::vector<ChVisualMaterial*>& GetRenderMaterials() const { return m_render_materials; }
+
     /// Get the list of associated Chrono systems.
     std::vector<ChSystem*> GetSystems() const { return m_systems; }
 
@@ -156,7 +214,7 @@ class ChApi ChVisualSystem {
     ChSystem& GetSystem(int i) const { return *m_systems[i]; }
 
   protected:
-    ChVisualSystem() {}
+    ChVisualSystem();
 
     /// Perform any necessary setup operations at the beginning of a time step.
     /// Called by an associated ChSystem.
@@ -164,7 +222,12 @@ class ChApi ChVisualSystem {
 
     /// Perform any necessary update operations at the end of a time step.
     /// Called by an associated ChSystem.
-    virtual void OnUpdate(ChSystem* sys) {}
+    virtual void OnUpdate(ChSystem* sys) { PublishPoseSnapshot(); }
+
+    /// Publish a pose snapshot (to be called from the physics thread only).
+    /// A no-op unless snapshot publication is enabled. Derived classes which override OnUpdate() must call
+    /// this function themselves to keep snapshot publication working.
+    void PublishPoseSnapshot();
 
     /// Remove all visualization objects from this visualization system.
     /// Called by an associated ChSystem.
@@ -172,6 +235,30 @@ class ChApi ChVisualSystem {
 
     std::vector<ChSystem*> m_systems;  ///< associated Chrono system(s)
 
+  private:
+    /// One model instance whose world transform is refreshed every frame.
+    struct RenderOwner {
+        ChPhysicsItem* item;  ///< physics item carrying the model instance
+        unsigned int clone;   ///< clone index, for items with cloned visual models
+    };
+
+    /// Compute a cheap signature of the scene topology (items, models, shape counts),
+    /// used to detect when the render item table must be rebuilt.
+    size_t ComputeRenderTableSignature() const;
+
+    std::vector<RenderItem> m_render_items;            ///< flattened render item table
+    std::vector<ChFrame<>> m_render_frames;            ///< world transform per model instance
+    std::vector<ChVisualMaterial*> m_render_materials; ///< deduplicated material table
+    std::vector<RenderOwner> m_render_owners;          ///< model instance per frame table slot
+    size_t m_render_signature;                         ///< topology signature of the current table
+
+    bool m_snapshots_enabled;                  ///< publish pose snapshots at the end of each step?
+    std::array<PoseSnapshot, 3> m_snapshots;   ///< triple buffer of pose snapshots
+    std::atomic<unsigned int> m_snap_mid;      ///< middle buffer slot, with a flag marking it as fresh
+    unsigned int m_snap_back;                  ///< buffer slot owned by the physics thread
+    unsigned int m_snap_front;                 ///< buffer slot owned by the render thread
+    bool m_snap_front_valid;                   ///< was any snapshot ever acquired by the render thread?
+
     friend class ChSystem;
 };
 
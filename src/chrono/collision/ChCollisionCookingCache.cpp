@@ -0,0 +1,209 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "chrono/collision/ChCollisionCookingCache.h"
+
+namespace chrono {
+namespace collision {
+
+static std::string cooking_cache_dir;
+
+void ChCollisionCookingCache::SetDir(const std::string& dir) {
+    cooking_cache_dir = dir;
+}
+
+const std::string& ChCollisionCookingCache::GetDir() {
+    return cooking_cache_dir;
+}
+
+uint64_t ChCollisionCookingCache::Hash(const void* data, size_t size, uint64_t h) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        h ^= bytes[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+uint64_t ChCollisionCookingCache::HashMesh(geometry::ChTriangleMesh& trimesh, uint64_t h) {
+    for (int i = 0; i < trimesh.getNumTriangles(); i++) {
+        geometry::ChTriangle tri = trimesh.getTriangle(i);
+        h = Hash(tri.p1.data(), 3 * sizeof(double), h);
+        h = Hash(tri.p2.data(), 3 * sizeof(double), h);
+        h = Hash(tri.p3.data(), 3 * sizeof(double), h);
+    }
+    return h;
+}
+
+std::string ChCollisionCookingCache::Filename(const char* kind, uint64_t hash) {
+    char name[64];
+    sprintf(name, "/%s_%016llx.bin", kind, (unsigned long long)hash);
+    return cooking_cache_dir + name;
+}
+
+// -----------------------------------------------------------------------------
+
+// Entries are written to a temporary file and then renamed into place, so that
+// concurrent cookers (e.g. a parallel decomposition pipeline) producing the same
+// entry can never leave a torn cache file behind.
+class cooking_cache_writer {
+  public:
+    cooking_cache_writer(const std::string& filename)
+        : m_filename(filename), m_tempname(filename + ".tmp"), m_file(m_tempname.c_str(), std::ios::binary) {}
+
+    ~cooking_cache_writer() {
+        m_file.close();
+        if (std::rename(m_tempname.c_str(), m_filename.c_str()) != 0)
+            std::remove(m_tempname.c_str());
+    }
+
+    std::ofstream& stream() { return m_file; }
+
+  private:
+    std::string m_filename;
+    std::string m_tempname;
+    std::ofstream m_file;
+};
+
+// -----------------------------------------------------------------------------
+
+bool ChCollisionCookingCache::LoadHulls(const std::string& filename, std::vector<std::vector<ChVector<double>>>& hulls) {
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    if (!file)
+        return false;
+    char magic[8];
+    file.read(magic, 8);
+    if (!file || memcmp(magic, "CHHULL01", 8) != 0)
+        return false;
+    uint32_t num_hulls;
+    file.read(reinterpret_cast<char*>(&num_hulls), sizeof(num_hulls));
+    hulls.resize(num_hulls);
+    for (uint32_t j = 0; j < num_hulls; j++) {
+        uint32_t num_points;
+        file.read(reinterpret_cast<char*>(&num_points), sizeof(num_points));
+        if (!file)
+            return false;
+        hulls[j].resize(num_points);
+        file.read(reinterpret_cast<char*>(hulls[j].data()), num_points * sizeof(ChVector<double>));
+    }
+    return (bool)file;
+}
+
+void ChCollisionCookingCache::SaveHulls(const std::string& filename,
+                                        const std::vector<std::vector<ChVector<double>>>& hulls) {
+    cooking_cache_writer writer(filename);
+    std::ofstream& file = writer.stream();
+    file.write("CHHULL01", 8);
+    uint32_t num_hulls = (uint32_t)hulls.size();
+    file.write(reinterpret_cast<const char*>(&num_hulls), sizeof(num_hulls));
+    for (const auto& hull : hulls) {
+        uint32_t num_points = (uint32_t)hull.size();
+        file.write(reinterpret_cast<const char*>(&num_points), sizeof(num_points));
+        file.write(reinterpret_cast<const char*>(hull.data()), num_points * sizeof(ChVector<double>));
+    }
+}
+
+bool ChCollisionCookingCache::LoadHullMeshes(const std::string& filename, std::vector<HullMesh>& hulls) {
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    if (!file)
+        return false;
+    char magic[8];
+    file.read(magic, 8);
+    if (!file || memcmp(magic, "CHHULM01", 8) != 0)
+        return false;
+    uint32_t num_hulls;
+    file.read(reinterpret_cast<char*>(&num_hulls), sizeof(num_hulls));
+    hulls.resize(num_hulls);
+    for (uint32_t j = 0; j < num_hulls; j++) {
+        uint32_t num_points;
+        uint32_t num_triangles;
+        file.read(reinterpret_cast<char*>(&num_points), sizeof(num_points));
+        file.read(reinterpret_cast<char*>(&num_triangles), sizeof(num_triangles));
+        if (!file)
+            return false;
+        hulls[j].points.resize(num_points);
+        hulls[j].triangles.resize(num_triangles);
+        file.read(reinterpret_cast<char*>(hulls[j].points.data()), num_points * sizeof(ChVector<double>));
+        file.read(reinterpret_cast<char*>(hulls[j].triangles.data()), num_triangles * sizeof(ChVector<int>));
+    }
+    return (bool)file;
+}
+
+void ChCollisionCookingCache::SaveHullMeshes(const std::string& filename, const std::vector<HullMesh>& hulls) {
+    cooking_cache_writer writer(filename);
+    std::ofstream& file = writer.stream();
+    file.write("CHHULM01", 8);
+    uint32_t num_hulls = (uint32_t)hulls.size();
+    file.write(reinterpret_cast<const char*>(&num_hulls), sizeof(num_hulls));
+    for (const auto& hull : hulls) {
+        uint32_t num_points = (uint32_t)hull.points.size();
+        uint32_t num_triangles = (uint32_t)hull.triangles.size();
+        file.write(reinterpret_cast<const char*>(&num_points), sizeof(num_points));
+        file.write(reinterpret_cast<const char*>(&num_triangles), sizeof(num_triangles));
+        file.write(reinterpret_cast<const char*>(hull.points.data()), num_points * sizeof(ChVector<double>));
+        file.write(reinterpret_cast<const char*>(hull.triangles.data()), num_triangles * sizeof(ChVector<int>));
+    }
+}
+
+bool ChCollisionCookingCache::LoadAdjacency(const std::string& filename,
+                                            std::vector<std::array<int, 4>>& trimap,
+                                            std::map<std::pair<int, int>, std::pair<int, int>>& winged_edges) {
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    if (!file)
+        return false;
+    char magic[8];
+    file.read(magic, 8);
+    if (!file || memcmp(magic, "CHADJ001", 8) != 0)
+        return false;
+    uint64_t num_tri;
+    file.read(reinterpret_cast<char*>(&num_tri), sizeof(num_tri));
+    if (!file)
+        return false;
+    trimap.resize(num_tri);
+    file.read(reinterpret_cast<char*>(trimap.data()), num_tri * sizeof(std::array<int, 4>));
+    uint64_t num_edges;
+    file.read(reinterpret_cast<char*>(&num_edges), sizeof(num_edges));
+    if (!file)
+        return false;
+    for (uint64_t i = 0; i < num_edges; i++) {
+        int32_t vals[4];
+        file.read(reinterpret_cast<char*>(vals), sizeof(vals));
+        winged_edges[std::pair<int, int>(vals[0], vals[1])] = std::pair<int, int>(vals[2], vals[3]);
+    }
+    return (bool)file;
+}
+
+void ChCollisionCookingCache::SaveAdjacency(const std::string& filename,
+                                            const std::vector<std::array<int, 4>>& trimap,
+                                            const std::map<std::pair<int, int>, std::pair<int, int>>& winged_edges) {
+    cooking_cache_writer writer(filename);
+    std::ofstream& file = writer.stream();
+    file.write("CHADJ001", 8);
+    uint64_t num_tri = (uint64_t)trimap.size();
+    file.write(reinterpret_cast<const char*>(&num_tri), sizeof(num_tri));
+    file.write(reinterpret_cast<const char*>(trimap.data()), num_tri * sizeof(std::array<int, 4>));
+    uint64_t num_edges = (uint64_t)winged_edges.size();
+    file.write(reinterpret_cast<const char*>(&num_edges), sizeof(num_edges));
+    for (const auto& edge : winged_edges) {
+        int32_t vals[4] = {edge.first.first, edge.first.second, edge.second.first, edge.second.second};
+        file.write(reinterpret_cast<const char*>(vals), sizeof(vals));
+    }
+}
+
+}  // end namespace collision
+}  // end namespace chrono
@@ -0,0 +1,96 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CH_COLLISION_COOKING_CACHE_H
+#define CH_COLLISION_COOKING_CACHE_H
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/geometry/ChTriangleMesh.h"
+
+namespace chrono {
+namespace collision {
+
+/// @addtogroup chrono_collision
+/// @{
+
+/// On-disk cache for expensive collision cooking results, keyed by a content hash of the
+/// input mesh (and of the cooking parameters). Cache entries survive across runs, so the
+/// cooking cost of an asset is paid once per asset revision instead of once per run.
+/// The cache is shared by all cookers: the Bullet collision model uses it for convex
+/// decomposition hulls and connected-mesh adjacency data, and ChConvexDecompositionHACDv2
+/// uses it directly for full decomposition results.
+/// The cache is disabled until a directory is set; the directory must exist.
+class ChApi ChCollisionCookingCache {
+  public:
+    /// A single convex hull of a decomposition result, with both vertices and triangles.
+    struct HullMesh {
+        std::vector<ChVector<double>> points;
+        std::vector<ChVector<int>> triangles;
+    };
+
+    /// Enable the cache, storing entries in the given (existing) directory.
+    /// Pass an empty string to disable the cache.
+    static void SetDir(const std::string& dir);
+
+    /// Return the cache directory (empty if the cache is disabled).
+    static const std::string& GetDir();
+
+    /// Incremental FNV-1a hash over raw bytes.
+    static uint64_t Hash(const void* data, size_t size, uint64_t h = 14695981039346656037ull);
+
+    /// Hash the triangle vertices of a generic triangle mesh.
+    static uint64_t HashMesh(geometry::ChTriangleMesh& trimesh, uint64_t h);
+
+    /// Return the cache filename for an entry of the given kind and content hash.
+    static std::string Filename(const char* kind, uint64_t hash);
+
+    /// Load cached convex decomposition hulls (vertices only).
+    /// Returns false if no valid cache file exists.
+    static bool LoadHulls(const std::string& filename, std::vector<std::vector<ChVector<double>>>& hulls);
+
+    /// Save convex decomposition hulls (vertices only).
+    static void SaveHulls(const std::string& filename, const std::vector<std::vector<ChVector<double>>>& hulls);
+
+    /// Load cached convex decomposition hulls with triangles.
+    /// Returns false if no valid cache file exists.
+    static bool LoadHullMeshes(const std::string& filename, std::vector<HullMesh>& hulls);
+
+    /// Save convex decomposition hulls with triangles.
+    static void SaveHullMeshes(const std::string& filename, const std::vector<HullMesh>& hulls);
+
+    /// Load cached adjacency data (neighbouring-triangle map and winged edges) of a connected mesh.
+    /// Returns false if no valid cache file exists.
+    static bool LoadAdjacency(const std::string& filename,
+                              std::vector<std::array<int, 4>>& trimap,
+                              std::map<std::pair<int, int>, std::pair<int, int>>& winged_edges);
+
+    /// Save adjacency data of a connected mesh.
+    static void SaveAdjacency(const std::string& filename,
+                              const std::vector<std::array<int, 4>>& trimap,
+                              const std::map<std::pair<int, int>, std::pair<int, int>>& winged_edges);
+};
+
+/// @} chrono_collision
+
+}  // end namespace collision
+}  // end namespace chrono
+
+#endif
@@ -27,7 +27,8 @@ ChCollisionInfo::ChCollisionInfo()
       vN(ChVector<>(1, 0, 0)),
       distance(0),
       eff_radius(default_eff_radius),
-      reaction_cache(nullptr) {}
+      reaction_cache(nullptr),
+      is_speculative(false) {}
 
 ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap) {
     if (!swap) {
@@ -51,6 +52,7 @@ ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap)
     distance = other.distance;
     eff_radius = other.eff_radius;
     reaction_cache = other.reaction_cache;
+    is_speculative = other.is_speculative;
 }
 
 void ChCollisionInfo::SwapModels() {
@@ -36,6 +36,7 @@ class ChApi ChCollisionInfo {
     double distance;           ///< distance (negative for penetration)
     double eff_radius;         ///< effective radius of curvature at contact (SMC only)
     float* reaction_cache;     ///< pointer to some persistent user cache of reactions
+    bool is_speculative;       ///< true if generated by speculative detection at a separation beyond the envelope
 
     /// Basic default constructor.
     ChCollisionInfo();
@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include "chrono/ChConfig.h"
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/geometry/ChLineSegment.h"
@@ -22,10 +23,17 @@ namespace collision {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 // CH_FACTORY_REGISTER(ChCollisionModel)  // NO! Abstract class!
 
+#ifdef CHRONO_SINGLE_PRECISION
+// With single-precision dynamics, use larger default envelope and margin to absorb the reduced accuracy of the
+// contact point calculations.
+static double default_model_envelope = 0.05;
+static double default_safe_margin = 0.02;
+#else
 static double default_model_envelope = 0.03;
 static double default_safe_margin = 0.01;
+#endif
 
-ChCollisionModel::ChCollisionModel() : mcontactable(nullptr), family_group(1), family_mask(0x7FFF) {
+ChCollisionModel::ChCollisionModel() : mcontactable(nullptr), family_group(1), family_mask(0x7FFFFFFF) {
     model_envelope = (float)default_model_envelope;
     model_safe_margin = (float)default_safe_margin;
 }
@@ -58,7 +66,7 @@ double ChCollisionModel::GetDefaultSuggestedMargin() {
 
 // Set family_group to a power of 2, with the set bit in position mfamily.
 void ChCollisionModel::SetFamily(int mfamily) {
-    assert(mfamily >= 0 && mfamily < 15);
+    assert(mfamily >= 0 && mfamily < 31);
     family_group = (1 << mfamily);
 }
 
@@ -75,33 +83,33 @@ int ChCollisionModel::GetFamily() {
 
 // Clear the family_mask bit in position mfamily.
 void ChCollisionModel::SetFamilyMaskNoCollisionWithFamily(int mfamily) {
-    assert(mfamily >= 0 && mfamily < 15);
+    assert(mfamily >= 0 && mfamily < 31);
     family_mask &= ~(1 << mfamily);
 }
 
 // Set the family_mask bit in position mfamily.
 void ChCollisionModel::SetFamilyMaskDoCollisionWithFamily(int mfamily) {
-    assert(mfamily >= 0 && mfamily < 15);
+    assert(mfamily >= 0 && mfamily < 31);
     family_mask |= (1 << mfamily);
 }
 
 // Return true if the family_mask bit in position mfamily is set.
 bool ChCollisionModel::GetFamilyMaskDoesCollisionWithFamily(int mfamily) {
-    assert(mfamily >= 0 && mfamily < 15);
+    assert(mfamily >= 0 && mfamily < 31);
     return (family_mask & (1 << mfamily)) != 0;
 }
 
 // Set the collision family group of this model.
 // In order to properly encode a collision family, the value 'group' must be a power of 2.
-void ChCollisionModel::SetFamilyGroup(short int group) {
+void ChCollisionModel::SetFamilyGroup(int group) {
     assert(group > 0 && !(group & (group - 1)));
     family_group = group;
 }
 
 // Set the collision mask for this model.
-// In order to properly encode a collision mask, the value 'mask' must not exceed 0x7FFFF (i.e. 15 right bits all set)
-void ChCollisionModel::SetFamilyMask(short int mask) {
-    assert(mask >= 0 && mask <= 0x7FFF);
+// In order to properly encode a collision mask, the value 'mask' must not exceed 0x7FFFFFFF (i.e. 31 right bits all set)
+void ChCollisionModel::SetFamilyMask(int mask) {
+    assert(mask >= 0 && mask <= 0x7FFFFFFF);
     family_mask = mask;
 }
 
@@ -271,7 +271,7 @@ class ChApi ChCollisionModel {
     virtual void SyncPosition() = 0;
 
     /// By default, all collision objects belong to family n.0,
-    /// but you can set family in range 0..15. This is used when
+    /// but you can set family in range 0..30. This is used when
     /// the objects collided with another: the contact is created
     /// only if the family is within the 'family mask' of the other,
     /// and viceversa.
@@ -297,23 +297,23 @@ class ChApi ChCollisionModel {
 
     /// Return the collision family group of this model.
     /// The collision family of this model is the position of the single set bit in the return value.
-    virtual short int GetFamilyGroup() const { return family_group; }
+    virtual int GetFamilyGroup() const { return family_group; }
 
     /// Set the collision family group of this model.
     /// This is an alternative way of specifying the collision family for this
     /// object.  The value family_group must have a single bit set (i.e. it must
     /// be a power of 2). The corresponding family is then the bit position.
-    virtual void SetFamilyGroup(short int group);
+    virtual void SetFamilyGroup(int group);
 
     /// Return the collision mask for this model.
     /// Each bit of the return value indicates whether this model collides with
     /// the corresponding family (bit set) or not (bit unset).
-    virtual short int GetFamilyMask() const { return family_mask; }
+    virtual int GetFamilyMask() const { return family_mask; }
 
     /// Set the collision mask for this model.
     /// Any set bit in the specified mask indicates that this model collides with
     /// all objects whose family is equal to the bit position.
-    virtual void SetFamilyMask(short int mask);
+    virtual void SetFamilyMask(int mask);
 
     // TOLERANCES, ENVELOPES, THRESHOLDS
 
@@ -410,8 +410,8 @@ class ChApi ChCollisionModel {
     float model_safe_margin;      ///< Maximum margin value to be used for fast penetration contact detection
     ChContactable* mcontactable;  ///< Pointer to the contactable object
 
-    short int family_group;  ///< Collision family group
-    short int family_mask;   ///< Collision family mask
+    int family_group;  ///< Collision family group
+    int family_mask;   ///< Collision family mask
 
     std::vector<std::shared_ptr<ChCollisionShape>> m_shapes;  ///< list of collision shapes in model
 };
@@ -14,7 +14,9 @@
 
 #include <memory>
 #include <array>
+#include <cstdint>
 
+#include "chrono/collision/ChCollisionCookingCache.h"
 #include "chrono/collision/ChCollisionSystemBullet.h"
 #include "chrono/collision/ChCollisionUtilsBullet.h"
 #include "chrono/collision/ChConvexDecomposition.h"
@@ -37,6 +39,19 @@ namespace collision {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChCollisionModelBullet)
 
+// -----------------------------------------------------------------------------
+// On-disk cache for expensive collision cooking results (convex decompositions and
+// connected-mesh adjacency data); see ChCollisionCookingCache.
+// -----------------------------------------------------------------------------
+
+void ChCollisionModelBullet::SetCookingCacheDir(const std::string& dir) {
+    ChCollisionCookingCache::SetDir(dir);
+}
+
+const std::string& ChCollisionModelBullet::GetCookingCacheDir() {
+    return ChCollisionCookingCache::GetDir();
+}
+
 ChCollisionModelBullet::ChCollisionModelBullet() {
     bt_collision_object = std::unique_ptr<cbtCollisionObject>(new cbtCollisionObject);
     bt_collision_object->setCollisionShape(nullptr);
@@ -552,10 +567,25 @@ bool ChCollisionModelBullet::AddTriangleMesh(std::shared_ptr<ChMaterialSurface>
 
     if (auto mesh = std::dynamic_pointer_cast<geometry::ChTriangleMeshConnected>(trimesh)) {
         std::vector<std::array<int, 4>> trimap;
-        mesh->ComputeNeighbouringTriangleMap(trimap);
-
         std::map<std::pair<int, int>, std::pair<int, int>> winged_edges;
-        mesh->ComputeWingedEdges(winged_edges, true);
+
+        // Computing the adjacency data is expensive for large meshes; reuse a cached copy when the
+        // cooking cache is enabled and holds an entry for this mesh content.
+        std::string cache_file;
+        if (!ChCollisionCookingCache::GetDir().empty()) {
+            uint64_t hash = ChCollisionCookingCache::Hash(mesh->m_vertices.data(),
+                                                          mesh->m_vertices.size() * sizeof(ChVector<double>));
+            hash = ChCollisionCookingCache::Hash(mesh->m_face_v_indices.data(),
+                                                 mesh->m_face_v_indices.size() * sizeof(ChVector<int>), hash);
+            cache_file = ChCollisionCookingCache::Filename("adjacency", hash);
+        }
+
+        if (cache_file.empty() || !ChCollisionCookingCache::LoadAdjacency(cache_file, trimap, winged_edges)) {
+            mesh->ComputeNeighbouringTriangleMap(trimap);
+            mesh->ComputeWingedEdges(winged_edges, true);
+            if (!cache_file.empty())
+                ChCollisionCookingCache::SaveAdjacency(cache_file, trimap, winged_edges);
+        }
 
         std::vector<bool> added_vertexes(mesh->m_vertices.size());
 
@@ -681,20 +711,47 @@ bool ChCollisionModelBullet::AddTriangleMesh(std::shared_ptr<ChMaterialSurface>
             AddTriangleMeshConcaveDecomposed(material, mydecompositionHACD, pos, rot);
             */
 
-            // using HACDv2 convex decomposition
-            auto mydecompositionHACDv2 = chrono_types::make_shared<ChConvexDecompositionHACDv2>();
-            mydecompositionHACDv2->Reset();
-            mydecompositionHACDv2->AddTriangleMesh(*trimesh);
-            mydecompositionHACDv2->SetParameters(  //
-                512,                               // max hull count
-                256,                               // max hull merge
-                64,                                // max hull vettices
-                0.2f,                              // concavity
-                0.0f,                              // small cluster threshold
-                1e-9f                              // fuse tolerance
-            );
-            mydecompositionHACDv2->ComputeConvexDecomposition();
-            AddTriangleMeshConcaveDecomposed(material, mydecompositionHACDv2, pos, rot);
+            // The convex decomposition dominates the cooking cost; reuse cached hulls when the
+            // cooking cache is enabled and holds an entry for this mesh content.
+            std::string cache_file;
+            std::vector<std::vector<ChVector<double>>> hulls;
+            if (!ChCollisionCookingCache::GetDir().empty()) {
+                // tag the hash with the decomposition parameters, so changing them invalidates the entry
+                uint64_t hash = ChCollisionCookingCache::Hash("HACDv2_512_256_64_0.2_0.0_1e-9", 30);
+                hash = ChCollisionCookingCache::HashMesh(*trimesh, hash);
+                cache_file = ChCollisionCookingCache::Filename("hulls", hash);
+            }
+
+            if (!cache_file.empty() && ChCollisionCookingCache::LoadHulls(cache_file, hulls)) {
+                // hulls are not shrunk, so the safe margin must be zero (as in AddTriangleMeshConcaveDecomposed)
+                SetSafeMargin(0);
+                for (const auto& ptlist : hulls) {
+                    if (ptlist.size())
+                        AddConvexHull(material, ptlist, pos, rot);
+                }
+            } else {
+                // using HACDv2 convex decomposition
+                auto mydecompositionHACDv2 = chrono_types::make_shared<ChConvexDecompositionHACDv2>();
+                mydecompositionHACDv2->Reset();
+                mydecompositionHACDv2->AddTriangleMesh(*trimesh);
+                mydecompositionHACDv2->SetParameters(  //
+                    512,                               // max hull count
+                    256,                               // max hull merge
+                    64,                                // max hull vettices
+                    0.2f,                              // concavity
+                    0.0f,                              // small cluster threshold
+                    1e-9f                              // fuse tolerance
+                );
+                mydecompositionHACDv2->ComputeConvexDecomposition();
+                AddTriangleMeshConcaveDecomposed(material, mydecompositionHACDv2, pos, rot);
+
+                if (!cache_file.empty()) {
+                    hulls.resize(mydecompositionHACDv2->GetHullCount());
+                    for (unsigned int j = 0; j < mydecompositionHACDv2->GetHullCount(); j++)
+                        mydecompositionHACDv2->GetConvexHullResult(j, hulls[j]);
+                    ChCollisionCookingCache::SaveHulls(cache_file, hulls);
+                }
+            }
         }
     }
 
@@ -771,8 +828,8 @@ int ChCollisionModelBullet::GetFamily() {
     int fam;
     if (!bt_collision_object->getBroadphaseHandle())
         return -1;
-    for (fam = 0; fam < 16; fam++)
-        if (((short int)0x1 << fam) & bt_collision_object->getBroadphaseHandle()->m_collisionFilterGroup)
+    for (fam = 0; fam < 31; fam++)
+        if ((0x1 << fam) & bt_collision_object->getBroadphaseHandle()->m_collisionFilterGroup)
             return fam;
     return fam;
 }
@@ -788,19 +845,19 @@ void ChCollisionModelBullet::SetFamilyMaskDoCollisionWithFamily(int mfamily) {
 }
 
 bool ChCollisionModelBullet::GetFamilyMaskDoesCollisionWithFamily(int mfamily) {
-    assert(mfamily < 16);
+    assert(mfamily < 31);
     if (!bt_collision_object->getBroadphaseHandle())
         return false;
-    short familyflag = (1 << mfamily);
+    int familyflag = (1 << mfamily);
     return (bt_collision_object->getBroadphaseHandle()->m_collisionFilterMask & familyflag) != 0;
 }
 
-void ChCollisionModelBullet::SetFamilyGroup(short int group) {
+void ChCollisionModelBullet::SetFamilyGroup(int group) {
     ChCollisionModel::SetFamilyGroup(group);
     onFamilyChange();
 }
 
-void ChCollisionModelBullet::SetFamilyMask(short int mask) {
+void ChCollisionModelBullet::SetFamilyMask(int mask) {
     ChCollisionModel::SetFamilyMask(mask);
     onFamilyChange();
 }
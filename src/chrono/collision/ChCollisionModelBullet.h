@@ -174,6 +174,16 @@ class ChApi ChCollisionModelBullet : public ChCollisionModel {
         const ChMatrix33<>& rot = ChMatrix33<>(1)        ///< rotation in model coordinates
         ) override;
 
+    /// Enable an on-disk cache for the expensive mesh cooking performed in AddTriangleMesh (convex
+    /// decomposition of dynamic non-convex meshes and adjacency data of connected meshes), by setting
+    /// the directory where cache files are stored. Entries are keyed by a hash of the mesh content, so
+    /// the same directory can be shared by different models and different runs; pass an empty string
+    /// to disable caching (default). The directory must exist.
+    static void SetCookingCacheDir(const std::string& dir);
+
+    /// Get the directory of the on-disk mesh cooking cache (empty if caching is disabled).
+    static const std::string& GetCookingCacheDir();
+
     /// Add a triangle mesh to this collision model.
     /// Note: if possible, for better performance, avoid triangle meshes and prefer simplified
     /// representations as compounds of primitive convex shapes (boxes, sphers, etc).
@@ -289,12 +299,12 @@ class ChApi ChCollisionModelBullet : public ChCollisionModel {
     /// This is an alternative way of specifying the collision family for this
     /// object.  The value family_group must have a single bit set (i.e. it must
     /// be a power of 2). The corresponding family is then the bit position.
-    virtual void SetFamilyGroup(short int group) override;
+    virtual void SetFamilyGroup(int group) override;
 
     /// Set the collision mask for this model.
     /// Any set bit in the specified mask indicates that this model collides with
     /// all objects whose family is equal to the bit position.
-    virtual void SetFamilyMask(short int mask) override;
+    virtual void SetFamilyMask(int mask) override;
 
     /// Returns the axis aligned bounding box (AABB) of the collision model,
     /// i.e. max-min along the x,y,z world axes. Remember that SyncPosition()
@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChProximityContainer.h"
 #include "chrono/collision/ChCollisionSystemBullet.h"
@@ -20,6 +21,7 @@
 #include "chrono/collision/gimpact/GIMPACT/Bullet/cbtGImpactCollisionAlgorithm.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionDispatch/cbtCollisionDispatcherMt.h"
 #include "chrono/collision/bullet/LinearMath/cbtIDebugDraw.h"
+#include "chrono/utils/ChOpenMP.h"
 
 extern cbtScalar gContactBreakingThreshold;
 
@@ -30,7 +32,34 @@ namespace collision {
 // dynamic creation and persistence
 CH_FACTORY_REGISTER(ChCollisionSystemBullet)
 
-ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
+// Broadphase overlap filter: the standard collision family group/mask test, optionally extended
+// with culling of pairs in which both collision objects are static (models of fixed bodies, see
+// ChCollisionSystemBullet::Add). Rejecting these pairs here avoids their pair bookkeeping and
+// narrowphase dispatch entirely - with large static environments the bulk of the broadphase
+// output would otherwise be static-static pairs that can never produce active constraints.
+struct ChOverlapFilterCallback : public cbtOverlapFilterCallback {
+    bool static_culling;
+
+    ChOverlapFilterCallback() : static_culling(true) {}
+
+    virtual bool needBroadphaseCollision(cbtBroadphaseProxy* proxy0, cbtBroadphaseProxy* proxy1) const override {
+        bool collides = (proxy0->m_collisionFilterGroup & proxy1->m_collisionFilterMask) != 0 &&
+                        (proxy1->m_collisionFilterGroup & proxy0->m_collisionFilterMask) != 0;
+        if (!collides)
+            return false;
+
+        if (static_culling) {
+            const cbtCollisionObject* obj0 = (const cbtCollisionObject*)proxy0->m_clientObject;
+            const cbtCollisionObject* obj1 = (const cbtCollisionObject*)proxy1->m_clientObject;
+            if (obj0->isStaticObject() && obj1->isStaticObject())
+                return false;
+        }
+
+        return true;
+    }
+};
+
+ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr), m_nthreads(1) {
     // cbtDefaultCollisionConstructionInfo conf_info(...); ***TODO***
     bt_collision_configuration = new cbtDefaultCollisionConfiguration();
 
@@ -44,6 +73,10 @@ ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
     bt_broadphase = new cbtDbvtBroadphase();
     bt_collision_world = new cbtCollisionWorld(bt_dispatcher, bt_broadphase, bt_collision_configuration);
 
+    // install the broadphase filter with static-static pair culling
+    m_filter_callback = new ChOverlapFilterCallback();
+    bt_broadphase->getOverlappingPairCache()->setOverlapFilterCallback(m_filter_callback);
+
     // custom collision for cylinder-sphere case, for improved precision
     ////cbtCollisionAlgorithmCreateFunc* m_collision_sph_cyl = new cbtSphereCylinderCollisionAlgorithm::CreateFunc;
     ////cbtCollisionAlgorithmCreateFunc* m_collision_cyl_sph = new cbtSphereCylinderCollisionAlgorithm::CreateFunc;
@@ -116,9 +149,25 @@ ChCollisionSystemBullet::~ChCollisionSystemBullet() {
     delete m_collision_cetri_cetri;
     m_emptyCreateFunc->~cbtCollisionAlgorithmCreateFunc();
     cbtAlignedFree(m_tmp_mem);
+
+    delete m_filter_callback;
+}
+
+void ChCollisionSystemBullet::SetStaticPairCulling(bool val) {
+    static_cast<ChOverlapFilterCallback*>(m_filter_callback)->static_culling = val;
+}
+
+bool ChCollisionSystemBullet::GetStaticPairCulling() const {
+    return static_cast<ChOverlapFilterCallback*>(m_filter_callback)->static_culling;
+}
+
+void ChCollisionSystemBullet::OptimizeStaticTree() {
+    if (auto dbvt_broadphase = dynamic_cast<cbtDbvtBroadphase*>(bt_broadphase))
+        dbvt_broadphase->optimize();
 }
 
 void ChCollisionSystemBullet::SetNumThreads(int nthreads) {
+    m_nthreads = (nthreads < 1) ? 1 : nthreads;
 #ifdef BT_USE_OPENMP
     cbtGetOpenMPTaskScheduler()->setNumThreads(nthreads);
 #endif
@@ -136,6 +185,16 @@ void ChCollisionSystemBullet::Add(ChCollisionModel* model) {
     auto model_bt = static_cast<ChCollisionModelBullet*>(model);
     if (model_bt->GetBulletModel()->getCollisionShape()) {
         model->SyncPosition();
+
+        // Classify the object for broadphase static-static culling: only models of fixed bodies
+        // keep the Bullet static flag (which cbtCollisionObject sets by default on construction).
+        auto bt_obj = model_bt->GetBulletModel();
+        auto body = dynamic_cast<ChBody*>(model->GetContactable());
+        if (body && body->GetBodyFixed())
+            bt_obj->setCollisionFlags(bt_obj->getCollisionFlags() | cbtCollisionObject::CF_STATIC_OBJECT);
+        else
+            bt_obj->setCollisionFlags(bt_obj->getCollisionFlags() & ~cbtCollisionObject::CF_STATIC_OBJECT);
+
         bt_collision_world->addCollisionObject(model_bt->GetBulletModel(), model_bt->GetFamilyGroup(),
                                                model_bt->GetFamilyMask());
     }
@@ -178,88 +237,127 @@ double ChCollisionSystemBullet::GetTimerCollisionNarrow() const {
     return bt_collision_world->timer_collision_narrow();
 }
 
-void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontainer) {
-    // This should remove all old contacts (or at least rewind the index)
-    mcontactcontainer->BeginAddContact();
-
+void ChCollisionSystemBullet::ProcessManifold(cbtPersistentManifold* contactManifold,
+                                              std::vector<ChCollisionInfo>& buffer) {
     // NOTE: Bullet does not provide information on radius of curvature at a contact point.
     // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
     ChCollisionInfo icontact;
 
-    int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
-    for (int i = 0; i < numManifolds; i++) {
-        cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
-        const cbtCollisionObject* obA = contactManifold->getBody0();
-        const cbtCollisionObject* obB = contactManifold->getBody1();
-        contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
+    const cbtCollisionObject* obA = contactManifold->getBody0();
+    const cbtCollisionObject* obB = contactManifold->getBody1();
+    contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
 
-        icontact.modelA = (ChCollisionModel*)obA->getUserPointer();
-        icontact.modelB = (ChCollisionModel*)obB->getUserPointer();
+    icontact.modelA = (ChCollisionModel*)obA->getUserPointer();
+    icontact.modelB = (ChCollisionModel*)obB->getUserPointer();
 
-        double envelopeA = icontact.modelA->GetEnvelope();
-        double envelopeB = icontact.modelB->GetEnvelope();
+    double envelopeA = icontact.modelA->GetEnvelope();
+    double envelopeB = icontact.modelB->GetEnvelope();
 
-        double marginA = icontact.modelA->GetSafeMargin();
-        double marginB = icontact.modelB->GetSafeMargin();
+    double marginA = icontact.modelA->GetSafeMargin();
+    double marginB = icontact.modelB->GetSafeMargin();
 
-        // Execute custom broadphase callback, if any
-        bool do_narrow_contactgeneration = true;
-        if (this->broad_callback)
-            do_narrow_contactgeneration = this->broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
+    int numContacts = contactManifold->getNumContacts();
+    for (int j = 0; j < numContacts; j++) {
+        cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
 
-        if (do_narrow_contactgeneration) {
-            int numContacts = contactManifold->getNumContacts();
-            // GetLog() << "numContacts=" << numContacts << "\n";
-            for (int j = 0; j < numContacts; j++) {
-                cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
+        // Discard "too far" constraints (the Bullet engine also has its threshold)
+        if (pt.getDistance() < marginA + marginB) {
+            cbtVector3 ptA = pt.getPositionWorldOnA();
+            cbtVector3 ptB = pt.getPositionWorldOnB();
 
-                // Discard "too far" constraints (the Bullet engine also has its threshold)
-                if (pt.getDistance() < marginA + marginB) {
-                    cbtVector3 ptA = pt.getPositionWorldOnA();
-                    cbtVector3 ptB = pt.getPositionWorldOnB();
+            icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
+            icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
 
-                    icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
-                    icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
+            icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(), -pt.m_normalWorldOnB.getZ());
+            icontact.vN.Normalize();
 
-                    icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(),
-                                    -pt.m_normalWorldOnB.getZ());
-                    icontact.vN.Normalize();
+            double ptdist = pt.getDistance();
 
-                    double ptdist = pt.getDistance();
+            icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
+            icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
+            icontact.distance = ptdist + envelopeA + envelopeB;
 
-                    icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
-                    icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
-                    icontact.distance = ptdist + envelopeA + envelopeB;
+            icontact.reaction_cache = pt.reactions_cache;
 
-                    icontact.reaction_cache = pt.reactions_cache;
+            bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+            bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
 
-                    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
-                    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+            int indexA = compoundA ? pt.m_index0 : 0;
+            int indexB = compoundB ? pt.m_index1 : 0;
 
-                    int indexA = compoundA ? pt.m_index0 : 0;
-                    int indexB = compoundB ? pt.m_index1 : 0;
+            icontact.shapeA = icontact.modelA->GetShape(indexA).get();
+            icontact.shapeB = icontact.modelB->GetShape(indexB).get();
 
-                    icontact.shapeA = icontact.modelA->GetShape(indexA).get();
-                    icontact.shapeB = icontact.modelB->GetShape(indexB).get();
+            buffer.push_back(icontact);
+        }
+    }
+
+    // Uncomment this line to remove all points
+    ////contactManifold->clearManifold();
+}
 
-                    // Execute some user custom callback, if any
-                    bool add_contact = true;
-                    if (this->narrow_callback)
-                        add_contact = this->narrow_callback->OnNarrowphase(icontact);
+void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontainer) {
+    // This should remove all old contacts (or at least rewind the index)
+    mcontactcontainer->BeginAddContact();
 
-                    // Add to contact container
-                    if (add_contact) {
-                        ////std::cout << " add indexA=" << indexA << " indexB=" << indexB << std::endl;
-                        ////std::cout << "     typeA=" << icontact.shapeA->m_type << " typeB=" << icontact.shapeB->m_type << std::endl;
+    int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
 
-                        mcontactcontainer->AddContact(icontact);
-                    }
-                }
+#ifdef BT_USE_OPENMP
+    // Parallel path: process manifolds (refresh of contact points and extraction of contact
+    // geometry) into per-thread buffers, then merge into the contact container in a single serial
+    // pass, since AddContact is not thread safe. Not used when a broadphase callback is registered,
+    // as user callbacks give no thread-safety guarantees.
+    if (m_nthreads > 1 && numManifolds > 64 && !broad_callback) {
+        std::vector<std::vector<ChCollisionInfo>> buffers(m_nthreads);
+#pragma omp parallel num_threads(m_nthreads)
+        {
+            std::vector<ChCollisionInfo>& buffer = buffers[ChOMP::GetThreadNum()];
+#pragma omp for schedule(dynamic, 64)
+            for (int i = 0; i < numManifolds; i++) {
+                cbtPersistentManifold* contactManifold =
+                    bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
+                ProcessManifold(contactManifold, buffer);
             }
         }
+        for (auto& buffer : buffers) {
+            for (auto& icontact : buffer) {
+                bool add_contact = true;
+                if (this->narrow_callback)
+                    add_contact = this->narrow_callback->OnNarrowphase(icontact);
+                if (add_contact)
+                    mcontactcontainer->AddContact(icontact);
+            }
+        }
+        mcontactcontainer->EndAddContact();
+        return;
+    }
+#endif
+
+    std::vector<ChCollisionInfo> buffer;
+    for (int i = 0; i < numManifolds; i++) {
+        cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
 
-        // Uncomment this line to remove all points
-        ////contactManifold->clearManifold();
+        // Execute custom broadphase callback, if any
+        if (this->broad_callback) {
+            ChCollisionModel* modelA = (ChCollisionModel*)contactManifold->getBody0()->getUserPointer();
+            ChCollisionModel* modelB = (ChCollisionModel*)contactManifold->getBody1()->getUserPointer();
+            if (!this->broad_callback->OnBroadphase(modelA, modelB))
+                continue;
+        }
+
+        buffer.clear();
+        ProcessManifold(contactManifold, buffer);
+
+        for (auto& icontact : buffer) {
+            // Execute some user custom callback, if any
+            bool add_contact = true;
+            if (this->narrow_callback)
+                add_contact = this->narrow_callback->OnNarrowphase(icontact);
+
+            // Add to contact container
+            if (add_contact)
+                mcontactcontainer->AddContact(icontact);
+        }
     }
     mcontactcontainer->EndAddContact();
 }
@@ -15,7 +15,10 @@
 #ifndef CH_COLLISION_SYSTEM_BULLET_H
 #define CH_COLLISION_SYSTEM_BULLET_H
 
+#include <vector>
+
 #include "chrono/collision/ChCollisionSystem.h"
+#include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/collision/bullet/cbtBulletCollisionCommon.h"
 #include "chrono/core/ChApiCE.h"
 
@@ -106,6 +109,26 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// visualization callback was not specified with RegisterVisualizationCallback().
     virtual void Visualize(int flags) override;
 
+    /// Enable/disable broadphase culling of static-static pairs (default: true).
+    /// Models of fixed bodies are classified as static when added to the collision system; with
+    /// culling enabled, pairs in which both objects are static are rejected at the broadphase
+    /// filter level, before any pair bookkeeping or narrowphase dispatch. Contacts between two
+    /// fixed bodies never produce active constraints, so this only removes overhead; disable it
+    /// if such contacts must still be reported (e.g. for custom contact processing).
+    /// Note that a body fixed or released *after* its model was added keeps its classification
+    /// until the model is removed and re-added.
+    void SetStaticPairCulling(bool val);
+
+    /// Return whether broadphase culling of static-static pairs is enabled.
+    bool GetStaticPairCulling() const;
+
+    /// Optimize the broadphase tree holding the non-moving objects.
+    /// The Bullet dbvt broadphase keeps static geometry in a dedicated BVH that is optimized only
+    /// incrementally; after a large static environment has been added (and before long simulation
+    /// runs), calling this once performs a full rebalance, improving the quality of all subsequent
+    /// dynamic-vs-static queries against the prebuilt tree.
+    void OptimizeStaticTree();
+
     // Get the underlying Bullet collision world.
     cbtCollisionWorld* GetBulletCollisionWorld() { return bt_collision_world; }
 
@@ -132,6 +155,12 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                 short int filter_group,
                 short int filter_mask) const;
 
+    /// Process one Bullet contact manifold, appending the resulting collision pair information
+    /// (without executing user callbacks) to the given buffer.
+    void ProcessManifold(cbtPersistentManifold* manifold, std::vector<ChCollisionInfo>& buffer);
+
+    int m_nthreads;  ///< number of threads used in parallel manifold processing
+
     cbtCollisionConfiguration* bt_collision_configuration;
     cbtCollisionDispatcher* bt_dispatcher;
     cbtBroadphaseInterface* bt_broadphase;
@@ -149,6 +178,8 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     cbtCollisionAlgorithmCreateFunc* m_emptyCreateFunc;
 
     cbtIDebugDraw* m_debug_drawer;
+
+    cbtOverlapFilterCallback* m_filter_callback;  ///< broadphase filter with static-static culling
 };
 
 /// @} collision_bullet
@@ -17,6 +17,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/physics/ChSystem.h"
 #include "chrono/collision/ChCollisionSystemChrono.h"
 #include "chrono/collision/chrono/ChRayTest.h"
@@ -24,7 +26,8 @@
 namespace chrono {
 namespace collision {
 
-ChCollisionSystemChrono::ChCollisionSystemChrono() : use_aabb_active(false) {
+ChCollisionSystemChrono::ChCollisionSystemChrono()
+    : use_speculative(false), max_speculative_margin(0), speculative_margin(0), use_aabb_active(false) {
     // Create the shared data structure with own state data
     cd_data = chrono_types::make_shared<ChCollisionData>(true);
     cd_data->collision_envelope = ChCollisionModel::GetDefaultSuggestedEnvelope();
@@ -56,10 +59,30 @@ void ChCollisionSystemChrono::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemChrono::SetBroadphaseAlgorithm(ChBroadphase::Algorithm algorithm) {
+    broadphase.algorithm = algorithm;
+}
+
 void ChCollisionSystemChrono::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
 
+void ChCollisionSystemChrono::EnableNarrowphasePersistentManifolds(bool val) {
+    narrowphase.use_persistent_manifolds = val;
+}
+
+void ChCollisionSystemChrono::EnableDeterministicContactOrder(bool val) {
+    narrowphase.deterministic_order = val;
+}
+
+void ChCollisionSystemChrono::EnableSpeculativeContacts(bool val) {
+    use_speculative = val;
+}
+
+void ChCollisionSystemChrono::SetMaxSpeculativeMargin(double margin) {
+    max_speculative_margin = real(margin);
+}
+
 void ChCollisionSystemChrono::EnableActiveBoundingBox(const ChVector<>& aabb_min, const ChVector<>& aabb_max) {
     active_aabb_min = FromChVector(aabb_min);
     active_aabb_max = FromChVector(aabb_max);
@@ -109,7 +132,7 @@ void ChCollisionSystemChrono::Add(ChCollisionModel* model) {
     ChCollisionModelChrono* pmodel = static_cast<ChCollisionModelChrono*>(model);
 
     int body_id = pmodel->GetBody()->GetId();
-    short2 fam = S2(pmodel->GetFamilyGroup(), pmodel->GetFamilyMask());
+    vec2 fam = I2(pmodel->GetFamilyGroup(), pmodel->GetFamilyMask());
     // The offset for this shape will the current total number of points in the convex data list
     auto& shape_data = cd_data->shape_data;
     int convex_data_offset = (int)shape_data.convex_rigid.size();
@@ -311,6 +334,9 @@ void ChCollisionSystemChrono::PreProcess() {
     cd_data->state_data.num_rigid_bodies = nbodies;
     cd_data->state_data.num_fluid_bodies = 0;
 
+    if (use_speculative)
+        vel_rigid.resize(nbodies);
+
 #pragma omp parallel for
     for (int i = 0; i < nbodies; i++) {
         const auto& body = blist[i];
@@ -321,6 +347,11 @@ void ChCollisionSystemChrono::PreProcess() {
         position[i] = real3(body_pos.x(), body_pos.y(), body_pos.z());
         rotation[i] = quaternion(body_rot.e0(), body_rot.e1(), body_rot.e2(), body_rot.e3());
 
+        if (use_speculative) {
+            const ChVector<>& body_vel = body->GetPos_dt();
+            vel_rigid[i] = real3(body_vel.x(), body_vel.y(), body_vel.z());
+        }
+
         active[i] = body->IsActive();
         collide[i] = body->GetCollide();
     }
@@ -359,16 +390,55 @@ void ChCollisionSystemChrono::Run() {
         }
     }
 
+    // Speculative margin for this step: the distance covered by the fastest body over the upcoming step,
+    // optionally clamped to the user-specified bound.
+    speculative_margin = 0;
+    if (use_speculative) {
+        const real dt = real(m_system->GetStep());
+        real max_speed = 0;
+        for (const auto& v : vel_rigid)
+            max_speed = Max(max_speed, Length(v));
+        speculative_margin = max_speed * dt;
+        if (max_speculative_margin > 0)
+            speculative_margin = Min(speculative_margin, max_speculative_margin);
+    }
+
     // Broadphase
     m_timer_broad.start();
     GenerateAABB();
+    if (use_speculative && speculative_margin > 0) {
+        // Sweep each shape AABB along its body velocity over the upcoming step, so that pairs which may come in
+        // contact during the step are retained as broadphase candidates. The sweep is directional; resting shapes
+        // keep their regular (envelope-inflated) AABB.
+        const real dt = real(m_system->GetStep());
+        const std::vector<uint>& id_rigid = cd_data->shape_data.id_rigid;
+        const uint num_rigid_shapes = cd_data->num_rigid_shapes;
+
+#pragma omp parallel for
+        for (int index = 0; index < (signed)num_rigid_shapes; index++) {
+            uint id = id_rigid[index];
+            if (id == UINT_MAX)
+                continue;
+            real3 sweep = Clamp(vel_rigid[id] * dt, speculative_margin);
+            cd_data->aabb_min[index] += Min(sweep, real3(0));
+            cd_data->aabb_max[index] += Max(sweep, real3(0));
+        }
+    }
     broadphase.Process();
     m_timer_broad.stop();
 
     // Narrowphase
+    // When speculative contacts are enabled, the narrowphase detection margin is temporarily enlarged by the
+    // speculative margin, so that candidate pairs still separated by up to that distance produce (positive-gap)
+    // contacts. The pairs reaching the narrowphase were selected by the velocity-swept AABBs above, so resting
+    // pairs are not affected by the enlarged margin.
+    const real base_envelope = cd_data->collision_envelope;
+    if (use_speculative)
+        cd_data->collision_envelope = base_envelope + speculative_margin;
     m_timer_narrow.start();
     narrowphase.Process();
     m_timer_narrow.stop();
+    cd_data->collision_envelope = base_envelope;
 }
 
 // -----------------------------------------------------------------------------
@@ -406,6 +476,22 @@ void ChCollisionSystemChrono::ReportContacts(ChContactContainer* container) {
         cinfo.distance = cd_data->dpth_rigid_rigid[i];
         cinfo.eff_radius = cd_data->erad_rigid_rigid[i];
 
+        // Classify and filter speculative contacts, i.e. contacts whose gap exceeds the regular envelope and which
+        // were generated only because of the enlarged speculative margin. Such a contact is worth a constraint only
+        // if the pair can actually close the gap within the upcoming step (time of impact below the step size, under
+        // a constant-velocity estimate); separating or slowly-approaching pairs are dropped, so the solver problem
+        // does not grow in resting configurations. A retained speculative contact has a positive distance, whose
+        // -distance/h stabilization term bounds the approach speed and prevents tunneling within the step.
+        if (use_speculative && cinfo.distance > (double)cd_data->collision_envelope) {
+            double dt = m_system->GetStep();
+            ChVector<> vel_pA = blist[b1]->GetContactPointSpeed(cinfo.vpA);
+            ChVector<> vel_pB = blist[b2]->GetContactPointSpeed(cinfo.vpB);
+            double gap_rate = Vdot(vel_pB - vel_pA, cinfo.vN);
+            if (cinfo.distance + gap_rate * dt > (double)cd_data->collision_envelope)
+                continue;
+            cinfo.is_speculative = true;
+        }
+
         // Execute user custom callback, if any
         bool add_contact = true;
         if (this->narrow_callback)
@@ -654,6 +740,45 @@ bool ChCollisionSystemChrono::RayHit(const ChVector<>& from,
     return false;
 }
 
+int ChCollisionSystemChrono::RayHitBatch(const std::vector<ChVector<>>& from,
+                                         const std::vector<ChVector<>>& to,
+                                         std::vector<ChRayhitResult>& results) const {
+    int num_rays = (int)std::min(from.size(), to.size());
+    results.resize(num_rays);
+
+    if (cd_data->num_active_bins == 0) {
+        for (int i = 0; i < num_rays; i++)
+            results[i].hit = false;
+        return 0;
+    }
+
+    int num_hits = 0;
+
+    // Each thread traverses the shared broadphase grid with its own tester (ChRayTest carries per-test counters
+    // and is cheap to construct).
+#pragma omp parallel reduction(+ : num_hits)
+    {
+        ChRayTest tester(cd_data);
+        ChRayTest::RayHitInfo info;
+#pragma omp for schedule(dynamic, 256)
+        for (int i = 0; i < num_rays; i++) {
+            if (tester.Check(FromChVector(from[i]), FromChVector(to[i]), info)) {
+                results[i].hit = true;
+                results[i].abs_hitNormal = ToChVector(info.normal);
+                results[i].abs_hitPoint = ToChVector(info.point);
+                results[i].dist_factor = info.t;
+                uint bid = cd_data->shape_data.id_rigid[info.shapeID];
+                results[i].hitModel = m_system->Get_bodylist()[bid]->GetCollisionModel().get();
+                num_hits++;
+            } else {
+                results[i].hit = false;
+            }
+        }
+    }
+
+    return num_hits;
+}
+
 // -----------------------------------------------------------------------------
 
 void DrawHemisphere(ChCollisionSystem::VisualizationCallback* vis,
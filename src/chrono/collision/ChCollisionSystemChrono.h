@@ -67,12 +67,58 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Set the broadphase algorithm (default: ChBroadphase::Algorithm::AUTOMATIC).
+    /// In two-level mode, the collision shapes are split in two size classes based on their AABB sizes: small shapes
+    /// are binned in the uniform grid, while the (few) large shapes are swept directly against all other shapes. This
+    /// avoids compromising the grid resolution in scenes which mix shapes of very different scales (e.g., large
+    /// machinery interacting with fine granular material). In automatic mode, the two-level scheme is engaged whenever
+    /// the shape AABB statistics exhibit two well-separated size classes.
+    void SetBroadphaseAlgorithm(ChBroadphase::Algorithm algorithm);
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     void SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm);
 
+    /// Enable caching of contact manifolds across steps in the narrowphase (default: false).
+    /// When enabled, the contacts of a collision pair are kept in a persistent manifold and reused, after mapping to
+    /// the current body poses, for as long as the relative motion of the pair stays below a small threshold tied to
+    /// the collision envelope. Full narrowphase collision detection (analytical or MPR) is performed only for pairs
+    /// with appreciable relative motion. This can significantly reduce the narrowphase cost in simulations dominated
+    /// by resting contacts (e.g., settled beds of granular material).
+    void EnableNarrowphasePersistentManifolds(bool val);
+
+    /// Enable deterministic ordering of contacts (default: false).
+    /// Parallel narrowphase collision detection can produce contact orderings that depend on the number of threads,
+    /// which in turn perturbs the results of iterative solvers and breaks bitwise-reproducible replays. When enabled,
+    /// contacts are sorted (in parallel) into a canonical order given by the stable keys (body ID pair, shape ID pair)
+    /// before being reported, so results are independent of the parallel schedule and thread count.
+    void EnableDeterministicContactOrder(bool val);
+
+    /// Enable speculative contact generation for fast-moving bodies (default: false).
+    /// With purely discrete detection, a shape moving faster than (envelope / step size) can traverse the collision
+    /// envelope of a thin obstacle within a single step and tunnel through it; preventing this requires shrinking the
+    /// time step to match the fastest body. When speculative contacts are enabled, each shape AABB is additionally
+    /// swept along its body velocity over the upcoming step before the broadphase, and the narrowphase detection
+    /// margin is enlarged by the resulting speculative margin, so that contact constraints are created while the pair
+    /// is still separated. Speculative contacts carry a positive distance (gap); the NSC complementarity stabilization
+    /// term -gap/h then bounds the approach speed so the gap cannot be overshot within the step, which provides
+    /// continuous-collision behavior without any additional solves. Contacts generated in the speculative band whose
+    /// time of impact exceeds the step size (separating pairs, or pairs approaching too slowly to close the gap) are
+    /// filtered out before being reported, so resting configurations do not pay for the enlarged margin.
+    /// Only the linear body velocity is used for the sweep; the rotational surface velocity of a shape is assumed to
+    /// be covered by the regular envelope (the feature targets small fast bodies, e.g. pellets, for which the
+    /// rotational contribution is negligible).
+    void EnableSpeculativeContacts(bool val);
+
+    /// Set an upper bound on the speculative contact margin (default: 0, meaning no bound).
+    /// The speculative margin is computed at each step as (maximum body speed) * (step size); a single very fast body
+    /// would otherwise enlarge the narrowphase detection margin for the entire system. If a positive value is
+    /// specified, the margin (and the per-shape AABB sweep) is clamped to it; bodies fast enough to exceed the bound
+    /// may then tunnel, exactly as with plain discrete detection.
+    void SetMaxSpeculativeMargin(double margin);
+
     /// Enable monitoring of shapes outside active bounding box (default: false).
     /// If enabled, objects whose collision shapes exit the active bounding box are deactivated (frozen).
     /// The size of the bounding box is specified by its min and max extents.
@@ -136,6 +182,15 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests for a batch of rays against all collision models.
+    /// The i-th ray extends from 'from[i]' to 'to[i]' and its test result is written to 'results[i]' (the output
+    /// vector is resized as needed). Rays are distributed over OpenMP threads, each traversing the shared
+    /// broadphase grid independently; for large batches (lidar simulation, terrain queries) this is considerably
+    /// faster than issuing individual RayHit calls. Returns the number of rays that hit a collision shape.
+    int RayHitBatch(const std::vector<ChVector<>>& from,
+                    const std::vector<ChVector<>>& to,
+                    std::vector<ChRayhitResult>& results) const;
+
     /// Method to trigger debug visualization of collision shapes.
     /// The 'flags' argument can be any of the VisualizationModes enums, or a combination thereof (using bit-wise
     /// operators). The calling program must invoke this function from within the simulation loop. No-op if a
@@ -168,6 +223,11 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
 
     std::vector<char> body_active;
 
+    bool use_speculative;          ///< enable speculative contact generation
+    real max_speculative_margin;   ///< upper bound on the speculative margin (0: unbounded)
+    real speculative_margin;       ///< speculative margin used in the current Run()
+    std::vector<real3> vel_rigid;  ///< body linear velocities, packed in PreProcess when speculative contacts enabled
+
     bool use_aabb_active;   ///< enable freezing of objects outside the active bounding box
     real3 active_aabb_min;  ///< lower corner of active bounding box
     real3 active_aabb_max;  ///< upper corner of active bounding box
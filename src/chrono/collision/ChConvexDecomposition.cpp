@@ -12,6 +12,11 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
 #include "chrono/collision/ChConvexDecomposition.h"
 #include "chrono_thirdparty/HACDv2/wavefront.h"
 
@@ -94,6 +99,41 @@ bool ChConvexDecomposition::WriteConvexHullsAsChullsFile(ChStreamOutAscii& mstre
     return true;
 }
 
+void ChConvexDecomposition::ComputeConvexDecompositions(
+    const std::vector<std::shared_ptr<ChConvexDecomposition>>& batch,
+    int nthreads) {
+    if (batch.empty())
+        return;
+
+    size_t num_workers = (nthreads > 0) ? (size_t)nthreads : (size_t)std::thread::hardware_concurrency();
+    num_workers = std::min(std::max(num_workers, (size_t)1), batch.size());
+
+    // Workers pull the next pending decomposition from a shared atomic counter, so large
+    // meshes do not stall the others. Each object owns its own decomposition state, hence
+    // running them on different threads is safe.
+    std::atomic<size_t> next(0);
+    auto worker = [&batch, &next]() {
+        while (true) {
+            size_t i = next.fetch_add(1);
+            if (i >= batch.size())
+                return;
+            if (batch[i])
+                batch[i]->ComputeConvexDecomposition();
+        }
+    };
+
+    if (num_workers == 1) {
+        worker();
+        return;
+    }
+
+    std::vector<std::thread> pool;
+    for (size_t it = 0; it < num_workers; it++)
+        pool.emplace_back(worker);
+    for (auto& pthread : pool)
+        pthread.join();
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -288,6 +328,7 @@ ChConvexDecompositionHACDv2::ChConvexDecompositionHACDv2() {
     gHACD = HACD::createHACD_API();
 
     this->fuse_tol = 1e-9;
+    this->use_cached_hulls = false;
 }
 
 /// Destructor
@@ -301,6 +342,8 @@ void ChConvexDecompositionHACDv2::Reset(void) {
 
     this->points.clear();
     this->triangles.clear();
+    this->cached_hulls.clear();
+    this->use_cached_hulls = false;
 }
 
 bool ChConvexDecompositionHACDv2::AddTriangle(const ChVector<>& v1, const ChVector<>& v2, const ChVector<>& v3) {
@@ -359,6 +402,30 @@ int ChConvexDecompositionHACDv2::ComputeConvexDecomposition() {
     std::vector<ChVector<int> > triangles_FUSED;
     FuseMesh(this->points, this->triangles, points_FUSED, triangles_FUSED, this->fuse_tol);
 
+    // If the cooking cache is enabled, look for a cached result, keyed by a hash of the fused
+    // mesh content and of the decomposition parameters (so changing either invalidates the entry).
+
+    this->cached_hulls.clear();
+    this->use_cached_hulls = false;
+
+    std::string cache_file;
+    if (!ChCollisionCookingCache::GetDir().empty()) {
+        char params[128];
+        sprintf(params, "HACDv2_%u_%u_%u_%g_%g_%g", this->descriptor.mMaxHullCount,
+                this->descriptor.mMaxMergeHullCount, this->descriptor.mMaxHullVertices, this->descriptor.mConcavity,
+                this->descriptor.mSmallClusterThreshold, this->fuse_tol);
+        uint64_t hash = ChCollisionCookingCache::Hash(params, strlen(params));
+        hash = ChCollisionCookingCache::Hash(points_FUSED.data(), points_FUSED.size() * sizeof(ChVector<double>), hash);
+        hash = ChCollisionCookingCache::Hash(triangles_FUSED.data(), triangles_FUSED.size() * sizeof(ChVector<int>),
+                                             hash);
+        cache_file = ChCollisionCookingCache::Filename("hacdv2", hash);
+
+        if (ChCollisionCookingCache::LoadHullMeshes(cache_file, this->cached_hulls)) {
+            this->use_cached_hulls = true;
+            return (int)this->cached_hulls.size();
+        }
+    }
+
     // Convert to HACD format
 
     this->descriptor.mTriangleCount = (hacd::HaU32)triangles_FUSED.size();
@@ -388,16 +455,48 @@ int ChConvexDecompositionHACDv2::ComputeConvexDecomposition() {
     this->descriptor.mTriangleCount = 0;
     this->descriptor.mVertexCount = 0;
 
+    // Store the result in the cooking cache, for later runs of the same asset revision.
+
+    if (!cache_file.empty()) {
+        std::vector<ChCollisionCookingCache::HullMesh> hulls(hullCount);
+        for (hacd::HaU32 j = 0; j < hullCount; j++) {
+            const HACD::HACD_API::Hull* hull = gHACD->getHull(j);
+            if (!hull)
+                continue;
+            for (hacd::HaU32 i = 0; i < hull->mVertexCount; i++) {
+                const hacd::HaF32* p = &hull->mVertices[i * 3];
+                hulls[j].points.push_back(ChVector<double>(p[0], p[1], p[2]));
+            }
+            for (hacd::HaU32 i = 0; i < hull->mTriangleCount; i++) {
+                hulls[j].triangles.push_back(ChVector<int>((int)hull->mIndices[i * 3 + 0],
+                                                           (int)hull->mIndices[i * 3 + 1],
+                                                           (int)hull->mIndices[i * 3 + 2]));
+            }
+        }
+        ChCollisionCookingCache::SaveHullMeshes(cache_file, hulls);
+    }
+
     return hullCount;
 }
 
 /// Get the number of computed hulls after the convex decomposition
 unsigned int ChConvexDecompositionHACDv2::GetHullCount() {
+    if (this->use_cached_hulls)
+        return (unsigned int)this->cached_hulls.size();
+
     return this->gHACD->getHullCount();
 }
 
 bool ChConvexDecompositionHACDv2::GetConvexHullResult(unsigned int hullIndex,
                                                       std::vector<ChVector<double> >& convexhull) {
+    if (this->use_cached_hulls) {
+        if (hullIndex >= this->cached_hulls.size())
+            return false;
+        const auto& hull = this->cached_hulls[hullIndex];
+        convexhull.insert(convexhull.end(), hull.points.begin(), hull.points.end());
+        return true;
+    }
+
     if (hullIndex > this->gHACD->getHullCount())
         return false;
 
@@ -416,6 +515,15 @@ bool ChConvexDecompositionHACDv2::GetConvexHullResult(unsigned int hullIndex,
 /// Get the n-th computed convex hull, by filling a ChTriangleMesh object
 /// that is passed as a parameter.
 bool ChConvexDecompositionHACDv2::GetConvexHullResult(unsigned int hullIndex, geometry::ChTriangleMesh& convextrimesh) {
+    if (this->use_cached_hulls) {
+        if (hullIndex >= this->cached_hulls.size())
+            return false;
+        const auto& hull = this->cached_hulls[hullIndex];
+        for (const auto& tri : hull.triangles)
+            convextrimesh.addTriangle(hull.points[tri.x()], hull.points[tri.y()], hull.points[tri.z()]);
+        return true;
+    }
+
     if (hullIndex > this->gHACD->getHullCount())
         return false;
 
@@ -443,6 +551,22 @@ void ChConvexDecompositionHACDv2::WriteConvexHullsAsWavefrontObj(ChStreamOutAsci
 
     char buffer[200];
 
+    if (this->use_cached_hulls) {
+        unsigned int vcount_base = 1;
+        for (const auto& hull : this->cached_hulls) {
+            for (const auto& p : hull.points) {
+                sprintf(buffer, "v %0.9f %0.9f %0.9f\r\n", p.x(), p.y(), p.z());
+                mstream << buffer;
+            }
+            for (const auto& tri : hull.triangles) {
+                sprintf(buffer, "f %d %d %d\r\n", tri.x() + vcount_base, tri.y() + vcount_base, tri.z() + vcount_base);
+                mstream << buffer;
+            }
+            vcount_base += (unsigned int)hull.points.size();
+        }
+        return;
+    }
+
     hacd::HaU32* baseVertex = new hacd::HaU32[GetHullCount()];
     hacd::HaU32 vertexCount = 0;
     for (hacd::HaU32 i = 0; i < GetHullCount(); i++) {
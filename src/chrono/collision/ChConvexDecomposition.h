@@ -15,7 +15,10 @@
 #ifndef CH_CONVEX_DECOMPOSITION_H
 #define CH_CONVEX_DECOMPOSITION_H
 
+#include <memory>
+
 #include "chrono/core/ChApiCE.h"
+#include "chrono/collision/ChCollisionCookingCache.h"
 #include "chrono/geometry/ChTriangleMeshSoup.h"
 
 #include "chrono_thirdparty/HACD/hacdHACD.h"
@@ -73,6 +76,16 @@ class ChApi ChConvexDecomposition {
     /// '.obj' fileformat, with each hull as a separate group.
     /// May throw exceptions if file locked etc.
     virtual void WriteConvexHullsAsWavefrontObj(ChStreamOutAscii& mstream) = 0;
+
+    /// Perform the convex decomposition of a batch of meshes in parallel, across a pool of
+    /// worker threads. Each decomposition object in the batch must already have its input mesh
+    /// and parameters set; on return, results are queried from each object as usual.
+    /// Useful when many assets must be decomposed at load time (e.g. the parts of a vehicle
+    /// interior); combined with the cooking cache (see ChCollisionCookingCache) the cost is
+    /// paid once per asset revision instead of once per run.
+    /// If \a nthreads is 0 (the default), the hardware concurrency is used.
+    static void ComputeConvexDecompositions(const std::vector<std::shared_ptr<ChConvexDecomposition>>& batch,
+                                            int nthreads = 0);
 };
 
 /// Class for wrapping the HACD convex decomposition code by Khaled Mamou.
@@ -182,6 +195,9 @@ class ChApi ChConvexDecompositionHACDv2 : public ChConvexDecomposition {
     /// Quality of the results can depend a lot on the parameters. Also, meshes
     /// with triangles that are not well oriented (normals always pointing outside)
     /// or with gaps/holes, may give wrong results.
+    /// If the cooking cache is enabled (see ChCollisionCookingCache) and holds an entry for
+    /// this mesh content and these parameters, the cached result is loaded instead of running
+    /// the decomposition; on a cache miss the computed result is stored for later runs.
     virtual int ComputeConvexDecomposition();
 
     /// Get the number of computed hulls after the convex decomposition
@@ -206,6 +222,9 @@ class ChApi ChConvexDecompositionHACDv2 : public ChConvexDecomposition {
     std::vector<ChVector<double> > points;
     std::vector<ChVector<int> > triangles;
     double fuse_tol;
+
+    std::vector<ChCollisionCookingCache::HullMesh> cached_hulls;  ///< result loaded from the cooking cache
+    bool use_cached_hulls;                                        ///< serve results from cached_hulls
 };
 
 /// @} chrono_collision
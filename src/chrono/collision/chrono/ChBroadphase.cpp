@@ -39,6 +39,8 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      algorithm(Algorithm::AUTOMATIC),
+      size_class_factor(8),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -219,15 +221,327 @@ void ChBroadphase::Process() {
     ComputeTopLevelResolution();
 
     if (cd_data->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        if (algorithm == Algorithm::MORTON_TREE && cd_data->state_data.num_fluid_bodies == 0) {
+            // Linear BVH over Morton-sorted shapes (no grid). Note that the grid data consumed by
+            // rigid-particle narrowphase is not produced, hence the restriction to rigid-only systems.
+            MortonTreeBroadphase();
+        } else {
+            // If requested (or if automatic selection finds two well-separated size classes), bin only the small
+            // shapes in the grid and process the few large shapes with a direct sweep against all other shapes.
+            bool two_level = (algorithm != Algorithm::ONE_LEVEL) && (algorithm != Algorithm::MORTON_TREE) &&
+                             PartitionShapes();
+            if (two_level) {
+                OneLevelBroadphase(masked_id);
+                SweepLargeShapes();
+            } else {
+                OneLevelBroadphase(cd_data->shape_data.id_rigid);
+            }
+        }
         cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
     }
     return;
 }
 
-void ChBroadphase::OneLevelBroadphase() {
+// Spread the lowest 21 bits of x, inserting two zero bits between consecutive bits.
+static inline uint64_t morton_expand_bits(uint64_t x) {
+    x &= 0x1fffffull;
+    x = (x | x << 32) & 0x1f00000000ffffull;
+    x = (x | x << 16) & 0x1f0000ff0000ffull;
+    x = (x | x << 8) & 0x100f00f00f00f00full;
+    x = (x | x << 4) & 0x10c30c30c30c30c3ull;
+    x = (x | x << 2) & 0x1249249249249249ull;
+    return x;
+}
+
+// Broadphase based on a linear bounding volume hierarchy:
+// - compute the Morton code of each active shape AABB centroid (21 bits per axis over the overall
+//   bounding box) and radix-sort the shapes by it, so that spatially close shapes become neighbors;
+// - build a complete binary tree over the sorted leaves, with node AABBs computed bottom-up
+//   (one parallel pass per level);
+// - for each leaf, walk the tree and collect overlapping leaves at higher sorted positions
+//   (so that each pair is discovered exactly once), with a count + exclusive scan + store sequence
+//   to size the output exactly.
+// Unlike the uniform grid, the tree adapts to the shape distribution, with no cell overflow in
+// regions of high density.
+void ChBroadphase::MortonTreeBroadphase() {
     const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
-    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<vec2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    // The grid measures do not apply to this pipeline
+    cd_data->num_bins = 0;
+    cd_data->num_active_bins = 0;
+    cd_data->num_bin_aabb_intersections = 0;
+
+    // Collect the active shapes (the tree leaves)
+    tree_leaves.clear();
+    tree_leaves.reserve(num_shapes);
+    for (int i = 0; i < num_shapes; i++) {
+        if (obj_data_id[i] != UINT_MAX)
+            tree_leaves.push_back(i);
+    }
+    uint num_active = (uint)tree_leaves.size();
+
+    if (num_active < 2) {
+        num_possible_collisions = 0;
+        pair_shapeIDs.resize(0);
+        return;
+    }
+
+    // Morton code of each AABB centroid, normalized over the overall bounding box
+    // (AABBs were already offset to the global origin)
+    real3 diag = Abs(cd_data->max_bounding_point - cd_data->global_origin);
+    real3 inv_diag;
+    inv_diag.x = diag.x > 0 ? 1 / diag.x : 0;
+    inv_diag.y = diag.y > 0 ? 1 / diag.y : 0;
+    inv_diag.z = diag.z > 0 ? 1 / diag.z : 0;
+
+    tree_codes.resize(num_active);
+#pragma omp parallel for
+    for (int k = 0; k < (signed)num_active; k++) {
+        int i = tree_leaves[k];
+        real3 c = 0.5 * (aabb_min[i] + aabb_max[i]);
+        uint64_t cx = (uint64_t)(Min(Max(c.x * inv_diag.x, real(0)), real(1)) * 2097151);
+        uint64_t cy = (uint64_t)(Min(Max(c.y * inv_diag.y, real(0)), real(1)) * 2097151);
+        uint64_t cz = (uint64_t)(Min(Max(c.z * inv_diag.z, real(0)), real(1)) * 2097151);
+        tree_codes[k] = (morton_expand_bits(cx) << 2) | (morton_expand_bits(cy) << 1) | morton_expand_bits(cz);
+    }
+
+    // Sort the leaves by Morton code, so that spatially close shapes become neighbors
+    Thrust_Sort_By_Key(tree_codes, tree_leaves);
+
+    // Build a complete binary tree over the sorted leaves (heap layout, root at node 1, leaves
+    // at nodes [num_leaf_slots, 2*num_leaf_slots); unused leaf slots get an inverted AABB).
+    uint num_leaf_slots = 1;
+    while (num_leaf_slots < num_active)
+        num_leaf_slots *= 2;
+
+    tree_min.resize(2 * num_leaf_slots);
+    tree_max.resize(2 * num_leaf_slots);
+
+    const real3 empty_min = real3(+C_REAL_MAX, +C_REAL_MAX, +C_REAL_MAX);
+    const real3 empty_max = real3(-C_REAL_MAX, -C_REAL_MAX, -C_REAL_MAX);
+
+#pragma omp parallel for
+    for (int k = 0; k < (signed)num_leaf_slots; k++) {
+        if (k < (signed)num_active) {
+            int i = tree_leaves[k];
+            tree_min[num_leaf_slots + k] = aabb_min[i];
+            tree_max[num_leaf_slots + k] = aabb_max[i];
+        } else {
+            tree_min[num_leaf_slots + k] = empty_min;
+            tree_max[num_leaf_slots + k] = empty_max;
+        }
+    }
+
+    // Node AABBs, bottom-up one level at a time
+    for (uint level = num_leaf_slots / 2; level >= 1; level /= 2) {
+#pragma omp parallel for
+        for (int n = level; n < (signed)(2 * level); n++) {
+            tree_min[n] = Min(tree_min[2 * n], tree_min[2 * n + 1]);
+            tree_max[n] = Max(tree_max[2 * n], tree_max[2 * n + 1]);
+        }
+    }
+
+    // Walk the tree for the leaf at sorted position k, applying the same pair filters as the grid
+    // pipeline. Only leaves at higher sorted positions are collected, so that each pair is
+    // discovered exactly once (from its lower-position member). If 'pairs' is null only count;
+    // otherwise also store the shape ID pairs.
+    auto traverse = [&](uint k, long long* pairs) -> uint {
+        int i = tree_leaves[k];
+        uint bodyA = obj_data_id[i];
+        uint count = 0;
+        uint stack[64];
+        uint stack_size = 0;
+        stack[stack_size++] = 1;
+        while (stack_size > 0) {
+            uint n = stack[--stack_size];
+            if (!overlap(aabb_min[i], aabb_max[i], tree_min[n], tree_max[n]))
+                continue;
+            if (n < num_leaf_slots) {
+                stack[stack_size++] = 2 * n;
+                stack[stack_size++] = 2 * n + 1;
+                continue;
+            }
+            uint kj = n - num_leaf_slots;
+            if (kj <= k || kj >= num_active)
+                continue;
+            int j = tree_leaves[kj];
+            uint bodyB = obj_data_id[j];
+            if (bodyA == bodyB)
+                continue;
+            if (!obj_collide[bodyA] || !obj_collide[bodyB])
+                continue;
+            if (!obj_active[bodyA] && !obj_active[bodyB])
+                continue;
+            if (!collide(fam_data[i], fam_data[j]))
+                continue;
+            if (pairs) {
+                uint shapeA = (uint)std::min(i, j);
+                uint shapeB = (uint)std::max(i, j);
+                pairs[count] = ((long long)shapeA << 32 | (long long)shapeB);
+            }
+            count++;
+        }
+        return count;
+    };
+
+    // Count candidate pairs per leaf, size the output exactly, and store the pairs
+    std::vector<uint> leaf_num_contact(num_active + 1);
+    leaf_num_contact[num_active] = 0;
+#pragma omp parallel for
+    for (int k = 0; k < (signed)num_active; k++)
+        leaf_num_contact[k] = traverse(k, nullptr);
+
+    Thrust_Exclusive_Scan(leaf_num_contact);
+    num_possible_collisions = leaf_num_contact.back();
+
+    pair_shapeIDs.resize(num_possible_collisions);
+#pragma omp parallel for
+    for (int k = 0; k < (signed)num_active; k++)
+        traverse(k, pair_shapeIDs.data() + leaf_num_contact[k]);
+}
+
+// Partition collision shapes in two size classes, based on the lengths of their AABB diagonals.
+// A shape is "large" if its AABB diagonal exceeds 'size_class_factor' times the median over all active shapes.
+// On success, 'masked_id' holds a copy of the shape IDs with large shapes disabled (set to UINT_MAX, so that they
+// are ignored by the grid pipeline) and 'large_shapes' holds the indices of the large shapes.
+// Return false (reverting to a one-level broadphase) if the partition is trivial or too unbalanced.
+bool ChBroadphase::PartitionShapes() {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const std::vector<uint>& id_rigid = cd_data->shape_data.id_rigid;
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    // Collect AABB diagonal lengths of all active shapes
+    std::vector<real> sizes;
+    sizes.reserve(num_shapes);
+    for (int i = 0; i < num_shapes; i++) {
+        if (id_rigid[i] == UINT_MAX)
+            continue;
+        sizes.push_back(Length(aabb_max[i] - aabb_min[i]));
+    }
+    uint num_active = (uint)sizes.size();
+    if (num_active < 2)
+        return false;
+
+    std::nth_element(sizes.begin(), sizes.begin() + num_active / 2, sizes.end());
+    real median = sizes[num_active / 2];
+    real threshold = size_class_factor * median;
+
+    large_shapes.clear();
+    for (int i = 0; i < num_shapes; i++) {
+        if (id_rigid[i] == UINT_MAX)
+            continue;
+        if (Length(aabb_max[i] - aabb_min[i]) > threshold)
+            large_shapes.push_back(i);
+    }
+
+    // Require a non-trivial large class, but keep the cost of the direct sweep (num_large * num_shapes)
+    // below that of a grid pass.
+    uint num_large = (uint)large_shapes.size();
+    if (num_large == 0 || num_large > num_active / 4)
+        return false;
+
+    // Mask out the large shapes for the grid pass
+    masked_id = id_rigid;
+    for (auto i : large_shapes)
+        masked_id[i] = UINT_MAX;
+
+    // With a density-based grid, resize the grid for the small size class only
+    if (grid_type == GridType::FIXED_DENSITY) {
+        real3 diag = Abs(cd_data->max_bounding_point - cd_data->global_origin);
+        cd_data->bins_per_axis = Compute_Grid_Resolution(num_active - num_large, diag, grid_density);
+        cd_data->bin_size = diag / real3(cd_data->bins_per_axis.x, cd_data->bins_per_axis.y, cd_data->bins_per_axis.z);
+        cd_data->inv_bin_size = 1.0 / cd_data->bin_size;
+    }
+
+    return true;
+}
+
+// Find candidate pairs involving the large shapes, by direct sweep of each large shape against all other shapes.
+// This applies the same pair filters as f_Count_AABB_AABB_Intersection and appends the new pairs to the list
+// produced by the grid pass over the small shapes.
+void ChBroadphase::SweepLargeShapes() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<vec2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+    const int num_large = (int)large_shapes.size();
+
+    // Check whether shapes i (large) and j may collide, mirroring the filters in the grid pipeline.
+    // A large-large pair is accepted only when scanning its first member, to avoid duplicates.
+    auto accept = [&](int i, int j) {
+        if (j == i)
+            return false;
+        uint bodyA = obj_data_id[i];
+        uint bodyB = obj_data_id[j];
+        if (bodyB == UINT_MAX)
+            return false;
+        if (masked_id[j] == UINT_MAX && j < i)
+            return false;
+        if (bodyA == bodyB)
+            return false;
+        if (!obj_collide[bodyA] || !obj_collide[bodyB])
+            return false;
+        if (!obj_active[bodyA] && !obj_active[bodyB])
+            return false;
+        if (!collide(fam_data[i], fam_data[j]))
+            return false;
+        if (!overlap(aabb_min[i], aabb_max[i], aabb_min[j], aabb_max[j]))
+            return false;
+        return true;
+    };
+
+    // Count candidate pairs per large shape
+    std::vector<uint> sweep_num_contact(num_large + 1);
+    sweep_num_contact[num_large] = 0;
+#pragma omp parallel for
+    for (int li = 0; li < num_large; li++) {
+        uint count = 0;
+        for (int j = 0; j < num_shapes; j++) {
+            if (accept(large_shapes[li], j))
+                count++;
+        }
+        sweep_num_contact[li] = count;
+    }
+
+    Thrust_Exclusive_Scan(sweep_num_contact);
+    uint num_sweep_collisions = sweep_num_contact.back();
+
+    // Append the new pairs to those found by the grid pass
+    pair_shapeIDs.resize(num_possible_collisions + num_sweep_collisions);
+#pragma omp parallel for
+    for (int li = 0; li < num_large; li++) {
+        int i = large_shapes[li];
+        uint offset = num_possible_collisions + sweep_num_contact[li];
+        for (int j = 0; j < num_shapes; j++) {
+            if (!accept(i, j))
+                continue;
+            uint shapeA = (uint)std::min(i, j);
+            uint shapeB = (uint)std::max(i, j);
+            pair_shapeIDs[offset++] = ((long long)shapeA << 32 | (long long)shapeB);
+        }
+    }
+
+    num_possible_collisions += num_sweep_collisions;
+}
+
+void ChBroadphase::OneLevelBroadphase(const std::vector<uint>& obj_data_id) {
+    const std::vector<vec2>& fam_data = cd_data->shape_data.fam_rigid;
 
     const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
     const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
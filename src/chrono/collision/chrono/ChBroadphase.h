@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/chrono/ChCollisionData.h"
 
@@ -37,6 +39,20 @@ class ChApi ChBroadphase {
         FIXED_DENSITY      ///< user-specified density of shapes per bin
     };
 
+    /// Broadphase algorithm.
+    enum class Algorithm {
+        ONE_LEVEL,   ///< single uniform grid over all shapes
+        TWO_LEVEL,   ///< uniform grid over small shapes + direct sweep for large shapes
+        AUTOMATIC,   ///< select one- or two-level based on the spread of shape AABB sizes
+        MORTON_TREE  ///< linear BVH over Morton-sorted shapes (see note below)
+    };
+    // Note: MORTON_TREE replaces the uniform grid with a bounding volume hierarchy over the shape
+    // AABBs, sorted by the Morton codes of their centroids. Unlike the grid, the tree adapts to the
+    // shape distribution and is therefore better suited for scenes with highly non-uniform density,
+    // where grid cells overflow. However, since no grid is built, this algorithm cannot serve ray
+    // intersection tests and does not support systems with 3-dof particles (for such systems, the
+    // broadphase silently reverts to the grid).
+
     ChBroadphase();
 
     /// Perform broadphase collision detection.
@@ -44,7 +60,10 @@ class ChApi ChBroadphase {
     void Process();
 
   private:
-    void OneLevelBroadphase();
+    void OneLevelBroadphase(const std::vector<uint>& obj_data_id);
+    bool PartitionShapes();
+    void SweepLargeShapes();
+    void MortonTreeBroadphase();
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
@@ -58,6 +77,17 @@ class ChApi ChBroadphase {
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
     real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
 
+    Algorithm algorithm;     ///< (input) broadphase algorithm
+    real size_class_factor;  ///< (input) ratio to median AABB size above which a shape is "large"
+
+    std::vector<uint> masked_id;   ///< work vector: shape IDs with large shapes masked out
+    std::vector<int> large_shapes; ///< work vector: indices of shapes handled by the direct sweep
+
+    std::vector<uint64_t> tree_codes;  ///< work vector: Morton codes of active shape AABB centroids
+    std::vector<uint> tree_leaves;     ///< work vector: active shape indices in Morton order
+    std::vector<real3> tree_min;       ///< work vector: node AABB minima (heap layout)
+    std::vector<real3> tree_max;       ///< work vector: node AABB maxima (heap layout)
+
     friend class ChCollisionSystemChrono;
     friend class ChCollisionSystemChronoMulticore;
 };
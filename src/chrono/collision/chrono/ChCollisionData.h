@@ -36,7 +36,7 @@ typedef int shape_type;
 struct shape_container {
     // All arrays of num_shapes length and indexed by the shape ID.
 
-    std::vector<short2> fam_rigid;  ///< family information
+    std::vector<vec2> fam_rigid;   ///< family information
     std::vector<uint> id_rigid;     ///< ID of associated body
     std::vector<int> typ_rigid;     ///< shape type
     std::vector<int> local_rigid;   ///< local shape index in collision model of associated body
@@ -96,7 +96,7 @@ class ChApi ChCollisionData {
           //
           p_collision_envelope(0),
           p_kernel_radius(real(0.04)),
-          p_collision_family(short2(1, 0x7FFF)),
+          p_collision_family(vec2(1, 0x7FFFFFFF)),
           //
           bins_per_axis(vec3(10, 10, 10)),
           //
@@ -152,7 +152,7 @@ class ChApi ChCollisionData {
 
     real p_collision_envelope;  ///< collision envelope for 3-dof particles
     real p_kernel_radius;       ///< 3-dof particle radius
-    short2 p_collision_family;  ///< collision family and family mask for 3-dof particles
+    vec2 p_collision_family;    ///< collision family and family mask for 3-dof particles
 
     // Collision detection output data
     // -------------------------------
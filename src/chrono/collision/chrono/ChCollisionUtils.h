@@ -84,7 +84,7 @@ inline vec3 Hash_Decode(uint hash, const vec3& bins_per_axis) {
 /// @{
 
 /// Check if two bodies interact using their collision family data.
-inline bool collide(const short2& fam_data_A, const short2& fam_data_B) {
+inline bool collide(const vec2& fam_data_A, const vec2& fam_data_B) {
     // Return true only if the bit corresponding to family of B is set in the mask
     // of A and vice-versa.
     return (fam_data_A.y & fam_data_B.x) && (fam_data_B.y & fam_data_A.x);
@@ -149,7 +149,7 @@ ChApi void f_Count_AABB_AABB_Intersection(const uint index,
                                           const std::vector<uint>& bin_number,
                                           const std::vector<uint>& aabb_number,
                                           const std::vector<uint>& bin_start_index,
-                                          const std::vector<short2>& fam_data,
+                                          const std::vector<vec2>& fam_data,
                                           const std::vector<char>& body_active,
                                           const std::vector<char>& body_collide,
                                           const std::vector<uint>& body_id,
@@ -165,7 +165,7 @@ ChApi void f_Store_AABB_AABB_Intersection(const uint index,
                                           const std::vector<uint>& aabb_number,
                                           const std::vector<uint>& bin_start_index,
                                           const std::vector<uint>& num_contact,
-                                          const std::vector<short2>& fam_data,
+                                          const std::vector<vec2>& fam_data,
                                           const std::vector<char>& body_active,
                                           const std::vector<char>& body_collide,
                                           const std::vector<uint>& body_id,
@@ -93,7 +93,7 @@ void f_Count_AABB_AABB_Intersection(const uint index,
                                     const std::vector<uint>& bin_number,
                                     const std::vector<uint>& aabb_number,
                                     const std::vector<uint>& bin_start_index,
-                                    const std::vector<short2>& fam_data,
+                                    const std::vector<vec2>& fam_data,
                                     const std::vector<char>& body_active,
                                     const std::vector<char>& body_collide,
                                     const std::vector<uint>& body_id,
@@ -110,7 +110,7 @@ void f_Count_AABB_AABB_Intersection(const uint index,
         uint shapeA = aabb_number[i];
         real3 Amin = aabb_min_data[shapeA];
         real3 Amax = aabb_max_data[shapeA];
-        short2 famA = fam_data[shapeA];
+        vec2 famA = fam_data[shapeA];
         uint bodyA = body_id[shapeA];
 
         if (bodyA == UINT_MAX)
@@ -157,7 +157,7 @@ void f_Store_AABB_AABB_Intersection(const uint index,
                                     const std::vector<uint>& aabb_number,
                                     const std::vector<uint>& bin_start_index,
                                     const std::vector<uint>& num_contact,
-                                    const std::vector<short2>& fam_data,
+                                    const std::vector<vec2>& fam_data,
                                     const std::vector<char>& body_active,
                                     const std::vector<char>& body_collide,
                                     const std::vector<uint>& body_id,
@@ -175,7 +175,7 @@ void f_Store_AABB_AABB_Intersection(const uint index,
         uint shapeA = aabb_number[i];
         real3 Amin = aabb_min_data[shapeA];
         real3 Amax = aabb_max_data[shapeA];
-        short2 famA = fam_data[shapeA];
+        vec2 famA = fam_data[shapeA];
         uint bodyA = body_id[shapeA];
 
         if (bodyA == UINT_MAX)
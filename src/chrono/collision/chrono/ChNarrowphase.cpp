@@ -27,6 +27,8 @@
 #include "chrono/ChConfig.h"
 #include <thrust/remove.h>
 #include <thrust/sort.h>
+#include <thrust/sequence.h>
+#include <thrust/gather.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/count.h>
 #include <thrust/iterator/constant_iterator.h>
@@ -41,6 +43,11 @@ ChNarrowphase::ChNarrowphase()
       num_potential_rigid_contacts(0),
       num_potential_fluid_contacts(0),
       num_potential_rigid_fluid_contacts(0),
+      deterministic_order(false),
+      use_persistent_manifolds(false),
+      manifold_pos_threshold(0),
+      manifold_rot_threshold(real(0.02)),
+      manifold_step(0),
       cd_data(nullptr) {}
 
 void ChNarrowphase::ClearContacts() {
@@ -231,6 +238,174 @@ void ChNarrowphase::Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC)
     }
 }
 
+void ChNarrowphase::RestoreCachedManifolds() {
+    const std::vector<uint>& obj_data_ID = cd_data->shape_data.id_rigid;
+    const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    const std::vector<real3>& body_pos = *cd_data->state_data.pos_rigid;
+    const std::vector<quaternion>& body_rot = *cd_data->state_data.rot_rigid;
+
+    std::vector<real3>& norm_data = cd_data->norm_rigid_rigid;
+    std::vector<real3>& cpta_data = cd_data->cpta_rigid_rigid;
+    std::vector<real3>& cptb_data = cd_data->cptb_rigid_rigid;
+    std::vector<real>& dpth_data = cd_data->dpth_rigid_rigid;
+    std::vector<real>& erad_data = cd_data->erad_rigid_rigid;
+    std::vector<vec2>& body_ids = cd_data->bids_rigid_rigid;
+
+    // Threshold on the relative translation of a pair; if not set explicitly, derive it from the
+    // collision envelope (motions well below the envelope cannot change the contact configuration
+    // appreciably).
+    real pos_threshold =
+        (manifold_pos_threshold > 0) ? manifold_pos_threshold : real(0.1) * cd_data->collision_envelope;
+    // The rotation check uses the quaternion dot product: |dot| = cos(angle/2) for the residual
+    // rotation between the current and the cached relative orientation.
+    real rot_threshold_dot = Cos(manifold_rot_threshold / 2);
+
+    pair_from_cache.resize(num_potential_rigid_contacts);
+    thrust::fill(pair_from_cache.begin(), pair_from_cache.end(), false);
+
+    // Concurrent cache lookups are safe in the loop below: no entries are inserted or removed, and
+    // each pair key is visited by exactly one iteration.
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+        auto cached = manifold_cache.find(pair_shapeIDs[index]);
+        if (cached == manifold_cache.end())
+            continue;
+        PairManifold& manifold = cached->second;
+
+        // Identify the two bodies associated with the shapes in this collision pair.
+        vec2 pair = I2(int(pair_shapeIDs[index] >> 32), int(pair_shapeIDs[index] & 0xffffffff));
+        uint ID_A = obj_data_ID[pair.x];
+        uint ID_B = obj_data_ID[pair.y];
+
+        const real3& pos_A = body_pos[ID_A];
+        const quaternion& rot_A = body_rot[ID_A];
+        const real3& pos_B = body_pos[ID_B];
+        const quaternion& rot_B = body_rot[ID_B];
+
+        // Current relative pose of body B with respect to body A. If the pair moved too much since
+        // its manifold was built, fall through to a full narrowphase pass.
+        real3 rel_pos = RotateT(pos_B - pos_A, rot_A);
+        quaternion rel_rot = Mult(Inv(rot_A), rot_B);
+        if (Length(rel_pos - manifold.rel_pos) > pos_threshold)
+            continue;
+        if (Abs(Dot(rel_rot, manifold.rel_rot)) < rot_threshold_dot)
+            continue;
+
+        // Map the cached contact geometry to the global frame at the current body poses and
+        // recompute the penetration depths, so that resting contacts track small body motions.
+        uint icoll = contact_index[index];
+        for (int i = 0; i < manifold.num_contacts; i++) {
+            real3 n = Rotate(manifold.norm[i], rot_A);
+            real3 pA = TransformLocalToParent(pos_A, rot_A, manifold.ptA[i]);
+            real3 pB = TransformLocalToParent(pos_B, rot_B, manifold.ptB[i]);
+            norm_data[icoll + i] = n;
+            cpta_data[icoll + i] = pA;
+            cptb_data[icoll + i] = pB;
+            dpth_data[icoll + i] = Dot(pA - pB, n);
+            erad_data[icoll + i] = manifold.erad[i];
+            body_ids[icoll + i] = I2(ID_A, ID_B);
+            contact_rigid_active[icoll + i] = true;
+        }
+
+        manifold.last_step = manifold_step;
+        pair_from_cache[index] = true;
+    }
+}
+
+void ChNarrowphase::UpdateManifoldCache() {
+    const std::vector<uint>& obj_data_ID = cd_data->shape_data.id_rigid;
+    const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    const std::vector<real3>& body_pos = *cd_data->state_data.pos_rigid;
+    const std::vector<quaternion>& body_rot = *cd_data->state_data.rot_rigid;
+
+    const std::vector<real3>& norm_data = cd_data->norm_rigid_rigid;
+    const std::vector<real3>& cpta_data = cd_data->cpta_rigid_rigid;
+    const std::vector<real3>& cptb_data = cd_data->cptb_rigid_rigid;
+    const std::vector<real>& erad_data = cd_data->erad_rigid_rigid;
+
+    // Cache the manifolds produced by the dispatch functions for reuse in subsequent steps. Note
+    // that the contact data arrays are still indexed by potential contact slot at this point
+    // (compaction happens after this function is called).
+    for (uint index = 0; index < num_potential_rigid_contacts; index++) {
+        if (pair_from_cache[index])
+            continue;
+
+        // The contacts of a pair occupy consecutive slots, starting at the pair's start index
+        // (see Dispatch_Finalize).
+        uint icoll = contact_index[index];
+        int max_contacts = (int)(contact_index[index + 1] - icoll);
+        int nC = 0;
+        while (nC < max_contacts && contact_rigid_active[icoll + nC])
+            nC++;
+
+        // A pair with no contacts has separated beyond the collision envelope; drop its manifold.
+        if (nC == 0) {
+            manifold_cache.erase(pair_shapeIDs[index]);
+            continue;
+        }
+
+        vec2 pair = I2(int(pair_shapeIDs[index] >> 32), int(pair_shapeIDs[index] & 0xffffffff));
+        uint ID_A = obj_data_ID[pair.x];
+        uint ID_B = obj_data_ID[pair.y];
+
+        const real3& pos_A = body_pos[ID_A];
+        const quaternion& rot_A = body_rot[ID_A];
+        const real3& pos_B = body_pos[ID_B];
+        const quaternion& rot_B = body_rot[ID_B];
+
+        // Store the contact geometry in the local frames of the two bodies.
+        PairManifold& manifold = manifold_cache[pair_shapeIDs[index]];
+        manifold.rel_pos = RotateT(pos_B - pos_A, rot_A);
+        manifold.rel_rot = Mult(Inv(rot_A), rot_B);
+        manifold.num_contacts = (nC < max_manifold_contacts) ? nC : max_manifold_contacts;
+        manifold.last_step = manifold_step;
+        for (int i = 0; i < manifold.num_contacts; i++) {
+            manifold.norm[i] = RotateT(norm_data[icoll + i], rot_A);
+            manifold.ptA[i] = TransformParentToLocal(pos_A, rot_A, cpta_data[icoll + i]);
+            manifold.ptB[i] = TransformParentToLocal(pos_B, rot_B, cptb_data[icoll + i]);
+            manifold.erad[i] = erad_data[icoll + i];
+        }
+    }
+
+    // Prune manifolds that were neither reused nor rebuilt in this step (their pair is no longer
+    // in potential contact).
+    for (auto it = manifold_cache.begin(); it != manifold_cache.end();) {
+        if (it->second.last_step != manifold_step)
+            it = manifold_cache.erase(it);
+        else
+            ++it;
+    }
+
+    manifold_step++;
+}
+
+void ChNarrowphase::SortCandidatesByPairType() {
+    const std::vector<shape_type>& typ_rigid = cd_data->shape_data.typ_rigid;
+    const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+
+    int n = (int)num_potential_rigid_contacts;
+    const int num_types = ChCollisionShape::Type::UNKNOWN_SHAPE + 1;
+
+    dispatch_order.resize(n);
+    dispatch_keys.resize(n);
+
+    // Histogram of the shape-type pair keys
+    std::vector<int> offsets(num_types * num_types + 1, 0);
+    for (int i = 0; i < n; i++) {
+        long long p = pair_shapeIDs[i];
+        vec2 pair = I2(int(p >> 32), int(p & 0xffffffff));
+        int key = typ_rigid[pair.x] * num_types + typ_rigid[pair.y];
+        dispatch_keys[i] = key;
+        offsets[key + 1]++;
+    }
+    for (int k = 1; k <= num_types * num_types; k++)
+        offsets[k] += offsets[k - 1];
+
+    // Stable counting sort of the candidate indices by key
+    for (int i = 0; i < n; i++)
+        dispatch_order[offsets[dispatch_keys[i]]++] = i;
+}
+
 void ChNarrowphase::DispatchMPR() {
     const real envelope = cd_data->collision_envelope;
     std::vector<real3>& norm = cd_data->norm_rigid_rigid;
@@ -245,9 +420,14 @@ void ChNarrowphase::DispatchMPR() {
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
 #pragma omp parallel for private(shapeA, shapeB)
-    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+    for (int i = 0; i < (signed)num_potential_rigid_contacts; i++) {
         uint ID_A, ID_B, icoll;
 
+        uint index = (uint)dispatch_order[i];
+
+        if (use_persistent_manifolds && pair_from_cache[index])
+            continue;
+
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
         if (MPRCollision(&shapeA, &shapeB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
@@ -270,11 +450,16 @@ void ChNarrowphase::DispatchPRIMS() {
     ConvexShape shapeB;
 
 #pragma omp parallel for private(shapeA, shapeB)
-    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+    for (int i = 0; i < (signed)num_potential_rigid_contacts; i++) {
         uint ID_A, ID_B, icoll;
 
         int nC;
 
+        uint index = (uint)dispatch_order[i];
+
+        if (use_persistent_manifolds && pair_from_cache[index])
+            continue;
+
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
         if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
@@ -298,11 +483,16 @@ void ChNarrowphase::DispatchHybridMPR() {
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
 #pragma omp parallel for private(shapeA, shapeB)
-    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+    for (int i = 0; i < (signed)num_potential_rigid_contacts; i++) {
         uint ID_A, ID_B, icoll;
 
         int nC;
 
+        uint index = (uint)dispatch_order[i];
+
+        if (use_persistent_manifolds && pair_from_cache[index])
+            continue;
+
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
         if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
@@ -347,6 +537,15 @@ void ChNarrowphase::ProcessRigidRigid() {
     contact_rigid_active.resize(num_potentialContacts);
     thrust::fill(contact_rigid_active.begin(), contact_rigid_active.end(), false);
 
+    // If persistent manifolds are enabled, restore the contacts of resting pairs from the manifold
+    // cache; such pairs are flagged in 'pair_from_cache' and skipped by the dispatch functions.
+    if (use_persistent_manifolds)
+        RestoreCachedManifolds();
+
+    // Group the candidate pairs by shape-type pair, so that each pair class is processed as a contiguous batch
+    // by the dispatch loops below (same collision function, same instruction stream for an entire batch).
+    SortCandidatesByPairType();
+
     switch (algorithm) {
         case Algorithm::MPR:
             DispatchMPR();
@@ -359,6 +558,10 @@ void ChNarrowphase::ProcessRigidRigid() {
             break;
     }
 
+    // Cache the freshly computed manifolds for reuse in subsequent steps and drop stale entries.
+    if (use_persistent_manifolds)
+        UpdateManifoldCache();
+
     // Calculate total number of actual (active) contacts
     num_rigid_contacts = (uint)Thrust_Count(contact_rigid_active, 1);
 
@@ -380,6 +583,50 @@ void ChNarrowphase::ProcessRigidRigid() {
     erad_data.resize(num_rigid_contacts);
     bids_data.resize(num_rigid_contacts);
     contact_shapeIDs.resize(num_rigid_contacts);
+
+    // If requested, reorder the contact data into a canonical, thread-count-independent order.
+    if (deterministic_order)
+        SortContactsDeterministic();
+}
+
+// Reorder 'data' according to the given permutation ('data[i]' receives the value at 'order[i]').
+template <typename T>
+static void ApplyContactOrder(const std::vector<uint>& order, std::vector<T>& data) {
+    std::vector<T> tmp(data.size());
+    thrust::gather(THRUST_PAR order.begin(), order.end(), data.begin(), tmp.begin());
+    data.swap(tmp);
+}
+
+void ChNarrowphase::SortContactsDeterministic() {
+    uint num_rigid_contacts = cd_data->num_rigid_contacts;
+    if (num_rigid_contacts < 2)
+        return;
+
+    const std::vector<vec2>& bids = cd_data->bids_rigid_rigid;
+    const std::vector<long long>& sids = cd_data->contact_shapeIDs;
+
+    // Sort a permutation of the contact indices by body ID pair, then encoded shape ID pair, then original position.
+    // The contacts of a single collision pair are generated sequentially by one thread at consecutive positions, so
+    // the final tie-break on the original position does not reintroduce a dependency on the parallel schedule.
+    std::vector<uint> order(num_rigid_contacts);
+    thrust::sequence(order.begin(), order.end());
+    thrust::sort(THRUST_PAR order.begin(), order.end(), [&bids, &sids](uint a, uint b) {
+        if (bids[a].x != bids[b].x)
+            return bids[a].x < bids[b].x;
+        if (bids[a].y != bids[b].y)
+            return bids[a].y < bids[b].y;
+        if (sids[a] != sids[b])
+            return sids[a] < sids[b];
+        return a < b;
+    });
+
+    ApplyContactOrder(order, cd_data->norm_rigid_rigid);
+    ApplyContactOrder(order, cd_data->cpta_rigid_rigid);
+    ApplyContactOrder(order, cd_data->cptb_rigid_rigid);
+    ApplyContactOrder(order, cd_data->dpth_rigid_rigid);
+    ApplyContactOrder(order, cd_data->erad_rigid_rigid);
+    ApplyContactOrder(order, cd_data->bids_rigid_rigid);
+    ApplyContactOrder(order, cd_data->contact_shapeIDs);
 }
 
 // -----------------------------------------------------------------------------
@@ -515,7 +762,7 @@ void ChNarrowphase::ProcessRigidFluid() {
     const real sphere_radius = cd_data->p_kernel_radius;
     const int num_spheres = cd_data->state_data.num_fluid_bodies;
     const std::vector<real3>& pos_spheres = *cd_data->state_data.sorted_pos_3dof;
-    const short2& family = cd_data->p_collision_family;
+    const vec2& family = cd_data->p_collision_family;
     const real envelope = cd_data->collision_envelope;
 
     std::vector<real3>& norm_rigid_sphere = cd_data->norm_rigid_fluid;
@@ -528,7 +775,7 @@ void ChNarrowphase::ProcessRigidFluid() {
     const vec3& bins_per_axis = cd_data->bins_per_axis;
     real3 global_origin = cd_data->global_origin;
     real3 inv_bin_size = cd_data->inv_bin_size;
-    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<vec2>& fam_data = cd_data->shape_data.fam_rigid;
     const real radius = sphere_radius;
 
     uint total_bins = (bins_per_axis.x + 1) * (bins_per_axis.y + 1) * (bins_per_axis.z + 1);
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/chrono/ChCollisionData.h"
 #include "chrono/collision/chrono/ChConvexShape.h"
@@ -130,12 +132,56 @@ class ChApi ChNarrowphase {
     void ProcessRigidRigid();
     void ProcessRigidFluid();
 
+    /// Group the candidate pairs by shape-type pair (stable counting sort of candidate indices, see
+    /// 'dispatch_order'). The dispatch loops then process each shape-type class as a contiguous batch, so the
+    /// pair collision function invoked (and its instruction stream) is the same for an entire batch instead of
+    /// being re-selected per candidate.
+    void SortCandidatesByPairType();
+
     void DispatchMPR();
     void DispatchPRIMS();
     void DispatchHybridMPR();
     void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
 
+    /// Reorder the rigid-rigid contact data into a canonical order, independent of the number of threads.
+    /// Contacts are sorted by body ID pair, then encoded shape ID pair, then original position; since the contacts of
+    /// a single collision pair are generated sequentially at consecutive positions, the resulting order depends only
+    /// on the problem and not on the parallel schedule.
+    void SortContactsDeterministic();
+
+    /// Restore contacts for cached pairs with small relative motion and flag them in 'pair_from_cache'.
+    void RestoreCachedManifolds();
+
+    /// Cache the manifolds produced by the dispatch functions and prune stale cache entries.
+    void UpdateManifoldCache();
+
+    /// Maximum number of contacts in a cached manifold (matching the worst case in PreprocessCount).
+    static const int max_manifold_contacts = 8;
+
+    /// Cached contact manifold for a single collision pair, used when persistent manifolds are enabled.
+    /// The contact geometry is stored in the local frames of the two bodies so that it can be mapped
+    /// back to the global frame at the current body poses when the manifold is reused.
+    struct PairManifold {
+        quaternion rel_rot;                 ///< orientation of body B in body A frame at build time
+        real3 rel_pos;                      ///< position of body B in body A frame at build time
+        int num_contacts;                   ///< number of contacts in this manifold
+        uint last_step;                     ///< last narrowphase invocation this manifold was valid
+        real3 norm[max_manifold_contacts];  ///< contact normals, in body A frame
+        real3 ptA[max_manifold_contacts];   ///< contact points on first shape, in body A frame
+        real3 ptB[max_manifold_contacts];   ///< contact points on second shape, in body B frame
+        real erad[max_manifold_contacts];   ///< effective contact radii
+    };
+
+    bool deterministic_order;       ///< sort contacts into a canonical, thread-count-independent order?
+    bool use_persistent_manifolds;  ///< enable reuse of contact manifolds across steps
+    real manifold_pos_threshold;    ///< relative translation above which a manifold is rebuilt (0: derive from envelope)
+    real manifold_rot_threshold;    ///< relative rotation (in radians) above which a manifold is rebuilt
+    uint manifold_step;             ///< narrowphase invocation counter (for cache pruning)
+
+    std::unordered_map<long long, PairManifold> manifold_cache;  ///< cached manifolds, keyed by encoded pair shape IDs
+    std::vector<char> pair_from_cache;  ///< per-pair flags: contacts restored from the cache this step
+
     std::shared_ptr<ChCollisionData> cd_data;
 
     std::vector<char> contact_rigid_active;
@@ -143,6 +189,9 @@ class ChApi ChNarrowphase {
     std::vector<char> contact_fluid_active;
     std::vector<uint> contact_index;
 
+    std::vector<int> dispatch_order;  ///< candidate pair indices, grouped by shape-type pair
+    std::vector<int> dispatch_keys;   ///< scratch: shape-type pair key of each candidate
+
     uint num_potential_rigid_contacts;
     uint num_potential_fluid_contacts;
     uint num_potential_rigid_fluid_contacts;
@@ -1385,223 +1385,439 @@ real ChNarrowphase::GetDefaultEdgeRadius() {
     return edge_radius;
 }
 
-// This is the main worker function for narrow phase check of the collision
-// between two candidate shapes.  Each candidate pair of shapes can result in
-// 0, 1, or more contacts.  For each actual contact, we calculate various
-// geometrical quantities and load them in the output arguments (starting from
-// the given addresses)
-//   - ct_pt1:      contact point on first shape (in global frame)
-//   - ct_pt2:      contact point on second shape (in global frame)
-//   - ct_depth:    penetration distance (negative if overlap exists)
-//   - ct_norm:     contact normal, from ct_pt2 to ct_pt1 (in global frame)
-//   - ct_eff_rad:  effective contact radius
-// Note that we also report collisions for which the distance between the two
-// shapes is at most 'separation' (typically twice the collision envelope).
-// In these cases, the corresponding ct_depth is a positive value.
-// This function returns true if it was able to determine the collision state
-// for the given pair of shapes and false if the shape types are not supported.
-bool ChNarrowphase::PRIMSCollision(const ConvexBase* shapeA,  // first candidate shape
-                                   const ConvexBase* shapeB,  // second candidate shape
-                                   real separation,           // maximum separation
-                                   real3* ct_norm,            // [output] contact normal (per contact pair)
-                                   real3* ct_pt1,             // [output] point on shape1 (per contact pair)
-                                   real3* ct_pt2,             // [output] point on shape2 (per contact pair)
-                                   real* ct_depth,            // [output] penetration depth (per contact pair)
-                                   real* ct_eff_rad,          // [output] effective contact radius (per contact pair)
-                                   int& nC)                   // [output] number of contacts found
-{
-    // Special-case the collision detection based on the types of the two potentially colliding shapes.
-
-    nC = 0;
+// =============================================================================
 
-    if (shapeA->Type() == ChCollisionShape::Type::SPHERE && shapeB->Type() == ChCollisionShape::Type::SPHERE) {
-        if (sphere_sphere(shapeA->A(), shapeA->Radius(), shapeB->A(), shapeB->Radius(), separation, *ct_norm, *ct_depth,
-                          *ct_pt1, *ct_pt2, *ct_eff_rad)) {
-            nC = 1;
-        }
-        return true;
+// Monomorphic dispatch functions, one per supported shape-type pair. Each adapter unpacks the shape
+// data for exactly one pair class and invokes the corresponding analytic function (the bodies are
+// those of the former if-else chain in PRIMSCollision). The adapters are collected in a static
+// table indexed by the two shape types, so that dispatching a candidate pair costs one table load
+// and an indirect call; with candidates grouped by pair type in the narrowphase dispatch loops,
+// the call target is the same for an entire batch.
+
+typedef bool (*PairCollisionFunction)(const ConvexBase* shapeA,
+                                      const ConvexBase* shapeB,
+                                      const real& separation,
+                                      real3* ct_norm,
+                                      real3* ct_pt1,
+                                      real3* ct_pt2,
+                                      real* ct_depth,
+                                      real* ct_eff_rad,
+                                      int& nC);
+
+static bool prims_sphere_sphere(const ConvexBase* shapeA,
+                                const ConvexBase* shapeB,
+                                const real& separation,
+                                real3* ct_norm,
+                                real3* ct_pt1,
+                                real3* ct_pt2,
+                                real* ct_depth,
+                                real* ct_eff_rad,
+                                int& nC) {
+    if (sphere_sphere(shapeA->A(), shapeA->Radius(), shapeB->A(), shapeB->Radius(), separation, *ct_norm, *ct_depth,
+                      *ct_pt1, *ct_pt2, *ct_eff_rad)) {
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::CAPSULE && shapeB->Type() == ChCollisionShape::Type::SPHERE) {
-        if (capsule_sphere(shapeA->A(), shapeA->R(), shapeA->Capsule().x, shapeA->Capsule().y, shapeB->A(),
-                           shapeB->Radius(), separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad)) {
-            nC = 1;
-        }
-        return true;
+static bool prims_capsule_sphere(const ConvexBase* shapeA,
+                                 const ConvexBase* shapeB,
+                                 const real& separation,
+                                 real3* ct_norm,
+                                 real3* ct_pt1,
+                                 real3* ct_pt2,
+                                 real* ct_depth,
+                                 real* ct_eff_rad,
+                                 int& nC) {
+    if (capsule_sphere(shapeA->A(), shapeA->R(), shapeA->Capsule().x, shapeA->Capsule().y, shapeB->A(),
+                       shapeB->Radius(), separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad)) {
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::SPHERE && shapeB->Type() == ChCollisionShape::Type::CAPSULE) {
-        if (capsule_sphere(shapeB->A(), shapeB->R(), shapeB->Capsule().x, shapeB->Capsule().y, shapeA->A(),
-                           shapeA->Radius(), separation, *ct_norm, *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad)) {
-            *ct_norm = -(*ct_norm);
-            nC = 1;
-        }
-        return true;
+static bool prims_sphere_capsule(const ConvexBase* shapeA,
+                                 const ConvexBase* shapeB,
+                                 const real& separation,
+                                 real3* ct_norm,
+                                 real3* ct_pt1,
+                                 real3* ct_pt2,
+                                 real* ct_depth,
+                                 real* ct_eff_rad,
+                                 int& nC) {
+    if (capsule_sphere(shapeB->A(), shapeB->R(), shapeB->Capsule().x, shapeB->Capsule().y, shapeA->A(),
+                       shapeA->Radius(), separation, *ct_norm, *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad)) {
+        *ct_norm = -(*ct_norm);
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::CYLINDER && shapeB->Type() == ChCollisionShape::Type::SPHERE) {
-        if (cylinder_sphere(shapeA->A(), shapeA->R(), shapeA->Box().x, shapeA->Box().y, shapeB->A(), shapeB->Radius(),
-                            separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad)) {
-            nC = 1;
-        }
-        return true;
+static bool prims_cylinder_sphere(const ConvexBase* shapeA,
+                                  const ConvexBase* shapeB,
+                                  const real& separation,
+                                  real3* ct_norm,
+                                  real3* ct_pt1,
+                                  real3* ct_pt2,
+                                  real* ct_depth,
+                                  real* ct_eff_rad,
+                                  int& nC) {
+    if (cylinder_sphere(shapeA->A(), shapeA->R(), shapeA->Box().x, shapeA->Box().y, shapeB->A(), shapeB->Radius(),
+                        separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad)) {
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::SPHERE && shapeB->Type() == ChCollisionShape::Type::CYLINDER) {
-        if (cylinder_sphere(shapeB->A(), shapeB->R(), shapeB->Box().x, shapeB->Box().y, shapeA->A(), shapeA->Radius(),
-                            separation, *ct_norm, *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad)) {
-            *ct_norm = -(*ct_norm);
-            nC = 1;
-        }
-        return true;
+static bool prims_sphere_cylinder(const ConvexBase* shapeA,
+                                  const ConvexBase* shapeB,
+                                  const real& separation,
+                                  real3* ct_norm,
+                                  real3* ct_pt1,
+                                  real3* ct_pt2,
+                                  real* ct_depth,
+                                  real* ct_eff_rad,
+                                  int& nC) {
+    if (cylinder_sphere(shapeB->A(), shapeB->R(), shapeB->Box().x, shapeB->Box().y, shapeA->A(), shapeA->Radius(),
+                        separation, *ct_norm, *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad)) {
+        *ct_norm = -(*ct_norm);
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::ROUNDEDCYL && shapeB->Type() == ChCollisionShape::Type::SPHERE) {
-        if (roundedcyl_sphere(shapeA->A(), shapeA->R(), shapeA->Rbox().x, shapeA->Rbox().y, shapeA->Rbox().w,
-                              shapeB->A(), shapeB->Radius(), separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2,
-                              *ct_eff_rad)) {
-            nC = 1;
-        }
-        return true;
+static bool prims_roundedcyl_sphere(const ConvexBase* shapeA,
+                                    const ConvexBase* shapeB,
+                                    const real& separation,
+                                    real3* ct_norm,
+                                    real3* ct_pt1,
+                                    real3* ct_pt2,
+                                    real* ct_depth,
+                                    real* ct_eff_rad,
+                                    int& nC) {
+    if (roundedcyl_sphere(shapeA->A(), shapeA->R(), shapeA->Rbox().x, shapeA->Rbox().y, shapeA->Rbox().w, shapeB->A(),
+                          shapeB->Radius(), separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad)) {
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::SPHERE && shapeB->Type() == ChCollisionShape::Type::ROUNDEDCYL) {
-        if (roundedcyl_sphere(shapeB->A(), shapeB->R(), shapeB->Rbox().x, shapeB->Rbox().y, shapeB->Rbox().w,
-                              shapeA->A(), shapeA->Radius(), separation, *ct_norm, *ct_depth, *ct_pt2, *ct_pt1,
-                              *ct_eff_rad)) {
-            *ct_norm = -(*ct_norm);
-            nC = 1;
-        }
-        return true;
+static bool prims_sphere_roundedcyl(const ConvexBase* shapeA,
+                                    const ConvexBase* shapeB,
+                                    const real& separation,
+                                    real3* ct_norm,
+                                    real3* ct_pt1,
+                                    real3* ct_pt2,
+                                    real* ct_depth,
+                                    real* ct_eff_rad,
+                                    int& nC) {
+    if (roundedcyl_sphere(shapeB->A(), shapeB->R(), shapeB->Rbox().x, shapeB->Rbox().y, shapeB->Rbox().w, shapeA->A(),
+                          shapeA->Radius(), separation, *ct_norm, *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad)) {
+        *ct_norm = -(*ct_norm);
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::BOX && shapeB->Type() == ChCollisionShape::Type::SPHERE) {
-        if (box_sphere(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->A(), shapeB->Radius(), separation, *ct_norm,
-                       *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad)) {
-            nC = 1;
-        }
-        return true;
+static bool prims_box_sphere(const ConvexBase* shapeA,
+                             const ConvexBase* shapeB,
+                             const real& separation,
+                             real3* ct_norm,
+                             real3* ct_pt1,
+                             real3* ct_pt2,
+                             real* ct_depth,
+                             real* ct_eff_rad,
+                             int& nC) {
+    if (box_sphere(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->A(), shapeB->Radius(), separation, *ct_norm,
+                   *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad)) {
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::SPHERE && shapeB->Type() == ChCollisionShape::Type::BOX) {
-        if (box_sphere(shapeB->A(), shapeB->R(), shapeB->Box(), shapeA->A(), shapeA->Radius(), separation, *ct_norm,
-                       *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad)) {
-            *ct_norm = -(*ct_norm);
-            nC = 1;
-        }
-        return true;
+static bool prims_sphere_box(const ConvexBase* shapeA,
+                             const ConvexBase* shapeB,
+                             const real& separation,
+                             real3* ct_norm,
+                             real3* ct_pt1,
+                             real3* ct_pt2,
+                             real* ct_depth,
+                             real* ct_eff_rad,
+                             int& nC) {
+    if (box_sphere(shapeB->A(), shapeB->R(), shapeB->Box(), shapeA->A(), shapeA->Radius(), separation, *ct_norm,
+                   *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad)) {
+        *ct_norm = -(*ct_norm);
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::ROUNDEDBOX && shapeB->Type() == ChCollisionShape::Type::SPHERE) {
-        if (roundedbox_sphere(shapeA->A(), shapeA->R(), shapeA->Rbox(), shapeA->Rbox().w, shapeB->A(), shapeB->Radius(),
-                              separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad)) {
-            nC = 1;
-        }
-        return true;
+static bool prims_roundedbox_sphere(const ConvexBase* shapeA,
+                                    const ConvexBase* shapeB,
+                                    const real& separation,
+                                    real3* ct_norm,
+                                    real3* ct_pt1,
+                                    real3* ct_pt2,
+                                    real* ct_depth,
+                                    real* ct_eff_rad,
+                                    int& nC) {
+    if (roundedbox_sphere(shapeA->A(), shapeA->R(), shapeA->Rbox(), shapeA->Rbox().w, shapeB->A(), shapeB->Radius(),
+                          separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad)) {
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::SPHERE && shapeB->Type() == ChCollisionShape::Type::ROUNDEDBOX) {
-        if (roundedbox_sphere(shapeB->A(), shapeB->R(), shapeB->Rbox(), shapeB->Rbox().w, shapeA->A(), shapeA->Radius(),
-                              separation, *ct_norm, *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad)) {
-            *ct_norm = -(*ct_norm);
-            nC = 1;
-        }
-        return true;
+static bool prims_sphere_roundedbox(const ConvexBase* shapeA,
+                                    const ConvexBase* shapeB,
+                                    const real& separation,
+                                    real3* ct_norm,
+                                    real3* ct_pt1,
+                                    real3* ct_pt2,
+                                    real* ct_depth,
+                                    real* ct_eff_rad,
+                                    int& nC) {
+    if (roundedbox_sphere(shapeB->A(), shapeB->R(), shapeB->Rbox(), shapeB->Rbox().w, shapeA->A(), shapeA->Radius(),
+                          separation, *ct_norm, *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad)) {
+        *ct_norm = -(*ct_norm);
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::TRIANGLE && shapeB->Type() == ChCollisionShape::Type::SPHERE) {
-        if (triangle_sphere(shapeA->Triangles()[0], shapeA->Triangles()[1], shapeA->Triangles()[2], shapeB->A(),
-                            shapeB->Radius(), separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad)) {
-            nC = 1;
-        }
-        return true;
+static bool prims_triangle_sphere(const ConvexBase* shapeA,
+                                  const ConvexBase* shapeB,
+                                  const real& separation,
+                                  real3* ct_norm,
+                                  real3* ct_pt1,
+                                  real3* ct_pt2,
+                                  real* ct_depth,
+                                  real* ct_eff_rad,
+                                  int& nC) {
+    if (triangle_sphere(shapeA->Triangles()[0], shapeA->Triangles()[1], shapeA->Triangles()[2], shapeB->A(),
+                        shapeB->Radius(), separation, *ct_norm, *ct_depth, *ct_pt1, *ct_pt2, *ct_eff_rad)) {
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::SPHERE && shapeB->Type() == ChCollisionShape::Type::TRIANGLE) {
-        if (triangle_sphere(shapeB->Triangles()[0], shapeB->Triangles()[1], shapeB->Triangles()[2], shapeA->A(),
-                            shapeA->Radius(), separation, *ct_norm, *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad)) {
-            *ct_norm = -(*ct_norm);
-            nC = 1;
-        }
-        return true;
+static bool prims_sphere_triangle(const ConvexBase* shapeA,
+                                  const ConvexBase* shapeB,
+                                  const real& separation,
+                                  real3* ct_norm,
+                                  real3* ct_pt1,
+                                  real3* ct_pt2,
+                                  real* ct_depth,
+                                  real* ct_eff_rad,
+                                  int& nC) {
+    if (triangle_sphere(shapeB->Triangles()[0], shapeB->Triangles()[1], shapeB->Triangles()[2], shapeA->A(),
+                        shapeA->Radius(), separation, *ct_norm, *ct_depth, *ct_pt2, *ct_pt1, *ct_eff_rad)) {
+        *ct_norm = -(*ct_norm);
+        nC = 1;
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::CAPSULE && shapeB->Type() == ChCollisionShape::Type::CAPSULE) {
-        nC = capsule_capsule(shapeA->A(), shapeA->R(), shapeA->Capsule().x, shapeA->Capsule().y, shapeB->A(),
-                             shapeB->R(), shapeB->Capsule().x, shapeB->Capsule().y, separation, ct_norm, ct_depth,
-                             ct_pt1, ct_pt2, ct_eff_rad);
-        return true;
-    }
+static bool prims_capsule_capsule(const ConvexBase* shapeA,
+                                  const ConvexBase* shapeB,
+                                  const real& separation,
+                                  real3* ct_norm,
+                                  real3* ct_pt1,
+                                  real3* ct_pt2,
+                                  real* ct_depth,
+                                  real* ct_eff_rad,
+                                  int& nC) {
+    nC = capsule_capsule(shapeA->A(), shapeA->R(), shapeA->Capsule().x, shapeA->Capsule().y, shapeB->A(), shapeB->R(),
+                         shapeB->Capsule().x, shapeB->Capsule().y, separation, ct_norm, ct_depth, ct_pt1, ct_pt2,
+                         ct_eff_rad);
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::BOX && shapeB->Type() == ChCollisionShape::Type::CAPSULE) {
-        nC = box_capsule(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->A(), shapeB->R(), shapeB->Capsule().x,
-                         shapeB->Capsule().y, separation, ct_norm, ct_depth, ct_pt1, ct_pt2, ct_eff_rad);
-        return true;
-    }
+static bool prims_box_capsule(const ConvexBase* shapeA,
+                              const ConvexBase* shapeB,
+                              const real& separation,
+                              real3* ct_norm,
+                              real3* ct_pt1,
+                              real3* ct_pt2,
+                              real* ct_depth,
+                              real* ct_eff_rad,
+                              int& nC) {
+    nC = box_capsule(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->A(), shapeB->R(), shapeB->Capsule().x,
+                     shapeB->Capsule().y, separation, ct_norm, ct_depth, ct_pt1, ct_pt2, ct_eff_rad);
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::CAPSULE && shapeB->Type() == ChCollisionShape::Type::BOX) {
-        nC = box_capsule(shapeB->A(), shapeB->R(), shapeB->Box(), shapeA->A(), shapeA->R(), shapeA->Capsule().x,
-                         shapeA->Capsule().y, separation, ct_norm, ct_depth, ct_pt2, ct_pt1, ct_eff_rad);
-        for (int i = 0; i < nC; i++) {
-            *(ct_norm + i) = -(*(ct_norm + i));
-        }
-        return true;
+static bool prims_capsule_box(const ConvexBase* shapeA,
+                              const ConvexBase* shapeB,
+                              const real& separation,
+                              real3* ct_norm,
+                              real3* ct_pt1,
+                              real3* ct_pt2,
+                              real* ct_depth,
+                              real* ct_eff_rad,
+                              int& nC) {
+    nC = box_capsule(shapeB->A(), shapeB->R(), shapeB->Box(), shapeA->A(), shapeA->R(), shapeA->Capsule().x,
+                     shapeA->Capsule().y, separation, ct_norm, ct_depth, ct_pt2, ct_pt1, ct_eff_rad);
+    for (int i = 0; i < nC; i++) {
+        *(ct_norm + i) = -(*(ct_norm + i));
     }
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::BOX && shapeB->Type() == ChCollisionShape::Type::CYLSHELL) {
-        nC = box_cylshell(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->A(), shapeB->R(), shapeB->Cylshell().x,
-                          shapeB->Cylshell().y, separation, ct_norm, ct_depth, ct_pt1, ct_pt2, ct_eff_rad);
-        return (nC >= 0);
-    }
+static bool prims_box_cylshell(const ConvexBase* shapeA,
+                               const ConvexBase* shapeB,
+                               const real& separation,
+                               real3* ct_norm,
+                               real3* ct_pt1,
+                               real3* ct_pt2,
+                               real* ct_depth,
+                               real* ct_eff_rad,
+                               int& nC) {
+    nC = box_cylshell(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->A(), shapeB->R(), shapeB->Cylshell().x,
+                      shapeB->Cylshell().y, separation, ct_norm, ct_depth, ct_pt1, ct_pt2, ct_eff_rad);
+    return (nC >= 0);
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::CYLSHELL && shapeB->Type() == ChCollisionShape::Type::BOX) {
-        nC = box_cylshell(shapeB->A(), shapeB->R(), shapeB->Box(), shapeA->A(), shapeA->R(), shapeA->Cylshell().x,
-                          shapeA->Cylshell().y, separation, ct_norm, ct_depth, ct_pt2, ct_pt1, ct_eff_rad);
-        for (int i = 0; i < nC; i++) {
-            *(ct_norm + i) = -(*(ct_norm + i));
-        }
-        return (nC >= 0);
+static bool prims_cylshell_box(const ConvexBase* shapeA,
+                               const ConvexBase* shapeB,
+                               const real& separation,
+                               real3* ct_norm,
+                               real3* ct_pt1,
+                               real3* ct_pt2,
+                               real* ct_depth,
+                               real* ct_eff_rad,
+                               int& nC) {
+    nC = box_cylshell(shapeB->A(), shapeB->R(), shapeB->Box(), shapeA->A(), shapeA->R(), shapeA->Cylshell().x,
+                      shapeA->Cylshell().y, separation, ct_norm, ct_depth, ct_pt2, ct_pt1, ct_eff_rad);
+    for (int i = 0; i < nC; i++) {
+        *(ct_norm + i) = -(*(ct_norm + i));
     }
+    return (nC >= 0);
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::BOX && shapeB->Type() == ChCollisionShape::Type::BOX) {
-        nC = box_box(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->A(), shapeB->R(), shapeB->Box(), separation,
-                     ct_norm, ct_depth, ct_pt1, ct_pt2, ct_eff_rad);
-
-        ////std::cout << nC << std::endl;
-        ////for (int j = 0; j < nC; j++) {
-        ////    real3 ptT = *(ct_pt1 + j);
-        ////    real3 ptO = *(ct_pt2 + j);
-        ////    real3 nrm = *(ct_norm + j);
-        ////    real depth = *(ct_depth + j);
-        ////    real er = *(ct_eff_rad + j);
-        ////    std::cout << "  " << ptT.x << "  " << ptT.y << "  " << ptT.z << std::endl;
-        ////    std::cout << "  " << ptO.x << "  " << ptO.y << "  " << ptO.z << std::endl;
-        ////    std::cout << "  " << nrm.x << "  " << nrm.y << "  " << nrm.z << std::endl;
-        ////    std::cout << "  " << depth << std::endl;
-        ////    std::cout << "  " << er << std::endl;
-        ////}
-
-        return true;
-    }
+static bool prims_box_box(const ConvexBase* shapeA,
+                          const ConvexBase* shapeB,
+                          const real& separation,
+                          real3* ct_norm,
+                          real3* ct_pt1,
+                          real3* ct_pt2,
+                          real* ct_depth,
+                          real* ct_eff_rad,
+                          int& nC) {
+    nC = box_box(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->A(), shapeB->R(), shapeB->Box(), separation, ct_norm,
+                 ct_depth, ct_pt1, ct_pt2, ct_eff_rad);
+    return true;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::BOX && shapeB->Type() == ChCollisionShape::Type::TRIANGLE) {
-        nC = triangle_box(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->Triangles(), separation, ct_norm, ct_depth,
-                          ct_pt1, ct_pt2, ct_eff_rad);
-        return false;
+static bool prims_box_triangle(const ConvexBase* shapeA,
+                               const ConvexBase* shapeB,
+                               const real& separation,
+                               real3* ct_norm,
+                               real3* ct_pt1,
+                               real3* ct_pt2,
+                               real* ct_depth,
+                               real* ct_eff_rad,
+                               int& nC) {
+    nC = triangle_box(shapeA->A(), shapeA->R(), shapeA->Box(), shapeB->Triangles(), separation, ct_norm, ct_depth,
+                      ct_pt1, ct_pt2, ct_eff_rad);
+    return false;
+}
+
+static bool prims_triangle_box(const ConvexBase* shapeA,
+                               const ConvexBase* shapeB,
+                               const real& separation,
+                               real3* ct_norm,
+                               real3* ct_pt1,
+                               real3* ct_pt2,
+                               real* ct_depth,
+                               real* ct_eff_rad,
+                               int& nC) {
+    nC = triangle_box(shapeB->A(), shapeB->R(), shapeB->Box(), shapeA->Triangles(), separation, ct_norm, ct_depth,
+                      ct_pt2, ct_pt1, ct_eff_rad);
+    for (int i = 0; i < nC; i++) {
+        *(ct_norm + i) = -(*(ct_norm + i));
     }
+    return false;
+}
 
-    if (shapeA->Type() == ChCollisionShape::Type::TRIANGLE && shapeB->Type() == ChCollisionShape::Type::BOX) {
-        nC = triangle_box(shapeB->A(), shapeB->R(), shapeB->Box(), shapeA->Triangles(), separation, ct_norm, ct_depth,
-                          ct_pt2, ct_pt1, ct_eff_rad);
-        for (int i = 0; i < nC; i++) {
-            *(ct_norm + i) = -(*(ct_norm + i));
-        }
-        return false;
+/// Static table of pair collision functions, indexed by the types of the two candidate shapes.
+/// Built once at load time; entries for unsupported shape-type pairs are null.
+class PairCollisionTable {
+  public:
+    static const int num_types = ChCollisionShape::Type::UNKNOWN_SHAPE + 1;
+
+    PairCollisionTable() {
+        for (int i = 0; i < num_types * num_types; i++)
+            m_table[i] = nullptr;
+
+        typedef ChCollisionShape::Type Type;
+        Set(Type::SPHERE, Type::SPHERE, prims_sphere_sphere);
+        Set(Type::CAPSULE, Type::SPHERE, prims_capsule_sphere);
+        Set(Type::SPHERE, Type::CAPSULE, prims_sphere_capsule);
+        Set(Type::CYLINDER, Type::SPHERE, prims_cylinder_sphere);
+        Set(Type::SPHERE, Type::CYLINDER, prims_sphere_cylinder);
+        Set(Type::ROUNDEDCYL, Type::SPHERE, prims_roundedcyl_sphere);
+        Set(Type::SPHERE, Type::ROUNDEDCYL, prims_sphere_roundedcyl);
+        Set(Type::BOX, Type::SPHERE, prims_box_sphere);
+        Set(Type::SPHERE, Type::BOX, prims_sphere_box);
+        Set(Type::ROUNDEDBOX, Type::SPHERE, prims_roundedbox_sphere);
+        Set(Type::SPHERE, Type::ROUNDEDBOX, prims_sphere_roundedbox);
+        Set(Type::TRIANGLE, Type::SPHERE, prims_triangle_sphere);
+        Set(Type::SPHERE, Type::TRIANGLE, prims_sphere_triangle);
+        Set(Type::CAPSULE, Type::CAPSULE, prims_capsule_capsule);
+        Set(Type::BOX, Type::CAPSULE, prims_box_capsule);
+        Set(Type::CAPSULE, Type::BOX, prims_capsule_box);
+        Set(Type::BOX, Type::CYLSHELL, prims_box_cylshell);
+        Set(Type::CYLSHELL, Type::BOX, prims_cylshell_box);
+        Set(Type::BOX, Type::BOX, prims_box_box);
+        Set(Type::BOX, Type::TRIANGLE, prims_box_triangle);
+        Set(Type::TRIANGLE, Type::BOX, prims_triangle_box);
     }
 
+    PairCollisionFunction Get(int type_A, int type_B) const { return m_table[type_A * num_types + type_B]; }
 
-    // Contact could not be checked using this CD algorithm
-    return false;
+  private:
+    void Set(int type_A, int type_B, PairCollisionFunction fn) { m_table[type_A * num_types + type_B] = fn; }
+
+    PairCollisionFunction m_table[num_types * num_types];
+};
+
+static const PairCollisionTable pair_collision_table;
+
+// This is the main worker function for narrow phase check of the collision
+// between two candidate shapes.  Each candidate pair of shapes can result in
+// 0, 1, or more contacts.  For each actual contact, we calculate various
+// geometrical quantities and load them in the output arguments (starting from
+// the given addresses)
+//   - ct_pt1:      contact point on first shape (in global frame)
+//   - ct_pt2:      contact point on second shape (in global frame)
+//   - ct_depth:    penetration distance (negative if overlap exists)
+//   - ct_norm:     contact normal, from ct_pt2 to ct_pt1 (in global frame)
+//   - ct_eff_rad:  effective contact radius
+// Note that we also report collisions for which the distance between the two
+// shapes is at most 'separation' (typically twice the collision envelope).
+// In these cases, the corresponding ct_depth is a positive value.
+// This function returns true if it was able to determine the collision state
+// for the given pair of shapes and false if the shape types are not supported.
+bool ChNarrowphase::PRIMSCollision(const ConvexBase* shapeA,  // first candidate shape
+                                   const ConvexBase* shapeB,  // second candidate shape
+                                   real separation,           // maximum separation
+                                   real3* ct_norm,            // [output] contact normal (per contact pair)
+                                   real3* ct_pt1,             // [output] point on shape1 (per contact pair)
+                                   real3* ct_pt2,             // [output] point on shape2 (per contact pair)
+                                   real* ct_depth,            // [output] penetration depth (per contact pair)
+                                   real* ct_eff_rad,          // [output] effective contact radius (per contact pair)
+                                   int& nC)                   // [output] number of contacts found
+{
+    nC = 0;
+
+    // Special-case the collision detection based on the types of the two potentially colliding shapes,
+    // through the static table of monomorphic pair functions.
+    PairCollisionFunction fn = pair_collision_table.Get(shapeA->Type(), shapeB->Type());
+    if (!fn)
+        return false;
+
+    return fn(shapeA, shapeB, separation, ct_norm, ct_pt1, ct_pt2, ct_depth, ct_eff_rad, nC);
 }
 
 }  // end namespace collision
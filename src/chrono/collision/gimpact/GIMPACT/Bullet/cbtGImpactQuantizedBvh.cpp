@@ -24,6 +24,13 @@ subject to the following restrictions:
 #include "cbtGImpactQuantizedBvh.h"
 #include "LinearMath/cbtQuickprof.h"
 
+#include "chrono/ChConfig.h"
+
+#if defined(CHRONO_SIMD_ENABLED) && defined(CHRONO_AVX_2_0) && defined(BT_USE_DOUBLE_PRECISION)
+#define GIM_QUANTIZED_BVH_AVX
+#include <immintrin.h>
+#endif
+
 #ifdef TRI_COLLISION_PROFILING
 cbtClock g_q_tree_clock;
 
@@ -376,91 +383,198 @@ SIMD_FORCE_INLINE bool _quantized_node_collision(
 	//	return box0.has_collision(box1);
 }
 
-//stackless recursive collision routine
-static void _find_quantized_collision_pairs_recursive(
+//! Tests up to 4 node pairs (sharing the same transform cache) in one batch.
+//! Applies the class I and class II separating-axis tests (identical to
+//! overlapping_trans_cache with fulltest = false, the test used by the descent
+//! for all pairs except the roots) and returns a bitmask with bit k set if
+//! pair k overlaps.
+static int _quantized_node_collision_batch(
 	const cbtGImpactQuantizedBvh* boxset0, const cbtGImpactQuantizedBvh* boxset1,
-	cbtPairSet* collision_pairs,
 	const BT_BOX_BOX_TRANSFORM_CACHE& trans_cache_1to0,
-	int node0, int node1, bool complete_primitive_tests)
+	const int* nodes0, const int* nodes1, int num_pairs)
 {
-	if (_quantized_node_collision(
-			boxset0, boxset1, trans_cache_1to0,
-			node0, node1, complete_primitive_tests) == false) return;  //avoid colliding internal nodes
-
-	if (boxset0->isLeafNode(node0))
+#ifdef GIM_QUANTIZED_BVH_AVX
+	//gather centers and extents of both boxes of each pair, one pair per lane
+	cbtScalar ca[3][4], ea[3][4], cb[3][4], eb[3][4];
+	for (int k = 0; k < num_pairs; k++)
 	{
-		if (boxset1->isLeafNode(node1))
+		cbtAABB box0;
+		boxset0->getNodeBound(nodes0[k], box0);
+		cbtAABB box1;
+		boxset1->getNodeBound(nodes1[k], box1);
+
+		cbtVector3 c, e;
+		box0.get_center_extend(c, e);
+		for (int i = 0; i < 3; i++)
 		{
-			// collision result
-			collision_pairs->push_pair(
-				boxset0->getNodeData(node0), boxset1->getNodeData(node1));
-			return;
+			ca[i][k] = c[i];
+			ea[i][k] = e[i];
 		}
-		else
+		box1.get_center_extend(c, e);
+		for (int i = 0; i < 3; i++)
 		{
-			//collide left recursive
-
-			_find_quantized_collision_pairs_recursive(
-				boxset0, boxset1,
-				collision_pairs, trans_cache_1to0,
-				node0, boxset1->getLeftNode(node1), false);
-
-			//collide right recursive
-			_find_quantized_collision_pairs_recursive(
-				boxset0, boxset1,
-				collision_pairs, trans_cache_1to0,
-				node0, boxset1->getRightNode(node1), false);
+			cb[i][k] = c[i];
+			eb[i][k] = e[i];
 		}
 	}
-	else
+	//duplicate the first pair in unused lanes (masked out of the result)
+	for (int k = num_pairs; k < 4; k++)
 	{
-		if (boxset1->isLeafNode(node1))
+		for (int i = 0; i < 3; i++)
 		{
-			//collide left recursive
-			_find_quantized_collision_pairs_recursive(
-				boxset0, boxset1,
-				collision_pairs, trans_cache_1to0,
-				boxset0->getLeftNode(node0), node1, false);
-
-			//collide right recursive
-
-			_find_quantized_collision_pairs_recursive(
-				boxset0, boxset1,
-				collision_pairs, trans_cache_1to0,
-				boxset0->getRightNode(node0), node1, false);
+			ca[i][k] = ca[i][0];
+			ea[i][k] = ea[i][0];
+			cb[i][k] = cb[i][0];
+			eb[i][k] = eb[i][0];
 		}
-		else
+	}
+
+	const __m256d signmask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+	__m256d result = _mm256_castsi256_pd(_mm256_set1_epi64x(-1LL));
+	__m256d T[3];
+
+	// Class I : A's basis vectors
+	for (int i = 0; i < 3; i++)
+	{
+		T[i] = _mm256_add_pd(
+			_mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(trans_cache_1to0.m_R1to0[i][0]), _mm256_loadu_pd(cb[0])),
+						  _mm256_mul_pd(_mm256_set1_pd(trans_cache_1to0.m_R1to0[i][1]), _mm256_loadu_pd(cb[1]))),
+			_mm256_mul_pd(_mm256_set1_pd(trans_cache_1to0.m_R1to0[i][2]), _mm256_loadu_pd(cb[2])));
+		T[i] = _mm256_sub_pd(_mm256_add_pd(T[i], _mm256_set1_pd(trans_cache_1to0.m_T1to0[i])), _mm256_loadu_pd(ca[i]));
+
+		__m256d t = _mm256_add_pd(
+			_mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(trans_cache_1to0.m_AR[i][0]), _mm256_loadu_pd(eb[0])),
+						  _mm256_mul_pd(_mm256_set1_pd(trans_cache_1to0.m_AR[i][1]), _mm256_loadu_pd(eb[1]))),
+			_mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(trans_cache_1to0.m_AR[i][2]), _mm256_loadu_pd(eb[2])),
+						  _mm256_loadu_pd(ea[i])));
+
+		result = _mm256_and_pd(result, _mm256_cmp_pd(_mm256_and_pd(T[i], signmask), t, _CMP_LE_OQ));
+	}
+	// Class II : B's basis vectors
+	for (int i = 0; i < 3; i++)
+	{
+		__m256d t = _mm256_add_pd(
+			_mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(trans_cache_1to0.m_R1to0[0][i]), T[0]),
+						  _mm256_mul_pd(_mm256_set1_pd(trans_cache_1to0.m_R1to0[1][i]), T[1])),
+			_mm256_mul_pd(_mm256_set1_pd(trans_cache_1to0.m_R1to0[2][i]), T[2]));
+		__m256d t2 = _mm256_add_pd(
+			_mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(trans_cache_1to0.m_AR[0][i]), _mm256_loadu_pd(ea[0])),
+						  _mm256_mul_pd(_mm256_set1_pd(trans_cache_1to0.m_AR[1][i]), _mm256_loadu_pd(ea[1]))),
+			_mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(trans_cache_1to0.m_AR[2][i]), _mm256_loadu_pd(ea[2])),
+						  _mm256_loadu_pd(eb[i])));
+
+		result = _mm256_and_pd(result, _mm256_cmp_pd(_mm256_and_pd(t, signmask), t2, _CMP_LE_OQ));
+	}
+
+	return _mm256_movemask_pd(result) & ((1 << num_pairs) - 1);
+#else
+	int result = 0;
+	for (int k = 0; k < num_pairs; k++)
+	{
+		if (_quantized_node_collision(boxset0, boxset1, trans_cache_1to0, nodes0[k], nodes1[k], false))
 		{
-			//collide left0 left1
+			result |= 1 << k;
+		}
+	}
+	return result;
+#endif
+}
 
-			_find_quantized_collision_pairs_recursive(
-				boxset0, boxset1,
-				collision_pairs, trans_cache_1to0,
-				boxset0->getLeftNode(node0), boxset1->getLeftNode(node1), false);
+//explicit-stack collision routine; child pair candidates produced when expanding
+//a node pair are tested together in one batch of up to 4
+static void _find_quantized_collision_pairs(
+	const cbtGImpactQuantizedBvh* boxset0, const cbtGImpactQuantizedBvh* boxset1,
+	cbtPairSet* collision_pairs,
+	const BT_BOX_BOX_TRANSFORM_CACHE& trans_cache_1to0)
+{
+	//test the roots with the complete (9 axis) test, as the recursive version did
+	if (_quantized_node_collision(
+			boxset0, boxset1, trans_cache_1to0,
+			0, 0, true) == false) return;  //avoid colliding internal nodes
 
-			//collide left0 right1
+	struct GIM_NODE_PAIR
+	{
+		int node0;
+		int node1;
+	};
+
+	cbtAlignedObjectArray<GIM_NODE_PAIR> stack;
+	stack.reserve(128);
 
-			_find_quantized_collision_pairs_recursive(
-				boxset0, boxset1,
-				collision_pairs, trans_cache_1to0,
-				boxset0->getLeftNode(node0), boxset1->getRightNode(node1), false);
+	GIM_NODE_PAIR root;
+	root.node0 = 0;
+	root.node1 = 0;
+	stack.push_back(root);
 
-			//collide right0 left1
+	int nodes0[4];
+	int nodes1[4];
 
-			_find_quantized_collision_pairs_recursive(
-				boxset0, boxset1,
-				collision_pairs, trans_cache_1to0,
-				boxset0->getRightNode(node0), boxset1->getLeftNode(node1), false);
+	while (stack.size() > 0)
+	{
+		GIM_NODE_PAIR pair = stack[stack.size() - 1];
+		stack.pop_back();
 
-			//collide right0 right1
+		bool isleaf0 = boxset0->isLeafNode(pair.node0);
+		bool isleaf1 = boxset1->isLeafNode(pair.node1);
 
-			_find_quantized_collision_pairs_recursive(
-				boxset0, boxset1,
-				collision_pairs, trans_cache_1to0,
-				boxset0->getRightNode(node0), boxset1->getRightNode(node1), false);
+		if (isleaf0 && isleaf1)
+		{
+			// collision result (the pair already passed its overlap test when pushed)
+			collision_pairs->push_pair(
+				boxset0->getNodeData(pair.node0), boxset1->getNodeData(pair.node1));
+			continue;
+		}
 
-		}  // else if node1 is not a leaf
-	}      // else if node0 is not a leaf
+		int num_pairs;
+		if (isleaf0)
+		{
+			nodes0[0] = pair.node0;
+			nodes0[1] = pair.node0;
+			nodes1[0] = boxset1->getLeftNode(pair.node1);
+			nodes1[1] = boxset1->getRightNode(pair.node1);
+			num_pairs = 2;
+		}
+		else if (isleaf1)
+		{
+			nodes0[0] = boxset0->getLeftNode(pair.node0);
+			nodes0[1] = boxset0->getRightNode(pair.node0);
+			nodes1[0] = pair.node1;
+			nodes1[1] = pair.node1;
+			num_pairs = 2;
+		}
+		else
+		{
+			int left0 = boxset0->getLeftNode(pair.node0);
+			int right0 = boxset0->getRightNode(pair.node0);
+			int left1 = boxset1->getLeftNode(pair.node1);
+			int right1 = boxset1->getRightNode(pair.node1);
+			nodes0[0] = left0;
+			nodes0[1] = left0;
+			nodes0[2] = right0;
+			nodes0[3] = right0;
+			nodes1[0] = left1;
+			nodes1[1] = right1;
+			nodes1[2] = left1;
+			nodes1[3] = right1;
+			num_pairs = 4;
+		}
+
+		int overlap_mask = _quantized_node_collision_batch(
+			boxset0, boxset1, trans_cache_1to0, nodes0, nodes1, num_pairs);
+
+		//push in reverse order so that pairs are processed in the same (left first)
+		//order as the recursive version
+		for (int k = num_pairs - 1; k >= 0; k--)
+		{
+			if (overlap_mask & (1 << k))
+			{
+				GIM_NODE_PAIR child_pair;
+				child_pair.node0 = nodes0[k];
+				child_pair.node1 = nodes1[k];
+				stack.push_back(child_pair);
+			}
+		}
+	}
 }
 
 void cbtGImpactQuantizedBvh::find_collision(const cbtGImpactQuantizedBvh* boxset0, const cbtTransform& trans0,
@@ -477,9 +591,9 @@ void cbtGImpactQuantizedBvh::find_collision(const cbtGImpactQuantizedBvh* boxset
 	bt_begin_gim02_q_tree_time();
 #endif  //TRI_COLLISION_PROFILING
 
-	_find_quantized_collision_pairs_recursive(
+	_find_quantized_collision_pairs(
 		boxset0, boxset1,
-		&collision_pairs, trans_cache_1to0, 0, 0, true);
+		&collision_pairs, trans_cache_1to0);
 #ifdef TRI_COLLISION_PROFILING
 	bt_end_gim02_q_tree_time();
 #endif  //TRI_COLLISION_PROFILING
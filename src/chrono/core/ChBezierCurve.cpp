@@ -50,6 +50,7 @@ namespace chrono {
 // Initialize static members
 // -----------------------------------------------------------------------------
 const size_t ChBezierCurve::m_maxNumIters = 50;
+const size_t ChBezierCurve::m_lengthSamples = 16;
 const double ChBezierCurve::m_sqrDistTol = 1e-6;
 const double ChBezierCurve::m_cosAngleTol = 1e-4;
 const double ChBezierCurve::m_paramTol = 1e-5;
@@ -238,6 +239,7 @@ void ChBezierCurve::setPoints(const std::vector<ChVector<> >& points,
     m_points = points;
     m_inCV = inCV;
     m_outCV = outCV;
+    m_arclen.clear();
 }
 
 // Utility function for solving the tridiagonal system for one of the
@@ -552,6 +554,101 @@ ChVector<> ChBezierCurve::calcClosestPoint(const ChVector<>& loc, size_t i, doub
     */
 }
 
+// -----------------------------------------------------------------------------
+// Arc-length parametrization.
+//
+// The cumulative arc length is approximated by a table of chord lengths sampled
+// at fixed parameter increments in each segment. The table is built lazily on
+// the first arc-length query and discarded whenever the curve points change.
+// -----------------------------------------------------------------------------
+void ChBezierCurve::buildArcLengthTable() const {
+    size_t numSegments = getNumSegments();
+    m_arclen.resize(numSegments * m_lengthSamples + 1);
+    m_arclen[0] = 0;
+
+    double s = 0;
+    for (size_t i = 0; i < numSegments; i++) {
+        ChVector<> prev = eval(i, 0.0);
+        for (size_t j = 1; j <= m_lengthSamples; j++) {
+            ChVector<> crt = eval(i, (double)j / m_lengthSamples);
+            s += (crt - prev).Length();
+            m_arclen[i * m_lengthSamples + j] = s;
+            prev = crt;
+        }
+    }
+}
+
+double ChBezierCurve::getLength() const {
+    if (m_points.size() < 2)
+        return 0;
+    if (m_arclen.empty())
+        buildArcLengthTable();
+    return m_arclen.back();
+}
+
+double ChBezierCurve::calcArcLength(size_t i, double t) const {
+    if (m_points.size() < 2)
+        return 0;
+    if (m_arclen.empty())
+        buildArcLengthTable();
+
+    ChClampValue(t, 0.0, 1.0);
+    double x = t * m_lengthSamples;
+    size_t j = std::min((size_t)x, m_lengthSamples - 1);
+    size_t base = i * m_lengthSamples + j;
+
+    return m_arclen[base] + (x - j) * (m_arclen[base + 1] - m_arclen[base]);
+}
+
+size_t ChBezierCurve::findArcLengthInterval(double s, size_t hint) const {
+    size_t last = m_arclen.size() - 2;
+
+    if (hint <= last && m_arclen[hint] <= s) {
+        // Walk forward from the hint (amortized O(1) for monotone queries).
+        while (hint < last && m_arclen[hint + 1] < s)
+            hint++;
+        return hint;
+    }
+
+    // Hint unusable; locate the interval with a binary search.
+    size_t idx = std::upper_bound(m_arclen.begin(), m_arclen.end(), s) - m_arclen.begin();
+    return std::min(idx > 0 ? idx - 1 : 0, last);
+}
+
+ChVector<> ChBezierCurve::evalByArcLength(double s) const {
+    if (m_arclen.empty() && m_points.size() > 1)
+        buildArcLengthTable();
+    size_t cursor = m_arclen.size();  // invalid hint, forces a binary search
+    return evalByArcLength(s, cursor);
+}
+
+ChVector<> ChBezierCurve::evalByArcLength(double s, size_t& cursor) const {
+    if (m_points.size() < 2)
+        return m_points.empty() ? ChVector<>(0) : m_points.front();
+    if (m_arclen.empty())
+        buildArcLengthTable();
+
+    double length = m_arclen.back();
+    if (m_closed) {
+        s = std::fmod(s, length);
+        if (s < 0)
+            s += length;
+    } else {
+        ChClampValue(s, 0.0, length);
+    }
+
+    cursor = findArcLengthInterval(s, cursor);
+
+    // Interpolate the curve parameter within the sample interval and evaluate.
+    double s0 = m_arclen[cursor];
+    double s1 = m_arclen[cursor + 1];
+    double frac = (s1 > s0) ? (s - s0) / (s1 - s0) : 0;
+    size_t i = cursor / m_lengthSamples;
+    double t = ((cursor % m_lengthSamples) + frac) / m_lengthSamples;
+
+    return eval(i, t);
+}
+
 // -----------------------------------------------------------------------------
 
 void ChBezierCurve::ArchiveOut(ChArchiveOut& marchive)
@@ -582,12 +679,13 @@ void ChBezierCurve::ArchiveIn(ChArchiveIn& marchive)
     marchive >> CHNVP(m_sqrDistTol);
     marchive >> CHNVP(m_cosAngleTol);
     marchive >> CHNVP(m_paramTol);
+    m_arclen.clear();
 }
 
 // -----------------------------------------------------------------------------
 
 ChBezierCurveTracker::ChBezierCurveTracker(std::shared_ptr<ChBezierCurve> path)
-    : m_path(path), m_curInterval(0), m_curParam(0) {}
+    : m_path(path), m_curInterval(0), m_curParam(0), m_arcCursor(0) {}
 
 // -----------------------------------------------------------------------------
 // ChBezierCurveTracker::reset()
@@ -761,6 +859,39 @@ int ChBezierCurveTracker::calcClosestPoint(const ChVector<>& loc, ChVector<>& po
     */
 }
 
+void ChBezierCurveTracker::calcClosestPoints(const std::vector<ChVector<> >& locs, std::vector<ChVector<> >& points) {
+    points.resize(locs.size());
+    if (locs.empty())
+        return;
+
+    // The first location is the per-step tracking query; it updates the tracker state.
+    calcClosestPoint(locs[0], points[0]);
+
+    size_t interval = m_curInterval;
+    double param = m_curParam;
+
+    // Process the remaining locations. Each query warm-starts from the interval localized by the
+    // previous one (the locations are assumed coherent along the path), then the tracker state is
+    // restored to that of the first query.
+    for (size_t k = 1; k < locs.size(); k++)
+        calcClosestPoint(locs[k], points[k]);
+
+    m_curInterval = interval;
+    m_curParam = param;
+}
+
+double ChBezierCurveTracker::getArcLength() const {
+    return m_path->calcArcLength(m_curInterval, m_curParam);
+}
+
+void ChBezierCurveTracker::samplePointsAhead(const std::vector<double>& offsets,
+                                             std::vector<ChVector<> >& points) const {
+    points.resize(offsets.size());
+    double s = getArcLength();
+    for (size_t k = 0; k < offsets.size(); k++)
+        points[k] = m_path->evalByArcLength(s + offsets[k], m_arcCursor);
+}
+
 int ChBezierCurveTracker::calcClosestPoint(const ChVector<>& loc, ChFrame<>& tnb, double& curvature) {
     // Find closest point to specified location
     ChVector<> r;
@@ -135,6 +135,26 @@ class ChApi ChBezierCurve {
     /// to the closest point.
     ChVector<> calcClosestPoint(const ChVector<>& loc, size_t i, double& t) const;
 
+    /// Return the total arc length of the curve.
+    /// The length is approximated from a precomputed table of cumulative chord lengths,
+    /// sampled at fixed parameter increments in each segment and built lazily on first use.
+    double getLength() const;
+
+    /// Return the (approximate) arc length from the start of the curve to the point at the
+    /// given curve parameter (assumed to be in [0,1]) in the specified interval.
+    double calcArcLength(size_t i, double t) const;
+
+    /// Evaluate the curve at the given arc length from the start of the curve.
+    /// The arc length is wrapped around for closed curves and clamped to [0, getLength()]
+    /// otherwise. This performs a binary search in the arc-length table.
+    ChVector<> evalByArcLength(double s) const;
+
+    /// Evaluate the curve at the given arc length from the start of the curve, using the given
+    /// cursor into the arc-length table as a starting point for segment localization. For
+    /// monotonically increasing arc-length queries (e.g. lookahead sampling), the amortized cost
+    /// per query is O(1).
+    ChVector<> evalByArcLength(double s, size_t& cursor) const;
+
     /// Write the knots and control points to the specified file.
     void write(const std::string& filename);
 
@@ -162,12 +182,24 @@ class ChApi ChBezierCurve {
     /// resulting Bezier curve is a spline interpolant of the knots.
     static void solveTriDiag(size_t n, double* rhs, double* x);
 
+    /// Build the table of cumulative chord lengths at the arc-length sample points.
+    void buildArcLengthTable() const;
+
+    /// Return the index in the arc-length table of the sample interval containing the given arc
+    /// length (assumed to be in [0, getLength()]). The hint, if valid and not past the target,
+    /// is used as a starting point for a forward walk; otherwise a binary search is performed.
+    size_t findArcLengthInterval(double s, size_t hint) const;
+
     std::vector<ChVector<> > m_points;  ///< set of knot points
     std::vector<ChVector<> > m_inCV;    ///< set on "incident" control points
     std::vector<ChVector<> > m_outCV;   ///< set of "outgoing" control points
 
     bool m_closed;  ///< treat the path as a closed loop curve
 
+    mutable std::vector<double> m_arclen;  ///< cumulative arc length at the sample points (lazily built)
+
+    static const size_t m_lengthSamples;  ///< number of arc-length samples per segment
+
     static const size_t m_maxNumIters;  ///< maximum number of Newton iterations
     static const double m_sqrDistTol;   ///< tolerance on squared distance
     static const double m_cosAngleTol;  ///< tolerance for orthogonality test
@@ -215,10 +247,28 @@ class ChApi ChBezierCurveTracker {
     /// In such cases, we return an orthonormal frame with X axis along the tangent.
     int calcClosestPoint(const ChVector<>& loc, ChFrame<>& tnb, double& curvature);
 
+    /// Calculate the closest points on the underlying curve to a batch of specified locations.
+    /// The locations are assumed to form a coherent sequence along the path (e.g. the current
+    /// vehicle location followed by lookahead preview points), so that each query can be
+    /// warm-started from the segment localized by the previous one. Only the first query updates
+    /// the persistent tracker state; the per-step tracking of the first location is therefore
+    /// unaffected by the lookahead queries.
+    void calcClosestPoints(const std::vector<ChVector<> >& locs, std::vector<ChVector<> >& points);
+
+    /// Return the (approximate) arc length from the start of the path to the current tracked point.
+    double getArcLength() const;
+
+    /// Evaluate the path at the given arc-length offsets ahead of the current tracked point.
+    /// The offsets are wrapped around for closed paths and clamped to the end of the path
+    /// otherwise. For monotonically increasing offsets (the usual lookahead pattern), a cursor
+    /// into the precomputed arc-length table makes the amortized cost O(1) per sample.
+    void samplePointsAhead(const std::vector<double>& offsets, std::vector<ChVector<> >& points) const;
+
   private:
     std::shared_ptr<ChBezierCurve> m_path;  ///< associated Bezier curve
     size_t m_curInterval;                   ///< current search interval
     double m_curParam;                      ///< parameter for current closest point
+    mutable size_t m_arcCursor;             ///< cursor into the arc-length table for lookahead sampling
 };
 
 CH_CLASS_VERSION(ChBezierCurve,0)
@@ -34,7 +34,7 @@ namespace chrono {
 ///
 /// Further info at the @ref coordinate_transformations manual page.
 
-template <class Real = double>
+template <class Real = ChScalar>
 class ChCoordsys {
   public:
     ChVector<Real> pos;
@@ -30,7 +30,7 @@ namespace chrono {
 /// by the same frame.
 ///
 /// See @ref coordinate_transformations manual page.
-template <class Real = double>
+template <class Real = ChScalar>
 class ChFrame {
   public:
     ChCoordsys<Real> coord;    ///< Rotation and position, as vector+quaternion
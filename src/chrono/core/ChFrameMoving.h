@@ -34,7 +34,7 @@ namespace chrono {
 ///
 /// Further info at the @ref coordinate_transformations manual page.
 
-template <class Real = double>
+template <class Real = ChScalar>
 class ChFrameMoving : public ChFrame<Real> {
   public:
     ChCoordsys<Real> coord_dt;    ///< Rotation and position speed, as vector+quaternion
@@ -58,6 +58,7 @@ struct eigen_static_assert_exception {
 #include "Eigen/Sparse"
 
 #include "chrono/ChConfig.h"
+#include "chrono/core/ChScalar.h"
 #include "chrono/core/ChTypes.h"
 
 namespace chrono {
@@ -69,7 +70,7 @@ namespace chrono {
 
 /// Dense matrix with *dynamic size* (i.e., with unknown at compile time) and row-major storage.
 /// A ChMatrixDynamic is templated by the coefficient type (default: double).
-template <typename T = double>
+template <typename T = ChScalar>
 using ChMatrixDynamic = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
 
 /// Dense matrix with *fixed size* (known at compile time) and row-major storage.
@@ -79,7 +80,7 @@ using ChMatrixNM = Eigen::Matrix<T, M, N, Eigen::RowMajor>;
 
 /// Dense matrix with *dynamic size* (i.e., with unknown at compile time) and column-major storage.
 /// A ChMatrixDynamic_col is templated by the coefficient type (default: double).
-template <typename T = double>
+template <typename T = ChScalar>
 using ChMatrixDynamic_col = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>;
 
 /// Dense matrix with *fixed size* (known at compile time) and column-major storage.
@@ -94,12 +95,12 @@ using ChMatrixNM_col = Eigen::Matrix<T, M, N, Eigen::ColMajor>;
 
 /// Column vector with *dynamic size* (i.e., with size unknown at compile time).
 /// A ChVectorDynamic is templated by the type of its coefficients (default: double).
-template <typename T = double>
+template <typename T = ChScalar>
 using ChVectorDynamic = Eigen::Matrix<T, Eigen::Dynamic, 1, Eigen::ColMajor>;
 
 /// Row vector with *dynamic size* (i.e., with size unknown at compile time).
 /// A ChRowVectorDynamic is templated by the type of its coefficients (default: double).
-template <typename T = double>
+template <typename T = ChScalar>
 using ChRowVectorDynamic = Eigen::Matrix<T, 1, Eigen::Dynamic, Eigen::RowMajor>;
 
 /// Column vector with *fixed size* (known at compile time).
@@ -116,7 +117,7 @@ using ChRowVectorN = Eigen::Matrix<T, 1, N, Eigen::RowMajor>;
 
 /// General-purpose column array with *dynamic size*.
 /// This class provides easy-access to coefficient-wise operations.
-template <typename T = double>
+template <typename T = ChScalar>
 using ChArray = Eigen::Array<T, Eigen::Dynamic, 1, Eigen::ColMajor>;
 
 /// Column array with *fixed size* (known at compile time).
@@ -128,47 +129,48 @@ using ChArrayN = Eigen::Array<T, N, 1>;
 
 //// RADU
 //// Consider templating the following by precision
+//// (for now, they follow the configured default scalar type; see ChScalar.h)
 
-/// Reference to a dense matrix expression, with double coefficients.
+/// Reference to a dense matrix expression, with ChScalar coefficients.
 /// This allows writing non-template functions that can accept either a ChMatrixDynamic or a ChMatrixNM.
-using ChMatrixRef = Eigen::Ref<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
+using ChMatrixRef = Eigen::Ref<Eigen::Matrix<ChScalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
 
-/// Constant reference to a dense matrix expression, with double coefficients.
+/// Constant reference to a dense matrix expression, with ChScalar coefficients.
 /// This allows writing non-template functions that can accept either a ChMatrixDynamic or a ChMatrixNM.
 using ChMatrixConstRef =
-    const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>&;
+    const Eigen::Ref<const Eigen::Matrix<ChScalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>&;
 
-/// Reference to a column vector expression, with double coefficients.
+/// Reference to a column vector expression, with ChScalar coefficients.
 /// This allows writing non-template functions that can accept either a ChVectorDynamic or a ChVectorN.
-using ChVectorRef = Eigen::Ref<Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor>>;
+using ChVectorRef = Eigen::Ref<Eigen::Matrix<ChScalar, Eigen::Dynamic, 1, Eigen::ColMajor>>;
 
-/// Constant reference to a column vector expression, with double coefficients.
+/// Constant reference to a column vector expression, with ChScalar coefficients.
 /// This allows writing non-template functions that can accept either a ChVectorDynamic or a ChRowVectorN.
-using ChVectorConstRef = const Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor>>&;
+using ChVectorConstRef = const Eigen::Ref<const Eigen::Matrix<ChScalar, Eigen::Dynamic, 1, Eigen::ColMajor>>&;
 
-/// Reference to a row vector expression, with double coefficients.
+/// Reference to a row vector expression, with ChScalar coefficients.
 /// This allows writing non-template functions that can accept either a ChRowVectorDynamic or a CVectorN.
-using ChRowVectorRef = Eigen::Ref<Eigen::Matrix<double, 1, Eigen::Dynamic, Eigen::RowMajor>>;
+using ChRowVectorRef = Eigen::Ref<Eigen::Matrix<ChScalar, 1, Eigen::Dynamic, Eigen::RowMajor>>;
 
-/// Constant reference to a row vector expression, with double coefficients.
+/// Constant reference to a row vector expression, with ChScalar coefficients.
 /// This allows writing non-template functions that can accept either a ChRowVectorDynamic or a CVectorN.
-using ChRowVectorConstRef = const Eigen::Ref<const Eigen::Matrix<double, 1, Eigen::Dynamic, Eigen::RowMajor>>&;
+using ChRowVectorConstRef = const Eigen::Ref<const Eigen::Matrix<ChScalar, 1, Eigen::Dynamic, Eigen::RowMajor>>&;
 
 /// Reference to an array expression, templated by coefficient type.
 /// This allows writing non-template functions that can accept either a ChArrayDynamic or a ChArrayN.
-template <typename T = double>
+template <typename T = ChScalar>
 using ChArrayRef = Eigen::Ref<Eigen::Array<T, Eigen::Dynamic, Eigen::ColMajor>>&;
 
 /// Constant reference to an array expression, templated by coefficient type.
 /// This allows writing non-template functions that can accept either a ChArray or a ChArrayN.
-template <typename T = double>
+template <typename T = ChScalar>
 using ChArrayConstRef = const Eigen::Ref<const Eigen::Array<T, Eigen::Dynamic, 1, Eigen::ColMajor>>&;
 
 // -----------------------------------------------------------------------------
 
 /// Sparse matrix representation.
-/// A ChSparseMatrix is an Eigen SparseMatrix with double coefficients, row-major storage order, and int indices.
-using ChSparseMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor, int>;
+/// A ChSparseMatrix is an Eigen SparseMatrix with ChScalar coefficients, row-major storage order, and int indices.
+using ChSparseMatrix = Eigen::SparseMatrix<ChScalar, Eigen::RowMajor, int>;
 
 // -----------------------------------------------------------------------------
 
@@ -253,7 +255,7 @@ inline void StreamOut(ChSparseMatrix& matr, ChStreamOutAscii& stream) {
 
 /// Utility function for slicing a vector based on an array of indices.
 /// Return a new vector which only contains the elements with specified indices.
-template <typename T = double>
+template <typename T = ChScalar>
 ChVectorDynamic<T> SliceVector(ChVectorConstRef v, ChArrayConstRef<int> indices) {
 #if EIGEN_VERSION_AT_LEAST(3, 4, 0)
     return v(indices);
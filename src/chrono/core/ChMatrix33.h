@@ -27,7 +27,7 @@ namespace chrono {
 /// @{
 
 /// Definition of a 3x3 fixed size matrix to represent 3D rotations and inertia tensors.
-template <typename Real = double>
+template <typename Real = ChScalar>
 class ChMatrix33 : public Eigen::Matrix<Real, 3, 3, Eigen::RowMajor> {
   public:
     /// Default constructor: uninitialized 3x3 matrix.
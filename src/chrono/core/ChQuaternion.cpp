@@ -93,6 +93,21 @@ ChQuaternion<double> Qcross(const ChQuaternion<double>& qa, const ChQuaternion<d
     return (res);
 }
 
+// Compute the quaternion products res[i] = qa[i] * qb[i] over contiguous arrays of n quaternions.
+void Qcross_batch(const ChQuaternion<double>* qa,
+                  const ChQuaternion<double>* qb,
+                  ChQuaternion<double>* res,
+                  size_t n) {
+    for (size_t i = 0; i < n; i++)
+        res[i].Cross(qa[i], qb[i]);
+}
+
+// Rotate the n vectors in A by the corresponding quaternions in q.
+void Qrotate_batch(const ChQuaternion<double>* q, const ChVector<double>* A, ChVector<double>* res, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        res[i] = q[i].Rotate(A[i]);
+}
+
 // Get the quaternion from an angle of rotation and an axis, defined in _abs_ coords.
 // The axis is supposed to be fixed, i.e. it is constant during rotation.
 // The 'axis' vector must be normalized.
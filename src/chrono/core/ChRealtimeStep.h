@@ -15,10 +15,21 @@
 #ifndef CHREALTIMESTEP_H
 #define CHREALTIMESTEP_H
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <limits>
+#include <thread>
+#include <vector>
 
 #include "chrono/core/ChTimer.h"
 
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
 namespace chrono {
 
 /// Class for a timer which attempts to enforce soft real-time.
@@ -39,6 +50,153 @@ class ChRealtimeStepTimer : public ChTimer {
     }
 };
 
+/// Class for a real-time governor with deadline tracking and jitter diagnostics.
+/// Unlike ChRealtimeStepTimer, which busy-waits for the entire wait interval, this governor sleeps until close to the
+/// step deadline and only spins for the final stretch (the spin margin), keeping CPU usage low while still hitting the
+/// deadline with sub-millisecond accuracy. Deadlines are derived from an absolute time base, so small wakeup errors do
+/// not accumulate over the course of a simulation. The governor additionally collects per-step overrun and jitter
+/// statistics and can notify a user-provided callback whenever a physics step misses its deadline, allowing
+/// hardware-in-the-loop setups to degrade gracefully instead of silently drifting behind real time.
+class ChRealtimeGovernor {
+  public:
+    /// Aggregate timing statistics, collected over all calls to Spin since construction or the last Reset.
+    struct Statistics {
+        unsigned long num_steps = 0;     ///< number of completed steps
+        unsigned long num_overruns = 0;  ///< number of steps that missed their deadline
+        double max_overrun = 0;          ///< worst deadline overrun [s]
+        double sum_overrun = 0;          ///< cumulative deadline overrun [s]
+        double max_jitter = 0;           ///< worst wakeup lateness over met deadlines [s]
+        double sum_jitter = 0;           ///< cumulative wakeup lateness over met deadlines [s]
+    };
+
+    /// Create the governor (outside the simulation loop, preferably just before beginning the loop).
+    /// The spin margin is the length of the final busy-wait stretch before each deadline; it should be no smaller
+    /// than the worst-case oversleep of the OS sleep primitive (default: 500 microseconds).
+    ChRealtimeGovernor(double spin_margin = 500e-6)
+        : m_spin_margin(ToDuration(spin_margin)), m_histogram(m_num_bins, 0), m_deadline_valid(false) {}
+
+    /// Set the length of the final busy-wait stretch before each deadline.
+    void SetSpinMargin(double spin_margin) { m_spin_margin = ToDuration(spin_margin); }
+
+    /// Set a callback invoked (from within Spin) whenever a step misses its deadline.
+    /// The callback receives the overrun with respect to the deadline, in seconds.
+    void SetOverrunCallback(std::function<void(double)> callback) { m_overrun_callback = callback; }
+
+    /// Call this function INSIDE the simulation loop, just ONCE per loop (preferably as the last call in the loop),
+    /// passing it the integration step size used at this step. The governor sleeps, then spins, until real time
+    /// catches up with simulation time. If the step took longer than the requested step size, the deadline was missed:
+    /// the overrun is recorded, the overrun callback (if any) is invoked, and the time base is re-anchored to the
+    /// current time so that a single long step does not trigger a catch-up spiral in subsequent steps.
+    void Spin(double step) {
+        auto now = std::chrono::steady_clock::now();
+        if (!m_deadline_valid) {
+            m_deadline = now;
+            m_deadline_valid = true;
+        }
+        m_deadline += ToDuration(step);
+
+        if (now > m_deadline) {
+            // Deadline missed; record the overrun and re-anchor the time base to avoid accumulating debt.
+            double overrun = ToSeconds(now - m_deadline);
+            m_stats.num_steps++;
+            m_stats.num_overruns++;
+            m_stats.sum_overrun += overrun;
+            if (overrun > m_stats.max_overrun)
+                m_stats.max_overrun = overrun;
+            AddToHistogram(overrun);
+            m_deadline = now;
+            if (m_overrun_callback)
+                m_overrun_callback(overrun);
+            return;
+        }
+
+        // Sleep until close to the deadline, then spin for the final stretch.
+        if (m_deadline - now > m_spin_margin)
+            std::this_thread::sleep_until(m_deadline - m_spin_margin);
+        while (std::chrono::steady_clock::now() < m_deadline) {
+        }
+
+        // Jitter is the wakeup lateness with respect to the deadline.
+        double jitter = ToSeconds(std::chrono::steady_clock::now() - m_deadline);
+        m_stats.num_steps++;
+        m_stats.sum_jitter += jitter;
+        if (jitter > m_stats.max_jitter)
+            m_stats.max_jitter = jitter;
+        AddToHistogram(jitter);
+    }
+
+    /// Get the aggregate timing statistics collected so far.
+    const Statistics& GetStatistics() const { return m_stats; }
+
+    /// Get the histogram of wakeup lateness and overruns.
+    /// Bin i counts steps whose lateness was in [2^i, 2^(i+1)) microseconds, with bin 0 also including everything
+    /// below one microsecond; the last bin collects all larger values.
+    const std::vector<unsigned long>& GetHistogram() const { return m_histogram; }
+
+    /// Reset all statistics and re-anchor the time base at the next call to Spin.
+    void Reset() {
+        m_stats = Statistics();
+        std::fill(m_histogram.begin(), m_histogram.end(), 0);
+        m_deadline_valid = false;
+    }
+
+    /// Request SCHED_FIFO real-time scheduling with the given priority for the calling thread.
+    /// Return true on success. Only implemented on Linux (where it typically requires elevated privileges or an
+    /// appropriate rtprio limit); a no-op returning false on other platforms.
+    static bool SetRealtimeScheduling(int priority) {
+#if defined(__linux__)
+        sched_param param;
+        param.sched_priority = priority;
+        return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+#else
+        (void)priority;
+        return false;
+#endif
+    }
+
+    /// Pin the calling thread to the given CPU core.
+    /// Return true on success. Only implemented on Linux; a no-op returning false on other platforms.
+    static bool SetThreadAffinity(int core) {
+#if defined(__linux__)
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(core, &cpuset);
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) == 0;
+#else
+        (void)core;
+        return false;
+#endif
+    }
+
+  private:
+    static std::chrono::steady_clock::duration ToDuration(double seconds) {
+        return std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds));
+    }
+
+    static double ToSeconds(std::chrono::steady_clock::duration d) {
+        return std::chrono::duration<double>(d).count();
+    }
+
+    void AddToHistogram(double lateness) {
+        double us = lateness * 1e6;
+        int bin = 0;
+        while (us >= 2 && bin < m_num_bins - 1) {
+            us *= 0.5;
+            bin++;
+        }
+        m_histogram[bin]++;
+    }
+
+    static const int m_num_bins = 24;  ///< number of power-of-two histogram bins
+
+    std::chrono::steady_clock::duration m_spin_margin;   ///< final busy-wait stretch before each deadline
+    std::chrono::steady_clock::time_point m_deadline;    ///< deadline of the current step
+    bool m_deadline_valid;                               ///< has the time base been anchored?
+    Statistics m_stats;                                  ///< aggregate timing statistics
+    std::vector<unsigned long> m_histogram;              ///< power-of-two lateness histogram [us]
+    std::function<void(double)> m_overrun_callback;      ///< invoked when a step misses its deadline
+};
+
 }  // end namespace chrono
 
 #endif
@@ -0,0 +1,46 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHSCALAR_H
+#define CHSCALAR_H
+
+#include <cfloat>
+
+#include "chrono/ChConfig.h"
+
+// Definition of the default scalar type for the core dynamics pipeline (states, linear algebra, solver).
+//
+// By default, all core dynamics calculations are carried out in double precision. If Chrono is configured with
+// USE_SINGLE_PRECISION (which defines CHRONO_SINGLE_PRECISION), the default scalar of the templated math classes
+// (ChVector, ChQuaternion, ChMatrix33, ...) and of the dense linear algebra aliases (ChVectorDynamic, ...) becomes
+// float. This is intended for embedded targets where double throughput and memory bandwidth are limiting; expect
+// reduced accuracy and adjust collision envelopes/margins and solver tolerances accordingly.
+
+namespace chrono {
+
+#ifdef CHRONO_SINGLE_PRECISION
+/// Default scalar type for the core dynamics pipeline.
+typedef float ChScalar;
+    #define CH_SCALAR_EPSILON FLT_EPSILON
+    #define CH_SCALAR_MAX FLT_MAX
+    #define CH_SCALAR_MIN FLT_MIN
+#else
+/// Default scalar type for the core dynamics pipeline.
+typedef double ChScalar;
+    #define CH_SCALAR_EPSILON DBL_EPSILON
+    #define CH_SCALAR_MAX DBL_MAX
+    #define CH_SCALAR_MIN DBL_MIN
+#endif
+
+}  // end namespace chrono
+
+#endif
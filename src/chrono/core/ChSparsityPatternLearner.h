@@ -15,6 +15,9 @@
 #ifndef CHSPARSITYPATTERNLEARNER_H
 #define CHSPARSITYPATTERNLEARNER_H
 
+#include <algorithm>
+#include <vector>
+
 #include "chrono/core/ChMatrix.h"
 
 namespace chrono {
@@ -24,7 +27,9 @@ namespace chrono {
 
 /// Utility class for extracting sparsity patter from a sparse matrix.
 /// Derived from ChSparseMatrix, ChSparsityPatternLearner does not allocate values, but only element indices.
-/// The sparsity pattern can then be applied to a given sparse matrix.
+/// The sparsity pattern can then be applied to a given sparse matrix; a single learner can be applied to any
+/// number of matrices (e.g. the system matrices of multiple ChSystem instances built from the same model),
+/// since the learned pattern is retained across calls to Apply().
 class ChSparsityPatternLearner : public Eigen::SparseMatrix<double, Eigen::RowMajor, int> {
   public:
     ChSparsityPatternLearner(int nrows, int ncols) : ChSparseMatrix(nrows, ncols), processed(false) {
@@ -41,6 +46,23 @@ class ChSparsityPatternLearner : public Eigen::SparseMatrix<double, Eigen::RowMa
         innerVectors[outer].push_back((int)inner);
     }
 
+    /// Forget the learned pattern of the trailing block of the matrix, keeping the leading block intact.
+    /// All indices (both row and column) greater than or equal to 'first_index' are dropped. With the usual
+    /// saddle-point ordering of the system matrix, this allows an incremental pattern update when only the
+    /// trailing constraints (e.g. contacts) changed: reset the tail, then replay the assembly of the changed
+    /// constraints only, leaving the variable and persistent-constraint pattern untouched.
+    void ResetTail(int first_index) {
+        int boundary = std::min(first_index, (int)innerVectors.size());
+        for (int outer = 0; outer < boundary; ++outer) {
+            auto& vec = innerVectors[outer];
+            vec.erase(std::remove_if(vec.begin(), vec.end(), [first_index](int i) { return i >= first_index; }),
+                      vec.end());
+        }
+        for (int outer = boundary; outer < (int)innerVectors.size(); ++outer)
+            innerVectors[outer].clear();
+        processed = false;
+    }
+
     void Apply(ChSparseMatrix& mat) {
         if (!processed)
             process();
@@ -49,21 +71,24 @@ class ChSparsityPatternLearner : public Eigen::SparseMatrix<double, Eigen::RowMa
         mat.resize(rows(), cols());
         mat.reserve(innerVectors_size);
 
-        int col_el = 0;
-        for (auto outer = 0; outer < innerVectors.size(); ++outer) {
-            for (auto inner = innerVectors[outer].begin(); inner != innerVectors[outer].end(); ++inner) {
-                mat.innerIndexPtr()[col_el] = *inner;
-                col_el++;
-            }
+        // The reserved space of each inner vector is contiguous and its start offset is in the outer index;
+        // the inner vectors can therefore be copied independently.
+#pragma omp parallel for schedule(static, 256)
+        for (int outer = 0; outer < (int)innerVectors.size(); ++outer) {
+            int* dest = mat.innerIndexPtr() + mat.outerIndexPtr()[outer];
+            std::copy(innerVectors[outer].begin(), innerVectors[outer].end(), dest);
         }
     }
 
   private:
     void process() {
-        // Find the unique indices of non-zero elements in each inner vector
-        for (auto vec = innerVectors.begin(); vec != innerVectors.end(); ++vec) {
-            vec->sort();
-            vec->unique();
+        // Find the unique indices of non-zero elements in each inner vector.
+        // Each inner vector is independent, so the (dominant) sort/unique work is spread over threads.
+#pragma omp parallel for schedule(dynamic, 256)
+        for (int i = 0; i < (int)innerVectors.size(); ++i) {
+            auto& vec = innerVectors[i];
+            std::sort(vec.begin(), vec.end());
+            vec.erase(std::unique(vec.begin(), vec.end()), vec.end());
         }
 
         // Cache the number of non-zero elements in each inner vector
@@ -78,7 +103,7 @@ class ChSparsityPatternLearner : public Eigen::SparseMatrix<double, Eigen::RowMa
 
     // RowMajor:  innerVectors[i] contains the column indices of non-zero elements in row i
     // ColMajor:  innerVectors[i] contains the row indices of non-zero elements in column i
-    std::vector<std::list<int>> innerVectors;
+    std::vector<std::vector<int>> innerVectors;
 
     // RowMajor: innerVectors_size[i] contains the number of non-zero elements in row i
     // ColMajor: innerVectors_size[i] contains the number of non-zero elements in column i
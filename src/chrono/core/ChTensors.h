@@ -31,7 +31,7 @@ namespace chrono {
 /// memory when compared to traditional 3D tensors with three
 /// rows and three columns, that are symmetric.
 
-template <class Real = double>
+template <class Real = ChScalar>
 class ChVoightTensor : public ChVectorN<Real, 6> {
   public:
     /// Constructor (default empty).
@@ -202,7 +202,7 @@ class ChVoightTensor : public ChVectorN<Real, 6> {
 };
 
 /// Class for stress tensors, in compact Voight notation that is with 6 components in a column.
-template <class Real = double>
+template <class Real = ChScalar>
 class ChStressTensor : public ChVoightTensor<Real> {
   public:
     /// Constructor (default empty).
@@ -237,7 +237,7 @@ class ChStressTensor : public ChVoightTensor<Real> {
 };
 
 /// Class for strain tensors, in compact Voight notation that is with 6 components in a column.
-template <class Real = double>
+template <class Real = ChScalar>
 class ChStrainTensor : public ChVoightTensor<Real> {
   public:
     /// Constructor (default empty).
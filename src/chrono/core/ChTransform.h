@@ -35,7 +35,7 @@ namespace chrono {
 ///   ChTransform<>::SomeFunction(..)
 ///
 
-template <class Real = double>
+template <class Real = ChScalar>
 class ChTransform {
   public:
     //
@@ -31,7 +31,7 @@ namespace chrono {
 /// ChVector is templated by precision, with default 'double'.
 ///
 /// Further info at the @ref mathematical_objects manual page.
-template <class Real = double>
+template <class Real = ChScalar>
 class ChVector {
   public:
     // CONSTRUCTORS
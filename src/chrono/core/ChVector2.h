@@ -24,13 +24,14 @@
 #include <limits>
 
 #include "chrono/core/ChMathematics.h"
+#include "chrono/core/ChScalar.h"
 #include "chrono/serialization/ChArchive.h"
 
 namespace chrono {
 
 /// Definition of a general purpose 2d vector.
 /// ChVector2 is templated by precision, with default 'double'.
-template <class Real = double>
+template <class Real = ChScalar>
 class ChVector2 {
   public:
     // CONSTRUCTORS
@@ -0,0 +1,190 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CHVECTOR3PADDED_H
+#define CHVECTOR3PADDED_H
+
+#include <vector>
+
+#include "chrono/core/ChAlignedAllocator.h"
+#include "chrono/core/ChVector.h"
+
+#if defined(CHRONO_SIMD_ENABLED) && defined(CHRONO_AVX_2_0)
+    #include <immintrin.h>
+#endif
+
+namespace chrono {
+
+/// Padded 3d vector for bulk storage in vectorized kernels.
+///
+/// A ChVector<double> occupies 24 bytes; in a contiguous array, every other element therefore
+/// straddles a 32-byte boundary and requires split-register loads. ChVector3Padded stores the
+/// same three doubles in a 32-byte aligned, 4-lane slot whose 4th lane is kept at zero, so that
+/// an array of these vectors supports aligned full-width loads and the padding lane can be
+/// carried through 4-lane arithmetic without affecting 3d results (dot products, norms, etc.).
+///
+/// This layout is a per-container opt-in: it costs 33% more memory than the packed form, so
+/// memory-sensitive paths should keep std::vector<ChVector<>> and convert at kernel boundaries
+/// with Pack()/Unpack(). Use ChVector3PaddedArray for properly aligned storage.
+class ChVector3Padded {
+  public:
+    ChVector3Padded() : m_data{0, 0, 0, 0} {}
+    ChVector3Padded(double x, double y, double z) : m_data{x, y, z, 0} {}
+    ChVector3Padded(const ChVector<double>& v) : m_data{v.x(), v.y(), v.z(), 0} {}
+
+    /// Access to components
+    double x() const { return m_data[0]; }
+    double y() const { return m_data[1]; }
+    double z() const { return m_data[2]; }
+    double& x() { return m_data[0]; }
+    double& y() { return m_data[1]; }
+    double& z() { return m_data[2]; }
+
+    /// Return const pointer to underlying array storage (4 lanes, 32-byte aligned).
+    const double* data() const { return m_data; }
+
+    /// Return pointer to underlying array storage (4 lanes, 32-byte aligned).
+    /// Writing a nonzero value in the 4th lane violates the class invariant.
+    double* data() { return m_data; }
+
+    /// Conversion to a packed 3d vector.
+    ChVector<double> ToVector() const { return ChVector<double>(m_data[0], m_data[1], m_data[2]); }
+
+#if defined(CHRONO_SIMD_ENABLED) && defined(CHRONO_AVX_2_0)
+
+    ChVector3Padded& operator+=(const ChVector3Padded& v) {
+        Store(_mm256_add_pd(Load(), v.Load()));
+        return *this;
+    }
+
+    ChVector3Padded& operator-=(const ChVector3Padded& v) {
+        Store(_mm256_sub_pd(Load(), v.Load()));
+        return *this;
+    }
+
+    ChVector3Padded& operator*=(double s) {
+        Store(_mm256_mul_pd(Load(), _mm256_set1_pd(s)));
+        return *this;
+    }
+
+    /// Dot product with another vector (the zero padding lane contributes nothing).
+    double Dot(const ChVector3Padded& v) const {
+        __m256d t = _mm256_mul_pd(Load(), v.Load());
+        __m128d lo = _mm256_castpd256_pd128(t);
+        __m128d hi = _mm256_extractf128_pd(t, 1);
+        lo = _mm_add_pd(lo, hi);
+        return _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+    }
+
+    /// Cross product with another vector.
+    ChVector3Padded Cross(const ChVector3Padded& v) const {
+        __m256d a = Load();
+        __m256d b = v.Load();
+        __m256d a_yzx = _mm256_permute4x64_pd(a, 0xC9);
+        __m256d b_yzx = _mm256_permute4x64_pd(b, 0xC9);
+        __m256d c = _mm256_sub_pd(_mm256_mul_pd(a, b_yzx), _mm256_mul_pd(a_yzx, b));
+        ChVector3Padded result;
+        result.Store(_mm256_permute4x64_pd(c, 0xC9));
+        return result;
+    }
+
+    /// Load the 4 lanes in a vector register (aligned load).
+    __m256d Load() const { return _mm256_load_pd(m_data); }
+
+    /// Store a vector register in the 4 lanes (aligned store).
+    /// The caller must guarantee a zero 4th lane.
+    void Store(__m256d v) { _mm256_store_pd(m_data, v); }
+
+#else
+
+    ChVector3Padded& operator+=(const ChVector3Padded& v) {
+        m_data[0] += v.m_data[0];
+        m_data[1] += v.m_data[1];
+        m_data[2] += v.m_data[2];
+        return *this;
+    }
+
+    ChVector3Padded& operator-=(const ChVector3Padded& v) {
+        m_data[0] -= v.m_data[0];
+        m_data[1] -= v.m_data[1];
+        m_data[2] -= v.m_data[2];
+        return *this;
+    }
+
+    ChVector3Padded& operator*=(double s) {
+        m_data[0] *= s;
+        m_data[1] *= s;
+        m_data[2] *= s;
+        return *this;
+    }
+
+    /// Dot product with another vector.
+    double Dot(const ChVector3Padded& v) const {
+        return m_data[0] * v.m_data[0] + m_data[1] * v.m_data[1] + m_data[2] * v.m_data[2];
+    }
+
+    /// Cross product with another vector.
+    ChVector3Padded Cross(const ChVector3Padded& v) const {
+        return ChVector3Padded(m_data[1] * v.m_data[2] - m_data[2] * v.m_data[1],
+                               m_data[2] * v.m_data[0] - m_data[0] * v.m_data[2],
+                               m_data[0] * v.m_data[1] - m_data[1] * v.m_data[0]);
+    }
+
+#endif
+
+    ChVector3Padded operator+(const ChVector3Padded& v) const {
+        ChVector3Padded result(*this);
+        result += v;
+        return result;
+    }
+
+    ChVector3Padded operator-(const ChVector3Padded& v) const {
+        ChVector3Padded result(*this);
+        result -= v;
+        return result;
+    }
+
+    ChVector3Padded operator*(double s) const {
+        ChVector3Padded result(*this);
+        result *= s;
+        return result;
+    }
+
+    /// Squared Euclidean norm.
+    double Length2() const { return Dot(*this); }
+
+  private:
+    alignas(32) double m_data[4];  ///< lanes (x, y, z, 0)
+};
+
+/// Contiguous, 32-byte aligned array of padded 3d vectors.
+using ChVector3PaddedArray = std::vector<ChVector3Padded, aligned_allocator<ChVector3Padded, 32>>;
+
+/// Convert an array of packed 3d vectors to the padded layout.
+inline void Pack(const std::vector<ChVector<double>>& in, ChVector3PaddedArray& out) {
+    out.resize(in.size());
+    for (size_t i = 0; i < in.size(); i++)
+        out[i] = ChVector3Padded(in[i]);
+}
+
+/// Convert an array of padded 3d vectors back to the packed layout.
+inline void Unpack(const ChVector3PaddedArray& in, std::vector<ChVector<double>>& out) {
+    out.resize(in.size());
+    for (size_t i = 0; i < in.size(); i++)
+        out[i] = in[i].ToVector();
+}
+
+}  // end namespace chrono
+
+#endif
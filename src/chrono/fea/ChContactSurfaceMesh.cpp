@@ -551,7 +551,7 @@ void ChContactTriangleXYZROT::ComputeUVfromP(const ChVector<> P, double& u, doub
 // =============================================================================
 
 ChContactSurfaceMesh::ChContactSurfaceMesh(std::shared_ptr<ChMaterialSurface> material, ChMesh* mesh)
-    : ChContactSurface(material, mesh) {}
+    : ChContactSurface(material, mesh), m_use_midphase(false), m_sphere_swept(0) {}
 
 void ChContactSurfaceMesh::AddFace(std::shared_ptr<ChNodeFEAxyz> node1,
                                    std::shared_ptr<ChNodeFEAxyz> node2,
@@ -570,6 +570,8 @@ void ChContactSurfaceMesh::AddFace(std::shared_ptr<ChNodeFEAxyz> node1,
     assert(node2);
     assert(node3);
 
+    m_sphere_swept = sphere_swept;
+
     auto contact_triangle = chrono_types::make_shared<ChContactTriangleXYZ>();
     contact_triangle->SetNodes({{node1, node2, node3}});
     contact_triangle->SetNodeOwnership({owns_node1, owns_node2, owns_node3});
@@ -1318,6 +1320,8 @@ unsigned int ChContactSurfaceMesh::GetNumVertices() const {
 }
 
 void ChContactSurfaceMesh::SurfaceSyncCollisionModels() {
+    if (m_use_midphase)
+        return;
     for (unsigned int j = 0; j < vfaces.size(); j++) {
         vfaces[j]->GetCollisionModel()->SyncPosition();
     }
@@ -1328,6 +1332,8 @@ void ChContactSurfaceMesh::SurfaceSyncCollisionModels() {
 
 void ChContactSurfaceMesh::SurfaceAddCollisionModelsToSystem(ChSystem* msys) {
     assert(msys);
+    if (m_use_midphase)
+        return;
     SurfaceSyncCollisionModels();
     for (unsigned int j = 0; j < vfaces.size(); j++) {
         msys->GetCollisionSystem()->Add(vfaces[j]->GetCollisionModel());
@@ -1339,6 +1345,8 @@ void ChContactSurfaceMesh::SurfaceAddCollisionModelsToSystem(ChSystem* msys) {
 
 void ChContactSurfaceMesh::SurfaceRemoveCollisionModelsFromSystem(ChSystem* msys) {
     assert(msys);
+    if (m_use_midphase)
+        return;
     for (unsigned int j = 0; j < vfaces.size(); j++) {
         msys->GetCollisionSystem()->Remove(vfaces[j]->GetCollisionModel());
     }
@@ -510,6 +510,18 @@ class ChApi ChContactSurfaceMesh : public ChContactSurface {
     /// Get the number of vertices.
     unsigned int GetNumVertices() const;
 
+    /// Enable handling of this surface by a dedicated mesh midphase (see ChContactSurfaceMeshMidphase).
+    /// When enabled, the per-triangle collision models of this surface are not registered with the collision
+    /// system; broadphase, candidate generation, and contact creation are performed by the midphase object with
+    /// which this surface was registered. Called automatically by ChContactSurfaceMeshMidphase::AddSurface.
+    void EnableDedicatedMidphase(bool val) { m_use_midphase = val; }
+
+    /// Return true if this surface is handled by a dedicated mesh midphase.
+    bool UseDedicatedMidphase() const { return m_use_midphase; }
+
+    /// Return the sweep thickness (sphere_swept radius) of the collision faces of this surface.
+    double GetSweepThickness() const { return m_sphere_swept; }
+
     // Functions to interface this with ChPhysicsItem container
     virtual void SurfaceSyncCollisionModels() override;
     virtual void SurfaceAddCollisionModelsToSystem(ChSystem* msys) override;
@@ -534,6 +546,9 @@ class ChApi ChContactSurfaceMesh : public ChContactSurface {
 
     std::vector<std::shared_ptr<ChContactTriangleXYZ>> vfaces;         ///< XYZ-node collision faces
     std::vector<std::shared_ptr<ChContactTriangleXYZROT>> vfaces_rot;  ///< XYWROT-node collision faces
+
+    bool m_use_midphase;     ///< surface handled by a dedicated mesh midphase (skip the collision system)?
+    double m_sphere_swept;   ///< sweep thickness of the collision faces (as passed to AddFace)
 };
 
 /// @} fea_contact
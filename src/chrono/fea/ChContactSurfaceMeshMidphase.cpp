@@ -0,0 +1,398 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <numeric>
+
+#include "chrono/collision/ChCollisionUtils.h"
+#include "chrono/fea/ChContactSurfaceMeshMidphase.h"
+#include "chrono/physics/ChContactContainer.h"
+
+namespace chrono {
+namespace fea {
+
+// Maximum number of faces in a BVH leaf.
+static const int bvh_leaf_size = 4;
+
+ChContactSurfaceMeshMidphase::ChContactSurfaceMeshMidphase(double envelope) : m_envelope(envelope) {}
+
+void ChContactSurfaceMeshMidphase::AddSurface(std::shared_ptr<ChContactSurfaceMesh> surface, bool self_contact) {
+    surface->EnableDedicatedMidphase(true);
+    SurfaceData sd;
+    sd.surface = surface;
+    sd.self_contact = self_contact;
+    sd.thickness = 0;
+    sd.built = false;
+    m_surfaces.push_back(sd);
+}
+
+void ChContactSurfaceMeshMidphase::Setup(SurfaceData& sd) {
+    sd.surface->OutputSimpleMesh(sd.vpos, sd.vvel, sd.faces, sd.owns_node, sd.owns_edge);
+
+    if (sd.built)
+        return;
+
+    // Collect the per-face collision models and shapes, in the same order used by OutputSimpleMesh.
+    sd.thickness = sd.surface->GetSweepThickness();
+    sd.models.clear();
+    sd.shapes.clear();
+    for (const auto& tri : sd.surface->GetTriangleList()) {
+        sd.models.push_back(tri->GetCollisionModel());
+        sd.shapes.push_back(tri->GetCollisionModel()->GetShape(0).get());
+    }
+    for (const auto& tri : sd.surface->GetTriangleListRot()) {
+        sd.models.push_back(tri->GetCollisionModel());
+        sd.shapes.push_back(tri->GetCollisionModel()->GetShape(0).get());
+    }
+
+    // Build the BVH topology over the faces (the AABBs themselves are set by Refit).
+    int nf = (int)sd.faces.size();
+    sd.face_bmin.resize(nf);
+    sd.face_bmax.resize(nf);
+    sd.prim.resize(nf);
+    std::iota(sd.prim.begin(), sd.prim.end(), 0);
+    sd.nodes.clear();
+    sd.nodes.reserve(2 * nf);
+    if (nf > 0)
+        BuildNode(sd, 0, nf);
+    sd.built = true;
+}
+
+int ChContactSurfaceMeshMidphase::BuildNode(SurfaceData& sd, int start, int end) {
+    int inode = (int)sd.nodes.size();
+    sd.nodes.push_back(BVHNode());
+
+    if (end - start <= bvh_leaf_size) {
+        sd.nodes[inode].left = -1;
+        sd.nodes[inode].right = -1;
+        sd.nodes[inode].start = start;
+        sd.nodes[inode].count = end - start;
+        return inode;
+    }
+
+    // Split at the median centroid along the axis of largest centroid extent.
+    ChVector<> cmin(+1e30);
+    ChVector<> cmax(-1e30);
+    for (int i = start; i < end; i++) {
+        const ChVector<int>& f = sd.faces[sd.prim[i]];
+        ChVector<> c = (sd.vpos[f.x()] + sd.vpos[f.y()] + sd.vpos[f.z()]) / 3.0;
+        cmin = ChVector<>(ChMin(cmin.x(), c.x()), ChMin(cmin.y(), c.y()), ChMin(cmin.z(), c.z()));
+        cmax = ChVector<>(ChMax(cmax.x(), c.x()), ChMax(cmax.y(), c.y()), ChMax(cmax.z(), c.z()));
+    }
+    ChVector<> extent = cmax - cmin;
+    int axis = 0;
+    if (extent.y() > extent.x())
+        axis = 1;
+    if (extent.z() > extent[axis])
+        axis = 2;
+
+    int mid = (start + end) / 2;
+    std::nth_element(sd.prim.begin() + start, sd.prim.begin() + mid, sd.prim.begin() + end,
+                     [&sd, axis](int a, int b) {
+                         const ChVector<int>& fa = sd.faces[a];
+                         const ChVector<int>& fb = sd.faces[b];
+                         double ca = sd.vpos[fa.x()][axis] + sd.vpos[fa.y()][axis] + sd.vpos[fa.z()][axis];
+                         double cb = sd.vpos[fb.x()][axis] + sd.vpos[fb.y()][axis] + sd.vpos[fb.z()][axis];
+                         return ca < cb;
+                     });
+
+    // Children are created after the parent, so a reverse sweep over the node array visits children first (Refit).
+    int left = BuildNode(sd, start, mid);
+    int right = BuildNode(sd, mid, end);
+    sd.nodes[inode].left = left;
+    sd.nodes[inode].right = right;
+    sd.nodes[inode].start = -1;
+    sd.nodes[inode].count = 0;
+    return inode;
+}
+
+void ChContactSurfaceMeshMidphase::Refit(SurfaceData& sd) {
+    // Per-face AABBs, inflated by the face sweep thickness and the contact envelope.
+    double inflate = sd.thickness + m_envelope;
+    for (int f = 0; f < (int)sd.faces.size(); f++) {
+        const ChVector<>& p0 = sd.vpos[sd.faces[f].x()];
+        const ChVector<>& p1 = sd.vpos[sd.faces[f].y()];
+        const ChVector<>& p2 = sd.vpos[sd.faces[f].z()];
+        sd.face_bmin[f] = ChVector<>(ChMin(ChMin(p0.x(), p1.x()), p2.x()) - inflate,
+                                     ChMin(ChMin(p0.y(), p1.y()), p2.y()) - inflate,
+                                     ChMin(ChMin(p0.z(), p1.z()), p2.z()) - inflate);
+        sd.face_bmax[f] = ChVector<>(ChMax(ChMax(p0.x(), p1.x()), p2.x()) + inflate,
+                                     ChMax(ChMax(p0.y(), p1.y()), p2.y()) + inflate,
+                                     ChMax(ChMax(p0.z(), p1.z()), p2.z()) + inflate);
+    }
+
+    // Bottom-up refit; children always follow their parent in the preorder node array.
+    for (int i = (int)sd.nodes.size() - 1; i >= 0; i--) {
+        BVHNode& node = sd.nodes[i];
+        if (node.left < 0) {
+            node.bmin = ChVector<>(+1e30);
+            node.bmax = ChVector<>(-1e30);
+            for (int k = node.start; k < node.start + node.count; k++) {
+                int f = sd.prim[k];
+                node.bmin = ChVector<>(ChMin(node.bmin.x(), sd.face_bmin[f].x()),
+                                       ChMin(node.bmin.y(), sd.face_bmin[f].y()),
+                                       ChMin(node.bmin.z(), sd.face_bmin[f].z()));
+                node.bmax = ChVector<>(ChMax(node.bmax.x(), sd.face_bmax[f].x()),
+                                       ChMax(node.bmax.y(), sd.face_bmax[f].y()),
+                                       ChMax(node.bmax.z(), sd.face_bmax[f].z()));
+            }
+        } else {
+            const BVHNode& nl = sd.nodes[node.left];
+            const BVHNode& nr = sd.nodes[node.right];
+            node.bmin = ChVector<>(ChMin(nl.bmin.x(), nr.bmin.x()), ChMin(nl.bmin.y(), nr.bmin.y()),
+                                   ChMin(nl.bmin.z(), nr.bmin.z()));
+            node.bmax = ChVector<>(ChMax(nl.bmax.x(), nr.bmax.x()), ChMax(nl.bmax.y(), nr.bmax.y()),
+                                   ChMax(nl.bmax.z(), nr.bmax.z()));
+        }
+    }
+}
+
+// Overlap test between two axis-aligned boxes.
+static bool BoxesOverlap(const ChVector<>& amin,
+                         const ChVector<>& amax,
+                         const ChVector<>& bmin,
+                         const ChVector<>& bmax) {
+    return amin.x() <= bmax.x() && bmin.x() <= amax.x() &&  //
+           amin.y() <= bmax.y() && bmin.y() <= amax.y() &&  //
+           amin.z() <= bmax.z() && bmin.z() <= amax.z();
+}
+
+// Check if two faces of the same surface share a vertex (adjacent faces are excluded from self-contact).
+static bool FacesShareVertex(const ChVector<int>& fa, const ChVector<int>& fb) {
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            if (fa[i] == fb[j])
+                return true;
+    return false;
+}
+
+void ChContactSurfaceMeshMidphase::CollideNodes(const SurfaceData& sa,
+                                                int ia,
+                                                const SurfaceData& sb,
+                                                int ib,
+                                                std::vector<ChVector2<int>>& pairs) {
+    const BVHNode& na = sa.nodes[ia];
+    const BVHNode& nb = sb.nodes[ib];
+    if (!BoxesOverlap(na.bmin, na.bmax, nb.bmin, nb.bmax))
+        return;
+
+    if (na.left < 0 && nb.left < 0) {
+        for (int i = na.start; i < na.start + na.count; i++) {
+            int fa = sa.prim[i];
+            for (int j = nb.start; j < nb.start + nb.count; j++) {
+                int fb = sb.prim[j];
+                if (BoxesOverlap(sa.face_bmin[fa], sa.face_bmax[fa], sb.face_bmin[fb], sb.face_bmax[fb]))
+                    pairs.push_back(ChVector2<int>(fa, fb));
+            }
+        }
+        return;
+    }
+
+    // Descend into the larger non-leaf node.
+    if (nb.left < 0 || (na.left >= 0 && (na.bmax - na.bmin).Length2() > (nb.bmax - nb.bmin).Length2())) {
+        CollideNodes(sa, na.left, sb, ib, pairs);
+        CollideNodes(sa, na.right, sb, ib, pairs);
+    } else {
+        CollideNodes(sa, ia, sb, nb.left, pairs);
+        CollideNodes(sa, ia, sb, nb.right, pairs);
+    }
+}
+
+void ChContactSurfaceMeshMidphase::CollideNodesSelf(const SurfaceData& sd,
+                                                    int ia,
+                                                    int ib,
+                                                    std::vector<ChVector2<int>>& pairs) {
+    const BVHNode& na = sd.nodes[ia];
+    const BVHNode& nb = sd.nodes[ib];
+
+    if (ia == ib) {
+        if (na.left < 0) {
+            for (int i = na.start; i < na.start + na.count; i++)
+                for (int j = i + 1; j < na.start + na.count; j++) {
+                    int fa = sd.prim[i];
+                    int fb = sd.prim[j];
+                    if (!FacesShareVertex(sd.faces[fa], sd.faces[fb]) &&
+                        BoxesOverlap(sd.face_bmin[fa], sd.face_bmax[fa], sd.face_bmin[fb], sd.face_bmax[fb]))
+                        pairs.push_back(ChVector2<int>(fa, fb));
+                }
+            return;
+        }
+        CollideNodesSelf(sd, na.left, na.left, pairs);
+        CollideNodesSelf(sd, na.right, na.right, pairs);
+        CollideNodesSelf(sd, na.left, na.right, pairs);
+        return;
+    }
+
+    if (!BoxesOverlap(na.bmin, na.bmax, nb.bmin, nb.bmax))
+        return;
+
+    if (na.left < 0 && nb.left < 0) {
+        for (int i = na.start; i < na.start + na.count; i++)
+            for (int j = nb.start; j < nb.start + nb.count; j++) {
+                int fa = sd.prim[i];
+                int fb = sd.prim[j];
+                if (!FacesShareVertex(sd.faces[fa], sd.faces[fb]) &&
+                    BoxesOverlap(sd.face_bmin[fa], sd.face_bmax[fa], sd.face_bmin[fb], sd.face_bmax[fb]))
+                    pairs.push_back(ChVector2<int>(fa, fb));
+            }
+        return;
+    }
+
+    if (nb.left < 0 || (na.left >= 0 && (na.bmax - na.bmin).Length2() > (nb.bmax - nb.bmin).Length2())) {
+        CollideNodesSelf(sd, na.left, ib, pairs);
+        CollideNodesSelf(sd, na.right, ib, pairs);
+    } else {
+        CollideNodesSelf(sd, ia, nb.left, pairs);
+        CollideNodesSelf(sd, ia, nb.right, pairs);
+    }
+}
+
+void ChContactSurfaceMeshMidphase::ProcessFacePair(const SurfaceData& sa,
+                                                   int fa,
+                                                   const SurfaceData& sb,
+                                                   int fb,
+                                                   ChSystem* msys) {
+    const ChVector<>& pa0 = sa.vpos[sa.faces[fa].x()];
+    const ChVector<>& pa1 = sa.vpos[sa.faces[fa].y()];
+    const ChVector<>& pa2 = sa.vpos[sa.faces[fa].z()];
+    const ChVector<>& pb0 = sb.vpos[sb.faces[fb].x()];
+    const ChVector<>& pb1 = sb.vpos[sb.faces[fb].y()];
+    const ChVector<>& pb2 = sb.vpos[sb.faces[fb].z()];
+
+    ChVector<> nA = Vcross(pa1 - pa0, pa2 - pa0).GetNormalized();
+    ChVector<> nB = Vcross(pb1 - pb0, pb2 - pb0).GetNormalized();
+
+    double rA = sa.thickness;
+    double rB = sb.thickness;
+    double max_gap = m_envelope;
+
+    collision::ChCollisionInfo cinfo;
+    cinfo.modelA = sa.models[fa];
+    cinfo.modelB = sb.models[fb];
+    cinfo.shapeA = sa.shapes[fa];
+    cinfo.shapeB = sb.shapes[fb];
+
+    auto contact_container = msys->GetContactContainer();
+
+    // Vertices of face A (owned by A) against face B. Faces are one-sided: only vertices on the outward side of B
+    // are considered, while a small window below the swept surface keeps contacts alive under penetration.
+    for (int i = 0; i < 3; i++) {
+        if (!sa.owns_node[fa][i])
+            continue;
+        const ChVector<>& P = sa.vpos[sa.faces[fa][i]];
+        double mu, mv;
+        bool is_into;
+        ChVector<> proj;
+        collision::utils::PointTriangleDistance(P, pb0, pb1, pb2, mu, mv, is_into, proj);
+        if (!is_into)
+            continue;
+        double d = Vdot(P - proj, nB);
+        if (d - rA - rB > max_gap || d < -(rA + rB + max_gap))
+            continue;
+        cinfo.vN = -nB;
+        cinfo.vpA = P + cinfo.vN * rA;
+        cinfo.vpB = proj - cinfo.vN * rB;
+        cinfo.distance = d - rA - rB;
+        contact_container->AddContact(cinfo);
+    }
+
+    // Vertices of face B (owned by B) against face A.
+    for (int i = 0; i < 3; i++) {
+        if (!sb.owns_node[fb][i])
+            continue;
+        const ChVector<>& P = sb.vpos[sb.faces[fb][i]];
+        double mu, mv;
+        bool is_into;
+        ChVector<> proj;
+        collision::utils::PointTriangleDistance(P, pa0, pa1, pa2, mu, mv, is_into, proj);
+        if (!is_into)
+            continue;
+        double d = Vdot(P - proj, nA);
+        if (d - rA - rB > max_gap || d < -(rA + rB + max_gap))
+            continue;
+        cinfo.vN = nA;
+        cinfo.vpA = proj + cinfo.vN * rA;
+        cinfo.vpB = P - cinfo.vN * rB;
+        cinfo.distance = d - rA - rB;
+        contact_container->AddContact(cinfo);
+    }
+
+    // Owned edges of face A against owned edges of face B. Only closest points strictly interior to both segments
+    // generate contacts; endpoint cases are covered by the node-face tests above.
+    const ChVector<>* va[3] = {&pa0, &pa1, &pa2};
+    const ChVector<>* vb[3] = {&pb0, &pb1, &pb2};
+    for (int i = 0; i < 3; i++) {
+        if (!sa.owns_edge[fa][i])
+            continue;
+        const ChVector<>& ea0 = *va[i];
+        const ChVector<>& ea1 = *va[(i + 1) % 3];
+        for (int j = 0; j < 3; j++) {
+            if (!sb.owns_edge[fb][j])
+                continue;
+            const ChVector<>& eb0 = *vb[j];
+            const ChVector<>& eb1 = *vb[(j + 1) % 3];
+            ChVector<> pa, pb;
+            double mua, mub;
+            if (!collision::utils::LineLineIntersect(ea0, ea1, eb0, eb1, &pa, &pb, &mua, &mub))
+                continue;
+            if (mua <= 0 || mua >= 1 || mub <= 0 || mub >= 1)
+                continue;
+            ChVector<> D = pb - pa;
+            double dist = D.Length();
+            if (dist < 1e-12 || dist - rA - rB > max_gap)
+                continue;
+            cinfo.vN = D / dist;
+            cinfo.vpA = pa + cinfo.vN * rA;
+            cinfo.vpB = pb - cinfo.vN * rB;
+            cinfo.distance = dist - rA - rB;
+            contact_container->AddContact(cinfo);
+        }
+    }
+}
+
+void ChContactSurfaceMeshMidphase::OnCustomCollision(ChSystem* msys) {
+    // Refresh the deformed positions and refit the hierarchies.
+    for (auto& sd : m_surfaces) {
+        Setup(sd);
+        if (!sd.nodes.empty())
+            Refit(sd);
+    }
+
+    std::vector<ChVector2<int>> pairs;
+
+    // Self-contact, per surface.
+    for (auto& sd : m_surfaces) {
+        if (!sd.self_contact || sd.nodes.empty())
+            continue;
+        pairs.clear();
+        CollideNodesSelf(sd, 0, 0, pairs);
+        for (const auto& p : pairs)
+            ProcessFacePair(sd, p.x(), sd, p.y(), msys);
+    }
+
+    // Surface vs surface, per surface pair.
+    for (size_t a = 0; a < m_surfaces.size(); a++) {
+        if (m_surfaces[a].nodes.empty())
+            continue;
+        for (size_t b = a + 1; b < m_surfaces.size(); b++) {
+            if (m_surfaces[b].nodes.empty())
+                continue;
+            pairs.clear();
+            CollideNodes(m_surfaces[a], 0, m_surfaces[b], 0, pairs);
+            for (const auto& p : pairs)
+                ProcessFacePair(m_surfaces[a], p.x(), m_surfaces[b], p.y(), msys);
+        }
+    }
+}
+
+}  // end namespace fea
+}  // end namespace chrono
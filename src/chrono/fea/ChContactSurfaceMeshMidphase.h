@@ -0,0 +1,122 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHCONTACTSURFACEMESHMIDPHASE_H
+#define CHCONTACTSURFACEMESHMIDPHASE_H
+
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+#include "chrono/fea/ChContactSurfaceMesh.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_contact
+/// @{
+
+/// Dedicated midphase for FEA mesh contact surfaces (ChContactSurfaceMesh).
+///
+/// The default treatment of a mesh contact surface registers one collision model per triangle with the collision
+/// system; for large surfaces (e.g. an airbag mesh with hundreds of thousands of faces), this floods the broadphase
+/// with proxies that all move every step. This class bypasses the per-triangle models entirely: each registered
+/// surface gets a refittable bounding volume hierarchy, built once over the mesh topology and refit to the deformed
+/// nodal positions every step; candidate face pairs are generated in batch per surface pair (optionally including a
+/// surface against itself, for self-contact); and node-face and edge-edge contacts are created directly in the
+/// system contact container. Node and edge ownership of the collision faces is used to avoid duplicate contacts,
+/// exactly as in the default per-triangle treatment. Faces are treated as one-sided (contact from the outward side),
+/// consistent with the default treatment of shell collision faces.
+///
+/// Usage:
+/// <pre>
+///     auto midphase = chrono_types::make_shared<ChContactSurfaceMeshMidphase>();
+///     midphase->AddSurface(surface, true);  // handle 'surface', with self-contact
+///     system->RegisterCustomCollisionCallback(midphase);
+/// </pre>
+/// Surfaces registered here are automatically excluded from the collision system broadphase. Contacts between a
+/// registered surface and bodies or surfaces not registered here are NOT detected by this midphase.
+class ChApi ChContactSurfaceMeshMidphase : public ChSystem::CustomCollisionCallback {
+  public:
+    ChContactSurfaceMeshMidphase(double envelope = 0.0005);
+
+    /// Add a mesh contact surface to this midphase.
+    /// The surface is excluded from the collision system broadphase; collision detection for it (against the other
+    /// surfaces registered here and, if requested, against itself) is performed by this midphase instead.
+    void AddSurface(std::shared_ptr<ChContactSurfaceMesh> surface, bool self_contact = false);
+
+    /// Set the envelope within which contacts between two faces are created (default: 0.0005).
+    /// Contacts are created when two features come closer than the sum of the face sweep thicknesses plus this
+    /// envelope, so that contacts exist before penetration occurs.
+    void SetEnvelope(double envelope) { m_envelope = envelope; }
+
+    /// Perform collision detection for the registered surfaces and add contacts to the system contact container.
+    /// Called automatically by the system during collision detection.
+    virtual void OnCustomCollision(ChSystem* msys) override;
+
+  private:
+    /// Node of a flattened (preorder) axis-aligned bounding box tree over the faces of one contact surface.
+    struct BVHNode {
+        ChVector<> bmin;  ///< lower corner of the node AABB
+        ChVector<> bmax;  ///< upper corner of the node AABB
+        int left;         ///< index of left child (-1 for a leaf)
+        int right;        ///< index of right child (-1 for a leaf)
+        int start;        ///< first face (index into the leaf ordering) for a leaf node
+        int count;        ///< number of faces for a leaf node
+    };
+
+    /// Cached collision data for one registered contact surface.
+    struct SurfaceData {
+        std::shared_ptr<ChContactSurfaceMesh> surface;  ///< the contact surface
+        bool self_contact;                              ///< also collide this surface against itself?
+        double thickness;                               ///< sweep thickness (sphere_swept) of the collision faces
+        std::vector<ChVector<>> vpos;                   ///< current vertex positions (refreshed every step)
+        std::vector<ChVector<>> vvel;                   ///< current vertex velocities (refreshed every step)
+        std::vector<ChVector<int>> faces;               ///< face vertex indices
+        std::vector<ChVector<bool>> owns_node;          ///< per-face node ownership
+        std::vector<ChVector<bool>> owns_edge;          ///< per-face edge ownership
+        std::vector<collision::ChCollisionModel*> models;  ///< per-face collision model (for contact creation)
+        std::vector<collision::ChCollisionShape*> shapes;  ///< per-face collision shape (for contact material)
+        std::vector<ChVector<>> face_bmin;              ///< per-face inflated AABB, lower corner
+        std::vector<ChVector<>> face_bmax;              ///< per-face inflated AABB, upper corner
+        std::vector<int> prim;                          ///< face indices in BVH leaf order
+        std::vector<BVHNode> nodes;                     ///< flattened BVH nodes (preorder, root first)
+        bool built;                                     ///< BVH topology already built?
+    };
+
+    /// Refresh vertex positions and build the BVH topology (first call only).
+    void Setup(SurfaceData& sd);
+
+    /// Recursively build the BVH over the face range [start, end) of sd.prim; return the node index.
+    int BuildNode(SurfaceData& sd, int start, int end);
+
+    /// Recompute the per-face AABBs and refit the BVH node AABBs to the current vertex positions.
+    void Refit(SurfaceData& sd);
+
+    /// Collect candidate face pairs between the subtrees rooted at ia (in sa) and ib (in sb).
+    void CollideNodes(const SurfaceData& sa, int ia, const SurfaceData& sb, int ib, std::vector<ChVector2<int>>& pairs);
+
+    /// Collect candidate face pairs within the subtree rooted at ia against the one rooted at ib (same surface).
+    void CollideNodesSelf(const SurfaceData& sd, int ia, int ib, std::vector<ChVector2<int>>& pairs);
+
+    /// Generate node-face and edge-edge contacts between two candidate faces and add them to the contact container.
+    void ProcessFacePair(const SurfaceData& sa, int fa, const SurfaceData& sb, int fb, ChSystem* msys);
+
+    double m_envelope;                    ///< envelope within which contacts are created
+    std::vector<SurfaceData> m_surfaces;  ///< registered contact surfaces
+};
+
+/// @} fea_contact
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
@@ -104,6 +104,11 @@ class ChApi ChElementBase {
     ///   R += forces * c
     virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {}
 
+    /// As EleIntLoadResidual_F, for use when the caller guarantees that no other element concurrently updates
+    /// the same entries of R (e.g. elements processed by conflict-free groups, see ChMesh element coloring);
+    /// implementations may then skip atomic protection of the updates.
+    virtual void EleIntLoadResidual_F_exclusive(ChVectorDynamic<>& R, const double c) { EleIntLoadResidual_F(R, c); }
+
     /// Add the product of element mass M by a vector w (pasted at global nodes offsets) into
     /// a global vector R, multiplied by a scaling factor c, as
     ///   R += M * w * c
@@ -117,6 +122,14 @@ class ChApi ChElementBase {
     /// and not even the g vector, for instance if using lumped masses.
     virtual void EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector<>& G_acc, const double c) = 0;
 
+    /// As EleIntLoadResidual_F_gravity, for use when the caller guarantees that no other element concurrently
+    /// updates the same entries of R (see EleIntLoadResidual_F_exclusive).
+    virtual void EleIntLoadResidual_F_gravity_exclusive(ChVectorDynamic<>& R,
+                                                        const ChVector<>& G_acc,
+                                                        const double c) {
+        EleIntLoadResidual_F_gravity(R, G_acc, c);
+    }
+
     // Functions for interfacing to the solver
 
     /// Indicate that there are item(s) of type ChKblock in this object (for further passing it to a solver)
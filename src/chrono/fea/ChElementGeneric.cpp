@@ -40,6 +40,23 @@ void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c
     // GetLog() << "EleIntLoadResidual_F , R=" << R << "\n";
 }
 
+void ChElementGeneric::EleIntLoadResidual_F_exclusive(ChVectorDynamic<>& R, const double c) {
+    ChVectorDynamic<> Fi(GetNdofs());
+    ComputeInternalForces(Fi);
+    Fi *= c;
+
+    //// Called for elements within one group of a colored assembly: no other element updates the
+    //// same entries of R concurrently, so plain (non-atomic) increments can be used.
+
+    int stride = 0;
+    for (int in = 0; in < GetNnodes(); in++) {
+        int node_dofs = GetNodeNdofs_active(in);
+        if (!GetNodeN(in)->IsFixed())
+            R.segment(GetNodeN(in)->NodeGetOffsetW(), node_dofs) += Fi.segment(stride, node_dofs);
+        stride += GetNodeNdofs(in);
+    }
+}
+
 void ChElementGeneric::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) {
     ChMatrixDynamic<> Mi(GetNdofs(), GetNdofs());
     ComputeMmatrixGlobal(Mi);
@@ -86,6 +103,25 @@ void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const
     }
 }
 
+void ChElementGeneric::EleIntLoadResidual_F_gravity_exclusive(ChVectorDynamic<>& R,
+                                                              const ChVector<>& G_acc,
+                                                              const double c) {
+    ChVectorDynamic<> Fg(GetNdofs());
+    ComputeGravityForces(Fg, G_acc);
+    Fg *= c;
+
+    //// Called for elements within one group of a colored assembly: no other element updates the
+    //// same entries of R concurrently, so plain (non-atomic) increments can be used.
+
+    int stride = 0;
+    for (int in = 0; in < GetNnodes(); in++) {
+        int node_dofs = GetNodeNdofs_active(in);
+        if (!GetNodeN(in)->IsFixed())
+            R.segment(GetNodeN(in)->NodeGetOffsetW(), node_dofs) += Fg.segment(stride, node_dofs);
+        stride += GetNodeNdofs(in);
+    }
+}
+
 // A default fall-back implementation of the ComputeGravityForces that will work for all elements inherited from
 // ChLoadableUVW and with nonzero GetDensity().
 void ChElementGeneric::ComputeGravityForces(ChVectorDynamic<>& Fg, const ChVector<>& G_acc) {
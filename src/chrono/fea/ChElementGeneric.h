@@ -44,6 +44,10 @@ class ChApi ChElementGeneric : public ChElementBase {
     /// This default implementation is SLIGHTLY INEFFICIENT.
     virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) override;
 
+    /// As EleIntLoadResidual_F, but without atomic protection of the updates to R.
+    /// Only called when elements are assembled by conflict-free groups (see ChMesh element coloring).
+    virtual void EleIntLoadResidual_F_exclusive(ChVectorDynamic<>& R, const double c) override;
+
     /// Add the product of element mass M by a vector w (pasted at global nodes offsets) into
     /// a global vector R, multiplied by a scaling factor c, as
     ///   R += M * w * c
@@ -57,6 +61,12 @@ class ChApi ChElementGeneric : public ChElementBase {
     /// only if they are inherited by ChLoadableUVW so it can use GetDensity() and Gauss quadrature.
     virtual void EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector<>& G_acc, const double c) override;
 
+    /// As EleIntLoadResidual_F_gravity, but without atomic protection of the updates to R.
+    /// Only called when elements are assembled by conflict-free groups (see ChMesh element coloring).
+    virtual void EleIntLoadResidual_F_gravity_exclusive(ChVectorDynamic<>& R,
+                                                        const ChVector<>& G_acc,
+                                                        const double c) override;
+
     // FEM functions
 
     /// Compute the gravitational forces.
@@ -21,7 +21,7 @@
 // Dynamics Eccomas thematic Conference, Madrid(2005).
 //
 // The "Pre-Integration" style calculation is based on modifications
-// to Liu, Cheng, Qiang Tian, and Haiyan Hu. "Dynamics of a large scale rigid�flexible multibody system composed of
+// to Liu, Cheng, Qiang Tian, and Haiyan Hu. "Dynamics of a large scale rigid�flexible multibody system composed of
 // composite laminated plates." Multibody System Dynamics 26, no. 3 (2011): 283-305.
 //
 // A report covering the detailed mathematics and implementation both of these generalized internal force calculations
@@ -1440,6 +1440,22 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntPreInt(ChVectorDynamic<
 // Jacobians of internal forces
 // -----------------------------------------------------------------------------
 
+// Scratch matrices for the "Continuous Integration" style Jacobian calculations below.  Each of the three
+// temporaries is a (3*NSF x 6*NIP) dense matrix (~300 kB) that is needed by every element on every Newton
+// iteration.  One persistent copy is kept per thread so that the parallel element loop in
+// ChMesh::KRMmatricesLoad reuses warm buffers instead of paying a large heap allocation and release (with
+// the associated allocator contention between threads) for each element Jacobian evaluation.
+struct JacobianScratch_3843 {
+    ChMatrixDynamic<> PE;
+    ChMatrixDynamic<> Scaled_Combined_PE;
+    ChMatrixDynamic<> DScaled_Combined_PE;
+};
+
+static JacobianScratch_3843& GetJacobianScratch() {
+    static thread_local JacobianScratch_3843 scratch;
+    return scratch;
+}
+
 void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef& H,
                                                                    double Kfactor,
                                                                    double Rfactor,
@@ -1493,7 +1509,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     // The explanation of the calculation above is just too long to write it all on a single line.
     // =============================================================================
 
-    ChMatrixDynamic<> PE;
+    ChMatrixDynamic<>& PE = GetJacobianScratch().PE;
     PE.resize(3 * NSF, 6 * NIP);
 
     for (auto i = 0; i < NSF; i++) {
@@ -1577,7 +1593,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     // calculating this matrix.
     // =============================================================================
 
-    ChMatrixDynamic<> Scaled_Combined_PE;
+    ChMatrixDynamic<>& Scaled_Combined_PE = GetJacobianScratch().Scaled_Combined_PE;
     Scaled_Combined_PE.resize(3 * NSF, 6 * NIP);
 
     for (auto i = 0; i < NSF; i++) {
@@ -1641,7 +1657,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     // Gauss quadrature point
     // =============================================================================
 
-    ChMatrixDynamic<> DScaled_Combined_PE;
+    ChMatrixDynamic<>& DScaled_Combined_PE = GetJacobianScratch().DScaled_Combined_PE;
     DScaled_Combined_PE.resize(3 * NSF, 6 * NIP);
 
     DScaled_Combined_PE.template block<3 * NSF, NIP>(0, 0) =
@@ -1914,7 +1930,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
     // Note that each partial derivative block shown is placed to the left of the previous block.
     // The explanation of the calculation above is just too long to write it all on a single line.
     // =============================================================================
-    ChMatrixDynamic<> PE;
+    ChMatrixDynamic<>& PE = GetJacobianScratch().PE;
     PE.resize(3 * NSF, 6 * NIP);
 
     for (auto i = 0; i < NSF; i++) {
@@ -1986,7 +2002,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
     // row major memory layout to align with the access patterns for calculating this matrix.
     // =============================================================================
 
-    ChMatrixDynamic<> Scaled_Combined_PE;
+    ChMatrixDynamic<>& Scaled_Combined_PE = GetJacobianScratch().Scaled_Combined_PE;
     Scaled_Combined_PE.resize(3 * NSF, 6 * NIP);
 
     for (auto i = 0; i < NSF; i++) {
@@ -2049,7 +2065,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
     // Multiply the scaled and combined partial derivative block matrix by the stiffness matrix for each individual
     // Gauss quadrature point
     // =============================================================================
-    ChMatrixDynamic<> DScaled_Combined_PE;
+    ChMatrixDynamic<>& DScaled_Combined_PE = GetJacobianScratch().DScaled_Combined_PE;
     DScaled_Combined_PE.resize(3 * NSF, 6 * NIP);
 
     DScaled_Combined_PE.template block<3 * NSF, NIP>(0, 0) =
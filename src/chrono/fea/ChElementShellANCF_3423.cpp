@@ -139,6 +139,10 @@ void ChElementShellANCF_3423::SetupInitial(ChSystem* system) {
     // Compute mass matrix and gravitational force scaling term (constant)
     ComputeMassMatrix();
     ComputeGravityForceScale();
+
+    // Cache the reference-configuration data at the quadrature points of each layer, used at
+    // every internal force evaluation
+    PrecomputeInternalForceQuadData();
 }
 
 // State update.
@@ -306,146 +310,167 @@ void ChElementShellANCF_3423::ComputeGravityForces(ChVectorDynamic<>& Fg, const
 // Elastic force calculation
 // -----------------------------------------------------------------------------
 
-// The class ShellANCF_Force provides the integrand for the calculation of the internal forces
-// for one layer of an ANCF shell element.
-// The first 24 entries in the integrand represent the internal force.
-// The next 5 entries represent the residual of the EAS nonlinear system.
-// The last 25 entries represent the 5x5 Jacobian of the EAS nonlinear system.
-// Capabilities of this class include: application of enhanced assumed strain (EAS) and
-// assumed natural strain (ANS) formulations to avoid thickness and (transverse and in-plane)
-// shear locking. This implementation also features a composite material implementation
-// that allows for selecting a number of layers over the element thickness; each of which
-// has an independent, user-selected fiber angle (direction for orthotropic constitutive behavior)
-class ShellANCF_Force : public ChIntegrable3D<ChVectorN<double, 54>> {
-  public:
-    ShellANCF_Force(ChElementShellANCF_3423* element,  // Containing element
-                    size_t kl,                         // Current layer index
-                    ChVectorN<double, 5>* alpha_eas    // Vector of internal parameters for EAS formulation
-                    )
-        : m_element(element), m_kl(kl), m_alpha_eas(alpha_eas) {}
-    ~ShellANCF_Force() {}
+// Precompute, for each Gauss quadrature point of each layer, all quantities that depend only on the
+// reference configuration and the layer setup: shape function (derivative) vectors, the coefficients of
+// the contravariant transformation, the EAS projection matrix, and the combined quadrature weight.
+// The quadrature layout (2x2x2 points per layer, order 2) matches the one previously used through
+// ChQuadrature::Integrate3D in the internal force calculation.
+void ChElementShellANCF_3423::PrecomputeInternalForceQuadData() {
+    const std::vector<double>& roots = ChQuadrature::GetStaticTables()->Lroots[1];
+    const std::vector<double>& weights = ChQuadrature::GetStaticTables()->Weight[1];
+    const size_t NIP = roots.size() * roots.size() * roots.size();
 
-  private:
-    ChElementShellANCF_3423* m_element;
-    size_t m_kl;
-    ChVectorN<double, 5>* m_alpha_eas;
+    m_quadCache.resize(m_numLayers * NIP);
 
-    /// Evaluate (strainD'*strain)  at point x, include ANS and EAS.
-    virtual void Evaluate(ChVectorN<double, 54>& result, const double x, const double y, const double z) override;
-};
-
-void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, const double y, const double z) {
-    // Element shape function
-    ChElementShellANCF_3423::ShapeVector N;
-    m_element->ShapeFunctions(N, x, y, z);
-
-    // Determinant of position vector gradient matrix: Initial configuration
-    ChElementShellANCF_3423::ShapeVector Nx;
-    ChElementShellANCF_3423::ShapeVector Ny;
-    ChElementShellANCF_3423::ShapeVector Nz;
-    ChMatrixNM<double, 1, 3> Nx_d0;
-    ChMatrixNM<double, 1, 3> Ny_d0;
-    ChMatrixNM<double, 1, 3> Nz_d0;
-    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
-
-    // ANS shape function
-    ChMatrixNM<double, 1, 4> S_ANS;  // Shape function vector for Assumed Natural Strain
-    ChMatrixNM<double, 6, 5> M;      // Shape function vector for Enhanced Assumed Strain
-    m_element->ShapeFunctionANSbilinearShell(S_ANS, x, y);
-    m_element->Basis_M(M, x, y, z);
-
-    // Transformation : Orthogonal transformation (A and J)
-    ChVector<double> G1xG2;  // Cross product of first and second column of
-    double G1dotG1;          // Dot product of first column of position vector gradient
-
-    G1xG2.x() = Nx_d0(1) * Ny_d0(2) - Nx_d0(2) * Ny_d0(1);
-    G1xG2.y() = Nx_d0(2) * Ny_d0(0) - Nx_d0(0) * Ny_d0(2);
-    G1xG2.z() = Nx_d0(0) * Ny_d0(1) - Nx_d0(1) * Ny_d0(0);
-    G1dotG1 = Nx_d0(0) * Nx_d0(0) + Nx_d0(1) * Nx_d0(1) + Nx_d0(2) * Nx_d0(2);
-
-    // Tangent Frame
-    ChVector<double> A1;
-    ChVector<double> A2;
-    ChVector<double> A3;
-    A1.x() = Nx_d0(0);
-    A1.y() = Nx_d0(1);
-    A1.z() = Nx_d0(2);
-    A1 = A1 / sqrt(G1dotG1);
-    A3 = G1xG2.GetNormalized();
-    A2.Cross(A3, A1);
-
-    // Direction for orthotropic material
-    double theta = m_element->GetLayer(m_kl).Get_theta();  // Fiber angle
-    ChVector<double> AA1;
-    ChVector<double> AA2;
-    ChVector<double> AA3;
-    AA1 = A1 * cos(theta) + A2 * sin(theta);
-    AA2 = -A1 * sin(theta) + A2 * cos(theta);
-    AA3 = A3;
-
-    /// Beta
-    ChMatrixNM<double, 3, 3> j0;
-    ChVector<double> j01;
-    ChVector<double> j02;
-    ChVector<double> j03;
-    ChVectorN<double, 9> beta;
-    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
-    j0(0, 0) = Ny_d0(1) * Nz_d0(2) - Nz_d0(1) * Ny_d0(2);
-    j0(0, 1) = Ny_d0(2) * Nz_d0(0) - Ny_d0(0) * Nz_d0(2);
-    j0(0, 2) = Ny_d0(0) * Nz_d0(1) - Nz_d0(0) * Ny_d0(1);
-    j0(1, 0) = Nz_d0(1) * Nx_d0(2) - Nx_d0(1) * Nz_d0(2);
-    j0(1, 1) = Nz_d0(2) * Nx_d0(0) - Nx_d0(2) * Nz_d0(0);
-    j0(1, 2) = Nz_d0(0) * Nx_d0(1) - Nz_d0(1) * Nx_d0(0);
-    j0(2, 0) = Nx_d0(1) * Ny_d0(2) - Ny_d0(1) * Nx_d0(2);
-    j0(2, 1) = Ny_d0(0) * Nx_d0(2) - Nx_d0(0) * Ny_d0(2);
-    j0(2, 2) = Nx_d0(0) * Ny_d0(1) - Ny_d0(0) * Nx_d0(1);
-    j0 /= detJ0;
-
-    j01[0] = j0(0, 0);
-    j02[0] = j0(1, 0);
-    j03[0] = j0(2, 0);
-    j01[1] = j0(0, 1);
-    j02[1] = j0(1, 1);
-    j03[1] = j0(2, 1);
-    j01[2] = j0(0, 2);
-    j02[2] = j0(1, 2);
-    j03[2] = j0(2, 2);
-
-    // Coefficients of contravariant transformation
-    beta(0) = Vdot(AA1, j01);
-    beta(1) = Vdot(AA2, j01);
-    beta(2) = Vdot(AA3, j01);
-    beta(3) = Vdot(AA1, j02);
-    beta(4) = Vdot(AA2, j02);
-    beta(5) = Vdot(AA3, j02);
-    beta(6) = Vdot(AA1, j03);
-    beta(7) = Vdot(AA2, j03);
-    beta(8) = Vdot(AA3, j03);
+    for (size_t kl = 0; kl < m_numLayers; kl++) {
+        // z quadrature interval for this layer
+        double Zc1 = (m_GaussZ[kl + 1] - m_GaussZ[kl]) / 2;
+        double Zc2 = (m_GaussZ[kl + 1] + m_GaussZ[kl]) / 2;
+
+        const ChMatrixNM<double, 6, 6>& T0 = GetLayer(kl).Get_T0();
+        double detJ0C = GetLayer(kl).Get_detJ0C();
+        double theta = GetLayer(kl).Get_theta();  // Fiber angle
+
+        size_t ip = 0;
+        for (size_t ix = 0; ix < roots.size(); ix++) {
+            for (size_t iy = 0; iy < roots.size(); iy++) {
+                for (size_t iz = 0; iz < roots.size(); iz++) {
+                    double x = roots[ix];
+                    double y = roots[iy];
+                    double z = Zc1 * roots[iz] + Zc2;
+
+                    CachedQuadPoint& qp = m_quadCache[kl * NIP + ip];
+                    ip++;
+
+                    // Element shape functions
+                    ShapeFunctions(qp.N, x, y, z);
+
+                    // Determinant of position vector gradient matrix: Initial configuration
+                    ShapeVector Nz;
+                    ChMatrixNM<double, 1, 3> Nx_d0;
+                    ChMatrixNM<double, 1, 3> Ny_d0;
+                    ChMatrixNM<double, 1, 3> Nz_d0;
+                    double detJ0 = Calc_detJ0(x, y, z, qp.Nx, qp.Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
+
+                    // ANS shape function
+                    ShapeFunctionANSbilinearShell(qp.S_ANS, x, y);
+
+                    // Shape function vector for Enhanced Assumed Strain
+                    ChMatrixNM<double, 6, 5> M;
+                    Basis_M(M, x, y, z);
+
+                    // Transformation : Orthogonal transformation (A and J)
+                    ChVector<double> G1xG2;  // Cross product of first and second column of
+                    double G1dotG1;          // Dot product of first column of position vector gradient
+
+                    G1xG2.x() = Nx_d0(1) * Ny_d0(2) - Nx_d0(2) * Ny_d0(1);
+                    G1xG2.y() = Nx_d0(2) * Ny_d0(0) - Nx_d0(0) * Ny_d0(2);
+                    G1xG2.z() = Nx_d0(0) * Ny_d0(1) - Nx_d0(1) * Ny_d0(0);
+                    G1dotG1 = Nx_d0(0) * Nx_d0(0) + Nx_d0(1) * Nx_d0(1) + Nx_d0(2) * Nx_d0(2);
+
+                    // Tangent Frame
+                    ChVector<double> A1;
+                    ChVector<double> A2;
+                    ChVector<double> A3;
+                    A1.x() = Nx_d0(0);
+                    A1.y() = Nx_d0(1);
+                    A1.z() = Nx_d0(2);
+                    A1 = A1 / sqrt(G1dotG1);
+                    A3 = G1xG2.GetNormalized();
+                    A2.Cross(A3, A1);
+
+                    // Direction for orthotropic material
+                    ChVector<double> AA1;
+                    ChVector<double> AA2;
+                    ChVector<double> AA3;
+                    AA1 = A1 * cos(theta) + A2 * sin(theta);
+                    AA2 = -A1 * sin(theta) + A2 * cos(theta);
+                    AA3 = A3;
+
+                    /// Beta
+                    ChMatrixNM<double, 3, 3> j0;
+                    ChVector<double> j01;
+                    ChVector<double> j02;
+                    ChVector<double> j03;
+                    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
+                    j0(0, 0) = Ny_d0(1) * Nz_d0(2) - Nz_d0(1) * Ny_d0(2);
+                    j0(0, 1) = Ny_d0(2) * Nz_d0(0) - Ny_d0(0) * Nz_d0(2);
+                    j0(0, 2) = Ny_d0(0) * Nz_d0(1) - Nz_d0(0) * Ny_d0(1);
+                    j0(1, 0) = Nz_d0(1) * Nx_d0(2) - Nx_d0(1) * Nz_d0(2);
+                    j0(1, 1) = Nz_d0(2) * Nx_d0(0) - Nx_d0(2) * Nz_d0(0);
+                    j0(1, 2) = Nz_d0(0) * Nx_d0(1) - Nz_d0(1) * Nx_d0(0);
+                    j0(2, 0) = Nx_d0(1) * Ny_d0(2) - Ny_d0(1) * Nx_d0(2);
+                    j0(2, 1) = Ny_d0(0) * Nx_d0(2) - Nx_d0(0) * Ny_d0(2);
+                    j0(2, 2) = Nx_d0(0) * Ny_d0(1) - Ny_d0(0) * Nx_d0(1);
+                    j0 /= detJ0;
+
+                    j01[0] = j0(0, 0);
+                    j02[0] = j0(1, 0);
+                    j03[0] = j0(2, 0);
+                    j01[1] = j0(0, 1);
+                    j02[1] = j0(1, 1);
+                    j03[1] = j0(2, 1);
+                    j01[2] = j0(0, 2);
+                    j02[2] = j0(1, 2);
+                    j03[2] = j0(2, 2);
+
+                    // Coefficients of contravariant transformation
+                    qp.beta(0) = Vdot(AA1, j01);
+                    qp.beta(1) = Vdot(AA2, j01);
+                    qp.beta(2) = Vdot(AA3, j01);
+                    qp.beta(3) = Vdot(AA1, j02);
+                    qp.beta(4) = Vdot(AA2, j02);
+                    qp.beta(5) = Vdot(AA3, j02);
+                    qp.beta(6) = Vdot(AA1, j03);
+                    qp.beta(7) = Vdot(AA2, j03);
+                    qp.beta(8) = Vdot(AA3, j03);
+
+                    // Enhanced Assumed Strain projection
+                    qp.G = T0 * M * (detJ0C / detJ0);
+
+                    qp.d0d0Nx = m_d0d0T * qp.Nx.transpose();
+                    qp.d0d0Ny = m_d0d0T * qp.Ny.transpose();
+
+                    // Combined quadrature weight, including the z-interval scaling and the element Jacobians
+                    qp.wdetJ0 = weights[ix] * weights[iy] * weights[iz] * Zc1 * detJ0 * m_GaussScaling;
+                }
+            }
+        }
+    }
+}
 
-    // Transformation matrix, function of fiber angle
-    const ChMatrixNM<double, 6, 6>& T0 = m_element->GetLayer(m_kl).Get_T0();
-    // Determinant of the initial position vector gradient at the element center
-    double detJ0C = m_element->GetLayer(m_kl).Get_detJ0C();
+// Accumulate the internal force integrand contribution at one cached quadrature point, including the EAS
+// residual and EAS Jacobian terms. This performs the same calculation as the former coordinate-based
+// integrand, with all reference-configuration quantities looked up in the cache instead of recomputed.
+void ChElementShellANCF_3423::EvaluateInternalForceQuadPoint(const CachedQuadPoint& qp,
+                                                             size_t kl,
+                                                             const ChVectorN<double, 5>& alpha_eas,
+                                                             ChVectorN<double, 24>& Fint,
+                                                             ChVectorN<double, 5>& HE,
+                                                             ChMatrixNM<double, 5, 5>& KALPHA) {
+    const ShapeVector& N = qp.N;
+    const ShapeVector& Nx = qp.Nx;
+    const ShapeVector& Ny = qp.Ny;
+    const ChMatrixNM<double, 1, 4>& S_ANS = qp.S_ANS;
+    const ChVectorN<double, 9>& beta = qp.beta;
 
     // Enhanced Assumed Strain
-    ChMatrixNM<double, 6, 5> G = T0 * M * (detJ0C / detJ0);
-    ChVectorN<double, 6> strain_EAS = G * (*m_alpha_eas);
+    ChVectorN<double, 6> strain_EAS = qp.G * alpha_eas;
 
-    ChVectorN<double, 8> ddNx = m_element->m_ddT * Nx.transpose();
-    ChVectorN<double, 8> ddNy = m_element->m_ddT * Ny.transpose();
+    ChVectorN<double, 8> ddNx = m_ddT * Nx.transpose();
+    ChVectorN<double, 8> ddNy = m_ddT * Ny.transpose();
 
-    ChVectorN<double, 8> d0d0Nx = m_element->m_d0d0T * Nx.transpose();
-    ChVectorN<double, 8> d0d0Ny = m_element->m_d0d0T * Ny.transpose();
+    const ChVectorN<double, 8>& d0d0Nx = qp.d0d0Nx;
+    const ChVectorN<double, 8>& d0d0Ny = qp.d0d0Ny;
 
     // Strain component
     ChVectorN<double, 6> strain_til;
     strain_til(0) = 0.5 * ((Nx * ddNx)(0, 0) - (Nx * d0d0Nx)(0, 0));
     strain_til(1) = 0.5 * ((Ny * ddNy)(0, 0) - (Ny * d0d0Ny)(0, 0));
     strain_til(2) = (Nx * ddNy)(0, 0) - (Nx * d0d0Ny)(0, 0);
-    strain_til(3) = N(0) * m_element->m_strainANS(0) + N(2) * m_element->m_strainANS(1) +
-                    N(4) * m_element->m_strainANS(2) + N(6) * m_element->m_strainANS(3);
-    strain_til(4) = S_ANS(0, 2) * m_element->m_strainANS(6) + S_ANS(0, 3) * m_element->m_strainANS(7);
-    strain_til(5) = S_ANS(0, 0) * m_element->m_strainANS(4) + S_ANS(0, 1) * m_element->m_strainANS(5);
+    strain_til(3) = N(0) * m_strainANS(0) + N(2) * m_strainANS(1) + N(4) * m_strainANS(2) + N(6) * m_strainANS(3);
+    strain_til(4) = S_ANS(0, 2) * m_strainANS(6) + S_ANS(0, 3) * m_strainANS(7);
+    strain_til(5) = S_ANS(0, 0) * m_strainANS(4) + S_ANS(0, 1) * m_strainANS(5);
 
     // For orthotropic material
     ChVectorN<double, 6> strain;
@@ -480,7 +505,7 @@ void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, co
     ChMatrixNM<double, 1, 3> tempB3;
     ChMatrixNM<double, 1, 3> tempB31;
 
-    tempB3 = Nx * m_element->m_d;
+    tempB3 = Nx * m_d;
     for (int i = 0; i < 8; i++) {
         for (int j = 0; j < 3; j++) {
             tempB(0, i * 3 + j) = tempB3(0, j) * Nx(0, i);
@@ -488,7 +513,7 @@ void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, co
     }
     strainD_til.row(0) = tempB;
 
-    tempB3 = Ny * m_element->m_d;
+    tempB3 = Ny * m_d;
     for (int i = 0; i < 8; i++) {
         for (int j = 0; j < 3; j++) {
             tempB(0, i * 3 + j) = tempB3(0, j) * Ny(0, i);
@@ -496,7 +521,7 @@ void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, co
     }
     strainD_til.row(1) = tempB;
 
-    tempB31 = Nx * m_element->m_d;
+    tempB31 = Nx * m_d;
     for (int i = 0; i < 8; i++) {
         for (int j = 0; j < 3; j++) {
             tempB(0, i * 3 + j) = tempB3(0, j) * Nx(0, i) + tempB31(0, j) * Ny(0, i);
@@ -506,19 +531,19 @@ void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, co
 
     tempB.setZero();
     for (int i = 0; i < 4; i++) {
-        tempB += N(i * 2) * m_element->m_strainANS_D.row(i);
+        tempB += N(i * 2) * m_strainANS_D.row(i);
     }
     strainD_til.row(3) = tempB;  // strainD for zz
 
     tempB.setZero();
     for (int i = 0; i < 2; i++) {
-        tempB += S_ANS(0, i + 2) * m_element->m_strainANS_D.row(i + 6);
+        tempB += S_ANS(0, i + 2) * m_strainANS_D.row(i + 6);
     }
     strainD_til.row(4) = tempB;  // strainD for xz
 
     tempB.setZero();
     for (int i = 0; i < 2; i++) {
-        tempB += S_ANS(0, i) * m_element->m_strainANS_D.row(i + 4);
+        tempB += S_ANS(0, i) * m_strainANS_D.row(i + 4);
     }
     strainD_til.row(5) = tempB;  // strainD for yz
 
@@ -558,32 +583,27 @@ void ShellANCF_Force::Evaluate(ChVectorN<double, 54>& result, const double x, co
     ChVectorN<double, 6> DEPS;
     DEPS.setZero();
     for (int ii = 0; ii < 24; ii++) {
-        DEPS(0) += strainD(0, ii) * m_element->m_d_dt(ii);
-        DEPS(1) += strainD(1, ii) * m_element->m_d_dt(ii);
-        DEPS(2) += strainD(2, ii) * m_element->m_d_dt(ii);
-        DEPS(3) += strainD(3, ii) * m_element->m_d_dt(ii);
-        DEPS(4) += strainD(4, ii) * m_element->m_d_dt(ii);
-        DEPS(5) += strainD(5, ii) * m_element->m_d_dt(ii);
+        DEPS(0) += strainD(0, ii) * m_d_dt(ii);
+        DEPS(1) += strainD(1, ii) * m_d_dt(ii);
+        DEPS(2) += strainD(2, ii) * m_d_dt(ii);
+        DEPS(3) += strainD(3, ii) * m_d_dt(ii);
+        DEPS(4) += strainD(4, ii) * m_d_dt(ii);
+        DEPS(5) += strainD(5, ii) * m_d_dt(ii);
     }
 
     // Add structural damping
-    strain += DEPS * m_element->m_Alpha;
+    strain += DEPS * m_Alpha;
 
     // Matrix of elastic coefficients: the input assumes the material *could* be orthotropic
-    const ChMatrixNM<double, 6, 6>& E_eps = m_element->GetLayer(m_kl).GetMaterial()->Get_E_eps();
+    const ChMatrixNM<double, 6, 6>& E_eps = GetLayer(kl).GetMaterial()->Get_E_eps();
 
     // Internal force calculation
-    ChVectorN<double, 24> Fint = (strainD.transpose() * E_eps * strain) * (detJ0 * m_element->m_GaussScaling);
+    Fint += (strainD.transpose() * E_eps * strain) * qp.wdetJ0;
 
     // EAS terms
-    ChMatrixNM<double, 5, 6> temp56 = G.transpose() * E_eps;
-    ChVectorN<double, 5> HE = (temp56 * strain) * (detJ0 * m_element->m_GaussScaling);     // EAS residual
-    ChMatrixNM<double, 5, 5> KALPHA = (temp56 * G) * (detJ0 * m_element->m_GaussScaling);  // EAS Jacobian
-
-    /// Total result vector
-    result.segment(0, 24) = Fint;
-    result.segment(24, 5) = HE;
-    result.segment(29, 5 * 5) = Eigen::Map<ChVectorN<double, 5 * 5>>(KALPHA.data(), 5 * 5);
+    ChMatrixNM<double, 5, 6> temp56 = qp.G.transpose() * E_eps;
+    HE += (temp56 * strain) * qp.wdetJ0;          // EAS residual
+    KALPHA += (temp56 * qp.G) * qp.wdetJ0;        // EAS Jacobian
 }
 
 void ChElementShellANCF_3423::ComputeInternalForces(ChVectorDynamic<>& Fi) {
@@ -596,6 +616,8 @@ void ChElementShellANCF_3423::ComputeInternalForces(ChVectorDynamic<>& Fi) {
 
     Fi.setZero();
 
+    size_t NIP = m_quadCache.size() / m_numLayers;
+
     for (size_t kl = 0; kl < m_numLayers; kl++) {
         ChVectorN<double, 24> Finternal;
         ChVectorN<double, 5> HE;
@@ -606,21 +628,14 @@ void ChElementShellANCF_3423::ComputeInternalForces(ChVectorDynamic<>& Fi) {
 
         // Newton loop for EAS
         for (int count = 0; count < m_maxIterationsEAS; count++) {
-            ShellANCF_Force formula(this, kl, &alphaEAS);
-            ChVectorN<double, 54> result;
-            result.setZero();
-            ChQuadrature::Integrate3D<ChVectorN<double, 54>>(result,                          // result of integration
-                                                             formula,                         // integrand formula
-                                                             -1, 1,                           // x limits
-                                                             -1, 1,                           // y limits
-                                                             m_GaussZ[kl], m_GaussZ[kl + 1],  // z limits
-                                                             2                                // order of integration
-            );
-
-            // Extract vectors and matrices from result of integration
-            Finternal = result.segment(0, 24);
-            HE = result.segment(24, 5);
-            KALPHA = Eigen::Map<ChMatrixNM<double, 5, 5>>(result.segment(29, 5 * 5).data(), 5, 5);
+            // Integrate over the quadrature points of this layer, using the cached
+            // reference-configuration data
+            Finternal.setZero();
+            HE.setZero();
+            KALPHA.setZero();
+            for (size_t ip = 0; ip < NIP; ip++) {
+                EvaluateInternalForceQuadPoint(m_quadCache[kl * NIP + ip], kl, alphaEAS, Finternal, HE, KALPHA);
+            }
 
             // Check convergence (residual check)
             double norm_HE = HE.norm();
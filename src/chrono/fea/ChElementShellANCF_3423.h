@@ -375,6 +375,36 @@ class ChApi ChElementShellANCF_3423 : public ChElementANCF,
     /// stiffness of each element (if any), the mass, etc.
     virtual void SetupInitial(ChSystem* system) override;
 
+    /// Reference-configuration data cached at one Gauss quadrature point of one layer.
+    /// All members depend only on the initial nodal coordinates and the layer setup, so they are computed once in
+    /// SetupInitial and then reused by every internal force evaluation (and by every EAS iteration within it).
+    struct CachedQuadPoint {
+        ShapeVector N;                   ///< shape functions
+        ShapeVector Nx;                  ///< shape function derivatives with respect to x
+        ShapeVector Ny;                  ///< shape function derivatives with respect to y
+        ChMatrixNM<double, 1, 4> S_ANS;  ///< ANS shape functions
+        ChMatrixNM<double, 6, 5> G;      ///< EAS projection matrix T0 * M * (detJ0C / detJ0)
+        ChVectorN<double, 9> beta;       ///< coefficients of the contravariant transformation
+        ChVectorN<double, 8> d0d0Nx;     ///< m_d0d0T * Nx'
+        ChVectorN<double, 8> d0d0Ny;     ///< m_d0d0T * Ny'
+        double wdetJ0;                   ///< combined quadrature weight, including detJ0 and interval scaling
+
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    };
+
+    /// Precompute the reference-configuration quantities used by the internal force evaluation at the Gauss
+    /// quadrature points of each layer (2x2x2 points per layer).
+    void PrecomputeInternalForceQuadData();
+
+    /// Accumulate the internal force integrand contributions of a single cached quadrature point of layer kl,
+    /// for the given EAS parameters, into the force vector Fint, the EAS residual HE, and the EAS Jacobian KALPHA.
+    void EvaluateInternalForceQuadPoint(const CachedQuadPoint& qp,
+                                        size_t kl,
+                                        const ChVectorN<double, 5>& alpha_eas,
+                                        ChVectorN<double, 24>& Fint,
+                                        ChVectorN<double, 5>& HE,
+                                        ChMatrixNM<double, 5, 5>& KALPHA);
+
     //// RADU
     //// Why is m_d_dt inconsistent with m_d?  Why not keep it as an 8x3 matrix?
 
@@ -397,6 +427,8 @@ class ChApi ChElementShellANCF_3423 : public ChElementANCF,
     ChVectorN<double, 24> m_d_dt;                       ///< current nodal velocities
     ChVectorN<double, 8> m_strainANS;                   ///< ANS strain
     ChMatrixNM<double, 8, 24> m_strainANS_D;            ///< ANS strain derivatives
+    std::vector<CachedQuadPoint, Eigen::aligned_allocator<CachedQuadPoint>>
+        m_quadCache;  ///< cached quadrature point data (8 points per layer, layer-major order)
     std::vector<ChVectorN<double, 5>> m_alphaEAS;       ///< EAS parameters (5 per layer)
     std::vector<ChMatrixNM<double, 5, 5>> m_KalphaEAS;  ///< EAS Jacobians (a 5x5 matrix per layer)
     static const double m_toleranceEAS;                 ///< tolerance for nonlinear EAS solver (on residual)
@@ -407,7 +439,6 @@ class ChApi ChElementShellANCF_3423 : public ChElementANCF,
 
     friend class ShellANCF_Mass;
     friend class ShellANCF_Gravity;
-    friend class ShellANCF_Force;
     friend class ShellANCF_Jacobian;
 };
 
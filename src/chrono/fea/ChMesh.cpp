@@ -18,6 +18,8 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <typeindex>
+#include <unordered_map>
 
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChLoad.h"
@@ -45,6 +47,10 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
     automatic_gravity_load = other.automatic_gravity_load;
     num_points_gravity = other.num_points_gravity;
 
+    use_element_coloring = other.use_element_coloring;
+    element_color_groups = other.element_color_groups;
+    element_type_order = other.element_type_order;
+
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
 }
@@ -67,6 +73,72 @@ void ChMesh::SetupInitial() {
         // precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    // If colored parallel assembly is requested, (re)build the element color groups,
+    // now that the element-node connectivity is complete.
+    if (use_element_coloring)
+        ComputeElementColoring();
+    else
+        element_color_groups.clear();
+
+    // Group elements of the same concrete type into contiguous runs for the assembly loops.
+    ComputeElementTypeOrder();
+}
+
+void ChMesh::ComputeElementTypeOrder() {
+    element_type_order.resize(velements.size());
+    for (int ie = 0; ie < (int)velements.size(); ie++)
+        element_type_order[ie] = ie;
+
+    // Stable sort by concrete element type, preserving the original relative order within each type
+    std::stable_sort(element_type_order.begin(), element_type_order.end(), [this](int a, int b) {
+        return std::type_index(typeid(*velements[a])) < std::type_index(typeid(*velements[b]));
+    });
+}
+
+void ChMesh::ComputeElementColoring() {
+    element_color_groups.clear();
+
+    // Map each node referenced by an element to a sequential index and collect,
+    // for each node, the list of elements referencing it.
+    std::unordered_map<ChNodeFEAbase*, int> node_index;
+    node_index.reserve(vnodes.size());
+    std::vector<std::vector<int>> node_elements;
+    node_elements.reserve(vnodes.size());
+
+    for (int ie = 0; ie < (int)velements.size(); ie++) {
+        for (int in = 0; in < velements[ie]->GetNnodes(); in++) {
+            auto ret = node_index.insert({velements[ie]->GetNodeN(in).get(), (int)node_elements.size()});
+            if (ret.second)
+                node_elements.push_back(std::vector<int>());
+            node_elements[ret.first->second].push_back(ie);
+        }
+    }
+
+    // Greedy coloring: assign to each element the smallest color not already used
+    // by another element sharing one of its nodes.
+    std::vector<int> element_color(velements.size(), -1);
+    std::vector<int> color_stamp;  // per-color scratch marker, stamped with the current element index
+
+    for (int ie = 0; ie < (int)velements.size(); ie++) {
+        for (int in = 0; in < velements[ie]->GetNnodes(); in++) {
+            int ni = node_index[velements[ie]->GetNodeN(in).get()];
+            for (int je : node_elements[ni]) {
+                if (element_color[je] >= 0)
+                    color_stamp[element_color[je]] = ie;
+            }
+        }
+        int color = 0;
+        while (color < (int)color_stamp.size() && color_stamp[color] == ie)
+            color++;
+        if (color == (int)color_stamp.size())
+            color_stamp.push_back(-1);
+
+        element_color[ie] = color;
+        if (color == (int)element_color_groups.size())
+            element_color_groups.push_back(std::vector<int>());
+        element_color_groups[color].push_back(ie);
+    }
 }
 
 void ChMesh::Relax() {
@@ -296,22 +368,45 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
 
     int nthreads = GetSystem()->nthreads_chrono;
 
+    bool colored = use_element_coloring && !element_color_groups.empty();
+
     // elements internal forces
     timer_internal_forces.start();
-    //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
+    if (colored) {
+        // colored assembly: elements within one group share no nodes, so each group can be
+        // processed fully in parallel without atomic updates of R
+        for (const auto& group : element_color_groups) {
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+            for (int ig = 0; ig < group.size(); ig++) {
+                velements[group[ig]]->EleIntLoadResidual_F_exclusive(R, c);
+            }
+        }
+    } else {
+        //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
+        // (elements visited in type-grouped order, see ComputeElementTypeOrder)
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+        for (int ie = 0; ie < velements.size(); ie++) {
+            velements[element_type_order[ie]]->EleIntLoadResidual_F(R, c);
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
+        if (colored) {
+            for (const auto& group : element_color_groups) {
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->Get_G_acc(), c);
+                for (int ig = 0; ig < group.size(); ig++) {
+                    velements[group[ig]]->EleIntLoadResidual_F_gravity_exclusive(R, GetSystem()->Get_G_acc(), c);
+                }
+            }
+        } else {
+            //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+            for (int ie = 0; ie < velements.size(); ie++) {
+                velements[element_type_order[ie]]->EleIntLoadResidual_F_gravity(R, GetSystem()->Get_G_acc(), c);
+            }
         }
     }
 
@@ -418,9 +513,10 @@ void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
     int nthreads = GetSystem()->nthreads_chrono;
 
     timer_KRMload.start();
+    // (elements visited in type-grouped order, see ComputeElementTypeOrder)
 #pragma omp parallel for num_threads(nthreads)
     for (int ie = 0; ie < velements.size(); ie++)
-        velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+        velements[element_type_order[ie]]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
     timer_KRMload.stop();
     ncalls_KRMload++;
 }
@@ -57,6 +57,10 @@ class ChApi ChMesh : public ChIndexedNodes {
     int ncalls_internal_forces;
     int ncalls_KRMload;
 
+    bool use_element_coloring;                         ///< use colored (lock-free) parallel element assembly?
+    std::vector<std::vector<int>> element_color_groups;  ///< element groups sharing no nodes, built at initialization
+    std::vector<int> element_type_order;  ///< element indices grouped by concrete element type, built at initialization
+
   public:
     ChMesh()
         : n_dofs(0),
@@ -64,7 +68,8 @@ class ChApi ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          use_element_coloring(false) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -100,6 +105,21 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Override default in ChPhysicsItem.
     virtual bool GetCollide() const override { return true; }
 
+    /// Enable/disable graph-colored parallel assembly of element forces (default: false).
+    /// If enabled, the elements are partitioned at initialization into groups (colors) such that no two elements
+    /// in the same group share a node; each group is then assembled fully in parallel, without atomic updates of
+    /// the residual vector. Recommended for large meshes, where atomic updates limit parallel scaling.
+    void SetUseElementColoring(bool val) { use_element_coloring = val; }
+
+    /// Return the number of element groups (colors) used in colored parallel assembly.
+    int GetNumElementColors() const { return (int)element_color_groups.size(); }
+
+    /// Return the element processing order used by the force and Jacobian assembly loops.
+    /// Elements are grouped by concrete type (see SetupInitial), so that threads sweep runs of homogeneous
+    /// elements with a uniform virtual dispatch target; on meshes mixing element types this improves branch
+    /// prediction and instruction cache behavior. On a single-type mesh this is the identity ordering.
+    const std::vector<int>& GetElementTypeOrder() const { return element_type_order; }
+
     /// Reset counters for internal force and Jacobian evaluations.
     void ResetCounters() {
         ncalls_internal_forces = 0;
@@ -291,6 +311,13 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Partition the elements into groups (colors) such that no two elements in the same group share a node,
+    /// using a greedy coloring of the element-node connectivity graph. Used by colored parallel assembly.
+    void ComputeElementColoring();
+
+    /// Build the element processing order grouping elements of the same concrete type into contiguous runs.
+    void ComputeElementTypeOrder();
+
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
     friend class chrono::modal::ChModalAssembly;
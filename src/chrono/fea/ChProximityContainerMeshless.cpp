@@ -52,6 +52,9 @@ ChProximityContainerMeshless::~ChProximityContainerMeshless() {
 }
 
 void ChProximityContainerMeshless::RemoveAllProximities() {
+    pair_nodeA.clear();
+    pair_nodeB.clear();
+
     std::list<ChProximityMeshless*>::iterator iterproximity = proximitylist.begin();
     while (iterproximity != proximitylist.end()) {
         delete (*iterproximity);
@@ -68,6 +71,11 @@ void ChProximityContainerMeshless::RemoveAllProximities() {
 void ChProximityContainerMeshless::BeginAddProximities() {
     lastproximity = proximitylist.begin();
     n_added = 0;
+
+    // Rewind the flat pair arrays too; clear() keeps the capacity, so in steady state
+    // the refill performed by AddProximity() is allocation-free.
+    pair_nodeA.clear();
+    pair_nodeB.clear();
 }
 
 void ChProximityContainerMeshless::EndAddProximities() {
@@ -93,6 +101,11 @@ void ChProximityContainerMeshless::AddProximity(collision::ChCollisionModel* mod
         this->add_proximity_callback->OnAddProximity(*modA, *modB);
     }
 
+    // Mirror the pair into the flat node arrays (the casts above are done once per pair here,
+    // so the accumulation loops and user material models never need to repeat them).
+    pair_nodeA.push_back(mnA);
+    pair_nodeB.push_back(mnB);
+
     // %%%%%%% Create and add a ChProximityMeshless object
 
     if (lastproximity != proximitylist.end()) {
@@ -137,11 +150,14 @@ static double W_sq_visco(double r, double h) {
 }
 
 void ChProximityContainerMeshless::AccumulateStep1() {
-    // Per-edge data computation
-    std::list<ChProximityMeshless*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        ChNodeMeshless* mnodeA = dynamic_cast<ChNodeMeshless*>((*iterproximity)->GetModelA()->GetContactable());
-        ChNodeMeshless* mnodeB = dynamic_cast<ChNodeMeshless*>((*iterproximity)->GetModelB()->GetContactable());
+    // Per-edge data computation, over the flat pair arrays (no list traversal, no casting).
+    // This sweep accumulates matrix data (Amoment, J) into both endpoints of each edge, so it
+    // is kept sequential: per-element atomics on 3x3 matrices would cost more than the math.
+    int npairs = (int)pair_nodeA.size();
+
+    for (int ip = 0; ip < npairs; ip++) {
+        ChNodeMeshless* mnodeA = pair_nodeA[ip];
+        ChNodeMeshless* mnodeB = pair_nodeB[ip];
 
         ChVector<> x_A = mnodeA->GetPos();
         ChVector<> x_B = mnodeB->GetPos();
@@ -182,17 +198,31 @@ void ChProximityContainerMeshless::AccumulateStep1() {
         mnodeB->J.col(0) -= g_BA.x() * m_inc_AB.eigen();
         mnodeB->J.col(1) -= g_BA.y() * m_inc_AB.eigen();
         mnodeB->J.col(2) -= g_BA.z() * m_inc_AB.eigen();
-
-        ++iterproximity;
     }
 }
 
+// Atomic accumulation of a vector increment into a node force, component by component;
+// used by the parallel per-edge loops where both endpoints of an edge are written.
+static void AtomicVectorAdd(ChVector<>& target, const ChVector<>& inc) {
+#pragma omp atomic
+    target.x() += inc.x();
+#pragma omp atomic
+    target.y() += inc.y();
+#pragma omp atomic
+    target.z() += inc.z();
+}
+
 void ChProximityContainerMeshless::AccumulateStep2() {
-    // Per-edge data computation (transfer stress to forces)
-    std::list<ChProximityMeshless*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        ChNodeMeshless* mnodeA = dynamic_cast<ChNodeMeshless*>((*iterproximity)->GetModelA()->GetContactable());
-        ChNodeMeshless* mnodeB = dynamic_cast<ChNodeMeshless*>((*iterproximity)->GetModelB()->GetContactable());
+    // Per-edge data computation (transfer stress to forces), over the flat pair arrays.
+    // Only the scalar components of UserForce are written here, so the sweep runs in parallel
+    // with atomic accumulation on the shared node forces.
+    int nthreads = GetSystem() ? GetSystem()->GetNumThreadsChrono() : 1;
+    int npairs = (int)pair_nodeA.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < npairs; ip++) {
+        ChNodeMeshless* mnodeA = pair_nodeA[ip];
+        ChNodeMeshless* mnodeB = pair_nodeB[ip];
 
         ChVector<> x_A = mnodeA->GetPos();
         ChVector<> x_B = mnodeB->GetPos();
@@ -207,11 +237,13 @@ void ChProximityContainerMeshless::AccumulateStep2() {
 
         // increment elastoplastic forces of connected nodes
 
-        mnodeA->UserForce += mnodeA->FA * (d_BA * W_BA);
-        mnodeB->UserForce -= mnodeA->FA * (d_BA * W_BA);
+        ChVector<> elastoForceA = mnodeA->FA * (d_BA * W_BA);
+        AtomicVectorAdd(mnodeA->UserForce, elastoForceA);
+        AtomicVectorAdd(mnodeB->UserForce, -elastoForceA);
 
-        mnodeB->UserForce += mnodeB->FA * (d_BA * (-W_AB));
-        mnodeA->UserForce -= mnodeB->FA * (d_BA * (-W_AB));
+        ChVector<> elastoForceB = mnodeB->FA * (d_BA * (-W_AB));
+        AtomicVectorAdd(mnodeB->UserForce, elastoForceB);
+        AtomicVectorAdd(mnodeA->UserForce, -elastoForceB);
 
         // increment viscous forces..
 
@@ -224,10 +256,8 @@ void ChProximityContainerMeshless::AccumulateStep2() {
             0.5 * (mnodeA->GetMatterContainer()->GetViscosity() + mnodeB->GetMatterContainer()->GetViscosity());
 
         ChVector<> viscforceBA = velBA * (mnodeA->volume * avg_viscosity * mnodeB->volume * W_BA_visc);
-        mnodeA->UserForce += viscforceBA;
-        mnodeB->UserForce -= viscforceBA;
-
-        ++iterproximity;
+        AtomicVectorAdd(mnodeA->UserForce, viscforceBA);
+        AtomicVectorAdd(mnodeB->UserForce, -viscforceBA);
     }
 }
 
@@ -16,11 +16,16 @@
 #define CHPROXIMITYCONTAINERMESHLESS_H
 
 #include <list>
+#include <vector>
 
 #include "chrono/physics/ChProximityContainer.h"
 
 namespace chrono {
 
+namespace fea {
+class ChNodeMeshless;
+}
+
 /// @addtogroup chrono_fea
 /// @{
 
@@ -71,6 +76,14 @@ class ChApi ChProximityContainerMeshless : public ChProximityContainer {
     std::list<ChProximityMeshless*>::iterator lastproximity;
     int n_added;
 
+    // Flat structure-of-arrays mirror of the pair list, rebuilt during each broadphase pass.
+    // The meshless nodes are resolved (dynamic_cast) once per pair at AddProximity() time, so
+    // the per-step accumulation loops and custom material models can walk plain indexed arrays
+    // instead of chasing the linked list and re-casting the contactables for every pair.
+    // The vectors keep their capacity across steps, so steady-state refills are allocation-free.
+    std::vector<fea::ChNodeMeshless*> pair_nodeA;
+    std::vector<fea::ChNodeMeshless*> pair_nodeB;
+
   public:
     ChProximityContainerMeshless();
     ChProximityContainerMeshless(const ChProximityContainerMeshless& other);
@@ -106,6 +119,19 @@ class ChApi ChProximityContainerMeshless : public ChProximityContainer {
     /// function of the provided callback object.
     virtual void ReportAllProximities(ReportProximityCallback* mcallback) override;
 
+    /// Access the flat array of first-node pointers, one entry per proximity pair.
+    /// Together with GetPairNodesB() this exposes the neighbor list as indexed
+    /// structure-of-arrays data: custom meshless material models can consume the pairs in plain
+    /// (optionally OpenMP-parallel) loops over [0, GetNproximities()), with no per-pair virtual
+    /// call and no contactable casting. The arrays are valid between EndAddProximities() and the
+    /// next BeginAddProximities(); a parallel consumer is responsible for making its own
+    /// node accumulations race-free (e.g. atomic increments or per-thread buffers).
+    const std::vector<fea::ChNodeMeshless*>& GetPairNodesA() const { return pair_nodeA; }
+
+    /// Access the flat array of second-node pointers, one entry per proximity pair.
+    /// See GetPairNodesA().
+    const std::vector<fea::ChNodeMeshless*>& GetPairNodesB() const { return pair_nodeB; }
+
     // Perform some SPH per-edge initializations and accumulations of values
     // into the connected pairs of particles (summation into particle's  J, Amoment, m_v, UserForce -viscous only- )
     // Will be called by the ChMatterMeshless item.
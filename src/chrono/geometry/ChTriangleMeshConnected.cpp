@@ -20,9 +20,11 @@
 ///      This could be implemented such that the two new faces point to the same material.
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <fstream>
 #include <map>
+#include <unordered_map>
 
 #include "chrono/geometry/ChTriangleMeshConnected.h"
 
@@ -64,6 +66,89 @@ ChTriangleMeshConnected::ChTriangleMeshConnected(const ChTriangleMeshConnected&
     m_filename = source.m_filename;
 }
 
+ChTriangleMeshConnected::ChTriangleMeshConnected(ChTriangleMeshConnected&& source) {
+    m_vertices = std::move(source.m_vertices);
+    m_normals = std::move(source.m_normals);
+    m_UV = std::move(source.m_UV);
+    m_colors = std::move(source.m_colors);
+
+    m_face_v_indices = std::move(source.m_face_v_indices);
+    m_face_n_indices = std::move(source.m_face_n_indices);
+    m_face_uv_indices = std::move(source.m_face_uv_indices);
+    m_face_col_indices = std::move(source.m_face_col_indices);
+    m_face_mat_indices = std::move(source.m_face_mat_indices);
+
+    // steal the properties (ownership of the pointers is transferred)
+    m_properties_per_vertex = std::move(source.m_properties_per_vertex);
+    source.m_properties_per_vertex.clear();
+    m_properties_per_face = std::move(source.m_properties_per_face);
+    source.m_properties_per_face.clear();
+
+    m_filename = std::move(source.m_filename);
+}
+
+ChTriangleMeshConnected& ChTriangleMeshConnected::operator=(const ChTriangleMeshConnected& source) {
+    if (this == &source)
+        return *this;
+
+    m_vertices = source.m_vertices;
+    m_normals = source.m_normals;
+    m_UV = source.m_UV;
+    m_colors = source.m_colors;
+
+    m_face_v_indices = source.m_face_v_indices;
+    m_face_n_indices = source.m_face_n_indices;
+    m_face_uv_indices = source.m_face_uv_indices;
+    m_face_col_indices = source.m_face_col_indices;
+    m_face_mat_indices = source.m_face_mat_indices;
+
+    // deep copies of properties
+    for (ChProperty* id : m_properties_per_vertex)
+        delete (id);
+    m_properties_per_vertex.resize(source.m_properties_per_vertex.size());
+    for (size_t i = 0; i < source.m_properties_per_vertex.size(); ++i)
+        m_properties_per_vertex[i] = source.m_properties_per_vertex[i]->clone();
+    for (ChProperty* id : m_properties_per_face)
+        delete (id);
+    m_properties_per_face.resize(source.m_properties_per_face.size());
+    for (size_t i = 0; i < source.m_properties_per_face.size(); ++i)
+        m_properties_per_face[i] = source.m_properties_per_face[i]->clone();
+
+    m_filename = source.m_filename;
+
+    return *this;
+}
+
+ChTriangleMeshConnected& ChTriangleMeshConnected::operator=(ChTriangleMeshConnected&& source) {
+    if (this == &source)
+        return *this;
+
+    m_vertices = std::move(source.m_vertices);
+    m_normals = std::move(source.m_normals);
+    m_UV = std::move(source.m_UV);
+    m_colors = std::move(source.m_colors);
+
+    m_face_v_indices = std::move(source.m_face_v_indices);
+    m_face_n_indices = std::move(source.m_face_n_indices);
+    m_face_uv_indices = std::move(source.m_face_uv_indices);
+    m_face_col_indices = std::move(source.m_face_col_indices);
+    m_face_mat_indices = std::move(source.m_face_mat_indices);
+
+    // steal the properties (ownership of the pointers is transferred)
+    for (ChProperty* id : m_properties_per_vertex)
+        delete (id);
+    m_properties_per_vertex = std::move(source.m_properties_per_vertex);
+    source.m_properties_per_vertex.clear();
+    for (ChProperty* id : m_properties_per_face)
+        delete (id);
+    m_properties_per_face = std::move(source.m_properties_per_face);
+    source.m_properties_per_face.clear();
+
+    m_filename = std::move(source.m_filename);
+
+    return *this;
+}
+
 ChTriangleMeshConnected::~ChTriangleMeshConnected() {
     for (ChProperty* id : this->m_properties_per_vertex)
         delete (id);
@@ -152,6 +237,14 @@ void ChTriangleMeshConnected::ComputeMassProperties(bool bodyCoords,
     double integral[10] = {(double)0.0, (double)0.0, (double)0.0, (double)0.0, (double)0.0,
                            (double)0.0, (double)0.0, (double)0.0, (double)0.0, (double)0.0};
 
+    // The per-triangle terms are independent; accumulate them in thread-local partial integrals and
+    // reduce at the end.
+#pragma omp parallel
+    {
+        double local[10] = {(double)0.0, (double)0.0, (double)0.0, (double)0.0, (double)0.0,
+                            (double)0.0, (double)0.0, (double)0.0, (double)0.0, (double)0.0};
+
+#pragma omp for nowait
     for (int i = 0; i < this->getNumTriangles(); i++) {
         // Get vertices of triangle i.
         ChVector<double> v0 = this->m_vertices[m_face_v_indices[i].x()];
@@ -199,16 +292,23 @@ void ChTriangleMeshConnected::ComputeMassProperties(bool bodyCoords,
         g2z = f2z + v2.z() * (f1z + v2.z());
 
         // Update integrals.
-        integral[0] += N.x() * f1x;
-        integral[1] += N.x() * f2x;
-        integral[2] += N.y() * f2y;
-        integral[3] += N.z() * f2z;
-        integral[4] += N.x() * f3x;
-        integral[5] += N.y() * f3y;
-        integral[6] += N.z() * f3z;
-        integral[7] += N.x() * (v0.y() * g0x + v1.y() * g1x + v2.y() * g2x);
-        integral[8] += N.y() * (v0.z() * g0y + v1.z() * g1y + v2.z() * g2y);
-        integral[9] += N.z() * (v0.x() * g0z + v1.x() * g1z + v2.x() * g2z);
+        local[0] += N.x() * f1x;
+        local[1] += N.x() * f2x;
+        local[2] += N.y() * f2y;
+        local[3] += N.z() * f2z;
+        local[4] += N.x() * f3x;
+        local[5] += N.y() * f3y;
+        local[6] += N.z() * f3z;
+        local[7] += N.x() * (v0.y() * g0x + v1.y() * g1x + v2.y() * g2x);
+        local[8] += N.y() * (v0.z() * g0y + v1.z() * g1y + v2.z() * g2y);
+        local[9] += N.z() * (v0.x() * g0z + v1.x() * g1z + v2.x() * g2z);
+    }
+
+#pragma omp critical(ChTriangleMeshConnected_mass_props)
+        {
+            for (int k = 0; k < 10; k++)
+                integral[k] += local[k];
+        }
     }
 
     integral[0] *= oneDiv6;
@@ -458,6 +558,30 @@ ChTriangleMeshConnected ChTriangleMeshConnected::Merge(std::vector<ChTriangleMes
     auto& idx_uvs = trimesh.m_face_uv_indices;
     auto& idx_colors = trimesh.m_face_col_indices;
 
+    // Reserve the final buffer sizes upfront, to avoid repeated reallocations and the full copies
+    // they imply on large merged meshes.
+    {
+        size_t n_v = 0, n_n = 0, n_uv = 0, n_c = 0, n_iv = 0, n_in = 0, n_iuv = 0, n_ic = 0;
+        for (const auto& m : meshes) {
+            n_v += m.m_vertices.size();
+            n_n += m.m_normals.size();
+            n_uv += m.m_UV.size();
+            n_c += m.m_colors.size();
+            n_iv += m.m_face_v_indices.size();
+            n_in += m.m_face_n_indices.size();
+            n_iuv += m.m_face_uv_indices.size();
+            n_ic += m.m_face_col_indices.size();
+        }
+        vertices.reserve(n_v);
+        normals.reserve(n_n);
+        uvs.reserve(n_uv);
+        colors.reserve(n_c);
+        idx_vertices.reserve(n_iv);
+        idx_normals.reserve(n_in);
+        idx_uvs.reserve(n_iuv);
+        idx_colors.reserve(n_ic);
+    }
+
     int v_off = 0;
     int n_off = 0;
     int uv_off = 0;
@@ -465,41 +589,30 @@ ChTriangleMeshConnected ChTriangleMeshConnected::Merge(std::vector<ChTriangleMes
     for (auto& m : meshes) {
         {
             vertices.insert(vertices.end(), m.m_vertices.begin(), m.m_vertices.end());
-            std::vector<ChVector<int>> tmp;
-            tmp.reserve(m.m_face_v_indices.size());
-            std::transform(m.m_face_v_indices.begin(), m.m_face_v_indices.end(), std::back_inserter(tmp),
-                           [&v_off](ChVector<int>& a) { return a + v_off; });
-            idx_vertices.insert(idx_vertices.end(), tmp.begin(), tmp.end());
+            auto start = idx_vertices.insert(idx_vertices.end(), m.m_face_v_indices.begin(), m.m_face_v_indices.end());
+            std::for_each(start, idx_vertices.end(), [v_off](ChVector<int>& a) { a = a + v_off; });
             v_off += static_cast<int>(m.m_vertices.size());
         }
 
         {
             normals.insert(normals.end(), m.m_normals.begin(), m.m_normals.end());
-            std::vector<ChVector<int>> tmp;
-            tmp.reserve(m.m_face_n_indices.size());
-            std::transform(m.m_face_n_indices.begin(), m.m_face_n_indices.end(), std::back_inserter(tmp),
-                           [&n_off](ChVector<int>& a) { return a + n_off; });
-            idx_normals.insert(idx_normals.end(), tmp.begin(), tmp.end());
+            auto start = idx_normals.insert(idx_normals.end(), m.m_face_n_indices.begin(), m.m_face_n_indices.end());
+            std::for_each(start, idx_normals.end(), [n_off](ChVector<int>& a) { a = a + n_off; });
             n_off += static_cast<int>(m.m_normals.size());
         }
 
         {
             uvs.insert(uvs.end(), m.m_UV.begin(), m.m_UV.end());
-            std::vector<ChVector<int>> tmp;
-            tmp.reserve(m.m_face_uv_indices.size());
-            std::transform(m.m_face_uv_indices.begin(), m.m_face_uv_indices.end(), std::back_inserter(tmp),
-                           [&uv_off](ChVector<int>& a) { return a + uv_off; });
-            idx_uvs.insert(idx_uvs.end(), tmp.begin(), tmp.end());
+            auto start = idx_uvs.insert(idx_uvs.end(), m.m_face_uv_indices.begin(), m.m_face_uv_indices.end());
+            std::for_each(start, idx_uvs.end(), [uv_off](ChVector<int>& a) { a = a + uv_off; });
             uv_off += static_cast<int>(m.m_UV.size());
         }
 
         {
             colors.insert(colors.end(), m.m_colors.begin(), m.m_colors.end());
-            std::vector<ChVector<int>> tmp;
-            tmp.reserve(m.m_face_col_indices.size());
-            std::transform(m.m_face_col_indices.begin(), m.m_face_col_indices.end(), std::back_inserter(tmp),
-                           [&c_off](ChVector<int>& a) { return a + c_off; });
-            idx_colors.insert(idx_colors.end(), tmp.begin(), tmp.end());
+            auto start =
+                idx_colors.insert(idx_colors.end(), m.m_face_col_indices.begin(), m.m_face_col_indices.end());
+            std::for_each(start, idx_colors.end(), [c_off](ChVector<int>& a) { a = a + c_off; });
             c_off += static_cast<int>(m.m_colors.size());
         }
     }
@@ -508,13 +621,19 @@ ChTriangleMeshConnected ChTriangleMeshConnected::Merge(std::vector<ChTriangleMes
 }
 
 void ChTriangleMeshConnected::Transform(const ChVector<> displ, const ChMatrix33<> rotscale) {
-    for (int i = 0; i < m_vertices.size(); ++i) {
-        m_vertices[i] = rotscale * m_vertices[i];
-        m_vertices[i] += displ;
+    // The vertex and normal buffers are contiguous arrays of 3 doubles each; mapping them as 3xN
+    // matrices lets Eigen process the whole buffers with vectorized kernels.
+    if (!m_vertices.empty()) {
+        Eigen::Map<Eigen::Matrix<double, 3, Eigen::Dynamic>> V(m_vertices.data()->eigen().data(), 3,
+                                                               (Eigen::Index)m_vertices.size());
+        V = (rotscale * V).eval();
+        V.colwise() += displ.eigen();
     }
-    for (int i = 0; i < m_normals.size(); ++i) {
-        m_normals[i] = rotscale * m_normals[i];
-        m_normals[i].Normalize();
+    if (!m_normals.empty()) {
+        Eigen::Map<Eigen::Matrix<double, 3, Eigen::Dynamic>> N(m_normals.data()->eigen().data(), 3,
+                                                               (Eigen::Index)m_normals.size());
+        N = (rotscale * N).eval();
+        N.colwise().normalize();
     }
 }
 
@@ -650,20 +769,45 @@ int ChTriangleMeshConnected::RepairDuplicateVertexes(const double tolerance) {
     std::vector<ChVector<>> processed_verts;
     std::vector<int> new_indexes(m_vertices.size());
 
+    // Bin the already-kept vertexes in a voxel hash grid with cell size equal to the merge distance,
+    // so that each vertex is tested only against the candidates in its 3x3x3 cell neighborhood
+    // (instead of against all kept vertexes, which is quadratic in the mesh size).
+    double cell_size = std::sqrt(tolerance);
+    auto cell_hash = [](int64_t cx, int64_t cy, int64_t cz) {
+        return (size_t)(cx * 73856093 ^ cy * 19349663 ^ cz * 83492791);
+    };
+    std::unordered_map<size_t, std::vector<int>> grid;
+
     // merge vertexes
     for (int i = 0; i < m_vertices.size(); ++i) {
-        bool tomerge = false;
-        for (int j = 0; j < processed_verts.size(); ++j) {
-            if ((m_vertices[i] - processed_verts[j]).Length2() < tolerance) {
-                tomerge = true;
-                ++nmerged;
-                new_indexes[i] = j;
-                break;
+        int64_t cx = (int64_t)std::floor(m_vertices[i].x() / cell_size);
+        int64_t cy = (int64_t)std::floor(m_vertices[i].y() / cell_size);
+        int64_t cz = (int64_t)std::floor(m_vertices[i].z() / cell_size);
+
+        int jmerge = -1;
+        for (int64_t dx = -1; dx <= 1 && jmerge < 0; ++dx) {
+            for (int64_t dy = -1; dy <= 1 && jmerge < 0; ++dy) {
+                for (int64_t dz = -1; dz <= 1 && jmerge < 0; ++dz) {
+                    auto cell = grid.find(cell_hash(cx + dx, cy + dy, cz + dz));
+                    if (cell == grid.end())
+                        continue;
+                    for (int j : cell->second) {
+                        if ((m_vertices[i] - processed_verts[j]).Length2() < tolerance) {
+                            jmerge = j;
+                            break;
+                        }
+                    }
+                }
             }
         }
-        if (!tomerge) {
+
+        if (jmerge >= 0) {
+            ++nmerged;
+            new_indexes[i] = jmerge;
+        } else {
             processed_verts.push_back(m_vertices[i]);
             new_indexes[i] = (int)processed_verts.size() - 1;
+            grid[cell_hash(cx, cy, cz)].push_back(new_indexes[i]);
         }
     }
 
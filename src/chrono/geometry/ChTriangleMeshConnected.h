@@ -39,8 +39,12 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
   public:
     ChTriangleMeshConnected() {}
     ChTriangleMeshConnected(const ChTriangleMeshConnected& source);
+    ChTriangleMeshConnected(ChTriangleMeshConnected&& source);
     ~ChTriangleMeshConnected();
 
+    ChTriangleMeshConnected& operator=(const ChTriangleMeshConnected& source);
+    ChTriangleMeshConnected& operator=(ChTriangleMeshConnected&& source);
+
     /// "Virtual" copy constructor (covariant return type).
     virtual ChTriangleMeshConnected* Clone() const override { return new ChTriangleMeshConnected(*this); }
 
@@ -196,7 +200,7 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     /// tends to produce triangles with bounded angles even if starting from skewed/skinny
     /// triangles in the coarse mesh.
     /// Based on "Multithread parallelization of Lepp-bisection algorithms"
-    ///    M.-C. Rivara et al., Applied Numerical Mathematics 62 (2012) 473�488
+    ///    M.-C. Rivara et al., Applied Numerical Mathematics 62 (2012) 473�488
     /// The auxiliary buffers are used for refinement and assumed to be indexed like the vertex buffer.
     void RefineMeshEdges(
         std::vector<int>& marked_tris,     ///< indexes of triangles to refine (also surrounding triangles might be
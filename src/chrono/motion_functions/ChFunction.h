@@ -16,6 +16,7 @@
 #include "chrono/motion_functions/ChFunction_Const.h"
 #include "chrono/motion_functions/ChFunction_ConstAcc.h"
 #include "chrono/motion_functions/ChFunction_Derive.h"
+#include "chrono/motion_functions/ChFunction_External.h"
 #include "chrono/motion_functions/ChFunction_Fillet3.h"
 #include "chrono/motion_functions/ChFunction_Integrate.h"
 #include "chrono/motion_functions/ChFunction_Matlab.h"
@@ -0,0 +1,36 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono/motion_functions/ChFunction_External.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChFunction_External)
+
+void ChFunction_External::ArchiveOut(ChArchiveOut& marchive) {
+    // version number
+    marchive.VersionWrite<ChFunction_External>();
+    // serialize parent class
+    ChFunction::ArchiveOut(marchive);
+    // the bound pointers are transient by nature and are not serialized
+}
+
+void ChFunction_External::ArchiveIn(ChArchiveIn& marchive) {
+    // version number
+    /*int version =*/marchive.VersionRead<ChFunction_External>();
+    // deserialize parent class
+    ChFunction::ArchiveIn(marchive);
+    // the bound pointers are transient by nature; rebind after deserialization
+}
+
+}  // end namespace chrono
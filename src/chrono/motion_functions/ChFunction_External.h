@@ -0,0 +1,91 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHFUNCT_EXTERNAL_H
+#define CHFUNCT_EXTERNAL_H
+
+#include "chrono/motion_functions/ChFunction_Base.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_functions
+/// @{
+
+/// Function that reads its value (and optionally its derivatives) directly from caller-owned
+/// memory. Every Get_y() dereferences the bound pointer, so the function always reflects the
+/// current content of the external buffer with no per-step SetSetpoint() traffic - unlike
+/// ChFunction_Setpoint, where each new value must be pushed into the function object.
+///
+/// This is intended for tight controller coupling with many actuators: bind each motor function
+/// to one slot of a contiguous setpoint array owned by the controller, and the controller updates
+/// all setpoints by writing that array in a single pass (e.g. one memcpy from a shared-memory or
+/// network buffer), with the motors picking up the new values at the next evaluation.
+///
+/// If no derivative pointers are bound, the derivatives evaluate to zero (ZOH behavior). The
+/// caller-owned memory must outlive the function object; the bound pointers are shared (not
+/// copied) by Clone() and are not serialized.
+class ChApi ChFunction_External : public ChFunction {
+  private:
+    const double* y_ptr;
+    const double* y_dx_ptr;
+    const double* y_dxdx_ptr;
+
+  public:
+    ChFunction_External() : y_ptr(nullptr), y_dx_ptr(nullptr), y_dxdx_ptr(nullptr) {}
+
+    ChFunction_External(const double* value_ptr, const double* der_ptr = nullptr, const double* der2_ptr = nullptr)
+        : y_ptr(value_ptr), y_dx_ptr(der_ptr), y_dxdx_ptr(der2_ptr) {}
+
+    ChFunction_External(const ChFunction_External& other)
+        : y_ptr(other.y_ptr), y_dx_ptr(other.y_dx_ptr), y_dxdx_ptr(other.y_dxdx_ptr) {}
+
+    virtual ~ChFunction_External() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChFunction_External* Clone() const override { return new ChFunction_External(*this); }
+
+    virtual double Get_y(double x) const override { return y_ptr ? *y_ptr : 0; }
+    virtual double Get_y_dx(double x) const override { return y_dx_ptr ? *y_dx_ptr : 0; }
+    virtual double Get_y_dxdx(double x) const override { return y_dxdx_ptr ? *y_dxdx_ptr : 0; }
+
+    /// Bind the caller-owned memory locations read by this function.
+    /// Derivative pointers may be null, in which case the derivatives evaluate to zero.
+    void BindValue(const double* value_ptr, const double* der_ptr = nullptr, const double* der2_ptr = nullptr) {
+        y_ptr = value_ptr;
+        y_dx_ptr = der_ptr;
+        y_dxdx_ptr = der2_ptr;
+    }
+
+    /// Unbind the external memory; the function evaluates to zero afterwards.
+    void Unbind() {
+        y_ptr = nullptr;
+        y_dx_ptr = nullptr;
+        y_dxdx_ptr = nullptr;
+    }
+
+    /// Return true if a value pointer is currently bound.
+    bool IsBound() const { return y_ptr != nullptr; }
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& marchive) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& marchive) override;
+};
+
+/// @} chrono_functions
+
+CH_CLASS_VERSION(ChFunction_External, 0)
+
+}  // end namespace chrono
+
+#endif
@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -41,6 +42,7 @@ void ChFunction_Recorder::Estimate_x_range(double& xmin, double& xmax) const {
 }
 
 void ChFunction_Recorder::AddPoint(double mx, double my, double mw) {
+    m_table_dirty = true;
     for (auto iter = m_points.rbegin(); iter != m_points.rend(); ++iter) {
         double dist = mx - iter->x;
         if (std::abs(dist) < std::numeric_limits<double>::epsilon()) {
@@ -61,6 +63,12 @@ void ChFunction_Recorder::AddPoint(double mx, double my, double mw) {
     m_points.push_front(ChRecPoint(mx, my, mw));
 }
 
+void ChFunction_Recorder::CompactTable() const {
+    m_table.assign(m_points.begin(), m_points.end());
+    m_cursor = 0;
+    m_table_dirty = false;
+}
+
 double Interpolate_y(double x, const ChRecPoint& p1, const ChRecPoint& p2) {
     return ((x - p1.x) * p2.y + (p2.x - x) * p1.y) / (p2.x - p1.x);
 }
@@ -106,6 +114,94 @@ double ChFunction_Recorder::Get_y(double x) const {
     return 0;
 }
 
+double ChFunction_Recorder::Get_y_sorted(double x) const {
+    if (m_table_dirty) {
+        CompactTable();
+    }
+
+    const size_t n = m_table.size();
+
+    if (n == 0) {
+        return 0;
+    }
+
+    if (x <= m_table.front().x) {
+        return m_table.front().y;
+    }
+
+    if (x >= m_table.back().x) {
+        return m_table.back().y;
+    }
+
+    // At this point we are guaranteed that there are at least two records.
+
+    if (x < m_table[m_cursor].x) {
+        // Query behind the cursor: locate the segment with a binary search.
+        auto iter = std::lower_bound(m_table.begin(), m_table.begin() + m_cursor, x,
+                                     [](const ChRecPoint& rec, double val) { return rec.x < val; });
+        m_cursor = iter - m_table.begin() - 1;
+    }
+
+    // Advance the cursor to the segment containing x (one step, in the common case).
+    while (x > m_table[m_cursor + 1].x) {
+        m_cursor++;
+    }
+
+    return Interpolate_y(x, m_table[m_cursor], m_table[m_cursor + 1]);
+}
+
+void ChFunction_Recorder::Evaluate(const std::vector<const ChFunction_Recorder*>& functions,
+                                   double x,
+                                   std::vector<double>& y) {
+    const size_t n = functions.size();
+    y.resize(n);
+
+    std::vector<double> x0(n), x1(n), y0(n), y1(n);
+
+    // Advance the per-function cursors and gather the bracketing segment endpoints.
+    // Empty and out-of-range tables are encoded as a degenerate segment centered on x,
+    // so that the interpolation below returns the clamped value without branching.
+    for (size_t i = 0; i < n; i++) {
+        const ChFunction_Recorder* fun = functions[i];
+
+        if (fun->m_table_dirty) {
+            fun->CompactTable();
+        }
+
+        const std::vector<ChRecPoint>& table = fun->m_table;
+        const size_t np = table.size();
+
+        if (np == 0 || x <= table.front().x || x >= table.back().x) {
+            double val = (np == 0) ? 0 : (x <= table.front().x ? table.front().y : table.back().y);
+            x0[i] = x - 1;
+            x1[i] = x + 1;
+            y0[i] = val;
+            y1[i] = val;
+            continue;
+        }
+
+        if (x < table[fun->m_cursor].x) {
+            auto iter = std::lower_bound(table.begin(), table.begin() + fun->m_cursor, x,
+                                         [](const ChRecPoint& rec, double val) { return rec.x < val; });
+            fun->m_cursor = iter - table.begin() - 1;
+        }
+
+        while (x > table[fun->m_cursor + 1].x) {
+            fun->m_cursor++;
+        }
+
+        x0[i] = table[fun->m_cursor].x;
+        x1[i] = table[fun->m_cursor + 1].x;
+        y0[i] = table[fun->m_cursor].y;
+        y1[i] = table[fun->m_cursor + 1].y;
+    }
+
+    // Interpolate all functions in one pass over contiguous arrays (vectorizable).
+    for (size_t i = 0; i < n; i++) {
+        y[i] = ((x - x0[i]) * y1[i] + (x1[i] - x) * y0[i]) / (x1[i] - x0[i]);
+    }
+}
+
 double ChFunction_Recorder::Get_y_dx(double x) const {
     //// TODO:  can we do better?
     return ChFunction::Get_y_dx(x);
@@ -136,6 +232,7 @@ void ChFunction_Recorder::ArchiveIn(ChArchiveIn& marchive) {
     marchive >> CHNVP(tmpvect);
     m_points.clear();
     std::copy(tmpvect.begin(), tmpvect.end(), std::back_inserter(m_points));
+    m_table_dirty = true;
 }
 
 }  // end namespace chrono
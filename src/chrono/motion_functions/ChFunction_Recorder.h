@@ -17,6 +17,7 @@
 
 #include <iterator>
 #include <list>
+#include <vector>
 
 #include "chrono/motion_functions/ChFunction_Base.h"
 
@@ -56,6 +57,13 @@ class ChApi ChFunction_Recorder : public ChFunction {
     std::list<ChRecPoint> m_points;  ///< the list of points
     mutable std::list<ChRecPoint>::const_iterator m_last;
 
+    mutable std::vector<ChRecPoint> m_table;  ///< contiguous snapshot of the points, for sorted evaluation
+    mutable size_t m_cursor = 0;              ///< index of the segment hit by the last sorted query
+    mutable bool m_table_dirty = true;        ///< snapshot must be rebuilt before the next sorted query
+
+    /// Rebuild the contiguous snapshot of the point list and reset the cursor.
+    void CompactTable() const;
+
   public:
     ChFunction_Recorder() : m_last(m_points.end()) {}
     ChFunction_Recorder(const ChFunction_Recorder& other);
@@ -70,15 +78,33 @@ class ChApi ChFunction_Recorder : public ChFunction {
     virtual double Get_y_dx(double x) const override;
     virtual double Get_y_dxdx(double x) const override;
 
+    /// Evaluate the function at \a x, assuming that successive queries arrive with non-decreasing
+    /// abscissas (e.g. simulation time). A cached cursor into a contiguous copy of the table makes
+    /// each lookup O(1) amortized; a query behind the cursor falls back to a binary search.
+    /// Results are identical to Get_y().
+    double Get_y_sorted(double x) const;
+
+    /// Evaluate a bank of recorder functions at the same abscissa \a x, writing one value per
+    /// function into \a y (resized as needed). Each function advances its own sorted-query cursor
+    /// (see Get_y_sorted); the segment endpoints are gathered into contiguous scratch arrays so
+    /// that the interpolation itself runs as a single vectorizable loop over all functions.
+    static void Evaluate(const std::vector<const ChFunction_Recorder*>& functions,
+                         double x,
+                         std::vector<double>& y);
+
     void AddPoint(double mx, double my, double mw = 1);
 
     void Reset() {
         m_points.clear();
         m_last = m_points.end();
+        m_table_dirty = true;
     }
 
     const std::list<ChRecPoint>& GetPoints() const { return m_points; }
-    std::list<ChRecPoint>& GetPoints() { return m_points; }
+    std::list<ChRecPoint>& GetPoints() {
+        m_table_dirty = true;  // the caller may modify the points
+        return m_points;
+    }
 
     virtual void Estimate_x_range(double& xmin, double& xmax) const override;
 
@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <cmath>
+
 #include "chrono/motion_functions/ChFunction_Sine.h"
 
 namespace chrono {
@@ -38,6 +40,24 @@ double ChFunction_Sine::Get_y_dxdx(double x) const {
     return amp * -w * w * (sin(phase + w * x));
 }
 
+void ChFunction_Sine::Evaluate(const std::vector<const ChFunction_Sine*>& functions, double x, std::vector<double>& y) {
+    const size_t n = functions.size();
+    y.resize(n);
+
+    std::vector<double> amps(n), args(n);
+
+    // Gather the parameters into contiguous arrays.
+    for (size_t i = 0; i < n; i++) {
+        amps[i] = functions[i]->amp;
+        args[i] = functions[i]->phase + functions[i]->w * x;
+    }
+
+    // Evaluate all functions in one pass (vectorizable with a vector math library).
+    for (size_t i = 0; i < n; i++) {
+        y[i] = amps[i] * std::sin(args[i]);
+    }
+}
+
 void ChFunction_Sine::ArchiveOut(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChFunction_Sine>();
@@ -15,6 +15,8 @@
 #ifndef CHFUNCT_SINE_H
 #define CHFUNCT_SINE_H
 
+#include <vector>
+
 #include "chrono/motion_functions/ChFunction_Base.h"
 
 namespace chrono {
@@ -47,6 +49,12 @@ class ChApi ChFunction_Sine : public ChFunction {
     virtual double Get_y_dx(double x) const override;
     virtual double Get_y_dxdx(double x) const override;
 
+    /// Evaluate a bank of sine functions at the same abscissa \a x, writing one value per function
+    /// into \a y (resized as needed). The amplitudes, phases, and pulsations are gathered into
+    /// contiguous arrays so that the evaluation runs as a single vectorizable loop over all
+    /// functions.
+    static void Evaluate(const std::vector<const ChFunction_Sine*>& functions, double x, std::vector<double>& y);
+
     void Set_phase(double m_phase) { phase = m_phase; };
     void Set_freq(double m_freq) {
         freq = m_freq;
@@ -14,6 +14,8 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <typeinfo>
+#include <unordered_set>
 
 #include "chrono/core/ChGlobal.h"
 #include "chrono/core/ChTransform.h"
@@ -47,7 +49,16 @@ ChAssembly::ChAssembly()
       nsysvars_w(0),
       ndof(0),
       ndoc_w_C(0),
-      ndoc_w_D(0)
+      ndoc_w_D(0),
+      use_body_soa(false),
+      use_lazy_update(false),
+      body_soa_valid(false),
+      topology_version(1),
+      setup_version(0),
+      setup_offset_x(0),
+      setup_offset_w(0),
+      setup_offset_L(0),
+      raw_lists_version(0)
        {}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
@@ -70,6 +81,17 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     nsysvars = other.nsysvars;
     nsysvars_w = other.nsysvars_w;
 
+    use_body_soa = other.use_body_soa;
+    use_lazy_update = other.use_lazy_update;
+    body_soa_valid = false;
+
+    topology_version = 1;
+    setup_version = 0;
+    setup_offset_x = 0;
+    setup_offset_w = 0;
+    setup_offset_L = 0;
+    raw_lists_version = 0;
+
     //// RADU
     //// TODO:  deep copy of the object lists (bodylist, shaftlist, linklist, meshlist,  otherphysicslist)
 }
@@ -146,6 +168,7 @@ void ChAssembly::Clear() {
 // Note: removing items from the assembly incurs linear time cost
 
 void ChAssembly::AddBody(std::shared_ptr<ChBody> body) {
+    topology_version++;
     assert(std::find(std::begin(bodylist), std::end(bodylist), body) == bodylist.end());
     assert(body->GetSystem() == nullptr);  // should remove from other system before adding here
 
@@ -158,6 +181,7 @@ void ChAssembly::AddBody(std::shared_ptr<ChBody> body) {
 }
 
 void ChAssembly::RemoveBody(std::shared_ptr<ChBody> body) {
+    topology_version++;
     auto itr = std::find(std::begin(bodylist), std::end(bodylist), body);
     assert(itr != bodylist.end());
 
@@ -167,7 +191,45 @@ void ChAssembly::RemoveBody(std::shared_ptr<ChBody> body) {
     system->is_updated = false;
 }
 
+void ChAssembly::AddBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    topology_version++;
+    bodylist.reserve(bodylist.size() + bodies.size());
+    for (const auto& body : bodies) {
+        assert(std::find(std::begin(bodylist), std::end(bodylist), body) == bodylist.end());
+        assert(body->GetSystem() == nullptr);  // should remove from other system before adding here
+
+        // set system and also add collision models to system
+        body->SetSystem(system);
+        bodylist.push_back(body);
+    }
+
+    system->is_updated = false;
+}
+
+void ChAssembly::RemoveBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    topology_version++;
+    // Mark-and-sweep: flag the bodies to be removed, then compact the list in a single pass.
+    std::unordered_set<ChBody*> marked;
+    marked.reserve(bodies.size());
+    for (const auto& body : bodies) {
+        assert(std::find(std::begin(bodylist), std::end(bodylist), body) != bodylist.end());
+        marked.insert(body.get());
+    }
+
+    bodylist.erase(std::remove_if(std::begin(bodylist), std::end(bodylist),
+                                  [&marked](const std::shared_ptr<ChBody>& body) {
+                                      if (marked.find(body.get()) == marked.end())
+                                          return false;
+                                      body->SetSystem(nullptr);
+                                      return true;
+                                  }),
+                   std::end(bodylist));
+
+    system->is_updated = false;
+}
+
 void ChAssembly::AddShaft(std::shared_ptr<ChShaft> shaft) {
+    topology_version++;
     assert(std::find(std::begin(shaftlist), std::end(shaftlist), shaft) == shaftlist.end());
     assert(shaft->GetSystem() == nullptr);  // should remove from other system before adding here
 
@@ -179,6 +241,7 @@ void ChAssembly::AddShaft(std::shared_ptr<ChShaft> shaft) {
 }
 
 void ChAssembly::RemoveShaft(std::shared_ptr<ChShaft> shaft) {
+    topology_version++;
     auto itr = std::find(std::begin(shaftlist), std::end(shaftlist), shaft);
     assert(itr != shaftlist.end());
 
@@ -189,6 +252,7 @@ void ChAssembly::RemoveShaft(std::shared_ptr<ChShaft> shaft) {
 }
 
 void ChAssembly::AddLink(std::shared_ptr<ChLinkBase> link) {
+    topology_version++;
     assert(std::find(std::begin(linklist), std::end(linklist), link) == linklist.end());
 
     link->SetSystem(system);
@@ -199,6 +263,7 @@ void ChAssembly::AddLink(std::shared_ptr<ChLinkBase> link) {
 }
 
 void ChAssembly::RemoveLink(std::shared_ptr<ChLinkBase> link) {
+    topology_version++;
     auto itr = std::find(std::begin(linklist), std::end(linklist), link);
     assert(itr != linklist.end());
 
@@ -209,6 +274,7 @@ void ChAssembly::RemoveLink(std::shared_ptr<ChLinkBase> link) {
 }
 
 void ChAssembly::AddMesh(std::shared_ptr<fea::ChMesh> mesh) {
+    topology_version++;
     assert(std::find(std::begin(meshlist), std::end(meshlist), mesh) == meshlist.end());
 
     mesh->SetSystem(system);
@@ -219,6 +285,7 @@ void ChAssembly::AddMesh(std::shared_ptr<fea::ChMesh> mesh) {
 }
 
 void ChAssembly::RemoveMesh(std::shared_ptr<fea::ChMesh> mesh) {
+    topology_version++;
     auto itr = std::find(std::begin(meshlist), std::end(meshlist), mesh);
     assert(itr != meshlist.end());
 
@@ -229,6 +296,7 @@ void ChAssembly::RemoveMesh(std::shared_ptr<fea::ChMesh> mesh) {
 }
 
 void ChAssembly::AddOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
+    topology_version++;
     assert(!std::dynamic_pointer_cast<ChBody>(item));
     assert(!std::dynamic_pointer_cast<ChLinkBase>(item));
     assert(!std::dynamic_pointer_cast<ChMesh>(item));
@@ -244,6 +312,7 @@ void ChAssembly::AddOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
 }
 
 void ChAssembly::RemoveOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
+    topology_version++;
     auto itr = std::find(std::begin(otherphysicslist), std::end(otherphysicslist), item);
     assert(itr != otherphysicslist.end());
 
@@ -316,6 +385,7 @@ void ChAssembly::Remove(std::shared_ptr<ChPhysicsItem> item) {
 }
 
 void ChAssembly::RemoveAllBodies() {
+    topology_version++;
     for (auto& body : bodylist) {
         body->SetSystem(nullptr);
     }
@@ -326,6 +396,7 @@ void ChAssembly::RemoveAllBodies() {
 }
 
 void ChAssembly::RemoveAllShafts() {
+    topology_version++;
     for (auto& shaft : shaftlist) {
         shaft->SetSystem(nullptr);
     }
@@ -336,6 +407,7 @@ void ChAssembly::RemoveAllShafts() {
 }
 
 void ChAssembly::RemoveAllLinks() {
+    topology_version++;
     for (auto& link : linklist) {
         link->SetSystem(nullptr);
     }
@@ -346,6 +418,7 @@ void ChAssembly::RemoveAllLinks() {
 }
 
 void ChAssembly::RemoveAllMeshes() {
+    topology_version++;
     for (auto& mesh : meshlist) {
         mesh->SetSystem(nullptr);
     }
@@ -356,6 +429,7 @@ void ChAssembly::RemoveAllMeshes() {
 }
 
 void ChAssembly::RemoveAllOtherPhysicsItems() {
+    topology_version++;
     for (auto& item : otherphysicslist) {
         item->SetSystem(nullptr);
     }
@@ -480,6 +554,17 @@ void ChAssembly::SyncCollisionModels() {
     }
 }
 
+void ChAssembly::SetCollisionFamily(int family) {
+    for (auto& body : bodylist) {
+        if (body->GetCollisionModel())
+            body->GetCollisionModel()->SetFamily(family);
+    }
+    for (auto& item : otherphysicslist) {
+        if (auto assembly = std::dynamic_pointer_cast<ChAssembly>(item))
+            assembly->SetCollisionFamily(family);
+    }
+}
+
 // -----------------------------------------------------------------------------
 // UPDATING ROUTINES
 
@@ -501,9 +586,129 @@ void ChAssembly::SetupInitial() {
     }
 }
 
+// Attempt the fixed-topology fast path of Setup(): verify that no contained item changed its
+// activity state or its numbers of unknowns and constraints since the last full counting pass,
+// while dispatching the per-item Setup hooks. Bodies and shafts have no-op hooks and fixed
+// counts, so only their activity is checked. The hooks of links and meshes are idempotent
+// recomputations of counts and child offsets and may safely run again should the counting pass
+// turn out to be needed; the hooks of the other physics items may instead perform once-per-step
+// work, so their activity is checked for all items before any of them is dispatched.
+bool ChAssembly::SetupFastPath(bool& item_hooks_dispatched) {
+    item_hooks_dispatched = false;
+
+    size_t num_items =
+        bodylist.size() + shaftlist.size() + linklist.size() + meshlist.size() + otherphysicslist.size();
+    if (setup_counts.size() != num_items)
+        return false;
+
+    size_t k = 0;
+
+    for (const auto& body : bodylist) {
+        int state = body->GetBodyFixed() ? 0 : (body->GetSleeping() ? 1 : 2);
+        if (state != setup_counts[k++][0])
+            return false;
+    }
+    for (const auto& shaft : shaftlist) {
+        int state = shaft->GetShaftFixed() ? 0 : (shaft->GetSleeping() ? 1 : 2);
+        if (state != setup_counts[k++][0])
+            return false;
+    }
+
+    for (const auto& link : linklist) {
+        const auto& c = setup_counts[k++];
+        int active = link->IsActive() ? 1 : 0;
+        if (active != c[0])
+            return false;
+        if (active) {
+            link->Setup();
+            if (link->GetDOF() != c[1] || link->GetDOF_w() != c[2] || link->GetDOC() != c[3] ||
+                link->GetDOC_c() != c[4] || link->GetDOC_d() != c[5])
+                return false;
+        }
+    }
+    for (const auto& mesh : meshlist) {
+        const auto& c = setup_counts[k++];
+        mesh->Setup();
+        if (mesh->GetDOF() != c[1] || mesh->GetDOF_w() != c[2] || mesh->GetDOC() != c[3] ||
+            mesh->GetDOC_c() != c[4] || mesh->GetDOC_d() != c[5])
+            return false;
+    }
+
+    size_t k_items = k;
+    for (const auto& item : otherphysicslist) {
+        if ((item->IsActive() ? 1 : 0) != setup_counts[k++][0])
+            return false;
+    }
+    item_hooks_dispatched = true;
+    k = k_items;
+    for (const auto& item : otherphysicslist) {
+        const auto& c = setup_counts[k++];
+        if (!c[0])
+            continue;
+        item->Setup();
+        if (item->GetDOF() != c[1] || item->GetDOF_w() != c[2] || item->GetDOC() != c[3] ||
+            item->GetDOC_c() != c[4] || item->GetDOC_d() != c[5])
+            return false;
+    }
+
+    return true;
+}
+
+// Refresh the raw-pointer mirrors of the item lists, if the set of contained items changed.
+// The size checks also catch list manipulation that bypasses the Add/Remove functions (and thus
+// the topology version), as done by some derived system classes.
+void ChAssembly::EnsureRawLists() {
+    if (raw_lists_version == topology_version &&                                        //
+        bodylist_raw.size() == bodylist.size() && shaftlist_raw.size() == shaftlist.size() &&
+        linklist_raw.size() == linklist.size() && meshlist_raw.size() == meshlist.size() &&
+        otherphysicslist_raw.size() == otherphysicslist.size())
+        return;
+
+    bodylist_raw.clear();
+    bodylist_raw.reserve(bodylist.size());
+    for (const auto& body : bodylist)
+        bodylist_raw.push_back(body.get());
+
+    shaftlist_raw.clear();
+    shaftlist_raw.reserve(shaftlist.size());
+    for (const auto& shaft : shaftlist)
+        shaftlist_raw.push_back(shaft.get());
+
+    linklist_raw.clear();
+    linklist_raw.reserve(linklist.size());
+    for (const auto& link : linklist)
+        linklist_raw.push_back(link.get());
+
+    meshlist_raw.clear();
+    meshlist_raw.reserve(meshlist.size());
+    for (const auto& mesh : meshlist)
+        meshlist_raw.push_back(mesh.get());
+
+    otherphysicslist_raw.clear();
+    otherphysicslist_raw.reserve(otherphysicslist.size());
+    for (const auto& item : otherphysicslist)
+        otherphysicslist_raw.push_back(item.get());
+
+    raw_lists_version = topology_version;
+}
+
 // Count all bodies, links, meshes, and other physics items.
 // Set counters (DOF, num constraints, etc) and offsets.
 void ChAssembly::Setup() {
+    // Add any items queued for insertion in the assembly's lists.
+    this->FlushBatch();
+
+    // Fixed-topology fast path: if no item was added or removed since the last full counting pass,
+    // the assembly offsets are unchanged, and no item changed its activity state or its numbers of
+    // unknowns and constraints, then all counters and item offsets are still valid and the counting
+    // pass below is skipped. The per-item Setup hooks are still dispatched, since several items use
+    // them to perform work at the beginning of a step.
+    bool item_hooks_dispatched = false;
+    if (setup_version == topology_version && offset_x == setup_offset_x && offset_w == setup_offset_w &&
+        offset_L == setup_offset_L && SetupFastPath(item_hooks_dispatched)) {
+        return;
+    }
+
     nbodies = 0;
     nbodies_sleep = 0;
     nbodies_fixed = 0;
@@ -520,9 +725,6 @@ void ChAssembly::Setup() {
     nmeshes = 0;
     nphysicsitems = 0;
 
-    // Add any items queued for insertion in the assembly's lists.
-    this->FlushBatch();
-
     for (auto& body : bodylist) {
         if (body->GetBodyFixed())
             nbodies_fixed++;
@@ -605,11 +807,18 @@ void ChAssembly::Setup() {
         if (item->IsActive()) {
             nphysicsitems++;
 
+            bool offsets_changed = item->GetOffset_x() != this->offset_x + ncoords ||
+                                   item->GetOffset_w() != this->offset_w + ncoords_w ||
+                                   item->GetOffset_L() != this->offset_L + ndoc_w;
+
             item->SetOffset_x(this->offset_x + ncoords);
             item->SetOffset_w(this->offset_w + ncoords_w);
             item->SetOffset_L(this->offset_L + ndoc_w);
 
-            item->Setup();
+            // Skip the hook if it already ran in an aborted fast-path attempt, unless the item
+            // offsets changed under it (the hook may have propagated them to child objects)
+            if (!item_hooks_dispatched || offsets_changed)
+                item->Setup();
 
             ncoords += item->GetDOF();
             ncoords_w += item->GetDOF_w();
@@ -625,6 +834,85 @@ void ChAssembly::Setup() {
 
     // number of degrees of freedom (approximate - does not consider constr. redundancy, etc)
     ndof = ncoords_w - ndoc_w;
+
+    // Record the configuration seen by this counting pass, for the fast path of subsequent calls.
+    setup_offset_x = offset_x;
+    setup_offset_w = offset_w;
+    setup_offset_L = offset_L;
+    setup_counts.clear();
+    setup_counts.reserve(bodylist.size() + shaftlist.size() + linklist.size() + meshlist.size() +
+                         otherphysicslist.size());
+    for (const auto& body : bodylist) {
+        int state = body->GetBodyFixed() ? 0 : (body->GetSleeping() ? 1 : 2);
+        setup_counts.push_back({{state, 0, 0, 0, 0, 0}});
+    }
+    for (const auto& shaft : shaftlist) {
+        int state = shaft->GetShaftFixed() ? 0 : (shaft->GetSleeping() ? 1 : 2);
+        setup_counts.push_back({{state, 0, 0, 0, 0, 0}});
+    }
+    for (const auto& link : linklist) {
+        setup_counts.push_back({{link->IsActive() ? 1 : 0, link->GetDOF(), link->GetDOF_w(), link->GetDOC(),
+                                 link->GetDOC_c(), link->GetDOC_d()}});
+    }
+    for (const auto& mesh : meshlist) {
+        setup_counts.push_back(
+            {{1, mesh->GetDOF(), mesh->GetDOF_w(), mesh->GetDOC(), mesh->GetDOC_c(), mesh->GetDOC_d()}});
+    }
+    for (const auto& item : otherphysicslist) {
+        setup_counts.push_back({{item->IsActive() ? 1 : 0, item->GetDOF(), item->GetDOF_w(), item->GetDOC(),
+                                 item->GetDOC_c(), item->GetDOC_d()}});
+    }
+    setup_version = topology_version;
+
+    // Rebuild the SoA state store, if enabled (offsets and active sets may have changed).
+    if (use_body_soa)
+        RebuildBodySoA();
+}
+
+void ChAssembly::EnableBodySoAStorage(bool val) {
+    use_body_soa = val;
+    body_soa_valid = false;
+    if (!val) {
+        for (auto body : body_soa.bodies)
+            body->body_soa_index = -1;
+        body_soa.clear();
+    }
+}
+
+void ChAssembly::RebuildBodySoA() {
+    for (auto body : body_soa.bodies)
+        body->body_soa_index = -1;
+    body_soa.clear();
+
+    // Mirror only active bodies of exact type ChBody, so that the packed state copies exactly
+    // replicate ChBody::IntStateGather / IntStateScatter; derived types (e.g. ChBodyAuxRef)
+    // keep using their own virtual state functions.
+    for (auto& body : bodylist) {
+        if (body->IsActive() && typeid(*body.get()) == typeid(ChBody)) {
+            body->body_soa_index = (int)body_soa.bodies.size();
+            body_soa.bodies.push_back(body.get());
+            body_soa.off_x.push_back(body->GetOffset_x() - this->offset_x);
+            body_soa.off_w.push_back(body->GetOffset_w() - this->offset_w);
+        }
+    }
+
+    auto n = (Eigen::Index)body_soa.size();
+    body_soa.pos.resize(3 * n);
+    body_soa.rot.resize(4 * n);
+    body_soa.pos_dt.resize(3 * n);
+    body_soa.wvel.resize(3 * n);
+
+    body_soa_valid = true;
+}
+
+void ChAssembly::SyncBodySoAFromBodies() {
+    for (size_t i = 0; i < body_soa.size(); i++) {
+        const ChBody* body = body_soa.bodies[i];
+        body_soa.pos.segment(3 * i, 3) = body->GetPos().eigen();
+        body_soa.rot.segment(4 * i, 4) = body->GetRot().eigen();
+        body_soa.pos_dt.segment(3 * i, 3) = body->GetPos_dt().eigen();
+        body_soa.wvel.segment(3 * i, 3) = body->GetWvel_loc().eigen();
+    }
 }
 
 // Update assembly's own properties first (ChTime and assets, if any).
@@ -638,21 +926,36 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
-    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
-        bodylist[ip]->Update(ChTime, update_assets);
+    int nthreads = GetSystem() ? GetSystem()->GetNumThreadsChrono() : 1;
+
+    EnsureRawLists();
+
+    // Bodies update only their own state, markers, and forces; links update only their own
+    // internal data, reading the (already updated) states of their connected bodies. These
+    // sweeps are therefore distributed over the OpenMP worker pool (which persists between
+    // parallel regions), as already done in Chrono::Multicore. Shafts and other physics items
+    // are updated serially: the former are too cheap to be worth a barrier, the latter may be
+    // arbitrary user items with no thread-safety guarantees. Meshes parallelize internally.
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+    for (int ip = 0; ip < (int)bodylist_raw.size(); ++ip) {
+        if (use_lazy_update && bodylist_raw[ip]->CanSkipUpdate())
+            continue;
+        bodylist_raw[ip]->Update(ChTime, update_assets);
     }
-    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
-        shaftlist[ip]->Update(ChTime, update_assets);
+    for (int ip = 0; ip < (int)shaftlist_raw.size(); ++ip) {
+        shaftlist_raw[ip]->Update(ChTime, update_assets);
     }
-    for (int ip = 0; ip < (int)otherphysicslist.size(); ++ip) {
-        otherphysicslist[ip]->Update(ChTime, update_assets);
+    for (int ip = 0; ip < (int)otherphysicslist_raw.size(); ++ip) {
+        if (use_lazy_update && otherphysicslist_raw[ip]->CanSkipUpdate())
+            continue;
+        otherphysicslist_raw[ip]->Update(ChTime, update_assets);
     }
-    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
-        linklist[ip]->Update(ChTime, update_assets);
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+    for (int ip = 0; ip < (int)linklist_raw.size(); ++ip) {
+        linklist_raw[ip]->Update(ChTime, update_assets);
     }
-    for (int ip = 0; ip < (int)meshlist.size(); ++ip) {
-        meshlist[ip]->Update(ChTime, update_assets);
+    for (int ip = 0; ip < (int)meshlist_raw.size(); ++ip) {
+        meshlist_raw[ip]->Update(ChTime, update_assets);
     }
 }
 
@@ -682,22 +985,41 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
-        if (body->IsActive())
-            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+    EnsureRawLists();
+
+    if (use_body_soa && body_soa_valid) {
+        // Streaming fast path: refresh the packed SoA mirror in a tight non-virtual loop,
+        // then copy it into the state vectors.
+        SyncBodySoAFromBodies();
+        for (size_t i = 0; i < body_soa.size(); i++) {
+            x.segment(displ_x + body_soa.off_x[i], 3) = body_soa.pos.segment(3 * i, 3);
+            x.segment(displ_x + body_soa.off_x[i] + 3, 4) = body_soa.rot.segment(4 * i, 4);
+            v.segment(displ_v + body_soa.off_w[i], 3) = body_soa.pos_dt.segment(3 * i, 3);
+            v.segment(displ_v + body_soa.off_w[i] + 3, 3) = body_soa.wvel.segment(3 * i, 3);
+        }
+        // Bodies not tracked in the SoA store (derived types) use the standard path.
+        for (auto body : bodylist_raw) {
+            if (body->body_soa_index < 0 && body->IsActive())
+                body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+        }
+    } else {
+        for (auto body : bodylist_raw) {
+            if (body->IsActive())
+                body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+        }
     }
-    for (auto& shaft : shaftlist) {
+    for (auto shaft : shaftlist_raw) {
         if (shaft->IsActive())
             shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T);
     }
-    for (auto& link : linklist) {
+    for (auto link : linklist_raw) {
         if (link->IsActive())
             link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T);
     }
-    for (auto& mesh : meshlist) {
+    for (auto mesh : meshlist_raw) {
         mesh->IntStateGather(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T);
     }
-    for (auto& item : otherphysicslist) {
+    for (auto item : otherphysicslist_raw) {
         if (item->IsActive())
             item->IntStateGather(displ_x + item->GetOffset_x(), x, displ_v + item->GetOffset_w(), v, T);
     }
@@ -721,28 +1043,63 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
-        if (body->IsActive())
-            body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
-        else
+    EnsureRawLists();
+
+    if (use_body_soa && body_soa_valid) {
+        // Flat fast path over the SoA mirror, avoiding per-body virtual state dispatch
+        // (replicates ChBody::IntStateScatter for exact-type bodies).
+        for (size_t i = 0; i < body_soa.size(); i++) {
+            ChBody* body = body_soa.bodies[i];
+            body->SetCoord(x.segment(displ_x + body_soa.off_x[i], 7));
+            body->SetPos_dt(v.segment(displ_v + body_soa.off_w[i], 3));
+            body->SetWvel_loc(v.segment(displ_v + body_soa.off_w[i] + 3, 3));
+            body->SetChTime(T);
             body->Update(T, full_update);
+        }
+        for (auto body : bodylist_raw) {
+            if (body->body_soa_index >= 0)
+                continue;
+            if (body->IsActive())
+                body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T,
+                                      full_update);
+            else
+                body->Update(T, full_update);
+        }
+    } else {
+        for (auto body : bodylist_raw) {
+            if (body->IsActive())
+                body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T,
+                                      full_update);
+            else
+                body->Update(T, full_update);
+        }
     }
-    for (auto& shaft : shaftlist) {
+    for (auto shaft : shaftlist_raw) {
         if (shaft->IsActive())
             shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T, full_update);
         else
             shaft->Update(T, full_update);
     }
-    for (auto& mesh : meshlist) {
+    for (auto mesh : meshlist_raw) {
         mesh->IntStateScatter(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T, full_update);
     }
-    for (auto& link : linklist) {
-        if (link->IsActive())
-            link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
-        else
-            link->Update(T, full_update);
+    // Links update only their own internal data (constraint residuals and jacobians), reading the
+    // already-scattered states of their connected bodies, so this sweep is distributed over the
+    // OpenMP worker pool as in Update(). This is where the per-step constraint linearization of
+    // models with many links (e.g. mate constraints) is paid for.
+    {
+        int nthreads = GetSystem() ? GetSystem()->GetNumThreadsChrono() : 1;
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+        for (int ip = 0; ip < (int)linklist_raw.size(); ++ip) {
+            auto link = linklist_raw[ip];
+            if (link->IsActive())
+                link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T,
+                                      full_update);
+            else
+                link->Update(T, full_update);
+        }
     }
-    for (auto& item : otherphysicslist) {
+    for (auto item : otherphysicslist_raw) {
         if (item->IsActive())
             item->IntStateScatter(displ_x + item->GetOffset_x(), x, displ_v + item->GetOffset_w(), v, T, full_update);
     }
@@ -920,22 +1277,24 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
 {
     unsigned int displ_v = off - this->offset_w;
 
-    for (auto& body : bodylist) {
+    EnsureRawLists();
+
+    for (auto body : bodylist_raw) {
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
     }
-    for (auto& shaft : shaftlist) {
+    for (auto shaft : shaftlist_raw) {
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
     }
-    for (auto& link : linklist) {
+    for (auto link : linklist_raw) {
         if (link->IsActive())
             link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c);
     }
-    for (auto& mesh : meshlist) {
+    for (auto mesh : meshlist_raw) {
         mesh->IntLoadResidual_F(displ_v + mesh->GetOffset_w(), R, c);
     }
-    for (auto& item : otherphysicslist) {
+    for (auto item : otherphysicslist_raw) {
         if (item->IsActive())
             item->IntLoadResidual_F(displ_v + item->GetOffset_w(), R, c);
     }
@@ -1122,19 +1481,21 @@ void ChAssembly::IntFromDescriptor(const unsigned int off_v,
 // -----------------------------------------------------------------------------
 
 void ChAssembly::InjectVariables(ChSystemDescriptor& mdescriptor) {
-    for (auto& body : bodylist) {
+    EnsureRawLists();
+
+    for (auto body : bodylist_raw) {
         body->InjectVariables(mdescriptor);
     }
-    for (auto& shaft : shaftlist) {
+    for (auto shaft : shaftlist_raw) {
         shaft->InjectVariables(mdescriptor);
     }
-    for (auto& link : linklist) {
+    for (auto link : linklist_raw) {
         link->InjectVariables(mdescriptor);
     }
-    for (auto& mesh : meshlist) {
+    for (auto mesh : meshlist_raw) {
         mesh->InjectVariables(mdescriptor);
     }
-    for (auto& item : otherphysicslist) {
+    for (auto item : otherphysicslist_raw) {
         item->InjectVariables(mdescriptor);
     }
 }
@@ -1248,19 +1609,21 @@ void ChAssembly::VariablesQbIncrementPosition(double dt_step) {
 }
 
 void ChAssembly::InjectConstraints(ChSystemDescriptor& mdescriptor) {
-    for (auto& body : bodylist) {
+    EnsureRawLists();
+
+    for (auto body : bodylist_raw) {
         body->InjectConstraints(mdescriptor);
     }
-    for (auto& shaft : shaftlist) {
+    for (auto shaft : shaftlist_raw) {
         shaft->InjectConstraints(mdescriptor);
     }
-    for (auto& link : linklist) {
+    for (auto link : linklist_raw) {
         link->InjectConstraints(mdescriptor);
     }
-    for (auto& mesh : meshlist) {
+    for (auto mesh : meshlist_raw) {
         mesh->InjectConstraints(mdescriptor);
     }
-    for (auto& item : otherphysicslist) {
+    for (auto item : otherphysicslist_raw) {
         item->InjectConstraints(mdescriptor);
     }
 }
@@ -1392,19 +1755,21 @@ void ChAssembly::ConstraintsFetch_react(double factor) {
 }
 
 void ChAssembly::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
-    for (auto& body : bodylist) {
+    EnsureRawLists();
+
+    for (auto body : bodylist_raw) {
         body->InjectKRMmatrices(mdescriptor);
     }
-    for (auto& shaft : shaftlist) {
+    for (auto shaft : shaftlist_raw) {
         shaft->InjectKRMmatrices(mdescriptor);
     }
-    for (auto& link : linklist) {
+    for (auto link : linklist_raw) {
         link->InjectKRMmatrices(mdescriptor);
     }
-    for (auto& mesh : meshlist) {
+    for (auto mesh : meshlist_raw) {
         mesh->InjectKRMmatrices(mdescriptor);
     }
-    for (auto& item : otherphysicslist) {
+    for (auto item : otherphysicslist_raw) {
         item->InjectKRMmatrices(mdescriptor);
     }
 }
@@ -15,7 +15,9 @@
 #ifndef CHASSEMBLY_H
 #define CHASSEMBLY_H
 
+#include <array>
 #include <cmath>
+
 #include "chrono/fea/ChMesh.h"
 #include "chrono/physics/ChBodyAuxRef.h"
 #include "chrono/physics/ChShaft.h"
@@ -53,6 +55,13 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Attach a body to this assembly.
     void AddBody(std::shared_ptr<ChBody> body);
 
+    /// Attach a batch of bodies to this assembly, in a single list update.
+    /// Equivalent to calling AddBody() on each element, but the body list grows once and the
+    /// per-item bookkeeping is amortized over the whole batch - preferable when spawning many
+    /// bodies mid-simulation. As with AddBody(), offsets and DOF counts are recomputed at the
+    /// next Setup(), not per insertion.
+    void AddBodies(const std::vector<std::shared_ptr<ChBody>>& bodies);
+
     /// Attach a shaft to this assembly.
     void AddShaft(std::shared_ptr<ChShaft> shaft);
 
@@ -83,6 +92,10 @@ class ChApi ChAssembly : public ChPhysicsItem {
 
     /// Remove a body from this assembly.
     void RemoveBody(std::shared_ptr<ChBody> body);
+    /// Remove a batch of bodies from this assembly, in a single sweep of the body list.
+    /// Equivalent to calling RemoveBody() on each element, but the list is compacted once
+    /// (linear in the list size) instead of once per removed body.
+    void RemoveBodies(const std::vector<std::shared_ptr<ChBody>>& bodies);
     /// Remove a shaft from this assembly.
     void RemoveShaft(std::shared_ptr<ChShaft> shaft);
     /// Remove a link from this assembly.
@@ -116,6 +129,30 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Get the list of physics items that are not in the body or link lists.
     const std::vector<std::shared_ptr<ChPhysicsItem>>& Get_otherphysicslist() const { return otherphysicslist; }
 
+    /// Enable or disable the structure-of-arrays (SoA) backing store for rigid body states.
+    /// When enabled, the states of all active bodies of exact type ChBody are mirrored in contiguous
+    /// arrays (positions, rotations, linear and angular velocities), rebuilt at each Setup(). State
+    /// gather/scatter then runs as streaming loops over these arrays instead of chasing per-body
+    /// pointers and virtual calls, which is significantly faster for very large body populations.
+    /// Bodies of derived types (e.g. ChBodyAuxRef) always fall back to the standard per-item path.
+    /// Disabled by default.
+    void EnableBodySoAStorage(bool val);
+
+    /// Return true if the SoA backing store for body states is enabled.
+    bool UseBodySoAStorage() const { return use_body_soa; }
+
+    /// Enable lazy updates of the items contained in this assembly (default: false).
+    /// When enabled, Update() skips items that declare their update unnecessary (see
+    /// ChPhysicsItem::CanSkipUpdate) because neither their state nor their inputs changed since the
+    /// last step - typically fixed or sleeping bodies with no attached markers or forces. This can
+    /// save substantial time in scenes where most bodies are at rest. User code that directly
+    /// modifies a skippable item (e.g. repositioning a fixed body) must then flag it with
+    /// ChPhysicsItem::ForceUpdate().
+    void SetUseLazyUpdate(bool val) { use_lazy_update = val; }
+
+    /// Return true if lazy updates of sub-items are enabled.
+    bool GetUseLazyUpdate() const { return use_lazy_update; }
+
     /// Search a body by its name.
     std::shared_ptr<ChBody> SearchBody(const std::string& name) const;
     /// Search a body by its ID
@@ -195,6 +232,12 @@ class ChApi ChAssembly : public ChPhysicsItem {
 
     virtual void SyncCollisionModels() override;
 
+    /// Assign the given collision family to all collision models in this assembly.
+    /// The family is applied to the collision model of every body in this assembly and, recursively, in all
+    /// sub-assemblies found among its physics items. Use together with ChSystem::RegisterCollisionFamily to keep
+    /// independently developed sub-assemblies in distinct collision families without manual bookkeeping.
+    void SetCollisionFamily(int family);
+
     /// Counts the number of bodies, links, and meshes.
     /// Computes the offsets of object states in the global state.
     /// Assumes that this->offset_x this->offset_w this->offset_L are already set
@@ -321,6 +364,29 @@ class ChApi ChAssembly : public ChPhysicsItem {
   protected:
     virtual void SetupInitial() override;
 
+    /// Rebuild the SoA state store from the current body list (called at each Setup() when enabled).
+    void RebuildBodySoA();
+    /// Refresh the packed SoA arrays from the mirrored bodies (tight non-virtual loop).
+    void SyncBodySoAFromBodies();
+
+    /// Structure-of-arrays mirror of the states of active, exact-type ChBody objects.
+    /// All arrays are indexed by the body's SoA index (see ChBody::GetSoaIndex).
+    struct BodySoAStore {
+        std::vector<ChBody*> bodies;        ///< raw pointers to the mirrored bodies
+        std::vector<unsigned int> off_x;    ///< per-body offsets in the position state (relative to assembly)
+        std::vector<unsigned int> off_w;    ///< per-body offsets in the velocity state (relative to assembly)
+        ChVectorDynamic<> pos;              ///< packed positions (3 per body)
+        ChVectorDynamic<> rot;              ///< packed rotation quaternions (4 per body)
+        ChVectorDynamic<> pos_dt;           ///< packed linear velocities (3 per body)
+        ChVectorDynamic<> wvel;             ///< packed local angular velocities (3 per body)
+        size_t size() const { return bodies.size(); }
+        void clear() {
+            bodies.clear();
+            off_x.clear();
+            off_w.clear();
+        }
+    };
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChShaft>> shaftlist;               ///< list of 1-D shafts
     std::vector<std::shared_ptr<ChLinkBase>> linklist;             ///< list of joints (links)
@@ -328,6 +394,17 @@ class ChApi ChAssembly : public ChPhysicsItem {
     std::vector<std::shared_ptr<ChPhysicsItem>> otherphysicslist;  ///< list of other physics objects
     std::vector<std::shared_ptr<ChPhysicsItem>> batch_to_insert;   ///< list of items to insert at once
 
+    // Raw-pointer mirrors of the item lists above, used by the hot per-step iteration paths
+    // (Update, state gather/scatter, descriptor injection) so that inner loops never touch the
+    // shared_ptr control blocks. Ownership remains with the shared_ptr lists; the mirrors are
+    // refreshed on first use after any change to the set of contained items (see EnsureRawLists).
+    std::vector<ChBody*> bodylist_raw;                  ///< raw mirror of bodylist
+    std::vector<ChShaft*> shaftlist_raw;                ///< raw mirror of shaftlist
+    std::vector<ChLinkBase*> linklist_raw;              ///< raw mirror of linklist
+    std::vector<fea::ChMesh*> meshlist_raw;             ///< raw mirror of meshlist
+    std::vector<ChPhysicsItem*> otherphysicslist_raw;   ///< raw mirror of otherphysicslist
+    unsigned int raw_lists_version;                     ///< topology version at the last mirror refresh
+
     // Statistics:
     int nbodies;        ///< number of bodies (currently active)
     int nbodies_sleep;  ///< number of bodies that are sleeping
@@ -349,6 +426,31 @@ class ChApi ChAssembly : public ChPhysicsItem {
     int ndoc_w_C;    ///< number of scalar constraints C, when using 3 rot. dof. per body (excluding unilaterals)
     int ndoc_w_D;    ///< number of scalar constraints D, when using 3 rot. dof. per body (only unilaterals)
 
+    bool use_body_soa;       ///< if true, maintain the SoA backing store for body states
+    bool use_lazy_update;    ///< if true, skip the update of items whose state and inputs are unchanged
+    bool body_soa_valid;     ///< if true, the SoA store matches the current body list
+    BodySoAStore body_soa;   ///< SoA backing store for body states
+
+    // Bookkeeping for the fixed-topology fast path of Setup().
+    // The topology version is incremented whenever an item is added to or removed from the assembly; the
+    // cached counts record, for every contained item in setup order, its activity state and its numbers of
+    // unknowns and constraints as seen by the last full counting pass.
+    unsigned int topology_version;  ///< incremented on every change to the set of contained items
+    unsigned int setup_version;     ///< topology version at the last full counting pass (0: none yet)
+    unsigned int setup_offset_x;    ///< assembly state offsets seen by the last full counting pass
+    unsigned int setup_offset_w;
+    unsigned int setup_offset_L;
+    std::vector<std::array<int, 6>> setup_counts;  ///< cached per-item {activity, DOF, DOF_w, DOC, DOC_c, DOC_d}
+
+    /// Attempt the fixed-topology fast path of Setup(). Verify that no contained item changed its activity
+    /// state or its counts and dispatch the per-item Setup hooks; return false if a full counting pass is
+    /// needed, with 'item_hooks_dispatched' indicating whether the hooks of the other physics items (which
+    /// may perform once-per-step work and must not run twice) were already dispatched.
+    bool SetupFastPath(bool& item_hooks_dispatched);
+
+    /// Refresh the raw-pointer mirrors of the item lists, if the set of contained items changed.
+    void EnsureRawLists();
+
     friend class ChSystem;
     friend class ChSystemMulticore;
     friend class ChSystemDistributed;
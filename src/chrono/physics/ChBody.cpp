@@ -46,6 +46,8 @@ ChBody::ChBody(collision::ChCollisionSystemType collision_type) {
 
     BFlagsSetAllOFF();  // no flags
 
+    body_soa_index = -1;
+
     Xforce = VNULL;
     Xtorque = VNULL;
 
@@ -92,6 +94,8 @@ ChBody::ChBody(std::shared_ptr<collision::ChCollisionModel> new_collision_model)
 
     BFlagsSetAllOFF();  // no flags
 
+    body_soa_index = -1;
+
     Xforce = VNULL;
     Xtorque = VNULL;
 
@@ -120,6 +124,8 @@ ChBody::ChBody(std::shared_ptr<collision::ChCollisionModel> new_collision_model)
 ChBody::ChBody(const ChBody& other) : ChPhysicsItem(other), ChBodyFrame(other) {
     bflags = other.bflags;
 
+    body_soa_index = -1;
+
     variables = other.variables;
     variables.SetUserData((void*)this);
 
@@ -152,6 +152,10 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     /// Get the global body index (internal use only)
     unsigned int GetGid() const { return body_gid; }
 
+    /// Get the index of this body in the SoA state store of the containing assembly, if enabled.
+    /// Return -1 if the body is not tracked in a SoA state store (internal use only).
+    int GetSoaIndex() const { return body_soa_index; }
+
     // FUNCTIONS
 
     /// Number of coordinates of body: 7 because uses quaternions for rotation.
@@ -414,6 +418,14 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     /// its children (markers, forces..)
     virtual void Update(bool update_assets = true) override;
 
+    /// A fixed or sleeping body may skip its update: its state is frozen and, if it carries no
+    /// markers and no forces (both of which may be time-dependent), Update() would only recompute
+    /// identical data. Honors the dirty flag raised by ChPhysicsItem::ForceUpdate(), which must be
+    /// used when directly modifying such a body (e.g. repositioning a fixed body).
+    virtual bool CanSkipUpdate() const override {
+        return !update_dirty && (GetBodyFixed() || GetSleeping()) && marklist.empty() && forcelist.empty();
+    }
+
     /// Return the resultant applied force on the body.
     /// This resultant force includes all external applied loads acting on this body (from gravity, loads, springs,
     /// etc). However, this does *not* include any constraint forces. In particular, contact forces are not included if
@@ -481,6 +493,7 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
 
     unsigned int body_id;   ///< body-specific identifier, used for indexing (internal use only)
     unsigned int body_gid;  ///< body-specific identifier, used for global indexing (internal use only)
+    int body_soa_index;     ///< index in the optional SoA state store of the containing assembly; -1 if none
 
     std::vector<std::shared_ptr<ChMarker>> marklist;  ///< list of markers
     std::vector<std::shared_ptr<ChForce>> forcelist;  ///< list of forces
@@ -727,6 +740,7 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
 
     // Give private access
     friend class ChSystem;
+    friend class ChSleepManager;
     friend class ChSystemMulticore;
     friend class ChSystemMulticoreNSC;
     friend class ChAssembly;
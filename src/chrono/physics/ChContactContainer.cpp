@@ -24,6 +24,56 @@ ChContactContainer::ChContactContainer(const ChContactContainer& other) : ChPhys
     report_contact_callback = other.report_contact_callback;
 }
 
+void ChContactContainer::SnapshotContacts(ContactSnapshot& snapshot) {
+    // Adapter appending each reported contact to the snapshot arrays
+    class SnapshotReporter : public ReportContactCallback {
+      public:
+        SnapshotReporter(ContactSnapshot& snapshot) : m_snapshot(snapshot) {}
+        virtual bool OnReportContact(const ChVector<>& pA,
+                                     const ChVector<>& pB,
+                                     const ChMatrix33<>& plane_coord,
+                                     const double& distance,
+                                     const double& eff_radius,
+                                     const ChVector<>& react_forces,
+                                     const ChVector<>& react_torques,
+                                     ChContactable* contactobjA,
+                                     ChContactable* contactobjB) override {
+            m_snapshot.Append(pA, pB, plane_coord, distance, eff_radius, react_forces, react_torques, contactobjA,
+                              contactobjB);
+            return true;
+        }
+        ContactSnapshot& m_snapshot;
+    };
+
+    snapshot.Clear();
+    snapshot.Reserve(GetNcontacts());
+    ReportAllContacts(chrono_types::make_shared<SnapshotReporter>(snapshot));
+    LoadSnapshotUserData(snapshot);
+}
+
+void ChContactContainer::StoreSnapshotUserData(const ContactSnapshot& snapshot) {
+    user_data_map.clear();
+    for (size_t i = 0; i < snapshot.Size(); i++)
+        user_data_map[{snapshot.obj_A[i], snapshot.obj_B[i]}].push_back(snapshot.user_data[i]);
+}
+
+void ChContactContainer::LoadSnapshotUserData(ContactSnapshot& snapshot) {
+    snapshot.user_data.assign(snapshot.Size(), 0.0);
+
+    if (user_data_map.empty())
+        return;
+
+    // Match contacts to saved values by contactable pair, in scan order within each pair
+    std::unordered_map<std::pair<ChContactable*, ChContactable*>, size_t, ContactPairHash> ordinals;
+    for (size_t i = 0; i < snapshot.Size(); i++) {
+        std::pair<ChContactable*, ChContactable*> key(snapshot.obj_A[i], snapshot.obj_B[i]);
+        size_t ordinal = ordinals[key]++;
+        auto entry = user_data_map.find(key);
+        if (entry != user_data_map.end() && ordinal < entry->second.size())
+            snapshot.user_data[i] = entry->second[ordinal];
+    }
+}
+
 void ChContactContainer::ArchiveOut(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChContactContainer>();
@@ -22,6 +22,8 @@
 
 #include <list>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/physics/ChBody.h"
@@ -115,6 +117,86 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     /// object.
     virtual void ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) {}
 
+    /// Structure-of-arrays snapshot of all contacts in a container.
+    /// All arrays have one entry per contact; entries with the same index refer to the same contact. A snapshot
+    /// filled by SnapshotContacts() is valid for the current step only, as the collision detection of the next step
+    /// rebuilds the contact list. Iterating these plain arrays lets user analysis code vectorize, instead of paying
+    /// a virtual function call per contact as with ReportAllContacts().
+    struct ContactSnapshot {
+        std::vector<ChVector<>> point_A;    ///< contact point on first contactable (global frame)
+        std::vector<ChVector<>> point_B;    ///< contact point on second contactable (global frame)
+        std::vector<ChVector<>> normal;     ///< contact normal (global frame)
+        std::vector<double> distance;       ///< contact distance (negative for penetration)
+        std::vector<double> eff_radius;     ///< effective radius of curvature at contact
+        std::vector<ChVector<>> force;      ///< contact force, if already computed (global frame)
+        std::vector<ChVector<>> torque;     ///< contact torque, if rolling friction (global frame)
+        std::vector<ChContactable*> obj_A;  ///< first contactable object
+        std::vector<ChContactable*> obj_B;  ///< second contactable object
+        std::vector<double> user_data;      ///< per-contact user data slots (see SnapshotContacts)
+
+        /// Return the number of contacts in the snapshot.
+        size_t Size() const { return distance.size(); }
+
+        /// Remove all entries.
+        void Clear() {
+            point_A.clear();
+            point_B.clear();
+            normal.clear();
+            distance.clear();
+            eff_radius.clear();
+            force.clear();
+            torque.clear();
+            obj_A.clear();
+            obj_B.clear();
+            user_data.clear();
+        }
+
+        /// Reserve space for the specified number of contacts.
+        void Reserve(size_t n) {
+            point_A.reserve(n);
+            point_B.reserve(n);
+            normal.reserve(n);
+            distance.reserve(n);
+            eff_radius.reserve(n);
+            force.reserve(n);
+            torque.reserve(n);
+            obj_A.reserve(n);
+            obj_B.reserve(n);
+        }
+
+        /// Append one contact entry, converting force and torque from the contact plane to the global frame.
+        void Append(const ChVector<>& pA,
+                    const ChVector<>& pB,
+                    const ChMatrix33<>& plane_coord,
+                    double dist,
+                    double radius,
+                    const ChVector<>& force_loc,
+                    const ChVector<>& torque_loc,
+                    ChContactable* objA,
+                    ChContactable* objB) {
+            point_A.push_back(pA);
+            point_B.push_back(pB);
+            normal.push_back(plane_coord.Get_A_Xaxis());
+            distance.push_back(dist);
+            eff_radius.push_back(radius);
+            force.push_back(plane_coord * force_loc);
+            torque.push_back(plane_coord * torque_loc);
+            obj_A.push_back(objA);
+            obj_B.push_back(objB);
+        }
+    };
+
+    /// Fill a structure-of-arrays snapshot with all contacts in the container (replacing its current content).
+    /// The default implementation scans the contacts through the reporting callback mechanism; derived containers
+    /// may override it with a direct traversal of their contact lists. On return, the user_data array holds, for
+    /// each contact, the value saved for the matching contact by StoreSnapshotUserData() at a previous step (0 if
+    /// the contact is new); contacts are matched across steps by their pair of contactable objects, in scan order.
+    virtual void SnapshotContacts(ContactSnapshot& snapshot);
+
+    /// Save the user_data column of the given snapshot, so that it can be recovered (for the contacts that still
+    /// exist) by SnapshotContacts() at later steps.
+    virtual void StoreSnapshotUserData(const ContactSnapshot& snapshot);
+
     /// Compute contact forces on all contactable objects in this container.
     virtual void ComputeContactForces() {}
 
@@ -139,6 +221,22 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     std::shared_ptr<AddContactCallback> add_contact_callback;
     ReportContactCallback* report_contact_callback;
 
+    /// Hash functor for a pair of contactable objects.
+    struct ContactPairHash {
+        size_t operator()(const std::pair<ChContactable*, ChContactable*>& p) const {
+            size_t h = std::hash<ChContactable*>()(p.first);
+            return (h ^ std::hash<ChContactable*>()(p.second)) * (size_t)1099511628211ULL;
+        }
+    };
+
+    /// Per-contact user data saved by StoreSnapshotUserData, keyed by the pair of contactable objects;
+    /// each entry holds the values of all contacts of that pair, in scan order.
+    std::unordered_map<std::pair<ChContactable*, ChContactable*>, std::vector<double>, ContactPairHash> user_data_map;
+
+    /// Fill the user_data column of the snapshot from the values saved by StoreSnapshotUserData().
+    /// Derived classes overriding SnapshotContacts() must call this after filling the contact arrays.
+    void LoadSnapshotUserData(ContactSnapshot& snapshot);
+
     /// Utility function to accumulate contact forces from a specified list of contacts.
     /// This function is templated by the contact type (assumed to be derived from ChContactTuple).
     /// Contact forces are accumulated in a map keyed by the contactable objects.
@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <iterator>
+
 #include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
@@ -35,7 +37,10 @@ ChContactContainerNSC::ChContactContainerNSC()
       n_added_666_6(0),
       n_added_666_333(0),
       n_added_666_666(0),
-      n_added_6_6_rolling(0) {}
+      n_added_6_6_rolling(0),
+      use_warm_start(false),
+      warm_start_step(0),
+      warm_start_resolution(1e-3) {}
 
 ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other) : ChContactContainer(other) {
     n_added_6_6 = 0;
@@ -49,6 +54,9 @@ ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other)
     n_added_666_333 = 0;
     n_added_666_666 = 0;
     n_added_6_6_rolling = 0;
+    use_warm_start = other.use_warm_start;
+    warm_start_step = 0;
+    warm_start_resolution = other.warm_start_resolution;
 }
 
 ChContactContainerNSC::~ChContactContainerNSC() {
@@ -73,6 +81,13 @@ void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int&
     n_added = 0;
 }
 
+template <class Tcont>
+void _PurgeContactPool(std::list<Tcont*>& contactpool) {
+    for (auto* contact : contactpool)
+        delete contact;
+    contactpool.clear();
+}
+
 void ChContactContainerNSC::RemoveAllContacts() {
     _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
     _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
@@ -85,9 +100,23 @@ void ChContactContainerNSC::RemoveAllContacts() {
     _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
     _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
     _RemoveAllContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
+
+    _PurgeContactPool(contactpool_6_6);
+    _PurgeContactPool(contactpool_6_3);
+    _PurgeContactPool(contactpool_3_3);
+    _PurgeContactPool(contactpool_333_3);
+    _PurgeContactPool(contactpool_333_6);
+    _PurgeContactPool(contactpool_333_333);
+    _PurgeContactPool(contactpool_666_3);
+    _PurgeContactPool(contactpool_666_6);
+    _PurgeContactPool(contactpool_666_333);
+    _PurgeContactPool(contactpool_666_666);
+    _PurgeContactPool(contactpool_6_6_rolling);
 }
 
 void ChContactContainerNSC::BeginAddContact() {
+    warm_start_step++;
+
     lastcontact_6_6 = contactlist_6_6.begin();
     n_added_6_6 = 0;
 
@@ -122,59 +151,66 @@ void ChContactContainerNSC::BeginAddContact() {
     n_added_6_6_rolling = 0;
 }
 
-void ChContactContainerNSC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
-    }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
-    }
+template <class Tcont, class Titer>
+void _EndAddContact(std::list<Tcont*>& contactlist, Titer& lastcontact, std::list<Tcont*>& contactpool) {
+    // Contacts beyond the last one reused in this step have vanished: move them to the recycling
+    // pool (an O(n) splice with no heap traffic) so they can be reused by later insertions.
+    contactpool.splice(contactpool.end(), contactlist, lastcontact, contactlist.end());
+    lastcontact = contactlist.end();
+}
 
-    while (lastcontact_6_6_rolling != contactlist_6_6_rolling.end()) {
-        delete (*lastcontact_6_6_rolling);
-        lastcontact_6_6_rolling = contactlist_6_6_rolling.erase(lastcontact_6_6_rolling);
-    }
+void ChContactContainerNSC::EndAddContact() {
+    // move contacts that are beyond last contact to the recycling pools
+    _EndAddContact(contactlist_6_6, lastcontact_6_6, contactpool_6_6);
+    _EndAddContact(contactlist_6_3, lastcontact_6_3, contactpool_6_3);
+    _EndAddContact(contactlist_3_3, lastcontact_3_3, contactpool_3_3);
+    _EndAddContact(contactlist_333_3, lastcontact_333_3, contactpool_333_3);
+    _EndAddContact(contactlist_333_6, lastcontact_333_6, contactpool_333_6);
+    _EndAddContact(contactlist_333_333, lastcontact_333_333, contactpool_333_333);
+    _EndAddContact(contactlist_666_3, lastcontact_666_3, contactpool_666_3);
+    _EndAddContact(contactlist_666_6, lastcontact_666_6, contactpool_666_6);
+    _EndAddContact(contactlist_666_333, lastcontact_666_333, contactpool_666_333);
+    _EndAddContact(contactlist_666_666, lastcontact_666_666, contactpool_666_666);
+    _EndAddContact(contactlist_6_6_rolling, lastcontact_6_6_rolling, contactpool_6_6_rolling);
+
+    // Evict warm-start entries for contacts that have vanished (with one step of grace, so that
+    // contacts blinking on and off between collision detections keep their cached multipliers).
+    if (use_warm_start) {
+        for (auto it = warm_start_cache.begin(); it != warm_start_cache.end();) {
+            if (it->second.last_step < warm_start_step - 1)
+                it = warm_start_cache.erase(it);
+            else
+                ++it;
+        }
+    }
+}
+
+float* ChContactContainerNSC::GetWarmStartSlot(const collision::ChCollisionInfo& cinfo) {
+    auto objA = cinfo.modelA->GetContactable();
+    auto objB = cinfo.modelB->GetContactable();
+
+    // Quantize the contact point on A, expressed in the local frame of A, so that the key is
+    // invariant to rigid motion of the pair and stable across small sliding motions.
+    ChVector<> p_loc = objA->GetCsysForCollisionModel().TransformPointParentToLocal(cinfo.vpA);
+    double scale = 1.0 / warm_start_resolution;
+
+    WarmStartKey key;
+    key.objA = objA;
+    key.objB = objB;
+    key.x = (long long)std::floor(p_loc.x() * scale);
+    key.y = (long long)std::floor(p_loc.y() * scale);
+    key.z = (long long)std::floor(p_loc.z() * scale);
+
+    auto result = warm_start_cache.insert({key, WarmStartSlot{{0, 0, 0, 0, 0, 0}, warm_start_step}});
+    result.first->second.last_step = warm_start_step;
+    return result.first->second.reactions.data();
 }
 
 template <class Tcont, class Titer, class Ta, class Tb>
 void _OptimalContactInsert(std::list<Tcont*>& contactlist,           // contact list
                            Titer& lastcontact,                       // last contact acquired
                            int& n_added,                             // number of contacts inserted
+                           std::list<Tcont*>& contactpool,           // pool of recycled contact objects
                            ChContactContainer* container,            // contact container
                            Ta* objA,                                 // collidable object A
                            Tb* objB,                                 // collidable object B
@@ -185,6 +221,11 @@ void _OptimalContactInsert(std::list<Tcont*>& contactlist,           // contact
         // reuse old contacts
         (*lastcontact)->Reset(objA, objB, cinfo, cmat);
         lastcontact++;
+    } else if (!contactpool.empty()) {
+        // recycle a contact object from the pool (O(1) node splice, no allocation)
+        contactpool.back()->Reset(objA, objB, cinfo, cmat);
+        contactlist.splice(contactlist.end(), contactpool, std::prev(contactpool.end()));
+        lastcontact = contactlist.end();
     } else {
         // add new contact
         Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
@@ -250,7 +291,16 @@ void ChContactContainerNSC::AddContact(const collision::ChCollisionInfo& cinfo)
     InsertContact(cinfo, cmat);
 }
 
-void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat) {
+void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinfo_in,
+                                          const ChMaterialCompositeNSC& cmat) {
+    collision::ChCollisionInfo cinfo(cinfo_in);
+
+    // If the warm-start cache is enabled and the collision system did not attach its own persistent
+    // reaction cache (as the Bullet system does through its contact manifolds), attach a cache slot
+    // keyed by contact identity, so that multipliers survive container reordering across steps.
+    if (use_warm_start && !cinfo.reaction_cache)
+        cinfo.reaction_cache = GetWarmStartSlot(cinfo);
+
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
 
@@ -271,22 +321,22 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, contactpool_3_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, contactpool_6_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, contactpool_333_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, contactpool_666_3, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -295,25 +345,25 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, contactpool_6_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6    ***NOTE: for body-body one could have rolling friction: ***
                 if (cmat.rolling_friction || cmat.spinning_friction) {
-                    _OptimalContactInsert(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this, objA, objB, cinfo, cmat);
+                    _OptimalContactInsert(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, contactpool_6_6_rolling, this, objA, objB, cinfo, cmat);
                 } else {
-                    _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                    _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, contactpool_6_6, this, objA, objB, cinfo, cmat);
                 }
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, contactpool_333_6, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, contactpool_666_6, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -322,20 +372,20 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, contactpool_333_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, contactpool_333_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, contactpool_333_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, contactpool_666_333, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -344,19 +394,19 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, contactpool_666_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, contactpool_666_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, contactpool_666_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, contactpool_666_666, this, objA, objB, cinfo, cmat);
             }
         } break;
 
@@ -441,6 +491,42 @@ void ChContactContainerNSC::ReportAllContacts(std::shared_ptr<ReportContactCallb
     _ReportAllContactsRolling(contactlist_6_6_rolling, callback.get());
 }
 
+template <class Tcont>
+void _SnapshotContacts(std::list<Tcont*>& contactlist, ChContactContainer::ContactSnapshot& snapshot) {
+    for (auto contact : contactlist) {
+        snapshot.Append(contact->GetContactP1(), contact->GetContactP2(), contact->GetContactPlane(),
+                        contact->GetContactDistance(), contact->GetEffectiveCurvatureRadius(),
+                        contact->GetContactForce(), VNULL, contact->GetObjA(), contact->GetObjB());
+    }
+}
+
+template <class Tcont>
+void _SnapshotContactsRolling(std::list<Tcont*>& contactlist, ChContactContainer::ContactSnapshot& snapshot) {
+    for (auto contact : contactlist) {
+        snapshot.Append(contact->GetContactP1(), contact->GetContactP2(), contact->GetContactPlane(),
+                        contact->GetContactDistance(), contact->GetEffectiveCurvatureRadius(),
+                        contact->GetContactForce(), contact->GetContactTorque(), contact->GetObjA(),
+                        contact->GetObjB());
+    }
+}
+
+void ChContactContainerNSC::SnapshotContacts(ContactSnapshot& snapshot) {
+    snapshot.Clear();
+    snapshot.Reserve(GetNcontacts());
+    _SnapshotContacts(contactlist_6_6, snapshot);
+    _SnapshotContacts(contactlist_6_3, snapshot);
+    _SnapshotContacts(contactlist_3_3, snapshot);
+    _SnapshotContacts(contactlist_333_3, snapshot);
+    _SnapshotContacts(contactlist_333_6, snapshot);
+    _SnapshotContacts(contactlist_333_333, snapshot);
+    _SnapshotContacts(contactlist_666_3, snapshot);
+    _SnapshotContacts(contactlist_666_6, snapshot);
+    _SnapshotContacts(contactlist_666_333, snapshot);
+    _SnapshotContacts(contactlist_666_666, snapshot);
+    _SnapshotContactsRolling(contactlist_6_6_rolling, snapshot);
+    LoadSnapshotUserData(snapshot);
+}
+
 
 template <class Tcont>
 void _ReportAllContactsNSC(std::list<Tcont*>& contactlist, ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
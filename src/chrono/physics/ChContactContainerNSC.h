@@ -15,7 +15,9 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
+#include <array>
 #include <list>
+#include <unordered_map>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactNSC.h"
@@ -57,6 +59,21 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     std::list<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
 
+    // Pools of contact objects recycled across steps. Contacts that vanish are moved here by
+    // EndAddContact() (instead of being deleted) and reused by later insertions, so that steady-state
+    // simulation incurs no per-contact heap traffic even when the number of contacts fluctuates.
+    std::list<ChContactNSC_6_6*> contactpool_6_6;
+    std::list<ChContactNSC_6_3*> contactpool_6_3;
+    std::list<ChContactNSC_3_3*> contactpool_3_3;
+    std::list<ChContactNSC_333_3*> contactpool_333_3;
+    std::list<ChContactNSC_333_6*> contactpool_333_6;
+    std::list<ChContactNSC_333_333*> contactpool_333_333;
+    std::list<ChContactNSC_666_3*> contactpool_666_3;
+    std::list<ChContactNSC_666_6*> contactpool_666_6;
+    std::list<ChContactNSC_666_333*> contactpool_666_333;
+    std::list<ChContactNSC_666_666*> contactpool_666_666;
+    std::list<ChContactNSCrolling_6_6*> contactpool_6_6_rolling;
+
     int n_added_6_6;
     int n_added_6_3;
     int n_added_3_3;
@@ -84,6 +101,44 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
+    /// Identity of a contact, used as key in the warm-start cache: the contactable pair plus the
+    /// contact point on the first contactable, quantized in its local frame.
+    struct WarmStartKey {
+        ChContactable* objA;
+        ChContactable* objB;
+        long long x;
+        long long y;
+        long long z;
+        bool operator==(const WarmStartKey& other) const {
+            return objA == other.objA && objB == other.objB && x == other.x && y == other.y && z == other.z;
+        }
+    };
+
+    struct WarmStartKeyHash {
+        std::size_t operator()(const WarmStartKey& key) const {
+            std::size_t h = std::hash<void*>()(key.objA) ^ (std::hash<void*>()(key.objB) << 1);
+            h ^= std::hash<long long>()(key.x) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+            h ^= std::hash<long long>()(key.y) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+            h ^= std::hash<long long>()(key.z) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+
+    /// Cached reactions (N,U,V and, for rolling contacts, the three rolling reactions) of one contact.
+    struct WarmStartSlot {
+        std::array<float, 6> reactions;
+        int last_step;
+    };
+
+    bool use_warm_start;              ///< if true, maintain the persistent warm-start cache
+    int warm_start_step;              ///< step counter used to evict stale warm-start entries
+    double warm_start_resolution;     ///< quantization resolution for contact points in the cache key
+    std::unordered_map<WarmStartKey, WarmStartSlot, WarmStartKeyHash> warm_start_cache;
+
+    /// Return the persistent reaction cache slot for the given collision pair, creating a
+    /// zero-initialized one on first use.
+    float* GetWarmStartSlot(const collision::ChCollisionInfo& cinfo);
+
   public:
     ChContactContainerNSC();
     ChContactContainerNSC(const ChContactContainerNSC& other);
@@ -92,13 +147,29 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChContactContainerNSC* Clone() const override { return new ChContactContainerNSC(*this); }
 
+    /// Enable a persistent warm-start cache for contact multipliers (default: disabled).
+    /// When enabled, each contact without a collision-system-provided reaction cache is attached to a
+    /// persistent cache slot keyed by its identity (contactable pair plus quantized contact point), so
+    /// that the iterative VI solvers are seeded with the multipliers of the previous step even when
+    /// contact ordering in this container shifts as contacts are created and destroyed.
+    /// The optional resolution is the quantization cell size used to match contact points across steps.
+    void EnableWarmStartCache(bool val, double resolution = 1e-3) {
+        use_warm_start = val;
+        warm_start_resolution = resolution;
+        if (!val)
+            warm_start_cache.clear();
+    }
+
+    /// Return true if the persistent warm-start cache is enabled.
+    bool IsWarmStartCacheEnabled() const { return use_warm_start; }
+
     /// Report the number of added contacts.
     virtual int GetNcontacts() const override {
         return n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
                n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666 + n_added_6_6_rolling;
     }
 
-    /// Remove (delete) all contained contact data.
+    /// Remove (delete) all contained contact data, including the pools of recycled contact objects.
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
@@ -127,6 +198,10 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// object.
     virtual void ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) override;
 
+    /// Fill a structure-of-arrays snapshot with all contacts in the container (replacing its current content).
+    /// Overrides the base implementation with a direct traversal of the contact lists (no virtual call per contact).
+    virtual void SnapshotContacts(ContactSnapshot& snapshot) override;
+
     /// Class to be used as a NSC-specific callback interface for some user defined action to be taken
     /// for each contact (already added to the container, maybe with already computed forces).
     /// It can be used to report or post-process contacts. 
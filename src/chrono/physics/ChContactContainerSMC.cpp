@@ -117,6 +117,10 @@ void ChContactContainerSMC::BeginAddContact() {
 
     // lastcontact_roll = contactlist_roll.begin();
     // n_added_roll = 0;
+
+    // Composite materials are cached only within one collision batch, so that in-place changes to
+    // the contact materials between steps are picked up.
+    composite_cache.clear();
 }
 
 void ChContactContainerSMC::EndAddContact() {
@@ -214,9 +218,8 @@ void ChContactContainerSMC::AddContact(const collision::ChCollisionInfo& cinfo,
     }
 
     // Create the composite material
-    ChMaterialCompositeSMC cmat(GetSystem()->composition_strategy.get(),
-                                std::static_pointer_cast<ChMaterialSurfaceSMC>(mat1),
-                                std::static_pointer_cast<ChMaterialSurfaceSMC>(mat2));
+    const ChMaterialCompositeSMC& cmat = GetCompositeMaterial(std::static_pointer_cast<ChMaterialSurfaceSMC>(mat1),
+                                                              std::static_pointer_cast<ChMaterialSurfaceSMC>(mat2));
 
     InsertContact(cinfo, cmat);
 }
@@ -243,9 +246,9 @@ void ChContactContainerSMC::AddContact(const collision::ChCollisionInfo& cinfo)
     }
 
     // Create the composite material
-    ChMaterialCompositeSMC cmat(GetSystem()->composition_strategy.get(),
-                                std::static_pointer_cast<ChMaterialSurfaceSMC>(cinfo.shapeA->GetMaterial()),
-                                std::static_pointer_cast<ChMaterialSurfaceSMC>(cinfo.shapeB->GetMaterial()));
+    ChMaterialCompositeSMC cmat =
+        GetCompositeMaterial(std::static_pointer_cast<ChMaterialSurfaceSMC>(cinfo.shapeA->GetMaterial()),
+                             std::static_pointer_cast<ChMaterialSurfaceSMC>(cinfo.shapeB->GetMaterial()));
 
     // Check for a user-provided callback to modify the material
     if (GetAddContactCallback()) {
@@ -255,6 +258,18 @@ void ChContactContainerSMC::AddContact(const collision::ChCollisionInfo& cinfo)
     InsertContact(cinfo, cmat);
 }
 
+const ChMaterialCompositeSMC& ChContactContainerSMC::GetCompositeMaterial(
+    std::shared_ptr<ChMaterialSurfaceSMC> mat1,
+    std::shared_ptr<ChMaterialSurfaceSMC> mat2) {
+    auto key = std::make_pair((const void*)mat1.get(), (const void*)mat2.get());
+    auto cached = composite_cache.find(key);
+    if (cached != composite_cache.end())
+        return cached->second;
+
+    ChMaterialCompositeSMC cmat(GetSystem()->composition_strategy.get(), mat1, mat2);
+    return composite_cache.insert({key, cmat}).first->second;
+}
+
 void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeSMC& cmat) {
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
@@ -426,6 +441,31 @@ void ChContactContainerSMC::ReportAllContacts(std::shared_ptr<ReportContactCallb
     //***TODO*** rolling cont.
 }
 
+template <class Tcont>
+void _SnapshotContacts(std::list<Tcont*>& contactlist, ChContactContainer::ContactSnapshot& snapshot) {
+    for (auto contact : contactlist) {
+        snapshot.Append(contact->GetContactP1(), contact->GetContactP2(), contact->GetContactPlane(),
+                        contact->GetContactDistance(), contact->GetEffectiveCurvatureRadius(),
+                        contact->GetContactForce(), VNULL, contact->GetObjA(), contact->GetObjB());
+    }
+}
+
+void ChContactContainerSMC::SnapshotContacts(ContactSnapshot& snapshot) {
+    snapshot.Clear();
+    snapshot.Reserve(GetNcontacts());
+    _SnapshotContacts(contactlist_3_3, snapshot);
+    _SnapshotContacts(contactlist_6_3, snapshot);
+    _SnapshotContacts(contactlist_6_6, snapshot);
+    _SnapshotContacts(contactlist_333_3, snapshot);
+    _SnapshotContacts(contactlist_333_6, snapshot);
+    _SnapshotContacts(contactlist_333_333, snapshot);
+    _SnapshotContacts(contactlist_666_3, snapshot);
+    _SnapshotContacts(contactlist_666_6, snapshot);
+    _SnapshotContacts(contactlist_666_333, snapshot);
+    _SnapshotContacts(contactlist_666_666, snapshot);
+    LoadSnapshotUserData(snapshot);
+}
+
 // STATE INTERFACE
 
 template <class Tcont>
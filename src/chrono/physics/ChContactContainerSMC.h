@@ -18,6 +18,8 @@
 #include <algorithm>
 #include <cmath>
 #include <list>
+#include <unordered_map>
+#include <utility>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactSMC.h"
@@ -76,6 +78,25 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
+    /// Hasher for a pair of contact material addresses.
+    struct MaterialPairHash {
+        std::size_t operator()(const std::pair<const void*, const void*>& p) const {
+            std::size_t h = std::hash<const void*>()(p.first);
+            return h ^ (std::hash<const void*>()(p.second) + 0x9e3779b9 + (h << 6) + (h >> 2));
+        }
+    };
+
+    /// Cache of composite materials for the material pairs encountered in the current collision
+    /// batch, keyed by the material addresses (ordered, since a custom composition strategy need
+    /// not be symmetric). Cleared at BeginAddContact, so in-place material changes between steps
+    /// are picked up. Effective when many shapes share material instances (see ChMaterialRegistry).
+    std::unordered_map<std::pair<const void*, const void*>, ChMaterialCompositeSMC, MaterialPairHash> composite_cache;
+
+    /// Return the composite material for the given material pair, composing and caching it if this
+    /// pair was not seen yet in the current collision batch.
+    const ChMaterialCompositeSMC& GetCompositeMaterial(std::shared_ptr<ChMaterialSurfaceSMC> mat1,
+                                                       std::shared_ptr<ChMaterialSurfaceSMC> mat2);
+
   public:
     ChContactContainerSMC();
     ChContactContainerSMC(const ChContactContainerSMC& other);
@@ -119,6 +140,10 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     /// object.
     virtual void ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) override;
 
+    /// Fill a structure-of-arrays snapshot with all contacts in the container (replacing its current content).
+    /// Overrides the base implementation with a direct traversal of the contact lists (no virtual call per contact).
+    virtual void SnapshotContacts(ContactSnapshot& snapshot) override;
+
     /// Update state of this contact container: compute jacobians, violations, etc.
     /// and store results in inner structures of contacts.
     virtual void Update(double mtime, bool update_assets = true) override;
@@ -0,0 +1,77 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono/physics/ChContactSMC.h"
+
+namespace chrono {
+
+// Instantiate the ChSpecializedContactForceSMC variant matching the given runtime model selection,
+// resolving one template parameter per level.
+
+namespace {
+
+template <ChSystemSMC::ContactForceModel CFM,
+          ChSystemSMC::AdhesionForceModel AFM,
+          ChSystemSMC::TangentialDisplacementModel TDM>
+std::unique_ptr<ChSystemSMC::ChContactForceSMC> make_specialized(bool use_mat_props) {
+    if (use_mat_props)
+        return std::unique_ptr<ChSystemSMC::ChContactForceSMC>(new ChSpecializedContactForceSMC<CFM, AFM, TDM, true>());
+    return std::unique_ptr<ChSystemSMC::ChContactForceSMC>(new ChSpecializedContactForceSMC<CFM, AFM, TDM, false>());
+}
+
+template <ChSystemSMC::ContactForceModel CFM, ChSystemSMC::AdhesionForceModel AFM>
+std::unique_ptr<ChSystemSMC::ChContactForceSMC> make_specialized(ChSystemSMC::TangentialDisplacementModel tdispl_model,
+                                                                 bool use_mat_props) {
+    switch (tdispl_model) {
+        case ChSystemSMC::None:
+            return make_specialized<CFM, AFM, ChSystemSMC::None>(use_mat_props);
+        case ChSystemSMC::OneStep:
+            return make_specialized<CFM, AFM, ChSystemSMC::OneStep>(use_mat_props);
+        default:
+            return make_specialized<CFM, AFM, ChSystemSMC::MultiStep>(use_mat_props);
+    }
+}
+
+template <ChSystemSMC::ContactForceModel CFM>
+std::unique_ptr<ChSystemSMC::ChContactForceSMC> make_specialized(ChSystemSMC::AdhesionForceModel adhesion_model,
+                                                                 ChSystemSMC::TangentialDisplacementModel tdispl_model,
+                                                                 bool use_mat_props) {
+    switch (adhesion_model) {
+        case ChSystemSMC::AdhesionForceModel::DMT:
+            return make_specialized<CFM, ChSystemSMC::AdhesionForceModel::DMT>(tdispl_model, use_mat_props);
+        case ChSystemSMC::AdhesionForceModel::Perko:
+            return make_specialized<CFM, ChSystemSMC::AdhesionForceModel::Perko>(tdispl_model, use_mat_props);
+        default:
+            return make_specialized<CFM, ChSystemSMC::AdhesionForceModel::Constant>(tdispl_model, use_mat_props);
+    }
+}
+
+}  // end unnamed namespace
+
+std::unique_ptr<ChSystemSMC::ChContactForceSMC> MakeSpecializedContactForceSMC(const ChSystemSMC& sys) {
+    auto adhesion_model = sys.GetAdhesionForceModel();
+    auto tdispl_model = sys.GetTangentialDisplacementModel();
+    bool use_mat_props = sys.UsingMaterialProperties();
+
+    switch (sys.GetContactForceModel()) {
+        case ChSystemSMC::Hooke:
+            return make_specialized<ChSystemSMC::Hooke>(adhesion_model, tdispl_model, use_mat_props);
+        case ChSystemSMC::Hertz:
+            return make_specialized<ChSystemSMC::Hertz>(adhesion_model, tdispl_model, use_mat_props);
+        case ChSystemSMC::PlainCoulomb:
+            return make_specialized<ChSystemSMC::PlainCoulomb>(adhesion_model, tdispl_model, use_mat_props);
+        default:
+            return make_specialized<ChSystemSMC::Flores>(adhesion_model, tdispl_model, use_mat_props);
+    }
+}
+
+}  // end namespace chrono
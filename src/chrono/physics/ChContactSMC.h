@@ -221,6 +221,161 @@ class ChDefaultContactForceSMC : public ChSystemSMC::ChContactForceSMC {
     }
 };
 
+/// Specialized SMC force calculation, with the model combination fixed at compile time.
+/// Functionally identical to ChDefaultContactForceSMC, but the per-contact switches on the
+/// contact force, adhesion, and tangential displacement models (and on the use of material
+/// properties) are template parameters, so the compiler folds the branches away and can inline
+/// and vectorize the remaining straight-line kernel. Use MakeSpecializedContactForceSMC() to
+/// instantiate the variant matching the current system settings and install it with
+/// ChSystemSMC::SetContactForceAlgorithm(); the system settings are then baked in and later
+/// changes to them have no effect.
+template <ChSystemSMC::ContactForceModel CFM,
+          ChSystemSMC::AdhesionForceModel AFM,
+          ChSystemSMC::TangentialDisplacementModel TDM,
+          bool USE_MAT_PROPS>
+class ChSpecializedContactForceSMC : public ChSystemSMC::ChContactForceSMC {
+  public:
+    virtual ChVector<> CalculateForce(
+        const ChSystemSMC& sys,             ///< containing system
+        const ChVector<>& normal_dir,       ///< normal contact direction (expressed in global frame)
+        const ChVector<>& p1,               ///< most penetrated point on obj1 (expressed in global frame)
+        const ChVector<>& p2,               ///< most penetrated point on obj2 (expressed in global frame)
+        const ChVector<>& vel1,             ///< velocity of contact point on obj1 (expressed in global frame)
+        const ChVector<>& vel2,             ///< velocity of contact point on obj2 (expressed in global frame)
+        const ChMaterialCompositeSMC& mat,  ///< composite material for contact pair
+        double delta,                       ///< overlap in normal direction
+        double eff_radius,                  ///< effective radius of curvature at contact
+        double mass1,                       ///< mass of obj1
+        double mass2                        ///< mass of obj2
+        ) const override {
+        // Set contact force to zero if no penetration.
+        if (delta <= 0) {
+            return ChVector<>(0, 0, 0);
+        }
+
+        double dT = sys.GetStep();
+
+        // Relative velocity at contact
+        ChVector<> relvel = vel2 - vel1;
+        double relvel_n_mag = relvel.Dot(normal_dir);
+        ChVector<> relvel_n = relvel_n_mag * normal_dir;
+        ChVector<> relvel_t = relvel - relvel_n;
+        double relvel_t_mag = relvel_t.Length();
+
+        // Calculate effective mass
+        double eff_mass = mass1 * mass2 / (mass1 + mass2);
+
+        // Calculate stiffness and viscous damping coefficients (see ChDefaultContactForceSMC for
+        // the model formulas; the branches below are compile-time constants).
+        double kn = 0;
+        double kt = 0;
+        double gn = 0;
+        double gt = 0;
+
+        double eps = std::numeric_limits<double>::epsilon();
+
+        if (CFM == ChSystemSMC::Hooke || CFM == ChSystemSMC::Flores) {
+            if (USE_MAT_PROPS) {
+                double tmp_k = (16.0 / 15) * std::sqrt(eff_radius) * mat.E_eff;
+                double v2 = sys.GetCharacteristicImpactVelocity() * sys.GetCharacteristicImpactVelocity();
+                double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+                loge = (mat.cr_eff > 1 - eps) ? std::log(1 - eps) : loge;
+                double tmp_g = 1 + std::pow(CH_C_PI / loge, 2);
+                kn = tmp_k * std::pow(eff_mass * v2 / tmp_k, 1.0 / 5);
+                kt = kn;
+                gn = std::sqrt(4 * eff_mass * kn / tmp_g);
+                gt = gn;
+            } else {
+                kn = mat.kn;
+                kt = mat.kt;
+                gn = eff_mass * mat.gn;
+                gt = eff_mass * mat.gt;
+            }
+        } else if (CFM == ChSystemSMC::Hertz) {
+            if (USE_MAT_PROPS) {
+                double sqrt_Rd = std::sqrt(eff_radius * delta);
+                double Sn = 2 * mat.E_eff * sqrt_Rd;
+                double St = 8 * mat.G_eff * sqrt_Rd;
+                double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+                double beta = loge / std::sqrt(loge * loge + CH_C_PI * CH_C_PI);
+                kn = (2.0 / 3) * Sn;
+                kt = St;
+                gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
+                gt = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(St * eff_mass);
+            } else {
+                double tmp = eff_radius * std::sqrt(delta);
+                kn = tmp * mat.kn;
+                kt = tmp * mat.kt;
+                gn = tmp * eff_mass * mat.gn;
+                gt = tmp * eff_mass * mat.gt;
+            }
+        } else /* CFM == ChSystemSMC::PlainCoulomb */ {
+            if (USE_MAT_PROPS) {
+                double sqrt_Rd = std::sqrt(delta);
+                double Sn = 2 * mat.E_eff * sqrt_Rd;
+                double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+                double beta = loge / std::sqrt(loge * loge + CH_C_PI * CH_C_PI);
+                kn = (2.0 / 3) * Sn;
+                gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
+            } else {
+                double tmp = std::sqrt(delta);
+                kn = tmp * mat.kn;
+                gn = tmp * mat.gn;
+            }
+
+            double forceN = kn * delta - gn * relvel_n_mag;
+            if (forceN < 0)
+                forceN = 0;
+            double forceT = mat.mu_eff * std::tanh(5.0 * relvel_t_mag) * forceN;
+            if (AFM == ChSystemSMC::AdhesionForceModel::DMT)
+                forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
+            else  // Constant (and Perko, not implemented)
+                forceN -= mat.adhesion_eff;
+            ChVector<> force = forceN * normal_dir;
+            if (relvel_t_mag >= sys.GetSlipVelocityThreshold())
+                force -= (forceT / relvel_t_mag) * relvel_t;
+
+            return force;
+        }
+
+        // Tangential displacement (magnitude); OneStep and MultiStep currently coincide.
+        double delta_t = (TDM == ChSystemSMC::None) ? 0 : relvel_t_mag * dT;
+
+        // Calculate the magnitudes of the normal and tangential contact forces
+        double forceN = kn * delta - gn * relvel_n_mag;
+        double forceT = kt * delta_t + gt * relvel_t_mag;
+
+        // If the resulting normal contact force is negative, the two shapes are moving
+        // away from each other so fast that no contact force is generated.
+        if (forceN < 0) {
+            forceN = 0;
+            forceT = 0;
+        }
+
+        // Include adhesion force
+        if (AFM == ChSystemSMC::AdhesionForceModel::DMT)
+            forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
+        else  // Constant (and Perko, not implemented)
+            forceN -= mat.adhesion_eff;
+
+        // Coulomb law
+        forceT = std::min<double>(forceT, mat.mu_eff * std::abs(forceN));
+
+        // Accumulate normal and tangential forces
+        ChVector<> force = forceN * normal_dir;
+        if (relvel_t_mag >= sys.GetSlipVelocityThreshold())
+            force -= (forceT / relvel_t_mag) * relvel_t;
+
+        return force;
+    }
+};
+
+/// Create the specialized SMC force calculation object matching the current settings of the given
+/// system (contact force model, adhesion model, tangential displacement model, use of material
+/// properties). Install the result with ChSystemSMC::SetContactForceAlgorithm() to replace the
+/// per-contact runtime model dispatch of ChDefaultContactForceSMC with a monomorphic kernel.
+ChApi std::unique_ptr<ChSystemSMC::ChContactForceSMC> MakeSpecializedContactForceSMC(const ChSystemSMC& sys);
+
 /// Class for smooth (penalty-based) contact between two generic contactable objects.
 /// Ta and Tb are of ChContactable sub classes.
 template <class Ta, class Tb>
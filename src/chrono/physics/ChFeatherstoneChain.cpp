@@ -0,0 +1,217 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <cassert>
+#include <cmath>
+
+#include "chrono/physics/ChFeatherstoneChain.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+// -----------------------------------------------------------------------------
+// Spatial (6D) algebra helpers, with motion vectors ordered [omega; v] and
+// force vectors ordered [n; f], all expressed in link body frames.
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Motion-vector transform from parent body coordinates to child body coordinates,
+// given the pose of the child in the parent (rotation A, child origin r in parent coords).
+ChMatrixNM<double, 6, 6> SpatialTransform(const ChFrame<>& X_pc) {
+    const ChMatrix33<> E = X_pc.GetA().transpose();
+    const ChVector<>& r = X_pc.GetPos();
+    ChMatrix33<> rx(0);
+    rx(0, 1) = -r.z(), rx(0, 2) = r.y();
+    rx(1, 0) = r.z(), rx(1, 2) = -r.x();
+    rx(2, 0) = -r.y(), rx(2, 1) = r.x();
+    ChMatrixNM<double, 6, 6> X;
+    X.setZero();
+    X.block<3, 3>(0, 0) = E;
+    X.block<3, 3>(3, 3) = E;
+    X.block<3, 3>(3, 0) = -E * rx;
+    return X;
+}
+
+// Spatial cross product of a motion vector with a motion vector.
+ChVectorN<double, 6> CrossMotion(const ChVectorN<double, 6>& v, const ChVectorN<double, 6>& m) {
+    ChVector<> w(v(0), v(1), v(2)), vo(v(3), v(4), v(5));
+    ChVector<> mw(m(0), m(1), m(2)), mv(m(3), m(4), m(5));
+    ChVector<> rw = Vcross(w, mw);
+    ChVector<> rv = Vcross(w, mv) + Vcross(vo, mw);
+    ChVectorN<double, 6> res;
+    res << rw.x(), rw.y(), rw.z(), rv.x(), rv.y(), rv.z();
+    return res;
+}
+
+// Spatial cross product of a motion vector with a force vector.
+ChVectorN<double, 6> CrossForce(const ChVectorN<double, 6>& v, const ChVectorN<double, 6>& f) {
+    ChVector<> w(v(0), v(1), v(2)), vo(v(3), v(4), v(5));
+    ChVector<> n(f(0), f(1), f(2)), fo(f(3), f(4), f(5));
+    ChVector<> rn = Vcross(w, n) + Vcross(vo, fo);
+    ChVector<> rf = Vcross(w, fo);
+    ChVectorN<double, 6> res;
+    res << rn.x(), rn.y(), rn.z(), rf.x(), rf.y(), rf.z();
+    return res;
+}
+
+}  // end unnamed namespace
+
+// -----------------------------------------------------------------------------
+
+ChFeatherstoneChain::ChFeatherstoneChain() : m_use_contact_forces(true), m_initialized(false) {}
+
+int ChFeatherstoneChain::AddRevoluteJoint(std::shared_ptr<ChBody> body,
+                                          const ChFrame<>& joint_frame,
+                                          std::shared_ptr<ChLinkBase> bypassed_link) {
+    assert(!m_initialized);
+    Joint joint;
+    joint.body = body;
+    joint.bypassed = bypassed_link;
+    joint.X_pj = joint_frame;
+    m_joints.push_back(joint);
+    m_q.push_back(0);
+    m_qd.push_back(0);
+    m_qdd.push_back(0);
+    m_tau.push_back(0);
+    return (int)m_joints.size() - 1;
+}
+
+void ChFeatherstoneChain::Initialize() {
+    assert(m_base);
+    assert(!m_joints.empty());
+
+    ChFrame<> W_parent(m_base->GetCoord());
+    for (auto& joint : m_joints) {
+        ChFrame<> W_child(joint.body->GetCoord());
+
+        // Capture the current configuration as the joint zero position.
+        joint.X_jc = (W_parent * joint.X_pj).GetInverse() * W_child;
+
+        // Joint motion subspace in child body coordinates: rotation about the joint Z axis,
+        // which passes through the joint origin.
+        ChFrame<> X_cj = joint.X_jc.GetInverse();
+        ChVector<> axis = X_cj.GetA() * ChVector<>(0, 0, 1);
+        ChVector<> moment = Vcross(X_cj.GetPos(), axis);
+        joint.S << axis.x(), axis.y(), axis.z(), moment.x(), moment.y(), moment.z();
+
+        // Spatial inertia in body coordinates (the ChBody frame is the centroidal frame).
+        joint.I.setZero();
+        joint.I.block<3, 3>(0, 0) = joint.body->GetInertia();
+        joint.I.block<3, 3>(3, 3) = joint.body->GetMass() * ChMatrix33<>(1);
+
+        // Hand the body over to the reduced-coordinate sweep: the maximal-coordinate solver
+        // must no longer integrate it, and the bypassed constraint must no longer act.
+        joint.body->SetBodyFixed(true);
+        if (joint.bypassed)
+            joint.bypassed->SetDisabled(true);
+
+        W_parent = W_child;
+    }
+
+    m_initialized = true;
+}
+
+void ChFeatherstoneChain::Advance(double step) {
+    assert(m_initialized);
+    const int n = (int)m_joints.size();
+
+    std::vector<ChMatrixNM<double, 6, 6>> X(n), IA(n);
+    std::vector<ChVectorN<double, 6>> v(n), c(n), pA(n), U(n), a(n);
+    std::vector<double> D(n), u(n);
+    std::vector<ChFrame<>> W(n);
+
+    const ChFrame<> W_base(m_base->GetCoord());
+
+    // Spatial velocity of the base, in base coordinates.
+    ChVectorN<double, 6> v_base;
+    {
+        ChVector<> w = m_base->GetWvel_loc();
+        ChVector<> vo = W_base.GetA().transpose() * m_base->GetPos_dt();
+        v_base << w.x(), w.y(), w.z(), vo.x(), vo.y(), vo.z();
+    }
+
+    // Outward pass: kinematics, velocities, bias terms.
+    for (int i = 0; i < n; i++) {
+        const Joint& joint = m_joints[i];
+
+        ChFrame<> X_pc = joint.X_pj * ChFrame<>(VNULL, Q_from_AngZ(m_q[i])) * joint.X_jc;
+        W[i] = (i == 0 ? W_base : W[i - 1]) * X_pc;
+        X[i] = SpatialTransform(X_pc);
+
+        ChVectorN<double, 6> vJ = joint.S * m_qd[i];
+        v[i] = X[i] * (i == 0 ? v_base : v[i - 1]) + vJ;
+        c[i] = CrossMotion(v[i], vJ);
+
+        IA[i] = joint.I;
+        pA[i] = CrossForce(v[i], joint.I * v[i]);
+
+        if (m_use_contact_forces) {
+            // Contact resultants are reported in the global frame, with the torque about the COM.
+            ChVector<> f_loc = W[i].GetA().transpose() * joint.body->GetContactForce();
+            ChVector<> n_loc = W[i].GetA().transpose() * joint.body->GetContactTorque();
+            ChVectorN<double, 6> f_ext;
+            f_ext << n_loc.x(), n_loc.y(), n_loc.z(), f_loc.x(), f_loc.y(), f_loc.z();
+            pA[i] -= f_ext;
+        }
+    }
+
+    // Inward pass: articulated-body inertias and bias forces.
+    for (int i = n - 1; i >= 0; i--) {
+        const Joint& joint = m_joints[i];
+        U[i] = IA[i] * joint.S;
+        D[i] = joint.S.dot(U[i]);
+        u[i] = m_tau[i] - joint.S.dot(pA[i]);
+        if (i > 0) {
+            ChMatrixNM<double, 6, 6> Ia = IA[i] - (U[i] * U[i].transpose()) / D[i];
+            ChVectorN<double, 6> pa = pA[i] + Ia * c[i] + U[i] * (u[i] / D[i]);
+            IA[i - 1] += X[i].transpose() * Ia * X[i];
+            pA[i - 1] += X[i].transpose() * pa;
+        }
+    }
+
+    // Outward pass: accelerations. Gravity enters through the standard trick of giving the base
+    // a fictitious acceleration equal to -g, so no per-link gravity forces are needed.
+    ChVectorN<double, 6> a_base;
+    {
+        ChVector<> g_loc = W_base.GetA().transpose() * m_base->GetSystem()->Get_G_acc();
+        a_base << 0, 0, 0, -g_loc.x(), -g_loc.y(), -g_loc.z();
+    }
+    for (int i = 0; i < n; i++) {
+        a[i] = X[i] * (i == 0 ? a_base : a[i - 1]) + c[i];
+        m_qdd[i] = (u[i] - U[i].dot(a[i])) / D[i];
+        a[i] += m_joints[i].S * m_qdd[i];
+    }
+
+    // Semi-implicit Euler integration of the joint coordinates.
+    for (int i = 0; i < n; i++) {
+        m_qd[i] += step * m_qdd[i];
+        m_q[i] += step * m_qd[i];
+    }
+
+    // Write the updated configuration and velocities back to the chain bodies.
+    for (int i = 0; i < n; i++) {
+        const Joint& joint = m_joints[i];
+
+        ChFrame<> X_pc = joint.X_pj * ChFrame<>(VNULL, Q_from_AngZ(m_q[i])) * joint.X_jc;
+        W[i] = (i == 0 ? W_base : W[i - 1]) * X_pc;
+        X[i] = SpatialTransform(X_pc);
+        v[i] = X[i] * (i == 0 ? v_base : v[i - 1]) + joint.S * m_qd[i];
+
+        joint.body->SetPos(W[i].GetPos());
+        joint.body->SetRot(W[i].GetRot());
+        joint.body->SetWvel_loc(ChVector<>(v[i](0), v[i](1), v[i](2)));
+        joint.body->SetPos_dt(W[i].GetA() * ChVector<>(v[i](3), v[i](4), v[i](5)));
+    }
+}
+
+}  // end namespace chrono
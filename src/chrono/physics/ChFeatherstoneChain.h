@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_FEATHERSTONE_CHAIN_H
+#define CH_FEATHERSTONE_CHAIN_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChFrame.h"
+#include "chrono/core/ChMatrix.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChLinkBase.h"
+
+namespace chrono {
+
+/// Reduced-coordinate evaluation of an open-loop chain of rigid bodies connected by revolute joints.
+///
+/// Long serial chains (e.g. manipulator arms) built from maximal-coordinate joints spend most of the
+/// solver effort on constraint stabilization. This utility integrates such a subtree in its joint
+/// coordinates using the articulated-body algorithm (Featherstone), which is O(n) in the number of
+/// joints and drift-free by construction.
+///
+/// The chain bodies remain in their ChSystem for collision detection and visualization: they are
+/// marked as fixed (so the maximal-coordinate solver skips them) and the bypassed joint constraints
+/// are disabled, while this object overwrites their positions and velocities after each call to
+/// Advance(). Contact interoperation at the subtree boundary is one-way with a one-step lag: the
+/// resultant contact forces computed by the system on each chain body during the last step are
+/// applied as external forces in the articulated-body sweep.
+///
+/// Usage, interleaved with the regular simulation loop:
+/// <pre>
+///     chain.Initialize();
+///     while (...) {
+///         chain.SetJointTorque(i, tau);   // actuation, e.g. from a controller or RL policy
+///         sys.DoStepDynamics(h);          // free bodies, collision, contacts
+///         chain.Advance(h);               // reduced-coordinate update of the chain bodies
+///     }
+/// </pre>
+class ChApi ChFeatherstoneChain {
+  public:
+    ChFeatherstoneChain();
+
+    /// Set the base body of the chain (treated as kinematically fixed during the chain sweep).
+    void SetBaseBody(std::shared_ptr<ChBody> base) { m_base = base; }
+
+    /// Append a revolute joint and its child body to the chain.
+    /// The joint frame is expressed in the coordinates of the parent body (the base for the first
+    /// joint, the previously added body otherwise) and its Z axis is the rotation axis. The current
+    /// relative configuration of the bodies is taken as the joint zero position at Initialize().
+    /// If the chain was previously modeled with a maximal-coordinate link, pass it as \a bypassed_link
+    /// so that it can be disabled when the chain is initialized. Returns the joint index.
+    int AddRevoluteJoint(std::shared_ptr<ChBody> body,                       ///< child body of the new joint
+                         const ChFrame<>& joint_frame,                       ///< joint frame, in parent body coordinates
+                         std::shared_ptr<ChLinkBase> bypassed_link = nullptr  ///< optional link to disable
+    );
+
+    /// Capture the reference configuration, fix the chain bodies, and disable any bypassed links.
+    /// Call after all joints have been added and the bodies are in their initial configuration.
+    void Initialize();
+
+    /// Enable/disable feed-through of system contact forces on the chain bodies (default: true).
+    /// When enabled, the resultant contact force and torque reported by each chain body are applied
+    /// as external loads in the next articulated-body sweep.
+    void SetUseContactForces(bool val) { m_use_contact_forces = val; }
+
+    /// Set the actuation torque applied at the specified joint.
+    void SetJointTorque(int i, double torque) { m_tau[i] = torque; }
+
+    /// Set the position (angle) of the specified joint, relative to the configuration captured at
+    /// Initialize(). The chain bodies are updated at the next call to Advance(). Together with
+    /// SetJointVel(), this allows cheap state resets (e.g. between rollout episodes).
+    void SetJointPos(int i, double pos) { m_q[i] = pos; }
+
+    /// Set the velocity of the specified joint.
+    void SetJointVel(int i, double vel) { m_qd[i] = vel; }
+
+    /// Get the current position (angle) of the specified joint.
+    double GetJointPos(int i) const { return m_q[i]; }
+
+    /// Get the current velocity of the specified joint.
+    double GetJointVel(int i) const { return m_qd[i]; }
+
+    /// Get the joint acceleration computed in the last call to Advance().
+    double GetJointAcc(int i) const { return m_qdd[i]; }
+
+    /// Get the number of joints in the chain.
+    int GetNumJoints() const { return (int)m_joints.size(); }
+
+    /// Advance the chain state by one step of the specified length.
+    /// Runs the articulated-body forward dynamics, integrates the joint coordinates with the
+    /// semi-implicit Euler scheme (matching the default ChSystem integrator), and writes the
+    /// resulting body positions and velocities back to the chain bodies.
+    void Advance(double step);
+
+  private:
+    /// Description of one revolute joint and its child body.
+    struct Joint {
+        std::shared_ptr<ChBody> body;            ///< child body (its frame is the link frame)
+        std::shared_ptr<ChLinkBase> bypassed;    ///< maximal-coordinate link replaced by this joint
+        ChFrame<> X_pj;                          ///< joint frame in parent body coordinates
+        ChFrame<> X_jc;                          ///< child body frame in joint coordinates (at q=0)
+        ChVectorN<double, 6> S;                  ///< joint motion subspace, in child body coordinates
+        ChMatrixNM<double, 6, 6> I;              ///< spatial inertia of the child, in body coordinates
+    };
+
+    std::shared_ptr<ChBody> m_base;  ///< base body of the chain
+    std::vector<Joint> m_joints;     ///< chain joints, in order from the base
+    std::vector<double> m_q;         ///< joint positions
+    std::vector<double> m_qd;        ///< joint velocities
+    std::vector<double> m_qdd;       ///< joint accelerations (from last sweep)
+    std::vector<double> m_tau;       ///< joint actuation torques
+    bool m_use_contact_forces;       ///< feed system contact forces into the sweep?
+    bool m_initialized;              ///< Initialize() called?
+};
+
+}  // end namespace chrono
+
+#endif
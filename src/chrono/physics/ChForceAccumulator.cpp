@@ -0,0 +1,85 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono/physics/ChForceAccumulator.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChForceAccumulator)
+
+ChForceAccumulator::ChForceAccumulator(const ChForceAccumulator& other) : ChPhysicsItem(other) {
+    m_bodies = other.m_bodies;
+    m_forces = other.m_forces;
+    m_torques = other.m_torques;
+}
+
+unsigned int ChForceAccumulator::AddBody(std::shared_ptr<ChBody> body) {
+    m_bodies.push_back(body);
+    m_forces.push_back(VNULL);
+    m_torques.push_back(VNULL);
+    return (unsigned int)m_bodies.size() - 1;
+}
+
+void ChForceAccumulator::SetForce(unsigned int index, const ChVector<>& force, const ChVector<>& appl_point, bool local) {
+    ChVector<> absforce;
+    ChVector<> abstorque;
+    m_bodies[index]->To_abs_forcetorque(force, appl_point, local, absforce, abstorque);
+
+    m_forces[index] = absforce;
+    m_torques[index] = abstorque;
+}
+
+void ChForceAccumulator::Reset() {
+    std::fill(m_forces.begin(), m_forces.end(), VNULL);
+    std::fill(m_torques.begin(), m_torques.end(), VNULL);
+}
+
+void ChForceAccumulator::IntLoadResidual_F(const unsigned int off,  // offset in R residual
+                                           ChVectorDynamic<>& R,    // result: the R residual, R += c*F
+                                           const double c           // a scaling factor
+) {
+    // Scatter the buffered loads into the residual at the offsets of the body variables.
+    // Note that the torque rows of a body residual are expressed in the body local frame.
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        const auto& body = m_bodies[i];
+        if (!body->Variables().IsActive())
+            continue;
+        unsigned int boff = body->GetOffset_w();
+        R.segment(boff, 3) += c * m_forces[i].eigen();
+        R.segment(boff + 3, 3) += c * body->Dir_World2Body(m_torques[i]).eigen();
+    }
+}
+
+void ChForceAccumulator::ArchiveOut(ChArchiveOut& marchive) {
+    // version number
+    marchive.VersionWrite<ChForceAccumulator>();
+    // serialize parent class
+    ChPhysicsItem::ArchiveOut(marchive);
+    // serialize all member data:
+    marchive << CHNVP(m_bodies);
+    marchive << CHNVP(m_forces);
+    marchive << CHNVP(m_torques);
+}
+
+void ChForceAccumulator::ArchiveIn(ChArchiveIn& marchive) {
+    // version number
+    /*int version =*/ marchive.VersionRead<ChForceAccumulator>();
+    // deserialize parent class
+    ChPhysicsItem::ArchiveIn(marchive);
+    // stream in all member data:
+    marchive >> CHNVP(m_bodies);
+    marchive >> CHNVP(m_forces);
+    marchive >> CHNVP(m_torques);
+}
+
+}  // end namespace chrono
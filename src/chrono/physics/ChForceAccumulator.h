@@ -0,0 +1,98 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHFORCEACCUMULATOR_H
+#define CHFORCEACCUMULATOR_H
+
+#include <vector>
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChPhysicsItem.h"
+
+namespace chrono {
+
+/// Bulk force/torque accumulator for large sets of rigid bodies.
+/// This physics item maintains structure-of-arrays force and torque buffers, one entry per registered body, and
+/// applies all of them in a single pass during residual assembly. It is intended for distributed load fields
+/// (e.g. aerodynamic or fluid drag models) acting on thousands of bodies, where creating one ChForce object per
+/// body would add allocation and per-object virtual update overhead.
+/// Register each body once with AddBody(), then overwrite the corresponding buffer entries before each step
+/// (the buffers can be filled in parallel). Forces are expressed in the absolute frame and assumed applied at the
+/// body COM; torques are expressed in the absolute frame. Buffer entries are persistent: they are applied at
+/// every step until overwritten or cleared with Reset().
+/// The accumulator must be added to the same ChSystem as the registered bodies.
+class ChApi ChForceAccumulator : public ChPhysicsItem {
+  public:
+    ChForceAccumulator() {}
+    ChForceAccumulator(const ChForceAccumulator& other);
+    ~ChForceAccumulator() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChForceAccumulator* Clone() const override { return new ChForceAccumulator(*this); }
+
+    /// Register a body with this accumulator and return its slot index.
+    /// The force and torque entries for the new slot are initialized to zero.
+    unsigned int AddBody(std::shared_ptr<ChBody> body);
+
+    /// Return the number of registered bodies.
+    unsigned int GetNumBodies() const { return (unsigned int)m_bodies.size(); }
+
+    /// Set the force applied to the body in the specified slot.
+    /// The force is assumed expressed in the absolute frame and applied at the body COM.
+    void SetForce(unsigned int index, const ChVector<>& force) { m_forces[index] = force; }
+
+    /// Set the force applied to the body in the specified slot, acting at the given point.
+    /// The resulting torque about the body COM is added to the torque entry of the slot.
+    void SetForce(unsigned int index,
+                  const ChVector<>& force,       ///< applied force
+                  const ChVector<>& appl_point,  ///< application point
+                  bool local                     ///< force and point expressed in body local frame?
+    );
+
+    /// Set the torque applied to the body in the specified slot (expressed in the absolute frame).
+    void SetTorque(unsigned int index, const ChVector<>& torque) { m_torques[index] = torque; }
+
+    /// Zero all force and torque entries (registered bodies are unaffected).
+    void Reset();
+
+    /// Direct access to the force buffer (one absolute force per registered body, applied at COM).
+    std::vector<ChVector<>>& GetForces() { return m_forces; }
+
+    /// Direct access to the torque buffer (one absolute torque per registered body).
+    std::vector<ChVector<>>& GetTorques() { return m_torques; }
+
+    virtual void Setup() override {}
+
+    virtual void IntLoadResidual_F(const unsigned int off,  ///< offset in R residual
+                                   ChVectorDynamic<>& R,    ///< result: the R residual, R += c*F
+                                   const double c           ///< a scaling factor
+                                   ) override;
+
+    // SERIALIZATION
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& marchive) override;
+
+    /// Method to allow deserialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& marchive) override;
+
+  private:
+    std::vector<std::shared_ptr<ChBody>> m_bodies;  ///< registered bodies
+    std::vector<ChVector<>> m_forces;               ///< applied forces (absolute frame, at COM)
+    std::vector<ChVector<>> m_torques;              ///< applied torques (absolute frame)
+};
+
+CH_CLASS_VERSION(ChForceAccumulator, 0)
+
+}  // end namespace chrono
+
+#endif
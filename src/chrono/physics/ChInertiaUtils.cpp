@@ -0,0 +1,175 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChInertiaUtils.h"
+
+namespace chrono {
+
+void ChInertiaUtils::VoxelInertia(const geometry::ChTriangleMeshConnected& mesh,
+                                  int resolution,
+                                  double density,
+                                  double& mass,
+                                  ChVector<>& com,
+                                  ChMatrix33<>& inertia) {
+    mass = 0;
+    com = VNULL;
+    inertia.setZero();
+
+    const auto& vertices = mesh.m_vertices;
+    const auto& faces = mesh.m_face_v_indices;
+    if (vertices.empty() || faces.empty() || resolution < 1)
+        return;
+
+    // Mesh bounding box and voxel grid dimensions.
+    ChVector<> bbmin = vertices[0];
+    ChVector<> bbmax = vertices[0];
+    for (const auto& v : vertices) {
+        bbmin = ChVector<>(std::min(bbmin.x(), v.x()), std::min(bbmin.y(), v.y()), std::min(bbmin.z(), v.z()));
+        bbmax = ChVector<>(std::max(bbmax.x(), v.x()), std::max(bbmax.y(), v.y()), std::max(bbmax.z(), v.z()));
+    }
+    ChVector<> ext = bbmax - bbmin;
+    double h = ChMax(ChMax(ext.x(), ext.y()), ext.z()) / resolution;
+    if (h <= 0)
+        return;
+    int dims[3];
+    for (int a = 0; a < 3; a++)
+        dims[a] = std::max(1, (int)std::ceil(ext[a] / h));
+
+    // Interior votes per voxel: each of the three axis-aligned parity sweeps votes for the voxels
+    // it classifies as interior; a voxel is accepted with at least two votes, which tolerates
+    // holes and duplicated patches seen along a single direction.
+    std::vector<unsigned char> votes((size_t)dims[0] * dims[1] * dims[2], 0);
+    auto voxel = [&](int ix, int iy, int iz) -> unsigned char& {
+        return votes[((size_t)ix * dims[1] + iy) * dims[2] + iz];
+    };
+
+    for (int axis = 0; axis < 3; axis++) {
+        int ua = (axis + 1) % 3;  // first in-plane axis
+        int va = (axis + 2) % 3;  // second in-plane axis
+
+        // Bin triangles by the 2D grid cells their projection overlaps, so that each column only
+        // tests its local candidates.
+        std::vector<std::vector<int>> bins((size_t)dims[ua] * dims[va]);
+        for (int it = 0; it < (int)faces.size(); it++) {
+            const ChVector<>& p0 = vertices[faces[it].x()];
+            const ChVector<>& p1 = vertices[faces[it].y()];
+            const ChVector<>& p2 = vertices[faces[it].z()];
+            double umin = std::min(p0[ua], std::min(p1[ua], p2[ua])) - bbmin[ua];
+            double umax = std::max(p0[ua], std::max(p1[ua], p2[ua])) - bbmin[ua];
+            double vmin = std::min(p0[va], std::min(p1[va], p2[va])) - bbmin[va];
+            double vmax = std::max(p0[va], std::max(p1[va], p2[va])) - bbmin[va];
+            int iu0 = std::max(0, (int)(umin / h));
+            int iu1 = std::min(dims[ua] - 1, (int)(umax / h));
+            int iv0 = std::max(0, (int)(vmin / h));
+            int iv1 = std::min(dims[va] - 1, (int)(vmax / h));
+            for (int iu = iu0; iu <= iu1; iu++)
+                for (int iv = iv0; iv <= iv1; iv++)
+                    bins[(size_t)iu * dims[va] + iv].push_back(it);
+        }
+
+        // Parity sweep: for each column, collect the crossings of the column center ray with the
+        // mesh and mark the voxels between successive crossing pairs. Columns are independent, so
+        // the sweep is parallelized over them.
+#pragma omp parallel for schedule(dynamic, 8)
+        for (int iu = 0; iu < dims[ua]; iu++) {
+            std::vector<double> crossings;
+            for (int iv = 0; iv < dims[va]; iv++) {
+                double cu = bbmin[ua] + (iu + 0.5) * h;
+                double cv = bbmin[va] + (iv + 0.5) * h;
+                crossings.clear();
+                for (int it : bins[(size_t)iu * dims[va] + iv]) {
+                    const ChVector<>& p0 = vertices[faces[it].x()];
+                    const ChVector<>& p1 = vertices[faces[it].y()];
+                    const ChVector<>& p2 = vertices[faces[it].z()];
+                    // 2D point-in-triangle test in the projection plane, via signed edge areas.
+                    double d0u = p1[ua] - p0[ua], d0v = p1[va] - p0[va];
+                    double d1u = p2[ua] - p0[ua], d1v = p2[va] - p0[va];
+                    double det = d0u * d1v - d0v * d1u;
+                    if (std::abs(det) < 1e-30)
+                        continue;
+                    double lu = cu - p0[ua], lv = cv - p0[va];
+                    double w1 = (lu * d1v - lv * d1u) / det;
+                    double w2 = (d0u * lv - d0v * lu) / det;
+                    if (w1 < 0 || w2 < 0 || w1 + w2 > 1)
+                        continue;
+                    crossings.push_back((1 - w1 - w2) * p0[axis] + w1 * p1[axis] + w2 * p2[axis]);
+                }
+                if (crossings.size() < 2)
+                    continue;
+                std::sort(crossings.begin(), crossings.end());
+                // An odd crossing count indicates a hole along this ray; drop the unpaired entry.
+                for (size_t k = 0; k + 1 < crossings.size(); k += 2) {
+                    int k0 = (int)std::ceil((crossings[k] - bbmin[axis]) / h - 0.5);
+                    int k1 = (int)std::floor((crossings[k + 1] - bbmin[axis]) / h - 0.5);
+                    for (int kk = std::max(0, k0); kk <= std::min(dims[axis] - 1, k1); kk++) {
+                        int idx[3];
+                        idx[axis] = kk;
+                        idx[ua] = iu;
+                        idx[va] = iv;
+                        voxel(idx[0], idx[1], idx[2])++;
+                    }
+                }
+            }
+        }
+    }
+
+    // Accumulate mass properties of the accepted voxels (uniform solid cubes).
+    double m_vox = density * h * h * h;
+    double sum_m = 0;
+    ChVector<> sum_mc(0);
+    double sxx = 0, syy = 0, szz = 0, sxy = 0, sxz = 0, syz = 0;
+#pragma omp parallel for reduction(+ : sum_m, sxx, syy, szz, sxy, sxz, syz) schedule(static)
+    for (int ix = 0; ix < dims[0]; ix++) {
+        ChVector<> local_mc(0);
+        for (int iy = 0; iy < dims[1]; iy++) {
+            for (int iz = 0; iz < dims[2]; iz++) {
+                if (voxel(ix, iy, iz) < 2)
+                    continue;
+                double cx = bbmin.x() + (ix + 0.5) * h;
+                double cy = bbmin.y() + (iy + 0.5) * h;
+                double cz = bbmin.z() + (iz + 0.5) * h;
+                sum_m += m_vox;
+                local_mc += m_vox * ChVector<>(cx, cy, cz);
+                sxx += m_vox * cx * cx;
+                syy += m_vox * cy * cy;
+                szz += m_vox * cz * cz;
+                sxy += m_vox * cx * cy;
+                sxz += m_vox * cx * cz;
+                syz += m_vox * cy * cz;
+            }
+        }
+#pragma omp critical(ChInertiaUtils_voxel_inertia)
+        sum_mc += local_mc;
+    }
+
+    if (sum_m <= 0)
+        return;
+
+    mass = sum_m;
+    com = sum_mc / sum_m;
+
+    // Inertia about the COM, with the cube self-inertia of each voxel added on the diagonal.
+    double self = sum_m * h * h / 6.0;
+    inertia(0, 0) = (syy - sum_m * com.y() * com.y()) + (szz - sum_m * com.z() * com.z()) + self;
+    inertia(1, 1) = (sxx - sum_m * com.x() * com.x()) + (szz - sum_m * com.z() * com.z()) + self;
+    inertia(2, 2) = (sxx - sum_m * com.x() * com.x()) + (syy - sum_m * com.y() * com.y()) + self;
+    inertia(0, 1) = inertia(1, 0) = -(sxy - sum_m * com.x() * com.y());
+    inertia(0, 2) = inertia(2, 0) = -(sxz - sum_m * com.x() * com.z());
+    inertia(1, 2) = inertia(2, 1) = -(syz - sum_m * com.y() * com.z());
+}
+
+}  // end namespace chrono
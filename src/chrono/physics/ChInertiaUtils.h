@@ -25,11 +25,29 @@
 
 namespace chrono {
 
+namespace geometry {
+class ChTriangleMeshConnected;
+}
+
 /// Class with some static functions that can be used to make
 /// computations with inertia tensors
 
-class ChInertiaUtils {
+class ChApi ChInertiaUtils {
   public:
+    /// Compute mass properties of a triangle mesh by voxelization of its interior.
+    /// Unlike the divergence-theorem integration in ChTriangleMeshConnected::ComputeMassProperties
+    /// (which should be preferred for clean watertight meshes), this is robust for scanned or
+    /// otherwise imperfect meshes: the interior is classified by parity ray casting along all three
+    /// axes with majority voting, so holes and duplicated patches only perturb the result locally.
+    /// The grid resolution is the number of voxels along the largest extent of the mesh bounding
+    /// box; the voxel sweep is parallelized over grid columns.
+    static void VoxelInertia(const geometry::ChTriangleMeshConnected& mesh,  ///< input mesh (any orientation/quality)
+                             int resolution,                                 ///< voxels along largest AABB extent
+                             double density,                                 ///< material density
+                             double& mass,                                   ///< output: total mass
+                             ChVector<>& com,                                ///< output: center of mass
+                             ChMatrix33<>& inertia                           ///< output: inertia tensor about the COM
+    );
     /// Given a cluster of bodies, each with local inertia tensor, and position and rotation respect
     /// to absolute coordinates, compute the total mass, the barycenter and
     /// the inertia tensor of the cluster.
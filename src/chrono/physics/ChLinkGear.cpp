@@ -30,7 +30,8 @@ ChLinkGear::ChLinkGear()
       a2(0),
       r1(0),
       r2(0),
-      contact_pt(VNULL) {
+      contact_pt(VNULL),
+      mesh_cache_dirty(true) {
     local_shaft1.SetIdentity();
     local_shaft2.SetIdentity();
 
@@ -53,6 +54,26 @@ ChLinkGear::ChLinkGear(const ChLinkGear& other) : ChLinkLock(other) {
     contact_pt = other.contact_pt;
     local_shaft1 = other.local_shaft1;
     local_shaft2 = other.local_shaft2;
+    mesh_cache_dirty = true;
+}
+
+void ChLinkGear::UpdateMeshCache() {
+    ChVector<> vrota(0, beta, 0);
+    rot_beta.Set_A_Rxyz(vrota);
+
+    vrota = ChVector<>(0, 0, alpha);
+    rot_alpha_pos.Set_A_Rxyz(vrota);
+    vrota = ChVector<>(0, 0, -alpha);
+    rot_alpha_neg.Set_A_Rxyz(vrota);
+
+    mesh_cache_dirty = false;
+}
+
+void ChLinkGear::UpdateTimeBatch(const std::vector<std::shared_ptr<ChLinkGear>>& gears, double mytime) {
+#pragma omp parallel for
+    for (int i = 0; i < (signed)gears.size(); i++) {
+        gears[i]->UpdateTime(mytime);
+    }
 }
 
 ChVector<> ChLinkGear::Get_shaft_dir1() const {
@@ -107,13 +128,23 @@ void ChLinkGear::UpdateTime(double mytime) {
     ChVector<> vrota;
     Coordsys newmarkpos;
 
+    // refresh the cached mesh rotations if the pressure/helix angles changed
+    if (mesh_cache_dirty)
+        UpdateMeshCache();
+
     ChFrame<double> abs_shaft1;
     ChFrame<double> abs_shaft2;
 
     ((ChFrame<double>*)Body1)->TransformLocalToParent(local_shaft1, abs_shaft1);
     ((ChFrame<double>*)Body2)->TransformLocalToParent(local_shaft2, abs_shaft2);
 
-    ChVector<> vbdist = Vsub(Get_shaft_pos1(), Get_shaft_pos2());
+    // shaft positions and directions in absolute frame (same as Get_shaft_pos/dir, reusing the transforms above)
+    ChVector<> shaft_pos1 = abs_shaft1.GetPos();
+    ChVector<> shaft_pos2 = abs_shaft2.GetPos();
+    ChVector<> shaft_dir1 = abs_shaft1.GetA().Get_A_Zaxis();
+    ChVector<> shaft_dir2 = abs_shaft2.GetA().Get_A_Zaxis();
+
+    ChVector<> vbdist = Vsub(shaft_pos1, shaft_pos2);
     ////ChVector<> Trad1 = Vnorm(Vcross(Get_shaft_dir1(), Vnorm(Vcross(Get_shaft_dir1(), vbdist))));
     ////ChVector<> Trad2 = Vnorm(Vcross(Vnorm(Vcross(Get_shaft_dir2(), vbdist)), Get_shaft_dir2()));
 
@@ -152,43 +183,27 @@ void ChLinkGear::UpdateTime(double mytime) {
 
     // compute new markers coordsystem alignment
     my = Vnorm(vbdist);
-    mz = Get_shaft_dir1();
+    mz = shaft_dir1;
     mx = Vnorm(Vcross(my, mz));
     mr = Vnorm(Vcross(mz, mx));
     mz = Vnorm(Vcross(mx, my));
     ChVector<> mz2, mx2, mr2, my2;
     my2 = my;
-    mz2 = Get_shaft_dir2();
+    mz2 = shaft_dir2;
     mx2 = Vnorm(Vcross(my2, mz2));
     mr2 = Vnorm(Vcross(mz2, mx2));
 
     ChMatrix33<> ma1(mx, my, mz);
 
-    // rotate csys because of beta
-    vrota.x() = 0.0;
-    vrota.y() = beta;
-    vrota.z() = 0.0;
-    ChMatrix33<> mrotma;
-    mrotma.Set_A_Rxyz(vrota);
-    ChMatrix33<> marot_beta = ma1 * mrotma;
-    // rotate csys because of alpha
-    vrota.x() = 0.0;
-    vrota.y() = 0.0;
-    vrota.z() = alpha;
-    if (react_force.x() < 0)
-        vrota.z() = alpha;
-    else
-        vrota.z() = -alpha;
-    mrotma.Set_A_Rxyz(vrota);
-    ma1 = marot_beta * mrotma;
+    // rotate csys because of beta, then because of alpha (sign given by the action line side),
+    // using the cached mesh rotations
+    ma1 = (ma1 * rot_beta) * (react_force.x() < 0 ? rot_alpha_pos : rot_alpha_neg);
 
     ChMatrix33<> ma2 = ma1;
 
     // is a bevel gear?
-    double be = acos(Vdot(Get_shaft_dir1(), Get_shaft_dir2()));
-    bool is_bevel = true;
-    if (fabs(Vdot(Get_shaft_dir1(), Get_shaft_dir2())) > 0.96)
-        is_bevel = false;
+    double shaft_dot = Vdot(shaft_dir1, shaft_dir2);
+    bool is_bevel = fabs(shaft_dot) <= 0.96;
 
     // compute wheel radii so that:
     //            w2 = - tau * w1
@@ -202,13 +217,14 @@ void ChLinkGear::UpdateTime(double mytime) {
         }
         r1 = r2 * tau;
     } else {
+        double be = acos(shaft_dot);
         double gamma2;
         if (!epicyclic) {
             gamma2 = be / (tau + 1.0);
         } else {
             gamma2 = be / (-tau + 1.0);
         }
-        double al = CH_C_PI - acos(Vdot(Get_shaft_dir2(), my));
+        double al = CH_C_PI - acos(Vdot(shaft_dir2, my));
         double te = CH_C_PI - al - be;
         double fd = sin(te) * (dist / sin(be));
         r2 = fd * tan(gamma2);
@@ -217,7 +233,7 @@ void ChLinkGear::UpdateTime(double mytime) {
 
     // compute markers positions, supposing they
     // stay on the ideal wheel contact point
-    mmark1 = Vadd(Get_shaft_pos2(), Vmul(mr2, r2));
+    mmark1 = Vadd(shaft_pos2, Vmul(mr2, r2));
     mmark2 = mmark1;
     contact_pt = mmark1;
 
@@ -232,20 +248,21 @@ void ChLinkGear::UpdateTime(double mytime) {
         if (m_delta > CH_C_PI)
             m_delta -= (CH_C_2PI);  // range -180..+180 is better than 0...360
         if (m_delta > (CH_C_PI / 4.0))
-            m_delta = (CH_C_PI / 4.0);  // phase correction only in +/- 45�
+            m_delta = (CH_C_PI / 4.0);  // phase correction only in +/- 45�
         if (m_delta < -(CH_C_PI / 4.0))
             m_delta = -(CH_C_PI / 4.0);
 
         vrota.x() = vrota.y() = 0.0;
         vrota.z() = -m_delta;
+        ChMatrix33<> mrotma;
         mrotma.Set_A_Rxyz(vrota);  // rotate about Z of shaft to correct
-        mmark1 = abs_shaft1.GetA().transpose() * (mmark1 - Get_shaft_pos1());
+        mmark1 = abs_shaft1.GetA().transpose() * (mmark1 - shaft_pos1);
         mmark1 = mrotma * mmark1;
-        mmark1 = abs_shaft1.GetA() * mmark1 + Get_shaft_pos1();
+        mmark1 = abs_shaft1.GetA() * mmark1 + shaft_pos1;
     }
     // Move Shaft 1 along its direction if not aligned to wheel
-    double offset = Vdot(Get_shaft_dir1(), (contact_pt - Get_shaft_pos1()));
-    ChVector<> moff = Get_shaft_dir1() * offset;
+    double offset = Vdot(shaft_dir1, (contact_pt - shaft_pos1));
+    ChVector<> moff = shaft_dir1 * offset;
     if (fabs(offset) > 0.0001)
         local_shaft1.SetPos(local_shaft1.GetPos() + Body1->TransformDirectionParentToLocal(moff));
 
@@ -307,6 +324,8 @@ void ChLinkGear::ArchiveIn(ChArchiveIn& marchive) {
     marchive >> CHNVP(local_shaft1);
     marchive >> CHNVP(local_shaft2);
 
+    mesh_cache_dirty = true;
+
     mask.SetTwoBodiesVariables(&Body1->Variables(), &Body2->Variables());
     BuildLink();
 
@@ -15,6 +15,9 @@
 #ifndef CHLINKGEAR_H
 #define CHLINKGEAR_H
 
+#include <memory>
+#include <vector>
+
 #include "chrono/physics/ChLinkLock.h"
 
 namespace chrono {
@@ -44,6 +47,16 @@ class ChApi ChLinkGear : public ChLinkLock {
     ChFrame<double> local_shaft1;  ///< shaft1 pos & dir (as Z axis), relative to body1
     ChFrame<double> local_shaft2;  ///< shaft2 pos & dir (as Z axis), relative to body2
 
+    // Cached mesh geometry, function of the pressure and helix angles only. Rebuilt lazily in UpdateTime when the
+    // angle setters mark it dirty, instead of rebuilding the trigonometric rotation matrices at every step.
+    ChMatrix33<> rot_beta;       ///< helix rotation (about Y by beta)
+    ChMatrix33<> rot_alpha_pos;  ///< action-line rotation (about Z by +alpha)
+    ChMatrix33<> rot_alpha_neg;  ///< action-line rotation (about Z by -alpha)
+    bool mesh_cache_dirty;       ///< cached mesh rotations must be rebuilt?
+
+    /// Rebuild the cached mesh rotation matrices from the current alpha and beta angles.
+    void UpdateMeshCache();
+
   public:
     ChLinkGear();
     ChLinkGear(const ChLinkGear& other);
@@ -68,12 +81,18 @@ class ChApi ChLinkGear : public ChLinkLock {
     /// Get the pressure angle (usually 20?for typical gears)
     double Get_alpha() const { return alpha; }
     /// Set the pressure angle (usually 20?for typical gears)
-    void Set_alpha(double mset) { alpha = mset; }
+    void Set_alpha(double mset) {
+        alpha = mset;
+        mesh_cache_dirty = true;
+    }
 
     /// Get the angle of teeth in bevel gears (0?for spur gears)
     double Get_beta() const { return beta; }
     /// Set the angle of teeth in bevel gears (0?for spur gears)
-    void Set_beta(double mset) { beta = mset; }
+    void Set_beta(double mset) {
+        beta = mset;
+        mesh_cache_dirty = true;
+    }
 
     /// Get the initial phase of rotation of gear A respect to gear B
     double Get_phase() const { return phase; }
@@ -136,6 +155,11 @@ class ChApi ChLinkGear : public ChLinkLock {
     /// Get shaft position, for 2nd gear, in absolute reference
     ChVector<> Get_shaft_pos2() const;
 
+    /// Update a whole set of gear links in one parallel pass.
+    /// Convenience for powertrain models driven outside a full system update; within a system, gear links are
+    /// already updated in the parallel link sweep of the containing assembly.
+    static void UpdateTimeBatch(const std::vector<std::shared_ptr<ChLinkGear>>& gears, double mytime);
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& marchive) override;
 
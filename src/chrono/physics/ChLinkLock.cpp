@@ -247,10 +247,11 @@ void ChLinkLock::SetUpMarkers(ChMarker* mark1, ChMarker* mark2) {
 }
 
 void ChLinkLock::BuildLink() {
-    // set ndoc by counting non-dofs
-    ndoc = mask.GetMaskDoc();
-    ndoc_c = mask.GetMaskDoc_c();
-    ndoc_d = mask.GetMaskDoc_d();
+    // refresh the mask active-set cache and set ndoc by counting non-dofs
+    mask.RebuildActiveSet();
+    ndoc = mask.GetActiveDoc();
+    ndoc_c = mask.GetActiveDoc_c();
+    ndoc_d = mask.GetActiveDoc_d();
 
     // create matrices
     C.resize(ndoc);
@@ -356,6 +357,14 @@ void ChLinkLock::ChangeLinkType(LinkType new_link_type) {
 void ChLinkLock::Update(double time, bool update_assets) {
     UpdateTime(time);
     UpdateRelMarkerCoords();
+
+    // In kinematics-only evaluation mode (e.g. pose replay), skip computation of the constraint Jacobians,
+    // reactions, and forces; only the relative marker coordinates have to be propagated.
+    if (system && system->GetKinematicsOnlyUpdate()) {
+        ChPhysicsItem::Update(ChTime, update_assets);
+        return;
+    }
+
     UpdateState();
     UpdateCqw();
     UpdateForces(time);
@@ -950,11 +959,9 @@ void ChLinkLock::IntLoadResidual_CqL(const unsigned int off_L,    // offset in L
                                      const double c)              // a scaling factor
 {
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            mask.Constr_N(i).MultiplyTandAdd(R, L(off_L + cnt) * c);
-            cnt++;
-        }
+    for (auto constr : mask.GetActiveConstraints()) {
+        constr->MultiplyTandAdd(R, L(off_L + cnt) * c);
+        cnt++;
     }
 
     int local_offset = this->GetDOC_c();
@@ -1028,17 +1035,15 @@ void ChLinkLock::IntLoadConstraint_C(const unsigned int off_L,  // offset in Qc
                                      double recovery_clamp)     // value for min/max clamping of c*C
 {
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            if (do_clamp) {
-                if (mask.Constr_N(i).IsUnilateral())
-                    Qc(off_L + cnt) += ChMax(c * C(cnt), -recovery_clamp);
-                else
-                    Qc(off_L + cnt) += ChMin(ChMax(c * C(cnt), -recovery_clamp), recovery_clamp);
-            } else
-                Qc(off_L + cnt) += c * C(cnt);
-            cnt++;
-        }
+    for (auto constr : mask.GetActiveConstraints()) {
+        if (do_clamp) {
+            if (constr->IsUnilateral())
+                Qc(off_L + cnt) += ChMax(c * C(cnt), -recovery_clamp);
+            else
+                Qc(off_L + cnt) += ChMin(ChMax(c * C(cnt), -recovery_clamp), recovery_clamp);
+        } else
+            Qc(off_L + cnt) += c * C(cnt);
+        cnt++;
     }
 
     if (!do_clamp)
@@ -1112,12 +1117,8 @@ void ChLinkLock::IntLoadConstraint_Ct(const unsigned int off_L,  // offset in Qc
                                       ChVectorDynamic<>& Qc,     // result: the Qc residual, Qc += c*Ct
                                       const double c)            // a scaling factor
 {
-    int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            Qc(off_L + cnt) += c * Ct(cnt);
-            cnt++;
-        }
+    for (int cnt = 0; cnt < mask.GetActiveDoc(); cnt++) {
+        Qc(off_L + cnt) += c * Ct(cnt);
     }
 
     // nothing to do for ChLinkLimit
@@ -1130,12 +1131,10 @@ void ChLinkLock::IntToDescriptor(const unsigned int off_v,
                                  const ChVectorDynamic<>& L,
                                  const ChVectorDynamic<>& Qc) {
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            mask.Constr_N(i).Set_l_i(L(off_L + cnt));
-            mask.Constr_N(i).Set_b_i(Qc(off_L + cnt));
-            cnt++;
-        }
+    for (auto constr : mask.GetActiveConstraints()) {
+        constr->Set_l_i(L(off_L + cnt));
+        constr->Set_b_i(Qc(off_L + cnt));
+        cnt++;
     }
 
     int local_offset = this->GetDOC_c();
@@ -1219,11 +1218,9 @@ void ChLinkLock::IntFromDescriptor(const unsigned int off_v,
                                    const unsigned int off_L,
                                    ChVectorDynamic<>& L) {
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            L(off_L + cnt) = mask.Constr_N(i).Get_l_i();
-            cnt++;
-        }
+    for (auto constr : mask.GetActiveConstraints()) {
+        L(off_L + cnt) = constr->Get_l_i();
+        cnt++;
     }
 
     int local_offset = this->GetDOC_c();
@@ -1294,10 +1291,8 @@ void ChLinkLock::InjectConstraints(ChSystemDescriptor& mdescriptor) {
     if (!this->IsActive())
         return;
 
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive())
-            mdescriptor.InsertConstraint(&mask.Constr_N(i));
-    }
+    for (auto constr : mask.GetActiveConstraints())
+        mdescriptor.InsertConstraint(constr);
 
     if (limit_X && limit_X->IsActive()) {
         if (limit_X->constr_lower.IsActive()) {
@@ -1418,19 +1413,16 @@ void ChLinkLock::ConstraintsBiReset() {
 
 void ChLinkLock::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool do_clamp) {
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            if (do_clamp) {
-                if (mask.Constr_N(i).IsUnilateral())
-                    mask.Constr_N(i).Set_b_i(mask.Constr_N(i).Get_b_i() + ChMax(factor * C(cnt), -recovery_clamp));
-                else
-                    mask.Constr_N(i).Set_b_i(mask.Constr_N(i).Get_b_i() +
-                                             ChMin(ChMax(factor * C(cnt), -recovery_clamp), recovery_clamp));
-            } else
-                mask.Constr_N(i).Set_b_i(mask.Constr_N(i).Get_b_i() + factor * C(cnt));
+    for (auto constr : mask.GetActiveConstraints()) {
+        if (do_clamp) {
+            if (constr->IsUnilateral())
+                constr->Set_b_i(constr->Get_b_i() + ChMax(factor * C(cnt), -recovery_clamp));
+            else
+                constr->Set_b_i(constr->Get_b_i() + ChMin(ChMax(factor * C(cnt), -recovery_clamp), recovery_clamp));
+        } else
+            constr->Set_b_i(constr->Get_b_i() + factor * C(cnt));
 
-            cnt++;
-        }
+        cnt++;
     }
 
     if (limit_X && limit_X->IsActive()) {
@@ -1563,21 +1555,17 @@ void ChLinkLock::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool
 
 void ChLinkLock::ConstraintsBiLoad_Ct(double factor) {
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            mask.Constr_N(i).Set_b_i(mask.Constr_N(i).Get_b_i() + factor * Ct(cnt));
-            cnt++;
-        }
+    for (auto constr : mask.GetActiveConstraints()) {
+        constr->Set_b_i(constr->Get_b_i() + factor * Ct(cnt));
+        cnt++;
     }
 }
 
 void ChLinkLock::ConstraintsBiLoad_Qc(double factor) {
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            mask.Constr_N(i).Set_b_i(mask.Constr_N(i).Get_b_i() + factor * Qc(cnt));
-            cnt++;
-        }
+    for (auto constr : mask.GetActiveConstraints()) {
+        constr->Set_b_i(constr->Get_b_i() + factor * Qc(cnt));
+        cnt++;
     }
 }
 
@@ -1602,15 +1590,13 @@ void ChLinkLock::ConstraintsLoadJacobians() {
         return;
 
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            mask.Constr_N(i).Get_Cq_a().block(0, 0, 1, Cqw1.cols()) = Cqw1.block(cnt, 0, 1, Cqw1.cols());
-            mask.Constr_N(i).Get_Cq_b().block(0, 0, 1, Cqw2.cols()) = Cqw2.block(cnt, 0, 1, Cqw2.cols());
-            cnt++;
+    for (auto constr : mask.GetActiveConstraints()) {
+        constr->Get_Cq_a().block(0, 0, 1, Cqw1.cols()) = Cqw1.block(cnt, 0, 1, Cqw1.cols());
+        constr->Get_Cq_b().block(0, 0, 1, Cqw2.cols()) = Cqw2.block(cnt, 0, 1, Cqw2.cols());
+        cnt++;
 
-            // sets also the CFM term
-            // mask->Constr_N(i).Set_cfm_i(this->attractor);
-        }
+        // sets also the CFM term
+        // constr->Set_cfm_i(this->attractor);
     }
 
     ChGlMatrix34<> Gl1(Body1->GetCoord().rot);
@@ -1708,11 +1694,9 @@ void ChLinkLock::ConstraintsFetch_react(double factor) {
 
     // From constraints to react vector:
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            react(cnt) = mask.Constr_N(i).Get_l_i() * factor;
-            cnt++;
-        }
+    for (auto constr : mask.GetActiveConstraints()) {
+        react(cnt) = constr->Get_l_i() * factor;
+        cnt++;
     }
 
     // Translational constraint reaction force = -lambda_translational
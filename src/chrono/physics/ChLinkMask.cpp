@@ -19,22 +19,24 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChLinkMask)
 
-ChLinkMask::ChLinkMask() : nconstr(0) {}
+ChLinkMask::ChLinkMask() : active_doc_d(0), nconstr(0) {}
 
-ChLinkMask::ChLinkMask(int mnconstr) {
+ChLinkMask::ChLinkMask(int mnconstr) : active_doc_d(0) {
     nconstr = mnconstr;
     constraints.resize(nconstr);
     for (int i = 0; i < nconstr; i++) {
         constraints[i] = new ChConstraintTwoBodies;
     }
+    RebuildActiveSet();
 }
 
-ChLinkMask::ChLinkMask(const ChLinkMask& other) {
+ChLinkMask::ChLinkMask(const ChLinkMask& other) : active_doc_d(0) {
     nconstr = other.nconstr;
     constraints.resize(other.nconstr);
     for (int i = 0; i < nconstr; i++) {
         constraints[i] = other.constraints[i]->Clone();
     }
+    RebuildActiveSet();
 }
 
 ChLinkMask::~ChLinkMask() {
@@ -54,6 +56,7 @@ ChLinkMask& ChLinkMask::operator=(const ChLinkMask& other) {
     for (int i = 0; i < nconstr; i++) {
         constraints[i] = other.constraints[i]->Clone();
     }
+    RebuildActiveSet();
 
     return *this;
 }
@@ -73,17 +76,21 @@ void ChLinkMask::ResetNconstr(int newnconstr) {
         for (int i = 0; i < nconstr; i++) {
             constraints[i] = new ChConstraintTwoBodies;
         }
+
+        RebuildActiveSet();
     }
 }
 
 void ChLinkMask::AddConstraint(ChConstraintTwoBodies* aconstr) {
     nconstr++;
     constraints.push_back(aconstr);
+    RebuildActiveSet();
 }
 
 void ChLinkMask::SetTwoBodiesVariables(ChVariables* var1, ChVariables* var2) {
     for (int i = 0; i < nconstr; i++)
         constraints[i]->SetVariables(var1, var2);
+    RebuildActiveSet();
 }
 
 bool ChLinkMask::IsEqual(ChLinkMask& mask2) {
@@ -118,6 +125,18 @@ int ChLinkMask::GetMaskDoc_c() {
     return (GetMaskDoc() - GetMaskDoc_d());
 }
 
+void ChLinkMask::RebuildActiveSet() {
+    active_constraints.clear();
+    active_doc_d = 0;
+    for (int i = 0; i < nconstr; i++) {
+        if (constraints[i]->IsActive()) {
+            active_constraints.push_back(constraints[i]);
+            if (constraints[i]->IsUnilateral())
+                active_doc_d++;
+        }
+    }
+}
+
 ChConstraintTwoBodies* ChLinkMask::GetActiveConstrByNum(int mnum) {
     int cnt = 0;
     for (int i = 0; i < nconstr; i++) {
@@ -150,6 +169,7 @@ int ChLinkMask::SetActiveRedundantByArray(int* mvector, int mcount) {
         delete constraints[i];
         constraints[i] = newmask.constraints[i]->Clone();
     }
+    RebuildActiveSet();
 
     return mcount;
 }
@@ -163,6 +183,8 @@ int ChLinkMask::RestoreRedundant() {
             tot++;
         }
     }
+    if (tot > 0)
+        RebuildActiveSet();
     return tot;
 }
 
@@ -175,6 +197,8 @@ int ChLinkMask::SetAllDisabled(bool mdis) {
             cnt++;
         }
     }
+    if (cnt > 0)
+        RebuildActiveSet();
 
     return cnt;
 }
@@ -188,6 +212,8 @@ int ChLinkMask::SetAllBroken(bool mdis) {
             cnt++;
         }
     }
+    if (cnt > 0)
+        RebuildActiveSet();
 
     return cnt;
 }
@@ -203,6 +229,8 @@ void ChLinkMask::ArchiveIn(ChArchiveIn& marchive) {
 
     marchive >> CHNVP(constraints);
 
+    nconstr = (int)constraints.size();
+    RebuildActiveSet();
 }
 
 // -----------------------------------------------------------------------------
@@ -256,6 +284,8 @@ void ChLinkMaskLF::SetLockMask(bool x, bool y, bool z, bool e0, bool e1, bool e2
         Constr_E3().SetMode(CONSTRAINT_LOCK);
     else
         Constr_E3().SetMode(CONSTRAINT_FREE);
+
+    RebuildActiveSet();
 }
 
 void ChLinkMaskLF::ArchiveOut(ChArchiveOut& marchive) {
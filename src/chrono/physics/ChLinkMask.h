@@ -28,6 +28,11 @@ class ChApi ChLinkMask {
   protected:
     std::vector<ChConstraintTwoBodies*> constraints;  ///< array of pointers to 'n' scalar constraints
 
+    // Cached active set, rebuilt by RebuildActiveSet() whenever the mask changes, so that solver-facing loops can
+    // iterate the active constraints directly instead of testing IsActive() on every constraint at every call.
+    std::vector<ChConstraintTwoBodies*> active_constraints;  ///< pointers to the active constraints, in mask order
+    int active_doc_d;                                        ///< number of active unilateral constraints
+
   public:
     int nconstr;  ///< number of scalar constraint equations.
 
@@ -80,6 +85,25 @@ class ChApi ChLinkMask {
     /// Get the i-th active scalar constraint (not active constr. won't be considered)
     ChConstraintTwoBodies* GetActiveConstrByNum(int mnum);
 
+    /// Rebuild the cached active-set index of the mask.
+    /// All mask-level mutators call this automatically; it must be called manually only after toggling the
+    /// activation of individual constraints accessed through Constr_N() (links do so in their BuildLink /
+    /// ChangedLinkMask re-setup, which is already mandatory after such changes).
+    void RebuildActiveSet();
+
+    /// Get the cached list of active constraints, in mask order.
+    /// Valid until the next mask change; see RebuildActiveSet().
+    const std::vector<ChConstraintTwoBodies*>& GetActiveConstraints() const { return active_constraints; }
+
+    /// Get the cached number of active constraints (bilateral and unilateral).
+    int GetActiveDoc() const { return (int)active_constraints.size(); }
+
+    /// Get the cached number of active bilateral constraints.
+    int GetActiveDoc_c() const { return (int)active_constraints.size() - active_doc_d; }
+
+    /// Get the cached number of active unilateral constraints.
+    int GetActiveDoc_d() const { return active_doc_d; }
+
     /// Sets some active constraints as redundant.
     int SetActiveRedundantByArray(int* mvector, int mcount);
 
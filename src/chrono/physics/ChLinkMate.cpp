@@ -107,9 +107,10 @@ void ChLinkMateGeneric::SetupLinkMask() {
 }
 
 void ChLinkMateGeneric::ChangedLinkMask() {
-    ndoc = mask.GetMaskDoc();
-    ndoc_c = mask.GetMaskDoc_c();
-    ndoc_d = mask.GetMaskDoc_d();
+    mask.RebuildActiveSet();
+    ndoc = mask.GetActiveDoc();
+    ndoc_c = mask.GetActiveDoc_c();
+    ndoc_d = mask.GetActiveDoc_d();
 }
 
 void ChLinkMateGeneric::SetDisabled(bool mdis) {
@@ -146,24 +147,36 @@ void ChLinkMateGeneric::Update(double mytime, bool update_assets) {
         F2_W.TransformParentToLocal(F1_W, F1_wrt_F2);
         // Now 'F1_wrt_F2' contains the position/rotation of frame 1 respect to frame 2, in frame 2 coords.
 
-        ChMatrix33<> Jx1 = F2_W.GetA().transpose();
-        ChMatrix33<> Jx2 = -F2_W.GetA().transpose();
+        // Only the Jacobian blocks selected by the mate mask are assembled: purely positional
+        // mates (e.g. spherical) skip the rotational blocks and vice versa, which saves several
+        // 3x3 products per link in models with many single-group mates.
+        bool has_pos = c_x || c_y || c_z;
+        bool has_rot = c_rx || c_ry || c_rz;
 
-        ChMatrix33<> Jr1 = -F2_W.GetA().transpose() * Body1->GetA() * ChStarMatrix33<>(frame1.GetPos());
-        ChVector<> r12_B2 = Body2->GetA().transpose() * (F1_W.GetPos() - F2_W.GetPos());
-        ChMatrix33<> Jr2 = this->frame2.GetA().transpose() * ChStarMatrix33<>(frame2.GetPos() + r12_B2);
+        ChMatrix33<> Jx1, Jx2, Jr1, Jr2, Jw1, Jw2;
 
-        // Premultiply by Jw1 and Jw2 by P = 0.5 * [Fp(q_resid^*)]'.bottomRow(3) to get residual as imaginary part of a
-        // quaternion. For small misalignment this effect is almost insignificant because P ~= [I33], but otherwise it
-        // is needed (if you want to use the stabilization term - if not, you can live without).
-        this->P = 0.5 * (ChMatrix33<>(F1_wrt_F2.GetRot().e0()) + ChStarMatrix33<>(F1_wrt_F2.GetRot().GetVector()));
+        if (has_pos) {
+            Jx1 = F2_W.GetA().transpose();
+            Jx2 = -F2_W.GetA().transpose();
 
-        ChMatrix33<> Jw1 = this->P.transpose() * F2_W.GetA().transpose() * Body1->GetA();
-        ChMatrix33<> Jw2 = -this->P.transpose() * F2_W.GetA().transpose() * Body2->GetA();
+            Jr1 = -F2_W.GetA().transpose() * Body1->GetA() * ChStarMatrix33<>(frame1.GetPos());
+            ChVector<> r12_B2 = Body2->GetA().transpose() * (F1_W.GetPos() - F2_W.GetPos());
+            Jr2 = this->frame2.GetA().transpose() * ChStarMatrix33<>(frame2.GetPos() + r12_B2);
+        }
+
+        if (has_rot) {
+            // Premultiply by Jw1 and Jw2 by P = 0.5 * [Fp(q_resid^*)]'.bottomRow(3) to get residual as imaginary part
+            // of a quaternion. For small misalignment this effect is almost insignificant because P ~= [I33], but
+            // otherwise it is needed (if you want to use the stabilization term - if not, you can live without).
+            this->P = 0.5 * (ChMatrix33<>(F1_wrt_F2.GetRot().e0()) + ChStarMatrix33<>(F1_wrt_F2.GetRot().GetVector()));
 
-        // Another equivalent expression:
-        // ChMatrix33<> Jw1 = this->P * F1_W.GetA().transpose() * Body1->GetA();
-        // ChMatrix33<> Jw2 = -this->P * F1_W.GetA().transpose() * Body2->GetA();
+            Jw1 = this->P.transpose() * F2_W.GetA().transpose() * Body1->GetA();
+            Jw2 = -this->P.transpose() * F2_W.GetA().transpose() * Body2->GetA();
+
+            // Another equivalent expression:
+            // ChMatrix33<> Jw1 = this->P * F1_W.GetA().transpose() * Body1->GetA();
+            // ChMatrix33<> Jw2 = -this->P * F1_W.GetA().transpose() * Body2->GetA();
+        }
 
         // The Jacobian matrix of constraint is:
         // Cq = [ Jx1,  Jr1,  Jx2,  Jr2 ]
@@ -491,11 +504,9 @@ void ChLinkMateGeneric::IntLoadResidual_CqL(const unsigned int off_L,
                                             const ChVectorDynamic<>& L,
                                             const double c) {
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            mask.Constr_N(i).MultiplyTandAdd(R, L(off_L + cnt) * c);
-            cnt++;
-        }
+    for (auto constr : mask.GetActiveConstraints()) {
+        constr->MultiplyTandAdd(R, L(off_L + cnt) * c);
+        cnt++;
     }
 }
 
@@ -505,17 +516,15 @@ void ChLinkMateGeneric::IntLoadConstraint_C(const unsigned int off_L,
                                             bool do_clamp,
                                             double recovery_clamp) {
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            if (do_clamp) {
-                if (mask.Constr_N(i).IsUnilateral())
-                    Qc(off_L + cnt) += ChMax(c * C(cnt), -recovery_clamp);
-                else
-                    Qc(off_L + cnt) += ChMin(ChMax(c * C(cnt), -recovery_clamp), recovery_clamp);
-            } else
-                Qc(off_L + cnt) += c * C(cnt);
-            cnt++;
-        }
+    for (auto constr : mask.GetActiveConstraints()) {
+        if (do_clamp) {
+            if (constr->IsUnilateral())
+                Qc(off_L + cnt) += ChMax(c * C(cnt), -recovery_clamp);
+            else
+                Qc(off_L + cnt) += ChMin(ChMax(c * C(cnt), -recovery_clamp), recovery_clamp);
+        } else
+            Qc(off_L + cnt) += c * C(cnt);
+        cnt++;
     }
 }
 
@@ -530,12 +539,10 @@ void ChLinkMateGeneric::IntToDescriptor(const unsigned int off_v,
                                         const ChVectorDynamic<>& L,
                                         const ChVectorDynamic<>& Qc) {
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            mask.Constr_N(i).Set_l_i(L(off_L + cnt));
-            mask.Constr_N(i).Set_b_i(Qc(off_L + cnt));
-            cnt++;
-        }
+    for (auto constr : mask.GetActiveConstraints()) {
+        constr->Set_l_i(L(off_L + cnt));
+        constr->Set_b_i(Qc(off_L + cnt));
+        cnt++;
     }
 }
 
@@ -544,11 +551,9 @@ void ChLinkMateGeneric::IntFromDescriptor(const unsigned int off_v,
                                           const unsigned int off_L,
                                           ChVectorDynamic<>& L) {
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            L(off_L + cnt) = mask.Constr_N(i).Get_l_i();
-            cnt++;
-        }
+    for (auto constr : mask.GetActiveConstraints()) {
+        L(off_L + cnt) = constr->Get_l_i();
+        cnt++;
     }
 }
 
@@ -558,10 +563,8 @@ void ChLinkMateGeneric::InjectConstraints(ChSystemDescriptor& mdescriptor) {
     if (!this->IsActive())
         return;
 
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive())
-            mdescriptor.InsertConstraint(&mask.Constr_N(i));
-    }
+    for (auto constr : mask.GetActiveConstraints())
+        mdescriptor.InsertConstraint(constr);
 }
 
 void ChLinkMateGeneric::ConstraintsBiReset() {
@@ -589,20 +592,16 @@ void ChLinkMateGeneric::ConstraintsBiLoad_C(double factor, double recovery_clamp
         GetLog()<< *this->C << "\n";
     */
     int cnt = 0;
-    for (int i = 0; i < mask.nconstr; i++) {
-        if (mask.Constr_N(i).IsActive()) {
-            if (do_clamp) {
-                if (mask.Constr_N(i).IsUnilateral())
-                    mask.Constr_N(i).Set_b_i(mask.Constr_N(i).Get_b_i() +
-                                              ChMax(factor * C(cnt), -recovery_clamp));
-                else
-                    mask.Constr_N(i).Set_b_i(mask.Constr_N(i).Get_b_i() +
-                                              ChMin(ChMax(factor * C(cnt), -recovery_clamp), recovery_clamp));
-            } else
-                mask.Constr_N(i).Set_b_i(mask.Constr_N(i).Get_b_i() + factor * C(cnt));
-
-            cnt++;
-        }
+    for (auto constr : mask.GetActiveConstraints()) {
+        if (do_clamp) {
+            if (constr->IsUnilateral())
+                constr->Set_b_i(constr->Get_b_i() + ChMax(factor * C(cnt), -recovery_clamp));
+            else
+                constr->Set_b_i(constr->Get_b_i() + ChMin(ChMax(factor * C(cnt), -recovery_clamp), recovery_clamp));
+        } else
+            constr->Set_b_i(constr->Get_b_i() + factor * C(cnt));
+
+        cnt++;
     }
 }
 
@@ -68,6 +68,15 @@ void ChMaterialSurface::ArchiveIn(ChArchiveIn& marchive) {
     marchive >> CHNVP(restitution);
 }
 
+bool ChMaterialSurface::SameProperties(const ChMaterialSurface& other) const {
+    return GetContactMethod() == other.GetContactMethod() &&        //
+           static_friction == other.static_friction &&              //
+           sliding_friction == other.sliding_friction &&            //
+           rolling_friction == other.rolling_friction &&            //
+           spinning_friction == other.spinning_friction &&          //
+           restitution == other.restitution;
+}
+
 std::shared_ptr<ChMaterialSurface> ChMaterialSurface::DefaultMaterial(ChContactMethod contact_method) {
     switch (contact_method) {
         case ChContactMethod::NSC:
@@ -116,4 +125,37 @@ std::shared_ptr<ChMaterialSurface> ChContactMaterialData::CreateMaterial(ChConta
     }
 }
 
+// -----------------------------------------------------------------------------
+
+size_t ChMaterialRegistry::Hash(const ChMaterialSurface& mat) {
+    // Hash only the properties common to all material types; candidates with equal hashes are
+    // compared through the virtual SameProperties, which also checks the type-specific properties.
+    size_t h = std::hash<int>()(static_cast<int>(mat.GetContactMethod()));
+    for (float v : {mat.static_friction, mat.sliding_friction, mat.rolling_friction, mat.spinning_friction,
+                    mat.restitution}) {
+        h ^= std::hash<float>()(v) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    }
+    return h;
+}
+
+std::shared_ptr<ChMaterialSurface> ChMaterialRegistry::Intern(std::shared_ptr<ChMaterialSurface> mat) {
+    if (!mat)
+        return mat;
+
+    size_t h = Hash(*mat);
+    auto range = m_materials.equal_range(h);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == mat || it->second->SameProperties(*mat))
+            return it->second;
+    }
+
+    m_materials.insert({h, mat});
+    return mat;
+}
+
+void ChMaterialRegistry::MakeUnique(std::shared_ptr<ChMaterialSurface>& mat) {
+    if (mat && mat.use_count() > 1)
+        mat = std::shared_ptr<ChMaterialSurface>(mat->Clone());
+}
+
 }  // end namespace chrono
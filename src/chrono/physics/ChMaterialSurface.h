@@ -16,6 +16,8 @@
 #define CH_MATERIAL_SURFACE_H
 
 #include <algorithm>
+#include <memory>
+#include <unordered_map>
 
 #include "chrono/core/ChClassFactory.h"
 #include "chrono/serialization/ChArchive.h"
@@ -65,6 +67,10 @@ class ChApi ChMaterialSurface {
     virtual void ArchiveOut(ChArchiveOut& marchive);
     virtual void ArchiveIn(ChArchiveIn& marchive);
 
+    /// Return true if the other material has the same type and identical properties.
+    /// Used by ChMaterialRegistry to collapse value-equal material instances.
+    virtual bool SameProperties(const ChMaterialSurface& other) const;
+
     /// Construct and return a contact material of the specified type with default properties.
     static std::shared_ptr<ChMaterialSurface> DefaultMaterial(ChContactMethod contact_method);
 
@@ -131,6 +137,35 @@ class ChApi ChMaterialCompositionStrategy {
 };
 
 
+/// Interning registry for contact materials.
+/// Collapses value-equal material instances to a single shared object, so that scenes with many
+/// bodies carrying identical materials hold one material per distinct property set instead of one
+/// per body. Registered materials are shared: a material obtained from Intern() must not be
+/// modified in place (that would affect every shape referencing it); use MakeUnique() to obtain a
+/// private copy before mutation.
+class ChApi ChMaterialRegistry {
+  public:
+    /// Return the registered material with the same type and properties as the given one,
+    /// registering the given material first if no equal instance exists yet.
+    std::shared_ptr<ChMaterialSurface> Intern(std::shared_ptr<ChMaterialSurface> mat);
+
+    /// Replace the given material with a private clone if it is referenced from elsewhere
+    /// (copy-on-write step for mutating a possibly interned material).
+    static void MakeUnique(std::shared_ptr<ChMaterialSurface>& mat);
+
+    /// Return the number of distinct materials currently registered.
+    size_t GetNumMaterials() const { return m_materials.size(); }
+
+    /// Discard all registered materials (shapes referencing them keep them alive).
+    void Clear() { m_materials.clear(); }
+
+  private:
+    /// Hash of the properties common to all material types (collisions resolved by SameProperties).
+    static size_t Hash(const ChMaterialSurface& mat);
+
+    std::unordered_multimap<size_t, std::shared_ptr<ChMaterialSurface>> m_materials;
+};
+
 typedef std::shared_ptr<ChMaterialSurface> ChMaterialSurfaceSharedPtr;
 
 }  // end namespace chrono
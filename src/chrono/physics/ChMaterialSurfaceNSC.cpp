@@ -74,6 +74,18 @@ void ChMaterialSurfaceNSC::ArchiveIn(ChArchiveIn& marchive) {
     marchive >> CHNVP(complianceSpin);
 }
 
+bool ChMaterialSurfaceNSC::SameProperties(const ChMaterialSurface& other) const {
+    if (!ChMaterialSurface::SameProperties(other))
+        return false;
+    auto& o = static_cast<const ChMaterialSurfaceNSC&>(other);
+    return cohesion == o.cohesion &&              //
+           dampingf == o.dampingf &&              //
+           compliance == o.compliance &&          //
+           complianceT == o.complianceT &&        //
+           complianceRoll == o.complianceRoll &&  //
+           complianceSpin == o.complianceSpin;
+}
+
 // -----------------------------------------------------------------------------
 
 ChMaterialCompositeNSC::ChMaterialCompositeNSC()
@@ -78,6 +78,9 @@ class ChApi ChMaterialSurfaceNSC : public ChMaterialSurface {
     /// Method to allow deserialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& marchive) override;
 
+    /// Return true if the other material has the same type and identical properties.
+    virtual bool SameProperties(const ChMaterialSurface& other) const override;
+
     float cohesion;
     float dampingf;
     float compliance;
@@ -87,6 +87,18 @@ void ChMaterialSurfaceSMC::ArchiveIn(ChArchiveIn& marchive) {
     marchive >> CHNVP(gt);
 }
 
+bool ChMaterialSurfaceSMC::SameProperties(const ChMaterialSurface& other) const {
+    if (!ChMaterialSurface::SameProperties(other))
+        return false;
+    auto& o = static_cast<const ChMaterialSurfaceSMC&>(other);
+    return young_modulus == o.young_modulus &&          //
+           poisson_ratio == o.poisson_ratio &&          //
+           constant_adhesion == o.constant_adhesion &&  //
+           adhesionMultDMT == o.adhesionMultDMT &&      //
+           adhesionSPerko == o.adhesionSPerko &&        //
+           kn == o.kn && kt == o.kt && gn == o.gn && gt == o.gt;
+}
+
 // -----------------------------------------------------------------------------
 
 ChMaterialCompositeSMC::ChMaterialCompositeSMC()
@@ -87,6 +87,9 @@ class ChApi ChMaterialSurfaceSMC : public ChMaterialSurface {
     /// Method to allow deserialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& marchive) override;
 
+    /// Return true if the other material has the same type and identical properties.
+    virtual bool SameProperties(const ChMaterialSurface& other) const override;
+
     float young_modulus;      ///< Young's modulus (elastic modulus)
     float poisson_ratio;      ///< Poisson ratio
     float constant_adhesion;  ///< Constant adhesion force, when constant adhesion model is used
@@ -25,6 +25,7 @@ ChPhysicsItem::ChPhysicsItem(const ChPhysicsItem& other) : ChObj(other) {
     offset_x = other.offset_x;
     offset_w = other.offset_w;
     offset_L = other.offset_L;
+    update_dirty = true;
 }
 
 ChPhysicsItem::~ChPhysicsItem() {
@@ -109,6 +110,8 @@ void ChPhysicsItem::Update(double mytime, bool update_assets) {
         if (vis_model_instance)
             vis_model_instance->Update(GetVisualModelFrame());
     }
+
+    update_dirty = false;
 }
 
 void ChPhysicsItem::ArchiveOut(ChArchiveOut& marchive) {
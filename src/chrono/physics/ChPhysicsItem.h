@@ -35,7 +35,7 @@ class ChModalAssembly;
 /// Such items (e.g., rigid bodies, joints, FEM meshes, etc.) can contain ChVariables or ChConstraints objects.
 class ChApi ChPhysicsItem : public ChObj {
   public:
-    ChPhysicsItem() : system(NULL), offset_x(0), offset_w(0), offset_L(0) {}
+    ChPhysicsItem() : system(NULL), offset_x(0), offset_w(0), offset_L(0), update_dirty(true) {}
     ChPhysicsItem(const ChPhysicsItem& other);
     virtual ~ChPhysicsItem();
 
@@ -160,6 +160,20 @@ class ChApi ChPhysicsItem : public ChObj {
     /// data. By default, calls Update(mytime) using item's current time.
     virtual void Update(bool update_assets = true) { Update(ChTime, update_assets); }
 
+    /// Mark this item as modified, so that its next Update() is performed even if the item would
+    /// otherwise be skippable (see CanSkipUpdate). User code that changes the state of an item
+    /// directly (e.g. repositioning a fixed body) while lazy updates are enabled on the containing
+    /// assembly must call this function. The flag is cleared by Update().
+    void ForceUpdate() { update_dirty = true; }
+
+    /// Return true if the next Update() of this item may be skipped, because neither its state nor
+    /// its inputs have changed since the last call. This base version is conservative and never
+    /// allows skipping. Derived classes may override it (e.g. a fixed or sleeping body with no
+    /// attached markers or forces); any override must honor the flag raised by ForceUpdate().
+    /// Skipping takes effect only if lazy updates are enabled on the containing assembly
+    /// (see ChAssembly::SetUseLazyUpdate).
+    virtual bool CanSkipUpdate() const { return false; }
+
     /// Set zero speed (and zero accelerations) in state, without changing the position.
     /// Child classes should implement this function if GetDOF() > 0.
     /// It is used by owner ChSystem for some static analysis.
@@ -438,6 +452,8 @@ class ChApi ChPhysicsItem : public ChObj {
     unsigned int offset_w;  ///< offset in vector of state (speed part)
     unsigned int offset_L;  ///< offset in vector of lagrangian multipliers
 
+    bool update_dirty;  ///< if raised, the next Update() cannot be skipped (see ForceUpdate)
+
   private:
     virtual void SetupInitial() {}
 
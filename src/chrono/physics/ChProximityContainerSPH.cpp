@@ -53,6 +53,9 @@ ChProximityContainerSPH::~ChProximityContainerSPH() {
 }
 
 void ChProximityContainerSPH::RemoveAllProximities() {
+    pair_nodeA.clear();
+    pair_nodeB.clear();
+
     std::list<ChProximitySPH*>::iterator iterproximity = proximitylist.begin();
     while (iterproximity != proximitylist.end()) {
         delete (*iterproximity);
@@ -69,6 +72,11 @@ void ChProximityContainerSPH::RemoveAllProximities() {
 void ChProximityContainerSPH::BeginAddProximities() {
     lastproximity = proximitylist.begin();
     n_added = 0;
+
+    // Rewind the flat pair arrays too; clear() keeps the capacity, so in steady state
+    // the refill performed by AddProximity() is allocation-free.
+    pair_nodeA.clear();
+    pair_nodeB.clear();
 }
 
 void ChProximityContainerSPH::EndAddProximities() {
@@ -94,6 +102,11 @@ void ChProximityContainerSPH::AddProximity(collision::ChCollisionModel* modA, co
         this->add_proximity_callback->OnAddProximity(*modA, *modB);
     }
 
+    // Mirror the pair into the flat node arrays (the casts above are done once per pair here,
+    // so the accumulation loops and user material models never need to repeat them).
+    pair_nodeA.push_back(mnA);
+    pair_nodeB.push_back(mnB);
+
     // %%%%%%% Create and add a ChProximitySPH object
 
     if (lastproximity != proximitylist.end()) {
@@ -146,11 +159,16 @@ static void W_gr_press(ChVector<>& Wresult, const ChVector<>& r, const double r_
 }
 
 void ChProximityContainerSPH::AccumulateStep1() {
-    // Per-edge data computation
-    std::list<ChProximitySPH*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        ChNodeSPH* mnodeA = dynamic_cast<ChNodeSPH*>((*iterproximity)->GetModelA()->GetContactable());
-        ChNodeSPH* mnodeB = dynamic_cast<ChNodeSPH*>((*iterproximity)->GetModelB()->GetContactable());
+    // Per-edge data computation, over the flat pair arrays (no list traversal, no casting).
+    // Both endpoints of each edge are incremented, so the parallel version guards the
+    // scalar density accumulations with atomic updates.
+    int nthreads = GetSystem() ? GetSystem()->GetNumThreadsChrono() : 1;
+    int npairs = (int)pair_nodeA.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < npairs; ip++) {
+        ChNodeSPH* mnodeA = pair_nodeA[ip];
+        ChNodeSPH* mnodeB = pair_nodeB[ip];
 
         ChVector<> x_A = mnodeA->GetPos();
         ChVector<> x_B = mnodeB->GetPos();
@@ -162,19 +180,35 @@ void ChProximityContainerSPH::AccumulateStep1() {
 
         // increment data of connected nodes
 
-        mnodeA->density += mnodeB->GetMass() * W_k_poly6;
-        mnodeB->density += mnodeA->GetMass() * W_k_poly6;
-
-        ++iterproximity;
+        double inc_A = mnodeB->GetMass() * W_k_poly6;
+        double inc_B = mnodeA->GetMass() * W_k_poly6;
+#pragma omp atomic
+        mnodeA->density += inc_A;
+#pragma omp atomic
+        mnodeB->density += inc_B;
     }
 }
 
+// Atomic accumulation of a vector increment into a node force, component by component;
+// used by the parallel per-edge loops where both endpoints of an edge are written.
+static void AtomicVectorAdd(ChVector<>& target, const ChVector<>& inc) {
+#pragma omp atomic
+    target.x() += inc.x();
+#pragma omp atomic
+    target.y() += inc.y();
+#pragma omp atomic
+    target.z() += inc.z();
+}
+
 void ChProximityContainerSPH::AccumulateStep2() {
-    // Per-edge data computation (transfer stress to forces)
-    std::list<ChProximitySPH*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        ChNodeSPH* mnodeA = dynamic_cast<ChNodeSPH*>((*iterproximity)->GetModelA()->GetContactable());
-        ChNodeSPH* mnodeB = dynamic_cast<ChNodeSPH*>((*iterproximity)->GetModelB()->GetContactable());
+    // Per-edge data computation (transfer stress to forces), over the flat pair arrays.
+    int nthreads = GetSystem() ? GetSystem()->GetNumThreadsChrono() : 1;
+    int npairs = (int)pair_nodeA.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < npairs; ip++) {
+        ChNodeSPH* mnodeA = pair_nodeA[ip];
+        ChNodeSPH* mnodeB = pair_nodeB[ip];
 
         ChVector<> x_A = mnodeA->GetPos();
         ChVector<> x_B = mnodeB->GetPos();
@@ -190,10 +224,10 @@ void ChProximityContainerSPH::AccumulateStep2() {
         double avg_press = 0.5 * (mnodeA->pressure + mnodeB->pressure);
 
         ChVector<> pressureForceA = W_k_press * mnodeA->volume * avg_press * mnodeB->volume;
-        mnodeA->UserForce += pressureForceA;
+        AtomicVectorAdd(mnodeA->UserForce, pressureForceA);
 
         // ChVector<> pressureForceB  = - W_k_press * mnodeB->volume * avg_dens * mnodeA->volume;
-        mnodeB->UserForce -= pressureForceA;
+        AtomicVectorAdd(mnodeB->UserForce, -pressureForceA);
 
         // increment viscous forces..
 
@@ -204,10 +238,8 @@ void ChProximityContainerSPH::AccumulateStep2() {
                                       mnodeB->GetContainer()->GetMaterial().Get_viscosity());
 
         ChVector<> viscforceBA = velBA * (mnodeA->volume * avg_viscosity * mnodeB->volume * W_k_visc);
-        mnodeA->UserForce += viscforceBA;
-        mnodeB->UserForce -= viscforceBA;
-
-        ++iterproximity;
+        AtomicVectorAdd(mnodeA->UserForce, viscforceBA);
+        AtomicVectorAdd(mnodeB->UserForce, -viscforceBA);
     }
 }
 
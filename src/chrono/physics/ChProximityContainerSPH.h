@@ -16,11 +16,14 @@
 #define CHPROXIMITYCONTAINERSPH_H
 
 #include <list>
+#include <vector>
 
 #include "chrono/physics/ChProximityContainer.h"
 
 namespace chrono {
 
+class ChNodeSPH;
+
 /// Class for a proximity pair information in a SPH cluster
 /// of particles - that is, an 'edge' topological connectivity in
 /// in a meshless FEA approach, like the Smoothed Particle Hydrodynamics.
@@ -67,6 +70,14 @@ class ChApi ChProximityContainerSPH : public ChProximityContainer {
     std::list<ChProximitySPH*>::iterator lastproximity;
     int n_added;
 
+    // Flat structure-of-arrays mirror of the pair list, rebuilt during each broadphase pass.
+    // The SPH nodes are resolved (dynamic_cast) once per pair at AddProximity() time, so the
+    // per-step accumulation loops and any user material model can walk plain indexed arrays
+    // instead of chasing the linked list and re-casting the contactables for every pair.
+    // The vectors keep their capacity across steps, so steady-state refills are allocation-free.
+    std::vector<ChNodeSPH*> pair_nodeA;
+    std::vector<ChNodeSPH*> pair_nodeB;
+
   public:
     ChProximityContainerSPH();
     ChProximityContainerSPH(const ChProximityContainerSPH& other);
@@ -102,6 +113,19 @@ class ChApi ChProximityContainerSPH : public ChProximityContainer {
     /// function of the provided callback object.
     virtual void ReportAllProximities(ReportProximityCallback* mcallback) override;
 
+    /// Access the flat array of first-node pointers, one entry per proximity pair.
+    /// Together with GetPairNodesB() this exposes the neighbor list as indexed
+    /// structure-of-arrays data: custom meshless material models can consume the pairs in plain
+    /// (optionally OpenMP-parallel) loops over [0, GetNproximities()), with no per-pair virtual
+    /// call and no contactable casting. The arrays are valid between EndAddProximities() and the
+    /// next BeginAddProximities(); a parallel consumer is responsible for making its own
+    /// node accumulations race-free (e.g. atomic increments or per-thread buffers).
+    const std::vector<ChNodeSPH*>& GetPairNodesA() const { return pair_nodeA; }
+
+    /// Access the flat array of second-node pointers, one entry per proximity pair.
+    /// See GetPairNodesA().
+    const std::vector<ChNodeSPH*>& GetPairNodesB() const { return pair_nodeB; }
+
     // Perform some SPH per-edge initializations and accumulations of values
     // into the connected pairs of particles (summation into particle's  J, Amoment, m_v, UserForce -viscous only- )
     // Will be called by the ChMatterSPH item.
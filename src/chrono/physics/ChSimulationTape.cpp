@@ -0,0 +1,87 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/physics/ChSimulationTape.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+ChSimulationTape::ChSimulationTape(ChSystem* system, int capacity)
+    : m_system(system),
+      m_count(0),
+      m_overflow(false),
+      m_record_M(false),
+      m_record_K(false),
+      m_record_R(false),
+      m_record_Cq(false) {
+    SetCapacity(capacity);
+}
+
+void ChSimulationTape::SetCapacity(int capacity) {
+    m_steps.resize(std::max(capacity, 1));
+    Reset();
+}
+
+void ChSimulationTape::EnableJacobianRecording(bool mass, bool constraint_jacobian, bool stiffness, bool damping) {
+    m_record_M = mass;
+    m_record_Cq = constraint_jacobian;
+    m_record_K = stiffness;
+    m_record_R = damping;
+}
+
+void ChSimulationTape::Reset() {
+    m_count = 0;
+    m_overflow = false;
+}
+
+void ChSimulationTape::Record() {
+    if (m_count >= GetCapacity()) {
+        m_overflow = true;
+        return;
+    }
+
+    StepRecord& rec = m_steps[m_count];
+
+    rec.step = m_system->GetStep();
+
+    // Resize record vectors only if the number of system coordinates changed
+    if (rec.x.size() != m_system->GetNcoords())
+        rec.x.setZero(m_system->GetNcoords(), m_system);
+    if (rec.v.size() != m_system->GetNcoords_w())
+        rec.v.setZero(m_system->GetNcoords_w(), m_system);
+    if (rec.a.size() != m_system->GetNcoords_w())
+        rec.a.setZero(m_system->GetNcoords_w(), m_system);
+    if (rec.L.size() != m_system->GetNconstr())
+        rec.L.setZero(m_system->GetNconstr());
+
+    m_system->StateGather(rec.x, rec.v, rec.time);
+    m_system->StateGatherAcceleration(rec.a);
+    m_system->StateGatherReactions(rec.L);
+
+    // Assemble the requested system matrices at the end-of-step configuration.
+    // The sparse matrices keep their allocated storage across tape resets; for a fixed system topology the
+    // assembly after the first recorded step does not allocate.
+    if (m_record_M)
+        m_system->GetMassMatrix(&rec.M);
+    if (m_record_K)
+        m_system->GetStiffnessMatrix(&rec.K);
+    if (m_record_R)
+        m_system->GetDampingMatrix(&rec.R);
+    if (m_record_Cq)
+        m_system->GetConstraintJacobianMatrix(&rec.Cq);
+
+    m_count++;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,98 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_SIMULATION_TAPE_H
+#define CH_SIMULATION_TAPE_H
+
+#include <vector>
+
+#include "chrono/core/ChMatrix.h"
+#include "chrono/timestepper/ChState.h"
+
+namespace chrono {
+
+class ChSystem;
+
+/// Per-step recording ("tape") of packed system states and system-level Jacobian matrices.
+///
+/// Gradient-based workloads (policy optimization, parameter identification) that differentiate through a simulation
+/// by finite differences must re-run the entire simulation once per perturbed input. An adjoint (reverse) pass over
+/// a recorded trajectory needs, at every step, the packed states and the linearization matrices of the dynamics --
+/// quantities Chrono already assembles for its own solver. This tape captures them as the simulation runs, so a
+/// backward pass can consume them directly instead of re-deriving (or re-factorizing) anything.
+///
+/// When attached to a ChSystem (see ChSystem::SetSimulationTape), a StepRecord is appended at the end of each
+/// DoStepDynamics with the packed position/velocity/acceleration states, the constraint reaction multipliers and,
+/// if enabled, the system-level M, K, R and Cq matrices evaluated at the end-of-step configuration. Recording stops
+/// (and the overflow flag is raised) when the preallocated capacity is exhausted; no samples are dropped, since an
+/// adjoint pass needs the uninterrupted trajectory. The records are owned by the tape and accessed in place through
+/// GetStep(), with no copies on the read side; matrix and vector storage in each record is reused across tape resets.
+class ChApi ChSimulationTape {
+  public:
+    /// Recorded data for one completed step.
+    struct StepRecord {
+        double time;          ///< system time at the end of the step
+        double step;          ///< step size used for this step
+        ChState x;            ///< packed position state
+        ChStateDelta v;       ///< packed velocity state
+        ChStateDelta a;       ///< packed acceleration state
+        ChVectorDynamic<> L;  ///< constraint reaction multipliers
+        ChSparseMatrix M;     ///< system mass matrix (empty unless enabled)
+        ChSparseMatrix K;     ///< system stiffness matrix -dF/dq (empty unless enabled)
+        ChSparseMatrix R;     ///< system damping matrix -dF/dv (empty unless enabled)
+        ChSparseMatrix Cq;    ///< system constraint Jacobian (empty unless enabled)
+    };
+
+    /// Construct a tape for the given system, with room for the specified number of steps.
+    ChSimulationTape(ChSystem* system, int capacity = 1024);
+
+    /// Set the tape capacity (number of recordable steps). This discards all recorded steps.
+    void SetCapacity(int capacity);
+
+    /// Get the tape capacity (number of recordable steps).
+    int GetCapacity() const { return (int)m_steps.size(); }
+
+    /// Select which system matrices are captured with each step (default: none).
+    /// Matrix assembly has a per-step cost proportional to the system size; enable only what the backward pass
+    /// actually consumes. For rigid multibody systems without stiff force elements, M and Cq suffice.
+    void EnableJacobianRecording(bool mass, bool constraint_jacobian, bool stiffness = false, bool damping = false);
+
+    /// Discard all recorded steps, keeping the allocated storage.
+    void Reset();
+
+    /// Get the number of recorded steps.
+    int GetNumSteps() const { return m_count; }
+
+    /// Return true if steps were skipped because the tape capacity was exhausted.
+    bool IsFull() const { return m_overflow; }
+
+    /// Access the i-th recorded step in place (0 = oldest).
+    const StepRecord& GetStep(int i) const { return m_steps[i]; }
+
+    /// Record the state (and enabled matrices) of the associated system as a new step.
+    /// Called automatically at the end of each step when the tape is attached to a system.
+    void Record();
+
+  private:
+    ChSystem* m_system;               ///< associated system
+    std::vector<StepRecord> m_steps;  ///< preallocated step records
+    int m_count;                      ///< number of recorded steps
+    bool m_overflow;                  ///< steps were dropped due to exhausted capacity
+    bool m_record_M;                  ///< capture the mass matrix
+    bool m_record_K;                  ///< capture the stiffness matrix
+    bool m_record_R;                  ///< capture the damping matrix
+    bool m_record_Cq;                 ///< capture the constraint Jacobian
+};
+
+}  // end namespace chrono
+
+#endif
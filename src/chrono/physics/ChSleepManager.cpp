@@ -0,0 +1,204 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/physics/ChSleepManager.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChLink.h"
+
+namespace chrono {
+
+ChSleepManager::ChSleepManager() : wake_distance(0.01), min_awake_time(0.5), next_region_id(0) {}
+
+int ChSleepManager::AddFrozenRegion(const ChVector<>& aabb_min, const ChVector<>& aabb_max) {
+    FrozenRegion region;
+    region.id = next_region_id++;
+    region.aabb_min = aabb_min;
+    region.aabb_max = aabb_max;
+    frozen_regions.push_back(region);
+    return region.id;
+}
+
+void ChSleepManager::RemoveFrozenRegion(int id) {
+    frozen_regions.erase(
+        std::remove_if(frozen_regions.begin(), frozen_regions.end(),
+                       [id](const FrozenRegion& region) { return region.id == id; }),
+        frozen_regions.end());
+}
+
+void ChSleepManager::ClearFrozenRegions() {
+    frozen_regions.clear();
+}
+
+bool ChSleepManager::IsFrozen(const ChVector<>& pos) const {
+    for (const auto& region : frozen_regions) {
+        if (pos.x() >= region.aabb_min.x() && pos.x() <= region.aabb_max.x() &&  //
+            pos.y() >= region.aabb_min.y() && pos.y() <= region.aabb_max.y() &&  //
+            pos.z() >= region.aabb_min.z() && pos.z() <= region.aabb_max.z())
+            return true;
+    }
+    return false;
+}
+
+// Reporter collecting the body-body pairs of all current contacts, used as island edges.
+class _island_edge_reporter : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        if (!(contactobjA && contactobjB))
+            return true;
+        ChBody* b1 = dynamic_cast<ChBody*>(contactobjA);
+        ChBody* b2 = dynamic_cast<ChBody*>(contactobjB);
+        if (b1 && b2)
+            pairs.push_back(std::make_pair(b1, b2));
+        return true;  // to continue scanning contacts
+    }
+
+    std::vector<std::pair<ChBody*, ChBody*>> pairs;
+};
+
+// Union-find root lookup with path halving.
+static int _island_find(std::vector<int>& parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+bool ChSleepManager::Update(ChSystem& system) {
+    const auto& bodylist = system.Get_bodylist();
+    double time = system.GetChTime();
+
+    // Index the non-fixed bodies for island building. Fixed bodies carry no edges: they would
+    // otherwise merge every island resting on the ground into a single one.
+    std::unordered_map<ChBody*, int> body_index;
+    std::vector<ChBody*> bodies;
+    bodies.reserve(bodylist.size());
+    for (const auto& body : bodylist) {
+        if (!body->GetBodyFixed()) {
+            body_index[body.get()] = (int)bodies.size();
+            bodies.push_back(body.get());
+        }
+    }
+    int nb = (int)bodies.size();
+
+    std::vector<int> parent(nb);
+    for (int i = 0; i < nb; i++)
+        parent[i] = i;
+
+    // Merge islands along the current contacts...
+    auto edge_reporter = chrono_types::make_shared<_island_edge_reporter>();
+    system.GetContactContainer()->ReportAllContacts(edge_reporter);
+    for (const auto& pair : edge_reporter->pairs) {
+        auto it1 = body_index.find(pair.first);
+        auto it2 = body_index.find(pair.second);
+        if (it1 != body_index.end() && it2 != body_index.end())
+            parent[_island_find(parent, it1->second)] = _island_find(parent, it2->second);
+    }
+
+    // ... and along the wake-requiring links.
+    for (const auto& link : system.Get_linklist()) {
+        if (auto Lpointer = std::dynamic_pointer_cast<ChLink>(link)) {
+            if (Lpointer->IsRequiringWaking()) {
+                auto it1 = body_index.find(dynamic_cast<ChBody*>(Lpointer->GetBody1()));
+                auto it2 = body_index.find(dynamic_cast<ChBody*>(Lpointer->GetBody2()));
+                if (it1 != body_index.end() && it2 != body_index.end())
+                    parent[_island_find(parent, it1->second)] = _island_find(parent, it2->second);
+            }
+        }
+    }
+
+    // Per-body sleep votes. A sleeping body keeps voting for sleep; an awake body votes for sleep
+    // when TrySleeping() reports it as a candidate (this also refreshes the per-body rest timers).
+    std::vector<char> vote(nb);
+    for (int i = 0; i < nb; i++)
+        vote[i] = bodies[i]->GetSleeping() || bodies[i]->TrySleeping();
+
+    // Aggregate the votes and the hysteresis state per island.
+    std::vector<char> island_all_vote(nb, 1);   // every member votes for sleep
+    std::vector<char> island_sleeping(nb, 0);   // some member is sleeping
+    std::vector<char> island_disturbed(nb, 0);  // some sleeping member was displaced
+    std::vector<double> island_wake_time(nb, -1e30);
+    for (int i = 0; i < nb; i++) {
+        int root = _island_find(parent, i);
+        island_all_vote[root] = island_all_vote[root] && vote[i];
+        auto state = body_states.find(bodies[i]);
+        if (bodies[i]->GetSleeping()) {
+            island_sleeping[root] = 1;
+            // spatial hysteresis: a sleeping body is disturbed only if it drifted away from the
+            // position recorded when it fell asleep (e.g. repositioned by the user)
+            if (state != body_states.end() &&
+                (bodies[i]->GetPos() - state->second.sleep_pos).Length() > wake_distance)
+                island_disturbed[root] = 1;
+        }
+        if (state != body_states.end())
+            island_wake_time[root] = std::max(island_wake_time[root], state->second.wake_time);
+    }
+
+    bool changed = false;
+
+    for (int i = 0; i < nb; i++) {
+        ChBody* body = bodies[i];
+        int root = _island_find(parent, i);
+
+        // Bodies inside a frozen region are forced asleep and never woken by the manager.
+        if (IsFrozen(body->GetPos())) {
+            if (!body->GetSleeping()) {
+                body->SetSleeping(true);
+                body_states[body].sleep_pos = body->GetPos();
+                changed = true;
+            }
+            body->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
+            continue;
+        }
+
+        bool wake = island_disturbed[root] || (island_sleeping[root] && !island_all_vote[root]);
+        bool sleep = island_all_vote[root] && (time - island_wake_time[root] >= min_awake_time);
+
+        if (wake) {
+            // Wake the whole island: a sleeping member is either disturbed or touching an awake
+            // non-candidate member.
+            if (body->GetSleeping()) {
+                body->SetSleeping(false);
+                body_states[body].wake_time = time;
+                changed = true;
+            }
+            body->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
+        } else if (sleep) {
+            // Unanimous vote and past the refractory period: the whole island falls asleep.
+            if (!body->GetSleeping()) {
+                body->SetSleeping(true);
+                body_states[body].sleep_pos = body->GetPos();
+                changed = true;
+            }
+            body->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
+        } else {
+            // No transition; clear the candidate mark left by TrySleeping.
+            body->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
+        }
+    }
+
+    return changed;
+}
+
+}  // end namespace chrono
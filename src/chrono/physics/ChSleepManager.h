@@ -0,0 +1,109 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_SLEEP_MANAGER_H
+#define CH_SLEEP_MANAGER_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/core/ChVector.h"
+
+namespace chrono {
+
+class ChSystem;
+class ChBody;
+
+/// Island-based sleep/wake policy manager for the bodies of a ChSystem.
+///
+/// When attached to a system (see ChSystem::SetSleepManager), this replaces the per-body sleeping
+/// logic of ChSystem::ManageSleepingBodies with a policy operating on contact islands: the
+/// connected components of the graph whose edges are the current contacts and the wake-requiring
+/// links between non-fixed bodies. An island falls asleep only when every member body has been a
+/// sleep candidate (see ChBody::TrySleeping) - an all-or-nothing vote that avoids the partial
+/// sleep states of the per-body policy, where the boundary between sleeping and awake bodies of
+/// the same pile keeps shifting and the pile oscillates in and out of sleep.
+///
+/// Two hysteresis controls further damp the sleep/wake cycle:
+/// - a sleeping body is considered disturbed (waking its whole island) only if it moved farther
+///   than the wake distance from the position recorded when it fell asleep, or if it is touched
+///   by an awake body that is not itself a sleep candidate;
+/// - an island that has been woken up is not allowed to fall asleep again before the minimum
+///   awake time has elapsed, so a marginal disturbance cannot produce a wake/sleep cycle at every
+///   step.
+///
+/// Axis-aligned box regions can be registered with AddFrozenRegion(): bodies whose center of mass
+/// lies inside a frozen region are forced asleep regardless of the island votes and are never
+/// woken by the manager while inside, providing a direct way to freeze settled parts of a scene.
+class ChApi ChSleepManager {
+  public:
+    ChSleepManager();
+
+    /// Set the distance a sleeping body must travel from the position recorded when it fell
+    /// asleep before it is considered disturbed and its island is woken up (default: 0.01).
+    void SetWakeDistance(double dist) { wake_distance = dist; }
+
+    /// Get the wake distance.
+    double GetWakeDistance() const { return wake_distance; }
+
+    /// Set the minimum time an island must stay awake after a wake-up before it is allowed to
+    /// fall asleep again (default: 0.5).
+    void SetMinAwakeTime(double time) { min_awake_time = time; }
+
+    /// Get the minimum awake time.
+    double GetMinAwakeTime() const { return min_awake_time; }
+
+    /// Add an axis-aligned box region in which bodies are forced asleep.
+    /// Returns an identifier that can be passed to RemoveFrozenRegion().
+    int AddFrozenRegion(const ChVector<>& aabb_min, const ChVector<>& aabb_max);
+
+    /// Remove the frozen region with the given identifier.
+    void RemoveFrozenRegion(int id);
+
+    /// Remove all frozen regions.
+    void ClearFrozenRegions();
+
+    /// Apply the sleep/wake policy to the bodies of the given system.
+    /// Called once per step by ChSystem::ManageSleepingBodies when the manager is attached.
+    /// Returns true if some body changed its sleep state (the caller must then re-Setup the
+    /// system, as the sleeping policy changes the DOF counts and offsets).
+    bool Update(ChSystem& system);
+
+  private:
+    struct FrozenRegion {
+        int id;
+        ChVector<> aabb_min;
+        ChVector<> aabb_max;
+    };
+
+    /// Per-body bookkeeping, persistent across steps.
+    struct BodyState {
+        BodyState() : sleep_pos(0), wake_time(-1e30) {}
+        ChVector<> sleep_pos;  ///< position recorded when the body fell asleep
+        double wake_time;      ///< time of the last wake-up (for the minimum awake time)
+    };
+
+    /// Return true if the given point lies inside some frozen region.
+    bool IsFrozen(const ChVector<>& pos) const;
+
+    double wake_distance;   ///< displacement of a sleeping body considered a disturbance
+    double min_awake_time;  ///< refractory period after a wake-up
+
+    int next_region_id;                        ///< identifier for the next frozen region
+    std::vector<FrozenRegion> frozen_regions;  ///< regions in which bodies are forced asleep
+
+    std::unordered_map<ChBody*, BodyState> body_states;  ///< per-body bookkeeping
+};
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/physics/ChStateHistory.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+ChStateHistory::ChStateHistory(ChSystem* system, int capacity) : m_system(system), m_head(-1), m_count(0) {
+    SetCapacity(capacity);
+}
+
+void ChStateHistory::SetCapacity(int capacity) {
+    capacity = std::max(capacity, 2);
+    m_times.resize(capacity);
+    m_states.resize(capacity);
+    m_state_dts.resize(capacity);
+    Reset();
+}
+
+void ChStateHistory::Reset() {
+    m_head = -1;
+    m_count = 0;
+}
+
+double ChStateHistory::GetOldestTime() const {
+    int capacity = GetCapacity();
+    return m_times[(m_head - m_count + 1 + capacity) % capacity];
+}
+
+double ChStateHistory::GetNewestTime() const {
+    return m_times[m_head];
+}
+
+void ChStateHistory::Record() {
+    int capacity = GetCapacity();
+
+    // Overwrite the newest sample if recording at the same time (e.g. repeated calls without stepping)
+    int slot;
+    if (m_count > 0 && m_system->GetChTime() == m_times[m_head]) {
+        slot = m_head;
+    } else {
+        slot = (m_head + 1) % capacity;
+        m_count = std::min(m_count + 1, capacity);
+    }
+
+    ChState& x = m_states[slot];
+    ChStateDelta& v = m_state_dts[slot];
+
+    // Resize slot vectors only if the number of system coordinates changed
+    if (x.size() != m_system->GetNcoords())
+        x.setZero(m_system->GetNcoords(), m_system);
+    if (v.size() != m_system->GetNcoords_w())
+        v.setZero(m_system->GetNcoords_w(), m_system);
+
+    double T;
+    m_system->StateGather(x, v, T);
+    m_times[slot] = T;
+    m_head = slot;
+}
+
+bool ChStateHistory::InterpolateState(double time, ChState& x, ChStateDelta& v) {
+    if (m_count == 0)
+        return false;
+
+    int capacity = GetCapacity();
+
+    // Clamp to the recorded time range
+    if (m_count == 1 || time >= m_times[m_head]) {
+        x = m_states[m_head];
+        v = m_state_dts[m_head];
+        return true;
+    }
+    int tail = (m_head - m_count + 1 + capacity) % capacity;
+    if (time <= m_times[tail]) {
+        x = m_states[tail];
+        v = m_state_dts[tail];
+        return true;
+    }
+
+    // Walk back from the newest sample to the pair bracketing the requested time
+    int hi = m_head;
+    int lo = (hi - 1 + capacity) % capacity;
+    while (time < m_times[lo]) {
+        hi = lo;
+        lo = (hi - 1 + capacity) % capacity;
+    }
+
+    double alpha = (time - m_times[lo]) / (m_times[hi] - m_times[lo]);
+
+    // Linear interpolation of the velocity states
+    v = (1 - alpha) * m_state_dts[lo] + alpha * m_state_dts[hi];
+
+    // Advance the position states from the earlier sample, using the trapezoidal average of the velocities over
+    // [t_lo, time]; StateIncrementX performs the proper (quaternion-aware) increment.
+    m_Dx = (time - m_times[lo]) * 0.5 * (m_state_dts[lo] + v);
+    if (x.size() != m_states[lo].size())
+        x.setZero(m_states[lo].size(), m_system);
+    m_system->StateIncrementX(x, m_states[lo], m_Dx);
+
+    return true;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,79 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_STATE_HISTORY_H
+#define CH_STATE_HISTORY_H
+
+#include <vector>
+
+#include "chrono/timestepper/ChState.h"
+
+namespace chrono {
+
+class ChSystem;
+
+/// Ring buffer of past system states with an interpolated query API.
+///
+/// When attached to a ChSystem (see ChSystem::SetStateHistory), the history records the packed system state (gathered
+/// with a single StateGather call) at the end of each DoStepDynamics. Past states at arbitrary times can then be
+/// queried with InterpolateState(), e.g. for sensor latency emulation or delayed-feedback controllers.
+///
+/// All sample slots are preallocated; recording and interpolation perform no heap allocations once the buffer and the
+/// caller-provided output vectors have reached the size of the system state.
+class ChApi ChStateHistory {
+  public:
+    /// Construct a state history for the given system, with room for the specified number of samples.
+    ChStateHistory(ChSystem* system, int capacity = 256);
+
+    /// Set the buffer capacity (number of retained samples). This discards all recorded samples.
+    void SetCapacity(int capacity);
+
+    /// Get the buffer capacity (number of retained samples).
+    int GetCapacity() const { return (int)m_times.size(); }
+
+    /// Get the current number of recorded samples.
+    int GetNumSamples() const { return m_count; }
+
+    /// Get the time of the oldest retained sample (undefined if the buffer is empty).
+    double GetOldestTime() const;
+
+    /// Get the time of the most recent sample (undefined if the buffer is empty).
+    double GetNewestTime() const;
+
+    /// Discard all recorded samples, keeping the allocated buffers.
+    void Reset();
+
+    /// Record the current system state into the ring buffer.
+    /// Called automatically at the end of each step when the history is attached to a system; a sample recorded at the
+    /// same time as the most recent one overwrites it.
+    void Record();
+
+    /// Evaluate the system state at the given time, interpolating between the two bracketing samples.
+    /// Times outside the recorded range are clamped to the oldest/newest sample. Velocity states are interpolated
+    /// linearly; position states are advanced from the earlier sample through StateIncrementX, which handles
+    /// quaternion coordinates correctly. The output vectors are resized if needed.
+    /// Return false if no samples have been recorded.
+    bool InterpolateState(double time, ChState& x, ChStateDelta& v);
+
+  private:
+    ChSystem* m_system;                     ///< associated system
+    std::vector<double> m_times;            ///< sample times
+    std::vector<ChState> m_states;          ///< sampled position states
+    std::vector<ChStateDelta> m_state_dts;  ///< sampled velocity states
+    ChStateDelta m_Dx;                      ///< scratch increment for interpolation
+    int m_head;                             ///< index of the most recent sample
+    int m_count;                            ///< number of valid samples
+};
+
+}  // end namespace chrono
+
+#endif
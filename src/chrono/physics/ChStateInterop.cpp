@@ -0,0 +1,89 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono/physics/ChStateInterop.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+ChStateInterop::ChStateInterop(ChSystem* system)
+    : m_system(system), m_pack_contact_forces(true), m_num_bodies(0) {}
+
+int ChStateInterop::GetBodyIndex(const ChBody* body) const {
+    auto it = m_indices.find(body);
+    return (it != m_indices.end()) ? it->second : -1;
+}
+
+void ChStateInterop::Refresh() {
+    const auto& bodies = m_system->Get_bodylist();
+    int nbodies = (int)bodies.size();
+
+    if (nbodies != m_num_bodies) {
+        m_num_bodies = nbodies;
+        m_positions.resize(7 * nbodies);
+        m_velocities.resize(6 * nbodies);
+        m_contact_forces.resize(6 * nbodies);
+        m_indices.clear();
+        m_indices.reserve(nbodies);
+        for (int ib = 0; ib < nbodies; ib++)
+            m_indices[bodies[ib].get()] = ib;
+    }
+
+    // Resolve the resultant contact forces once for the whole container, so that the per-body
+    // lookups below are plain cache reads.
+    auto contact_container = m_system->GetContactContainer();
+    if (m_pack_contact_forces && contact_container)
+        contact_container->ComputeContactForces();
+
+    for (int ib = 0; ib < nbodies; ib++) {
+        ChBody* body = bodies[ib].get();
+
+        const ChVector<>& pos = body->GetPos();
+        const ChQuaternion<>& rot = body->GetRot();
+        double* p = &m_positions[7 * ib];
+        p[0] = pos.x();
+        p[1] = pos.y();
+        p[2] = pos.z();
+        p[3] = rot.e0();
+        p[4] = rot.e1();
+        p[5] = rot.e2();
+        p[6] = rot.e3();
+
+        const ChVector<>& vel = body->GetPos_dt();
+        ChVector<> wvel = body->GetWvel_loc();
+        double* v = &m_velocities[6 * ib];
+        v[0] = vel.x();
+        v[1] = vel.y();
+        v[2] = vel.z();
+        v[3] = wvel.x();
+        v[4] = wvel.y();
+        v[5] = wvel.z();
+
+        double* f = &m_contact_forces[6 * ib];
+        if (m_pack_contact_forces && contact_container) {
+            ChVector<> force = contact_container->GetContactableForce(body);
+            ChVector<> torque = contact_container->GetContactableTorque(body);
+            f[0] = force.x();
+            f[1] = force.y();
+            f[2] = force.z();
+            f[3] = torque.x();
+            f[4] = torque.y();
+            f[5] = torque.z();
+        } else {
+            f[0] = f[1] = f[2] = f[3] = f[4] = f[5] = 0;
+        }
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,85 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_STATE_INTEROP_H
+#define CH_STATE_INTEROP_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+class ChSystem;
+class ChBody;
+
+/// Packed per-body state buffers for zero-copy language interop.
+///
+/// Scripting front-ends (e.g. the Python bindings) that read body states through the per-body
+/// accessors pay one wrapped call and one ChVector temporary per quantity per body; for
+/// reinforcement-learning style workloads that extract full observations every step, this binding
+/// overhead can exceed the cost of the step itself.
+///
+/// This helper maintains contiguous row-major double arrays with one row per body:
+///  - positions:       [x y z e0 e1 e2 e3]  (7 columns, position and rotation quaternion)
+///  - velocities:      [vx vy vz wx wy wz]  (6 columns, angular velocity in local frame)
+///  - contact forces:  [fx fy fz tx ty tz]  (6 columns, resultant contact force and torque)
+///
+/// Refresh() repacks the arrays from the current system state; the buffers are reallocated only
+/// when the number of bodies changes, so steady-state refreshes are allocation-free. The raw
+/// data()/size() accessors are what a binding layer needs to expose the arrays as buffer-protocol
+/// objects (NumPy arrays of shape [num_bodies, 7|6]) without any per-element marshaling; the
+/// arrays remain valid and at a fixed address between refreshes that do not change the body count.
+class ChApi ChStateInterop {
+  public:
+    /// Construct an interop buffer set for the given system.
+    ChStateInterop(ChSystem* system);
+
+    /// Enable/disable packing of contact forces (default: true).
+    /// Contact force resolution requires a ComputeContactForces() pass over the contact container;
+    /// disable it if the observations need only positions and velocities.
+    void SetPackContactForces(bool val) { m_pack_contact_forces = val; }
+
+    /// Repack all buffers from the current system state.
+    /// Call once per step (after DoStepDynamics), then read the arrays.
+    void Refresh();
+
+    /// Get the number of body rows in the buffers (as of the last Refresh).
+    int GetNumBodies() const { return m_num_bodies; }
+
+    /// Get the row index of the given body, or -1 if not present in the buffers.
+    int GetBodyIndex(const ChBody* body) const;
+
+    /// Raw position buffer: GetNumBodies() rows of 7 doubles [x y z e0 e1 e2 e3].
+    const std::vector<double>& GetPositions() const { return m_positions; }
+
+    /// Raw velocity buffer: GetNumBodies() rows of 6 doubles [vx vy vz wx wy wz].
+    const std::vector<double>& GetVelocities() const { return m_velocities; }
+
+    /// Raw contact force buffer: GetNumBodies() rows of 6 doubles [fx fy fz tx ty tz].
+    /// All zeros if contact force packing is disabled.
+    const std::vector<double>& GetContactForces() const { return m_contact_forces; }
+
+  private:
+    ChSystem* m_system;                                 ///< associated system
+    bool m_pack_contact_forces;                         ///< include contact forces in Refresh()?
+    int m_num_bodies;                                   ///< number of body rows
+    std::vector<double> m_positions;                    ///< packed positions and rotations
+    std::vector<double> m_velocities;                   ///< packed linear and angular velocities
+    std::vector<double> m_contact_forces;               ///< packed contact forces and torques
+    std::unordered_map<const ChBody*, int> m_indices;   ///< map from body to row index
+};
+
+}  // end namespace chrono
+
+#endif
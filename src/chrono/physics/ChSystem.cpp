@@ -13,6 +13,9 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 
 #include "chrono/collision/ChCollisionSystemBullet.h"
 #ifdef CHRONO_COLLISION
@@ -20,6 +23,9 @@
 #endif
 #include "chrono/assets/ChVisualSystem.h"
 #include "chrono/physics/ChProximityContainer.h"
+#include "chrono/physics/ChSleepManager.h"
+#include "chrono/physics/ChSimulationTape.h"
+#include "chrono/physics/ChStateHistory.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChSolverAPGD.h"
 #include "chrono/solver/ChSolverBB.h"
@@ -30,6 +36,8 @@
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/utils/ChMemoryProfiler.h"
+#include "chrono/utils/ChPhaseProfiler.h"
 #include "chrono/utils/ChProfiler.h"
 #include "chrono/physics/ChLinkMate.h"
 
@@ -161,6 +169,15 @@ void ChSystem::AddBody(std::shared_ptr<ChBody> body) {
     assembly.AddBody(body);
 }
 
+void ChSystem::AddBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    int id = static_cast<int>(Get_bodylist().size());
+    for (const auto& body : bodies) {
+        assert(body->GetCollisionModel()->GetType() == collision_system->GetType());
+        body->SetId(id++);
+    }
+    assembly.AddBodies(bodies);
+}
+
 void ChSystem::AddShaft(std::shared_ptr<ChShaft> shaft) {
     assembly.AddShaft(shaft);
 }
@@ -332,9 +349,51 @@ void ChSystem::UnregisterCustomCollisionCallback(std::shared_ptr<CustomCollision
 
 // -----------------------------------------------------------------------------
 
+int ChSystem::RegisterCollisionFamily(const std::string& name) {
+    auto itr = collision_families.find(name);
+    if (itr != collision_families.end())
+        return itr->second;
+
+    // Reserve the lowest family number not yet registered by name.
+    // Family 0 is the default family of all collision models and is never assigned automatically.
+    for (int family = 1; family < 31; family++) {
+        bool taken = false;
+        for (const auto& cf : collision_families) {
+            if (cf.second == family) {
+                taken = true;
+                break;
+            }
+        }
+        if (!taken) {
+            collision_families[name] = family;
+            return family;
+        }
+    }
+
+    return -1;
+}
+
+int ChSystem::GetCollisionFamily(const std::string& name) const {
+    auto itr = collision_families.find(name);
+    return (itr != collision_families.end()) ? itr->second : -1;
+}
+
+void ChSystem::AssignCollisionFamilies() {
+    for (const auto& item : assembly.Get_otherphysicslist()) {
+        if (auto sub = std::dynamic_pointer_cast<ChAssembly>(item)) {
+            int family = RegisterCollisionFamily(sub->GetNameString());
+            if (family >= 0)
+                sub->SetCollisionFamily(family);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 void ChSystem::SetSystemDescriptor(std::shared_ptr<ChSystemDescriptor> newdescriptor) {
     assert(newdescriptor);
     descriptor = newdescriptor;
+    descriptor->SetNumThreads(nthreads_chrono);
 }
 void ChSystem::SetSolver(std::shared_ptr<ChSolver> newsolver) {
     assert(newsolver);
@@ -394,6 +453,7 @@ void ChSystem::SetNumThreads(int num_threads_chrono, int num_threads_collision,
     nthreads_eigen = (num_threads_eigen <= 0) ? num_threads_chrono : num_threads_eigen;
 
     collision_system->SetNumThreads(nthreads_collision);
+    descriptor->SetNumThreads(nthreads_chrono);
 }
 
 // -----------------------------------------------------------------------------
@@ -486,6 +546,15 @@ bool ChSystem::ManageSleepingBodies() {
     if (!GetUseSleeping())
         return 0;
 
+    // If an island-based sleep manager is attached, delegate the whole policy to it.
+    if (sleep_manager) {
+        if (sleep_manager->Update(*this)) {
+            Setup();
+            return true;
+        }
+        return false;
+    }
+
     // STEP 1:
     // See if some body could change from no sleep to sleep
 
@@ -640,6 +709,7 @@ void ChSystem::Setup() {
     CH_PROFILE("Setup");
 
     timer_setup.start();
+    utils::ChPhaseProfiler::Begin(utils::ChPhaseProfiler::SETUP);
 
     ncoords = 0;
     ncoords_w = 0;
@@ -668,6 +738,7 @@ void ChSystem::Setup() {
 
     ndof = ncoords - ndoc;  // number of degrees of freedom (approximate - does not consider constr. redundancy, etc)
 
+    utils::ChPhaseProfiler::End(utils::ChPhaseProfiler::SETUP);
     timer_setup.stop();
 
 #ifdef _DEBUG
@@ -730,6 +801,7 @@ void ChSystem::Update(bool update_assets) {
         SetupInitial();
 
     timer_update.start();  // Timer for profiling
+    utils::ChPhaseProfiler::Begin(utils::ChPhaseProfiler::UPDATE);
 
     // Update underlying assembly (recursively update sub objects bodies, links, etc)
     assembly.Update(update_assets);
@@ -741,6 +813,7 @@ void ChSystem::Update(bool update_assets) {
     if (visual_system && update_assets)
         visual_system->OnUpdate(this);
 
+    utils::ChPhaseProfiler::End(utils::ChPhaseProfiler::UPDATE);
     timer_update.stop();
 }
 
@@ -1057,6 +1130,7 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // fill the sparse system structures with information in G and Cq.
     if (force_setup || GetSolver()->SolveRequiresMatrix()) {
         timer_jacobian.start();
+        utils::ChPhaseProfiler::Begin(utils::ChPhaseProfiler::JACOBIAN);
 
         // Cq  matrix
         ConstraintsLoadJacobians();
@@ -1068,6 +1142,7 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
         // For ChVariable objects without a ChKblock, just use the 'a' coefficient
         descriptor->SetMassFactor(c_a);
 
+        utils::ChPhaseProfiler::End(utils::ChPhaseProfiler::JACOBIAN);
         timer_jacobian.stop();
     }
 
@@ -1098,7 +1173,9 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // Return 'false' if the setup phase fails.
     if (force_setup) {
         timer_ls_setup.start();
+        utils::ChPhaseProfiler::Begin(utils::ChPhaseProfiler::LS_SETUP);
         bool success = GetSolver()->Setup(*descriptor);
+        utils::ChPhaseProfiler::End(utils::ChPhaseProfiler::LS_SETUP);
         timer_ls_setup.stop();
         setupcount++;
         if (!success)
@@ -1108,7 +1185,12 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // Solve the problem
     // The solution is scattered in the provided system descriptor
     timer_ls_solve.start();
-    GetSolver()->Solve(*descriptor);
+    utils::ChPhaseProfiler::Begin(utils::ChPhaseProfiler::LS_SOLVE);
+    {
+        utils::ChMemoryScope mem_scope(utils::ChMemoryProfiler::SOLVER);
+        GetSolver()->Solve(*descriptor);
+    }
+    utils::ChPhaseProfiler::End(utils::ChPhaseProfiler::LS_SOLVE);
     timer_ls_solve.stop();
 
     // Dv and L vectors  <-- sparse solver structures
@@ -1249,6 +1331,8 @@ double ChSystem::ComputeCollisions() {
     double mretC = 0.0;
 
     timer_collision.start();
+    utils::ChPhaseProfiler::Begin(utils::ChPhaseProfiler::COLLISION);
+    utils::ChMemoryScope mem_scope(utils::ChMemoryProfiler::COLLISION);
 
     // Update all positions of collision models: delegate this to the ChAssembly
     assembly.SyncCollisionModels();
@@ -1286,6 +1370,7 @@ double ChSystem::ComputeCollisions() {
     // Cache the total number of contacts
     ncontacts = contact_container->GetNcontacts();
 
+    utils::ChPhaseProfiler::End(utils::ChPhaseProfiler::COLLISION);
     timer_collision.stop();
 
     return mretC;
@@ -1543,6 +1628,7 @@ bool ChSystem::Integrate_Y() {
     ResetTimers();
 
     timer_step.start();
+    utils::ChPhaseProfiler::Begin(utils::ChPhaseProfiler::STEP);
 
     stepcount++;
     solvecount = 0;
@@ -1591,7 +1677,9 @@ bool ChSystem::Integrate_Y() {
     {
         CH_PROFILE("Advance");
         timer_advance.start();
+        utils::ChPhaseProfiler::Begin(utils::ChPhaseProfiler::ADVANCE);
         timestepper->Advance(step);
+        utils::ChPhaseProfiler::End(utils::ChPhaseProfiler::ADVANCE);
         timer_advance.stop();
     }
 
@@ -1601,7 +1689,19 @@ bool ChSystem::Integrate_Y() {
     // Call method to gather contact forces/torques in rigid bodies
     contact_container->ComputeContactForces();
 
+    // Record the new state in the attached state history, if any
+    if (state_history)
+        state_history->Record();
+
+    // Record the completed step on the attached simulation tape, if any
+    if (simulation_tape)
+        simulation_tape->Record();
+
+    // Sample the process memory footprint for this step (no-op when accounting is disabled)
+    utils::ChMemoryProfiler::SampleStep();
+
     // Time elapsed for step
+    utils::ChPhaseProfiler::End(utils::ChPhaseProfiler::STEP);
     timer_step.stop();
 
     // Update the run-time visualization system, if present
@@ -2208,4 +2308,106 @@ int ChSystem::FileWriteChR(ChStreamOutBinary& m_file) {
     return 1;
 }
 
+// Fixed-layout header of the binary state snapshot files. The magic tag doubles as a format
+// version: bump the trailing digits when the layout changes.
+static const char snapshot_magic[8] = {'C', 'H', 'S', 'N', 'A', 'P', '0', '1'};
+
+struct ChSnapshotHeader {
+    char magic[8];         // format tag, see snapshot_magic
+    uint64_t ncoords_x;    // number of position coordinates
+    uint64_t ncoords_v;    // number of speed (and acceleration) coordinates
+    double time;           // simulation time of the snapshot
+};
+
+bool ChSystem::SnapshotWrite(const std::string& filename) {
+    Setup();
+
+    ChState x(GetNcoords_x(), this);
+    ChStateDelta v(GetNcoords_v(), this);
+    ChStateDelta a(GetNcoords_v(), this);
+    double T;
+    StateGather(x, v, T);
+    StateGatherAcceleration(a);
+
+    ChSnapshotHeader header;
+    memcpy(header.magic, snapshot_magic, sizeof(snapshot_magic));
+    header.ncoords_x = (uint64_t)x.size();
+    header.ncoords_v = (uint64_t)v.size();
+    header.time = T;
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file)
+        return false;
+
+    // header plus the raw state arrays, one sequential pass
+    file.write((const char*)&header, sizeof(header));
+    file.write((const char*)x.data(), x.size() * sizeof(double));
+    file.write((const char*)v.data(), v.size() * sizeof(double));
+    file.write((const char*)a.data(), a.size() * sizeof(double));
+
+    return (bool)file;
+}
+
+bool ChSystem::SnapshotRead(const std::string& filename) {
+    Setup();
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+        return false;
+
+    ChSnapshotHeader header;
+    file.read((char*)&header, sizeof(header));
+    if (!file || memcmp(header.magic, snapshot_magic, sizeof(snapshot_magic)) != 0)
+        return false;
+
+    // The snapshot carries no model description: refuse to scatter into a system whose
+    // state layout differs from the one the snapshot was taken from.
+    if (header.ncoords_x != (uint64_t)GetNcoords_x() || header.ncoords_v != (uint64_t)GetNcoords_v())
+        return false;
+
+    ChState x(GetNcoords_x(), this);
+    ChStateDelta v(GetNcoords_v(), this);
+    ChStateDelta a(GetNcoords_v(), this);
+
+    file.read((char*)x.data(), x.size() * sizeof(double));
+    file.read((char*)v.data(), v.size() * sizeof(double));
+    file.read((char*)a.data(), a.size() * sizeof(double));
+    if (!file)
+        return false;
+
+    StateScatter(x, v, header.time, true);
+    StateScatterAcceleration(a);
+
+    return true;
+}
+
+void ChSystem::SnapshotCapture(ChStateSnapshot& snapshot) {
+    Setup();
+
+    snapshot.x.setZero(GetNcoords_x(), this);
+    snapshot.v.setZero(GetNcoords_v(), this);
+    snapshot.a.setZero(GetNcoords_v(), this);
+    snapshot.L.setZero(GetNconstr());
+
+    StateGather(snapshot.x, snapshot.v, snapshot.time);
+    StateGatherAcceleration(snapshot.a);
+    StateGatherReactions(snapshot.L);
+}
+
+bool ChSystem::SnapshotRestore(const ChStateSnapshot& snapshot) {
+    Setup();
+
+    // The snapshot carries no model description: refuse to scatter into a system whose state
+    // layout differs from the one the snapshot was taken from.
+    if (snapshot.x.size() != GetNcoords_x() || snapshot.v.size() != GetNcoords_v() ||
+        snapshot.L.size() != GetNconstr())
+        return false;
+
+    StateScatter(snapshot.x, snapshot.v, snapshot.time, true);
+    StateScatterAcceleration(snapshot.a);
+    StateScatterReactions(snapshot.L);
+
+    return true;
+}
+
 }  // end namespace chrono
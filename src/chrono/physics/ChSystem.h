@@ -22,6 +22,7 @@
 #include <cstring>
 #include <iostream>
 #include <list>
+#include <map>
 
 #include "chrono/core/ChGlobal.h"
 #include "chrono/core/ChLog.h"
@@ -43,10 +44,24 @@ namespace chrono {
 
 // Forward references
 class ChVisualSystem;
+class ChSleepManager;
+class ChSimulationTape;
+class ChStateHistory;
 namespace modal {
 class ChModalAssembly;
 }
 
+/// In-memory snapshot of the dynamic state of a system (see ChSystem::SnapshotCapture).
+/// Holds the position, speed, and acceleration coordinates, the constraint reactions, and the
+/// simulation time; nothing of the model itself (topology, materials, assets) is copied.
+struct ChStateSnapshot {
+    ChState x;            ///< position coordinates
+    ChStateDelta v;       ///< speed coordinates
+    ChStateDelta a;       ///< acceleration coordinates
+    ChVectorDynamic<> L;  ///< constraint reactions (Lagrange multipliers)
+    double time;          ///< simulation time at capture
+};
+
 /// Physical system.
 ///
 /// This class is used to represent a multibody physical system,
@@ -255,6 +270,12 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Attach a body to the underlying assembly.
     virtual void AddBody(std::shared_ptr<ChBody> body);
 
+    /// Attach a batch of bodies to the underlying assembly, in a single list update.
+    /// Equivalent to calling AddBody() on each element, but the per-item list bookkeeping is
+    /// amortized over the whole batch; offsets and DOF counts are recomputed at the next Setup().
+    /// Preferable over a loop of AddBody() calls when spawning many bodies mid-simulation.
+    virtual void AddBodies(const std::vector<std::shared_ptr<ChBody>>& bodies);
+
     /// Attach a shaft to the underlying assembly.
     virtual void AddShaft(std::shared_ptr<ChShaft> shaft);
 
@@ -286,6 +307,11 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Remove a body from this assembly.
     virtual void RemoveBody(std::shared_ptr<ChBody> body) { assembly.RemoveBody(body); }
 
+    /// Remove a batch of bodies from this assembly, in a single sweep of the body list.
+    /// Equivalent to calling RemoveBody() on each element, but the list is compacted once
+    /// instead of once per removed body.
+    virtual void RemoveBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) { assembly.RemoveBodies(bodies); }
+
     /// Remove a shaft from this assembly.
     virtual void RemoveShaft(std::shared_ptr<ChShaft> shaft) { assembly.RemoveShaft(shaft); }
 
@@ -517,6 +543,16 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// call.
     void ForceUpdate();
 
+    /// Enable kinematics-only evaluation during system updates (default: false).
+    /// In this mode, links of the ChLinkLock family skip computation of constraint Jacobians, reactions, and applied
+    /// forces in their Update and perform only position/velocity propagation. Use this for fast pose replay (e.g.
+    /// scattering recorded states for visualization); the flag can be toggled at any time, so precise dynamics steps
+    /// can be interleaved with fast preview updates. Do not step dynamics while this mode is active.
+    void SetKinematicsOnlyUpdate(bool val) { kinematics_only_update = val; }
+
+    /// Return true if kinematics-only evaluation is enabled (see SetKinematicsOnlyUpdate).
+    bool GetKinematicsOnlyUpdate() const { return kinematics_only_update; }
+
     void IntToDescriptor(const unsigned int off_v,
                          const ChStateDelta& v,
                          const ChVectorDynamic<>& R,
@@ -687,6 +723,40 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Remove the given collision callback from this system.
     void UnregisterCustomCollisionCallback(std::shared_ptr<CustomCollisionCallback> callback);
 
+    /// Attach a state history recorder to this system (see ChStateHistory).
+    /// If present, the packed system state is recorded in the history ring buffer at the end of each step.
+    /// Pass an empty pointer to detach the current recorder.
+    void SetStateHistory(std::shared_ptr<ChStateHistory> history) { state_history = history; }
+
+    /// Get the state history recorder attached to this system (if any).
+    std::shared_ptr<ChStateHistory> GetStateHistory() const { return state_history; }
+
+    /// Attach a simulation tape to this system (see ChSimulationTape).
+    /// If present, the packed system states (and optionally the system-level Jacobian matrices) are recorded on the
+    /// tape at the end of each step, for consumption by adjoint/gradient passes.
+    /// Pass an empty pointer to detach the current tape.
+    void SetSimulationTape(std::shared_ptr<ChSimulationTape> tape) { simulation_tape = tape; }
+
+    /// Get the simulation tape attached to this system (if any).
+    std::shared_ptr<ChSimulationTape> GetSimulationTape() const { return simulation_tape; }
+
+    /// Register a named collision family on this system and return its family number.
+    /// If a family with the given name was already registered, its number is returned; otherwise, the lowest family
+    /// number not yet registered by name is reserved (family 0, the default family of all collision models, is never
+    /// assigned automatically). Named families let independently developed subsystems share the family space without
+    /// aliasing. Returns -1 if all families are in use.
+    int RegisterCollisionFamily(const std::string& name);
+
+    /// Return the family number registered under the given name, or -1 if no such family was registered.
+    int GetCollisionFamily(const std::string& name) const;
+
+    /// Automatically assign collision families from the assembly hierarchy.
+    /// Each ChAssembly found among the physics items of this system is given its own collision family, registered
+    /// under the assembly name (see RegisterCollisionFamily) and applied to all collision models in that assembly
+    /// and its sub-assemblies (see ChAssembly::SetCollisionFamily). Items outside any sub-assembly are left in their
+    /// current families.
+    void AssignCollisionFamilies();
+
     /// Change the underlying collision detection system to the specified type.
     /// By default, a ChSystem uses a Bullet-based collision detection engine
     /// (collision::ChCollisionSystemType::BULLET).
@@ -726,6 +796,15 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Tell if the system will put to sleep the bodies whose motion has almost come to a rest.
     bool GetUseSleeping() const { return use_sleeping; }
 
+    /// Attach an island-based sleep/wake policy manager (see ChSleepManager).
+    /// When attached (and sleeping is enabled with SetUseSleeping), the manager replaces the
+    /// default per-body sleeping logic: bodies sleep and wake as whole contact islands, with
+    /// spatial hysteresis and optional frozen regions. Pass an empty pointer to detach.
+    void SetSleepManager(std::shared_ptr<ChSleepManager> manager) { sleep_manager = manager; }
+
+    /// Get the sleep manager attached to this system (if any).
+    std::shared_ptr<ChSleepManager> GetSleepManager() const { return sleep_manager; }
+
   private:
     /// Put bodies to sleep if possible. Also awakens sleeping bodies, if needed.
     /// Returns true if some body changed from sleep to no sleep or viceversa,
@@ -905,6 +984,36 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// hierarchy (bodies, forces, links, etc.) (deprecated function - obsolete)
     int FileWriteChR(ChStreamOutBinary& m_file);
 
+    /// Write a binary snapshot of the system state (positions, speeds, accelerations, time) to a file.
+    /// Unlike archive serialization, which walks the whole object hierarchy with per-field calls, the
+    /// snapshot has a fixed-layout header followed by the raw state arrays and is written with a single
+    /// sequential pass, so it is suitable for high-frequency checkpointing of large systems.
+    /// Note that the snapshot does not describe the model: it can be restored only into a system with
+    /// the same physics items, in the same order, as when it was taken.
+    /// Returns false if the file cannot be written.
+    bool SnapshotWrite(const std::string& filename);
+
+    /// Restore a binary state snapshot written by SnapshotWrite.
+    /// The system must contain the same physics items, in the same order, as when the snapshot was
+    /// taken; the state sizes are checked against the snapshot header.
+    /// Returns false if the file cannot be read or does not match the current state layout.
+    bool SnapshotRead(const std::string& filename);
+
+    /// Capture an in-memory snapshot of the dynamic state of the system (positions, speeds,
+    /// accelerations, constraint reactions, time). Since no part of the model itself is copied, a
+    /// capture/restore round trip is orders of magnitude cheaper than archive serialization and is
+    /// suitable for high-frequency scenario resets (e.g., episodic simulation restarts), at the
+    /// cost of being restorable only into the unmodified system.
+    void SnapshotCapture(ChStateSnapshot& snapshot);
+
+    /// Restore an in-memory snapshot taken with SnapshotCapture.
+    /// Scattering the reactions also refreshes the reaction forces cached in the links. Contacts
+    /// are not part of the state: the contact set is regenerated by the collision detection pass
+    /// of the next step.
+    /// The system must contain the same physics items, in the same order, as at capture time;
+    /// returns false if the state sizes do not match.
+    bool SnapshotRestore(const ChStateSnapshot& snapshot);
+
   protected:
     ChAssembly assembly;
 
@@ -914,6 +1023,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     bool is_initialized;  ///< if false, an initial setup is required (i.e. a call to SetupInitial)
     bool is_updated;      ///< if false, a new update is required (i.e. a call to Update)
+    bool kinematics_only_update = false;  ///< skip force/Jacobian computation in link updates
 
     int ncoords;     ///< number of scalar coordinates (including 4th dimension of quaternions) for all active bodies
     int ndoc;        ///< number of scalar constraints (including constr. on quaternions)
@@ -953,10 +1063,15 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     collision::ChCollisionSystemType collision_system_type;                     ///< type of the collision engine
     std::shared_ptr<collision::ChCollisionSystem> collision_system;             ///< collision engine
     std::vector<std::shared_ptr<CustomCollisionCallback>> collision_callbacks;  ///< user-defined collision callbacks
+    std::map<std::string, int> collision_families;                              ///< named collision families
     std::unique_ptr<ChMaterialCompositionStrategy> composition_strategy;        /// material composition strategy
 
     ChVisualSystem* visual_system;  ///< run-time visualization engine
 
+    std::shared_ptr<ChStateHistory> state_history;      ///< optional recorder of past system states
+    std::shared_ptr<ChSimulationTape> simulation_tape;  ///< optional per-step state/Jacobian tape
+    std::shared_ptr<ChSleepManager> sleep_manager;  ///< optional island-based sleep/wake policy manager
+
     // OpenMP
     int nthreads_chrono;
     int nthreads_eigen;
@@ -170,6 +170,14 @@ class ChApi ChConstraint {
     /// Set the status of the constraint to active
     void SetActive(bool isactive) { active = isactive; }
 
+    /// Tells if at least one of the variable blocks referenced by this constraint is active.
+    /// A constraint whose variables are all inactive (e.g. a joint or contact between sleeping
+    /// and/or fixed bodies) cannot exert any effect on the solution, and may be excluded from the
+    /// system descriptor (see ChSystemDescriptor::EnableSleepingConstraintPruning). This base
+    /// version is conservative and always returns true; derived classes that know their variable
+    /// blocks override it.
+    virtual bool HasActiveVariables() const { return true; }
+
     /// Compute the residual of the constraint using the LINEAR expression
     /// <pre>
     /// c_i= [Cq_i]*q + cfm_i*l_i + b_i
@@ -56,6 +56,15 @@ class ChApi ChConstraintNgeneric : public ChConstraint {
     /// Access the Nth variable object
     ChVariables* GetVariables_N(size_t n) { return variables[n]; }
 
+    /// Tells if at least one of the variable objects is active.
+    virtual bool HasActiveVariables() const override {
+        for (size_t i = 0; i < variables.size(); ++i) {
+            if (variables[i] && variables[i]->IsActive())
+                return true;
+        }
+        return false;
+    }
+
     /// Set references to the constrained objects, each of ChVariables type,
     /// automatically creating/resizing jacobians if needed.
     void SetVariables(std::vector<ChVariables*> mvars);
@@ -69,6 +69,12 @@ class ChApi ChConstraintThree : public ChConstraint {
     /// Access the second variable object.
     ChVariables* GetVariables_c() { return variables_c; }
 
+    /// Tells if at least one of the three variable objects is active.
+    virtual bool HasActiveVariables() const override {
+        return (variables_a && variables_a->IsActive()) || (variables_b && variables_b->IsActive()) ||
+               (variables_c && variables_c->IsActive());
+    }
+
     /// Set references to the constrained objects, each of ChVariables type,
     /// automatically creating/resizing jacobians if needed.
     virtual void SetVariables(ChVariables* mvariables_a, ChVariables* mvariables_b, ChVariables* mvariables_c) = 0;
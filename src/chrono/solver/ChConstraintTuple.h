@@ -103,13 +103,13 @@ class ChConstraintTuple_1vars {
 
     void MultiplyAndAdd(double& result, const ChVectorDynamic<double>& vect) const {
         if (variables->IsActive()) {
-            result += Cq * vect.segment(variables->GetOffset(), T::nvars1);
+            result += Cq * vect.segment<T::nvars1>(variables->GetOffset());
         }
     }
 
     void MultiplyTandAdd(ChVectorDynamic<double>& result, double l) {
         if (variables->IsActive()) {
-            result.segment(variables->GetOffset(), T::nvars1) += Cq.transpose() * l;
+            result.segment<T::nvars1>(variables->GetOffset()) += Cq.transpose() * l;
         }
     }
 
@@ -122,6 +122,8 @@ class ChConstraintTuple_1vars {
         if (variables->IsActive())
             PasteMatrix(storage, Cq.transpose(), variables->GetOffset(), inscol);
     }
+
+    bool HasActiveVariables() const { return variables && variables->IsActive(); }
 };
 
 /// Case of tuple with reference to 2 ChVariable objects:
@@ -232,21 +234,21 @@ class ChConstraintTuple_2vars {
 
     void MultiplyAndAdd(double& result, const ChVectorDynamic<double>& vect) const {
         if (variables_1->IsActive()) {
-            result += Cq_1 * vect.segment(variables_1->GetOffset(), T::nvars1);
+            result += Cq_1 * vect.segment<T::nvars1>(variables_1->GetOffset());
         }
 
         if (variables_2->IsActive()) {
-            result += Cq_2 * vect.segment(variables_2->GetOffset(), T::nvars2);
+            result += Cq_2 * vect.segment<T::nvars2>(variables_2->GetOffset());
         }
     }
 
     void MultiplyTandAdd(ChVectorDynamic<double>& result, double l) {
         if (variables_1->IsActive()) {
-            result.segment(variables_1->GetOffset(), T::nvars1) += Cq_1.transpose() * l;
+            result.segment<T::nvars1>(variables_1->GetOffset()) += Cq_1.transpose() * l;
         }
 
         if (variables_2->IsActive()) {
-            result.segment(variables_2->GetOffset(), T::nvars2) += Cq_2.transpose() * l;
+            result.segment<T::nvars2>(variables_2->GetOffset()) += Cq_2.transpose() * l;
         }
     }
 
@@ -263,6 +265,10 @@ class ChConstraintTuple_2vars {
         if (variables_2->IsActive())
             PasteMatrix(storage, Cq_2.transpose(), variables_2->GetOffset(), inscol);
     }
+
+    bool HasActiveVariables() const {
+        return (variables_1 && variables_1->IsActive()) || (variables_2 && variables_2->IsActive());
+    }
 };
 
 /// Case of tuple with reference to 3 ChVariable objects:
@@ -401,29 +407,29 @@ class ChConstraintTuple_3vars {
 
     void MultiplyAndAdd(double& result, const ChVectorDynamic<double>& vect) const {
         if (variables_1->IsActive()) {
-            result += Cq_1 * vect.segment(variables_1->GetOffset(), T::nvars1);
+            result += Cq_1 * vect.segment<T::nvars1>(variables_1->GetOffset());
         }
 
         if (variables_2->IsActive()) {
-            result += Cq_2 * vect.segment(variables_2->GetOffset(), T::nvars2);
+            result += Cq_2 * vect.segment<T::nvars2>(variables_2->GetOffset());
         }
 
         if (variables_3->IsActive()) {
-            result += Cq_3 * vect.segment(variables_3->GetOffset(), T::nvars3);
+            result += Cq_3 * vect.segment<T::nvars3>(variables_3->GetOffset());
         }
     }
 
     void MultiplyTandAdd(ChVectorDynamic<double>& result, double l) {
         if (variables_1->IsActive()) {
-            result.segment(variables_1->GetOffset(), T::nvars1) += Cq_1.transpose() * l;
+            result.segment<T::nvars1>(variables_1->GetOffset()) += Cq_1.transpose() * l;
         }
 
         if (variables_2->IsActive()) {
-            result.segment(variables_2->GetOffset(), T::nvars2) += Cq_2.transpose() * l;
+            result.segment<T::nvars2>(variables_2->GetOffset()) += Cq_2.transpose() * l;
         }
 
         if (variables_3->IsActive()) {
-            result.segment(variables_3->GetOffset(), T::nvars3) += Cq_3.transpose() * l;
+            result.segment<T::nvars3>(variables_3->GetOffset()) += Cq_3.transpose() * l;
         }
     }
 
@@ -444,6 +450,11 @@ class ChConstraintTuple_3vars {
         if (variables_3->IsActive())
             PasteMatrix(storage, Cq_3.transpose(), variables_3->GetOffset(), inscol);
     }
+
+    bool HasActiveVariables() const {
+        return (variables_1 && variables_1->IsActive()) || (variables_2 && variables_2->IsActive()) ||
+               (variables_3 && variables_3->IsActive());
+    }
 };
 
 
@@ -611,37 +622,37 @@ class ChConstraintTuple_4vars {
 
     void MultiplyAndAdd(double& result, const ChVectorDynamic<double>& vect) const {
         if (variables_1->IsActive()) {
-            result += Cq_1 * vect.segment(variables_1->GetOffset(), T::nvars1);
+            result += Cq_1 * vect.segment<T::nvars1>(variables_1->GetOffset());
         }
 
         if (variables_2->IsActive()) {
-            result += Cq_2 * vect.segment(variables_2->GetOffset(), T::nvars2);
+            result += Cq_2 * vect.segment<T::nvars2>(variables_2->GetOffset());
         }
 
         if (variables_3->IsActive()) {
-            result += Cq_3 * vect.segment(variables_3->GetOffset(), T::nvars3);
+            result += Cq_3 * vect.segment<T::nvars3>(variables_3->GetOffset());
         }
 
         if (variables_4->IsActive()) {
-            result += Cq_4 * vect.segment(variables_4->GetOffset(), T::nvars4);
+            result += Cq_4 * vect.segment<T::nvars4>(variables_4->GetOffset());
         }
     }
 
     void MultiplyTandAdd(ChVectorDynamic<double>& result, double l) {
         if (variables_1->IsActive()) {
-            result.segment(variables_1->GetOffset(), T::nvars1) += Cq_1.transpose() * l;
+            result.segment<T::nvars1>(variables_1->GetOffset()) += Cq_1.transpose() * l;
         }
 
         if (variables_2->IsActive()) {
-            result.segment(variables_2->GetOffset(), T::nvars2) += Cq_2.transpose() * l;
+            result.segment<T::nvars2>(variables_2->GetOffset()) += Cq_2.transpose() * l;
         }
 
         if (variables_3->IsActive()) {
-            result.segment(variables_3->GetOffset(), T::nvars3) += Cq_3.transpose() * l;
+            result.segment<T::nvars3>(variables_3->GetOffset()) += Cq_3.transpose() * l;
         }
 
         if (variables_4->IsActive()) {
-            result.segment(variables_4->GetOffset(), T::nvars4) += Cq_4.transpose() * l;
+            result.segment<T::nvars4>(variables_4->GetOffset()) += Cq_4.transpose() * l;
         }
     }
 
@@ -666,6 +677,11 @@ class ChConstraintTuple_4vars {
         if (variables_4->IsActive())
             PasteMatrix(storage, Cq_4.transpose(), variables_4->GetOffset(), inscol);
     }
+
+    bool HasActiveVariables() const {
+        return (variables_1 && variables_1->IsActive()) || (variables_2 && variables_2->IsActive()) ||
+               (variables_3 && variables_3->IsActive()) || (variables_4 && variables_4->IsActive());
+    }
 };
 
 /// This is a set of 'helper' classes that make easier to manage the templated
@@ -61,6 +61,11 @@ class ChApi ChConstraintTwo : public ChConstraint {
     /// Access the second variable object.
     ChVariables* GetVariables_b() { return variables_b; }
 
+    /// Tells if at least one of the two variable objects is active.
+    virtual bool HasActiveVariables() const override {
+        return (variables_a && variables_a->IsActive()) || (variables_b && variables_b->IsActive());
+    }
+
     /// Set references to the constrained objects, each of ChVariables type,
     /// automatically creating/resizing jacobians if needed.
     virtual void SetVariables(ChVariables* mvariables_a, ChVariables* mvariables_b) = 0;
@@ -100,12 +100,14 @@ void ChConstraintTwoBodies::Update_auxiliary() {
 double ChConstraintTwoBodies::Compute_Cq_q() {
     double ret = 0;
 
+    // The variables are of ChVariablesBody type (enforced in SetVariables), so their qb blocks
+    // have exactly 6 elements; use fixed-size heads to get unrolled products.
     if (variables_a->IsActive()) {
-        ret += Cq_a * variables_a->Get_qb();
+        ret += Cq_a * variables_a->Get_qb().head<6>();
     }
 
     if (variables_b->IsActive()) {
-        ret += Cq_b * variables_b->Get_qb();
+        ret += Cq_b * variables_b->Get_qb().head<6>();
     }
 
     return ret;
@@ -113,31 +115,33 @@ double ChConstraintTwoBodies::Compute_Cq_q() {
 
 void ChConstraintTwoBodies::Increment_q(const double deltal) {
     if (variables_a->IsActive()) {
-        variables_a->Get_qb() += Eq_a * deltal;
+        variables_a->Get_qb().head<6>() += Eq_a * deltal;
     }
 
     if (variables_b->IsActive()) {
-        variables_b->Get_qb() += Eq_b * deltal;
+        variables_b->Get_qb().head<6>() += Eq_b * deltal;
     }
 }
 
 void ChConstraintTwoBodies::MultiplyAndAdd(double& result, const ChVectorDynamic<double>& vect) const {
+    // Fixed-size 6-element segments, so that the products below are fully unrolled by Eigen
+    // (these are the innermost operations of the iterative solvers).
     if (variables_a->IsActive()) {
-        result += Cq_a * vect.segment(variables_a->GetOffset(), 6);
+        result += Cq_a * vect.segment<6>(variables_a->GetOffset());
     }
 
     if (variables_b->IsActive()) {
-        result += Cq_b * vect.segment(variables_b->GetOffset(), 6);
+        result += Cq_b * vect.segment<6>(variables_b->GetOffset());
     }
 }
 
 void ChConstraintTwoBodies::MultiplyTandAdd(ChVectorDynamic<double>& result, double l) {
     if (variables_a->IsActive()) {
-        result.segment(variables_a->GetOffset(), 6) += Cq_a.transpose() * l;
+        result.segment<6>(variables_a->GetOffset()) += Cq_a.transpose() * l;
     }
 
     if (variables_b->IsActive()) {
-        result.segment(variables_b->GetOffset(), 6) += Cq_b.transpose() * l;
+        result.segment<6>(variables_b->GetOffset()) += Cq_b.transpose() * l;
     }
 }
 
@@ -123,6 +123,11 @@ class ChConstraintTwoTuples : public ChConstraint {
         tuple_a.Build_CqT(storage, inscol);
         tuple_b.Build_CqT(storage, inscol);
     }
+
+    /// Tells if at least one of the variable objects of the two tuples is active.
+    virtual bool HasActiveVariables() const override {
+        return tuple_a.HasActiveVariables() || tuple_b.HasActiveVariables();
+    }
 };
 
 }  // end namespace chrono
@@ -14,6 +14,7 @@
 
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/solver/ChConstraintTwo.h"
 
 #define SPM_DEF_SPARSITY 0.9  ///< default predicted sparsity (in [0,1])
 
@@ -23,6 +24,8 @@ ChDirectSolverLS::ChDirectSolverLS()
     : m_lock(false),
       m_use_learner(true),
       m_force_update(true),
+      m_use_topology_detection(false),
+      m_structure_signature(0),
       m_null_pivot_detection(false),
       m_use_rhs_sparsity(false),
       m_use_perm(false),
@@ -46,30 +49,53 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     // Note that ChSystemDescriptor::UpdateCountsAndOffsets was already called at the beginning of the step.
     m_dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
 
+    // If topology detection is enabled, compare the signature of the current problem structure with that of the
+    // previous call; on a match, the sparsity pattern (and the symbolic analysis) can be reused.
+    bool pattern_unchanged = false;
+    if (m_use_topology_detection) {
+        size_t signature = ComputeStructureSignature(sysd);
+        pattern_unchanged = (m_setup_call > 0) && !m_force_update && (signature == m_structure_signature) &&
+                            (m_dim == (int)m_mat.rows());
+        m_structure_signature = signature;
+    }
+
     // If use of the sparsity pattern learner is enabled, call it if:
     // (a) an explicit update was requested (by default this is true at the first call), or
-    // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
-    bool call_learner = m_use_learner && (m_force_update || !m_lock);
+    // (b) the sparsity pattern is not locked nor known to be unchanged and so has to be re-evaluated at each call
+    bool call_learner = m_use_learner && (m_force_update || (!m_lock && !pattern_unchanged));
 
     // If use of the sparsity pattern learner is disabled, reserve space for nonzeros,
     // using the current sparsity level estimate, if:
     // (a) this is the first call to setup, or
-    // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
-    bool call_reserve = !m_use_learner && (m_setup_call == 0 || !m_lock);
+    // (b) the sparsity pattern is not locked nor known to be unchanged and so has to be re-evaluated at each call
+    bool call_reserve = !m_use_learner && (m_setup_call == 0 || (!m_lock && !pattern_unchanged));
 
     if (verbose) {
         GetLog() << "Solver setup\n";
         GetLog() << "  call number:    " << m_setup_call << "\n";
         GetLog() << "  use learner?    " << m_use_learner << "\n";
         GetLog() << "  pattern locked? " << m_lock << "\n";
+        GetLog() << "  same structure? " << pattern_unchanged << "\n";
         GetLog() << "  CALL learner:   " << call_learner << "\n";
         GetLog() << "  CALL reserve:   " << call_reserve << "\n";
     }
 
     if (call_learner) {
-        ChSparsityPatternLearner sparsity_pattern(m_dim, m_dim);
-        sysd.ConvertToMatrixForm(&sparsity_pattern, nullptr);
-        sparsity_pattern.Apply(m_mat);
+        if (m_symbolic && m_symbolic->m_dim == m_dim) {
+            // Shape the matrix directly from the imported symbolic data (indices copied, values zeroed),
+            // skipping the learning sweep
+            std::vector<ChSparseMatrix::Scalar> values(m_symbolic->m_inner.size(), 0);
+            m_mat = Eigen::Map<const ChSparseMatrix>(m_dim, m_dim, (int)m_symbolic->m_inner.size(),
+                                                     m_symbolic->m_outer.data(), m_symbolic->m_inner.data(),
+                                                     values.data());
+        } else if (m_pattern && m_pattern->rows() == m_dim && m_pattern->cols() == m_dim) {
+            // Reuse the supplied precomputed pattern, skipping the learning sweep
+            m_pattern->Apply(m_mat);
+        } else {
+            ChSparsityPatternLearner sparsity_pattern(m_dim, m_dim);
+            sysd.ConvertToMatrixForm(&sparsity_pattern, nullptr);
+            sparsity_pattern.Apply(m_mat);
+        }
         m_force_update = false;
     } else if (call_reserve) {
         double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
@@ -88,9 +114,10 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     if (write_matrix)
         WriteMatrix("LS_" + frame_id + "_A.dat", m_mat);
 
-    // Let the concrete solver perform the facorization
+    // Let the concrete solver perform the factorization.
+    // If the structure was detected as unchanged, only a numeric refactorization is needed.
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = pattern_unchanged ? FactorizeMatrixNumeric() : FactorizeMatrix();
     m_timer_setup_solvercall.stop();
 
     if (write_matrix)
@@ -153,6 +180,38 @@ double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
     return result;
 }
 
+bool ChDirectSolverLS::SetupNumeric(ChSystemDescriptor& sysd) {
+    m_timer_setup_assembly.start();
+
+    // Refill values into the existing sparsity pattern (ConvertToMatrixForm zeroes the stored values and stamps
+    // into existing nonzeros when the problem dimension is unchanged).
+    sysd.ConvertToMatrixForm(&m_mat, nullptr);
+
+    m_timer_setup_assembly.stop();
+
+    // Numeric-only refactorization, reusing the previous symbolic analysis
+    m_timer_setup_solvercall.start();
+    bool result = FactorizeMatrixNumeric();
+    m_timer_setup_solvercall.stop();
+
+    if (verbose) {
+        GetLog() << " Solver SetupNumeric() [" << m_setup_call << "] n = " << m_dim
+                 << "  nnz = " << (int)m_mat.nonZeros() << "\n";
+        GetLog() << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSecondsIntermediate() << "s\n"
+                 << "  factorize:         " << m_timer_setup_solvercall.GetTimeSecondsIntermediate() << "s\n";
+    }
+
+    m_setup_call++;
+
+    if (!result) {
+        // If the factorization failed, let the concrete solver display an error message.
+        GetLog() << "Solver SetupNumeric() failed\n";
+        PrintErrorMessage();
+    }
+
+    return result;
+}
+
 bool ChDirectSolverLS::SetupCurrent() {
     m_timer_setup_assembly.start();
 
@@ -184,6 +243,40 @@ bool ChDirectSolverLS::SetupCurrent() {
     return result;
 }
 
+bool ChDirectSolverLS::SetupCurrentNumeric() {
+    if (m_setup_call == 0)
+        return SetupCurrent();
+
+    m_timer_setup_assembly.start();
+
+    // Allow the matrix to be compressed, if not yet compressed
+    m_mat.makeCompressed();
+
+    m_timer_setup_assembly.stop();
+
+    // Numeric-only refactorization, reusing the previous symbolic analysis
+    m_timer_setup_solvercall.start();
+    bool result = FactorizeMatrixNumeric();
+    m_timer_setup_solvercall.stop();
+
+    if (verbose) {
+        GetLog() << " Solver SetupCurrentNumeric() [" << m_setup_call << "] n = " << m_dim
+                 << "  nnz = " << (int)m_mat.nonZeros() << "\n";
+        GetLog() << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSecondsIntermediate() << "s\n"
+                 << "  factorize:         " << m_timer_setup_solvercall.GetTimeSecondsIntermediate() << "s\n";
+    }
+
+    m_setup_call++;
+
+    if (!result) {
+        // If the factorization failed, let the concrete solver display an error message.
+        GetLog() << "Solver SetupCurrentNumeric() failed\n";
+        PrintErrorMessage();
+    }
+
+    return result;
+}
+
 double ChDirectSolverLS::SolveCurrent() {
     m_timer_solve_assembly.start();
     m_sol.resize(m_rhs.size());
@@ -212,6 +305,62 @@ double ChDirectSolverLS::SolveCurrent() {
 
 // ---------------------------------------------------------------------------
 
+std::shared_ptr<const ChDirectSolverLS::SymbolicData> ChDirectSolverLS::ExportSymbolicData() const {
+    if (m_setup_call == 0 || !m_mat.isCompressed())
+        return nullptr;
+
+    auto symbolic = std::shared_ptr<SymbolicData>(new SymbolicData);
+    symbolic->m_dim = m_dim;
+    symbolic->m_signature = m_structure_signature;
+    symbolic->m_outer.assign(m_mat.outerIndexPtr(), m_mat.outerIndexPtr() + m_mat.outerSize() + 1);
+    symbolic->m_inner.assign(m_mat.innerIndexPtr(), m_mat.innerIndexPtr() + m_mat.nonZeros());
+
+    return symbolic;
+}
+
+// ---------------------------------------------------------------------------
+
+size_t ChDirectSolverLS::ComputeStructureSignature(ChSystemDescriptor& sysd) const {
+    // FNV-1a style combination of the quantities that determine the sparsity pattern
+    auto combine = [](size_t& h, size_t v) { h = (h ^ v) * (size_t)1099511628211ULL; };
+    size_t h = (size_t)14695981039346656037ULL;
+
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChKblock*>& mstiffness = sysd.GetKblocksList();
+
+    combine(h, mvariables.size());
+    for (size_t iv = 0; iv < mvariables.size(); iv++) {
+        if (!mvariables[iv]->IsActive())
+            continue;
+        combine(h, (size_t)mvariables[iv]->GetOffset());
+        combine(h, (size_t)mvariables[iv]->Get_ndof());
+    }
+
+    combine(h, mconstraints.size());
+    for (size_t ic = 0; ic < mconstraints.size(); ic++) {
+        if (!mconstraints[ic]->IsActive())
+            continue;
+        // For two-object constraints, hash the offsets of the connected variable blocks, which determine the
+        // position of the constraint Jacobian blocks; for other constraint types, fall back on object identity.
+        if (auto mcon2 = dynamic_cast<ChConstraintTwo*>(mconstraints[ic])) {
+            combine(h, (size_t)mcon2->GetVariables_a()->GetOffset());
+            combine(h, (size_t)mcon2->GetVariables_b()->GetOffset());
+        } else {
+            combine(h, (size_t)mconstraints[ic]);
+        }
+    }
+
+    combine(h, mstiffness.size());
+    for (size_t ik = 0; ik < mstiffness.size(); ik++) {
+        combine(h, (size_t)mstiffness[ik]);
+    }
+
+    return h;
+}
+
+// ---------------------------------------------------------------------------
+
 void ChDirectSolverLS::WriteMatrix(const std::string& filename, const ChSparseMatrix& M) {
     ChStreamOutAsciiFile file(filename.c_str());
     file.SetNumFormat("%.12g");
@@ -269,6 +418,11 @@ bool ChSolverSparseLU::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseLU::FactorizeMatrixNumeric() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseLU::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
@@ -298,6 +452,11 @@ bool ChSolverSparseQR::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseQR::FactorizeMatrixNumeric() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseQR::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
@@ -21,8 +21,12 @@
 
 #include <Eigen/SparseLU>
 
+#include <memory>
+
 namespace chrono {
 
+class ChSparsityPatternLearner;
+
 /// @addtogroup chrono_solver
 /// @{
 
@@ -76,6 +80,29 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
         STRUCTURAL_SYMMETRIC  ///< structurally symmetric
     };
 
+    /// Immutable snapshot of the symbolic setup of a solver: problem dimension, structure signature, and the
+    /// sparsity pattern of the assembled problem matrix. Being immutable after creation, a single snapshot can be
+    /// safely shared (through the const shared pointer returned by ExportSymbolicData) by the solvers of any number
+    /// of systems running concurrently.
+    class ChApi SymbolicData {
+      public:
+        /// Return the problem dimension for which this symbolic data was created.
+        int GetDimension() const { return m_dim; }
+
+        /// Return the number of nonzeros in the stored sparsity pattern.
+        int GetNumNonZeros() const { return (int)m_inner.size(); }
+
+      private:
+        SymbolicData() : m_dim(0), m_signature(0) {}
+
+        int m_dim;                 ///< problem dimension
+        size_t m_signature;        ///< signature of the problem structure
+        std::vector<int> m_outer;  ///< CSR row pointers of the problem matrix
+        std::vector<int> m_inner;  ///< CSR column indices of the problem matrix
+
+        friend class ChDirectSolverLS;
+    };
+
     virtual ~ChDirectSolverLS() {}
 
     /// Enable/disable locking the sparsity pattern (default: false).\n
@@ -92,10 +119,40 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
     void ForceSparsityPatternUpdate() { m_force_update = true; }
 
+    /// Enable/disable automatic detection of an unchanged problem structure (default: false).\n
+    /// If enabled, Setup computes a cheap signature of the problem structure (active variables and their offsets,
+    /// constraint and stiffness blocks); whenever the signature matches that of the previous call, sparsity pattern
+    /// identification is skipped and a numeric-only refactorization is performed, reusing the previous symbolic
+    /// analysis. Unlike #LockSparsityPattern(), this remains safe when bodies, links, or contacts are added or
+    /// removed during the simulation, at the cost of one pass over the variable and constraint lists per call.
+    void UseTopologyDetection(bool val) { m_use_topology_detection = val; }
+
     /// Set estimate for matrix sparsity, a value in [0,1], with 0 indicating a fully dense matrix (default: 0.9).\n
     /// Only used if the sparsity pattern learner is disabled.
     void SetSparsityEstimate(double sparsity) { m_sparsity = sparsity; }
 
+    /// Provide a precomputed sparsity pattern (default: none).\n
+    /// Whenever the sparsity pattern has to be (re-)evaluated and the supplied pattern matches the problem size,
+    /// it is applied directly and the learning sweep over the system descriptor is skipped. This allows the
+    /// pattern learned on one system to be shared by the solvers of any number of systems built from the same
+    /// model. Pass a null pointer to revert to learning the pattern from the system descriptor.
+    void SetSparsityPattern(std::shared_ptr<ChSparsityPatternLearner> pattern) { m_pattern = pattern; }
+
+    /// Export the symbolic data of this solver (problem dimension, structure signature, and matrix sparsity
+    /// pattern), for reuse by the solvers of other systems built from the same model.\n
+    /// Valid only after at least one successful call to #Setup(); returns a null pointer otherwise.
+    std::shared_ptr<const SymbolicData> ExportSymbolicData() const;
+
+    /// Import symbolic data exported from another solver instance (default: none).\n
+    /// Whenever the sparsity pattern has to be (re-)evaluated and the imported data matches the problem size, the
+    /// problem matrix is shaped directly from the stored pattern, skipping both the learning sweep over the system
+    /// descriptor and the incremental nonzero allocations of the first assembly. Intended for many-system studies
+    /// (e.g. Monte Carlo campaigns) where thousands of short-lived systems share an identical structure; combine
+    /// with #LockSparsityPattern() so that each solver pays the pattern cost only once. Note that the factorization
+    /// engine still performs its own symbolic analysis on its first factorization. Pass a null pointer to revert to
+    /// learning the pattern from the system descriptor.
+    void ImportSymbolicData(std::shared_ptr<const SymbolicData> symbolic) { m_symbolic = symbolic; }
+
     /// Set the matrix symmetry type (default: GENERAL).
     virtual void SetMatrixSymmetryType(MatrixSymmetryType symmetry) { m_symmetry = symmetry; }
 
@@ -149,12 +206,25 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Here, sysd is the system description with constraints and variables.
     virtual double Solve(ChSystemDescriptor& sysd) override;
 
+    /// Numeric-only setup.
+    /// Refill the values of the problem matrix into the existing sparsity pattern and perform a numeric-only
+    /// refactorization, reusing the symbolic analysis of the previous #Setup() call. The caller is responsible for
+    /// guaranteeing that the problem structure is unchanged since that call (e.g. only material properties or
+    /// stiffness block values changed); no check is performed here. Returns true if successful.
+    virtual bool SetupNumeric(ChSystemDescriptor& sysd);
+
     /// Generic setup-solve without passing through the ChSystemDescriptor,
     /// in cases where a sparse matrix has been already assembled.
     /// Performs the solver setup operations, assuming someone
     /// has already filled A() matrix before calling this.
     virtual bool SetupCurrent();
 
+    /// Numeric-only variant of #SetupCurrent(): refactorize the already-assembled A() matrix reusing the
+    /// symbolic analysis of the previous factorization. The caller is responsible for guaranteeing that the
+    /// sparsity pattern of A() is unchanged since that factorization (only values changed); no check is
+    /// performed here. Falls back to a full #SetupCurrent() if nothing was factorized yet.
+    virtual bool SetupCurrentNumeric();
+
     /// Generic setup-solve without passing through the ChSystemDescriptor,
     /// in cases where the a sparse matrix has been already assembled.
     /// Here, sysd is the system description with constraints and variables.
@@ -175,6 +245,11 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() = 0;
 
+    /// Numeric-only factorization of the current sparse matrix, reusing the symbolic analysis performed by the last
+    /// call to FactorizeMatrix. Only called when the sparsity pattern is known to be unchanged. A concrete direct
+    /// sparse solver may or may not support this feature; the default falls back on a full factorization.
+    virtual bool FactorizeMatrixNumeric() { return FactorizeMatrix(); }
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() = 0;
@@ -197,9 +272,13 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     int m_solve_call;  ///< counter for calls to Solve
     int m_setup_call;  ///< counter for calls to Setup
 
-    bool m_lock;          ///< is the matrix sparsity pattern locked?
-    bool m_use_learner;   ///< use the sparsity pattern learner?
-    bool m_force_update;  ///< force a call to the sparsity pattern learner?
+    bool m_lock;                    ///< is the matrix sparsity pattern locked?
+    bool m_use_learner;             ///< use the sparsity pattern learner?
+    std::shared_ptr<ChSparsityPatternLearner> m_pattern;  ///< user-supplied precomputed sparsity pattern
+    std::shared_ptr<const SymbolicData> m_symbolic;       ///< symbolic data imported from another solver
+    bool m_force_update;            ///< force a call to the sparsity pattern learner?
+    bool m_use_topology_detection;  ///< detect unchanged problem structure and refactorize numerically?
+    size_t m_structure_signature;   ///< signature of the problem structure at the last Setup call
 
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
@@ -211,6 +290,10 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChTimer m_timer_solve_solvercall;  ///< timer for solution
 
   private:
+    /// Compute a signature of the problem structure (active variables with their offsets and sizes, constraint
+    /// blocks, stiffness blocks). Two problems with the same signature produce the same sparsity pattern.
+    size_t ComputeStructureSignature(ChSystemDescriptor& sysd) const;
+
     void WriteMatrix(const std::string& filename, const ChSparseMatrix& M);
     void WriteVector(const std::string& filename, const ChVectorDynamic<double>& v);
 };
@@ -231,6 +314,9 @@ class ChApi ChSolverSparseLU : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Numeric-only factorization, reusing the symbolic analysis of the last full factorization.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -256,6 +342,9 @@ class ChApi ChSolverSparseQR : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Numeric-only factorization, reusing the symbolic analysis of the last full factorization.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
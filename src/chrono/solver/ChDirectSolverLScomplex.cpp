@@ -20,8 +20,9 @@
 namespace chrono {
 
 ChDirectSolverLScomplex::ChDirectSolverLScomplex()
-    : m_dim(0)
-       {}
+    : m_dim(0),
+      m_lock(false),
+      m_setup_call(0) {}
 
 
 bool ChDirectSolverLScomplex::Setup() {
@@ -29,8 +30,11 @@ bool ChDirectSolverLScomplex::Setup() {
     // Allow the matrix to be compressed, if not yet compressed
     m_mat.makeCompressed();
 
-    // Let the concrete solver perform the factorization
-    bool result = FactorizeMatrix();
+    // Let the concrete solver perform the factorization.
+    // If the sparsity pattern is locked, all but the first call need only a numeric refactorization.
+    bool result = (m_lock && m_setup_call > 0) ? FactorizeMatrixNumeric() : FactorizeMatrix();
+
+    m_setup_call++;
 
     if (verbose) {
         GetLog() << " Solver Setup()  n = " << m_dim
@@ -75,6 +79,11 @@ bool ChSolverSparseComplexLU::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseComplexLU::FactorizeMatrixNumeric() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseComplexLU::SolveSystem(const ChVectorDynamic<std::complex<double>>& b) {
     m_sol = m_engine.solve(b);
     return (m_engine.info() == Eigen::Success);
@@ -104,6 +113,11 @@ bool ChSolverSparseComplexQR::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseComplexQR::FactorizeMatrixNumeric() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseComplexQR::SolveSystem(const ChVectorDynamic<std::complex<double>>& b) {
     m_sol = m_engine.solve(b);
     return (m_engine.info() == Eigen::Success);
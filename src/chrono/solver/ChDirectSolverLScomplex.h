@@ -41,6 +41,13 @@ class ChApi ChDirectSolverLScomplex  {
     
     virtual ~ChDirectSolverLScomplex() {}
 
+    /// Enable/disable locking the sparsity pattern (default: false).\n
+    /// If enabled, only the first call to Setup() performs the full (symbolic + numeric) factorization; subsequent
+    /// calls refactorize numerically, reusing the symbolic analysis. Enable this option when the same matrix
+    /// structure is factorized repeatedly with different values, e.g. the shift-and-invert operator evaluated at
+    /// successive complex shifts during Krylov-Schur iterations.
+    void LockSparsityPattern(bool val) { m_lock = val; }
+
     /// Get shortcut handle to underlying A matrix, for A*x=b
     Eigen::SparseMatrix<std::complex<double>, Eigen::ColMajor>& A() { return m_mat; }
 
@@ -62,6 +69,11 @@ class ChApi ChDirectSolverLScomplex  {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() = 0;
 
+    /// Numeric-only factorization of the current sparse matrix, reusing the symbolic analysis performed by the last
+    /// call to FactorizeMatrix. Only called when the sparsity pattern is known to be unchanged. A concrete direct
+    /// sparse solver may or may not support this feature; the default falls back on a full factorization.
+    virtual bool FactorizeMatrixNumeric() { return FactorizeMatrix(); }
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem(const ChVectorDynamic<std::complex<double>>& b) = 0;
@@ -70,9 +82,11 @@ class ChApi ChDirectSolverLScomplex  {
     /// This function is only called if Factorize or Solve returned false.
     virtual void PrintErrorMessage() = 0;
 
-   
+
     Eigen::SparseMatrix<std::complex<double>, Eigen::ColMajor> m_mat;           ///< problem matrix
     int m_dim;                      ///< problem size
+    bool m_lock;                    ///< is the matrix sparsity pattern locked?
+    int m_setup_call;               ///< counter for calls to Setup
     ChVectorDynamic<std::complex<double>> m_sol;  ///< solution vector
 };
 
@@ -91,6 +105,9 @@ class ChApi ChSolverSparseComplexLU : public ChDirectSolverLScomplex {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Numeric-only factorization, reusing the symbolic analysis of the last full factorization.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem(const ChVectorDynamic<std::complex<double>>& b) override;
@@ -115,6 +132,9 @@ class ChApi ChSolverSparseComplexQR : public ChDirectSolverLScomplex {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Numeric-only factorization, reusing the symbolic analysis of the last full factorization.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem(const ChVectorDynamic<std::complex<double>>& b) override;
@@ -88,12 +88,13 @@ class ChDiagonalPreconditioner {
     typedef int StorageIndex;
     enum { ColsAtCompileTime = Eigen::Dynamic, MaxColsAtCompileTime = Eigen::Dynamic };
 
-    ChDiagonalPreconditioner() : m_N(0), m_diag_precond(false), m_invdiag(nullptr) {}
+    ChDiagonalPreconditioner() : m_N(0), m_diag_precond(false), m_invdiag(nullptr), m_custom(nullptr) {}
 
-    void Setup(Eigen::Index N, const ChVectorDynamic<>& invdiag) {
+    void Setup(Eigen::Index N, const ChVectorDynamic<>& invdiag, ChIterativeSolverPreconditioner* custom = nullptr) {
         m_N = N;
         m_invdiag = &invdiag;
         m_diag_precond = (invdiag.size() > 0);
+        m_custom = custom;
     }
 
     Eigen::Index rows() const { return m_N; }
@@ -114,7 +115,13 @@ class ChDiagonalPreconditioner {
 
     template <typename Rhs, typename Dest>
     void _solve_impl(const Rhs& b, Dest& x) const {
-        if (m_diag_precond) {
+        if (m_custom) {
+            // Delegate to the installed plug-in preconditioner (through dense workspace vectors)
+            m_r = b;
+            m_z.resize(m_r.size());
+            m_custom->Apply(m_r, m_z);
+            x = m_z;
+        } else if (m_diag_precond) {
             x = m_invdiag->array() * b.array();
         } else {
             x = b;
@@ -129,9 +136,12 @@ class ChDiagonalPreconditioner {
     Eigen::ComputationInfo info() { return Eigen::Success; }
 
   protected:
-    Eigen::Index m_N;                    // problem dimension
-    const ChVectorDynamic<>* m_invdiag;  // pointer to (invcerse) diagonal entries
-    bool m_diag_precond;                 // if false, no preconditioning
+    Eigen::Index m_N;                             // problem dimension
+    const ChVectorDynamic<>* m_invdiag;           // pointer to (invcerse) diagonal entries
+    bool m_diag_precond;                          // if false, no preconditioning
+    ChIterativeSolverPreconditioner* m_custom;    // plug-in preconditioner (overrides diagonal scaling)
+    mutable ChVectorDynamic<> m_r;                // workspace for the plug-in preconditioner input
+    mutable ChVectorDynamic<> m_z;                // workspace for the plug-in preconditioner output
 };
 
 }  // namespace chrono
@@ -172,7 +182,7 @@ CH_FACTORY_REGISTER(ChSolverGMRES)
 CH_FACTORY_REGISTER(ChSolverBiCGSTAB)
 CH_FACTORY_REGISTER(ChSolverMINRES)
 
-ChIterativeSolverLS::ChIterativeSolverLS() : ChIterativeSolver(-1, -1.0, true, false) {
+ChIterativeSolverLS::ChIterativeSolverLS() : ChIterativeSolver(-1, -1.0, true, false), m_precond_ready(false) {
     m_spmv = new ChMatrixSPMV();
 }
 
@@ -199,6 +209,15 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
         }
     }
 
+    // If a custom preconditioner was specified, let it prepare for the current system.
+    // On failure, revert to diagonal preconditioning for this step.
+    m_precond_ready = false;
+    if (m_use_precond && m_precond) {
+        m_precond_ready = m_precond->Setup(sysd, dim);
+        if (!m_precond_ready && verbose)
+            std::cout << "  Custom preconditioner setup failed; using diagonal preconditioner" << std::endl;
+    }
+
     // If needed, evaluate the initial guess
     if (m_warm_start) {
         m_initguess.resize(dim);
@@ -215,6 +234,10 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
     return result;
 }
 
+ChIterativeSolverPreconditioner* ChIterativeSolverLS::GetCurrentPreconditioner() const {
+    return m_precond_ready ? m_precond.get() : nullptr;
+}
+
 double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
     // Assemble the problem right-hand side vector
     sysd.ConvertToMatrixForm(nullptr, &m_rhs);
@@ -240,6 +263,104 @@ double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
     return result;
 }
 
+// ---------------------------------------------------------------------------
+// Built-in plug-in preconditioners
+// ---------------------------------------------------------------------------
+
+bool ChBlockJacobiPreconditioner::Setup(ChSystemDescriptor& sysd, int dim) {
+    // Assemble the system matrix
+    ChSparseMatrix Z;
+    sysd.ConvertToMatrixForm(&Z, nullptr);
+
+    // Guarded inverse diagonal (used for the constraint rows and for singular variable blocks)
+    m_invdiag.resize(dim);
+    sysd.BuildDiagonalVector(m_invdiag);
+    for (int i = 0; i < dim; i++) {
+        if (std::abs(m_invdiag(i)) > 1e-9)
+            m_invdiag(i) = 1.0 / m_invdiag(i);
+        else
+            m_invdiag(i) = 1.0;
+    }
+
+    // Extract and invert the diagonal block of each active variable object
+    m_blocks.clear();
+    for (const auto& var : sysd.GetVariablesList()) {
+        if (!var->IsActive())
+            continue;
+        int offset = var->GetOffset();
+        int ndof = var->Get_ndof();
+        if (ndof <= 1)
+            continue;
+        ChMatrixDynamic<> block(ndof, ndof);
+        for (int i = 0; i < ndof; i++)
+            for (int j = 0; j < ndof; j++)
+                block(i, j) = Z.coeff(offset + i, offset + j);
+        Eigen::FullPivLU<ChMatrixDynamic<>> lu(block);
+        if (lu.isInvertible())
+            m_blocks.emplace_back(offset, lu.inverse());
+    }
+
+    return true;
+}
+
+void ChBlockJacobiPreconditioner::Apply(const ChVectorDynamic<>& r, ChVectorDynamic<>& z) {
+    z = m_invdiag.array() * r.array();
+    for (const auto& block : m_blocks) {
+        auto ndof = block.second.rows();
+        z.segment(block.first, ndof) = block.second * r.segment(block.first, ndof);
+    }
+}
+
+// ---------------------------------------------------------------------------
+
+ChSSORPreconditioner::ChSSORPreconditioner(double omega) : m_omega(omega) {}
+
+bool ChSSORPreconditioner::Setup(ChSystemDescriptor& sysd, int dim) {
+    // Assemble the system matrix
+    ChSparseMatrix Z;
+    sysd.ConvertToMatrixForm(&Z, nullptr);
+
+    // Guarded matrix diagonal (zero entries, e.g. from non-compliant constraints, are replaced with 1)
+    m_diag.resize(dim);
+    for (int i = 0; i < dim; i++) {
+        double d = Z.coeff(i, i);
+        m_diag(i) = (std::abs(d) > 1e-9) ? d : 1.0;
+    }
+
+    // Build the two triangular factors, overwriting their diagonals with the scaled guarded diagonal
+    m_lower = Z.triangularView<Eigen::Lower>();
+    m_upper = Z.triangularView<Eigen::Upper>();
+    for (int i = 0; i < dim; i++) {
+        m_lower.coeffRef(i, i) = m_diag(i) / m_omega;
+        m_upper.coeffRef(i, i) = m_diag(i) / m_omega;
+    }
+
+    return true;
+}
+
+void ChSSORPreconditioner::Apply(const ChVectorDynamic<>& r, ChVectorDynamic<>& z) {
+    // z = omega * (2 - omega) * (D/omega + U)^(-1) * D * (D/omega + L)^(-1) * r
+    z = m_lower.triangularView<Eigen::Lower>().solve(r);
+    z.array() *= m_diag.array();
+    z = m_upper.triangularView<Eigen::Upper>().solve(z);
+    z *= m_omega * (2 - m_omega);
+}
+
+// ---------------------------------------------------------------------------
+
+bool ChIncompleteCholeskyPreconditioner::Setup(ChSystemDescriptor& sysd, int dim) {
+    // Assemble the system matrix (the sparsity pattern is reused across calls whenever it is unchanged)
+    sysd.ConvertToMatrixForm(&m_Z, nullptr);
+
+    // Attempt the incomplete factorization; this fails if the matrix is not positive definite
+    m_engine.compute(m_Z);
+    return (m_engine.info() == Eigen::Success);
+}
+
+void ChIncompleteCholeskyPreconditioner::Apply(const ChVectorDynamic<>& r, ChVectorDynamic<>& z) {
+    z = m_engine.solve(r);
+}
+
 // ---------------------------------------------------------------------------
 
 ChSolverGMRES::ChSolverGMRES() {
@@ -251,7 +372,7 @@ ChSolverGMRES::~ChSolverGMRES() {
 }
 
 bool ChSolverGMRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag, GetCurrentPreconditioner());
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -296,7 +417,7 @@ ChSolverBiCGSTAB::~ChSolverBiCGSTAB() {
 }
 
 bool ChSolverBiCGSTAB::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag, GetCurrentPreconditioner());
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -342,7 +463,7 @@ ChSolverMINRES::~ChSolverMINRES() {
 }
 
 bool ChSolverMINRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag, GetCurrentPreconditioner());
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -27,6 +27,8 @@
 #ifndef CH_ITERATIVESOLVER_LS_H
 #define CH_ITERATIVESOLVER_LS_H
 
+#include <memory>
+
 #include "chrono/solver/ChSolverLS.h"
 #include "chrono/solver/ChIterativeSolver.h"
 
@@ -46,6 +48,77 @@ class ChDiagonalPreconditioner;
 
 // ---------------------------------------------------------------------------
 
+/// Base class for plug-in preconditioners for the Eigen-based iterative solvers.
+/// A preconditioner approximates the action of the inverse of the system matrix on a vector. Derived classes must
+/// prepare any factorization data in Setup() (called once per solver setup, whenever the system matrix may have
+/// changed) and apply it in Apply(). Install a preconditioner on a solver with ChIterativeSolverLS::SetPreconditioner.
+class ChApi ChIterativeSolverPreconditioner {
+  public:
+    virtual ~ChIterativeSolverPreconditioner() {}
+
+    /// Prepare the preconditioner for the system currently loaded in the given descriptor.
+    /// Here, dim is the problem dimension (number of active variables plus number of active constraints).
+    /// Return false on failure; in that case the solver reverts to diagonal preconditioning for the current step.
+    virtual bool Setup(ChSystemDescriptor& sysd, int dim) = 0;
+
+    /// Apply the preconditioner: z = M^(-1) * r.
+    /// The output vector is already sized to the problem dimension.
+    virtual void Apply(const ChVectorDynamic<>& r, ChVectorDynamic<>& z) = 0;
+};
+
+/// Block-Jacobi preconditioner.
+/// Inverts the diagonal blocks of the system matrix associated with the individual variable objects (e.g. the 6x6
+/// blocks of rigid bodies) and uses the guarded inverse diagonal for the constraint rows. More effective than plain
+/// diagonal scaling whenever the variable blocks have significant off-diagonal coupling (e.g. non-diagonal inertia
+/// tensors or stiffness blocks from FEA elements).
+class ChApi ChBlockJacobiPreconditioner : public ChIterativeSolverPreconditioner {
+  public:
+    virtual bool Setup(ChSystemDescriptor& sysd, int dim) override;
+    virtual void Apply(const ChVectorDynamic<>& r, ChVectorDynamic<>& z) override;
+
+  private:
+    std::vector<std::pair<int, ChMatrixDynamic<>>> m_blocks;  ///< offset and inverse of each variable block
+    ChVectorDynamic<> m_invdiag;                              ///< guarded inverse diagonal (constraint rows)
+};
+
+/// Symmetric successive over-relaxation (SSOR) preconditioner.
+/// Performs one forward and one backward Gauss-Seidel sweep on the assembled system matrix. Intended for use with
+/// ChSolverMINRES on symmetric problems; the relaxation factor omega must be in (0,2), with omega = 1 corresponding
+/// to symmetric Gauss-Seidel.
+class ChApi ChSSORPreconditioner : public ChIterativeSolverPreconditioner {
+  public:
+    ChSSORPreconditioner(double omega = 1.0);
+
+    /// Set the relaxation factor (default: 1).
+    void SetOmega(double omega) { m_omega = omega; }
+
+    virtual bool Setup(ChSystemDescriptor& sysd, int dim) override;
+    virtual void Apply(const ChVectorDynamic<>& r, ChVectorDynamic<>& z) override;
+
+  private:
+    double m_omega;            ///< relaxation factor
+    ChSparseMatrix m_lower;    ///< D/omega + strictly lower triangle of the system matrix
+    ChSparseMatrix m_upper;    ///< D/omega + strictly upper triangle of the system matrix
+    ChVectorDynamic<> m_diag;  ///< guarded matrix diagonal
+};
+
+/// Incomplete Cholesky preconditioner.
+/// Computes an incomplete Cholesky factorization (with dual threshold strategy) of the assembled system matrix.
+/// The most effective of the built-in preconditioners for ill-conditioned symmetric positive definite problems,
+/// at the cost of a more expensive setup phase. Setup() fails if the matrix is not positive definite, in which
+/// case the solver reverts to diagonal preconditioning.
+class ChApi ChIncompleteCholeskyPreconditioner : public ChIterativeSolverPreconditioner {
+  public:
+    virtual bool Setup(ChSystemDescriptor& sysd, int dim) override;
+    virtual void Apply(const ChVectorDynamic<>& r, ChVectorDynamic<>& z) override;
+
+  private:
+    Eigen::IncompleteCholesky<double> m_engine;  ///< Eigen incomplete Cholesky factorization
+    ChSparseMatrix m_Z;                          ///< assembled system matrix
+};
+
+// ---------------------------------------------------------------------------
+
 /** \class ChIterativeSolverLS
 \brief Base class for Chrono solvers based on Eigen iterative linear solvers.
 
@@ -61,13 +134,22 @@ The default value for the maximum number of iterations is twice the matrrix size
 The threshold value specified through #SetTolerance is used by the stopping criteria as an upper bound to the relative
 residual error: |Ax - b|/|b|. Default: machine precision.
 
-By default, these solvers use a diagonal preconditioner and no warm start. Recall that the warm start option should
-be used **only** in conjunction with the Euler implicit linearized integrator.
+By default, these solvers use a diagonal preconditioner and no warm start. A different preconditioner (one of the
+built-in ChIterativeSolverPreconditioner specializations or a user-supplied one) can be installed with
+#SetPreconditioner. Recall that the warm start option should be used **only** in conjunction with the Euler implicit
+linearized integrator.
 */
 class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
   public:
     virtual ~ChIterativeSolverLS();
 
+    /// Set a custom preconditioner (replacing the default diagonal preconditioner).
+    /// This can be one of the built-in preconditioners (ChBlockJacobiPreconditioner, ChSSORPreconditioner,
+    /// ChIncompleteCholeskyPreconditioner) or a user-supplied ChIterativeSolverPreconditioner. Pass an empty
+    /// pointer to revert to diagonal preconditioning. Note that the custom preconditioners assemble the system
+    /// matrix at each setup, thus trading a more expensive setup phase for a reduced iteration count.
+    void SetPreconditioner(std::shared_ptr<ChIterativeSolverPreconditioner> precond) { m_precond = precond; }
+
     /// Perform the solver setup operations.\n
     /// Here, sysd is the system description with constraints and variables.
     /// Returns true if successful and false otherwise.
@@ -90,11 +172,17 @@ class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveProblem() = 0;
 
+    /// Return the custom preconditioner to be used for the current step (null if diagonal preconditioning applies).
+    ChIterativeSolverPreconditioner* GetCurrentPreconditioner() const;
+
     ChMatrixSPMV* m_spmv;                 ///< matrix-like wrapper for SPMV operations
     ChVectorDynamic<double> m_sol;        ///< solution vector
     ChVectorDynamic<double> m_rhs;        ///< right-hand side vector
     ChVectorDynamic<double> m_invdiag;    ///< inverse diagonal entries (for preconditioning)
     ChVectorDynamic<double> m_initguess;  ///< initial guess (for warm start)
+
+    std::shared_ptr<ChIterativeSolverPreconditioner> m_precond;  ///< custom preconditioner (optional)
+    bool m_precond_ready;                                        ///< custom preconditioner setup succeeded
 };
 
 // ---------------------------------------------------------------------------
@@ -26,7 +26,14 @@ ChIterativeSolverVI::ChIterativeSolverVI()
       m_omega(1.0),
       m_shlambda(1.0),
       m_iterations(0),
-      record_violation_history(false) {}
+      m_mixed_precision(false),
+      m_fused_product(false),
+      record_violation_history(false),
+      m_telemetry_active(false),
+      m_telemetry_head(0),
+      m_telemetry_count(0) {
+    m_telemetry.resize(64);
+}
 
 void ChIterativeSolverVI::SetOmega(double mval) {
     if (mval > 0.)
@@ -39,6 +46,16 @@ void ChIterativeSolverVI::SetSharpnessLambda(double mval) {
 }
 
 void ChIterativeSolverVI::AtIterationEnd(double mmaxviolation, double mdeltalambda, unsigned int iternum) {
+    // Update the per-solve telemetry record (fixed cost, no allocations).
+    if (iternum == 0) {
+        PublishTelemetry();
+        m_telemetry_pending.warm_start_error = mmaxviolation;
+        m_telemetry_active = true;
+    }
+    m_telemetry_pending.iterations = (int)iternum + 1;
+    m_telemetry_pending.residual = mmaxviolation;
+    m_telemetry_pending.dlambda = mdeltalambda;
+
     if (!record_violation_history)
         return;
     if (iternum != violation_history.size()) {
@@ -53,6 +70,39 @@ void ChIterativeSolverVI::AtIterationEnd(double mmaxviolation, double mdeltalamb
     dlambda_history.push_back(mdeltalambda);
 }
 
+void ChIterativeSolverVI::PublishTelemetry() {
+    if (!m_telemetry_active)
+        return;
+    m_telemetry_active = false;
+
+    m_telemetry_pending.tolerance = m_tolerance;
+
+    m_telemetry[m_telemetry_head] = m_telemetry_pending;
+    m_telemetry_head = (m_telemetry_head + 1) % m_telemetry.size();
+    if (m_telemetry_count < m_telemetry.size())
+        m_telemetry_count++;
+
+    if (m_telemetry_callback)
+        m_telemetry_callback->OnSolveTelemetry(m_telemetry_pending);
+}
+
+void ChIterativeSolverVI::SetTelemetryHistorySize(size_t size) {
+    if (size < 1)
+        size = 1;
+    m_telemetry.clear();
+    m_telemetry.resize(size);
+    m_telemetry_head = 0;
+    m_telemetry_count = 0;
+}
+
+std::vector<ChIterativeSolverVI::SolveTelemetry> ChIterativeSolverVI::GetTelemetryHistory() const {
+    std::vector<SolveTelemetry> records(m_telemetry_count);
+    size_t start = (m_telemetry_head + m_telemetry.size() - m_telemetry_count) % m_telemetry.size();
+    for (size_t i = 0; i < m_telemetry_count; i++)
+        records[i] = m_telemetry[(start + i) % m_telemetry.size()];
+    return records;
+}
+
 void ChIterativeSolverVI::ArchiveOut(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChIterativeSolverVI>();
@@ -18,8 +18,31 @@
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
 
+#include <algorithm>
+
 namespace chrono {
 
+// Helpers comparing/recording the sparsity pattern of the (compressed) KKT matrix, so that successive solves
+// with an unchanged contact set can reuse the symbolic analysis and factorize numerically only.
+static bool SameFactorPattern(ChSparseMatrix& A, const std::vector<int>& pattern) {
+    A.makeCompressed();
+    size_t n_outer = (size_t)A.outerSize() + 1;
+    size_t n_inner = (size_t)A.nonZeros();
+    if (pattern.size() != n_outer + n_inner)
+        return false;
+    if (!std::equal(pattern.begin(), pattern.begin() + n_outer, A.outerIndexPtr()))
+        return false;
+    return std::equal(pattern.begin() + n_outer, pattern.end(), A.innerIndexPtr());
+}
+
+static void StoreFactorPattern(const ChSparseMatrix& A, std::vector<int>& pattern) {
+    size_t n_outer = (size_t)A.outerSize() + 1;
+    size_t n_inner = (size_t)A.nonZeros();
+    pattern.resize(n_outer + n_inner);
+    std::copy(A.outerIndexPtr(), A.outerIndexPtr() + n_outer, pattern.begin());
+    std::copy(A.innerIndexPtr(), A.innerIndexPtr() + n_inner, pattern.begin() + n_outer);
+}
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
     CH_FACTORY_REGISTER(ChSolverADMM)
 
@@ -274,7 +297,16 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
 
     m_timer_factorize.start();
 
-    LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+    // LU decomposition ++++++++++++++++++++++++++++++++++++++
+    // If the contact set did not change since the last solve, the KKT matrix has the same sparsity
+    // pattern, so the symbolic analysis of the previous factorization can be reused and only the
+    // numerical factorization is redone.
+    if (SameFactorPattern(LS_solver->A(), factor_pattern)) {
+        LS_solver->SetupCurrentNumeric();
+    } else {
+        LS_solver->SetupCurrent();
+        StoreFactorPattern(LS_solver->A(), factor_pattern);
+    }
 
     m_timer_factorize.stop();
     if (this->verbose)
@@ -439,7 +471,9 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
                 for (int i = 0; i < nc; ++i)
                     LS_solver->A().coeffRef(nv + i, nv + i) += -(sigma + vrho(i));
 
-                LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+                // Only diagonal values changed: pattern is unchanged by construction, so reuse the
+                // symbolic analysis and refactorize numerically only.
+                LS_solver->SetupCurrentNumeric();  // LU decomposition +++++++++++++++++++++++++++++
 
                 m_timer_refactorize.stop();
                 if (this->verbose) GetLog() << " Time for re-factorize : << " << m_timer_refactorize.GetTimeSecondsIntermediate() << "s\n";
@@ -679,8 +713,17 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     if (this->verbose) GetLog() << " Time for ConvertToMatrixForm: << " << m_timer_convert.GetTimeSecondsIntermediate() << "s\n";
 
     m_timer_factorize.start();
-                
-    LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+
+    // LU decomposition ++++++++++++++++++++++++++++++++++++++
+    // If the contact set did not change since the last solve, the KKT matrix has the same sparsity
+    // pattern, so the symbolic analysis of the previous factorization can be reused and only the
+    // numerical factorization is redone.
+    if (SameFactorPattern(LS_solver->A(), factor_pattern)) {
+        LS_solver->SetupCurrentNumeric();
+    } else {
+        LS_solver->SetupCurrent();
+        StoreFactorPattern(LS_solver->A(), factor_pattern);
+    }
 
     m_timer_factorize.stop();
     if (this->verbose) GetLog() << " Time for factorize : << " << m_timer_factorize.GetTimeSecondsIntermediate() << "s\n";
@@ -861,9 +904,11 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
                 // To avoid rebuilding A, we just removed the rho step from the diagonal in A), and now: 
                 // B) add old rho with += :
                 for (int i = 0; i < nc; ++i)
-                    LS_solver->A().coeffRef(nv + i, nv + i) += -(sigma + vrho(i));  
+                    LS_solver->A().coeffRef(nv + i, nv + i) += -(sigma + vrho(i));
 
-                LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+                // Only diagonal values changed: pattern is unchanged by construction, so reuse the
+                // symbolic analysis and refactorize numerically only.
+                LS_solver->SetupCurrentNumeric();  // LU decomposition +++++++++++++++++++++++++++++
 
                 m_timer_refactorize.stop();
                 if (this->verbose) GetLog() << " Time for re-factorize : << " << m_timer_refactorize.GetTimeSecondsIntermediate() << "s\n";
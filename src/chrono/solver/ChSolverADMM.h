@@ -144,6 +144,7 @@ class ChApi ChSolverADMM : public ChIterativeSolverVI {
     AdmmAcceleration acceleration;
 
     std::shared_ptr<ChDirectSolverLS> LS_solver;
+    std::vector<int> factor_pattern;  ///< sparsity pattern of the last factorized KKT matrix (outer + inner indices)
     //Eigen::SparseQR<ChSparseMatrix, Eigen::COLAMDOrdering<int>> m_engine;  ///< Eigen SparseQR solver (do not use SparseLU: it is broken!)
     // SparseLU: it is broken!)
     /// Performs basic ADMM, as in solve_kkt_ADMMbasic.m prototype 
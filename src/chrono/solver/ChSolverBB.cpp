@@ -126,8 +126,11 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
 
     // Optimization: backup the  q  sparse data computed above,
     // because   (M^-1)*k   will be needed at the end when computing primals.
-    ChVectorDynamic<> mq;
-    sysd.FromVariablesToVector(mq, true);
+    // The backup lives in the descriptor scratch arena, so that small systems
+    // stepped at high rates do not pay a heap allocation per solve.
+    int nq = sysd.CountActiveVariables();
+    double* mq = sysd.AcquireScratch(nq);
+    sysd.FromVariablesToBuffer(mq);
 
     // Initialize lambdas
     if (m_warm_start)
@@ -332,7 +335,8 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
     // compute the primal variables as   v = (M^-1)(k + D*l)
 
     // v = (M^-1)*k  ...    (by rewinding to the backup vector computed ad the beginning)
-    sysd.FromVectorToVariables(mq);
+    sysd.FromBufferToVariables(mq);
+    sysd.ReleaseScratch(nq);
 
     // ... + (M^-1)*D*l     (this increment and also stores 'qb' in the ChVariable items)
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
@@ -0,0 +1,210 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "chrono/solver/ChSolverIslands.h"
+#include "chrono/solver/ChSolverAPGD.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+ChSolverIslands::ChSolverIslands(InnerSolverType inner_type)
+    : m_inner_type(inner_type), m_num_islands(0), m_error(0) {}
+
+std::shared_ptr<ChIterativeSolverVI> ChSolverIslands::CreateInnerSolver() const {
+    std::shared_ptr<ChIterativeSolverVI> solver;
+    switch (m_inner_type) {
+        case InnerSolverType::PSOR:
+            solver = chrono_types::make_shared<ChSolverPSOR>();
+            break;
+        case InnerSolverType::APGD:
+            solver = chrono_types::make_shared<ChSolverAPGD>();
+            break;
+    }
+    solver->SetMaxIterations(m_max_iterations);
+    solver->SetTolerance(m_tolerance);
+    solver->SetOmega(m_omega);
+    solver->SetSharpnessLambda(m_shlambda);
+    solver->EnableDiagonalPreconditioner(m_use_precond);
+    solver->EnableWarmStart(m_warm_start);
+    solver->SetMixedPrecision(m_mixed_precision);
+    return solver;
+}
+
+double ChSolverIslands::SolveMonolithic(ChSystemDescriptor& sysd) {
+    auto solver = CreateInnerSolver();
+    m_num_islands = 1;
+    m_error = solver->Solve(sysd);
+    m_iterations = solver->GetIterations();
+    return m_error;
+}
+
+double ChSolverIslands::Solve(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    // Stiffness blocks couple variables outside the constraint jacobian, so the constraint-variable
+    // graph would miss part of the coupling; solve monolithically in that case (and when there are
+    // no constraints to decompose on).
+    if (!sysd.GetKblocksList().empty() || mconstraints.empty())
+        return SolveMonolithic(sysd);
+
+    int n_q = sysd.CountActiveVariables();
+    int n_vars = (int)mvariables.size();
+    int n_constr = (int)mconstraints.size();
+
+    // Map global column index -> index in the variables list.
+    std::vector<int> col_to_var(n_q);
+    for (int iv = 0; iv < n_vars; iv++) {
+        if (!mvariables[iv]->IsActive())
+            continue;
+        int off = mvariables[iv]->GetOffset();
+        for (int k = 0; k < mvariables[iv]->Get_ndof(); k++)
+            col_to_var[off + k] = iv;
+    }
+
+    // Union-find over the variables; constraints merge the components of all variables they touch.
+    // The coupling pattern is read off the assembled constraint jacobian, which covers every
+    // constraint type without requiring per-type knowledge of the referenced variables.
+    std::vector<int> parent(n_vars);
+    for (int iv = 0; iv < n_vars; iv++)
+        parent[iv] = iv;
+    std::function<int(int)> find_root = [&](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    ChSparseMatrix Cq;
+    sysd.ConvertToMatrixForm(&Cq, nullptr, nullptr, nullptr, nullptr, nullptr);
+
+    // Active constraints, in list order (matching the row order of the assembled jacobian).
+    std::vector<int> row_to_constr;
+    row_to_constr.reserve(Cq.rows());
+    for (int ic = 0; ic < n_constr; ic++) {
+        if (mconstraints[ic]->IsActive())
+            row_to_constr.push_back(ic);
+    }
+
+    for (int row = 0; row < Cq.outerSize(); row++) {
+        int first_var = -1;
+        for (ChSparseMatrix::InnerIterator it(Cq, row); it; ++it) {
+            int var = col_to_var[it.col()];
+            if (first_var < 0) {
+                first_var = var;
+            } else {
+                int ra = find_root(first_var);
+                int rb = find_root(var);
+                if (ra != rb)
+                    parent[rb] = ra;
+            }
+        }
+    }
+
+    // Enumerate the islands. Components touched by at least one constraint each become an island;
+    // all remaining (constraint-free) variables are lumped in one extra "free" island.
+    std::vector<int> island_of_root(n_vars, -1);
+    int num_islands = 0;
+    for (int row = 0; row < Cq.outerSize(); row++) {
+        ChSparseMatrix::InnerIterator it(Cq, row);
+        if (!it)
+            continue;
+        int root = find_root(col_to_var[it.col()]);
+        if (island_of_root[root] < 0)
+            island_of_root[root] = num_islands++;
+    }
+
+    if (num_islands <= 1)
+        return SolveMonolithic(sysd);
+
+    int free_island = num_islands;
+    bool has_free_vars = false;
+
+    // Build the per-island descriptors, preserving the relative order of variables and constraints
+    // (the friction constraint triplets of a contact must stay in sequence for the VI solvers).
+    std::vector<std::unique_ptr<ChSystemDescriptor>> islands;
+    for (int i = 0; i <= num_islands; i++) {
+        islands.push_back(std::unique_ptr<ChSystemDescriptor>(new ChSystemDescriptor));
+        islands.back()->BeginInsertion();
+        islands.back()->SetMassFactor(sysd.GetMassFactor());
+    }
+
+    for (int iv = 0; iv < n_vars; iv++) {
+        if (!mvariables[iv]->IsActive())
+            continue;
+        int island = island_of_root[find_root(iv)];
+        if (island < 0) {
+            island = free_island;
+            has_free_vars = true;
+        }
+        islands[island]->InsertVariables(mvariables[iv]);
+    }
+
+    for (int row = 0; row < (int)row_to_constr.size(); row++) {
+        ChSparseMatrix::InnerIterator it(Cq, row);
+        if (!it)
+            continue;  // constraint with no active variables
+        int island = island_of_root[find_root(col_to_var[it.col()])];
+        islands[island]->InsertConstraint(mconstraints[row_to_constr[row]]);
+    }
+
+    if (!has_free_vars)
+        islands.pop_back();
+    m_num_islands = (int)islands.size();
+
+    // Close the insertions sequentially: this recomputes the variable and constraint offsets
+    // within each island (the islands are disjoint, so no offset is written twice).
+    for (auto& island : islands)
+        island->EndInsertion();
+
+    // Solve the islands concurrently, each with its own inner solver instance. Every island
+    // references a disjoint set of variables and constraints, and the solution is stored directly
+    // in those objects.
+    double max_error = 0;
+    int max_iterations = 0;
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int i = 0; i < (int)islands.size(); i++) {
+        // The free island has no constraints: its solution is just the unconstrained update.
+        if (islands[i]->GetConstraintsList().empty()) {
+            for (auto* var : islands[i]->GetVariablesList())
+                var->Compute_invMb_v(var->Get_qb(), var->Get_fb());  // q = [M]'*fb
+            continue;
+        }
+        auto solver = CreateInnerSolver();
+        double err = solver->Solve(*islands[i]);
+#pragma omp critical(ChSolverIslands_reduce)
+        {
+            if (err > max_error)
+                max_error = err;
+            if (solver->GetIterations() > max_iterations)
+                max_iterations = solver->GetIterations();
+        }
+    }
+
+    // Restore the offsets of the parent descriptor, which the subsequent scatter of the solution
+    // into the system states relies on.
+    sysd.UpdateCountsAndOffsets();
+
+    m_error = max_error;
+    m_iterations = max_iterations;
+    return m_error;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,89 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CHSOLVER_ISLANDS_H
+#define CHSOLVER_ISLANDS_H
+
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Meta-solver that decomposes the VI problem into independent islands and solves them concurrently.
+///
+/// The constraint jacobian couples only the variables touched by each constraint, so whenever the
+/// contact graph splits into disconnected components (e.g. scattered debris piles), the monolithic
+/// VI problem is equivalent to a set of smaller independent problems. This solver detects the
+/// connected components of the constraint-variable graph at each solve, builds one sub-descriptor
+/// per island, and dispatches an independent iterative VI solve (PSOR or APGD, see
+/// SetInnerSolverType) per island across OpenMP threads. Small decoupled islands converge in far
+/// fewer iterations than the global problem, and the island solves run in parallel.
+///
+/// Variables not touched by any constraint are collected in one extra "free" island, whose solve
+/// reduces to the unconstrained update q = M^-1 f. If the problem contains stiffness blocks (which
+/// couple variables outside the constraint jacobian) or has no constraints at all, the solver
+/// falls back to a single monolithic solve with the inner solver.
+///
+/// All iterative-solver settings of this wrapper (max iterations, tolerance, omega, sharpness,
+/// preconditioning, warm start) are propagated to the per-island inner solvers.
+class ChApi ChSolverIslands : public ChIterativeSolverVI {
+  public:
+    /// Type of the iterative VI solver used for the individual islands.
+    enum class InnerSolverType {
+        PSOR,  ///< projected SOR
+        APGD   ///< accelerated projected gradient descent
+    };
+
+    ChSolverIslands(InnerSolverType inner_type = InnerSolverType::PSOR);
+
+    ~ChSolverIslands() {}
+
+    virtual Type GetType() const override { return Type::CUSTOM; }
+
+    /// Set the iterative VI solver used for the individual islands (default: PSOR).
+    void SetInnerSolverType(InnerSolverType inner_type) { m_inner_type = inner_type; }
+
+    /// Get the iterative VI solver type used for the individual islands.
+    InnerSolverType GetInnerSolverType() const { return m_inner_type; }
+
+    /// Return the number of islands detected in the last solve (including the "free" island).
+    int GetNumIslands() const { return m_num_islands; }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum error over all island solves.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Return the maximum error over all island solves performed in the last Solve().
+    virtual double GetError() const override { return m_error; }
+
+  private:
+    /// Create an inner solver of the selected type, with this solver's settings.
+    std::shared_ptr<ChIterativeSolverVI> CreateInnerSolver() const;
+
+    /// Solve the full problem with a single inner solver (fallback path).
+    double SolveMonolithic(ChSystemDescriptor& sysd);
+
+    InnerSolverType m_inner_type;  ///< solver type used per island
+    int m_num_islands;             ///< number of islands in the last solve
+    double m_error;                ///< maximum error over the island solves
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
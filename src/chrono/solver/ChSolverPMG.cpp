@@ -0,0 +1,352 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/solver/ChSolverPMG.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverPMG)
+
+// Union-find with path halving, used to aggregate bodies over the jacobian sparsity.
+static int PMG_find(std::vector<int>& parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+ChSolverPMG::ChSolverPMG()
+    : m_pre_sweeps(3),
+      m_post_sweeps(3),
+      m_aggregate_size(8),
+      m_coarse_sweeps(40),
+      m_num_aggregates(0),
+      m_residual(0.0),
+      nc(0) {}
+
+void ChSolverPMG::SmoothingSweep(ChSystemDescriptor& sysd, ChVectorDynamic<>& l) {
+    // Gauss-Seidel: each multiplier is relaxed against the already-updated ones, using the
+    // assembled rows of N. The projection is applied once per sweep on the whole vector, so that
+    // friction cone constraints (which couple triplets of rows) see a consistent iterate.
+    for (int i = 0; i < nc; i++) {
+        double rowdot = 0;
+        for (ChSparseMatrix::InnerIterator it(N, i); it; ++it)
+            rowdot += it.value() * l(it.col());
+        l(i) -= m_omega * (rowdot + r(i)) / Ndiag(i);
+    }
+    sysd.ConstraintsProject(l);
+}
+
+double ChSolverPMG::ProjectedResidual(ChSystemDescriptor& sysd, const ChVectorDynamic<>& l) {
+    // g_proj = (l - project_orthogonal(l - gdiff*g)) / gdiff,  g = N*l + r   (as in ChSolverAPGD)
+    double gdiff = 1.0 / (nc * nc);
+    tmp = l - gdiff * (N * l + r);
+    sysd.ConstraintsProject(tmp);
+    tmp = (l - tmp) / gdiff;
+    return tmp.norm();
+}
+
+double ChSolverPMG::Solve(ChSystemDescriptor& sysd) {
+    const std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    const std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    // Update auxiliary data in all constraints before starting,
+    // that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
+    for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+        mconstraints[ic]->Update_auxiliary();
+
+    nc = sysd.CountActiveConstraints();
+    int nv = sysd.CountActiveVariables();
+
+    r.resize(nc);
+    tmp.resize(nc);
+
+    // Compute the b_shur vector in the Schur complement equation N*l = b_shur, with flipped
+    // lambda sign:  b_shur = - b_i - D'*(M^-1)*k   (same convention as the other VI solvers).
+
+    // Put (M^-1)*k    in  q  sparse vector of each variable..
+    for (unsigned int iv = 0; iv < mvariables.size(); iv++)
+        if (mvariables[iv]->IsActive())
+            mvariables[iv]->Compute_invMb_v(mvariables[iv]->Get_qb(), mvariables[iv]->Get_fb());  // q = [M]'*fb
+
+    // ...and now do  b_shur = - D'*q = - D'*(M^-1)*k ..
+    r.setZero();
+    int s_i = 0;
+    for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+        if (mconstraints[ic]->IsActive()) {
+            r(s_i, 0) = mconstraints[ic]->Compute_Cq_q();
+            ++s_i;
+        }
+
+    // ..and finally do   b_shur = b_shur - c
+    sysd.BuildBiVector(tmp);  // b_i   =   -c   = phi/h
+    r += tmp;
+
+    // If no constraints, return now. Variables contain M^-1 * f after the loop above.
+    if (nc == 0) {
+        m_residual = 0;
+        m_iterations = 0;
+        return 0;
+    }
+
+    // Optimization: backup the  q  sparse data computed above,
+    // because   (M^-1)*k   will be needed at the end when computing primals.
+    ChVectorDynamic<> Minvk;
+    sysd.FromVariablesToVector(Minvk, true);
+
+    // ---- Assemble the fine-level Schur complement matrix  N = Cq * M^-1 * Cq' + E.
+    // The Gauss-Seidel sweeps need fast row access, which the matrix-free
+    // ShurComplementProduct cannot provide.
+
+    ChSparseMatrix Cq;
+    ChSparseMatrix E;
+    sysd.ConvertToMatrixForm(&Cq, nullptr, &E, nullptr, nullptr, nullptr);
+
+    // Block-diagonal inverse mass matrix, one block per active variable, built by applying
+    // Compute_invMb_v to the local unit basis vectors (blocks are small: 6x6 for bodies).
+    ChSparseMatrix Minv(nv, nv);
+    {
+        std::vector<Eigen::Triplet<double>> triplets;
+        ChVectorDynamic<> unit_v;
+        ChVectorDynamic<> invM_v;
+        for (unsigned int iv = 0; iv < mvariables.size(); iv++) {
+            if (!mvariables[iv]->IsActive())
+                continue;
+            int off = mvariables[iv]->GetOffset();
+            int ndof = mvariables[iv]->Get_ndof();
+            unit_v.setZero(ndof);
+            invM_v.setZero(ndof);
+            for (int j = 0; j < ndof; j++) {
+                unit_v(j) = 1;
+                mvariables[iv]->Compute_invMb_v(invM_v, unit_v);
+                for (int i = 0; i < ndof; i++) {
+                    if (invM_v(i) != 0)
+                        triplets.push_back(Eigen::Triplet<double>(off + i, off + j, invM_v(i)));
+                }
+                unit_v(j) = 0;
+            }
+        }
+        Minv.setFromTriplets(triplets.begin(), triplets.end());
+    }
+
+    ChSparseMatrix CqT = Cq.transpose();
+    ChSparseMatrix MinvCqT = Minv * CqT;
+    N = Cq * MinvCqT;
+    N += E;
+    N.makeCompressed();
+
+    Ndiag.resize(nc);
+    for (int i = 0; i < nc; i++) {
+        double d = N.coeff(i, i);
+        Ndiag(i) = (d > 0) ? d : 1.0;
+    }
+
+    // ---- Build the coarse level: cluster bodies into aggregates by a union-find sweep over the
+    // jacobian sparsity, capping the aggregate size, then assign each constraint to the aggregate
+    // of its first body. The restriction R is piecewise constant over that assignment.
+
+    // Map each scalar column to the index of the owning variable.
+    std::vector<int> col2var(nv, -1);
+    int n_active_vars = 0;
+    for (unsigned int iv = 0; iv < mvariables.size(); iv++) {
+        if (!mvariables[iv]->IsActive())
+            continue;
+        int off = mvariables[iv]->GetOffset();
+        int ndof = mvariables[iv]->Get_ndof();
+        for (int j = 0; j < ndof; j++)
+            col2var[off + j] = n_active_vars;
+        n_active_vars++;
+    }
+
+    std::vector<int> parent(n_active_vars);
+    std::vector<int> cluster_size(n_active_vars, 1);
+    for (int i = 0; i < n_active_vars; i++)
+        parent[i] = i;
+
+    for (int i = 0; i < nc; i++) {
+        int prev = -1;
+        for (ChSparseMatrix::InnerIterator it(Cq, i); it; ++it) {
+            int var = col2var[(int)it.col()];
+            if (var < 0 || var == prev)
+                continue;
+            if (prev >= 0) {
+                int ra = PMG_find(parent, prev);
+                int rb = PMG_find(parent, var);
+                if (ra != rb && cluster_size[ra] + cluster_size[rb] <= m_aggregate_size) {
+                    parent[rb] = ra;
+                    cluster_size[ra] += cluster_size[rb];
+                }
+            }
+            prev = var;
+        }
+    }
+
+    // Compact cluster roots into coarse indices and assign constraints to aggregates.
+    std::vector<int> root2agg(n_active_vars, -1);
+    std::vector<int> agg_of(nc, -1);
+    m_num_aggregates = 0;
+    for (int i = 0; i < nc; i++) {
+        ChSparseMatrix::InnerIterator it(Cq, i);
+        if (!it)
+            continue;
+        int var = col2var[(int)it.col()];
+        if (var < 0)
+            continue;
+        int root = PMG_find(parent, var);
+        if (root2agg[root] < 0)
+            root2agg[root] = m_num_aggregates++;
+        agg_of[i] = root2agg[root];
+    }
+
+    // Coarsening is only worthwhile if the coarse problem is substantially smaller; with one
+    // aggregate per constraint (fully disconnected contacts) fall back to pure smoothing.
+    bool use_coarse = (m_num_aggregates >= 1) && (m_num_aggregates < nc);
+
+    if (use_coarse) {
+        std::vector<Eigen::Triplet<double>> triplets;
+        triplets.reserve(nc);
+        for (int i = 0; i < nc; i++)
+            if (agg_of[i] >= 0)
+                triplets.push_back(Eigen::Triplet<double>(agg_of[i], i, 1.0));
+        R.resize(m_num_aggregates, nc);
+        R.setFromTriplets(triplets.begin(), triplets.end());
+
+        ChSparseMatrix RT = R.transpose();
+        ChSparseMatrix NRT = N * RT;
+        Nc = R * NRT;
+        Nc.makeCompressed();
+
+        rc.resize(m_num_aggregates);
+        ec.resize(m_num_aggregates);
+    }
+
+    // ---- Initial guess and V-cycle iterations.
+
+    ChVectorDynamic<> l(nc);
+    if (m_warm_start) {
+        for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+            if (mconstraints[ic]->IsActive())
+                mconstraints[ic]->Increment_q(mconstraints[ic]->Get_l_i());
+    } else {
+        for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+            mconstraints[ic]->Set_l_i(0.);
+    }
+    sysd.FromConstraintsToVector(l);
+
+    ChVectorDynamic<> l_old(nc);
+    ChVectorDynamic<> l_try(nc);
+
+    m_residual = 10e30;
+
+    for (m_iterations = 0; m_iterations < m_max_iterations; m_iterations++) {
+        l_old = l;
+
+        // Pre-smoothing
+        for (int s = 0; s < m_pre_sweeps; s++)
+            SmoothingSweep(sysd, l);
+
+        if (use_coarse) {
+            // Restrict the residual and solve the aggregate-level equation Nc*ec = rc with plain
+            // Gauss-Seidel sweeps (the coarse problem is unconstrained; the cone constraints are
+            // enforced on the fine level after prolongation).
+            rc = -(R * (N * l + r));
+            ec.setZero();
+            for (int s = 0; s < m_coarse_sweeps; s++) {
+                for (int i = 0; i < m_num_aggregates; i++) {
+                    double rowdot = 0;
+                    double diag = 0;
+                    for (ChSparseMatrix::InnerIterator it(Nc, i); it; ++it) {
+                        if ((int)it.col() == i)
+                            diag = it.value();
+                        else
+                            rowdot += it.value() * ec(it.col());
+                    }
+                    if (diag > 0)
+                        ec(i) = (rc(i) - rowdot) / diag;
+                }
+            }
+
+            // Prolong, project, and accept the correction only if it decreases the CCP objective
+            // f(l) = l'*(0.5*N*l + r): the projection may spoil a correction computed without the
+            // cone constraints, and a rejected correction leaves the smoothed iterate untouched.
+            l_try = l + R.transpose() * ec;
+            sysd.ConstraintsProject(l_try);
+            double f_cur = l.dot(0.5 * (N * l) + r);
+            double f_try = l_try.dot(0.5 * (N * l_try) + r);
+            if (f_try < f_cur)
+                l = l_try;
+        }
+
+        // Post-smoothing
+        for (int s = 0; s < m_post_sweeps; s++)
+            SmoothingSweep(sysd, l);
+
+        m_residual = ProjectedResidual(sysd, l);
+
+        if (this->record_violation_history)
+            AtIterationEnd(m_residual, (l - l_old).lpNorm<Eigen::Infinity>(), m_iterations);
+
+        if (m_residual < m_tolerance)
+            break;
+    }
+
+    if (verbose)
+        GetLog() << "ChSolverPMG: aggregates=" << m_num_aggregates << "  residual=" << m_residual
+                 << "  iterations=" << m_iterations << "\n";
+
+    // Store the final multipliers in the constraint objects.
+    sysd.FromVectorToConstraints(l);
+
+    // Resulting PRIMAL variables:
+    // compute the primal variables as   v = (M^-1)(k + D*l)
+    // v = (M^-1)*k  ...    (by rewinding to the backup vector computed at the beginning)
+    sysd.FromVectorToVariables(Minvk);
+
+    // ... + (M^-1)*D*l     (this increment and also stores 'qb' in the ChVariable items)
+    for (size_t ic = 0; ic < mconstraints.size(); ic++) {
+        if (mconstraints[ic]->IsActive())
+            mconstraints[ic]->Increment_q(mconstraints[ic]->Get_l_i());
+    }
+
+    return m_residual;
+}
+
+void ChSolverPMG::ArchiveOut(ChArchiveOut& marchive) {
+    // version number
+    marchive.VersionWrite<ChSolverPMG>();
+    // serialize parent class
+    ChIterativeSolverVI::ArchiveOut(marchive);
+    // serialize all member data:
+    marchive << CHNVP(m_pre_sweeps);
+    marchive << CHNVP(m_post_sweeps);
+    marchive << CHNVP(m_aggregate_size);
+    marchive << CHNVP(m_coarse_sweeps);
+}
+
+void ChSolverPMG::ArchiveIn(ChArchiveIn& marchive) {
+    // version number
+    /*int version =*/marchive.VersionRead<ChSolverPMG>();
+    // deserialize parent class
+    ChIterativeSolverVI::ArchiveIn(marchive);
+    // stream in all member data:
+    marchive >> CHNVP(m_pre_sweeps);
+    marchive >> CHNVP(m_post_sweeps);
+    marchive >> CHNVP(m_aggregate_size);
+    marchive >> CHNVP(m_coarse_sweeps);
+}
+
+}  // end namespace chrono
@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHSOLVERPMG_H
+#define CHSOLVERPMG_H
+
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Two-level projected multigrid solver for the Schur complement VI problem.
+///
+/// Plain projected fixed-point iterations (PSOR, Jacobi) damp the high-frequency error components
+/// of N*l + r quickly but stall on the long-wavelength modes that couple distant parts of a large
+/// contact network (e.g. force chains through a tall granular pile). This solver accelerates them
+/// with a coarse-grid correction: the bodies are clustered into aggregates by a union-find sweep
+/// over the constraint jacobian sparsity (bodies in contact tend to land in the same aggregate),
+/// every constraint is assigned to the aggregate of its first body, and a piecewise-constant
+/// restriction R built from that assignment yields a small Galerkin coarse matrix Nc = R*N*R'.
+/// Each outer iteration is then one V-cycle: a few projected Gauss-Seidel pre-smoothing sweeps on
+/// the fine level, a Gauss-Seidel solve of the aggregate-level residual equation, prolongation and
+/// projection of the correction (accepted only if it decreases the CCP objective, so the cone
+/// constraints are never violated by the coarse step), and post-smoothing sweeps.
+///
+/// Both levels operate on an explicitly assembled Schur complement matrix N = Cq*M^-1*Cq' + E,
+/// rebuilt at every Solve() call; this trades assembly time and memory for fast row access in the
+/// Gauss-Seidel sweeps and is worthwhile when many V-cycles are performed per step.
+///
+/// The solver can be used standalone, or as a preconditioner for APGD by chaining through the
+/// multipliers: run a few V-cycles with a loose tolerance, then hand the problem to a warm-started
+/// ChSolverAPGD, which picks up the smoothed multipliers from the constraint objects.
+///
+/// See ChSystemDescriptor for more information about the problem formulation and the data
+/// structures passed to the solver.
+class ChApi ChSolverPMG : public ChIterativeSolverVI {
+  public:
+    ChSolverPMG();
+
+    ~ChSolverPMG() {}
+
+    virtual Type GetType() const override { return Type::CUSTOM; }
+
+    /// Set the number of projected Gauss-Seidel smoothing sweeps performed before and after the
+    /// coarse-grid correction of each V-cycle (default: 3 and 3).
+    void SetSmoothingSweeps(int pre, int post) {
+        m_pre_sweeps = pre;
+        m_post_sweeps = post;
+    }
+
+    /// Set the target number of bodies per coarse aggregate (default: 8).
+    /// Larger aggregates give a smaller (cheaper) coarse problem but a less accurate correction.
+    void SetAggregateSize(int nbodies) { m_aggregate_size = nbodies; }
+
+    /// Set the number of Gauss-Seidel sweeps used to solve the coarse-level residual equation
+    /// (default: 40). The coarse problem has one unknown per aggregate, so these sweeps are cheap.
+    void SetCoarseSweeps(int nsweeps) { m_coarse_sweeps = nsweeps; }
+
+    /// Return the number of coarse aggregates built in the last solve.
+    int GetNumAggregates() const { return m_num_aggregates; }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum constraint violation after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Return the tolerance error reached during the last solve.
+    /// For the PMG solver, this is the norm of the projected gradient.
+    virtual double GetError() const override { return m_residual; }
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& marchive) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& marchive) override;
+
+  private:
+    /// One projected Gauss-Seidel sweep on the fine level: update all multipliers in sequence
+    /// using the assembled N, then project onto the constraint set.
+    void SmoothingSweep(ChSystemDescriptor& sysd, ChVectorDynamic<>& l);
+
+    /// Norm of the projected gradient at the current iterate (same metric as ChSolverAPGD).
+    double ProjectedResidual(ChSystemDescriptor& sysd, const ChVectorDynamic<>& l);
+
+    int m_pre_sweeps;      ///< pre-smoothing sweeps per V-cycle
+    int m_post_sweeps;     ///< post-smoothing sweeps per V-cycle
+    int m_aggregate_size;  ///< target number of bodies per aggregate
+    int m_coarse_sweeps;   ///< Gauss-Seidel sweeps on the coarse level
+    int m_num_aggregates;  ///< number of aggregates built in the last solve
+    double m_residual;     ///< projected-gradient norm at termination
+    int nc;                ///< number of active scalar constraints
+
+    ChSparseMatrix N;             ///< assembled fine-level Schur complement matrix
+    ChSparseMatrix Nc;            ///< Galerkin coarse matrix R*N*R'
+    ChSparseMatrix R;             ///< piecewise-constant restriction operator
+    ChVectorDynamic<> Ndiag;      ///< diagonal of N, for the Gauss-Seidel updates
+    ChVectorDynamic<> r, tmp;     ///< Schur rhs and scratch vector
+    ChVectorDynamic<> rc, ec;     ///< coarse-level residual and correction
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -12,10 +12,13 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/utils/ChOpenMP.h"
 
 namespace chrono {
 
@@ -25,7 +28,18 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor()
+    : n_q(0),
+      n_c(0),
+      c_a(1.0),
+      freeze_count(false),
+      nthreads(1),
+      prune_sleeping_constraints(false),
+      use_shur_float(false),
+      use_shur_fused(false),
+      shur_float_valid(false),
+      registry_valid(false),
+      scratch_used(0) {
     vconstraints.clear();
     vvariables.clear();
     vstiffness.clear();
@@ -97,6 +111,37 @@ void ChSystemDescriptor::UpdateCountsAndOffsets() {
     CountActiveVariables();
     CountActiveConstraints();
     freeze_count = true;
+    registry_valid = false;  // offsets changed: the packed registry will be rebuilt on first use
+}
+
+void ChSystemDescriptor::PackActiveRegistry() {
+    auto vv_size = vvariables.size();
+    auto vc_size = vconstraints.size();
+
+    // Pack the records of the active variables (offset, size, direct block storage pointers) and
+    // the active constraints into dense arrays, reusing the capacity from the previous cycle.
+    reg_vars.clear();
+    reg_vars.reserve(vv_size);
+    for (size_t iv = 0; iv < vv_size; iv++) {
+        if (vvariables[iv]->IsActive()) {
+            ChVariableRecord r;
+            r.var = vvariables[iv];
+            r.qb = vvariables[iv]->Get_qb().data();
+            r.fb = vvariables[iv]->Get_fb().data();
+            r.offset = vvariables[iv]->GetOffset();
+            r.ndof = vvariables[iv]->Get_ndof();
+            reg_vars.push_back(r);
+        }
+    }
+
+    reg_cons.clear();
+    reg_cons.reserve(vc_size);
+    for (size_t ic = 0; ic < vc_size; ic++) {
+        if (vconstraints[ic]->IsActive())
+            reg_cons.push_back(vconstraints[ic]);
+    }
+
+    registry_valid = true;
 }
 
 void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Cq,
@@ -112,19 +157,34 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Cq,
 
     auto mv_size = mvariables.size();
     auto mc_size = mconstraints.size();
-    auto vs_size = vstiffness.size();
 
-    // Count bilateral and other constraints.. (if wanted, bilaterals only)
+    // Classify all constraints in parallel: mark those to be inserted (if wanted, bilaterals only)
+    // and cache their friction flag/coefficient, so that the expensive dynamic casts are performed
+    // only once and outside of the serial stamping loop below.
 
-    int mn_c = 0;
-    for (size_t ic = 0; ic < mc_size; ic++) {
+    std::vector<char> insert_c(mc_size);
+    std::vector<double> frict_c(mc_size);
+#pragma omp parallel for schedule(static, 256) num_threads(nthreads)
+    for (int ic = 0; ic < (int)mc_size; ic++) {
+        insert_c[ic] = 0;
+        frict_c[ic] = -2;  // -2 flag for bilaterals (default)
         if (mconstraints[ic]->IsActive())
-            if (!((mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) && only_bilaterals))
-                if (!((dynamic_cast<ChConstraintTwoTuplesFrictionTall*>(mconstraints[ic])) && skip_contacts_uv)) {
-                    mn_c++;
+            if (!((mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) && only_bilaterals)) {
+                bool is_tangent = dynamic_cast<ChConstraintTwoTuplesFrictionTall*>(mconstraints[ic]) != nullptr;
+                if (!(is_tangent && skip_contacts_uv)) {
+                    insert_c[ic] = 1;
+                    if (is_tangent)
+                        frict_c[ic] = -1;  // -1 flag for rows of tangential components
+                    else if (auto mcon = dynamic_cast<ChConstraintTwoTuplesContactNall*>(mconstraints[ic]))
+                        frict_c[ic] = mcon->GetFrictionCoefficient();  // friction coeff in row of normal component
                 }
+            }
     }
 
+    int mn_c = 0;
+    for (size_t ic = 0; ic < mc_size; ic++)
+        mn_c += insert_c[ic];
+
     // Count active variables, by scanning through all variable blocks,
     // and set offsets
 
@@ -145,51 +205,69 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Cq,
     if (Frict)
         Frict->setZero(mn_c);
 
-    // Fills H submasses and 'f' vector,
-    // by looping on variables
-    int s_q = 0;
-    for (size_t iv = 0; iv < mv_size; iv++) {
-        if (mvariables[iv]->IsActive()) {
-            if (H)
+    // Fills the 'f' vector, by looping on variables (in parallel: each active variable
+    // writes only its own segment, at the offset set by CountActiveVariables above)
+    if (Fvector) {
+#pragma omp parallel for schedule(static, 256) num_threads(nthreads)
+        for (int iv = 0; iv < (int)mv_size; iv++) {
+            if (mvariables[iv]->IsActive())
+                Fvector->segment(mvariables[iv]->GetOffset(), vvariables[iv]->Get_ndof()) = vvariables[iv]->Get_fb();
+        }
+    }
+
+    // Fills H submasses, by looping on variables
+    // (serial: concurrent insertion in the shared sparse matrix storage is not safe)
+    if (H) {
+        int s_q = 0;
+        for (size_t iv = 0; iv < mv_size; iv++) {
+            if (mvariables[iv]->IsActive()) {
                 mvariables[iv]->Build_M(*H, s_q, s_q, c_a);  // .. fills  H  (often H=M , the mass)
-            if (Fvector)
-                Fvector->segment(s_q, vvariables[iv]->Get_ndof()) = vvariables[iv]->Get_fb();  // .. fills  'f'
-            s_q += mvariables[iv]->Get_ndof();
+                s_q += mvariables[iv]->Get_ndof();
+            }
         }
     }
 
     // If some stiffness / hessian matrix has been added to H ,
     // also add it to the sparse H
     if (H) {
-        for (size_t ik = 0; ik < vs_size; ik++) {
-            vstiffness[ik]->Build_K(*H, true);
+        AddStiffnessBlocks(*H);
+    }
+
+    // Compute the row index of each inserted constraint (exclusive prefix sum of the insertion flags)
+    std::vector<int> row_c(mc_size);
+    {
+        int s_c = 0;
+        for (size_t ic = 0; ic < mc_size; ic++) {
+            row_c[ic] = s_c;
+            s_c += insert_c[ic];
         }
     }
 
-    // Fills Cq jacobian, E 'compliance' matrix , the 'b' vector and friction coeff.vector,
-    // by looping on constraints
-    int s_c = 0;
-    for (size_t ic = 0; ic < mc_size; ic++) {
-        if (mconstraints[ic]->IsActive())
-            if (!((mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) && only_bilaterals))
-                if (!((dynamic_cast<ChConstraintTwoTuplesFrictionTall*>(mconstraints[ic])) && skip_contacts_uv)) {
-                    if (Cq)
-                        mconstraints[ic]->Build_Cq(*Cq, s_c);  // .. fills Cq
-                    if (E)
-                        E->SetElement(s_c, s_c, mconstraints[ic]->Get_cfm_i());  // .. fills E ( = cfm )
-                    if (Bvector)
-                        (*Bvector)(s_c) = mconstraints[ic]->Get_b_i();  // .. fills 'b'
-                    if (Frict)                                          // .. fills vector of friction coefficients
-                    {
-                        (*Frict)(s_c) = -2;  // mark with -2 flag for bilaterals (default)
-                        if (auto mcon = dynamic_cast<ChConstraintTwoTuplesContactNall*>(mconstraints[ic]))
-                            (*Frict)(s_c) =
-                                mcon->GetFrictionCoefficient();  // friction coeff only in row of normal component
-                        if (dynamic_cast<ChConstraintTwoTuplesFrictionTall*>(mconstraints[ic]))
-                            (*Frict)(s_c) = -1;  // mark with -1 flag for rows of tangential components
-                    }
-                    s_c++;
-                }
+    // Fills the 'b' vector and friction coeff. vector, by looping on constraints
+    // (in parallel: each inserted constraint writes only its own row)
+    if (Bvector || Frict) {
+#pragma omp parallel for schedule(static, 256) num_threads(nthreads)
+        for (int ic = 0; ic < (int)mc_size; ic++) {
+            if (insert_c[ic]) {
+                if (Bvector)
+                    (*Bvector)(row_c[ic]) = mconstraints[ic]->Get_b_i();  // .. fills 'b'
+                if (Frict)
+                    (*Frict)(row_c[ic]) = frict_c[ic];  // .. fills vector of friction coefficients
+            }
+        }
+    }
+
+    // Fills Cq jacobian and E 'compliance' matrix, by looping on constraints
+    // (serial: concurrent insertion in the shared sparse matrix storage is not safe)
+    if (Cq || E) {
+        for (size_t ic = 0; ic < mc_size; ic++) {
+            if (insert_c[ic]) {
+                if (Cq)
+                    mconstraints[ic]->Build_Cq(*Cq, row_c[ic]);  // .. fills Cq
+                if (E)
+                    E->SetElement(row_c[ic], row_c[ic], mconstraints[ic]->Get_cfm_i());  // .. fills E ( = cfm )
+            }
+        }
     }
 }
 
@@ -199,7 +277,6 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChVectorDynamic<
 
     auto mv_size = mvariables.size();
     auto mc_size = mconstraints.size();
-    auto vs_size = vstiffness.size();
 
     // Count constraints.
     int mn_c = 0;
@@ -226,9 +303,7 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChVectorDynamic<
         }
 
         // If present, add stiffness matrix K to upper-left block of Z.
-        for (size_t ik = 0; ik < vs_size; ik++) {
-            vstiffness[ik]->Build_K(*Z, true);
-        }
+        AddStiffnessBlocks(*Z);
 
         // Fill Z by looping over constraints.
         int s_c = 0;
@@ -270,17 +345,63 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChVectorDynamic<
     }
 }
 
+void ChSystemDescriptor::PruneConstraintsWithNoActiveVariables() {
+    vconstraints.erase(
+        std::remove_if(vconstraints.begin(), vconstraints.end(),
+                       [](ChConstraint* mc) { return !mc->HasActiveVariables(); }),
+        vconstraints.end());
+}
+
+void ChSystemDescriptor::AddStiffnessBlocks(ChSparseMatrix& storage) {
+    auto vs_size = vstiffness.size();
+    if (vs_size == 0)
+        return;
+
+    // With a single thread (or too few blocks to amortize the merge), stamp the blocks directly
+    // into the shared storage, as concurrent insertion in the sparse matrix is not safe.
+    if (nthreads <= 1 || vs_size < 2 * (size_t)nthreads) {
+        for (size_t ik = 0; ik < vs_size; ik++) {
+            vstiffness[ik]->Build_K(storage, true);
+        }
+        return;
+    }
+
+    // Phase 1: each thread stamps its share of the stiffness blocks into a private sparse matrix.
+    // The static schedule keeps the partition of blocks over threads (and hence the floating point
+    // summation order) deterministic for a given number of threads.
+    std::vector<ChSparseMatrix> partial(nthreads);
+#pragma omp parallel num_threads(nthreads)
+    {
+        int tid = ChOMP::GetThreadNum();
+        partial[tid].resize(storage.rows(), storage.cols());
+#pragma omp for schedule(static)
+        for (int ik = 0; ik < (int)vs_size; ik++) {
+            vstiffness[ik]->Build_K(partial[tid], true);
+        }
+    }
+
+    // Phase 2: pairwise merge of the per-thread partial sums (each a sorted sparse merge), then a
+    // single pass to add the total into the shared storage.
+    for (int stride = 1; stride < nthreads; stride *= 2) {
+#pragma omp parallel for num_threads(nthreads)
+        for (int tid = 0; tid < nthreads; tid += 2 * stride) {
+            if (tid + stride < nthreads)
+                partial[tid] += partial[tid + stride];
+        }
+    }
+    storage += partial[0];
+}
+
 int ChSystemDescriptor::BuildFbVector(ChVectorDynamic<>& Fvector) {
     n_q = CountActiveVariables();
     Fvector.setZero(n_q);
 
-    auto vv_size = vvariables.size();
+    if (!registry_valid)
+        PackActiveRegistry();
 
     // Fills the 'f' vector
-    for (size_t iv = 0; iv < vv_size; iv++) {
-        if (vvariables[iv]->IsActive()) {
-            Fvector.segment(vvariables[iv]->GetOffset(), vvariables[iv]->Get_ndof()) = vvariables[iv]->Get_fb();
-        }
+    for (const auto& vr : reg_vars) {
+        Fvector.segment(vr.offset, vr.ndof) = Eigen::Map<const ChVectorDynamic<>>(vr.fb, vr.ndof);
     }
     return n_q;
 }
@@ -289,13 +410,12 @@ int ChSystemDescriptor::BuildBiVector(ChVectorDynamic<>& Bvector) {
     n_c = CountActiveConstraints();
     Bvector.setZero(n_c);
 
-    auto vc_size = vconstraints.size();
+    if (!registry_valid)
+        PackActiveRegistry();
 
     // Fill the 'b' vector
-    for (size_t ic = 0; ic < vc_size; ic++) {
-        if (vconstraints[ic]->IsActive()) {
-            Bvector(vconstraints[ic]->GetOffset()) = vconstraints[ic]->Get_b_i();
-        }
+    for (ChConstraint* con : reg_cons) {
+        Bvector(con->GetOffset()) = con->Get_b_i();
     }
 
     return n_c;
@@ -306,21 +426,17 @@ int ChSystemDescriptor::BuildDiVector(ChVectorDynamic<>& Dvector) {
     n_c = CountActiveConstraints();
     Dvector.setZero(n_q + n_c);
 
-    auto vv_size = vvariables.size();
-    auto vc_size = vconstraints.size();
+    if (!registry_valid)
+        PackActiveRegistry();
 
     // Fills the 'f' vector part
-    for (size_t iv = 0; iv < vv_size; iv++) {
-        if (vvariables[iv]->IsActive()) {
-            Dvector.segment(vvariables[iv]->GetOffset(), vvariables[iv]->Get_ndof()) = vvariables[iv]->Get_fb();
-        }
+    for (const auto& vr : reg_vars) {
+        Dvector.segment(vr.offset, vr.ndof) = Eigen::Map<const ChVectorDynamic<>>(vr.fb, vr.ndof);
     }
 
     // Fill the '-b' vector (with flipped sign!)
-    for (size_t ic = 0; ic < vc_size; ic++) {
-        if (vconstraints[ic]->IsActive()) {
-            Dvector(vconstraints[ic]->GetOffset() + n_q) = -vconstraints[ic]->Get_b_i();
-        }
+    for (ChConstraint* con : reg_cons) {
+        Dvector(con->GetOffset() + n_q) = -con->Get_b_i();
     }
 
     return n_q + n_c;
@@ -332,8 +448,9 @@ int ChSystemDescriptor::BuildDiagonalVector(ChVectorDynamic<>& Diagonal_vect) {
     Diagonal_vect.setZero(n_q + n_c);
 
     auto vs_size = vstiffness.size();
-    auto vv_size = vvariables.size();
-    auto vc_size = vconstraints.size();
+
+    if (!registry_valid)
+        PackActiveRegistry();
 
     // Fill the diagonal values given by ChKblock objects , if any
     // (This cannot be easily parallelized because of possible write concurrency).
@@ -342,17 +459,13 @@ int ChSystemDescriptor::BuildDiagonalVector(ChVectorDynamic<>& Diagonal_vect) {
     }
 
     // Get the 'M' diagonal terms given by ChVariables objects
-    for (size_t iv = 0; iv < vv_size; iv++) {
-        if (vvariables[iv]->IsActive()) {
-            vvariables[iv]->DiagonalAdd(Diagonal_vect, c_a);
-        }
+    for (const auto& vr : reg_vars) {
+        vr.var->DiagonalAdd(Diagonal_vect, c_a);
     }
 
     // Get the 'E' diagonal terms (E_i = cfm_i )
-    for (size_t ic = 0; ic < vc_size; ic++) {
-        if (vconstraints[ic]->IsActive()) {
-            Diagonal_vect(vconstraints[ic]->GetOffset() + n_q) = vconstraints[ic]->Get_cfm_i();
-        }
+    for (ChConstraint* con : reg_cons) {
+        Diagonal_vect(con->GetOffset() + n_q) = con->Get_cfm_i();
     }
 
     return n_q + n_c;
@@ -365,12 +478,12 @@ int ChSystemDescriptor::FromVariablesToVector(ChVectorDynamic<>& mvector, bool r
         mvector.setZero(n_q);
     }
 
+    if (!registry_valid)
+        PackActiveRegistry();
+
     // Fill the vector
-    auto vv_size = vvariables.size();
-    for (size_t iv = 0; iv < vv_size; iv++) {
-        if (vvariables[iv]->IsActive()) {
-            mvector.segment(vvariables[iv]->GetOffset(), vvariables[iv]->Get_ndof()) = vvariables[iv]->Get_qb();
-        }
+    for (const auto& vr : reg_vars) {
+        mvector.segment(vr.offset, vr.ndof) = Eigen::Map<const ChVectorDynamic<>>(vr.qb, vr.ndof);
     }
 
     return n_q;
@@ -379,12 +492,12 @@ int ChSystemDescriptor::FromVariablesToVector(ChVectorDynamic<>& mvector, bool r
 int ChSystemDescriptor::FromVectorToVariables(const ChVectorDynamic<>& mvector) {
     assert(CountActiveVariables() == mvector.rows());
 
+    if (!registry_valid)
+        PackActiveRegistry();
+
     // fetch from the vector
-    auto vv_size = vvariables.size();
-    for (size_t iv = 0; iv < vv_size; iv++) {
-        if (vvariables[iv]->IsActive()) {
-            vvariables[iv]->Get_qb() = mvector.segment(vvariables[iv]->GetOffset(), vvariables[iv]->Get_ndof());
-        }
+    for (const auto& vr : reg_vars) {
+        Eigen::Map<ChVectorDynamic<>>(vr.qb, vr.ndof) = mvector.segment(vr.offset, vr.ndof);
     }
 
     return n_q;
@@ -397,13 +510,12 @@ int ChSystemDescriptor::FromConstraintsToVector(ChVectorDynamic<>& mvector, bool
         mvector.setZero(n_c);
     }
 
-    auto vc_size = (int)vconstraints.size();
+    if (!registry_valid)
+        PackActiveRegistry();
 
     // Fill the vector
-    for (size_t ic = 0; ic < vc_size; ic++) {
-        if (vconstraints[ic]->IsActive()) {
-            mvector(vconstraints[ic]->GetOffset()) = vconstraints[ic]->Get_l_i();
-        }
+    for (ChConstraint* con : reg_cons) {
+        mvector(con->GetOffset()) = con->Get_l_i();
     }
 
     return n_c;
@@ -414,18 +526,86 @@ int ChSystemDescriptor::FromVectorToConstraints(const ChVectorDynamic<>& mvector
 
     assert(n_c == mvector.size());
 
-    auto vc_size = (int)vconstraints.size();
+    if (!registry_valid)
+        PackActiveRegistry();
 
     // Fill the vector
-    for (size_t ic = 0; ic < vc_size; ic++) {
-        if (vconstraints[ic]->IsActive()) {
-            vconstraints[ic]->Set_l_i(mvector(vconstraints[ic]->GetOffset()));
-        }
+    for (ChConstraint* con : reg_cons) {
+        con->Set_l_i(mvector(con->GetOffset()));
     }
 
     return n_c;
 }
 
+int ChSystemDescriptor::FromVariablesToBuffer(double* buffer) {
+    if (!registry_valid)
+        PackActiveRegistry();
+
+    for (const auto& vr : reg_vars) {
+        Eigen::Map<ChVectorDynamic<>>(buffer + vr.offset, vr.ndof) =
+            Eigen::Map<const ChVectorDynamic<>>(vr.qb, vr.ndof);
+    }
+
+    return CountActiveVariables();
+}
+
+int ChSystemDescriptor::FromBufferToVariables(const double* buffer) {
+    if (!registry_valid)
+        PackActiveRegistry();
+
+    for (const auto& vr : reg_vars) {
+        Eigen::Map<ChVectorDynamic<>>(vr.qb, vr.ndof) =
+            Eigen::Map<const ChVectorDynamic<>>(buffer + vr.offset, vr.ndof);
+    }
+
+    return CountActiveVariables();
+}
+
+int ChSystemDescriptor::FromConstraintsToBuffer(double* buffer) {
+    if (!registry_valid)
+        PackActiveRegistry();
+
+    for (ChConstraint* con : reg_cons) {
+        buffer[con->GetOffset()] = con->Get_l_i();
+    }
+
+    return CountActiveConstraints();
+}
+
+int ChSystemDescriptor::FromBufferToConstraints(const double* buffer) {
+    if (!registry_valid)
+        PackActiveRegistry();
+
+    for (ChConstraint* con : reg_cons) {
+        con->Set_l_i(buffer[con->GetOffset()]);
+    }
+
+    return CountActiveConstraints();
+}
+
+double* ChSystemDescriptor::AcquireScratch(int n) {
+    double* buffer;
+    if (scratch_used + n <= SCRATCH_ARENA_SIZE) {
+        // Small-system fast path: serve the request from the fixed arena
+        buffer = scratch_arena + scratch_used;
+        scratch_used += n;
+    } else {
+        buffer = new double[n];
+    }
+    scratch_stack.push_back(std::make_pair(buffer, n));
+    return buffer;
+}
+
+void ChSystemDescriptor::ReleaseScratch(int n) {
+    assert(!scratch_stack.empty() && scratch_stack.back().second == n);
+    double* buffer = scratch_stack.back().first;
+    scratch_stack.pop_back();
+    if (buffer >= scratch_arena && buffer < scratch_arena + SCRATCH_ARENA_SIZE)
+        scratch_used -= n;
+    else
+        delete[] buffer;
+}
+
 int ChSystemDescriptor::FromUnknownsToVector(ChVectorDynamic<>& mvector, bool resize_vector) {
     // Count active variables & constraints and resize vector if necessary
     n_q = CountActiveVariables();
@@ -435,21 +615,17 @@ int ChSystemDescriptor::FromUnknownsToVector(ChVectorDynamic<>& mvector, bool re
         mvector.setZero(n_q + n_c);
     }
 
-    auto vv_size = (int)vvariables.size();
-    auto vc_size = (int)vconstraints.size();
+    if (!registry_valid)
+        PackActiveRegistry();
 
     // Fill the first part of vector, x.q ,with variables q
-    for (size_t iv = 0; iv < vv_size; iv++) {
-        if (vvariables[iv]->IsActive()) {
-            mvector.segment(vvariables[iv]->GetOffset(), vvariables[iv]->Get_ndof()) = vvariables[iv]->Get_qb();
-        }
+    for (const auto& vr : reg_vars) {
+        mvector.segment(vr.offset, vr.ndof) = Eigen::Map<const ChVectorDynamic<>>(vr.qb, vr.ndof);
     }
 
     // Fill the second part of vector, x.l, with constraint multipliers -l (with flipped sign!)
-    for (size_t ic = 0; ic < vc_size; ic++) {
-        if (vconstraints[ic]->IsActive()) {
-            mvector(vconstraints[ic]->GetOffset() + n_q) = -vconstraints[ic]->Get_l_i();
-        }
+    for (ChConstraint* con : reg_cons) {
+        mvector(con->GetOffset() + n_q) = -con->Get_l_i();
     }
 
     return n_q + n_c;
@@ -461,21 +637,17 @@ int ChSystemDescriptor::FromVectorToUnknowns(const ChVectorDynamic<>& mvector) {
 
     assert((n_q + n_c) == mvector.size());
 
-    auto vv_size = vvariables.size();
-    auto vc_size = vconstraints.size();
+    if (!registry_valid)
+        PackActiveRegistry();
 
     // Fetch from the first part of vector (x.q = q)
-    for (size_t iv = 0; iv < vv_size; iv++) {
-        if (vvariables[iv]->IsActive()) {
-            vvariables[iv]->Get_qb() = mvector.segment(vvariables[iv]->GetOffset(), vvariables[iv]->Get_ndof());
-        }
+    for (const auto& vr : reg_vars) {
+        Eigen::Map<ChVectorDynamic<>>(vr.qb, vr.ndof) = mvector.segment(vr.offset, vr.ndof);
     }
 
     // Fetch from the second part of vector (x.l = -l), with flipped sign!
-    for (size_t ic = 0; ic < vc_size; ic++) {
-        if (vconstraints[ic]->IsActive()) {
-            vconstraints[ic]->Set_l_i(-mvector(vconstraints[ic]->GetOffset() + n_q));
-        }
+    for (ChConstraint* con : reg_cons) {
+        con->Set_l_i(-mvector(con->GetOffset() + n_q));
     }
 
     return n_q + n_c;
@@ -488,6 +660,20 @@ void ChSystemDescriptor::ShurComplementProduct(ChVectorDynamic<>& result,
     assert(vstiffness.size() == 0);
     assert(lvector.size() == CountActiveConstraints());
 
+    if (use_shur_fused) {
+        if (!shur_float_valid)
+            PackShurFloatCache();
+        ShurComplementProductFused(result, lvector, enabled);
+        return;
+    }
+
+    if (use_shur_float) {
+        if (!shur_float_valid)
+            PackShurFloatCache();
+        ShurComplementProductFloat(result, lvector, enabled);
+        return;
+    }
+
     result.setZero(n_c);
 
     // Performs the sparse product    result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ] *l
@@ -498,7 +684,8 @@ void ChSystemDescriptor::ShurComplementProduct(ChVectorDynamic<>& result,
 
     // 1 - set the qb vector (aka speeds, in each ChVariable sparse data) as zero
 
-    for (size_t iv = 0; iv < vv_size; iv++) {
+#pragma omp parallel for schedule(static, 256) num_threads(nthreads)
+    for (int iv = 0; iv < (int)vv_size; iv++) {
         if (vvariables[iv]->IsActive())
             vvariables[iv]->Get_qb().setZero();
     }
@@ -529,9 +716,10 @@ void ChSystemDescriptor::ShurComplementProduct(ChVectorDynamic<>& result,
     }
 
     // 3 - performs    result=[Cq']*qb    by
-    //     iterating over all constraints
+    //     iterating over all constraints (in parallel: each constraint writes only its own row)
 
-    for (size_t ic = 0; ic < vc_size; ic++) {
+#pragma omp parallel for schedule(static, 256) num_threads(nthreads)
+    for (int ic = 0; ic < (int)vc_size; ic++) {
         if (vconstraints[ic]->IsActive()) {
             bool process = (!enabled) || (*enabled)[vconstraints[ic]->GetOffset()];
 
@@ -543,6 +731,176 @@ void ChSystemDescriptor::ShurComplementProduct(ChVectorDynamic<>& result,
     }
 }
 
+void ChSystemDescriptor::PackShurFloatCache() {
+    n_q = CountActiveVariables();
+    n_c = CountActiveConstraints();
+
+    auto vc_size = vconstraints.size();
+
+    // Assemble the jacobian in the scratch sparse matrix, preserving the sparsity pattern across
+    // rebuilds when the problem size did not change (same scheme as in ConvertToMatrixForm).
+    if (shur_Cq_build.rows() == n_c && shur_Cq_build.cols() == n_q)
+        shur_Cq_build.setZeroValues();
+    else
+        shur_Cq_build.resize(n_c, n_q);
+
+    shur_cfm.resize(n_c);
+
+    for (size_t ic = 0; ic < vc_size; ic++) {
+        if (vconstraints[ic]->IsActive()) {
+            int s_c = vconstraints[ic]->GetOffset();
+            vconstraints[ic]->Build_Cq(shur_Cq_build, s_c);
+            shur_cfm[s_c] = vconstraints[ic]->Get_cfm_i();
+        }
+    }
+
+    shur_Cq_build.makeCompressed();
+
+    // Repack in CSR arrays, both in double precision (for the fused product) and with the jacobian
+    // entries rounded to single precision (for the mixed-precision product).
+    shur_row_start.resize(n_c + 1);
+    shur_col.resize(shur_Cq_build.nonZeros());
+    shur_val.resize(shur_Cq_build.nonZeros());
+    shur_vald.resize(shur_Cq_build.nonZeros());
+
+    int k = 0;
+    for (int r = 0; r < n_c; r++) {
+        shur_row_start[r] = k;
+        for (ChSparseMatrix::InnerIterator it(shur_Cq_build, r); it; ++it) {
+            shur_col[k] = (int)it.col();
+            shur_val[k] = (float)it.value();
+            shur_vald[k] = (double)it.value();
+            k++;
+        }
+    }
+    shur_row_start[n_c] = k;
+
+    shur_float_valid = true;
+}
+
+void ChSystemDescriptor::ShurComplementProductFloat(ChVectorDynamic<>& result,
+                                                    const ChVectorDynamic<>& lvector,
+                                                    std::vector<bool>* enabled) {
+    // Performs the sparse product  result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ]*l  reading the
+    // jacobian from the packed single-precision cache (half the memory traffic of the double
+    // precision path); all sums are accumulated in double precision.
+
+    auto vv_size = vvariables.size();
+
+    // 1 - sparse product  q = [Cq']*l
+    //     (serial: rows with shared variables scatter-add to the same entries of q)
+    shur_q.setZero(n_q);
+    for (int ic = 0; ic < n_c; ic++) {
+        bool process = (!enabled) || (*enabled)[ic];
+        if (!process)
+            continue;
+        double li = lvector(ic);
+        for (int k = shur_row_start[ic]; k < shur_row_start[ic + 1]; k++)
+            shur_q(shur_col[k]) += (double)shur_val[k] * li;
+    }
+
+    // 2 - block-diagonal product  w = [M^(-1)]*q  (negligible traffic, kept in double precision);
+    //     also mirror the side effect of the standard path, leaving 'qb' = [M^(-1)][Cq']*l
+    shur_w.resize(n_q);
+#pragma omp parallel for schedule(static, 256) num_threads(nthreads)
+    for (int iv = 0; iv < (int)vv_size; iv++) {
+        if (vvariables[iv]->IsActive()) {
+            int off = vvariables[iv]->GetOffset();
+            int ndof = vvariables[iv]->Get_ndof();
+            vvariables[iv]->Compute_invMb_v(shur_w.segment(off, ndof), shur_q.segment(off, ndof));
+            vvariables[iv]->Get_qb() = shur_w.segment(off, ndof);
+        }
+    }
+
+    // 3 - sparse product  result = [Cq]*w + [E]*l  (in parallel: each row writes only its own entry)
+    result.resize(n_c);
+#pragma omp parallel for schedule(static, 256) num_threads(nthreads)
+    for (int ic = 0; ic < n_c; ic++) {
+        bool process = (!enabled) || (*enabled)[ic];
+        if (!process) {
+            result(ic) = 0;  // not enabled constraints, just set to 0 result
+            continue;
+        }
+        double acc = shur_cfm[ic] * lvector(ic);
+        for (int k = shur_row_start[ic]; k < shur_row_start[ic + 1]; k++)
+            acc += (double)shur_val[k] * shur_w(shur_col[k]);
+        result(ic) = acc;
+    }
+}
+
+void ChSystemDescriptor::ShurComplementProductFused(ChVectorDynamic<>& result,
+                                                    const ChVectorDynamic<>& lvector,
+                                                    std::vector<bool>* enabled) {
+    // Performs the sparse product  result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ]*l  entirely on the
+    // packed CSR copy of the jacobian: each constraint row is a contiguous run of (column, value)
+    // pairs, so every phase streams through memory once, without per-entry virtual calls.
+
+    auto vv_size = vvariables.size();
+
+    // 1 - sparse product  q = [Cq']*l
+    //     Rows acting on shared variables scatter-add to the same entries of q, so the parallel
+    //     path accumulates into per-thread buffers that are merged at the end.
+    if (nthreads > 1) {
+        if ((int)shur_scratch.size() < nthreads)
+            shur_scratch.resize(nthreads);
+#pragma omp parallel num_threads(nthreads)
+        {
+            ChVectorDynamic<>& buffer = shur_scratch[ChOMP::GetThreadNum()];
+            buffer.setZero(n_q);
+#pragma omp for schedule(static, 256)
+            for (int ic = 0; ic < n_c; ic++) {
+                bool process = (!enabled) || (*enabled)[ic];
+                if (!process)
+                    continue;
+                double li = lvector(ic);
+                for (int k = shur_row_start[ic]; k < shur_row_start[ic + 1]; k++)
+                    buffer(shur_col[k]) += shur_vald[k] * li;
+            }
+        }
+        shur_q = shur_scratch[0];
+        for (int it = 1; it < nthreads; it++)
+            shur_q += shur_scratch[it];
+    } else {
+        shur_q.setZero(n_q);
+        for (int ic = 0; ic < n_c; ic++) {
+            bool process = (!enabled) || (*enabled)[ic];
+            if (!process)
+                continue;
+            double li = lvector(ic);
+            for (int k = shur_row_start[ic]; k < shur_row_start[ic + 1]; k++)
+                shur_q(shur_col[k]) += shur_vald[k] * li;
+        }
+    }
+
+    // 2 - block-diagonal product  w = [M^(-1)]*q  (in parallel: each variable writes its own block);
+    //     also mirror the side effect of the standard path, leaving 'qb' = [M^(-1)][Cq']*l
+    shur_w.resize(n_q);
+#pragma omp parallel for schedule(static, 256) num_threads(nthreads)
+    for (int iv = 0; iv < (int)vv_size; iv++) {
+        if (vvariables[iv]->IsActive()) {
+            int off = vvariables[iv]->GetOffset();
+            int ndof = vvariables[iv]->Get_ndof();
+            vvariables[iv]->Compute_invMb_v(shur_w.segment(off, ndof), shur_q.segment(off, ndof));
+            vvariables[iv]->Get_qb() = shur_w.segment(off, ndof);
+        }
+    }
+
+    // 3 - sparse product  result = [Cq]*w + [E]*l  (in parallel: each row writes only its own entry)
+    result.resize(n_c);
+#pragma omp parallel for schedule(static, 256) num_threads(nthreads)
+    for (int ic = 0; ic < n_c; ic++) {
+        bool process = (!enabled) || (*enabled)[ic];
+        if (!process) {
+            result(ic) = 0;  // not enabled constraints, just set to 0 result
+            continue;
+        }
+        double acc = shur_cfm[ic] * lvector(ic);
+        for (int k = shur_row_start[ic]; k < shur_row_start[ic + 1]; k++)
+            acc += shur_vald[k] * shur_w(shur_col[k]);
+        result(ic) = acc;
+    }
+}
+
 void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVectorDynamic<>& x) {
     n_q = CountActiveVariables();
     n_c = CountActiveConstraints();
@@ -555,27 +913,53 @@ void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVector
 
     // 1) First row: result.q part =  [M + K]*x.q + [Cq']*x.l
 
-    // 1.1)  do  M*x.q
-    for (size_t iv = 0; iv < vv_size; iv++) {
+    // 1.1)  do  M*x.q  (in parallel: each active variable writes only its own block of result)
+#pragma omp parallel for schedule(static, 256) num_threads(nthreads)
+    for (int iv = 0; iv < (int)vv_size; iv++) {
         if (vvariables[iv]->IsActive()) {
             vvariables[iv]->MultiplyAndAdd(result, x, c_a);
         }
     }
 
-    // 1.2)  add also K*x.q  (NON straight parallelizable - risk of concurrency in writing)
-    for (size_t ik = 0; ik < vs_size; ik++) {
-        vstiffness[ik]->MultiplyAndAdd(result, x);
-    }
-
-    // 1.3)  add also [Cq]'*x.l  (NON straight parallelizable - risk of concurrency in writing)
-    for (size_t ic = 0; ic < vc_size; ic++) {
-        if (vconstraints[ic]->IsActive()) {
-            vconstraints[ic]->MultiplyTandAdd(result, x(vconstraints[ic]->GetOffset() + n_q));
+    // 1.2 - 1.3)  add also  K*x.q  and  [Cq]'*x.l
+    // These are scatter-add operations with overlapping targets (different K blocks and different
+    // constraints can write to the same entries of result), so the parallel path accumulates the
+    // contributions in per-thread buffers that are merged at the end.
+    if (nthreads > 1 && (vs_size + vc_size > 0)) {
+        if ((int)product_scratch.size() < nthreads)
+            product_scratch.resize(nthreads);
+#pragma omp parallel num_threads(nthreads)
+        {
+            ChVectorDynamic<>& buffer = product_scratch[ChOMP::GetThreadNum()];
+            buffer.setZero(n_q + n_c);
+#pragma omp for schedule(static) nowait
+            for (int ik = 0; ik < (int)vs_size; ik++) {
+                vstiffness[ik]->MultiplyAndAdd(buffer, x);
+            }
+#pragma omp for schedule(static, 256)
+            for (int ic = 0; ic < (int)vc_size; ic++) {
+                if (vconstraints[ic]->IsActive()) {
+                    vconstraints[ic]->MultiplyTandAdd(buffer, x(vconstraints[ic]->GetOffset() + n_q));
+                }
+            }
+        }
+        for (int it = 0; it < nthreads; it++)
+            result += product_scratch[it];
+    } else {
+        for (size_t ik = 0; ik < vs_size; ik++) {
+            vstiffness[ik]->MultiplyAndAdd(result, x);
+        }
+        for (size_t ic = 0; ic < vc_size; ic++) {
+            if (vconstraints[ic]->IsActive()) {
+                vconstraints[ic]->MultiplyTandAdd(result, x(vconstraints[ic]->GetOffset() + n_q));
+            }
         }
     }
 
     // 2) Second row: result.l part =  [C_q]*x.q + [E]*x.l
-    for (size_t ic = 0; ic < vc_size; ic++) {
+    // (in parallel: each active constraint writes only its own row)
+#pragma omp parallel for schedule(static, 256) num_threads(nthreads)
+    for (int ic = 0; ic < (int)vc_size; ic++) {
         if (vconstraints[ic]->IsActive()) {
             int s_c = vconstraints[ic]->GetOffset() + n_q;
             vconstraints[ic]->MultiplyAndAdd(result(s_c), x);       // result.l_i += [C_q_i]*x.q
@@ -587,11 +971,8 @@ void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVector
 void ChSystemDescriptor::ConstraintsProject(ChVectorDynamic<>& multipliers) {
     FromVectorToConstraints(multipliers);
 
-    auto vc_size = vconstraints.size();
-
-    for (size_t ic = 0; ic < vc_size; ic++) {
-        if (vconstraints[ic]->IsActive())
-            vconstraints[ic]->Project();
+    for (ChConstraint* con : reg_cons) {
+        con->Project();
     }
 
     FromConstraintsToVector(multipliers, false);
@@ -600,28 +981,24 @@ void ChSystemDescriptor::ConstraintsProject(ChVectorDynamic<>& multipliers) {
 void ChSystemDescriptor::UnknownsProject(ChVectorDynamic<>& mx) {
     n_q = CountActiveVariables();
 
-    auto vc_size = vconstraints.size();
+    if (!registry_valid)
+        PackActiveRegistry();
 
     // vector -> constraints
     // Fetch from the second part of vector (x.l = -l), with flipped sign!
-    for (size_t ic = 0; ic < vc_size; ic++) {
-        if (vconstraints[ic]->IsActive()) {
-            vconstraints[ic]->Set_l_i(-mx(vconstraints[ic]->GetOffset() + n_q));
-        }
+    for (ChConstraint* con : reg_cons) {
+        con->Set_l_i(-mx(con->GetOffset() + n_q));
     }
 
     // constraint projection!
-    for (size_t ic = 0; ic < vc_size; ic++) {
-        if (vconstraints[ic]->IsActive())
-            vconstraints[ic]->Project();
+    for (ChConstraint* con : reg_cons) {
+        con->Project();
     }
 
     // constraints -> vector
     // Fill the second part of vector, x.l, with constraint multipliers -l (with flipped sign!)
-    for (size_t ic = 0; ic < vc_size; ic++) {
-        if (vconstraints[ic]->IsActive()) {
-            mx(vconstraints[ic]->GetOffset() + n_q) = -vconstraints[ic]->Get_l_i();
-        }
+    for (ChConstraint* con : reg_cons) {
+        mx(con->GetOffset() + n_q) = -con->Get_l_i();
     }
 }
 
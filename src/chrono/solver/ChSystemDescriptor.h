@@ -15,6 +15,7 @@
 #ifndef CHSYSTEMDESCRIPTOR_H
 #define CHSYSTEMDESCRIPTOR_H
 
+#include <utility>
 #include <vector>
 
 #include "chrono/solver/ChConstraint.h"
@@ -70,6 +71,10 @@ namespace chrono {
 /// and variables structures with other, more efficient data schemes.
 
 class ChApi ChSystemDescriptor {
+  public:
+    /// Number of doubles in the fixed scratch arena embedded in each descriptor (see AcquireScratch).
+    static const int SCRATCH_ARENA_SIZE = 1024;
+
   protected:
     std::vector<ChConstraint*> vconstraints;  ///< list of pointers to all the ChConstraint in the current Chrono system
     std::vector<ChVariables*> vvariables;     ///< list of pointers to all the ChVariables in the current Chrono system
@@ -77,11 +82,82 @@ class ChApi ChSystemDescriptor {
 
     double c_a;  // coefficient form M mass matrices in vvariables
 
+    int nthreads;  ///< number of threads used in the parallel assembly and product loops
+
+    std::vector<ChVectorDynamic<>> product_scratch;  ///< per-thread accumulation buffers for scatter-add products
+
   private:
     int n_q;            ///< number of active variables
     int n_c;            ///< number of active constraints
     bool freeze_count;  ///< for optimization: avoid to re-count the number of active variables and constraints
 
+    // Packed cache of the constraint jacobian [Cq], in CSR layout, used by the opt-in fused and
+    // mixed-precision ShurComplementProduct() paths (see EnableFusedShurProduct and
+    // EnableMixedPrecisionShurProduct).
+    bool use_shur_float;                 ///< use the mixed-precision Schur complement product
+    bool use_shur_fused;                 ///< use the fused packed-jacobian Schur complement product
+    bool shur_float_valid;               ///< the packed jacobian cache matches the current problem data
+    std::vector<int> shur_row_start;     ///< CSR row pointers (one per scalar constraint, plus end marker)
+    std::vector<int> shur_col;           ///< CSR column indices (variable offsets)
+    std::vector<float> shur_val;         ///< CSR values, jacobian entries in single precision
+    std::vector<double> shur_vald;       ///< CSR values, jacobian entries in double precision
+    std::vector<double> shur_cfm;        ///< per-row constraint force mixing terms
+    ChSparseMatrix shur_Cq_build;        ///< scratch sparse matrix used when packing the cache
+    ChVectorDynamic<> shur_q;            ///< scratch vector  Cq' * l
+    ChVectorDynamic<> shur_w;            ///< scratch vector  M^(-1) * Cq' * l
+    std::vector<ChVectorDynamic<>> shur_scratch;  ///< per-thread accumulation buffers for the fused product
+
+    double scratch_arena[SCRATCH_ARENA_SIZE];            ///< fixed scratch arena serving small systems
+    int scratch_used;                                    ///< doubles of the fixed arena currently lent out
+    std::vector<std::pair<double*, int>> scratch_stack;  ///< outstanding scratch buffers (LIFO)
+
+    // Packed registry of the active items. For each active variable, the data needed by the
+    // per-iteration vector shuttling loops (offset, size, direct pointers to the 'qb' and 'fb'
+    // block storage) is copied into a contiguous array of POD records, and the active constraints
+    // are packed into a dense pointer array, so that those loops - executed at every iteration of
+    // the VI solvers - stream through compact records instead of scanning the full object lists
+    // and re-testing inactive items. The registry is rebuilt lazily (once per insertion cycle,
+    // reusing the array capacity) whenever counts and offsets change.
+    struct ChVariableRecord {
+        ChVariables* var;   ///< the variable object, for the (few) operations needing virtual calls
+        double* qb;         ///< direct pointer to the variable 'qb' block storage
+        const double* fb;   ///< direct pointer to the variable 'fb' block storage
+        int offset;         ///< offset of the block in the system-level 'q' vector
+        int ndof;           ///< size of the block
+    };
+    bool registry_valid;                       ///< the packed registry matches the current offsets
+    std::vector<ChVariableRecord> reg_vars;    ///< packed records of the active variables
+    std::vector<ChConstraint*> reg_cons;       ///< active constraints, densely packed
+
+    /// Rebuild the packed registry of the active variables and constraints.
+    void PackActiveRegistry();
+
+    /// Rebuild the packed CSR cache of the constraint jacobian.
+    void PackShurFloatCache();
+
+    /// Mixed-precision implementation of ShurComplementProduct(): jacobian entries are read from
+    /// the single-precision cache, all accumulations are carried out in double precision.
+    void ShurComplementProductFloat(ChVectorDynamic<>& result,
+                                    const ChVectorDynamic<>& lvector,
+                                    std::vector<bool>* enabled);
+
+    /// Fused implementation of ShurComplementProduct(): all phases stream through the packed CSR
+    /// cache (no virtual calls) and the scatter phase accumulates into per-thread buffers.
+    void ShurComplementProductFused(ChVectorDynamic<>& result,
+                                    const ChVectorDynamic<>& lvector,
+                                    std::vector<bool>* enabled);
+
+    bool prune_sleeping_constraints;  ///< drop constraints acting only on inactive variables
+
+    /// Remove from the constraint list all constraints whose variable blocks are all inactive.
+    void PruneConstraintsWithNoActiveVariables();
+
+    /// Stamp all stiffness blocks into the given sparse matrix, adding to existing coefficients.
+    /// With more than one thread, the blocks are assembled in two phases: each thread stamps its
+    /// share of the blocks into a private sparse matrix, and the per-thread partial sums are then
+    /// merged (pairwise) and added to the storage in a single pass.
+    void AddStiffnessBlocks(ChSparseMatrix& storage);
+
   public:
     /// Constructor
     ChSystemDescriptor();
@@ -118,7 +194,12 @@ class ChApi ChSystemDescriptor {
 
     /// End insertion of items.
     /// A derived class should always call UpdateCountsAndOffsets.
-    virtual void EndInsertion() { UpdateCountsAndOffsets(); }
+    virtual void EndInsertion() {
+        if (prune_sleeping_constraints)
+            PruneConstraintsWithNoActiveVariables();
+        UpdateCountsAndOffsets();
+        shur_float_valid = false;
+    }
 
     /// Count & returns the scalar variables in the system (excluding ChVariable objects
     /// that have  IsActive() as false). Note: the number of scalar variables is not necessarily
@@ -146,6 +227,50 @@ class ChApi ChSystemDescriptor {
     /// when performing ShurComplementProduct(), SystemProduct(), ConvertToMatrixForm(),
     virtual double GetMassFactor() { return c_a; }
 
+    /// Set the number of threads used in the parallel loops of SystemProduct(), ShurComplementProduct(),
+    /// and ConvertToMatrixForm() (default: 1).
+    /// Note that this is set automatically by ChSystem, using the value specified in ChSystem::SetNumThreads().
+    virtual void SetNumThreads(int num_threads) { nthreads = (num_threads < 1) ? 1 : num_threads; }
+
+    /// Get the number of threads used in the parallel assembly and product loops.
+    int GetNumThreads() const { return nthreads; }
+
+    /// Enable/disable pruning of constraints acting only on inactive variables (default: false).
+    /// When enabled, EndInsertion() drops from the descriptor all constraints whose variable
+    /// blocks are all inactive - e.g. joints and contacts within an island of sleeping and/or
+    /// fixed bodies (see ChConstraint::HasActiveVariables). Such constraints cannot exert any
+    /// effect on the active unknowns, so the solver problem shrinks to the active set. The
+    /// constraint list is rebuilt at every insertion cycle, hence pruned constraints re-enter the
+    /// problem automatically as soon as one of their bodies wakes up.
+    virtual void EnableSleepingConstraintPruning(bool val) { prune_sleeping_constraints = val; }
+
+    /// Enable/disable the mixed-precision Schur complement product (default: false).
+    /// When enabled, ShurComplementProduct() reads the constraint jacobian from a packed
+    /// single-precision copy (rebuilt automatically whenever the problem data change), while all
+    /// accumulations stay in double precision. This halves the memory traffic on the jacobian,
+    /// the dominant cost of the product in large bandwidth-bound problems, at the price of the
+    /// jacobian entries being rounded to single precision.
+    /// Note that this is set automatically by iterative VI solvers, using the value specified in
+    /// ChIterativeSolverVI::SetMixedPrecision().
+    virtual void EnableMixedPrecisionShurProduct(bool val) {
+        use_shur_float = val;
+        shur_float_valid = false;
+    }
+
+    /// Enable/disable the fused Schur complement product (default: false).
+    /// When enabled, ShurComplementProduct() runs entirely on a packed CSR copy of the constraint
+    /// jacobian (rebuilt automatically whenever the problem data change): each scalar constraint
+    /// row is a contiguous run of (column, value) pairs, so every phase of the product streams
+    /// through memory once, without per-entry virtual calls, and the scatter phase q = [Cq']*l -
+    /// serial in the standard path because rows acting on shared variables collide - is
+    /// parallelized over per-thread accumulation buffers. This is the innermost loop of the
+    /// iterative VI solvers, hence the dominant cost of NSC simulations with many contacts.
+    /// This option takes precedence over the mixed-precision product if both are enabled.
+    virtual void EnableFusedShurProduct(bool val) {
+        use_shur_fused = val;
+        shur_float_valid = false;
+    }
+
     // DATA <-> MATH.VECTORS FUNCTIONS
 
     /// Get a vector with all the 'fb' known terms ('forces'etc.) associated to all variables,
@@ -238,6 +363,44 @@ class ChApi ChSystemDescriptor {
     virtual int FromVectorToUnknowns(const ChVectorDynamic<>& mvector  ///< system-level vector x={q,l}
     );
 
+    /// In-place version of FromVariablesToVector(), writing into a caller-provided raw buffer of (at least)
+    /// CountActiveVariables() doubles. No allocation, resizing, or zero-fill is performed; entries of inactive
+    /// variables are left untouched. Intended for hot loops (e.g. HIL models stepped at kHz rates) where the
+    /// per-call allocation of a temporary vector is measurable.
+    /// \return  the number of scalar variables written.
+    virtual int FromVariablesToBuffer(double* buffer  ///< system-level vector 'q' (caller-provided)
+    );
+
+    /// In-place version of FromVectorToVariables(), reading from a caller-provided raw buffer of (at least)
+    /// CountActiveVariables() doubles. The same caveats on amount and ordering of the variable objects apply.
+    /// \return  the number of scalar variables read.
+    virtual int FromBufferToVariables(const double* buffer  ///< system-level vector 'q' (caller-provided)
+    );
+
+    /// In-place version of FromConstraintsToVector(), writing into a caller-provided raw buffer of (at least)
+    /// CountActiveConstraints() doubles. No allocation, resizing, or zero-fill is performed.
+    /// \return  the number of scalar constraint multipliers written.
+    virtual int FromConstraintsToBuffer(double* buffer  ///< system-level vector 'l_i' (caller-provided)
+    );
+
+    /// In-place version of FromVectorToConstraints(), reading from a caller-provided raw buffer of (at least)
+    /// CountActiveConstraints() doubles.
+    /// \return  the number of scalar constraint multipliers read.
+    virtual int FromBufferToConstraints(const double* buffer  ///< system-level vector 'l_i' (caller-provided)
+    );
+
+    // SCRATCH ARENA
+
+    /// Borrow a scratch buffer of n doubles from the descriptor scratch arena.
+    /// Buffers are stacked and must be returned in reverse order of acquisition with ReleaseScratch().
+    /// As long as the combined outstanding requests fit the fixed arena (SCRATCH_ARENA_SIZE doubles), buffers
+    /// are served from descriptor-owned storage with no heap allocation - the common case for small systems.
+    /// Larger requests transparently fall back to individual heap blocks.
+    double* AcquireScratch(int n);
+
+    /// Return the most recently acquired scratch buffer (of n doubles) to the arena.
+    void ReleaseScratch(int n);
+
     // MATHEMATICAL OPERATIONS ON DATA
 
     /// Performs the product of N, the Shur complement of the KKT matrix, by an 'l' vector
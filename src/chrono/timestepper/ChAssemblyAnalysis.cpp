@@ -23,6 +23,9 @@ ChAssemblyAnalysis::ChAssemblyAnalysis(ChIntegrableIIorder& mintegrable) {
     V.setZero(1, &mintegrable);
     A.setZero(1, &mintegrable);
     max_assembly_iters = 4;
+    abs_tol = 0;
+    use_line_search = false;
+    ls_max_halvings = 5;
 }
 
 void ChAssemblyAnalysis::AssemblyAnalysis(int action, double dt) {
@@ -35,6 +38,8 @@ void ChAssemblyAnalysis::AssemblyAnalysis(int action, double dt) {
 
     if (action & AssemblyLevel::POSITION) {
         ChStateDelta Dx;
+        ChState Xnew;
+        Xnew.setZero(integrable->GetNcoords_x(), GetIntegrable());
 
         for (int m_iter = 0; m_iter < max_assembly_iters; m_iter++) {
             // Set up auxiliary vectors
@@ -52,6 +57,11 @@ void ChAssemblyAnalysis::AssemblyAnalysis(int action, double dt) {
 
             integrable->LoadConstraint_C(Qc, 1.0);
 
+            // Stop early if the constraint violation is already within tolerance
+            double C_norm = (integrable->GetNconstr() > 0) ? Qc.lpNorm<Eigen::Infinity>() : 0.0;
+            if (C_norm <= abs_tol)
+                break;
+
             integrable->StateSolveCorrection(
                 Dx, L, R, Qc,
                 1.0,      // factor for  M
@@ -63,7 +73,21 @@ void ChAssemblyAnalysis::AssemblyAnalysis(int action, double dt) {
                 true      // force a call to the solver's Setup function
                 );
 
-            X += Dx;
+            // Optional line search: halve the correction until the constraint violation stops growing
+            double alpha = 1.0;
+            if (use_line_search) {
+                for (int ls = 0; ls < ls_max_halvings; ls++) {
+                    Xnew = X + Dx * alpha;
+                    integrable->StateScatter(Xnew, V, T, true);
+                    Qc.setZero();
+                    integrable->LoadConstraint_C(Qc, 1.0);
+                    if (Qc.lpNorm<Eigen::Infinity>() <= C_norm)
+                        break;
+                    alpha *= 0.5;
+                }
+            }
+
+            X += Dx * alpha;
 
             integrable->StateScatter(X, V, T, true);  // state -> system
         }
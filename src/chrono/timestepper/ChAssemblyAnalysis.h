@@ -40,6 +40,9 @@ class ChApi ChAssemblyAnalysis {
     ChStateDelta A;
     ChVectorDynamic<> L;
     int max_assembly_iters;
+    double abs_tol;
+    bool use_line_search;
+    int ls_max_halvings;
 
   public:
     ChAssemblyAnalysis(ChIntegrableIIorder& mintegrable);
@@ -58,6 +61,22 @@ class ChApi ChAssemblyAnalysis {
     /// Get the max number of Newton-Raphson iterations for the position assembly procedure.
     int GetMaxAssemblyIters() { return max_assembly_iters; }
 
+    /// Set the tolerance on the constraint violation (infinity norm) for the position assembly procedure
+    /// (default: 0). The Newton-Raphson iteration stops as soon as the violation is below the tolerance,
+    /// which on already nearly-assembled models avoids running through all allowed iterations.
+    void SetTolerance(double tol) { abs_tol = tol; }
+    /// Get the tolerance on the constraint violation for the position assembly procedure.
+    double GetTolerance() const { return abs_tol; }
+
+    /// Enable/disable a line search on the position corrections (default: disabled).
+    /// When enabled, a full Newton correction that increases the constraint violation is halved (at most
+    /// max_halvings times) before being accepted. This stabilizes assembly of models that start far from a
+    /// feasible configuration, at the cost of one constraint re-evaluation per trial.
+    void SetLineSearch(bool enable, int max_halvings = 5) {
+        use_line_search = enable;
+        ls_max_halvings = max_halvings;
+    }
+
     /// Get the integrable object.
     ChIntegrable* GetIntegrable() { return integrable; }
 
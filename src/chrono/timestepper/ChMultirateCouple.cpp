@@ -0,0 +1,100 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <cassert>
+
+#include "chrono/physics/ChShaft.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/timestepper/ChMultirateCouple.h"
+
+namespace chrono {
+
+// -----------------------------------------------------------------------------
+
+ChMultirateCouple::ChMultirateCouple(ChSystem* slow, ChSystem* fast, int substeps)
+    : m_slow(slow), m_fast(fast), m_substeps(substeps) {
+    assert(slow);
+    assert(fast);
+    assert(substeps >= 1);
+}
+
+void ChMultirateCouple::Advance(double macro_step) {
+    // Slowest-first: sample the coupling terms at both endpoints of the macro step, so that the
+    // fast substeps can interpolate in between.
+    for (auto& coupling : m_couplings)
+        coupling->SampleBegin();
+
+    m_slow->DoStepDynamics(macro_step);
+
+    for (auto& coupling : m_couplings)
+        coupling->SampleEnd();
+
+    double substep = macro_step / m_substeps;
+    for (int k = 1; k <= m_substeps; k++) {
+        // Evaluate the coupling at the substep midpoint.
+        double alpha = (k - 0.5) / m_substeps;
+        for (auto& coupling : m_couplings)
+            coupling->Apply(alpha);
+        m_fast->DoStepDynamics(substep);
+    }
+
+    for (auto& coupling : m_couplings)
+        coupling->Feedback();
+}
+
+// -----------------------------------------------------------------------------
+
+ChMultirateShaftCoupling::ChMultirateShaftCoupling(std::shared_ptr<ChShaft> shaft_slow,
+                                                   std::shared_ptr<ChShaft> shaft_fast,
+                                                   double stiffness,
+                                                   double damping)
+    : m_shaft_slow(shaft_slow),
+      m_shaft_fast(shaft_fast),
+      m_k(stiffness),
+      m_c(damping),
+      m_pos0(0),
+      m_vel0(0),
+      m_pos1(0),
+      m_vel1(0),
+      m_torque(0),
+      m_torque_sum(0),
+      m_torque_count(0) {}
+
+void ChMultirateShaftCoupling::SampleBegin() {
+    m_pos0 = m_shaft_slow->GetPos();
+    m_vel0 = m_shaft_slow->GetPos_dt();
+    m_torque_sum = 0;
+    m_torque_count = 0;
+}
+
+void ChMultirateShaftCoupling::SampleEnd() {
+    m_pos1 = m_shaft_slow->GetPos();
+    m_vel1 = m_shaft_slow->GetPos_dt();
+}
+
+void ChMultirateShaftCoupling::Apply(double alpha) {
+    double pos_slow = m_pos0 + alpha * (m_pos1 - m_pos0);
+    double vel_slow = m_vel0 + alpha * (m_vel1 - m_vel0);
+    m_torque = m_k * (pos_slow - m_shaft_fast->GetPos()) + m_c * (vel_slow - m_shaft_fast->GetPos_dt());
+    m_shaft_fast->SetAppliedTorque(m_torque);
+    m_torque_sum += m_torque;
+    m_torque_count++;
+}
+
+void ChMultirateShaftCoupling::Feedback() {
+    // Apply the average reaction over the completed macro step to the slow shaft; it acts during
+    // the next macro step (one-macro-step lag).
+    if (m_torque_count > 0)
+        m_shaft_slow->SetAppliedTorque(-m_torque_sum / m_torque_count);
+}
+
+}  // end namespace chrono
@@ -0,0 +1,117 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_MULTIRATE_COUPLE_H
+#define CH_MULTIRATE_COUPLE_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+class ChSystem;
+class ChShaft;
+
+/// Multirate co-integration of a slow and a fast subsystem.
+///
+/// Stiff components (e.g. a ChShaft driveline needing 1e-5 s steps) force the step size of the whole
+/// system even when the remainder (e.g. the chassis) is fine at 1e-3 s. This facility partitions the
+/// model into two ChSystem rate groups and advances them with a slowest-first scheme: the slow system
+/// takes one macro step, then the fast system is advanced with substeps while the coupling terms
+/// sampled at the macro-step endpoints are linearly interpolated in between. Reactions of the fast
+/// group on the slow group are fed back with a one-macro-step lag.
+///
+/// Coupling terms are exchanged through user-provided ChMultirateCoupling objects; a ready-made
+/// stiff spring-damper coupling between two ChShaft elements is provided for the common
+/// driveline-to-chassis split.
+class ChApi ChMultirateCouple {
+  public:
+    /// Base class for a coupling term exchanged between the rate groups.
+    class ChApi Coupling {
+      public:
+        virtual ~Coupling() {}
+
+        /// Sample the coupling inputs from the slow subsystem at the start of a macro step.
+        virtual void SampleBegin() = 0;
+
+        /// Sample the coupling inputs from the slow subsystem at the end of a macro step.
+        virtual void SampleEnd() = 0;
+
+        /// Apply the coupling inputs to the fast subsystem, with the slow-side quantities
+        /// interpolated at fraction alpha (in [0,1]) across the current macro step.
+        virtual void Apply(double alpha) = 0;
+
+        /// Feed the reaction of the fast subsystem back to the slow subsystem.
+        /// Called once per macro step, after all substeps; the reaction therefore acts on the slow
+        /// group with a one-macro-step lag.
+        virtual void Feedback() = 0;
+    };
+
+    /// Construct a multirate coupler for the given rate groups.
+    ChMultirateCouple(ChSystem* slow,  ///< slow rate group, advanced with the macro step
+                      ChSystem* fast,  ///< fast rate group, advanced with substeps
+                      int substeps     ///< number of fast substeps per macro step
+    );
+
+    /// Set the number of fast substeps per macro step.
+    void SetSubsteps(int substeps) { m_substeps = substeps; }
+
+    /// Add a coupling term exchanged between the two rate groups.
+    void AddCoupling(std::shared_ptr<Coupling> coupling) { m_couplings.push_back(coupling); }
+
+    /// Advance both rate groups by one macro step of the specified length.
+    void Advance(double macro_step);
+
+  private:
+    ChSystem* m_slow;
+    ChSystem* m_fast;
+    int m_substeps;
+    std::vector<std::shared_ptr<Coupling>> m_couplings;
+};
+
+/// Stiff spring-damper coupling between a shaft in the slow group and a shaft in the fast group.
+/// Each fast substep applies the torque T = k (pos_slow - pos_fast) + c (vel_slow - vel_fast) to the
+/// fast shaft, with the slow shaft position and velocity interpolated across the macro step; the
+/// average reaction -T over the macro step is applied to the slow shaft for the next macro step.
+class ChApi ChMultirateShaftCoupling : public ChMultirateCouple::Coupling {
+  public:
+    ChMultirateShaftCoupling(std::shared_ptr<ChShaft> shaft_slow,  ///< coupled shaft in the slow group
+                             std::shared_ptr<ChShaft> shaft_fast,  ///< coupled shaft in the fast group
+                             double stiffness,                     ///< coupling torsional stiffness
+                             double damping                        ///< coupling torsional damping
+    );
+
+    virtual void SampleBegin() override;
+    virtual void SampleEnd() override;
+    virtual void Apply(double alpha) override;
+    virtual void Feedback() override;
+
+    /// Get the coupling torque applied to the fast shaft in the last substep.
+    double GetTorque() const { return m_torque; }
+
+  private:
+    std::shared_ptr<ChShaft> m_shaft_slow;
+    std::shared_ptr<ChShaft> m_shaft_fast;
+    double m_k;
+    double m_c;
+    double m_pos0, m_vel0;      ///< slow shaft state at macro-step start
+    double m_pos1, m_vel1;      ///< slow shaft state at macro-step end
+    double m_torque;            ///< coupling torque applied in the last substep
+    double m_torque_sum;        ///< accumulated coupling torque over the current macro step
+    int m_torque_count;         ///< number of substeps accumulated
+};
+
+}  // end namespace chrono
+
+#endif
@@ -31,23 +31,23 @@ class ChIntegrable;
 
 /// Class for state of time-integrable objects.
 /// This is a vector (one-column matrix) which extends ChVectorDynamic.
-class ChState : public ChVectorDynamic<double> {
+class ChState : public ChVectorDynamic<ChScalar> {
   public:
-    explicit ChState(ChIntegrable* intgr = 0) : ChVectorDynamic<double>(1) { integrable = intgr; }
+    explicit ChState(ChIntegrable* intgr = 0) : ChVectorDynamic<ChScalar>(1) { integrable = intgr; }
 
-    explicit ChState(Eigen::Index size, ChIntegrable* intgr) : ChVectorDynamic<double>(size) { integrable = intgr; }
+    explicit ChState(Eigen::Index size, ChIntegrable* intgr) : ChVectorDynamic<ChScalar>(size) { integrable = intgr; }
 
-    explicit ChState(ChVectorConstRef vec, ChIntegrable* intgr) : ChVectorDynamic<double>(vec) {
+    explicit ChState(ChVectorConstRef vec, ChIntegrable* intgr) : ChVectorDynamic<ChScalar>(vec) {
         integrable = intgr;
     }
 
     /// Copy constructor
-    ChState(const ChState& other) : ChVectorDynamic<double>(other) { integrable = other.integrable; }
+    ChState(const ChState& other) : ChVectorDynamic<ChScalar>(other) { integrable = other.integrable; }
 
     /// This method allows assigning Eigen expressions to ChStateDelta.
     template <typename OtherDerived>
     ChState& operator=(const Eigen::MatrixBase<OtherDerived>& other) {
-        this->Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor>::operator=(other);
+        this->Eigen::Matrix<ChScalar, Eigen::Dynamic, 1, Eigen::ColMajor>::operator=(other);
         return *this;
     }
 
@@ -96,7 +96,7 @@ class ChState : public ChVectorDynamic<double> {
     }
 
     /// Return this state vector scaled by the given value.
-    ChState operator*(double factor) const {
+    ChState operator*(ChScalar factor) const {
         ChState result(*this);
         result.ChVectorDynamic<>::operator*=(factor);
         return result;
@@ -122,49 +122,40 @@ class ChState : public ChVectorDynamic<double> {
 /// and y_new, but with spinors/angular velocities/etc. in dydt; so dim(y) is not dim(dydt);
 /// hence the need of this specific class for increments in states.
 /// This is a vector (one-column matrix) which extends ChVectorDynamic.
-class ChStateDelta : public ChVectorDynamic<double> {
+class ChStateDelta : public ChVectorDynamic<ChScalar> {
   public:
     /// Constructors
-    explicit ChStateDelta(ChIntegrable* intgr = 0) : ChVectorDynamic<double>(1) { integrable = intgr; }
+    explicit ChStateDelta(ChIntegrable* intgr = 0) : ChVectorDynamic<ChScalar>(1) { integrable = intgr; }
 
-    explicit ChStateDelta(Eigen::Index size, ChIntegrable* intgr) : ChVectorDynamic<double>(size) { integrable = intgr; }
+    explicit ChStateDelta(Eigen::Index size, ChIntegrable* intgr) : ChVectorDynamic<ChScalar>(size) { integrable = intgr; }
 
-    explicit ChStateDelta(ChVectorConstRef vec, ChIntegrable* intgr) : ChVectorDynamic<double>(vec) {
+    explicit ChStateDelta(ChVectorConstRef vec, ChIntegrable* intgr) : ChVectorDynamic<ChScalar>(vec) {
         integrable = intgr;
     }
 
     /// Copy constructor
-    ChStateDelta(const ChStateDelta& other) : ChVectorDynamic<double>(other) { integrable = other.integrable; }
+    ChStateDelta(const ChStateDelta& other) : ChVectorDynamic<ChScalar>(other) { integrable = other.integrable; }
 
     /// This method allows assigning Eigen expressions to ChStateDelta.
     template <typename OtherDerived>
     ChStateDelta& operator=(const Eigen::MatrixBase<OtherDerived>& other) {
-        this->Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor>::operator=(other);
+        this->Eigen::Matrix<ChScalar, Eigen::Dynamic, 1, Eigen::ColMajor>::operator=(other);
         return *this;
     }
 
-    /*
-    /// Multiplies this matrix by a factor, in place
-    template <class Real>
-    ChStateDelta operator*=(const Real factor) {
-        MatrScale(factor);
-        return *this;
-    }
-
-    /// Increments this matrix by another matrix, in place
-    template <class RealB>
-    ChStateDelta operator+=(const ChMatrix<RealB>& matbis) {
-        MatrInc(matbis);
+    /// Increment this state by an Eigen expression, in place (no temporary vector is allocated).
+    template <typename OtherDerived>
+    ChStateDelta& operator+=(const Eigen::MatrixBase<OtherDerived>& other) {
+        this->Eigen::Matrix<ChScalar, Eigen::Dynamic, 1, Eigen::ColMajor>::operator+=(other);
         return *this;
     }
 
-    /// Decrements this matrix by another matrix, in place
-    template <class RealB>
-    ChStateDelta operator-=(const ChMatrix<RealB>& matbis) {
-        MatrDec(matbis);
+    /// Decrement this state by an Eigen expression, in place (no temporary vector is allocated).
+    template <typename OtherDerived>
+    ChStateDelta& operator-=(const Eigen::MatrixBase<OtherDerived>& other) {
+        this->Eigen::Matrix<ChScalar, Eigen::Dynamic, 1, Eigen::ColMajor>::operator-=(other);
         return *this;
     }
-    */
 
     /// Unary minus operator.
     ChStateDelta operator-() {
@@ -173,9 +164,9 @@ class ChStateDelta : public ChVectorDynamic<double> {
         return result;
     }
 
-    /// Scale this state by the given value.
-    ChStateDelta& operator *=(double factor) {
-        ChVectorDynamic<>::operator*(factor);
+    /// Scale this state by the given value, in place.
+    ChStateDelta& operator *=(ChScalar factor) {
+        ChVectorDynamic<>::operator*=(factor);
         return *this;
     }
 
@@ -194,7 +185,7 @@ class ChStateDelta : public ChVectorDynamic<double> {
     }
 
     /// Return this state vector scaled by the given value.
-    ChStateDelta operator*(double factor) const {
+    ChStateDelta operator*(ChScalar factor) const {
         ChStateDelta result(*this);
         result.ChVectorDynamic<>::operator*=(factor);
         return result;
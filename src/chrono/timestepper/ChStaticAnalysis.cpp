@@ -84,7 +84,10 @@ ChStaticNonLinearAnalysis::ChStaticNonLinearAnalysis()
       m_use_correction_test(true),
       m_reltol(1e-4),
       m_abstol(1e-8),
-      m_verbose(false) {}
+      m_verbose(false),
+      m_use_line_search(false),
+      m_ls_tolerance(1.0),
+      m_ls_max_halvings(5) {}
 
 void ChStaticNonLinearAnalysis::StaticAnalysis() {
     ChIntegrableIIorder* integrable = static_cast<ChIntegrableIIorder*>(m_integrable);
@@ -138,6 +141,10 @@ void ChStaticNonLinearAnalysis::StaticAnalysis() {
         integrable->LoadConstraint_C(Qc, 1.0);
 
         double cfactor = ChMin(1.0, (i + 2.0) / (m_incremental_steps + 1.0));
+
+        // Unscaled residual merit, used as reference by the optional line search
+        double merit_old = ChMax(R.lpNorm<Eigen::Infinity>(), Qc.lpNorm<Eigen::Infinity>());
+
         R *= cfactor;
         Qc *= cfactor;
 
@@ -172,7 +179,29 @@ void ChStaticNonLinearAnalysis::StaticAnalysis() {
             true                           // force a call to the solver's Setup() function
         );
 
-        Xnew = X + Dx;
+        // Optional backtracking line search: halve the step until the residual merit stops growing.
+        // R and Qc are re-assembled at the candidate state (they are rebuilt at the next iteration anyway).
+        double alpha = 1.0;
+        if (m_use_line_search) {
+            for (int ls = 0; ls < m_ls_max_halvings; ls++) {
+                Xnew = X + Dx * alpha;
+                integrable->StateScatter(Xnew, V, T, true);
+                R.setZero();
+                Qc.setZero();
+                integrable->LoadResidual_F(R, 1.0);
+                integrable->LoadConstraint_C(Qc, 1.0);
+                double merit = ChMax(R.lpNorm<Eigen::Infinity>(), Qc.lpNorm<Eigen::Infinity>());
+                if (merit <= m_ls_tolerance * merit_old)
+                    break;
+                alpha *= 0.5;
+                if (m_verbose) {
+                    GetLog() << "---     line search: merit " << merit << " > " << merit_old
+                             << "; retry with step factor " << alpha << "\n";
+                }
+            }
+        }
+
+        Xnew = X + Dx * alpha;
 
         if (m_use_correction_test) {
             // Calculate actual correction in X
@@ -217,6 +246,12 @@ void ChStaticNonLinearAnalysis::SetResidualTolerance(double tol) {
     m_abstol = tol;
 }
 
+void ChStaticNonLinearAnalysis::SetLineSearch(bool enable, double tolerance, int max_halvings) {
+    m_use_line_search = enable;
+    m_ls_tolerance = tolerance;
+    m_ls_max_halvings = max_halvings;
+}
+
 void ChStaticNonLinearAnalysis::SetMaxIterations(int max_iters) {
     m_maxiters = max_iters;
     if (m_incremental_steps > m_maxiters)
@@ -45,6 +45,34 @@ class my_enum_mappers : public ChTimestepper {
     CH_ENUM_MAPPER_END(Type);
 };
 
+void ChTimestepper::UpdateSuggestedStep(double dt, double err_norm, double constr_violation) {
+    err_estimate = err_norm;
+
+    // PI controller on the error ratio (err_norm = 1 means error exactly at tolerance).
+    // With no usable estimate (first step, or zero error) allow the maximum growth.
+    const double max_growth = 2.0;
+    const double min_shrink = 0.2;
+
+    double factor;
+    if (err_norm <= 0) {
+        factor = max_growth;
+    } else {
+        factor = adapt_safety * std::pow(1.0 / err_norm, adapt_gain_I);
+        if (err_prev > 0)
+            factor *= std::pow(err_prev / err_norm, adapt_gain_P);
+        factor = ChMin(max_growth, ChMax(min_shrink, factor));
+    }
+
+    // Constraint-violation-aware clamping: the embedded estimate sees only the velocity states,
+    // so a drifting constraint set must independently hold the step down until the stabilization
+    // terms have worked the violation off.
+    if (constr_violation > adapt_cviol_limit)
+        factor = ChMin(factor, (constr_violation > 10 * adapt_cviol_limit) ? 0.5 : 1.0);
+
+    dt_suggested = ChClamp(dt * factor, adapt_dt_min, adapt_dt_max);
+    err_prev = err_norm;
+}
+
 void ChTimestepper::ArchiveOut(ChArchiveOut& archive) {
     // version number
     archive.VersionWrite<ChTimestepper>();
@@ -84,6 +112,8 @@ void ChTimestepperEulerExpl::Advance(const double dt) {
 
     // setup auxiliary vectors
     L.setZero(GetIntegrable()->GetNconstr());
+    Ynew.setZero(GetIntegrable()->GetNcoords_y(), GetIntegrable());
+    Dy.setZero(GetIntegrable()->GetNcoords_dy(), GetIntegrable());
 
     GetIntegrable()->StateGather(Y, T);  // state <- system
 
@@ -91,8 +121,11 @@ void ChTimestepperEulerExpl::Advance(const double dt) {
 
     // Euler formula!
     //   y_new= y + dy/dt * dt
+    // (use the persistent scratch vectors, to avoid per-step heap allocations)
 
-    Y = Y + dYdt * dt;  //  also: GetIntegrable().StateIncrement(y_new, y, Dy);
+    Dy = dt * dYdt;
+    GetIntegrable()->StateIncrement(Ynew, Y, Dy);
+    Y = Ynew;
 
     T += dt;
 
@@ -124,6 +157,7 @@ void ChTimestepperEulerExplIIorder::Advance(const double dt) {
 
     // setup auxiliary vectors
     Dv.setZero(mintegrable->GetNcoords_v(), GetIntegrable());
+    Xnew.setZero(mintegrable->GetNcoords_x(), mintegrable);
     L.setZero(mintegrable->GetNconstr());
 
     mintegrable->StateGather(X, V, T);  // state <- system
@@ -131,10 +165,13 @@ void ChTimestepperEulerExplIIorder::Advance(const double dt) {
     mintegrable->StateSolveA(A, L, X, V, T, dt, false, false);  // Dv/dt = f(x,v,T)
 
     // Euler formula!
+    // (use the persistent scratch vectors, to avoid per-step heap allocations)
 
-    X = X + V * dt;  // x_new= x + v * dt
+    Dv = dt * V;
+    mintegrable->StateIncrement(Xnew, X, Dv);  // x_new= x + v * dt
+    X = Xnew;
 
-    V = V + A * dt;  // v_new= v + a * dt
+    V += dt * A;  // v_new= v + a * dt
 
     T += dt;
 
@@ -164,16 +201,21 @@ void ChTimestepperEulerSemiImplicit::Advance(const double dt) {
 
     // setup auxiliary vectors
     L.setZero(mintegrable->GetNconstr());
+    Xnew.setZero(mintegrable->GetNcoords_x(), mintegrable);
+    Dx.setZero(mintegrable->GetNcoords_v(), GetIntegrable());
 
     mintegrable->StateGather(X, V, T);  // state <- system
 
     mintegrable->StateSolveA(A, L, X, V, T, dt, false, false);  // Dv/dt = f(x,v,T)   Dv = f(x,v,T)*dt
 
     // Semi-implicit Euler formula!   (note the order of update of x and v, respect to original Euler II order explicit)
+    // (use the persistent scratch vectors, to avoid per-step heap allocations)
 
-    V = V + A * dt;  // v_new= v + a * dt
+    V += dt * A;  // v_new= v + a * dt
 
-    X = X + V * dt;  // x_new= x + v_new * dt
+    Dx = dt * V;
+    mintegrable->StateIncrement(Xnew, X, Dx);  // x_new= x + v_new * dt
+    X = Xnew;
 
     T += dt;
 
@@ -203,6 +245,7 @@ void ChTimestepperRungeKuttaExpl::Advance(const double dt) {
     Dydt2.setZero(n_dy, GetIntegrable());
     Dydt3.setZero(n_dy, GetIntegrable());
     Dydt4.setZero(n_dy, GetIntegrable());
+    Dy.setZero(n_dy, GetIntegrable());
     L.setZero(n_c);
 
     GetIntegrable()->StateGather(Y, T);  // state <- system
@@ -212,17 +255,29 @@ void ChTimestepperRungeKuttaExpl::Advance(const double dt) {
                                 false   // full update? (not used since no scatter)
     );  
 
-    y_new = Y + Dydt1 * 0.5 * dt;  // integrable.StateIncrement(y_new, Y, Dydt1*0.5*dt);
+    // (combine the stage increments in the persistent Dy scratch, to avoid per-step heap allocations)
+
+    Dy = (0.5 * dt) * Dydt1;
+    GetIntegrable()->StateIncrement(y_new, Y, Dy);  // y_new = Y + Dydt1*0.5*dt
     GetIntegrable()->StateSolve(Dydt2, L, y_new, T + dt * 0.5, dt, true, true);
 
-    y_new = Y + Dydt2 * 0.5 * dt;  // integrable.StateIncrement(y_new, Y, Dydt2*0.5*dt);
+    Dy = (0.5 * dt) * Dydt2;
+    GetIntegrable()->StateIncrement(y_new, Y, Dy);  // y_new = Y + Dydt2*0.5*dt
     GetIntegrable()->StateSolve(Dydt3, L, y_new, T + dt * 0.5, dt, true, true);
 
-    y_new = Y + Dydt3 * dt;  // integrable.StateIncrement(y_new, Y, Dydt3*dt);
+    Dy = dt * Dydt3;
+    GetIntegrable()->StateIncrement(y_new, Y, Dy);  // y_new = Y + Dydt3*dt
     GetIntegrable()->StateSolve(Dydt4, L, y_new, T + dt, dt, true, true);
 
-    Y = Y + (Dydt1 + Dydt2 * 2.0 + Dydt3 * 2.0 + Dydt4) * (1. / 6.) * dt;  // integrable.StateIncrement(...);
-    dYdt = Dydt4;                                                          // to check
+    Dy = Dydt1;
+    Dy += 2.0 * Dydt2;
+    Dy += 2.0 * Dydt3;
+    Dy += Dydt4;
+    Dy *= (1. / 6.);
+    Dy *= dt;
+    GetIntegrable()->StateIncrement(y_new, Y, Dy);  // Y = Y + (Dydt1 + Dydt2*2 + Dydt3*2 + Dydt4)*(1/6)*dt
+    Y = y_new;
+    dYdt = Dydt4;  // to check
     T += dt;
 
     GetIntegrable()->StateScatter(Y, T, true);            // state -> system
@@ -249,6 +304,7 @@ void ChTimestepperHeun::Advance(const double dt) {
     y_new.setZero(n_y, GetIntegrable());
     Dydt1.setZero(n_dy, GetIntegrable());
     Dydt2.setZero(n_dy, GetIntegrable());
+    Dy.setZero(n_dy, GetIntegrable());
     L.setZero(n_c);
 
     GetIntegrable()->StateGather(Y, T);  // state <- system
@@ -257,10 +313,15 @@ void ChTimestepperHeun::Advance(const double dt) {
                                 false,  // no need to scatter state before computation
                                 false   // full update? ( not used, since no scatter)
     );
-    y_new = Y + Dydt1 * dt;
+    Dy = dt * Dydt1;
+    GetIntegrable()->StateIncrement(y_new, Y, Dy);  // y_new = Y + Dydt1*dt
     GetIntegrable()->StateSolve(Dydt2, L, y_new, T + dt, dt, true, true);
 
-    Y = Y + (Dydt1 + Dydt2) * (dt / 2.);
+    Dy = Dydt1;
+    Dy += Dydt2;
+    Dy *= (dt / 2.);
+    GetIntegrable()->StateIncrement(y_new, Y, Dy);  // Y = Y + (Dydt1 + Dydt2)*(dt/2)
+    Y = y_new;
     dYdt = Dydt2;
     T += dt;
 
@@ -293,19 +354,26 @@ void ChTimestepperLeapfrog::Advance(const double dt) {
     // setup auxiliary vectors
     L.setZero(mintegrable->GetNconstr());
     Aold.setZero(mintegrable->GetNcoords_v(), GetIntegrable());
+    Xnew.setZero(mintegrable->GetNcoords_x(), mintegrable);
+    Dx.setZero(mintegrable->GetNcoords_v(), GetIntegrable());
 
     mintegrable->StateGather(X, V, T);  // state <- system
     mintegrable->StateGatherAcceleration(Aold);
 
     // advance X (uses last A)
-    X = X + V * dt + Aold * (0.5 * dt * dt);
+    // X = X + V * dt + Aold * (0.5 * dt * dt), using the persistent scratch vectors
+    Dx = dt * V;
+    mintegrable->StateIncrement(Xnew, X, Dx);
+    Dx = (0.5 * dt * dt) * Aold;
+    mintegrable->StateIncrement(X, Xnew, Dx);
 
     // computes new A  (NOTE!!true for imposing a state-> system scatter update,because X changed..)
     mintegrable->StateSolveA(A, L, X, V, T, dt, true, true);  // Dv/dt = f(x,v,T)   Dv = f(x,v,T)*dt
 
     // advance V
 
-    V = V + (Aold + A) * (0.5 * dt);
+    Aold += A;
+    V += (0.5 * dt) * Aold;  // V = V + (Aold + A) * (0.5 * dt)
 
     T += dt;
 
@@ -341,8 +409,10 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     mintegrable->StateGather(X, V, T);  // state <- system
 
     // Extrapolate a prediction as warm start
+    // (use the persistent Dv scratch for all state increments, to avoid per-step heap allocations)
 
-    Xnew = X + V * dt;
+    Dv = dt * V;
+    mintegrable->StateIncrement(Xnew, X, Dv);  // Xnew = X + V * dt
     Vnew = V;  //+ A()*dt;
 
     // use Newton Raphson iteration to solve implicit Euler for v_new
@@ -359,7 +429,9 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
         R.setZero();
         Qc.setZero();
         mintegrable->LoadResidual_F(R, dt);
-        mintegrable->LoadResidual_Mv(R, (V - Vnew), 1.0);
+        Dv = V;
+        Dv -= Vnew;
+        mintegrable->LoadResidual_Mv(R, Dv, 1.0);  // M*(v_old - v_new)
         mintegrable->LoadResidual_CqL(R, L, dt);
         mintegrable->LoadConstraint_C(Qc, 1.0 / dt, Qc_do_clamp, Qc_clamping);
 
@@ -390,11 +462,15 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
 
         Vnew += Dv;
 
-        Xnew = X + Vnew * dt;
+        Dv = dt * Vnew;
+        mintegrable->StateIncrement(Xnew, X, Dv);  // Xnew = X + Vnew * dt
     }
 
+    Dv = Vnew;
+    Dv -= V;
+    Dv *= (1 / dt);
     mintegrable->StateScatterAcceleration(
-        (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+        Dv);  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
     X = Xnew;
     V = Vnew;
@@ -445,6 +521,7 @@ void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
     R.setZero(mintegrable->GetNcoords_v());
     Qc.setZero(mintegrable->GetNconstr());
     L.setZero(mintegrable->GetNconstr());
+    Xnew.setZero(mintegrable->GetNcoords_x(), mintegrable);
 
     mintegrable->StateGather(X, V, T);  // state <- system
 
@@ -481,15 +558,49 @@ void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
 
     L *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
 
+    Vold -= V;
+    Vold *= -(1.0 / dt);  // Vold = (V - Vold) * (1/dt), in place
     mintegrable->StateScatterAcceleration(
-        (V - Vold) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+        Vold);  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+
+    // Embedded error estimate: the velocity update of a trapezoidal (2nd order) candidate built
+    // from the same solve differs from the Euler update by  0.5*dt*(a_new - a_old), with both
+    // acceleration measures already available. The WRMS norm of that difference, weighted by
+    // abstol + reltol*|v|, feeds the PI step-size controller (see UpdateSuggestedStep).
+    double err_norm = 0;
+    if (adaptive_step) {
+        if (Aold.size() == Vold.size()) {
+            double sum = 0;
+            for (int i = 0; i < Vold.size(); i++) {
+                double e = 0.5 * dt * (Vold(i) - Aold(i));
+                double w = adapt_abstol + adapt_reltol * fabs(V(i));
+                sum += (e / w) * (e / w);
+            }
+            err_norm = sqrt(sum / Vold.size());
+        }
+        Aold = Vold;
+    }
 
-    X += V * dt;
+    Vold = dt * V;
+    mintegrable->StateIncrement(Xnew, X, Vold);  // X += V * dt
+    X = Xnew;
 
     T += dt;
 
     mintegrable->StateScatter(X, V, T, true);  // state -> system
     mintegrable->StateScatterReactions(L);     // -> system auxiliary data
+
+    if (adaptive_step) {
+        // Measure the residual constraint violation on the updated state, for the
+        // violation-aware clamping of the controller.
+        double cviol = 0;
+        if (mintegrable->GetNconstr() > 0) {
+            Qc.setZero();
+            mintegrable->LoadConstraint_C(Qc, 1.0, false, 0);
+            cviol = Qc.lpNorm<Eigen::Infinity>();
+        }
+        UpdateSuggestedStep(dt, err_norm, cviol);
+    }
 }
 
 
@@ -518,6 +629,7 @@ void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
     R.setZero(mintegrable->GetNcoords_v());
     Qc.setZero(mintegrable->GetNconstr());
     L.setZero(mintegrable->GetNconstr());
+    Xnew.setZero(mintegrable->GetNcoords_x(), mintegrable);
 
     mintegrable->StateGather(X, V, T);  // state <- system
 
@@ -547,10 +659,14 @@ void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
 
     L *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
 
+    Vold -= V;
+    Vold *= -(1.0 / dt);  // Vold = (V - Vold) * (1/dt), in place
     mintegrable->StateScatterAcceleration(
-        (V - Vold) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+        Vold);  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
-    X += V * dt;
+    Vold = dt * V;
+    mintegrable->StateIncrement(Xnew, X, Vold);  // X += V * dt
+    X = Xnew;
 
     T += dt;
 
@@ -583,7 +699,8 @@ void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
         true                            // force a call to the solver's Setup() function
     );
 
-    X += Vold;  // here we used 'Vold' as 'dpos' to recycle Vold and avoid allocating a new vector dpos
+    mintegrable->StateIncrement(Xnew, X, Vold);  // here we used 'Vold' as 'dpos' to recycle Vold
+    X = Xnew;                                    // X += dpos
 
     mintegrable->StateScatter(X, V, T, true);  // state -> system
 }
@@ -623,7 +740,8 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
 
     // extrapolate a prediction as a warm start
 
-    Xnew = X + V * dt;
+    Dv = dt * V;
+    mintegrable->StateIncrement(Xnew, X, Dv);  // Xnew = X + V * dt
     Vnew = V;  // +A()*dt;
 
     // use Newton Raphson iteration to solve implicit trapezoidal for v_new
@@ -675,11 +793,17 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
 
         Vnew += Dv;
 
-        Xnew = X + ((Vnew + V) * (dt * 0.5));  // Xnew = Xold + h/2(Vnew+Vold)
+        Dv = Vnew;
+        Dv += V;
+        Dv *= (dt * 0.5);
+        mintegrable->StateIncrement(Xnew, X, Dv);  // Xnew = Xold + h/2(Vnew+Vold)
     }
 
+    Dv = Vnew;
+    Dv -= V;
+    Dv *= (1 / dt);
     mintegrable->StateScatterAcceleration(
-        (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+        Dv);  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
     X = Xnew;
     V = Vnew;
@@ -730,13 +854,15 @@ void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
     R.setZero(mintegrable->GetNcoords_v());
     Rold.setZero(mintegrable->GetNcoords_v());
     Qc.setZero(mintegrable->GetNconstr());
+    Dx.setZero(mintegrable->GetNcoords_v(), GetIntegrable());
 
     mintegrable->StateGather(X, V, T);  // state <- system
     // mintegrable->StateGatherReactions(L); // <- system  assume l_old = 0;
 
     // extrapolate a prediction as a warm start
 
-    Xnew = X + V * dt;
+    Dx = dt * V;
+    mintegrable->StateIncrement(Xnew, X, Dx);  // Xnew = X + V * dt
     Vnew = V;
 
     // solve implicit trapezoidal for v_new
@@ -776,7 +902,10 @@ void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
 
     Vnew += Dv;
 
-    Xnew = X + ((Vnew + V) * (dt * 0.5));  // Xnew = Xold + h/2(Vnew+Vold)
+    Dx = Vnew;
+    Dx += V;
+    Dx *= (dt * 0.5);
+    mintegrable->StateIncrement(Xnew, X, Dx);  // Xnew = Xold + h/2(Vnew+Vold)
 
     X = Xnew;
     V = Vnew;
@@ -831,7 +960,8 @@ void ChTimestepperTrapezoidalLinearized2::Advance(const double dt) {
 
     // extrapolate a prediction as a warm start
 
-    Xnew = X + V * dt;
+    Dv = dt * V;
+    mintegrable->StateIncrement(Xnew, X, Dv);  // Xnew = X + V * dt
     Vnew = V;
 
     // use Newton Raphson iteration to solve implicit trapezoidal for v_new
@@ -864,10 +994,17 @@ void ChTimestepperTrapezoidalLinearized2::Advance(const double dt) {
 
     L *= (2.0 / dt);  // Note it is not -(2.0/dt) because we assume StateSolveCorrection already flips sign of Dl
 
-    X += ((Vnew + V) * (dt * 0.5));  // Xnew = Xold + h/2(Vnew+Vold)
+    Dv = Vnew;
+    Dv += V;
+    Dv *= (dt * 0.5);
+    mintegrable->StateIncrement(Xnew, X, Dv);  // Xnew = Xold + h/2(Vnew+Vold)
+    X = Xnew;
 
+    Dv = Vnew;
+    Dv -= V;
+    Dv *= (1 / dt);
     mintegrable->StateScatterAcceleration(
-        (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+        Dv);  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
     V = Vnew;
 
@@ -927,6 +1064,8 @@ void ChTimestepperNewmark::Advance(const double dt) {
     Da.setZero(mintegrable->GetNcoords_a(), GetIntegrable());
     Dl.setZero(mintegrable->GetNconstr());
     Xnew.setZero(mintegrable->GetNcoords_x(), mintegrable);
+    Xtmp.setZero(mintegrable->GetNcoords_x(), mintegrable);
+    Dx.setZero(mintegrable->GetNcoords_v(), GetIntegrable());
     Vnew.setZero(mintegrable->GetNcoords_v(), mintegrable);
     Anew.setZero(mintegrable->GetNcoords_a(), mintegrable);
     R.setZero(mintegrable->GetNcoords_v());
@@ -940,7 +1079,8 @@ void ChTimestepperNewmark::Advance(const double dt) {
     // extrapolate a prediction as a warm start
 
     Vnew = V;
-    Xnew = X + Vnew * dt;
+    Dx = dt * Vnew;
+    mintegrable->StateIncrement(Xnew, X, Dx);  // Xnew = X + Vnew * dt
 
     // use Newton Raphson iteration to solve implicit Newmark for a_new
 
@@ -1000,9 +1140,18 @@ void ChTimestepperNewmark::Advance(const double dt) {
         L += Dl;  // Note it is not -= Dl because we assume StateSolveCorrection flips sign of Dl
         Anew += Da;
 
-        Xnew = X + V * dt + A * (dt * dt * (0.5 - beta)) + Anew * (dt * dt * beta);
-
-        Vnew = V + A * (dt * (1.0 - gamma)) + Anew * (dt * gamma);
+        // Xnew = X + V*dt + A*(dt^2*(0.5 - beta)) + Anew*(dt^2*beta), as a sequence of state
+        // increments through the persistent scratch vectors (no per-step heap allocations)
+        Dx = dt * V;
+        mintegrable->StateIncrement(Xnew, X, Dx);
+        Dx = (dt * dt * (0.5 - beta)) * A;
+        mintegrable->StateIncrement(Xtmp, Xnew, Dx);
+        Dx = (dt * dt * beta) * Anew;
+        mintegrable->StateIncrement(Xnew, Xtmp, Dx);
+
+        Vnew = V;
+        Vnew += (dt * (1.0 - gamma)) * A;
+        Vnew += (dt * gamma) * Anew;  // Vnew = V + A*(dt*(1-gamma)) + Anew*(dt*gamma)
     }
 
     X = Xnew;
@@ -49,7 +49,23 @@ class ChApi ChTimestepper {
 
     /// Constructor
     ChTimestepper(ChIntegrable* intgr = nullptr)
-        : integrable(intgr), T(0), verbose(false), Qc_do_clamp(false), Qc_clamping(0) {}
+        : integrable(intgr),
+          T(0),
+          verbose(false),
+          Qc_do_clamp(false),
+          Qc_clamping(0),
+          adaptive_step(false),
+          adapt_reltol(1e-3),
+          adapt_abstol(1e-5),
+          adapt_gain_I(0.35),
+          adapt_gain_P(0.2),
+          adapt_safety(0.9),
+          adapt_dt_min(1e-7),
+          adapt_dt_max(1e-2),
+          adapt_cviol_limit(1e-4),
+          err_estimate(0),
+          err_prev(0),
+          dt_suggested(0) {}
 
     /// Destructor
     virtual ~ChTimestepper() {}
@@ -86,6 +102,52 @@ class ChApi ChTimestepper {
     /// Turn on/off clamping on the Qcterm.
     void SetQcClamping(double cl) { Qc_clamping = cl; }
 
+    /// Enable/disable the adaptive step-size recommendation (default: false).
+    /// When enabled, and if supported by the concrete stepper (currently
+    /// ChTimestepperEulerImplicitLinearized), each Advance() updates an embedded local error
+    /// estimate and a PI-controlled suggestion for the next step size, to be retrieved with
+    /// GetSuggestedStep(). The controller only recommends: the caller remains in charge of the
+    /// step size actually passed to the next Advance().
+    void SetAdaptiveStep(bool val) { adaptive_step = val; }
+
+    /// Return whether the adaptive step-size recommendation is enabled.
+    bool GetAdaptiveStep() const { return adaptive_step; }
+
+    /// Set the step-size bounds for the adaptive controller (default: 1e-7 and 1e-2).
+    void SetStepBounds(double dt_min, double dt_max) {
+        adapt_dt_min = dt_min;
+        adapt_dt_max = dt_max;
+    }
+
+    /// Set the relative and absolute tolerances on the embedded local error estimate
+    /// (default: 1e-3 and 1e-5). The error is measured as a WRMS norm over the velocity states,
+    /// with per-component weights  abstol + reltol*|v|;  a norm of 1 means the step error sits
+    /// exactly at the tolerance.
+    void SetAdaptiveTolerances(double rel_tol, double abs_tol) {
+        adapt_reltol = rel_tol;
+        adapt_abstol = abs_tol;
+    }
+
+    /// Set the integral and proportional gains of the PI step-size controller
+    /// (default: 0.35 and 0.2, suited to a first-order embedded estimate).
+    void SetPIGains(double gain_I, double gain_P) {
+        adapt_gain_I = gain_I;
+        adapt_gain_P = gain_P;
+    }
+
+    /// Set the constraint-violation limit of the adaptive controller (default: 1e-4).
+    /// While the max constraint violation after a step exceeds this limit, the controller never
+    /// grows the step, and shrinks it when the violation is an order of magnitude above the limit,
+    /// regardless of the error estimate.
+    void SetConstraintViolationLimit(double limit) { adapt_cviol_limit = limit; }
+
+    /// Get the step size suggested by the adaptive controller after the last Advance().
+    /// Meaningful only when adaptive stepping is enabled and supported by the concrete stepper.
+    double GetSuggestedStep() const { return dt_suggested; }
+
+    /// Get the embedded local error estimate of the last Advance() (WRMS norm, 1 = at tolerance).
+    double GetEstimatedError() const { return err_estimate; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive);
 
@@ -93,6 +155,11 @@ class ChApi ChTimestepper {
     virtual void ArchiveIn(ChArchiveIn& archive);
 
   protected:
+    /// Feed the PI step-size controller with the embedded error estimate of the step just taken.
+    /// Called by concrete steppers which support adaptive stepping, at the end of Advance();
+    /// updates the error bookkeeping and the suggested size for the next step.
+    void UpdateSuggestedStep(double dt, double err_norm, double constr_violation);
+
     ChIntegrable* integrable;
     double T;
 
@@ -102,6 +169,19 @@ class ChApi ChTimestepper {
 
     bool Qc_do_clamp;
     double Qc_clamping;
+
+    bool adaptive_step;        ///< adaptive step-size recommendation enabled?
+    double adapt_reltol;       ///< relative tolerance on the embedded error estimate
+    double adapt_abstol;       ///< absolute tolerance on the embedded error estimate
+    double adapt_gain_I;       ///< integral gain of the PI step-size controller
+    double adapt_gain_P;       ///< proportional gain of the PI step-size controller
+    double adapt_safety;       ///< safety factor on the PI controller output
+    double adapt_dt_min;       ///< lower bound on the suggested step size
+    double adapt_dt_max;       ///< upper bound on the suggested step size
+    double adapt_cviol_limit;  ///< constraint violation above which step growth is clamped
+    double err_estimate;       ///< embedded error estimate of the last step
+    double err_prev;           ///< embedded error estimate of the step before
+    double dt_suggested;       ///< suggested size for the next step
 };
 
 /// Base class for 1st order timesteppers, that is a time integrator for a ChIntegrable.
@@ -254,6 +334,10 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
 /// Euler explicit timestepper.
 /// This performs the typical  y_new = y+ dy/dt * dt integration with Euler formula.
 class ChApi ChTimestepperEulerExpl : public ChTimestepperIorder {
+  protected:
+    ChState Ynew;
+    ChStateDelta Dy;
+
   public:
     /// Constructors (default empty)
     ChTimestepperEulerExpl(ChIntegrable* intgr = nullptr) : ChTimestepperIorder(intgr) {}
@@ -272,6 +356,7 @@ class ChApi ChTimestepperEulerExpl : public ChTimestepperIorder {
 class ChApi ChTimestepperEulerExplIIorder : public ChTimestepperIIorder {
   protected:
     ChStateDelta Dv;
+    ChState Xnew;
 
   public:
     /// Constructors (default empty)
@@ -290,6 +375,10 @@ class ChApi ChTimestepperEulerExplIIorder : public ChTimestepperIIorder {
 ///    x_new = x + v_new * dt
 /// integration with Euler semi-implicit formula.
 class ChApi ChTimestepperEulerSemiImplicit : public ChTimestepperIIorder {
+  protected:
+    ChState Xnew;
+    ChStateDelta Dx;
+
   public:
     /// Constructors (default empty)
     ChTimestepperEulerSemiImplicit(ChIntegrableIIorder* intgr = nullptr) : ChTimestepperIIorder(intgr) {}
@@ -307,6 +396,7 @@ class ChApi ChTimestepperRungeKuttaExpl : public ChTimestepperIorder {
     ChStateDelta Dydt2;
     ChStateDelta Dydt3;
     ChStateDelta Dydt4;
+    ChStateDelta Dy;
 
   public:
     /// Constructors (default empty)
@@ -325,6 +415,7 @@ class ChApi ChTimestepperHeun : public ChTimestepperIorder {
     ChState y_new;
     ChStateDelta Dydt1;
     ChStateDelta Dydt2;
+    ChStateDelta Dy;
 
   public:
     /// Constructors (default empty)
@@ -344,6 +435,8 @@ class ChApi ChTimestepperHeun : public ChTimestepperIorder {
 class ChApi ChTimestepperLeapfrog : public ChTimestepperIIorder {
   protected:
     ChStateDelta Aold;
+    ChState Xnew;
+    ChStateDelta Dx;
 
   public:
     /// Constructors (default empty)
@@ -392,6 +485,8 @@ class ChApi ChTimestepperEulerImplicit : public ChTimestepperIIorder, public ChI
 class ChApi ChTimestepperEulerImplicitLinearized : public ChTimestepperIIorder, public ChImplicitTimestepper {
   protected:
     ChStateDelta Vold;
+    ChStateDelta Aold;  ///< acceleration measure of the previous step, for the embedded error estimate
+    ChState Xnew;
     ChVectorDynamic<> Dl;
     ChVectorDynamic<> R;
     ChVectorDynamic<> Qc;
@@ -417,6 +512,7 @@ class ChApi ChTimestepperEulerImplicitLinearized : public ChTimestepperIIorder,
 class ChApi ChTimestepperEulerImplicitProjected : public ChTimestepperIIorder, public ChImplicitTimestepper {
   protected:
     ChStateDelta Vold;
+    ChState Xnew;
     ChVectorDynamic<> Dl;
     ChVectorDynamic<> R;
     ChVectorDynamic<> Qc;
@@ -470,6 +566,7 @@ class ChApi ChTimestepperTrapezoidal : public ChTimestepperIIorder, public ChImp
 class ChApi ChTimestepperTrapezoidalLinearized : public ChTimestepperIIorder, public ChImplicitIterativeTimestepper {
   protected:
     ChStateDelta Dv;
+    ChStateDelta Dx;
     ChVectorDynamic<> Dl;
     ChState Xnew;
     ChStateDelta Vnew;
@@ -530,6 +627,8 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     ChStateDelta Da;
     ChVectorDynamic<> Dl;
     ChState Xnew;
+    ChState Xtmp;
+    ChStateDelta Dx;
     ChStateDelta Vnew;
     ChStateDelta Anew;
     ChVectorDynamic<> R;
@@ -36,7 +36,16 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* intgr)
       h_min(1e-10),
       h(1e6),
       num_successful_steps(0),
-      modified_Newton(true) {
+      modified_Newton(true),
+      jacobian_reuse(false),
+      jacobian_max_age(10),
+      contraction_threshold(0.5),
+      jacobian_change_tol(0),
+      jacobian_valid(false),
+      jacobian_age(0),
+      h_jacobian(0),
+      num_jacobian_reuses(0),
+      num_jacobian_refreshes(0) {
     SetAlpha(-0.2);  // default: some dissipation
 }
 
@@ -109,8 +118,25 @@ void ChTimestepperHHT::Advance(const double dt) {
     //   - on a stepsize decrease
     //   - if the Newton iteration does not converge with an out-of-date matrix
     // Otherwise, the matrix is updated at each iteration.
+    // If cross-step Jacobian reuse is enabled, the matrix from a previous step is kept even at the beginning of
+    // a step, provided the stepsize is unchanged and the matrix has not exceeded its maximum age; convergence
+    // degradation during the Newton iteration triggers a refresh (see below).
     matrix_is_current = false;
     call_setup = true;
+    if (jacobian_reuse && modified_Newton && jacobian_valid && jacobian_age < jacobian_max_age) {
+        if (h == h_jacobian) {
+            call_setup = false;
+        } else if (jacobian_change_tol > 0 && X_jacobian.size() == X.size() && V_jacobian.size() == V.size()) {
+            // Estimate the relative change of the Newton matrix since it was last evaluated, combining the relative
+            // stepsize change (the matrix entries scale with h and h^2) with the relative change of the state at
+            // which the K and R blocks were assembled. Skip the refactorization if the estimate is below tolerance.
+            double change = std::abs(h - h_jacobian) / h_jacobian;
+            change += (X - X_jacobian).norm() / (1 + X_jacobian.norm());
+            change += (V - V_jacobian).norm() / (1 + V_jacobian.norm());
+            if (change <= jacobian_change_tol)
+                call_setup = false;
+        }
+    }
 
     // Loop until reaching final time
     while (true) {
@@ -119,6 +145,8 @@ void ChTimestepperHHT::Advance(const double dt) {
 
         // Newton-Raphson for state at T+h
         bool converged = false;
+        bool used_stale_jacobian = !call_setup;
+        double Da_nrm_prev = -1;
         int it;
 
         for (it = 0; it < maxiters; it++) {
@@ -133,11 +161,31 @@ void ChTimestepperHHT::Advance(const double dt) {
             numsolves++;
             if (call_setup) {
                 numsetups++;
+                jacobian_valid = true;
+                jacobian_age = 0;
+                h_jacobian = h;
+                if (jacobian_change_tol > 0) {
+                    X_jacobian = Xnew;
+                    V_jacobian = Vnew;
+                }
             }
 
             // If using modified Newton, do not call Setup again
             call_setup = !modified_Newton;
 
+            // If reusing an out-of-date matrix, monitor the contraction of the Newton iteration and schedule a
+            // matrix refresh for the next iteration if it degrades past the threshold.
+            if (jacobian_reuse && !matrix_is_current) {
+                double Da_nrm = Da.wrmsNorm(ewtS);
+                if (Da_nrm_prev >= 0 && Da_nrm > contraction_threshold * Da_nrm_prev) {
+                    call_setup = true;
+                    num_jacobian_refreshes++;
+                    if (verbose)
+                        GetLog() << " HHT refresh Newton matrix (contraction " << Da_nrm / Da_nrm_prev << ").\n";
+                }
+                Da_nrm_prev = Da_nrm;
+            }
+
             // A flag to indicate the trend of convergence
             if ((Rold.norm() < R.norm()) && (R.norm() > threshold_R)) {
                 convergence_trend_flag = false; // very dangerous, seems to diverge
@@ -172,6 +220,12 @@ void ChTimestepperHHT::Advance(const double dt) {
                 GetLog() << "  T = " << T + h << "  h = " << h << "\n";
             }
 
+            // Update cross-step Jacobian reuse bookkeeping
+            if (jacobian_reuse && !matrix_is_current) {
+                jacobian_age++;
+                num_jacobian_reuses += used_stale_jacobian ? 1 : 0;
+            }
+
             // Advance time (clamp to tfinal if close enough)
             T += h;
             if (std::abs(T - tfinal) < std::min(h_min, 1e-6)) {
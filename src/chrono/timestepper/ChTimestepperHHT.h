@@ -65,6 +65,18 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     bool matrix_is_current;  ///< is the Newton matrix up-to-date?
     bool call_setup;         ///< should the solver's Setup function be called?
 
+    bool jacobian_reuse;             ///< keep the factored Newton matrix across time steps?
+    int jacobian_max_age;            ///< maximum number of steps over which the Newton matrix may be reused
+    double contraction_threshold;    ///< NR contraction factor above which a matrix refresh is triggered
+    double jacobian_change_tol;      ///< estimated matrix change below which a refactorization is skipped (0: off)
+    bool jacobian_valid;             ///< does a factorization from a previous step exist?
+    int jacobian_age;                ///< number of completed steps since the Newton matrix was last evaluated
+    double h_jacobian;               ///< stepsize at which the Newton matrix was last evaluated
+    ChVectorDynamic<> X_jacobian;    ///< positions at which the Newton matrix was last evaluated
+    ChVectorDynamic<> V_jacobian;    ///< velocities at which the Newton matrix was last evaluated
+    int num_jacobian_reuses;         ///< cumulative number of steps completed with a reused Newton matrix
+    int num_jacobian_refreshes;      ///< cumulative number of refreshes triggered by convergence degradation
+
     ChVectorDynamic<> ewtS;  ///< vector of error weights (states)
     ChVectorDynamic<> ewtL;  ///< vector of error weights (Lagrange multipliers)
 
@@ -121,6 +133,40 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// Modified Newton iteration is enabled by default.
     void SetModifiedNewton(bool val) { modified_Newton = val; }
 
+    /// Enable/disable reuse of the factored Newton matrix across time steps (default: false).
+    /// If enabled (and modified Newton is in effect), the Newton matrix evaluated in one step is kept for
+    /// subsequent steps, as long as the stepsize is unchanged, the matrix age does not exceed the limit set with
+    /// SetJacobianMaxAge, and the Newton iteration keeps contracting; a refresh is triggered as soon as the ratio
+    /// of successive update norms degrades past the threshold set with SetJacobianContractionThreshold.
+    /// Savings show up directly in the GetNumSetupCalls counter.
+    void SetJacobianReuse(bool val) { jacobian_reuse = val; }
+
+    /// Set the maximum number of time steps over which the Newton matrix may be reused (default: 10).
+    /// Only used when Jacobian reuse is enabled; see SetJacobianReuse.
+    void SetJacobianMaxAge(int age) { jacobian_max_age = age; }
+
+    /// Set the tolerance on the estimated Newton matrix change below which a refactorization is skipped
+    /// (default: 0, disabled).
+    /// The HHT Newton matrix depends on the stepsize and on the state at which the K and R blocks were evaluated.
+    /// With a positive tolerance (and Jacobian reuse enabled), an existing factorization is reused even after a
+    /// stepsize change, as long as a cheap estimate of the relative matrix change - combining the relative stepsize
+    /// change with the relative change of positions and velocities since the matrix was last evaluated - stays below
+    /// the tolerance. The matrix age limit and the contraction monitor remain in effect, so a reused factorization
+    /// that hampers convergence still triggers a refresh. A value in the range [0.01, 0.1] is typically appropriate.
+    void SetJacobianChangeTolerance(double tol) { jacobian_change_tol = tol; }
+
+    /// Set the contraction factor threshold used to monitor convergence degradation (default: 0.5).
+    /// At each Newton iteration performed with an out-of-date matrix, the ratio of the current to the previous
+    /// update norm is compared against this threshold; if exceeded, the matrix is re-evaluated at the next
+    /// iteration. Only used when Jacobian reuse is enabled; see SetJacobianReuse.
+    void SetJacobianContractionThreshold(double val) { contraction_threshold = val; }
+
+    /// Return the cumulative number of steps completed with a Newton matrix reused from an earlier step.
+    int GetNumJacobianReuses() const { return num_jacobian_reuses; }
+
+    /// Return the cumulative number of matrix refreshes triggered by convergence degradation.
+    int GetNumJacobianRefreshes() const { return num_jacobian_refreshes; }
+
     /// Perform an integration timestep.
     virtual void Advance(const double dt  ///< timestep to advance
                          ) override;
@@ -20,6 +20,19 @@
 #ifndef CH_BENCHMARK_H
 #define CH_BENCHMARK_H
 
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
 #include "chrono_thirdparty/googlebenchmark/include/benchmark/benchmark.h"
 #include "chrono/physics/ChSystem.h"
 
@@ -99,6 +112,106 @@ inline void ChBenchmarkTest::ResetTimers() {
 
 // =============================================================================
 
+/// Global counters for heap allocations performed through the replaceable global operator new.
+/// The counters are updated only if CH_BENCHMARK_TRACK_ALLOCATIONS is defined in exactly one
+/// translation unit of the benchmark executable before including this header (which then also
+/// provides the replacement operator new/delete); otherwise they simply stay at zero.
+inline std::atomic<uint64_t>& ChBenchmarkAllocCount() {
+    static std::atomic<uint64_t> count(0);
+    return count;
+}
+inline std::atomic<uint64_t>& ChBenchmarkAllocBytes() {
+    static std::atomic<uint64_t> bytes(0);
+    return bytes;
+}
+
+/// Sampler for hardware performance counters (instruction count and last-level cache misses).
+/// Implemented on top of the Linux perf_event interface; on other platforms, or if opening the
+/// counters fails (e.g., perf_event_paranoid restrictions in containers), the sampler is simply
+/// inactive and no hardware counters are reported.
+class ChPerfCounterSampler {
+  public:
+    ChPerfCounterSampler() : instructions(0), cache_misses(0), m_samples(0), m_fd_instr(-1), m_fd_llc(-1) {
+#if defined(__linux__)
+        m_fd_instr = OpenCounter(PERF_COUNT_HW_INSTRUCTIONS);
+        m_fd_llc = OpenCounter(PERF_COUNT_HW_CACHE_MISSES);
+#endif
+    }
+
+    ~ChPerfCounterSampler() {
+#if defined(__linux__)
+        if (m_fd_instr >= 0)
+            close(m_fd_instr);
+        if (m_fd_llc >= 0)
+            close(m_fd_llc);
+#endif
+    }
+
+    /// Return true if the hardware counters could be opened.
+    bool Active() const { return m_fd_instr >= 0 || m_fd_llc >= 0; }
+
+    /// Return the number of completed Start/Stop sampling intervals.
+    int GetNumSamples() const { return m_samples; }
+
+    /// Reset and enable the counters.
+    void Start() {
+#if defined(__linux__)
+        if (m_fd_instr >= 0) {
+            ioctl(m_fd_instr, PERF_EVENT_IOC_RESET, 0);
+            ioctl(m_fd_instr, PERF_EVENT_IOC_ENABLE, 0);
+        }
+        if (m_fd_llc >= 0) {
+            ioctl(m_fd_llc, PERF_EVENT_IOC_RESET, 0);
+            ioctl(m_fd_llc, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    /// Disable the counters and accumulate their readings.
+    void Stop() {
+#if defined(__linux__)
+        uint64_t val;
+        if (m_fd_instr >= 0) {
+            ioctl(m_fd_instr, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(m_fd_instr, &val, sizeof(val)) == (ssize_t)sizeof(val))
+                instructions += val;
+        }
+        if (m_fd_llc >= 0) {
+            ioctl(m_fd_llc, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(m_fd_llc, &val, sizeof(val)) == (ssize_t)sizeof(val))
+                cache_misses += val;
+        }
+        if (Active())
+            m_samples++;
+#endif
+    }
+
+    uint64_t instructions;   ///< accumulated retired instructions
+    uint64_t cache_misses;   ///< accumulated last-level cache misses
+
+  private:
+#if defined(__linux__)
+    static int OpenCounter(uint64_t config) {
+        struct perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.inherit = 1;  // include worker threads (e.g., OpenMP) spawned by this process
+        return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+#endif
+
+    int m_samples;
+    int m_fd_instr;
+    int m_fd_llc;
+};
+
+// =============================================================================
+
 /// Define and register a test named TEST_NAME using the specified ChBenchmark TEST.
 /// This method benchmarks consecutive (in time) simulation batches and is therefore
 /// appropriate for cases where the cost per step is expected to be relatively uniform.
@@ -111,7 +224,9 @@ inline void ChBenchmarkTest::ResetTimers() {
     using TEST_NAME = chrono::utils::ChBenchmarkFixture<TEST, SKIP_STEPS>;         \
     BENCHMARK_DEFINE_F(TEST_NAME, SimulateLoop)(benchmark::State & st) {           \
         while (st.KeepRunning()) {                                                 \
+            StartCounters();                                                       \
             m_test->Simulate(SIM_STEPS);                                           \
+            StopCounters();                                                        \
         }                                                                          \
         Report(st);                                                                \
     }                                                                              \
@@ -130,7 +245,9 @@ inline void ChBenchmarkTest::ResetTimers() {
     BENCHMARK_DEFINE_F(TEST_NAME, SimulateOnce)(benchmark::State & st) {           \
         Reset(SKIP_STEPS);                                                         \
         while (st.KeepRunning()) {                                                 \
+            StartCounters();                                                       \
             m_test->Simulate(SIM_STEPS);                                           \
+            StopCounters();                                                        \
         }                                                                          \
         Report(st);                                                                \
     }                                                                              \
@@ -147,7 +264,7 @@ inline void ChBenchmarkTest::ResetTimers() {
 template <typename TEST, int SKIP>
 class ChBenchmarkFixture : public ::benchmark::Fixture {
   public:
-    ChBenchmarkFixture() : m_test(nullptr) {
+    ChBenchmarkFixture() : m_test(nullptr), m_alloc_count(0), m_alloc_bytes(0), m_alloc_count_mark(0), m_alloc_bytes_mark(0) {
         ////std::cout << "CREATE TEST" << std::endl;
         if (SKIP != 0) {
             m_test = new TEST();
@@ -157,6 +274,23 @@ class ChBenchmarkFixture : public ::benchmark::Fixture {
 
     ~ChBenchmarkFixture() { delete m_test; }
 
+    /// Start sampling hardware counters and heap allocations for a measured batch.
+    void StartCounters() {
+        m_alloc_count_mark = ChBenchmarkAllocCount().load();
+        m_alloc_bytes_mark = ChBenchmarkAllocBytes().load();
+        m_perf.Start();
+    }
+
+    /// Stop sampling and accumulate the counts of the measured batch.
+    void StopCounters() {
+        m_perf.Stop();
+        m_alloc_count += ChBenchmarkAllocCount().load() - m_alloc_count_mark;
+        m_alloc_bytes += ChBenchmarkAllocBytes().load() - m_alloc_bytes_mark;
+    }
+
+    /// Attach all collected metrics to the benchmark state as user counters, so that they appear
+    /// in the console report and in the JSON/CSV output produced with the standard benchmark
+    /// command line options (e.g. --benchmark_out=res.json --benchmark_out_format=json).
     void Report(benchmark::State& st) {
         st.counters["Step_Total"] = m_test->m_timer_step * 1e3;
         st.counters["Step_Advance"] = m_test->m_timer_advance * 1e3;
@@ -168,6 +302,15 @@ class ChBenchmarkFixture : public ::benchmark::Fixture {
         st.counters["CD_Total"] = m_test->m_timer_collision * 1e3;
         st.counters["CD_Broad"] = m_test->m_timer_collision_broad * 1e3;
         st.counters["CD_Narrow"] = m_test->m_timer_collision_narrow * 1e3;
+
+        if (m_perf.GetNumSamples() > 0) {
+            st.counters["HW_Instructions"] = (double)m_perf.instructions;
+            st.counters["HW_LLC_Misses"] = (double)m_perf.cache_misses;
+        }
+#ifdef CH_BENCHMARK_TRACK_ALLOCATIONS
+        st.counters["Heap_Allocations"] = (double)m_alloc_count;
+        st.counters["Heap_Bytes"] = (double)m_alloc_bytes;
+#endif
     }
 
     void Reset(int num_init_steps) {
@@ -178,9 +321,54 @@ class ChBenchmarkFixture : public ::benchmark::Fixture {
     }
 
     TEST* m_test;
+
+  private:
+    ChPerfCounterSampler m_perf;   ///< hardware counter sampler (inactive if counters unavailable)
+    uint64_t m_alloc_count;        ///< heap allocations performed during the measured batches
+    uint64_t m_alloc_bytes;        ///< heap bytes requested during the measured batches
+    uint64_t m_alloc_count_mark;   ///< allocation count at the start of the current batch
+    uint64_t m_alloc_bytes_mark;   ///< allocation bytes at the start of the current batch
 };
 
 }  // end namespace utils
 }  // end namespace chrono
 
+// -----------------------------------------------------------------------------
+// Replacement global allocation functions feeding the benchmark allocation counters.
+// Provided only if CH_BENCHMARK_TRACK_ALLOCATIONS is defined before including this header;
+// since these replace the global operator new/delete, the macro must be defined in exactly
+// one translation unit of the benchmark executable.
+// -----------------------------------------------------------------------------
+#ifdef CH_BENCHMARK_TRACK_ALLOCATIONS
+
+void* operator new(std::size_t size) {
+    chrono::utils::ChBenchmarkAllocCount().fetch_add(1, std::memory_order_relaxed);
+    chrono::utils::ChBenchmarkAllocBytes().fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+#endif
+
 #endif
@@ -69,5 +69,81 @@ void CompositeInertia::AddComponent(
         m_inertia += increment;
 }
 
+// Include the inertia properties of another composite body.
+void CompositeInertia::AddComposite(const ChFrame<>& frame, const CompositeInertia& composite, bool is_void) {
+    // The sub-composite acts as a single component with its mass lumped at its COM and its centroidal
+    // inertia tensor aligned with the axes of its reference frame
+    ChFrame<> centroidal(frame.TransformLocalToParent(composite.GetCOM()), frame.GetRot());
+    AddComponent(centroidal, composite.GetMass(), composite.GetInertia(), is_void);
+}
+
+// -----------------------------------------------------------------------------
+
+CompositeInertiaAssembly::CompositeInertiaAssembly() : m_mass(0) {
+    m_inertia.setZero();
+}
+
+int CompositeInertiaAssembly::AddSubtree(const ChFrame<>& frame) {
+    Subtree s;
+    s.frame = frame;
+    s.mass = 0;
+    s.inertia.setZero();
+    m_subtrees.push_back(s);
+
+    return (int)m_subtrees.size() - 1;
+}
+
+void CompositeInertiaAssembly::AddComponent(int subtree,
+                                            const ChFrame<>& frame,
+                                            double mass,
+                                            const ChMatrix33<>& inertia,
+                                            bool is_void) {
+    Subtree& s = m_subtrees[subtree];
+
+    SubtractContribution(s);
+    s.composite.AddComponent(frame, mass, inertia, is_void);
+    AddContribution(s);
+}
+
+void CompositeInertiaAssembly::SetSubtreeFrame(int subtree, const ChFrame<>& frame) {
+    Subtree& s = m_subtrees[subtree];
+
+    // Leave the cached contribution in place if the subtree did not move
+    if (frame == s.frame)
+        return;
+
+    SubtractContribution(s);
+    s.frame = frame;
+    AddContribution(s);
+}
+
+ChVector<> CompositeInertiaAssembly::GetCOM() const {
+    return (m_mass != 0) ? m_com_moment / m_mass : ChVector<>(0);
+}
+
+ChMatrix33<> CompositeInertiaAssembly::GetInertia() const {
+    return m_inertia - CompositeInertia::InertiaShiftMatrix(GetCOM()) * m_mass;
+}
+
+void CompositeInertiaAssembly::AddContribution(Subtree& s) {
+    double mass = s.composite.GetMass();
+    ChVector<> com = s.frame.TransformLocalToParent(s.composite.GetCOM());
+    const ChMatrix33<>& A = s.frame.GetA();
+
+    s.mass = mass;
+    s.com_moment = mass * com;
+    s.inertia = A * s.composite.GetInertia() * A.transpose() + CompositeInertia::InertiaShiftMatrix(com) * mass;
+
+    m_mass += s.mass;
+    m_com_moment += s.com_moment;
+    m_inertia += s.inertia;
+}
+
+void CompositeInertiaAssembly::SubtractContribution(const Subtree& s) {
+    m_mass -= s.mass;
+    m_com_moment -= s.com_moment;
+    m_inertia -= s.inertia;
+}
+
 }  // end namespace utils
 }  // end namespace chrono
@@ -15,6 +15,8 @@
 #ifndef CH_COMPOSITE_INERTIA_H
 #define CH_COMPOSITE_INERTIA_H
 
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChVector.h"
 #include "chrono/core/ChMatrix33.h"
@@ -60,6 +62,14 @@ class ChApi CompositeInertia {
                       bool is_void = false          ///< indicate if sub-component represents a material void
                       );
 
+    /// Include the inertia properties of another composite body.
+    /// The given frame is the placement of the sub-composite reference frame relative to this
+    /// composite's reference frame.
+    void AddComposite(const ChFrame<>& frame,             ///< placement of the sub-composite reference frame
+                      const CompositeInertia& composite,  ///< sub-composite inertia properties
+                      bool is_void = false                ///< indicate if sub-composite represents a material void
+                      );
+
     /// Utility function for calculating an inertia shift matrix from a given vector.
     /// This matrix is used when applying the parallel axis theorem.
     static ChMatrix33<> InertiaShiftMatrix(const ChVector<>& v);
@@ -70,6 +80,67 @@ class ChApi CompositeInertia {
     double m_mass;           ///< mass of composite body
 };
 
+/// Utility class for maintaining the inertia properties of an articulated assembly.
+/// Sub-components are grouped into subtrees (e.g., the links between two joints of a crane), each with its own
+/// reference frame in which its composite inertia is accumulated once. As the assembly articulates, only the
+/// placement of the subtree frames changes; SetSubtreeFrame subtracts the cached contribution of a moved subtree
+/// from the aggregate and adds it back at the new placement, so an update costs O(number of moved subtrees) and
+/// the inertia queries are O(1), independent of the total number of sub-components.
+class ChApi CompositeInertiaAssembly {
+  public:
+    CompositeInertiaAssembly();
+
+    /// Add a new (empty) subtree with the specified placement relative to the assembly reference frame.
+    /// Return the subtree index, to be used with AddComponent and SetSubtreeFrame.
+    int AddSubtree(const ChFrame<>& frame = ChFrame<>());
+
+    /// Include sub-component inertia properties in the specified subtree.
+    /// The centroidal frame of the sub-component is specified relative to the subtree reference frame.
+    void AddComponent(int subtree,                  ///< subtree index (as returned by AddSubtree)
+                      const ChFrame<>& frame,       ///< centroidal frame of sub-component (relative to subtree frame)
+                      double mass,                  ///< mass of sub-component
+                      const ChMatrix33<>& inertia,  ///< sub-component inertia tensor w.r.t. its centroidal frame
+                      bool is_void = false          ///< indicate if sub-component represents a material void
+                      );
+
+    /// Set the placement of the specified subtree relative to the assembly reference frame.
+    /// A no-op if the placement is unchanged; otherwise only this subtree's contribution is recomputed.
+    void SetSubtreeFrame(int subtree, const ChFrame<>& frame);
+
+    /// Get the assembly mass.
+    double GetMass() const { return m_mass; }
+
+    /// Get the location of the assembly COM (relative to the assembly reference frame).
+    ChVector<> GetCOM() const;
+
+    /// Get the assembly inertia tensor w.r.t. a centroidal frame aligned with the assembly reference frame.
+    ChMatrix33<> GetInertia() const;
+
+    /// Get the assembly inertia tensor w.r.t. the assembly reference frame.
+    const ChMatrix33<>& GetInertiaReference() const { return m_inertia; }
+
+  private:
+    /// Inertia properties of one subtree, together with its cached contribution to the aggregate.
+    struct Subtree {
+        CompositeInertia composite;  ///< composite inertia w.r.t. the subtree reference frame
+        ChFrame<> frame;             ///< subtree frame placement (relative to assembly reference frame)
+        double mass;                 ///< cached mass contribution
+        ChVector<> com_moment;       ///< cached first moment of mass (w.r.t. assembly reference frame)
+        ChMatrix33<> inertia;        ///< cached inertia contribution (w.r.t. assembly reference frame)
+    };
+
+    /// Recompute the cached contribution of the given subtree at its current placement and add it to the aggregate.
+    void AddContribution(Subtree& s);
+
+    /// Subtract the cached contribution of the given subtree from the aggregate.
+    void SubtractContribution(const Subtree& s);
+
+    std::vector<Subtree> m_subtrees;  ///< assembly subtrees
+    ChMatrix33<> m_inertia;           ///< aggregate inertia tensor w.r.t. assembly reference frame
+    ChVector<> m_com_moment;          ///< aggregate first moment of mass
+    double m_mass;                    ///< aggregate mass
+};
+
 }  // end namespace utils
 }  // end namespace chrono
 
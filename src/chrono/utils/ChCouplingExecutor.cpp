@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Coupling executor for co-scheduled stepping of heterogeneous systems.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/utils/ChCouplingExecutor.h"
+
+namespace chrono {
+namespace utils {
+
+ChCouplingExecutor::ChCouplingExecutor(double step_size) : m_step_size(step_size), m_time(0) {
+    assert(step_size > 0);
+}
+
+void ChCouplingExecutor::AddSystem(ChSystem* system, double step_size) {
+    assert(system);
+    assert(step_size > 0);
+
+    Participant p;
+    p.step_fun = [system](double time, double h) { system->DoStepDynamics(h); };
+    p.step_size = step_size;
+    p.substeps = (int)std::round(m_step_size / step_size);
+    if (p.substeps < 1)
+        p.substeps = 1;
+    // Distribute rounding over the substeps so the participant lands exactly on the coupling boundary
+    p.step_size = m_step_size / p.substeps;
+    m_systems.push_back(p);
+}
+
+void ChCouplingExecutor::AddSystem(std::function<void(double time, double step_size)> step_fun) {
+    Participant p;
+    p.step_fun = step_fun;
+    p.step_size = m_step_size;
+    p.substeps = 1;
+    m_systems.push_back(p);
+}
+
+void ChCouplingExecutor::AddExchange(std::function<void(double time)> exchange_fun, ExchangePoint point) {
+    Exchange e;
+    e.fun = exchange_fun;
+    e.point = point;
+    m_exchanges.push_back(e);
+}
+
+void ChCouplingExecutor::AddForceExchange(std::shared_ptr<ChBody> body,
+                                          std::function<ChVector<>(double time)> force_fun,
+                                          std::function<ChVector<>(double time)> torque_fun) {
+    AddExchange(
+        [body, force_fun, torque_fun](double time) {
+            body->Empty_forces_accumulators();
+            if (force_fun)
+                body->Accumulate_force(force_fun(time), body->GetPos(), false);
+            if (torque_fun)
+                body->Accumulate_torque(torque_fun(time), false);
+        },
+        ExchangePoint::PRE_STEP);
+}
+
+void ChCouplingExecutor::AddBodySetExchange(
+    std::vector<std::shared_ptr<ChBody>> bodies,
+    std::function<void(double time, const std::vector<std::shared_ptr<ChBody>>& bodies)> fun,
+    ExchangePoint point) {
+    AddExchange([bodies, fun](double time) { fun(time, bodies); }, point);
+}
+
+void ChCouplingExecutor::RunExchanges(ExchangePoint point) {
+    for (auto& e : m_exchanges) {
+        if (e.point == point)
+            e.fun(m_time);
+    }
+}
+
+void ChCouplingExecutor::DoStep() {
+    RunExchanges(ExchangePoint::PRE_STEP);
+
+    // Step all participants concurrently, each sub-stepping to the coupling boundary on its own thread.
+    std::vector<std::future<void>> futures;
+    futures.reserve(m_systems.size());
+    for (auto& p : m_systems) {
+        futures.push_back(std::async(std::launch::async, [this, &p] {
+            double t = m_time;
+            for (int i = 0; i < p.substeps; i++) {
+                p.step_fun(t, p.step_size);
+                t += p.step_size;
+            }
+        }));
+    }
+    for (auto& f : futures)
+        f.get();
+
+    m_time += m_step_size;
+
+    RunExchanges(ExchangePoint::POST_STEP);
+}
+
+void ChCouplingExecutor::Advance(double duration) {
+    int num_steps = (int)std::round(duration / m_step_size);
+    for (int i = 0; i < num_steps; i++)
+        DoStep();
+}
+
+}  // end namespace utils
+}  // end namespace chrono
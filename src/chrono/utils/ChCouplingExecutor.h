@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Coupling executor for co-scheduled stepping of heterogeneous systems.
+//
+// =============================================================================
+
+#ifndef CH_COUPLING_EXECUTOR_H
+#define CH_COUPLING_EXECUTOR_H
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// Coupling executor for co-scheduled stepping of heterogeneous systems.
+/// The typical tightly-coupled machine + granular setup (a ChSystem machine model coupled to a GPU terrain solver
+/// through manual force exchange) serializes the two solves in user code: step CPU, read states, step GPU, read forces,
+/// repeat. This executor standardizes that loop and overlaps it: all participants advance their steps concurrently, and
+/// the data exchange is declared once, as exchange callbacks bound to well-defined points of the coupling step, instead
+/// of being interleaved by hand with the stepping calls.
+///
+/// Participants are either ChSystem instances or opaque step functions, so solvers that do not derive from ChSystem
+/// (ChSystemGpu, ChSystemFsi) attach without introducing a module dependency; wrap their advance call in a lambda.
+/// Each participant declares its own integration step size; the executor sub-steps participants with smaller steps so
+/// that all participants meet at every coupling step boundary (the coupling step must be an integer multiple of each
+/// participant step).
+///
+/// Within a coupling step the schedule is: PRE_STEP exchanges (serial, on the calling thread), all participant steps
+/// (concurrent), POST_STEP exchanges (serial). An exchange callback may therefore freely touch any participant's data,
+/// but participants must not share mutable data during the concurrent phase.
+class ChApi ChCouplingExecutor {
+  public:
+    /// Point of the coupling step at which an exchange callback runs.
+    enum class ExchangePoint {
+        PRE_STEP,  ///< before the participant steps (inputs: apply forces, impose motion)
+        POST_STEP  ///< after the participant steps (outputs: read states, collect reactions)
+    };
+
+    /// Construct an executor with the given coupling step size (the meeting interval of all participants).
+    ChCouplingExecutor(double step_size);
+
+    ~ChCouplingExecutor() {}
+
+    /// Add a Chrono system, advanced with the given integration step size (must divide the coupling step).
+    /// Configure the system for modest internal parallelism (e.g. SetNumThreads) to avoid oversubscription,
+    /// since participants step concurrently.
+    void AddSystem(ChSystem* system, double step_size);
+
+    /// Add an opaque participant through its step function, called as step_fun(time, step_size) once per coupling
+    /// step with step_size equal to the coupling step. Use this for solvers that do not derive from ChSystem and
+    /// manage their own sub-stepping (e.g. ChSystemGpu::AdvanceSimulation, ChSystemFsi::DoStepDynamics_FSI).
+    void AddSystem(std::function<void(double time, double step_size)> step_fun);
+
+    /// Declare an exchange callback, run serially at the given point of every coupling step.
+    void AddExchange(std::function<void(double time)> exchange_fun, ExchangePoint point = ExchangePoint::PRE_STEP);
+
+    /// Declare a force exchange onto a body: at every PRE_STEP the body force accumulator is emptied and reloaded
+    /// with the force and torque returned by the callback (expressed in absolute coordinates, force applied at the
+    /// body COM). This is the standard pattern for feeding terrain reaction forces back into the machine model.
+    void AddForceExchange(std::shared_ptr<ChBody> body,
+                          std::function<ChVector<>(double time)> force_fun,
+                          std::function<ChVector<>(double time)> torque_fun = nullptr);
+
+    /// Declare a body-set exchange: the callback receives the declared set at the given point of every coupling
+    /// step, for reading states out to a co-simulated solver (POST_STEP) or imposing inputs on them (PRE_STEP).
+    void AddBodySetExchange(std::vector<std::shared_ptr<ChBody>> bodies,
+                            std::function<void(double time, const std::vector<std::shared_ptr<ChBody>>& bodies)> fun,
+                            ExchangePoint point = ExchangePoint::POST_STEP);
+
+    /// Advance all participants by one coupling step, running the declared exchanges at their points.
+    void DoStep();
+
+    /// Advance all participants by (approximately) the given duration, in whole coupling steps.
+    void Advance(double duration);
+
+    /// Get the coupling step size.
+    double GetStepSize() const { return m_step_size; }
+
+    /// Get the current coupling time.
+    double GetChTime() const { return m_time; }
+
+  private:
+    /// A co-scheduled system, stepped through a uniform function seam.
+    struct Participant {
+        std::function<void(double time, double step_size)> step_fun;  ///< advances the participant by step_size
+        double step_size;                                             ///< participant integration step
+        int substeps;                                                 ///< participant steps per coupling step
+    };
+
+    /// A declared exchange callback.
+    struct Exchange {
+        std::function<void(double time)> fun;
+        ExchangePoint point;
+    };
+
+    /// Run all exchange callbacks declared for the given point.
+    void RunExchanges(ExchangePoint point);
+
+    double m_step_size;                     ///< coupling step size
+    double m_time;                          ///< current coupling time
+    std::vector<Participant> m_systems;     ///< co-scheduled participants
+    std::vector<Exchange> m_exchanges;      ///< declared exchange callbacks, in declaration order
+};
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
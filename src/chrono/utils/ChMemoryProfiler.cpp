@@ -0,0 +1,171 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora
+// =============================================================================
+
+#include <cstdio>
+
+#include "chrono/utils/ChMemoryProfiler.h"
+
+#if defined(_WIN32)
+    #include <windows.h>
+    #include <psapi.h>
+#elif defined(__linux__)
+    #include <sys/resource.h>
+    #include <unistd.h>
+#elif defined(__APPLE__)
+    #include <mach/mach.h>
+    #include <sys/resource.h>
+#endif
+
+namespace chrono {
+namespace utils {
+
+std::atomic<bool> ChMemoryProfiler::m_enabled(false);
+
+// Per-tag counters and high watermarks. Updates race benignly between threads: a concurrent
+// update can miss a transient peak, but the counters themselves stay exact.
+static std::atomic<long long> tag_current[ChMemoryProfiler::NUM_TAGS];
+static std::atomic<long long> tag_peak[ChMemoryProfiler::NUM_TAGS];
+
+// Per-step RSS samples (see SampleStep).
+static std::atomic<size_t> step_rss(0);
+static std::atomic<size_t> step_peak_rss(0);
+
+void ChMemoryProfiler::SetEnabled(bool enable) {
+    m_enabled.store(enable, std::memory_order_relaxed);
+}
+
+void ChMemoryProfiler::Add(Tag tag, long long bytes) {
+    long long current = tag_current[tag].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    long long peak = tag_peak[tag].load(std::memory_order_relaxed);
+    while (current > peak && !tag_peak[tag].compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+    }
+}
+
+long long ChMemoryProfiler::GetCurrent(Tag tag) {
+    return tag_current[tag].load(std::memory_order_relaxed);
+}
+
+long long ChMemoryProfiler::GetPeak(Tag tag) {
+    return tag_peak[tag].load(std::memory_order_relaxed);
+}
+
+void ChMemoryProfiler::ResetPeaks() {
+    for (int i = 0; i < NUM_TAGS; i++) {
+        tag_peak[i].store(tag_current[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    size_t rss = GetProcessRSS();
+    step_rss.store(rss, std::memory_order_relaxed);
+    step_peak_rss.store(rss, std::memory_order_relaxed);
+}
+
+const char* ChMemoryProfiler::GetTagName(Tag tag) {
+    switch (tag) {
+        case COLLISION:
+            return "collision";
+        case SOLVER:
+            return "solver";
+        case FEA:
+            return "fea";
+        case SENSOR:
+            return "sensor";
+        case OTHER:
+            return "other";
+        default:
+            return "?";
+    }
+}
+
+size_t ChMemoryProfiler::GetProcessRSS() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return (size_t)pmc.WorkingSetSize;
+    return 0;
+#elif defined(__linux__)
+    long long size_pages, resident_pages;
+    FILE* f = fopen("/proc/self/statm", "r");
+    if (!f)
+        return 0;
+    int nread = fscanf(f, "%lld %lld", &size_pages, &resident_pages);
+    fclose(f);
+    if (nread != 2)
+        return 0;
+    return (size_t)resident_pages * (size_t)sysconf(_SC_PAGESIZE);
+#elif defined(__APPLE__)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) == KERN_SUCCESS)
+        return (size_t)info.resident_size;
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+size_t ChMemoryProfiler::GetProcessPeakRSS() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return (size_t)pmc.PeakWorkingSetSize;
+    return 0;
+#elif defined(__linux__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return (size_t)usage.ru_maxrss * 1024;  // ru_maxrss is in KiB on Linux
+#elif defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return (size_t)usage.ru_maxrss;  // ru_maxrss is in bytes on macOS
+#else
+    return 0;
+#endif
+}
+
+void ChMemoryProfiler::SampleStep() {
+    if (!IsEnabled())
+        return;
+    size_t rss = GetProcessRSS();
+    step_rss.store(rss, std::memory_order_relaxed);
+    size_t peak = step_peak_rss.load(std::memory_order_relaxed);
+    while (rss > peak && !step_peak_rss.compare_exchange_weak(peak, rss, std::memory_order_relaxed)) {
+    }
+}
+
+size_t ChMemoryProfiler::GetStepRSS() {
+    return step_rss.load(std::memory_order_relaxed);
+}
+
+size_t ChMemoryProfiler::GetStepPeakRSS() {
+    return step_peak_rss.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+
+ChMemoryScope::ChMemoryScope(ChMemoryProfiler::Tag tag) : m_tag(tag), m_rss_begin(0) {
+    if (ChMemoryProfiler::IsEnabled())
+        m_rss_begin = ChMemoryProfiler::GetProcessRSS();
+}
+
+ChMemoryScope::~ChMemoryScope() {
+    if (!ChMemoryProfiler::IsEnabled() || m_rss_begin == 0)
+        return;
+    size_t rss_end = ChMemoryProfiler::GetProcessRSS();
+    if (rss_end > m_rss_begin)
+        ChMemoryProfiler::Allocated(m_tag, rss_end - m_rss_begin);
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,143 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora
+// =============================================================================
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+#include "chrono/utils/ChPhaseProfiler.h"
+
+namespace chrono {
+namespace utils {
+
+std::atomic<bool> ChPhaseProfiler::m_enabled(false);
+
+// -----------------------------------------------------------------------------
+
+static const char* phase_names[ChPhaseProfiler::NUM_PHASES] = {
+    "step", "collision", "setup", "update", "jacobian", "ls_setup", "ls_solve", "advance"};
+
+// Read the time stamp counter (falling back to the steady clock on non-x86 platforms).
+static inline uint64_t get_timestamp() {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+// One recorded instrumentation event.
+struct PhaseEvent {
+    uint64_t stamp;  ///< time stamp counter value
+    int32_t phase;   ///< phase identifier
+    int32_t begin;   ///< 1 for phase begin, 0 for phase end
+};
+
+// Per-thread ring buffer of events. Written only by the owning thread; the head index is atomic so
+// that the exporter can read a consistent snapshot without locking the hot path.
+struct PhaseRing {
+    static const size_t capacity = 1 << 16;
+    std::vector<PhaseEvent> events;
+    std::atomic<uint64_t> head;
+    int thread_id;
+
+    PhaseRing() : events(capacity), head(0), thread_id(0) {}
+};
+
+// Registry of the ring buffers of all threads that ever recorded an event. Ring buffers are kept
+// alive for the duration of the program, so the exporter can still see events of finished threads.
+static std::mutex ring_registry_mutex;
+static std::vector<std::unique_ptr<PhaseRing>>& ring_registry() {
+    static std::vector<std::unique_ptr<PhaseRing>> rings;
+    return rings;
+}
+
+static PhaseRing* acquire_thread_ring() {
+    std::lock_guard<std::mutex> lock(ring_registry_mutex);
+    ring_registry().push_back(std::unique_ptr<PhaseRing>(new PhaseRing));
+    ring_registry().back()->thread_id = (int)ring_registry().size();
+    return ring_registry().back().get();
+}
+
+// Calibration pair (time stamp counter value, wall clock) taken at startup; a second pair taken at
+// export time gives the conversion factor from counter ticks to microseconds.
+static uint64_t calib_stamp = get_timestamp();
+static std::chrono::steady_clock::time_point calib_time = std::chrono::steady_clock::now();
+
+// -----------------------------------------------------------------------------
+
+void ChPhaseProfiler::SetEnabled(bool enable) {
+    m_enabled.store(enable, std::memory_order_relaxed);
+}
+
+void ChPhaseProfiler::Record(Phase phase, bool begin) {
+    static thread_local PhaseRing* ring = acquire_thread_ring();
+
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    PhaseEvent& ev = ring->events[head % PhaseRing::capacity];
+    ev.stamp = get_timestamp();
+    ev.phase = (int32_t)phase;
+    ev.begin = begin ? 1 : 0;
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+bool ChPhaseProfiler::WriteChromeTrace(const std::string& filename) {
+    // Convert counter ticks to microseconds using the two calibration pairs.
+    uint64_t stamp_now = get_timestamp();
+    auto time_now = std::chrono::steady_clock::now();
+    double elapsed_us = std::chrono::duration<double, std::micro>(time_now - calib_time).count();
+    double us_per_tick = (stamp_now > calib_stamp) ? elapsed_us / (double)(stamp_now - calib_stamp) : 1e-3;
+
+    std::ofstream file(filename.c_str());
+    if (!file)
+        return false;
+
+    file << "{\"traceEvents\":[\n";
+    bool first = true;
+
+    std::lock_guard<std::mutex> lock(ring_registry_mutex);
+    for (const auto& ring : ring_registry()) {
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        uint64_t count = (head < PhaseRing::capacity) ? head : (uint64_t)PhaseRing::capacity;
+        for (uint64_t i = head - count; i < head; i++) {
+            const PhaseEvent& ev = ring->events[i % PhaseRing::capacity];
+            double ts = (double)(ev.stamp - calib_stamp) * us_per_tick;
+            if (!first)
+                file << ",\n";
+            first = false;
+            file << "{\"name\":\"" << phase_names[ev.phase] << "\",\"ph\":\"" << (ev.begin ? 'B' : 'E')
+                 << "\",\"ts\":" << ts << ",\"pid\":0,\"tid\":" << ring->thread_id << "}";
+        }
+    }
+
+    file << "\n]}\n";
+    return (bool)file;
+}
+
+void ChPhaseProfiler::Clear() {
+    std::lock_guard<std::mutex> lock(ring_registry_mutex);
+    for (auto& ring : ring_registry())
+        ring->head.store(0, std::memory_order_release);
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,110 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Bounded executor for asynchronous stepping of multiple Chrono systems.
+//
+// =============================================================================
+
+#include "chrono/utils/ChStepExecutor.h"
+
+namespace chrono {
+namespace utils {
+
+ChStepExecutor::ChStepExecutor(int num_workers) : m_num_pending(0), m_stop(false) {
+    if (num_workers <= 0)
+        num_workers = (int)std::thread::hardware_concurrency();
+    if (num_workers < 1)
+        num_workers = 1;
+
+    m_workers.reserve(num_workers);
+    for (int i = 0; i < num_workers; i++)
+        m_workers.emplace_back(&ChStepExecutor::WorkerLoop, this);
+}
+
+ChStepExecutor::~ChStepExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv_workers.notify_all();
+    for (auto& worker : m_workers)
+        worker.join();
+}
+
+std::future<int> ChStepExecutor::StepAsync(ChSystem* system, double step_size) {
+    Task task;
+    task.system = system;
+    task.step_size = step_size;
+    auto future = task.result.get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(std::move(task));
+        m_num_pending++;
+    }
+    m_cv_workers.notify_one();
+
+    return future;
+}
+
+size_t ChStepExecutor::GetNumPending() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_num_pending;
+}
+
+void ChStepExecutor::Wait() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv_idle.wait(lock, [this] { return m_num_pending == 0; });
+}
+
+void ChStepExecutor::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true) {
+        // Find the oldest queued step whose system is not already being stepped by another worker. Steps of a single
+        // system thus run one at a time, in submission order, while steps of different systems run concurrently.
+        auto task_it = m_queue.end();
+        m_cv_workers.wait(lock, [this, &task_it] {
+            for (auto it = m_queue.begin(); it != m_queue.end(); ++it) {
+                if (m_active.find(it->system) == m_active.end()) {
+                    task_it = it;
+                    return true;
+                }
+            }
+            return m_stop;
+        });
+
+        // Exit only once no runnable work is left (pending steps of active systems are picked up by the workers
+        // completing them, which hold the lock again before this worker can observe the stop flag).
+        if (task_it == m_queue.end())
+            break;
+
+        Task task = std::move(*task_it);
+        m_queue.erase(task_it);
+        m_active.insert(task.system);
+
+        lock.unlock();
+        int result = task.system->DoStepDynamics(task.step_size);
+        task.result.set_value(result);
+        lock.lock();
+
+        m_active.erase(task.system);
+        m_num_pending--;
+        if (m_num_pending == 0)
+            m_cv_idle.notify_all();
+        // A step of this system queued behind the completed one may now be runnable.
+        m_cv_workers.notify_all();
+    }
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,90 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Bounded executor for asynchronous stepping of multiple Chrono systems.
+//
+// =============================================================================
+
+#ifndef CH_STEP_EXECUTOR_H
+#define CH_STEP_EXECUTOR_H
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// Bounded executor for asynchronous stepping of multiple Chrono systems.
+/// DoStepDynamics blocks its calling thread, so a process hosting many independent interactive simulations (e.g. a
+/// server with one session per client) would otherwise need one OS thread per session. This executor multiplexes any
+/// number of systems over a fixed pool of worker threads: StepAsync enqueues one integration step and immediately
+/// returns a std::future for its completion, and the caller resubmits a session whenever it wants its next step.
+///
+/// Steps of different systems run concurrently; steps of the same system are serialized in submission order, so it is
+/// safe to submit a system again before its previous step has completed. A system must not be modified by the caller
+/// while one of its steps is pending. Since the systems themselves run concurrently, each should be configured for
+/// modest internal parallelism (e.g. sys->SetNumThreads(1)) to avoid oversubscription.
+class ChApi ChStepExecutor {
+  public:
+    /// Construct an executor with the specified number of worker threads (0: all available cores).
+    ChStepExecutor(int num_workers = 0);
+
+    /// Drain all pending steps and stop the worker threads.
+    ~ChStepExecutor();
+
+    /// Enqueue a single integration step of the given system with the given step size.
+    /// The returned future becomes ready when the step has completed, holding the value returned by DoStepDynamics.
+    std::future<int> StepAsync(ChSystem* system, double step_size);
+
+    /// Get the number of worker threads.
+    int GetNumWorkers() const { return (int)m_workers.size(); }
+
+    /// Get the number of steps submitted but not yet completed.
+    size_t GetNumPending() const;
+
+    /// Block until all steps submitted so far have completed.
+    void Wait();
+
+  private:
+    /// A single enqueued integration step.
+    struct Task {
+        ChSystem* system;
+        double step_size;
+        std::promise<int> result;
+    };
+
+    /// Worker thread body: repeatedly run the oldest queued step whose system is not already being stepped.
+    void WorkerLoop();
+
+    std::vector<std::thread> m_workers;      ///< worker thread pool
+    std::deque<Task> m_queue;                ///< queued steps, in submission order
+    std::unordered_set<ChSystem*> m_active;  ///< systems with a step currently running
+    size_t m_num_pending;                    ///< number of submitted but not completed steps
+    bool m_stop;                             ///< shutdown requested?
+
+    mutable std::mutex m_mutex;              ///< protects all executor state
+    std::condition_variable m_cv_workers;    ///< signaled when work may be available
+    std::condition_variable m_cv_idle;       ///< signaled when a step completes
+};
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
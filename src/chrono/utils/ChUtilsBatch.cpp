@@ -0,0 +1,89 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <fstream>
+#include <sstream>
+
+#include "chrono/utils/ChOpenMP.h"
+#include "chrono/utils/ChUtilsBatch.h"
+
+namespace chrono {
+namespace utils {
+
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<geometry::ChTriangleMeshConnected> ModelDataCache::GetTriangleMesh(const std::string& filename,
+                                                                                   bool load_normals,
+                                                                                   bool load_uv) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto entry = m_meshes.find(filename);
+        if (entry != m_meshes.end())
+            return entry->second;
+    }
+
+    // Load outside the lock, so that a large mesh does not serialize unrelated lookups.
+    auto mesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(filename, load_normals, load_uv);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto entry = m_meshes.find(filename);
+    if (entry != m_meshes.end())
+        return entry->second;  // another thread raced us to it; keep the first copy
+    m_meshes[filename] = mesh;
+    return mesh;
+}
+
+const std::string& ModelDataCache::GetText(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto entry = m_texts.find(filename);
+    if (entry != m_texts.end())
+        return entry->second;
+
+    std::ifstream file(filename);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return m_texts[filename] = buffer.str();
+}
+
+void ModelDataCache::Clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_meshes.clear();
+    m_texts.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+int SimulationBatch::AddSimulation(std::function<std::shared_ptr<ChSystem>()> builder) {
+    m_builders.push_back(builder);
+    return (int)m_builders.size() - 1;
+}
+
+void SimulationBatch::Run(double step, double t_end, std::function<void(int, ChSystem&)> post_step) {
+    int num_sims = (int)m_builders.size();
+    m_systems.resize(num_sims);
+
+    int num_threads = m_num_threads > 0 ? m_num_threads : ChOMP::GetNumProcs();
+
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+    for (int i = 0; i < num_sims; i++) {
+        auto sys = m_builders[i]();
+        m_systems[i] = sys;
+        while (sys->GetChTime() < t_end) {
+            sys->DoStepDynamics(step);
+            if (post_step)
+                post_step(i, *sys);
+        }
+    }
+}
+
+}  // end namespace utils
+}  // end namespace chrono
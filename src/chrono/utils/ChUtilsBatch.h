@@ -0,0 +1,100 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Headless batched simulation runner with shared immutable model data.
+//
+// =============================================================================
+
+#ifndef CH_UTILS_BATCH_H
+#define CH_UTILS_BATCH_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// Thread-safe cache of immutable model data shared across simulation variants.
+/// Each file is parsed once; all callers receive shared pointers (or references) to the same
+/// in-memory object, so running N variants of one model no longer loads meshes and specification
+/// files N times. Cached objects must be treated as read-only; a variant that needs to modify a
+/// mesh must work on its own copy.
+class ChApi ModelDataCache {
+  public:
+    /// Get the triangle mesh loaded from the specified Wavefront OBJ file, loading it on first use.
+    std::shared_ptr<geometry::ChTriangleMeshConnected> GetTriangleMesh(const std::string& filename,
+                                                                       bool load_normals = true,
+                                                                       bool load_uv = false);
+
+    /// Get the contents of the specified text file (e.g. a JSON specification), reading it on first use.
+    const std::string& GetText(const std::string& filename);
+
+    /// Discard all cached entries.
+    void Clear();
+
+  private:
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::shared_ptr<geometry::ChTriangleMeshConnected>> m_meshes;
+    std::unordered_map<std::string, std::string> m_texts;
+};
+
+/// Executor for batches of parameter-variant simulations in one process.
+/// Each simulation is described by a builder functor which constructs and returns its ChSystem;
+/// builders typically capture a shared ModelDataCache so that the immutable model data (meshes,
+/// specification files) is loaded once and shared read-only by all variants. The batch is stepped
+/// on an OpenMP thread pool, one simulation per task.
+///
+/// Since the simulations themselves run concurrently, builders should configure each system for
+/// modest internal parallelism (e.g. sys->SetNumThreads(1)) to avoid oversubscription.
+class ChApi SimulationBatch {
+  public:
+    /// Construct a batch executor running on the specified number of threads (0: all available cores).
+    SimulationBatch(int num_threads = 0) : m_num_threads(num_threads) {}
+
+    /// Set the number of worker threads (0: all available cores).
+    void SetNumThreads(int num_threads) { m_num_threads = num_threads; }
+
+    /// Register one simulation, described by a functor constructing its system.
+    /// The builder is invoked from a worker thread when the batch runs. Returns the simulation index.
+    int AddSimulation(std::function<std::shared_ptr<ChSystem>()> builder);
+
+    /// Get the number of registered simulations.
+    int GetNumSimulations() const { return (int)m_builders.size(); }
+
+    /// Build and advance all registered simulations to the specified end time.
+    /// The optional post-step functor is invoked after every step of every simulation (from the
+    /// worker thread advancing it) with the simulation index and its system, e.g. to collect output.
+    void Run(double step,
+             double t_end,
+             std::function<void(int, ChSystem&)> post_step = std::function<void(int, ChSystem&)>());
+
+    /// Get the system of the specified simulation (available after Run).
+    std::shared_ptr<ChSystem> GetSystem(int i) const { return m_systems[i]; }
+
+  private:
+    int m_num_threads;
+    std::vector<std::function<std::shared_ptr<ChSystem>()>> m_builders;
+    std::vector<std::shared_ptr<ChSystem>> m_systems;
+};
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
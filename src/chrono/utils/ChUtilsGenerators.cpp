@@ -260,7 +260,13 @@ double MixtureIngredient::calcMinSeparation() {
 
 // Constructor: create a generator for the specified system.
 Generator::Generator(ChSystem* system)
-    : m_system(system), m_mixDist(0, 1), m_crtBodyId(0), m_totalNumBodies(0), m_totalMass(0), m_totalVolume(0) {
+    : m_system(system),
+      m_mixDist(0, 1),
+      m_crtBodyId(0),
+      m_totalNumBodies(0),
+      m_totalMass(0),
+      m_totalVolume(0),
+      m_shared_materials(true) {
 }
 
 // Destructor
@@ -487,6 +493,10 @@ void Generator::createObjects(const PointVector& points, const ChVector<>& vel)
             }
         }
 
+        // Share one material instance among all bodies with identical material properties.
+        if (m_shared_materials)
+            mat = m_mat_registry.Intern(mat);
+
         // Create the body (with appropriate collision model, consistent with the associated system)
         ChBody* body = m_system->NewBody();
 
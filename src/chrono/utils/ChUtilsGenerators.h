@@ -229,6 +229,13 @@ class ChApi Generator {
     /// at which bodies will be initialized.
     void RegisterCreateObjectsCallback(std::shared_ptr<CreateObjectsCallback> callback) { m_callback = callback; }
 
+    /// Enable or disable sharing of contact materials between generated bodies (default: true).
+    /// When enabled, the per-body materials are interned through a registry so that bodies with
+    /// identical material properties (e.g. when the mixture ingredients use no property
+    /// distributions) share a single material instance instead of each holding its own copy.
+    /// Disable this if the materials of individual generated bodies are modified after creation.
+    void SetSharedMaterials(bool val) { m_shared_materials = val; }
+
     /// Write information about the bodies created so far to the specified file (CSV format).
     void writeObjectInfo(const std::string& filename);
 
@@ -264,6 +271,9 @@ class ChApi Generator {
 
     std::shared_ptr<CreateObjectsCallback> m_callback;
 
+    bool m_shared_materials;              ///< intern per-body contact materials
+    ChMaterialRegistry m_mat_registry;    ///< registry of shared contact materials
+
     int m_crtBodyId;
 
     friend class MixtureIngredient;
@@ -164,7 +164,7 @@ void ReadCheckpoint(ChSystem* system, const std::string& filename) {
 
         // Read body Id and flags
         int bid, bfixed, bcollide;
-        short family_group, family_mask;
+        int family_group, family_mask;
         iss1 >> bid >> bfixed >> bcollide >> family_group >> family_mask;
 
         // Read body mass and inertia
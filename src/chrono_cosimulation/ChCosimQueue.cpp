@@ -0,0 +1,69 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora
+// =============================================================================
+
+#include <thread>
+
+#include "chrono_cosimulation/ChCosimQueue.h"
+
+#include "chrono/utils/ChSocket.h"
+
+using namespace chrono::utils;
+
+namespace chrono {
+namespace cosimul {
+
+ChCosimQueue::ChCosimQueue(int n_values, int capacity) : m_n(n_values), m_capacity(capacity), m_written(0), m_read(0) {
+    m_frames.resize(m_capacity * (m_n + 1));
+}
+
+void ChCosimQueue::Push(double time, ChVectorConstRef data) {
+    if (data.size() != m_n)
+        throw ChExceptionSocket(0, "Error. Sent data must be a vector of size N.");
+
+    size_t written = m_written.load(std::memory_order_relaxed);
+
+    // Wait until a frame slot is free.
+    while (written - m_read.load(std::memory_order_acquire) >= m_capacity)
+        std::this_thread::yield();
+
+    double* frame = &m_frames[(written % m_capacity) * (m_n + 1)];
+    frame[0] = time;
+    for (int i = 0; i < m_n; i++)
+        frame[1 + i] = data(i);
+
+    // Publish the frame.
+    m_written.store(written + 1, std::memory_order_release);
+}
+
+void ChCosimQueue::Pop(double& time, ChVectorRef data) {
+    if (data.size() != m_n)
+        throw ChExceptionSocket(0, "Error. Received data must be a vector of size N.");
+
+    size_t read = m_read.load(std::memory_order_relaxed);
+
+    // Wait until a frame is available.
+    while (m_written.load(std::memory_order_acquire) == read)
+        std::this_thread::yield();
+
+    const double* frame = &m_frames[(read % m_capacity) * (m_n + 1)];
+    time = frame[0];
+    for (int i = 0; i < m_n; i++)
+        data(i) = frame[1 + i];
+
+    // Release the frame slot.
+    m_read.store(read + 1, std::memory_order_release);
+}
+
+}  // end namespace cosimul
+}  // end namespace chrono
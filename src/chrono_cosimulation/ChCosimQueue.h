@@ -0,0 +1,121 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora
+// =============================================================================
+
+#ifndef CHCOSIMQUEUE_H
+#define CHCOSIMQUEUE_H
+
+#include <atomic>
+#include <vector>
+
+#include "chrono_cosimulation/ChApiCosimulation.h"
+
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+namespace cosimul {
+
+/// @addtogroup cosimulation_module
+/// @{
+
+/// Lock-free single-producer single-consumer queue of co-simulation state frames.
+/// Each frame has a fixed layout: the simulation time followed by a fixed number of scalar
+/// values. The producer and the consumer must be single threads; under this restriction the
+/// queue needs no locks, and an exchange costs only the frame copy plus two atomic counter
+/// updates. Push blocks (spinning with a yield) while the queue is full and Pop blocks while
+/// it is empty, mirroring the blocking behavior of the TCP socket transport.
+class ChApiCosimulation ChCosimQueue {
+  public:
+    /// Create a queue of frames carrying the given number of scalar values each.
+    /// The capacity is the number of in-flight frames (one is enough for lock-step coupling;
+    /// a larger capacity allows the producer to run ahead).
+    ChCosimQueue(int n_values, int capacity = 16);
+
+    /// Return the number of scalar values per frame (excluding the time).
+    int GetNumValues() const { return m_n; }
+
+    /// Append a frame to the queue, blocking while the queue is full.
+    /// To be called only from the (single) producer thread.
+    void Push(double time, ChVectorConstRef data);
+
+    /// Extract the oldest frame from the queue, blocking while the queue is empty.
+    /// To be called only from the (single) consumer thread.
+    void Pop(double& time, ChVectorRef data);
+
+  private:
+    int m_n;                  ///< number of scalar values per frame
+    size_t m_capacity;        ///< number of in-flight frames
+    std::vector<double> m_frames;  ///< frame storage (capacity * (n+1) doubles)
+
+    // Monotonically increasing frame counters, on separate cache lines to avoid false sharing.
+    alignas(64) std::atomic<size_t> m_written;  ///< number of frames pushed
+    alignas(64) std::atomic<size_t> m_read;     ///< number of frames popped
+};
+
+/// One side of an in-process co-simulation connection.
+/// Provides the send/receive interface of the co-simulation data exchange over a pair of
+/// lock-free queues (see ChCosimLocalConnection).
+class ChApiCosimulation ChCosimLocalEndpoint {
+  public:
+    ChCosimLocalEndpoint() : m_send(0), m_recv(0) {}
+
+    /// Return the number of scalar values received each timestep.
+    int GetNumInValues() const { return m_recv->GetNumValues(); }
+
+    /// Return the number of scalar values sent each timestep.
+    int GetNumOutValues() const { return m_send->GetNumValues(); }
+
+    /// Send a frame to the other endpoint (blocks while the outgoing queue is full).
+    void SendData(double time, ChVectorConstRef data) { m_send->Push(time, data); }
+
+    /// Receive a frame from the other endpoint (blocks until a frame is available).
+    void ReceiveData(double& time, ChVectorRef data) { m_recv->Pop(time, data); }
+
+  private:
+    ChCosimLocalEndpoint(ChCosimQueue* send, ChCosimQueue* recv) : m_send(send), m_recv(recv) {}
+
+    ChCosimQueue* m_send;  ///< queue for outgoing frames
+    ChCosimQueue* m_recv;  ///< queue for incoming frames
+
+    friend class ChCosimLocalConnection;
+};
+
+/// In-process transport for co-simulation couplings living in the same process (e.g.
+/// software-in-the-loop with generated code), replacing the TCP socket round trip with two
+/// lock-free queues. The connection owns one queue per direction; the two endpoints obtained
+/// from GetEndpointA() and GetEndpointB() can be driven from different threads of the same
+/// process, each thread acting as the single producer of its outgoing queue and the single
+/// consumer of its incoming queue.
+class ChApiCosimulation ChCosimLocalConnection {
+  public:
+    /// Create a connection exchanging the given number of scalar values in each direction.
+    ChCosimLocalConnection(int n_AtoB_values, int n_BtoA_values, int capacity = 16)
+        : m_AtoB(n_AtoB_values, capacity), m_BtoA(n_BtoA_values, capacity) {}
+
+    /// Return the endpoint sending A-to-B frames and receiving B-to-A frames.
+    ChCosimLocalEndpoint GetEndpointA() { return ChCosimLocalEndpoint(&m_AtoB, &m_BtoA); }
+
+    /// Return the endpoint sending B-to-A frames and receiving A-to-B frames.
+    ChCosimLocalEndpoint GetEndpointB() { return ChCosimLocalEndpoint(&m_BtoA, &m_AtoB); }
+
+  private:
+    ChCosimQueue m_AtoB;  ///< frames from endpoint A to endpoint B
+    ChCosimQueue m_BtoA;  ///< frames from endpoint B to endpoint A
+};
+
+/// @} cosimulation_module
+
+}  // end namespace cosimul
+}  // end namespace chrono
+
+#endif
@@ -27,11 +27,22 @@ ChCosimulation::ChCosimulation(ChSocketFramework& mframework,  // socket framewo
 ) {
     this->myServer = 0;
     this->myClient = 0;
+    this->myLocalValid = false;
     this->in_n = n_in_values;
     this->out_n = n_out_values;
     this->nport = 0;
 }
 
+ChCosimulation::ChCosimulation(const ChCosimLocalEndpoint& endpoint) {
+    this->myServer = 0;
+    this->myClient = 0;
+    this->myLocal = endpoint;
+    this->myLocalValid = true;
+    this->in_n = endpoint.GetNumInValues();
+    this->out_n = endpoint.GetNumOutValues();
+    this->nport = 0;
+}
+
 ChCosimulation::~ChCosimulation() {
     if (this->myServer)
         delete this->myServer;
@@ -42,6 +53,10 @@ ChCosimulation::~ChCosimulation() {
 }
 
 bool ChCosimulation::WaitConnection(int aport) {
+    // Nothing to wait for over an in-process connection.
+    if (this->myLocalValid)
+        return true;
+
     this->nport = aport;
 
     // a server is created, that could listen at a given port
@@ -66,6 +81,12 @@ bool ChCosimulation::WaitConnection(int aport) {
 bool ChCosimulation::SendData(double mtime, ChVectorConstRef out_data) {
     if (out_data.size() != this->out_n)
         throw ChExceptionSocket(0, "Error. Sent data must be a vector of size N.");
+
+    if (this->myLocalValid) {
+        this->myLocal.SendData(mtime, out_data);
+        return true;
+    }
+
     if (!myClient)
         throw ChExceptionSocket(0, "Error. Attempted 'SendData' with no connected client.");
 
@@ -89,6 +110,12 @@ bool ChCosimulation::SendData(double mtime, ChVectorConstRef out_data) {
 bool ChCosimulation::ReceiveData(double& mtime, ChVectorRef in_data) {
     if (in_data.size() != this->in_n)
         throw ChExceptionSocket(0, "Error. Received data must be a vector of size N.");
+
+    if (this->myLocalValid) {
+        this->myLocal.ReceiveData(mtime, in_data);
+        return true;
+    }
+
     if (!myClient)
         throw ChExceptionSocket(0, "Error. Attempted 'ReceiveData' with no connected client.");
 
@@ -16,6 +16,7 @@
 #define CHCOSIMULATION_H
 
 #include "chrono_cosimulation/ChApiCosimulation.h"
+#include "chrono_cosimulation/ChCosimQueue.h"
 
 #include "chrono/utils/ChSocket.h"
 
@@ -35,6 +36,9 @@ namespace cosimul {
 /// back and forth.
 /// In this case, C::E will work as a server, waiting for
 /// a client to talk with.
+/// Alternatively, for couplings living in the same process, the interface can be created on
+/// one endpoint of a ChCosimLocalConnection, in which case the exchange goes through lock-free
+/// in-memory queues instead of the TCP socket round trip.
 
 class ChApiCosimulation ChCosimulation {
   public:
@@ -44,11 +48,17 @@ class ChApiCosimulation ChCosimulation {
                    int n_out_values                       ///< number of scalar variables to send each timestep
     );
 
+    /// Create a co-simulation interface over one endpoint of an in-process connection.
+    /// The numbers of exchanged values are given by the connection; no socket is opened and
+    /// WaitConnection() is a no-op.
+    ChCosimulation(const ChCosimLocalEndpoint& endpoint);
+
     ~ChCosimulation();
 
     /// Wait for a client to connect to the interface,
     /// on a given port, and wait until not connected.
     /// \a aport is a free port number, for example 50009.
+    /// For an interface created on an in-process connection, this returns true immediately.
     bool WaitConnection(int aport);
 
     /// Exchange data with the client, by sending a
@@ -68,6 +78,9 @@ class ChApiCosimulation ChCosimulation {
     chrono::utils::ChSocketTCP* myClient;
     int nport;
 
+    ChCosimLocalEndpoint myLocal;  ///< in-process endpoint (used when myLocalValid is true)
+    bool myLocalValid;             ///< interface created over an in-process connection
+
     int in_n;
     int out_n;
 };
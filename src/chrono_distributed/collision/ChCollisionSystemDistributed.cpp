@@ -191,7 +191,7 @@ void ChCollisionSystemDistributed::Add(ChCollisionModel* model) {
             real3 obB = shape->B;
             real3 obC = shape->C;
 
-            short2 fam = S2(pmodel->GetFamilyGroup(), pmodel->GetFamilyMask());
+            vec2 fam = I2(pmodel->GetFamilyGroup(), pmodel->GetFamilyMask());
 
             switch (shape->GetType()) {
                 case ChCollisionShape::Type::SPHERE:
@@ -375,7 +375,7 @@ void ChCollisionSystemDistributed::Add(ChCollisionModel* model) {
 //             real3 obB = pmodel->mData[i].B;
 //             real3 obC = pmodel->mData[i].C;
 //
-//             short2 fam = S2(pmodel->GetFamilyGroup(), pmodel->GetFamilyMask());
+//             vec2 fam = I2(pmodel->GetFamilyGroup(), pmodel->GetFamilyMask());
 //
 //             switch (pmodel->mData[i].type) {
 //                 case chrono::collision::SPHERE:
@@ -69,7 +69,7 @@ ChCommDistributed::ChCommDistributed(ChSystemDistributed* my_sys) {
     MPI_Type_commit(&BodyUpdateType);
 
     // Shape
-    MPI_Datatype type_shape[5] = {MPI_UNSIGNED, MPI_INT, MPI_SHORT, MPI_DOUBLE, MPI_FLOAT};
+    MPI_Datatype type_shape[5] = {MPI_UNSIGNED, MPI_INT, MPI_INT, MPI_DOUBLE, MPI_FLOAT};
     int blocklen_shape[5] = {1, 1, 2, 13, 6};
     MPI_Aint disp_shape[5];
     disp_shape[0] = offsetof(Shape, gid);
@@ -528,14 +528,24 @@ void ChCommDistributed::Exchange() {
                 num_take_down = 1;
             }
 
-            // Send Exchanges
+            // Send Exchanges, Updates, and Takes
+            // All sends are posted up front so that every outgoing message is in flight before this rank
+            // blocks on its first receive. Receiving in a fixed order afterwards is then harmless: the
+            // matching sends have already been made by the neighbors so no phase serializes on another.
             if (my_rank != num_ranks - 1) {
                 MPI_Isend(&(exchange_up_buf[0]), num_exchange_up, BodyExchangeType, my_rank + 1, 1, my_sys->world,
                           &rq_exchange_up);
+                MPI_Isend(&(update_up_buf[0]), num_update_up, BodyUpdateType, my_rank + 1, 3, my_sys->world,
+                          &rq_update_up);
+                MPI_Isend(&(update_take_up[0]), num_take_up, MPI_UNSIGNED, my_rank + 1, 5, my_sys->world, &rq_take_up);
             }
             if (my_rank != 0) {
                 MPI_Isend(&(exchange_down_buf[0]), num_exchange_down, BodyExchangeType, my_rank - 1, 2, my_sys->world,
                           &rq_exchange_down);
+                MPI_Isend(&(update_down_buf[0]), num_update_down, BodyUpdateType, my_rank - 1, 4, my_sys->world,
+                          &rq_update_down);
+                MPI_Isend(&(update_take_down[0]), num_take_down, MPI_UNSIGNED, my_rank - 1, 6, my_sys->world,
+                          &rq_take_down);
             }
 
             // Recv Exchanges
@@ -554,16 +564,6 @@ void ChCommDistributed::Exchange() {
                          &recv_status_exchange_up);
             }
 
-            // Send Updates
-            if (my_rank != num_ranks - 1) {
-                MPI_Isend(&(update_up_buf[0]), num_update_up, BodyUpdateType, my_rank + 1, 3, my_sys->world,
-                          &rq_update_up);
-            }
-            if (my_rank != 0) {
-                MPI_Isend(&(update_down_buf[0]), num_update_down, BodyUpdateType, my_rank - 1, 4, my_sys->world,
-                          &rq_update_down);
-            }
-
             // Recv Updates
             if (my_rank != 0) {
                 MPI_Probe(my_rank - 1, 3, my_sys->world, &recv_status_update_down);
@@ -580,15 +580,6 @@ void ChCommDistributed::Exchange() {
                          &recv_status_update_up);
             }
 
-            // Send Takes
-            if (my_rank != num_ranks - 1) {
-                MPI_Isend(&(update_take_up[0]), num_take_up, MPI_UNSIGNED, my_rank + 1, 5, my_sys->world, &rq_take_up);
-            }
-            if (my_rank != 0) {
-                MPI_Isend(&(update_take_down[0]), num_take_down, MPI_UNSIGNED, my_rank - 1, 6, my_sys->world,
-                          &rq_take_down);
-            }
-
             // Recv Takes
             if (my_rank != 0) {
                 MPI_Probe(my_rank - 1, 5, my_sys->world, &recv_status_take_down);
@@ -649,6 +640,16 @@ void ChCommDistributed::Exchange() {
         }  // End of pack shapes down section
     }      // End of parallel sections
 
+    // Send Shapes
+    // Posted before the local processing of the received exchanges/updates/takes so that the shape
+    // messages travel while this rank is busy updating its own data structures.
+    if (my_rank != num_ranks - 1) {
+        MPI_Isend(&(shapes_up[0]), num_shapes_up, ShapeType, my_rank + 1, 7, my_sys->world, &rq_shapes_up);
+    }
+    if (my_rank != 0) {
+        MPI_Isend(&(shapes_down[0]), num_shapes_down, ShapeType, my_rank - 1, 8, my_sys->world, &rq_shapes_down);
+    }
+
     // TODO sections?
     if (my_rank != 0)
         ProcessExchanges(num_recv_exchange_down, recv_exchange_down, 0);
@@ -665,14 +666,6 @@ void ChCommDistributed::Exchange() {
     if (my_rank != num_ranks - 1)
         ProcessTakes(num_recv_take_up, recv_take_up);
 
-    // Send Shapes
-    if (my_rank != num_ranks - 1) {
-        MPI_Isend(&(shapes_up[0]), num_shapes_up, ShapeType, my_rank + 1, 7, my_sys->world, &rq_shapes_up);
-    }
-    if (my_rank != 0) {
-        MPI_Isend(&(shapes_down[0]), num_shapes_down, ShapeType, my_rank - 1, 8, my_sys->world, &rq_shapes_down);
-    }
-
     // Recv Shapes
     if (my_rank != 0) {
         MPI_Probe(my_rank - 1, 7, my_sys->world, &recv_status_shapes_down);
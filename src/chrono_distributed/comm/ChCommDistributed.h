@@ -69,7 +69,7 @@ typedef struct BodyUpdate {
 typedef struct Shape {
     uint gid;           ///< global shape ID
     int type;           ///< shape type
-    short coll_fam[2];  ///< collision family and mask
+    int coll_fam[2];  ///< collision family and mask
     double A[3];        ///< position
     double R[4];        ///< orientation
     double data[6];     ///< shape-specific geometric data
@@ -22,8 +22,10 @@
 
 #include <mpi.h>
 #include <stdlib.h>
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 using namespace chrono;
 
@@ -69,13 +71,21 @@ void ChDomainDistributed::SetSimDomain(const ChVector<>& lo, const ChVector<>& h
 }
 
 void ChDomainDistributed::SplitDomain() {
+    int num_ranks = my_sys->num_ranks;
+
     // Length of this subdomain along the long axis
-    double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / my_sys->num_ranks;
+    double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / num_ranks;
+
+    bounds.resize(num_ranks + 1);
+    for (int i = 0; i < num_ranks; i++) {
+        bounds[i] = boxlo[split_axis] + i * sub_len;
+    }
+    bounds[num_ranks] = boxhi[split_axis];
 
     for (int i = 0; i < 3; i++) {
         if (split_axis == i) {
-            sublo[i] = boxlo[i] + my_sys->my_rank * sub_len;
-            subhi[i] = sublo[i] + sub_len;
+            sublo[i] = bounds[my_sys->my_rank];
+            subhi[i] = bounds[my_sys->my_rank + 1];
         } else {
             sublo[i] = boxlo[i];
             subhi[i] = boxhi[i];
@@ -85,10 +95,53 @@ void ChDomainDistributed::SplitDomain() {
 }
 
 int ChDomainDistributed::GetRank(const ChVector<double>& pos) const {
-    double sub_len = subhi[split_axis] - sublo[split_axis];
-    double pt = pos[split_axis] - boxlo[split_axis];
+    // The boundaries need not be uniform after rebalancing, so search for the
+    // sub-domain that contains the position.
+    double pt = pos[split_axis];
+    for (int i = 1; i < my_sys->num_ranks; i++) {
+        if (pt < bounds[i])
+            return i - 1;
+    }
+    return my_sys->num_ranks - 1;
+}
+
+void ChDomainDistributed::Rebalance(const std::vector<int>& rank_loads) {
+    int num_ranks = my_sys->num_ranks;
+    double ghost_layer = my_sys->GetGhostLayer();
+
+    // Limiting a boundary shift to half the ghost layer guarantees that a body changes its
+    // region classification by at most one layer, so the regular exchange paths (share,
+    // transfer, give) move the affected bodies to their new owners over the next time steps.
+    double max_shift = ghost_layer / 2;
+
+    // Each sub-domain must keep an owned band between its two shared layers.
+    double min_width = 3 * ghost_layer;
+
+    // Diffusive scheme: every rank computes the same shifts from the same load data, moving
+    // each interior boundary toward its more heavily loaded side.
+    std::vector<double> new_bounds = bounds;
+    for (int i = 1; i < num_ranks; i++) {
+        int load_down = rank_loads[i - 1];
+        int load_up = rank_loads[i];
+        if (load_down + load_up == 0)
+            continue;
+
+        // Positive imbalance: the lower rank is more loaded, so shrink it by moving the
+        // boundary down.
+        double imbalance = static_cast<double>(load_down - load_up) / (load_down + load_up);
+        double shift = -imbalance * max_shift;
+
+        double min_pos = new_bounds[i - 1] + min_width;
+        double max_pos = bounds[i + 1] - min_width;
+        if (min_pos > max_pos)
+            continue;  // the neighboring sub-domains are too narrow to shift this boundary
+
+        new_bounds[i] = std::min(max_pos, std::max(min_pos, bounds[i] + shift));
+    }
+    bounds = new_bounds;
 
-    return (int)(pt / sub_len);
+    sublo[split_axis] = bounds[my_sys->my_rank];
+    subhi[split_axis] = bounds[my_sys->my_rank + 1];
 }
 
 distributed::COMM_STATUS ChDomainDistributed::GetRegion(double pos) const {
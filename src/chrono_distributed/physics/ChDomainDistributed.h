@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "chrono/core/ChVector.h"
 #include "chrono/physics/ChBody.h"
@@ -139,6 +140,20 @@ class CH_DISTR_API ChDomainDistributed {
     /// Returns the rank which has ownership of a body with the given position
     int GetRank(const ChVector<double>& pos) const;
 
+    /// Get the sub-domain boundary positions along the splitting axis.
+    /// Entry i is the lower bound of the sub-domain of rank i; the last entry is the
+    /// upper bound of the global domain.
+    const std::vector<double>& GetBounds() const { return bounds; }
+
+    /// Shifts the sub-domain boundaries to even out the given per-rank loads.
+    /// Each interior boundary moves toward its more heavily loaded side by an amount
+    /// proportional to the imbalance between the two adjacent ranks, clamped to half
+    /// the ghost layer so that the affected bodies migrate incrementally through the
+    /// standard exchange machinery over the following time steps.
+    /// Must be called with identical loads on all ranks so that every rank arrives at
+    /// the same decomposition.
+    virtual void Rebalance(const std::vector<int>& rank_loads);
+
     /// Returns true if the domain has been set.
     bool IsSplit() const { return split; }
 
@@ -156,6 +171,8 @@ class CH_DISTR_API ChDomainDistributed {
 
     int split_axis;  ///< Index of the dimension of the longest edge of the global domain
 
+    std::vector<double> bounds;  ///< Sub-domain boundary positions along the splitting axis (num_ranks + 1 entries)
+
     /// Divides the domain into equal-volume, orthogonal, axis-aligned regions along
     /// the longest axis. Needs to be called right after the system is created so that
     /// bodies are added correctly.
@@ -53,7 +53,7 @@ static void PrintNode(LocalShapeNode* node) {
 }
 
 ChSystemDistributed::ChSystemDistributed(MPI_Comm communicator, double ghostlayer, unsigned int maxobjects)
-    : ghost_layer(ghostlayer), master_rank(0), num_bodies_global(0) {
+    : ghost_layer(ghostlayer), master_rank(0), num_bodies_global(0), rebalance_interval(0), rebalance_steps(0) {
     MPI_Comm_dup(communicator, &world);
     MPI_Comm_size(world, &num_ranks);
     MPI_Comm_rank(world, &my_rank);
@@ -126,6 +126,12 @@ bool ChSystemDistributed::Integrate_Y() {
 
     bool ret = ChSystemMulticoreSMC::Integrate_Y();
     if (num_ranks != 1) {
+        // Shift the sub-domain boundaries before the exchange so that the same exchange
+        // starts migrating bodies toward their new owners.
+        if (rebalance_interval > 0 && ++rebalance_steps >= rebalance_interval) {
+            Rebalance();
+            rebalance_steps = 0;
+        }
         data_manager->system_timer.start("Exchange");
         comm->Exchange();
         data_manager->system_timer.stop("Exchange");
@@ -136,6 +142,21 @@ bool ChSystemDistributed::Integrate_Y() {
     return ret;
 }
 
+void ChSystemDistributed::Rebalance() {
+    // Count the bodies this rank is responsible for advancing
+    int my_load = 0;
+    for (uint i = 0; i < data_manager->num_rigid_bodies; i++) {
+        distributed::COMM_STATUS status = ddm->comm_status[i];
+        if (status == distributed::OWNED || status == distributed::SHARED_UP || status == distributed::SHARED_DOWN)
+            my_load++;
+    }
+
+    std::vector<int> rank_loads(num_ranks);
+    MPI_Allgather(&my_load, 1, MPI_INT, rank_loads.data(), 1, MPI_INT, world);
+
+    domain->Rebalance(rank_loads);
+}
+
 void ChSystemDistributed::UpdateRigidBodies() {
     this->ChSystemMulticore::UpdateRigidBodies();
 
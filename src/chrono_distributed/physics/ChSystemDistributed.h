@@ -77,6 +77,17 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemMulticoreSMC {
     /// Return the distance into the neighboring sub-domain that is considered shared.
     double GetGhostLayer() const { return ghost_layer; }
 
+    /// Set the number of time steps between load rebalancing operations.
+    /// At every interval, per-rank counts of the bodies each rank is responsible for advancing
+    /// are gathered and the sub-domain boundaries are shifted toward the more heavily loaded
+    /// ranks (see ChDomainDistributed::Rebalance). The affected bodies migrate through the
+    /// standard exchange machinery over the following time steps. A non-positive interval
+    /// (the default) disables rebalancing.
+    void SetRebalanceInterval(int interval) { rebalance_interval = interval; }
+
+    /// Return the number of time steps between load rebalancing operations.
+    int GetRebalanceInterval() const { return rebalance_interval; }
+
     /// Return the current global number of bodies in the system.
     unsigned int GetNumBodiesGlobal() const { return num_bodies_global; }
 
@@ -226,6 +237,16 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemMulticoreSMC {
     /// Length into the neighboring sub-domain which is considered shared.
     double ghost_layer;
 
+    /// Number of time steps between load rebalancing operations (non-positive: disabled)
+    int rebalance_interval;
+
+    /// Number of time steps taken since the last load rebalancing operation
+    int rebalance_steps;
+
+    /// Gathers the per-rank body counts and shifts the sub-domain boundaries toward the
+    /// more heavily loaded ranks. Called from Integrate_Y at the requested interval.
+    void Rebalance();
+
     /// Number of bodies in the whole global simulation. Important for maintaining
     /// unique global IDs
     unsigned int num_bodies_global;
@@ -72,9 +72,15 @@ ChSystemFsi::ChSystemFsi(ChSystem* sysMBS)
     m_num_shell_elements = 0;
 
     m_fsi_interface = chrono_types::make_unique<ChFsiInterface>(*m_sysFSI, m_paramsH);
+
+    cudaStreamCreateWithFlags(&m_copy_stream, cudaStreamNonBlocking);
+    cudaEventCreateWithFlags(&m_forces_done, cudaEventDisableTiming);
 }
 
-ChSystemFsi::~ChSystemFsi() {}
+ChSystemFsi::~ChSystemFsi() {
+    cudaEventDestroy(m_forces_done);
+    cudaStreamDestroy(m_copy_stream);
+}
 
 void ChSystemFsi::AttachSystem(ChSystem* sysMBS) {
     m_sysMBS = sysMBS;
@@ -120,6 +126,10 @@ void ChSystemFsi::InitParams() {
 
     m_paramsH->NUM_BOUNDARY_LAYERS = 3;
 
+    // Proximity structure reuse
+    m_paramsH->use_Verlet_prox = false;
+    m_paramsH->prox_skin = Real(0.0);
+
     // Time stepping
     m_paramsH->Adaptive_time_stepping = false;
     m_paramsH->Co_number = Real(0.1);
@@ -585,6 +595,15 @@ void ChSystemFsi::SetAdaptiveTimeStepping(bool adaptive) {
     m_paramsH->Adaptive_time_stepping = adaptive;
 }
 
+void ChSystemFsi::SetProximityStructureReuse(bool enable, double skin) {
+    m_paramsH->use_Verlet_prox = enable;
+    m_paramsH->prox_skin = Real(skin);
+}
+
+void ChSystemFsi::SetAitkenRelaxation(bool enable, double omega_init, double omega_min, double omega_max) {
+    m_fsi_interface->EnableAitkenRelaxation(enable, omega_init, omega_min, omega_max);
+}
+
 void ChSystemFsi::SetSPHintegration(bool runSPH) {
     m_integrate_SPH = runSPH;
 }
@@ -896,8 +915,9 @@ void ChSystemFsi::DoStepDynamics_FSI() {
     if (m_fluid_dynamics->GetIntegratorType() == TimeIntegrator::EXPLICITSPH) {
         // The following is used to execute the Explicit WCSPH
         CopyDeviceDataToHalfStep();
-        thrust::copy(m_sysFSI->fsiGeneralData->derivVelRhoD.begin(), m_sysFSI->fsiGeneralData->derivVelRhoD.end(),
-                     m_sysFSI->fsiGeneralData->derivVelRhoD_old.begin());
+        // Wait for the snapshot of the previous force derivatives, enqueued on the side
+        // stream at the end of the previous step so it overlaps the MBS solve
+        cudaStreamSynchronize(m_copy_stream);
         ChUtilsDevice::FillVector(m_sysFSI->fsiGeneralData->derivVelRhoD, mR4(0));
 
         if (m_integrate_SPH) {
@@ -910,6 +930,15 @@ void ChSystemFsi::DoStepDynamics_FSI() {
         m_bce_manager->Rigid_Forces_Torques(m_sysFSI->sphMarkersD2, m_sysFSI->fsiBodiesD2);
         m_bce_manager->Flex_Forces(m_sysFSI->sphMarkersD2, m_sysFSI->fsiMeshD);
 
+        // Snapshot the force derivatives needed by the next step's force relaxation on the
+        // side stream, so the device-to-device copy overlaps the MBS solve below
+        cudaEventRecord(m_forces_done, 0);
+        cudaStreamWaitEvent(m_copy_stream, m_forces_done, 0);
+        cudaMemcpyAsync(mR4CAST(m_sysFSI->fsiGeneralData->derivVelRhoD_old),
+                        mR4CAST(m_sysFSI->fsiGeneralData->derivVelRhoD),
+                        m_sysFSI->fsiGeneralData->derivVelRhoD.size() * sizeof(Real4), cudaMemcpyDeviceToDevice,
+                        m_copy_stream);
+
         // Advance dynamics of the associated MBS system (if provided)
         if (m_sysMBS) {
             m_fsi_interface->Add_Rigid_ForceTorques_To_ChSystem();
@@ -156,6 +156,22 @@ class CH_FSI_API ChSystemFsi {
     /// Enable/disable adaptive time stepping.
     void SetAdaptiveTimeStepping(bool adaptive);
 
+    /// Enable/disable reuse of the proximity structure across substeps (Verlet-list style).
+    /// When enabled, the neighbor search grid and sorted arrays are rebuilt only once particles
+    /// have drifted more than half the given skin distance since the last rebuild; in between,
+    /// current particle data is simply re-gathered in the existing sorted order. A skin of 0
+    /// falls back to half the kernel length. Particles moving a tiny fraction of the kernel
+    /// radius per explicit substep make rebuilds much rarer at no loss of interacting pairs.
+    void SetProximityStructureReuse(bool enable, double skin = 0);
+
+    /// Enable/disable Aitken adaptive relaxation of the exchanged FSI interface forces.
+    /// The rigid body force/torque and flexible nodal force vectors passed to the multibody system
+    /// are under-relaxed with a factor updated by Aitken's Delta^2 formula from consecutive
+    /// exchange residuals. This damps the added-mass force oscillations of the explicit
+    /// partitioned coupling for light floating bodies, allowing larger coupling steps. The factor
+    /// starts at omega_init and is clamped to [omega_min, omega_max].
+    void SetAitkenRelaxation(bool enable, double omega_init = 1.0, double omega_min = 0.05, double omega_max = 1.0);
+
     /// Enable/disable SPH integration.
     void SetSPHintegration(bool runSPH);
 
@@ -562,6 +578,9 @@ class CH_FSI_API ChSystemFsi {
     ChTimer m_timer_step;  ///< timer for integration step
     double m_RTF;          ///< real-time factor (simulation time / simulated time)
 
+    cudaStream_t m_copy_stream;  ///< side stream overlapping device copies with the MBS solve
+    cudaEvent_t m_forces_done;   ///< marks completion of the BCE force reduction on the device
+
     friend class ChFsiVisualizationGL;
     friend class ChFsiVisualizationVSG;
 };
@@ -16,6 +16,9 @@
 // =============================================================================
 
 #include <thrust/sort.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/zip_iterator.h>
 #include "chrono_fsi/physics/ChCollisionSystemFsi.cuh"
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
 #include "chrono_fsi/utils/ChUtilsDevice.cuh"
@@ -307,7 +310,8 @@ ChCollisionSystemFsi::ChCollisionSystemFsi(std::shared_ptr<SphMarkerDataD> other
       markersProximityD(otherMarkersProximityD),
       fsiGeneralData(otherFsiGeneralData),
       paramsH(otherParamsH),
-      numObjectsH(otherNumObjects) {
+      numObjectsH(otherNumObjects),
+      structureValid(false) {
     sphMarkersD = NULL;
 }
 ChCollisionSystemFsi::~ChCollisionSystemFsi() {}
@@ -390,6 +394,13 @@ void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
         U1CAST(markersProximityD->gridMarkerIndexD));
 
     // Reorder the arrays according to the sorted index of all particles
+    reorderData();
+}
+// ------------------------------------------------------------------------------
+void ChCollisionSystemFsi::reorderData() {
+    uint numThreads, numBlocks;
+    computeGridSize((uint)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
+
     reorderDataD<<<numBlocks, numThreads>>>(
         U1CAST(markersProximityD->gridMarkerIndexD),
         U1CAST(fsiGeneralData->extendedActivityIdD),
@@ -403,16 +414,55 @@ void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
     cudaCheckError();
 }
 // ------------------------------------------------------------------------------
+// Functor returning the squared displacement of a particle from its position at the
+// time the proximity structure was last built.
+struct displacement_sq_functor {
+    __host__ __device__ Real operator()(const thrust::tuple<Real4, Real4>& t) const {
+        Real3 d = mR3(thrust::get<0>(t)) - mR3(thrust::get<1>(t));
+        return dot(d, d);
+    }
+};
+// ------------------------------------------------------------------------------
+bool ChCollisionSystemFsi::needStructureRebuild() {
+    if (posRadRebuildD.size() != sphMarkersD->posRadD.size())
+        return true;
+
+    Real skin = (paramsH->prox_skin > 0) ? paramsH->prox_skin : Real(0.5) * paramsH->HSML;
+    Real maxDispSq = thrust::transform_reduce(
+        thrust::make_zip_iterator(
+            thrust::make_tuple(sphMarkersD->posRadD.begin(), posRadRebuildD.begin())),
+        thrust::make_zip_iterator(
+            thrust::make_tuple(sphMarkersD->posRadD.end(), posRadRebuildD.end())),
+        displacement_sq_functor(), Real(0), thrust::maximum<Real>());
+
+    return maxDispSq > (skin / 2) * (skin / 2);
+}
+// ------------------------------------------------------------------------------
 void ChCollisionSystemFsi::ArrangeData(std::shared_ptr<SphMarkerDataD> otherSphMarkersD) {
     sphMarkersD = otherSphMarkersD;
+
+    // With proximity structure reuse on, particles that drifted less than half the skin since
+    // the last rebuild are guaranteed to still find all their interacting pairs through the
+    // stale binning; only the current particle data needs re-gathering in the sorted order.
+    if (paramsH->use_Verlet_prox && structureValid && !needStructureRebuild()) {
+        reorderData();
+        return;
+    }
+
     int3 cellsDim = paramsH->gridSize;
     int numCells = cellsDim.x * cellsDim.y * cellsDim.z;
     ResetCellSize(numCells);
     calcHash();
-    thrust::sort_by_key(markersProximityD->gridMarkerHashD.begin(), 
+    thrust::sort_by_key(markersProximityD->gridMarkerHashD.begin(),
         markersProximityD->gridMarkerHashD.end(),
         markersProximityD->gridMarkerIndexD.begin());
     reorderDataAndFindCellStart();
+
+    if (paramsH->use_Verlet_prox) {
+        // Snapshot the positions this structure was built from
+        posRadRebuildD = sphMarkersD->posRadD;
+        structureValid = true;
+    }
 }
 
 }  // end namespace fsi
@@ -57,6 +57,13 @@ class ChCollisionSystemFsi : public ChFsiGeneral {
     std::shared_ptr<SimParams> paramsH;                 ///< Parameters of the simulation
     std::shared_ptr<ChCounters> numObjectsH;            ///< Size of different objects in the system
 
+    /// Particle positions (original order) at the time the proximity structure was last built.
+    /// Only maintained when proximity structure reuse is enabled.
+    thrust::device_vector<Real4> posRadRebuildD;
+
+    /// True while the sorted order and cell lists from the last rebuild may still be reused
+    bool structureValid;
+
     void ResetCellSize(int s);
 
     /// calcHash is the wrapper function for calcHashD. calcHashD is a kernel
@@ -65,6 +72,14 @@ class ChCollisionSystemFsi : public ChFsiGeneral {
 
     /// Wrapper function for reorderDataAndFindCellStartD
     void reorderDataAndFindCellStart();
+
+    /// Re-gather the current particle data in the existing sorted order (reorderDataD only),
+    /// leaving the cell lists and the sorted index map untouched.
+    void reorderData();
+
+    /// Check whether any particle has drifted more than half the skin distance since the
+    /// proximity structure was last built.
+    bool needStructureRebuild();
 };
 
 /// @} fsi_collision
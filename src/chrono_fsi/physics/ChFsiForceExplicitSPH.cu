@@ -23,6 +23,85 @@
 namespace chrono {
 namespace fsi {
 
+//--------------------------------------------------------------------------------------------------------------------------------
+// Precision used for the per-pair interaction math in the WCSPH force kernel.
+// With CHRONO_FSI_MIXED_PRECISION, positions and distances stay in double
+// while kernel weights and pairwise force terms are evaluated in single
+// precision and accumulated with Kahan compensation; otherwise everything
+// stays in Real and the results are unchanged.
+#ifdef CHRONO_FSI_MIXED_PRECISION
+typedef float PairReal;
+typedef float3 PairReal3;
+typedef float4 PairReal4;
+#define mPR3 make_float3
+#define mPR4 make_float4
+#define TO_PAIR3(v) make_float3((float)(v).x, (float)(v).y, (float)(v).z)
+#define TO_PAIR4(v) make_float4((float)(v).x, (float)(v).y, (float)(v).z, (float)(v).w)
+#else
+typedef Real PairReal;
+typedef Real3 PairReal3;
+typedef Real4 PairReal4;
+#define mPR3 mR3
+#define mPR4 mR4
+#define TO_PAIR3(v) (v)
+#define TO_PAIR4(v) (v)
+#endif
+
+// Accumulator for pairwise sums. In mixed-precision mode the running sum is
+// kept in single precision with Kahan compensation; in the default build it
+// reduces to a plain Real sum, leaving the results bitwise unchanged.
+#ifdef CHRONO_FSI_MIXED_PRECISION
+struct PairSum {
+    float sum, c;
+    __device__ PairSum() : sum(0), c(0) {}
+    __device__ void operator+=(float v) {
+        float y = v - c;
+        float t = sum + y;
+        c = (t - sum) - y;
+        sum = t;
+    }
+    __device__ Real value() const { return (Real)sum; }
+};
+struct PairSum3 {
+    PairSum x, y, z;
+    __device__ void operator+=(float3 v) {
+        x += v.x;
+        y += v.y;
+        z += v.z;
+    }
+    __device__ Real3 value() const { return mR3(x.value(), y.value(), z.value()); }
+};
+struct PairSum4 {
+    PairSum x, y, z, w;
+    __device__ void operator+=(float4 v) {
+        x += v.x;
+        y += v.y;
+        z += v.z;
+        w += v.w;
+    }
+    __device__ Real4 value() const { return mR4(x.value(), y.value(), z.value(), w.value()); }
+};
+#else
+struct PairSum {
+    Real sum;
+    __device__ PairSum() : sum(0) {}
+    __device__ void operator+=(Real v) { sum += v; }
+    __device__ Real value() const { return sum; }
+};
+struct PairSum3 {
+    Real3 sum;
+    __device__ PairSum3() : sum(mR3(0.0)) {}
+    __device__ void operator+=(Real3 v) { sum += v; }
+    __device__ Real3 value() const { return sum; }
+};
+struct PairSum4 {
+    Real4 sum;
+    __device__ PairSum4() : sum(mR4(0.0)) {}
+    __device__ void operator+=(Real4 v) { sum += v; }
+    __device__ Real4 value() const { return sum; }
+};
+#endif
+
 //--------------------------------------------------------------------------------------------------------------------------------
 __device__ __inline__ void calc_G_Matrix(Real4* sortedPosRad,
                                          Real3* sortedVelMas,
@@ -760,49 +839,51 @@ __device__ inline Real3 CubicEigen(Real4 c1, Real4 c2, Real4 c3) {
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
-__device__ inline Real4 DifVelocityRho(float G_i[9],
-                                       Real3 dist3,
-                                       Real d,
-                                       Real4 posRadA,
-                                       Real4 posRadB,
-                                       Real3 velMasA,
-                                       Real3 velMasB,
-                                       Real4 rhoPresMuA,
-                                       Real4 rhoPresMuB,
-                                       Real multViscosity) {
+__device__ inline PairReal4 DifVelocityRho(float G_i[9],
+                                           PairReal3 dist3,
+                                           PairReal d,
+                                           PairReal4 posRadA,
+                                           PairReal4 posRadB,
+                                           PairReal3 velMasA,
+                                           PairReal3 velMasB,
+                                           PairReal4 rhoPresMuA,
+                                           PairReal4 rhoPresMuB,
+                                           PairReal multViscosity) {
     if (rhoPresMuA.w > -0.5 && rhoPresMuB.w > -0.5)
-        return mR4(0.0);
+        return mPR4(0.0);
+
+    PairReal3 gradW = GradWh(dist3, (posRadA.w + posRadB.w) * PairReal(0.5));
 
-    Real3 gradW = GradWh(dist3, (posRadA.w + posRadB.w) * 0.5);
+    PairReal mass = PairReal(paramsD.markerMass);
+    PairReal epsDis = PairReal(paramsD.epsMinMarkersDis * paramsD.HSML * paramsD.HSML);
 
     // Continuty equation
-    Real derivRho = paramsD.markerMass * dot(velMasA - velMasB, gradW);
+    PairReal derivRho = mass * dot(velMasA - velMasB, gradW);
 
     // Viscosity
-    Real rAB_Dot_GradWh = dot(dist3, gradW);
-    Real rAB_Dot_GradWh_OverDist = 
-        rAB_Dot_GradWh / (d * d + paramsD.epsMinMarkersDis * paramsD.HSML * paramsD.HSML);
-    Real3 derivV = -paramsD.markerMass * (rhoPresMuA.y / (rhoPresMuA.x * rhoPresMuA.x) + 
+    PairReal rAB_Dot_GradWh = dot(dist3, gradW);
+    PairReal rAB_Dot_GradWh_OverDist = rAB_Dot_GradWh / (d * d + epsDis);
+    PairReal rhoSum = rhoPresMuA.x + rhoPresMuB.x;
+    PairReal3 derivV = -mass * (rhoPresMuA.y / (rhoPresMuA.x * rhoPresMuA.x) +
         rhoPresMuB.y / (rhoPresMuB.x * rhoPresMuB.x)) * gradW +
-        paramsD.markerMass * (8.0f * multViscosity) * paramsD.mu0 * 
-        rAB_Dot_GradWh_OverDist * (velMasA - velMasB) / square(rhoPresMuA.x + rhoPresMuB.x);
+        mass * (8.0f * multViscosity) * PairReal(paramsD.mu0) *
+        rAB_Dot_GradWh_OverDist * (velMasA - velMasB) / (rhoSum * rhoSum);
 
     // Artificial viscosity
-    Real vAB_Dot_rAB = dot(velMasA - velMasB, dist3);
+    PairReal vAB_Dot_rAB = dot(velMasA - velMasB, dist3);
     // change to 1==1 if needs artificial viscosity
-    if ((vAB_Dot_rAB < 0.0) && (1 == 1)) {  
-        Real alpha = paramsD.Ar_vis_alpha;
-        Real c_ab = paramsD.Cs;
-        Real rho = 0.5f * (rhoPresMuA.x * rhoPresMuB.x);
-        Real nu = -alpha * paramsD.HSML * c_ab / rho;
-        Real derivM1 = -paramsD.markerMass * (nu * vAB_Dot_rAB / (d * d + 
-            paramsD.epsMinMarkersDis * paramsD.HSML * paramsD.HSML));
+    if ((vAB_Dot_rAB < 0.0) && (1 == 1)) {
+        PairReal alpha = PairReal(paramsD.Ar_vis_alpha);
+        PairReal c_ab = PairReal(paramsD.Cs);
+        PairReal rho = 0.5f * (rhoPresMuA.x * rhoPresMuB.x);
+        PairReal nu = -alpha * PairReal(paramsD.HSML) * c_ab / rho;
+        PairReal derivM1 = -mass * (nu * vAB_Dot_rAB / (d * d + epsDis));
         derivV.x += derivM1 * gradW.x;
         derivV.y += derivM1 * gradW.y;
         derivV.z += derivM1 * gradW.z;
     }
 
-    return mR4(derivV, derivRho);
+    return mPR4(derivV, derivRho);
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -914,64 +995,64 @@ __device__ inline Real4 DifVelocityRho_ElasticSPH(Real W_ini_inv,
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
-__device__ inline Real3 GradientOperator(float G_i[9],
-                                         Real3 dist3,
-                                         Real4 posRadA,
-                                         Real4 posRadB,
-                                         Real fA,
-                                         Real fB,
-                                         Real4 rhoPresMuA,
-                                         Real4 rhoPresMuB) {
-    Real3 gradW = GradWh(dist3, (posRadA.w + posRadB.w) * 0.5);
-    Real3 gradW_new;
+__device__ inline PairReal3 GradientOperator(float G_i[9],
+                                             PairReal3 dist3,
+                                             PairReal4 posRadA,
+                                             PairReal4 posRadB,
+                                             PairReal fA,
+                                             PairReal fB,
+                                             PairReal4 rhoPresMuA,
+                                             PairReal4 rhoPresMuB) {
+    PairReal3 gradW = GradWh(dist3, (posRadA.w + posRadB.w) * PairReal(0.5));
+    PairReal3 gradW_new;
     gradW_new.x = G_i[0] * gradW.x + G_i[1] * gradW.y + G_i[2] * gradW.z;
     gradW_new.y = G_i[3] * gradW.x + G_i[4] * gradW.y + G_i[5] * gradW.z;
     gradW_new.z = G_i[6] * gradW.x + G_i[7] * gradW.y + G_i[8] * gradW.z;
 
-    Real Vol = paramsD.markerMass / rhoPresMuB.x;
-    Real fji = fB - fA;
-    Real Gra_ij_x = fji * gradW_new.x * Vol;
-    Real Gra_ij_y = fji * gradW_new.y * Vol;
-    Real Gra_ij_z = fji * gradW_new.z * Vol;
+    PairReal Vol = PairReal(paramsD.markerMass) / rhoPresMuB.x;
+    PairReal fji = fB - fA;
+    PairReal Gra_ij_x = fji * gradW_new.x * Vol;
+    PairReal Gra_ij_y = fji * gradW_new.y * Vol;
+    PairReal Gra_ij_z = fji * gradW_new.z * Vol;
 
-    return mR3(Gra_ij_x, Gra_ij_y, Gra_ij_z);
+    return mPR3(Gra_ij_x, Gra_ij_y, Gra_ij_z);
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
-__device__ inline Real4 LaplacianOperator(float G_i[9],
-                                          float L_i[9],
-                                          Real3 dist3,
-                                          Real4 posRadA,
-                                          Real4 posRadB,
-                                          Real fA,
-                                          Real fB,
-                                          Real4 rhoPresMuA,
-                                          Real4 rhoPresMuB) {
-    Real3 gradW = GradWh(dist3, (posRadA.w + posRadB.w) * 0.5);
-    Real d = length(dist3);
-    Real3 eij = dist3 / d;
-
-    Real Vol = paramsD.markerMass / rhoPresMuB.x;
-    Real fij = fA - fB;
-
-    Real ex_Gwx = eij.x * gradW.x;
-    Real ex_Gwy = eij.x * gradW.y;
-    Real ex_Gwz = eij.x * gradW.z;
-    Real ey_Gwx = eij.y * gradW.x;
-    Real ey_Gwy = eij.y * gradW.y;
-    Real ey_Gwz = eij.y * gradW.z;
-    Real ez_Gwx = eij.z * gradW.x;
-    Real ez_Gwy = eij.z * gradW.y;
-    Real ez_Gwz = eij.z * gradW.z;
-
-    Real Part1 = L_i[0] * ex_Gwx + L_i[1] * ex_Gwy + L_i[2] * ex_Gwz + 
-        L_i[3] * ey_Gwx + L_i[4] * ey_Gwy + L_i[5] * ey_Gwz + 
+__device__ inline PairReal4 LaplacianOperator(float G_i[9],
+                                              float L_i[9],
+                                              PairReal3 dist3,
+                                              PairReal4 posRadA,
+                                              PairReal4 posRadB,
+                                              PairReal fA,
+                                              PairReal fB,
+                                              PairReal4 rhoPresMuA,
+                                              PairReal4 rhoPresMuB) {
+    PairReal3 gradW = GradWh(dist3, (posRadA.w + posRadB.w) * PairReal(0.5));
+    PairReal d = length(dist3);
+    PairReal3 eij = dist3 / d;
+
+    PairReal Vol = PairReal(paramsD.markerMass) / rhoPresMuB.x;
+    PairReal fij = fA - fB;
+
+    PairReal ex_Gwx = eij.x * gradW.x;
+    PairReal ex_Gwy = eij.x * gradW.y;
+    PairReal ex_Gwz = eij.x * gradW.z;
+    PairReal ey_Gwx = eij.y * gradW.x;
+    PairReal ey_Gwy = eij.y * gradW.y;
+    PairReal ey_Gwz = eij.y * gradW.z;
+    PairReal ez_Gwx = eij.z * gradW.x;
+    PairReal ez_Gwy = eij.z * gradW.y;
+    PairReal ez_Gwz = eij.z * gradW.z;
+
+    PairReal Part1 = L_i[0] * ex_Gwx + L_i[1] * ex_Gwy + L_i[2] * ex_Gwz +
+        L_i[3] * ey_Gwx + L_i[4] * ey_Gwy + L_i[5] * ey_Gwz +
         L_i[6] * ez_Gwx + L_i[7] * ez_Gwy + L_i[8] * ez_Gwz;
-    Real Part2 = fij / d * Vol;
-    Real3 Part3 = mR3(-eij.x, -eij.y, -eij.z) * Vol;
+    PairReal Part2 = fij / d * Vol;
+    PairReal3 Part3 = mPR3(-eij.x, -eij.y, -eij.z) * Vol;
 
-    return mR4(2.0 * Part1 * Part2, Part3.x * (2.0 * Part1), 
-        Part3.y * (2.0 * Part1), Part3.z * (2.0 * Part1));
+    return mPR4(PairReal(2.0) * Part1 * Part2, Part3.x * (PairReal(2.0) * Part1),
+        Part3.y * (PairReal(2.0) * Part1), Part3.z * (PairReal(2.0) * Part1));
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -984,6 +1065,7 @@ __global__ void EOS(Real4* sortedRhoPreMu, volatile bool* isErrorD) {
 
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void Navier_Stokes(uint* indexOfIndex,
+                              uint* activityIdentifierD,
                               Real4* sortedDerivVelRho,
                               Real3* sortedXSPHandShift,
                               Real4* sortedPosRad,
@@ -1000,8 +1082,13 @@ __global__ void Navier_Stokes(uint* indexOfIndex,
         return;
 
     uint index = indexOfIndex[id];
-    
-    // Do nothing for fixed wall BCE particles 
+
+    // no need to do anything if it is not an active particle
+    uint activity = activityIdentifierD[gridMarkerIndex[index]];
+    if (activity == 0)
+        return;
+
+    // Do nothing for fixed wall BCE particles
     if (sortedRhoPreMu[index].w > -0.5 && sortedRhoPreMu[index].w < 0.5) {
         sortedDerivVelRho[index] = mR4(0.0);
         return;
@@ -1010,7 +1097,7 @@ __global__ void Navier_Stokes(uint* indexOfIndex,
     Real3 posRadA = mR3(sortedPosRad[index]);
     Real3 velMasA = sortedVelMas[index];
     Real4 rhoPresMuA = sortedRhoPreMu[index];
-    Real4 derivVelRho = mR4(0.0);
+    PairSum4 derivVelRhoSum;
     Real SuppRadii = RESOLUTION_LENGTH_MULT * paramsD.HSML;
     Real SqRadii = SuppRadii * SuppRadii;
 
@@ -1048,21 +1135,27 @@ __global__ void Navier_Stokes(uint* indexOfIndex,
     Li[7] = L_i[7];
     Li[8] = L_i[8];
 
-    Real3 preGra = mR3(0.0);
-    Real3 velxGra = mR3(0.0);
-    Real3 velyGra = mR3(0.0);
-    Real3 velzGra = mR3(0.0);
-    Real4 velxLap = mR4(0.0);
-    Real4 velyLap = mR4(0.0);
-    Real4 velzLap = mR4(0.0);
+    PairSum3 preGraSum;
+    PairSum3 velxGraSum;
+    PairSum3 velyGraSum;
+    PairSum3 velzGraSum;
+    PairSum4 velxLapSum;
+    PairSum4 velyLapSum;
+    PairSum4 velzLapSum;
 
     Real vA = length(velMasA);
     Real vAdT = vA * paramsD.dT;
 
+    // Loop-invariant quantities of particle A in pairwise precision
+    PairReal4 posRadAp = TO_PAIR4(sortedPosRad[index]);
+    PairReal3 velMasAp = TO_PAIR3(velMasA);
+    PairReal4 rhoPresMuAp = TO_PAIR4(rhoPresMuA);
+
     // get address in grid
     int3 gridPos = calcGridPos(posRadA);
     Real3 inner_sum = mR3(0.0);
-    Real sum_w_i = W3h(0.0, sortedPosRad[index].w) * paramsD.volume0;
+    PairSum sum_w_iSum;
+    sum_w_iSum += PairReal(W3h(Real(0.0), sortedPosRad[index].w) * paramsD.volume0);
 
     for (int x = -1; x <= 1; x++) {
         for (int y = -1; y <= 1; y++) {
@@ -1100,33 +1193,50 @@ __global__ void Navier_Stokes(uint* indexOfIndex,
                         }
                         Real multViscosit = 1;
 
-                        derivVelRho += DifVelocityRho(Gi, dist3, d, sortedPosRad[index], sortedPosRad[j],
-                             velMasA, velMasB, rhoPresMuA, rhoPresMuB, multViscosit);
-                        preGra += GradientOperator(Gi, dist3, sortedPosRad[index], sortedPosRad[j], 
-                            -rhoPresMuA.y, rhoPresMuB.y, rhoPresMuA, rhoPresMuB);
-                        velxGra += GradientOperator(Gi, dist3, sortedPosRad[index], sortedPosRad[j], 
-                            velMasA.x, velMasB.x, rhoPresMuA, rhoPresMuB);
-                        velyGra += GradientOperator(Gi, dist3, sortedPosRad[index], sortedPosRad[j], 
-                            velMasA.y, velMasB.y, rhoPresMuA, rhoPresMuB);
-                        velzGra += GradientOperator(Gi, dist3, sortedPosRad[index], sortedPosRad[j], 
-                            velMasA.z, velMasB.z, rhoPresMuA, rhoPresMuB);
-                        velxLap += LaplacianOperator(Gi, Li, dist3, sortedPosRad[index], sortedPosRad[j], 
-                            velMasA.x, velMasB.x, rhoPresMuA, rhoPresMuB);
-                        velyLap += LaplacianOperator(Gi, Li, dist3, sortedPosRad[index], sortedPosRad[j], 
-                            velMasA.y, velMasB.y, rhoPresMuA, rhoPresMuB);
-                        velzLap += LaplacianOperator(Gi, Li, dist3, sortedPosRad[index], sortedPosRad[j], 
-                            velMasA.z, velMasB.z, rhoPresMuA, rhoPresMuB);
-
-                        if (d > paramsD.HSML * 1.0e-9) 
-                            sum_w_i = sum_w_i + W3h(d, sortedPosRad[index].w) * paramsD.volume0;
+                        // Pairwise-precision copies of the particle B quantities
+                        PairReal3 dist3p = TO_PAIR3(dist3);
+                        PairReal dp = PairReal(d);
+                        PairReal4 posRadBp = TO_PAIR4(sortedPosRad[j]);
+                        PairReal3 velMasBp = TO_PAIR3(velMasB);
+                        PairReal4 rhoPresMuBp = TO_PAIR4(rhoPresMuB);
+
+                        derivVelRhoSum += DifVelocityRho(Gi, dist3p, dp, posRadAp, posRadBp,
+                             velMasAp, velMasBp, rhoPresMuAp, rhoPresMuBp, PairReal(multViscosit));
+                        preGraSum += GradientOperator(Gi, dist3p, posRadAp, posRadBp,
+                            -rhoPresMuAp.y, rhoPresMuBp.y, rhoPresMuAp, rhoPresMuBp);
+                        velxGraSum += GradientOperator(Gi, dist3p, posRadAp, posRadBp,
+                            velMasAp.x, velMasBp.x, rhoPresMuAp, rhoPresMuBp);
+                        velyGraSum += GradientOperator(Gi, dist3p, posRadAp, posRadBp,
+                            velMasAp.y, velMasBp.y, rhoPresMuAp, rhoPresMuBp);
+                        velzGraSum += GradientOperator(Gi, dist3p, posRadAp, posRadBp,
+                            velMasAp.z, velMasBp.z, rhoPresMuAp, rhoPresMuBp);
+                        velxLapSum += LaplacianOperator(Gi, Li, dist3p, posRadAp, posRadBp,
+                            velMasAp.x, velMasBp.x, rhoPresMuAp, rhoPresMuBp);
+                        velyLapSum += LaplacianOperator(Gi, Li, dist3p, posRadAp, posRadBp,
+                            velMasAp.y, velMasBp.y, rhoPresMuAp, rhoPresMuBp);
+                        velzLapSum += LaplacianOperator(Gi, Li, dist3p, posRadAp, posRadBp,
+                            velMasAp.z, velMasBp.z, rhoPresMuAp, rhoPresMuBp);
+
+                        if (d > paramsD.HSML * 1.0e-9)
+                            sum_w_iSum += W3h(dp, posRadAp.w) * PairReal(paramsD.volume0);
                     }
                 }
             }
         }
     }
 
+    Real4 derivVelRho = derivVelRhoSum.value();
+    Real3 preGra = preGraSum.value();
+    Real3 velxGra = velxGraSum.value();
+    Real3 velyGra = velyGraSum.value();
+    Real3 velzGra = velzGraSum.value();
+    Real4 velxLap = velxLapSum.value();
+    Real4 velyLap = velyLapSum.value();
+    Real4 velzLap = velzLapSum.value();
+    Real sum_w_i = sum_w_iSum.value();
+
     Real nu = paramsD.mu0 / paramsD.rho0;
-    Real dvxdt = -preGra.x / rhoPresMuA.x + (velxLap.x + velxGra.x * velxLap.y + 
+    Real dvxdt = -preGra.x / rhoPresMuA.x + (velxLap.x + velxGra.x * velxLap.y +
         velxGra.y * velxLap.z + velxGra.z * velxLap.w) * nu;
     Real dvydt = -preGra.y / rhoPresMuA.x + (velyLap.x + velyGra.x * velyLap.y + 
         velyGra.y * velyLap.z + velyGra.z * velyLap.w) * nu;
@@ -1464,6 +1574,7 @@ __global__ void NS_SSR(uint* activityIdentifierD,
 
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void CalcVel_XSPH_D(uint* indexOfIndex,
+                               uint* activityIdentifierD,
                                Real3* vel_XSPH_Sorted_D,
                                Real4* sortedPosRad,
                                Real3* sortedVelMas,
@@ -1479,6 +1590,11 @@ __global__ void CalcVel_XSPH_D(uint* indexOfIndex,
 
     uint index = indexOfIndex[id];
 
+    // no need to do anything if it is not an active particle
+    uint activity = activityIdentifierD[gridMarkerIndex[index]];
+    if (activity == 0)
+        return;
+
     Real4 rhoPreMuA = sortedRhoPreMu[index];
     Real3 velMasA = sortedVelMas[index];
     Real SuppRadii = RESOLUTION_LENGTH_MULT * paramsD.HSML;
@@ -1703,7 +1819,8 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
 
         // execute the kernel
         Navier_Stokes<<<numBlocks1, numThreads1>>>(
-            U1CAST(indexOfIndex), mR4CAST(sortedDerivVelRho), mR3CAST(sortedXSPHandShift),
+            U1CAST(indexOfIndex), U1CAST(fsiGeneralData->activityIdentifierD),
+            mR4CAST(sortedDerivVelRho), mR3CAST(sortedXSPHandShift),
             mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
             mR4CAST(sortedSphMarkersD->rhoPresMuD), mR3CAST(bceWorker->velMas_ModifiedBCE),
             mR4CAST(bceWorker->rhoPreMu_ModifiedBCE), U1CAST(markersProximityD->gridMarkerIndexD),
@@ -1776,7 +1893,8 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
 
         // Execute the kernel
         CalcVel_XSPH_D<<<numBlocks1, numThreads1>>>(
-            U1CAST(indexOfIndex), mR3CAST(vel_XSPH_Sorted_D),
+            U1CAST(indexOfIndex), U1CAST(fsiGeneralData->activityIdentifierD),
+            mR3CAST(vel_XSPH_Sorted_D),
             mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
             mR4CAST(sortedSphMarkersD->rhoPresMuD), mR3CAST(sortedXSPHandShift),
             U1CAST(markersProximityD->gridMarkerIndexD), U1CAST(markersProximityD->cellStartD),
@@ -18,6 +18,7 @@
 #include "chrono_fsi/physics/ChFsiInterface.h"
 #include "chrono_fsi/utils/ChUtilsDevice.cuh"
 #include "chrono_fsi/utils/ChUtilsTypeConvert.h"
+#include "chrono/core/ChMathematics.h"
 #include "chrono/fea/ChElementCableANCF.h"
 #include "chrono/fea/ChElementShellANCF_3423.h"
 #include "chrono/fea/ChMesh.h"
@@ -27,21 +28,107 @@ namespace chrono {
 namespace fsi {
 
 ChFsiInterface::ChFsiInterface(ChSystemFsi_impl& fsi, std::shared_ptr<SimParams> params)
-    : m_sysFSI(fsi), m_paramsH(params), m_verbose(true) {}
+    : m_sysFSI(fsi),
+      m_paramsH(params),
+      m_verbose(true),
+      m_use_aitken(false),
+      m_omega_init(1.0),
+      m_omega_min(0.05),
+      m_omega_max(1.0),
+      m_omega_rigid(1.0),
+      m_omega_flex(1.0),
+      m_rigid_forces_H(nullptr),
+      m_rigid_torques_H(nullptr),
+      m_flex_forces_H(nullptr),
+      m_num_rigids_pinned(0),
+      m_num_nodes_pinned(0) {}
 
-ChFsiInterface::~ChFsiInterface() {}
+ChFsiInterface::~ChFsiInterface() {
+    if (m_rigid_forces_H)
+        cudaFreeHost(m_rigid_forces_H);
+    if (m_rigid_torques_H)
+        cudaFreeHost(m_rigid_torques_H);
+    if (m_flex_forces_H)
+        cudaFreeHost(m_flex_forces_H);
+}
+
+void ChFsiInterface::EnableAitkenRelaxation(bool val, double omega_init, double omega_min, double omega_max) {
+    m_use_aitken = val;
+    m_omega_init = omega_init;
+    m_omega_min = omega_min;
+    m_omega_max = omega_max;
+
+    // Force reinitialization of the relaxation history at the next exchange
+    m_rigid_force_applied.clear();
+    m_flex_force_applied.clear();
+}
 
 //-----------------------Chrono rigid body Specifics----------------------------------
 
 void ChFsiInterface::Add_Rigid_ForceTorques_To_ChSystem() {
     size_t numRigids = m_fsi_bodies.size();
+    if (numRigids == 0)
+        return;
 
-    thrust::host_vector<Real3> forcesH = m_sysFSI.fsiGeneralData->rigid_FSI_ForcesD;
-    thrust::host_vector<Real3> torquesH = m_sysFSI.fsiGeneralData->rigid_FSI_TorquesD;
+    // (Re)allocate the pinned staging buffers, so that the device-to-host copies below
+    // can be issued back to back with a single synchronization point
+    if (m_num_rigids_pinned < numRigids) {
+        if (m_rigid_forces_H) {
+            cudaFreeHost(m_rigid_forces_H);
+            cudaFreeHost(m_rigid_torques_H);
+        }
+        cudaMallocHost((void**)&m_rigid_forces_H, numRigids * sizeof(Real3));
+        cudaMallocHost((void**)&m_rigid_torques_H, numRigids * sizeof(Real3));
+        m_num_rigids_pinned = numRigids;
+    }
+
+    cudaMemcpyAsync(m_rigid_forces_H, mR3CAST(m_sysFSI.fsiGeneralData->rigid_FSI_ForcesD),
+                    numRigids * sizeof(Real3), cudaMemcpyDeviceToHost, 0);
+    cudaMemcpyAsync(m_rigid_torques_H, mR3CAST(m_sysFSI.fsiGeneralData->rigid_FSI_TorquesD),
+                    numRigids * sizeof(Real3), cudaMemcpyDeviceToHost, 0);
+    cudaStreamSynchronize(0);
+
+    if (m_use_aitken) {
+        // (Re)initialize the relaxation history if the number of FSI bodies changed
+        bool first = (m_rigid_force_applied.size() != numRigids);
+        if (first) {
+            m_rigid_force_applied.assign(numRigids, VNULL);
+            m_rigid_torque_applied.assign(numRigids, VNULL);
+            m_rigid_force_res.assign(numRigids, VNULL);
+            m_rigid_torque_res.assign(numRigids, VNULL);
+            m_omega_rigid = m_omega_init;
+        }
+
+        // Aitken Delta^2 update of the relaxation factor, from the previous and current exchange residuals
+        // stacked over the force and torque components of all FSI bodies
+        double num = 0;
+        double den = 0;
+        for (size_t i = 0; i < numRigids; i++) {
+            ChVector<> rf = utils::ToChVector(m_rigid_forces_H[i]) - m_rigid_force_applied[i];
+            ChVector<> rt = utils::ToChVector(m_rigid_torques_H[i]) - m_rigid_torque_applied[i];
+            if (!first) {
+                ChVector<> df = rf - m_rigid_force_res[i];
+                ChVector<> dt = rt - m_rigid_torque_res[i];
+                num += Vdot(m_rigid_force_res[i], df) + Vdot(m_rigid_torque_res[i], dt);
+                den += df.Length2() + dt.Length2();
+            }
+            m_rigid_force_res[i] = rf;
+            m_rigid_torque_res[i] = rt;
+        }
+        if (!first && den > 0)
+            m_omega_rigid = ChClamp(-m_omega_rigid * num / den, m_omega_min, m_omega_max);
+    }
 
     for (size_t i = 0; i < numRigids; i++) {
-        ChVector<> mforce = utils::ToChVector(forcesH[i]);
-        ChVector<> mtorque = utils::ToChVector(torquesH[i]);
+        ChVector<> mforce = utils::ToChVector(m_rigid_forces_H[i]);
+        ChVector<> mtorque = utils::ToChVector(m_rigid_torques_H[i]);
+
+        if (m_use_aitken) {
+            m_rigid_force_applied[i] += m_omega_rigid * m_rigid_force_res[i];
+            m_rigid_torque_applied[i] += m_omega_rigid * m_rigid_torque_res[i];
+            mforce = m_rigid_force_applied[i];
+            mtorque = m_rigid_torque_applied[i];
+        }
 
         std::shared_ptr<ChBody> body = m_fsi_bodies[i];
 
@@ -72,11 +159,51 @@ void ChFsiInterface::Copy_FsiBodies_ChSystem_to_FsiSystem(std::shared_ptr<FsiBod
 
 void ChFsiInterface::Add_Flex_Forces_To_ChSystem() {
     size_t num_nodes = m_fsi_nodes.size();
+    if (num_nodes == 0)
+        return;
+
+    // (Re)allocate the pinned staging buffer used for the nodal force transfer
+    if (m_num_nodes_pinned < num_nodes) {
+        if (m_flex_forces_H)
+            cudaFreeHost(m_flex_forces_H);
+        cudaMallocHost((void**)&m_flex_forces_H, num_nodes * sizeof(Real3));
+        m_num_nodes_pinned = num_nodes;
+    }
+
+    cudaMemcpyAsync(m_flex_forces_H, mR3CAST(m_sysFSI.fsiGeneralData->Flex_FSI_ForcesD),
+                    num_nodes * sizeof(Real3), cudaMemcpyDeviceToHost, 0);
+    cudaStreamSynchronize(0);
 
-    thrust::host_vector<Real3> forcesH = m_sysFSI.fsiGeneralData->Flex_FSI_ForcesD;
+    if (m_use_aitken) {
+        // Same Aitken scheme as for the rigid interface, over the flexible nodal forces
+        bool first = (m_flex_force_applied.size() != num_nodes);
+        if (first) {
+            m_flex_force_applied.assign(num_nodes, VNULL);
+            m_flex_force_res.assign(num_nodes, VNULL);
+            m_omega_flex = m_omega_init;
+        }
+
+        double num = 0;
+        double den = 0;
+        for (size_t i = 0; i < num_nodes; i++) {
+            ChVector<> rf = utils::ToChVector(m_flex_forces_H[i]) - m_flex_force_applied[i];
+            if (!first) {
+                ChVector<> df = rf - m_flex_force_res[i];
+                num += Vdot(m_flex_force_res[i], df);
+                den += df.Length2();
+            }
+            m_flex_force_res[i] = rf;
+        }
+        if (!first && den > 0)
+            m_omega_flex = ChClamp(-m_omega_flex * num / den, m_omega_min, m_omega_max);
+    }
 
     for (size_t i = 0; i < num_nodes; i++) {
-        ChVector<> force = utils::ToChVector(forcesH[i]);
+        ChVector<> force = utils::ToChVector(m_flex_forces_H[i]);
+        if (m_use_aitken) {
+            m_flex_force_applied[i] += m_omega_flex * m_flex_force_res[i];
+            force = m_flex_force_applied[i];
+        }
         auto node = std::dynamic_pointer_cast<fea::ChNodeFEAxyzD>(m_fsi_mesh->GetNode((unsigned int)i));
         node->SetForce(force);
     }
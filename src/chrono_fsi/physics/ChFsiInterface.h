@@ -48,6 +48,16 @@ class ChFsiInterface : public ChFsiGeneral {
     /// Destructor of the FSI interface class.
     ~ChFsiInterface();
 
+    /// Enable Aitken adaptive relaxation of the exchanged interface forces (default: disabled).
+    /// In the explicit partitioned coupling scheme, the raw BCE forces are applied to the solid as-is; for light
+    /// floating bodies the added-mass effect then makes the exchanged forces oscillate between steps, which must be
+    /// suppressed by taking many small substeps. When enabled, the rigid force/torque and flexible nodal force
+    /// vectors are under-relaxed with a dynamic factor updated by Aitken's Delta^2 formula from two consecutive
+    /// exchange residuals, which adapts the relaxation to the actual interface stiffness and allows larger coupling
+    /// steps. The factor starts at omega_init at (re)initialization and is clamped to [omega_min, omega_max]
+    /// thereafter; separate factors are maintained for the rigid and flexible interfaces.
+    void EnableAitkenRelaxation(bool val, double omega_init = 1.0, double omega_min = 0.05, double omega_max = 1.0);
+
     /// Read the surface-integrated pressure and viscous forces form the fluid/granular dynamics system,
     /// and add these forces and torques as external forces to the ChSystem rigid bodies.
     void Add_Rigid_ForceTorques_To_ChSystem();
@@ -76,6 +86,26 @@ class ChFsiInterface : public ChFsiGeneral {
     std::vector<std::shared_ptr<ChBody>> m_fsi_bodies;             ///< bodies handled by the FSI system
     std::vector<std::shared_ptr<fea::ChNodeFEAxyzD>> m_fsi_nodes;  ///< FEA nodes available in FSI system
 
+    bool m_use_aitken;    ///< enable Aitken adaptive relaxation of the exchanged forces
+    double m_omega_init;  ///< initial relaxation factor
+    double m_omega_min;   ///< lower bound on the relaxation factor
+    double m_omega_max;   ///< upper bound on the relaxation factor
+    double m_omega_rigid;  ///< current relaxation factor for the rigid interface
+    double m_omega_flex;   ///< current relaxation factor for the flexible interface
+
+    std::vector<ChVector<>> m_rigid_force_applied;   ///< last relaxed rigid forces applied to the MBS
+    std::vector<ChVector<>> m_rigid_torque_applied;  ///< last relaxed rigid torques applied to the MBS
+    std::vector<ChVector<>> m_rigid_force_res;       ///< last rigid force exchange residuals
+    std::vector<ChVector<>> m_rigid_torque_res;      ///< last rigid torque exchange residuals
+    std::vector<ChVector<>> m_flex_force_applied;    ///< last relaxed nodal forces applied to the FEA mesh
+    std::vector<ChVector<>> m_flex_force_res;        ///< last nodal force exchange residuals
+
+    Real3* m_rigid_forces_H;     ///< pinned staging buffer for rigid BCE forces
+    Real3* m_rigid_torques_H;    ///< pinned staging buffer for rigid BCE torques
+    Real3* m_flex_forces_H;      ///< pinned staging buffer for flexible nodal forces
+    size_t m_num_rigids_pinned;  ///< capacity of the rigid staging buffers
+    size_t m_num_nodes_pinned;   ///< capacity of the flexible staging buffer
+
     friend class ChSystemFsi;
 };
 
@@ -49,6 +49,9 @@ struct SimParams {
     int3 gridSize;        ///< dx, dy, dz distances between particle centers.
     Real3 worldOrigin;    ///< Origin point.
     Real3 cellSize;       ///< Size of the neighbor particle searching cell.
+    bool use_Verlet_prox;  ///< If true, reuse the proximity structure across substeps until particles drift more than
+                           ///< half the skin distance; otherwise rebuild it every substep. Default value = false.
+    Real prox_skin;        ///< Skin distance for proximity structure reuse (0: use half the kernel length h).
     uint numBodies;       ///< Number of FSI bodies.
     Real3 boxDims;        ///< Dimensions of the domain. How big is the box that the domain is in.
     Real HSML;            ///< Interaction Radius (or h)
@@ -103,6 +103,39 @@ __device__ inline Real3 GradWh_Spline(Real3 d, Real h) {  // d is positive. r is
     bool less2 = (q < 2);
     return (less1 * (3 * q - 4.0f) + less2 * (!less1) * (-q + 4.0f - 4.0f / q)) * .75f * INVPI * quintic(invh) * d;
 }
+
+#if defined(CHRONO_FSI_MIXED_PRECISION) && defined(CHRONO_FSI_USE_DOUBLE)
+//--------------------------------------------------------------------------------------------------------------------------------
+// Single precision overload of the cubic spline kernel, selected by the
+// mixed-precision pairwise force path (see ChFsiForceExplicitSPH.cu)
+__device__ inline float W3h_Spline(float d, float h) {
+    float invh = (float)paramsD.INVHSML;
+    float q = fabsf(d) * invh;
+    if (q < 1) {
+        float q2 = 2.0f - q;
+        float q1 = 1.0f - q;
+        return (0.25f * (INVPI * invh * invh * invh) * (q2 * q2 * q2 - 4.0f * q1 * q1 * q1));
+    }
+    if (q < 2) {
+        float q2 = 2.0f - q;
+        return (0.25f * (INVPI * invh * invh * invh) * q2 * q2 * q2);
+    }
+    return 0;
+}
+//--------------------------------------------------------------------------------------------------------------------------------
+// Single precision overload of the cubic spline kernel gradient, selected by
+// the mixed-precision pairwise force path (see ChFsiForceExplicitSPH.cu)
+__device__ inline float3 GradWh_Spline(float3 d, float h) {
+    float invh = (float)paramsD.INVHSML;
+    float q = length(d) * invh;
+    if (fabsf(q) < EPSILON)
+        return make_float3(0.0f);
+    bool less1 = (q < 1);
+    bool less2 = (q < 2);
+    float invh5 = invh * invh * invh * invh * invh;
+    return (less1 * (3 * q - 4.0f) + less2 * (!less1) * (-q + 4.0f - 4.0f / q)) * .75f * INVPI * invh5 * d;
+}
+#endif
 //--------------------------------------------------------------------------------------------------------------------------------
 // Gradient of Johnson kernel 1996b
 __device__ inline Real3 GradWh_High(Real3 d, Real h) {  // d is positive. r is the sph kernel length (i.e. h
@@ -12,12 +12,31 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
+#include <cuda_runtime.h>
+
 #include "chrono/physics/ChSystemSMC.h"
 #include "chrono_fsi/visualization/ChFsiVisualization.h"
+#include "chrono_fsi/physics/ChSystemFsi_impl.cuh"
 
 namespace chrono {
 namespace fsi {
 
+/// Double-buffered snapshot state for asynchronous marker position collection.
+struct ChFsiVisualization::SnapshotBuffers {
+    bool async = false;                        ///< asynchronous collection enabled?
+    int interval = 1;                          ///< number of Render() calls between snapshot requests
+    int countdown = 0;                         ///< calls left until the next snapshot request
+    size_t count = 0;                          ///< number of markers per snapshot
+    cudaStream_t stream = nullptr;             ///< dedicated copy stream
+    Real4* buffer[2] = {nullptr, nullptr};     ///< pinned host position buffers
+    cudaEvent_t done[2] = {nullptr, nullptr};  ///< completion event for each buffer
+    int filling = -1;                          ///< buffer with a copy in flight (-1 if none)
+    int complete = -1;                         ///< most recently completed buffer (-1 if none)
+    thrust::host_vector<Real4> sync_buffer;    ///< destination for synchronous collection
+};
+
 ChFsiVisualization::ChFsiVisualization(ChSystemFsi* sysFSI)
     : m_systemFSI(sysFSI),
       m_user_system(nullptr),
@@ -30,12 +49,66 @@ ChFsiVisualization::ChFsiVisualization(ChSystemFsi* sysFSI)
       m_rigid_bce_color(ChColor(0.10f, 0.60f, 0.30f)),
       m_flex_bce_color(ChColor(0.40f, 0.10f, 0.65f)) {
     m_system = new ChSystemSMC();
+    m_snapshots = new SnapshotBuffers;
 }
 
 ChFsiVisualization::~ChFsiVisualization() {
+    if (m_snapshots->stream) {
+        cudaStreamSynchronize(m_snapshots->stream);
+        cudaStreamDestroy(m_snapshots->stream);
+        for (int i = 0; i < 2; i++) {
+            cudaFreeHost(m_snapshots->buffer[i]);
+            cudaEventDestroy(m_snapshots->done[i]);
+        }
+    }
+    delete m_snapshots;
     delete m_system;
 }
 
+void ChFsiVisualization::EnableAsyncSnapshots(int interval) {
+    m_snapshots->async = true;
+    m_snapshots->interval = std::max(1, interval);
+}
+
+const Real4* ChFsiVisualization::GetMarkerPositions() {
+    const auto& posRadD = m_systemFSI->m_sysFSI->sphMarkersD2->posRadD;
+
+    if (!m_snapshots->async) {
+        // Synchronous device-to-host copy of the current positions
+        m_snapshots->sync_buffer = posRadD;
+        return thrust::raw_pointer_cast(m_snapshots->sync_buffer.data());
+    }
+
+    auto& snap = *m_snapshots;
+
+    if (!snap.stream) {
+        snap.count = posRadD.size();
+        cudaStreamCreateWithFlags(&snap.stream, cudaStreamNonBlocking);
+        for (int i = 0; i < 2; i++) {
+            cudaMallocHost((void**)&snap.buffer[i], snap.count * sizeof(Real4));
+            cudaEventCreateWithFlags(&snap.done[i], cudaEventDisableTiming);
+        }
+    }
+
+    // Retire the in-flight snapshot if its copy has completed
+    if (snap.filling >= 0 && cudaEventQuery(snap.done[snap.filling]) == cudaSuccess) {
+        snap.complete = snap.filling;
+        snap.filling = -1;
+    }
+
+    // Request a new snapshot at the decimated rate, into the buffer not being rendered from
+    if (snap.filling < 0 && --snap.countdown <= 0) {
+        int target = (snap.complete == 0) ? 1 : 0;
+        cudaMemcpyAsync(snap.buffer[target], thrust::raw_pointer_cast(posRadD.data()), snap.count * sizeof(Real4),
+                        cudaMemcpyDeviceToHost, snap.stream);
+        cudaEventRecord(snap.done[target], snap.stream);
+        snap.filling = target;
+        snap.countdown = snap.interval;
+    }
+
+    return (snap.complete >= 0) ? snap.buffer[snap.complete] : nullptr;
+}
+
 void ChFsiVisualization::SetSize(int width, int height) {}
 
 void ChFsiVisualization::SetTitle(const std::string& title) {}
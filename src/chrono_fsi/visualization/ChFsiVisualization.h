@@ -32,7 +32,8 @@ namespace fsi {
 
 /// Run-time visualization support for Chrono::FSI systems.
 /// Note that using run-time visualization for a Chrono::FSI system incurs the penalty of collecting positions of all
-/// particles every time the Render() function is invoked.
+/// particles every time the Render() function is invoked. This cost can be largely hidden by enabling asynchronous
+/// snapshots (see EnableAsyncSnapshots).
 class CH_FSI_API ChFsiVisualization {
   public:
     /// Rendering mode for particles and mesh objects.
@@ -110,6 +111,13 @@ class CH_FSI_API ChFsiVisualization {
     /// body before a call to Render().
     void AddProxyBody(std::shared_ptr<ChBody> body);
 
+    /// Enable asynchronous, double-buffered collection of marker positions (default: disabled).
+    /// When enabled, Render() enqueues the device-to-host copy of the marker positions on a dedicated CUDA stream,
+    /// where it overlaps subsequent simulation work instead of stalling it, and renders from the most recent
+    /// completed snapshot. A new snapshot is requested only every 'interval'-th call to Render(); frames in between
+    /// re-render the last snapshot.
+    void EnableAsyncSnapshots(int interval = 1);
+
     /// Initialize the run-time visualization system.
     virtual void Initialize();
 
@@ -124,6 +132,14 @@ class CH_FSI_API ChFsiVisualization {
     ChSystem* GetSystem() const { return m_system; }
 
   protected:
+    /// Collect the marker positions to render from.
+    /// With asynchronous snapshots enabled, this requests a new snapshot at the decimated rate and returns the most
+    /// recent completed one (null until the first snapshot completes); otherwise it performs a synchronous
+    /// device-to-host copy of the current positions.
+    const Real4* GetMarkerPositions();
+
+    struct SnapshotBuffers;
+
     ChSystemFsi* m_systemFSI;  ///< associated Chrono::FSI system
     ChSystem* m_system;        ///< internal Chrono system (holds proxies)
     ChSystem* m_user_system;   ///< optional user-provided system
@@ -144,6 +160,8 @@ class CH_FSI_API ChFsiVisualization {
     ChColor m_flex_bce_color;   ///< color for BCE markers on flex bodies
 
     std::shared_ptr<ChParticleCloud::ColorCallback> m_color_fun;  ///< dynamic color functor for SPH particles
+
+    SnapshotBuffers* m_snapshots;  ///< state of the (possibly asynchronous) marker position collection
 };
 
 /// @} fsi_utils
@@ -193,8 +193,13 @@ bool ChFsiVisualizationVSG::Render() {
     m_system->SetRTF(m_systemFSI->GetRTF());
 
     if (m_vsys->Run()) {
-        // Copy SPH particle positions from device to host
-        thrust::host_vector<Real4> posH = m_systemFSI->m_sysFSI->sphMarkersD2->posRadD;
+        // Collect SPH particle positions (device to host)
+        const Real4* posH = GetMarkerPositions();
+        if (!posH) {
+            // No complete snapshot available yet; re-render the previous state
+            m_vsys->Render();
+            return true;
+        }
 
         // List of proxy bodies
         const auto& blist = m_system->Get_bodylist();
@@ -167,6 +167,23 @@ void ChSystemGpu_impl::resetSphereAccelerations() {
     }
 }
 
+// Zero the force-field grid accumulators and recompute the SU grid parameters from the user-unit specification
+// (the big domain frame can move between steps)
+void ChSystemGpu_impl::resetForceFieldGrid() {
+    double cell_X_UU = (forcefield_max_UU.x - forcefield_min_UU.x) / gran_params->forcefield_cells_X;
+    double cell_Y_UU = (forcefield_max_UU.y - forcefield_min_UU.y) / gran_params->forcefield_cells_Y;
+    double cell_Z_UU = (forcefield_max_UU.z - forcefield_min_UU.z) / gran_params->forcefield_cells_Z;
+
+    gran_params->forcefield_origin_X = (int64_t)std::llround(forcefield_min_UU.x / LENGTH_SU2UU);
+    gran_params->forcefield_origin_Y = (int64_t)std::llround(forcefield_min_UU.y / LENGTH_SU2UU);
+    gran_params->forcefield_origin_Z = (int64_t)std::llround(forcefield_min_UU.z / LENGTH_SU2UU);
+    gran_params->forcefield_inv_cell_X = LENGTH_SU2UU / cell_X_UU;
+    gran_params->forcefield_inv_cell_Y = LENGTH_SU2UU / cell_Y_UU;
+    gran_params->forcefield_inv_cell_Z = LENGTH_SU2UU / cell_Z_UU;
+
+    gpuErrchk(cudaMemset(forcefield_grid.data(), 0, forcefield_grid.size() * sizeof(float3)));
+}
+
 __global__ void compute_absv(const unsigned int nSpheres,
                              const float* velX,
                              const float* velY,
@@ -585,7 +602,17 @@ __host__ void ChSystemGpu_impl::runSphereBroadphase() {
     // Beginning of the last stage of computation in this function: assembling the big composite array.
     // num_entries: total number of sphere entries to record in the big fat composite array
     unsigned int num_entries = out_ptr[nSDs - 1] + in_ptr[nSDs - 1];
+    // The composite adjacency array is sized exactly from the prefix-sum result. Release its storage when the
+    // needed size drops below half the held capacity, so a transient packing spike does not permanently hold
+    // device memory that could go to more particles.
+    size_t composite_old_bytes = spheres_in_SD_composite.capacity() * sizeof(unsigned int);
+    if (spheres_in_SD_composite.capacity() > 2 * (size_t)num_entries) {
+        std::vector<unsigned int, cudallocator<unsigned int>> composite_tmp;
+        spheres_in_SD_composite.swap(composite_tmp);
+    }
     spheres_in_SD_composite.resize(num_entries, NULL_CHGPU_ID);
+    // keep the byte accounting in sync (unsigned wrap-around makes this correct for shrinks as well)
+    gran_approx_bytes_used += spheres_in_SD_composite.capacity() * sizeof(unsigned int) - composite_old_bytes;
     sphere_data->spheres_in_SD_composite = spheres_in_SD_composite.data();
 
     // Copy the offesets in the scratch pad; the subsequent kernel call would step on the outcome of the prefix scan
@@ -645,75 +672,271 @@ __host__ void ChSystemGpu_impl::updateBCPositions() {
     }
 }
 
-__host__ double ChSystemGpu_impl::AdvanceSimulation(float duration) {
+__host__ void ChSystemGpu_impl::launchStepKernels(cudaStream_t stream) {
     // Figure our the number of blocks that need to be launched to cover the box
     unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
-    // Settling simulation loop.
-    float duration_SU = (float)(duration / TIME_SU2UU);
-    unsigned int nsteps = (unsigned int)std::round(duration_SU / stepSize_SU);
-    METRICS_PRINTF("advancing by %f at timestep %f, %u timesteps at approx user timestep %f\n", duration_SU,
-                   stepSize_SU, nsteps, duration / nsteps);
-    float time_elapsed_SU = 0;  // time elapsed in this advance call
 
-    packSphereDataPointers();
+    if (gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        // Compute sphere-sphere forces
+        computeSphereForces_frictionless_matBased<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD, 0, stream>>>(
+            sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
+            (unsigned int)BC_params_list_SU.size());
+    } else if (gran_params->friction_mode == CHGPU_FRICTION_MODE::SINGLE_STEP ||
+               gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP) {
+        // figure out who is contacting
+        determineContactPairs<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD, 0, stream>>>(sphere_data, gran_params);
+
+        if (gran_params->use_mat_based == true) {
+            computeSphereContactForces_matBased<<<nBlocks, CUDA_THREADS_PER_BLOCK, 0, stream>>>(
+                sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
+                (unsigned int)BC_params_list_SU.size(), nSpheres);
 
-    // Run the simulation, there are aggressive synchronizations because we want to have no race conditions
-    for (unsigned int n = 0; n < nsteps; n++) {
-        updateBCPositions();
-        runSphereBroadphase();
-        resetSphereAccelerations();
-        resetBCForces();
+        } else {
+            computeSphereContactForces<<<nBlocks, CUDA_THREADS_PER_BLOCK, 0, stream>>>(
+                sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
+                (unsigned int)BC_params_list_SU.size(), nSpheres);
+        }
+    }
 
-        METRICS_PRINTF("Starting computeSphereForces!\n");
+    if (gran_params->forcefield_enabled) {
+        accumulateForceFieldGrid<<<nBlocks, CUDA_THREADS_PER_BLOCK, 0, stream>>>(sphere_data, nSpheres, gran_params);
+    }
 
-        if (gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS) {
-            // Compute sphere-sphere forces
-            computeSphereForces_frictionless_matBased<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD>>>(
-                sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
-                (unsigned int)BC_params_list_SU.size());
-            gpuErrchk(cudaPeekAtLastError());
-            gpuErrchk(cudaDeviceSynchronize());
-        } else if (gran_params->friction_mode == CHGPU_FRICTION_MODE::SINGLE_STEP ||
-                   gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP) {
-            // figure out who is contacting
-            determineContactPairs<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD>>>(sphere_data, gran_params);
+    integrateSpheres<<<nBlocks, CUDA_THREADS_PER_BLOCK, 0, stream>>>(stepSize_SU, sphere_data, nSpheres, gran_params);
+
+    if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        const unsigned int nThreadsUpdateHist = 2 * CUDA_THREADS_PER_BLOCK;
+        unsigned int fricMapSize = nSpheres * MAX_SPHERES_TOUCHED_BY_SPHERE;
+        unsigned int nBlocksFricHistoryPostProcess = (fricMapSize + nThreadsUpdateHist - 1) / nThreadsUpdateHist;
+
+        updateFrictionData<<<nBlocksFricHistoryPostProcess, nThreadsUpdateHist, 0, stream>>>(fricMapSize, sphere_data,
+                                                                                            gran_params);
+
+        updateAngVels<<<nBlocks, CUDA_THREADS_PER_BLOCK, 0, stream>>>(stepSize_SU, sphere_data, nSpheres, gran_params);
+    }
+}
+
+__host__ void ChSystemGpu_impl::setupMultiGpu() {
+    if (multigpu_peer_enabled) {
+        return;
+    }
+
+    int home_device;
+    gpuErrchk(cudaGetDevice(&home_device));
+
+    // enable peer access between every pair of devices, so that unified-memory pages owned by
+    // one device can be read (and atomically updated, over NVLink) by the kernels of another
+    for (size_t i = 0; i < multigpu_devices.size(); i++) {
+        gpuErrchk(cudaSetDevice(multigpu_devices[i]));
+        for (size_t j = 0; j < multigpu_devices.size(); j++) {
+            if (i == j) {
+                continue;
+            }
+            int can_access = 0;
+            gpuErrchk(cudaDeviceCanAccessPeer(&can_access, multigpu_devices[i], multigpu_devices[j]));
+            if (can_access) {
+                cudaError_t err = cudaDeviceEnablePeerAccess(multigpu_devices[j], 0);
+                if (err != cudaSuccess && err != cudaErrorPeerAccessAlreadyEnabled) {
+                    gpuErrchk(err);
+                }
+                cudaGetLastError();  // clear a possible cudaErrorPeerAccessAlreadyEnabled
+            }
+        }
+    }
+
+    gpuErrchk(cudaSetDevice(home_device));
+    multigpu_peer_enabled = true;
+}
+
+__host__ void ChSystemGpu_impl::launchStepKernelsMultiGpu() {
+    setupMultiGpu();
+
+    int home_device;
+    gpuErrchk(cudaGetDevice(&home_device));
+
+    const unsigned int ndev = (unsigned int)multigpu_devices.size();
+
+    // Each device gets a contiguous slab of the sphere index range, aligned to the block size so
+    // the launches of neighboring devices never overlap: a slab of sphere_chunk indices is covered
+    // by exactly sphere_chunk / CUDA_THREADS_PER_BLOCK blocks, and the usual mySphereID < nSpheres
+    // guard trims the final slab. After defragmentation sphere order follows SD order, so this is a
+    // slab decomposition of the SD grid in all but name.
+    unsigned int sphere_chunk = (nSpheres + ndev - 1) / ndev;
+    sphere_chunk = ((sphere_chunk + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK) * CUDA_THREADS_PER_BLOCK;
+
+    // Every phase must complete on all devices before the next phase may read its output
+    // (contact maps and halo accelerations cross slab boundaries)
+    auto syncAllDevices = [&]() {
+        for (unsigned int d = 0; d < ndev; d++) {
+            gpuErrchk(cudaSetDevice(multigpu_devices[d]));
             gpuErrchk(cudaPeekAtLastError());
             gpuErrchk(cudaDeviceSynchronize());
+        }
+    };
+
+    // Contact detection / frictionless forces, over SD slabs
+    for (unsigned int d = 0; d < ndev; d++) {
+        unsigned int sd_lo = (unsigned int)(((uint64_t)nSDs * d) / ndev);
+        unsigned int sd_hi = (unsigned int)(((uint64_t)nSDs * (d + 1)) / ndev);
+        if (sd_hi == sd_lo) {
+            continue;
+        }
+        gpuErrchk(cudaSetDevice(multigpu_devices[d]));
+        if (gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS) {
+            computeSphereForces_frictionless_matBased<<<sd_hi - sd_lo, MAX_COUNT_OF_SPHERES_PER_SD>>>(
+                sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
+                (unsigned int)BC_params_list_SU.size(), sd_lo);
+        } else {
+            determineContactPairs<<<sd_hi - sd_lo, MAX_COUNT_OF_SPHERES_PER_SD>>>(sphere_data, gran_params, sd_lo);
+        }
+    }
+    syncAllDevices();
+
+    unsigned int nBlocksPerSlab = sphere_chunk / CUDA_THREADS_PER_BLOCK;
 
+    // Contact force computation, over sphere slabs (owner-computes, so writes are disjoint)
+    if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        for (unsigned int d = 0; d < ndev; d++) {
+            unsigned int sp_lo = d * sphere_chunk;
+            if (sp_lo >= nSpheres) {
+                break;
+            }
+            gpuErrchk(cudaSetDevice(multigpu_devices[d]));
             if (gran_params->use_mat_based == true) {
-                computeSphereContactForces_matBased<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(
+                computeSphereContactForces_matBased<<<nBlocksPerSlab, CUDA_THREADS_PER_BLOCK>>>(
                     sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
-                    (unsigned int)BC_params_list_SU.size(), nSpheres);
-
+                    (unsigned int)BC_params_list_SU.size(), nSpheres, sp_lo);
             } else {
-                computeSphereContactForces<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(
+                computeSphereContactForces<<<nBlocksPerSlab, CUDA_THREADS_PER_BLOCK>>>(
                     sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
-                    (unsigned int)BC_params_list_SU.size(), nSpheres);
+                    (unsigned int)BC_params_list_SU.size(), nSpheres, sp_lo);
             }
+        }
+        syncAllDevices();
+    }
 
-            gpuErrchk(cudaPeekAtLastError());
-            gpuErrchk(cudaDeviceSynchronize());
+    // Force-field accumulation, over sphere slabs (each device covers the same spheres it integrates,
+    // so per-device stream ordering keeps the accumulation ahead of the position update)
+    if (gran_params->forcefield_enabled) {
+        for (unsigned int d = 0; d < ndev; d++) {
+            unsigned int sp_lo = d * sphere_chunk;
+            if (sp_lo >= nSpheres) {
+                break;
+            }
+            gpuErrchk(cudaSetDevice(multigpu_devices[d]));
+            accumulateForceFieldGrid<<<nBlocksPerSlab, CUDA_THREADS_PER_BLOCK>>>(sphere_data, nSpheres, gran_params,
+                                                                                 sp_lo);
         }
+    }
 
-        METRICS_PRINTF("Starting integrateSpheres!\n");
-        integrateSpheres<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(stepSize_SU, sphere_data, nSpheres, gran_params);
-        gpuErrchk(cudaPeekAtLastError());
-        gpuErrchk(cudaDeviceSynchronize());
+    // Integration, over sphere slabs
+    for (unsigned int d = 0; d < ndev; d++) {
+        unsigned int sp_lo = d * sphere_chunk;
+        if (sp_lo >= nSpheres) {
+            break;
+        }
+        gpuErrchk(cudaSetDevice(multigpu_devices[d]));
+        integrateSpheres<<<nBlocksPerSlab, CUDA_THREADS_PER_BLOCK>>>(stepSize_SU, sphere_data, nSpheres, gran_params,
+                                                                    sp_lo);
+    }
+    syncAllDevices();
 
-        if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
-            const unsigned int nThreadsUpdateHist = 2 * CUDA_THREADS_PER_BLOCK;
-            unsigned int fricMapSize = nSpheres * MAX_SPHERES_TOUCHED_BY_SPHERE;
-            unsigned int nBlocksFricHistoryPostProcess = (fricMapSize + nThreadsUpdateHist - 1) / nThreadsUpdateHist;
+    if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        const unsigned int nThreadsUpdateHist = 2 * CUDA_THREADS_PER_BLOCK;
+        unsigned int fricMapSize = nSpheres * MAX_SPHERES_TOUCHED_BY_SPHERE;
+        unsigned int map_chunk = (fricMapSize + ndev - 1) / ndev;
+        map_chunk = ((map_chunk + nThreadsUpdateHist - 1) / nThreadsUpdateHist) * nThreadsUpdateHist;
+
+        for (unsigned int d = 0; d < ndev; d++) {
+            unsigned int sp_lo = d * sphere_chunk;
+            unsigned int map_lo = d * map_chunk;
+            gpuErrchk(cudaSetDevice(multigpu_devices[d]));
+            if (map_lo < fricMapSize) {
+                updateFrictionData<<<map_chunk / nThreadsUpdateHist, nThreadsUpdateHist>>>(fricMapSize, sphere_data,
+                                                                                          gran_params, map_lo);
+            }
+            if (sp_lo < nSpheres) {
+                updateAngVels<<<nBlocksPerSlab, CUDA_THREADS_PER_BLOCK>>>(stepSize_SU, sphere_data, nSpheres,
+                                                                          gran_params, sp_lo);
+            }
+        }
+        syncAllDevices();
+    }
 
-            METRICS_PRINTF("Update Friction Data!\n");
+    gpuErrchk(cudaSetDevice(home_device));
+}
 
-            updateFrictionData<<<nBlocksFricHistoryPostProcess, nThreadsUpdateHist>>>(fricMapSize, sphere_data,
-                                                                                      gran_params);
+__host__ void ChSystemGpu_impl::updateStepGraph() {
+    // Nothing to do if the instantiated graph still matches the current configuration
+    if (step_graph_exec != nullptr &&                                         //
+        step_graph_config.nSpheres == nSpheres &&                             //
+        step_graph_config.nSDs == nSDs &&                                     //
+        step_graph_config.stepSize_SU == stepSize_SU &&                       //
+        step_graph_config.friction_mode == gran_params->friction_mode &&      //
+        step_graph_config.use_mat_based == gran_params->use_mat_based &&      //
+        step_graph_config.num_BCs == BC_params_list_SU.size() &&              //
+        step_graph_config.BC_params_ptr == (const void*)BC_params_list_SU.data() &&  //
+        step_graph_config.forcefield_enabled == gran_params->forcefield_enabled) {
+        return;
+    }
 
-            gpuErrchk(cudaPeekAtLastError());
-            gpuErrchk(cudaDeviceSynchronize());
-            METRICS_PRINTF("Update angular velocity.\n");
-            updateAngVels<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(stepSize_SU, sphere_data, nSpheres, gran_params);
+    if (step_graph_stream == nullptr) {
+        gpuErrchk(cudaStreamCreate(&step_graph_stream));
+    }
+    if (step_graph_exec != nullptr) {
+        gpuErrchk(cudaGraphExecDestroy(step_graph_exec));
+        step_graph_exec = nullptr;
+    }
+
+    cudaGraph_t graph;
+    gpuErrchk(cudaStreamBeginCapture(step_graph_stream, cudaStreamCaptureModeThreadLocal));
+    launchStepKernels(step_graph_stream);
+    gpuErrchk(cudaStreamEndCapture(step_graph_stream, &graph));
+    gpuErrchk(cudaGraphInstantiate(&step_graph_exec, graph, NULL, NULL, 0));
+    gpuErrchk(cudaGraphDestroy(graph));
+
+    step_graph_config.nSpheres = nSpheres;
+    step_graph_config.nSDs = nSDs;
+    step_graph_config.stepSize_SU = stepSize_SU;
+    step_graph_config.friction_mode = gran_params->friction_mode;
+    step_graph_config.use_mat_based = gran_params->use_mat_based;
+    step_graph_config.num_BCs = BC_params_list_SU.size();
+    step_graph_config.BC_params_ptr = (const void*)BC_params_list_SU.data();
+    step_graph_config.forcefield_enabled = gran_params->forcefield_enabled;
+}
+
+__host__ double ChSystemGpu_impl::AdvanceSimulation(float duration) {
+    // Settling simulation loop.
+    float duration_SU = (float)(duration / TIME_SU2UU);
+    unsigned int nsteps = (unsigned int)std::round(duration_SU / stepSize_SU);
+    METRICS_PRINTF("advancing by %f at timestep %f, %u timesteps at approx user timestep %f\n", duration_SU,
+                   stepSize_SU, nsteps, duration / nsteps);
+    float time_elapsed_SU = 0;  // time elapsed in this advance call
+
+    packSphereDataPointers();
+
+    // Run the simulation, there are aggressive synchronizations because we want to have no race conditions
+    for (unsigned int n = 0; n < nsteps; n++) {
+        updateBCPositions();
+        runSphereBroadphase();
+        resetSphereAccelerations();
+        if (gran_params->forcefield_enabled) {
+            resetForceFieldGrid();
+        }
+        resetBCForces();
+
+        METRICS_PRINTF("Starting computeSphereForces!\n");
+
+        if (multigpu_devices.size() > 1) {
+            // Decompose the force/integration sequence over the configured devices.
+            launchStepKernelsMultiGpu();
+        } else if (use_step_graph) {
+            // Launch the whole force/integration sequence as a single captured CUDA graph.
+            updateStepGraph();
+            gpuErrchk(cudaGraphLaunch(step_graph_exec, step_graph_stream));
+            gpuErrchk(cudaStreamSynchronize(step_graph_stream));
+        } else {
+            launchStepKernels(0);
             gpuErrchk(cudaPeekAtLastError());
             gpuErrchk(cudaDeviceSynchronize());
         }
@@ -538,13 +538,15 @@ inline __device__ void applyExternalForces(unsigned int currSphereID,
 }
 
 static __global__ void determineContactPairs(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                             ChSystemGpu_impl::GranParamsPtr gran_params) {
+                                             ChSystemGpu_impl::GranParamsPtr gran_params,
+                                             unsigned int thisSD_offset = 0) {
     // Cache positions of spheres local to this SD
     __shared__ int3 sphere_pos_local[MAX_COUNT_OF_SPHERES_PER_SD];
     __shared__ unsigned int sphIDs[MAX_COUNT_OF_SPHERES_PER_SD];
     __shared__ not_stupid_bool sphFixed[MAX_COUNT_OF_SPHERES_PER_SD];
 
-    unsigned int thisSD = blockIdx.x;
+    // thisSD_offset allows launching over a sub-range of SDs (multi-GPU decomposition)
+    unsigned int thisSD = blockIdx.x + thisSD_offset;
     unsigned int spheresTouchingThisSD = sphere_data->SD_NumSpheresTouching[thisSD];
 
     unsigned char bodyB_list[MAX_SPHERES_TOUCHED_BY_SPHERE];
@@ -739,12 +741,14 @@ static __global__ void computeSphereContactForces(ChSystemGpu_impl::GranSphereDa
                                                   BC_type* bc_type_list,
                                                   BC_params_t<int64_t, int64_t3>* bc_params_list,
                                                   unsigned int nBCs,
-                                                  unsigned int nSpheres) {
+                                                  unsigned int nSpheres,
+                                                  unsigned int sphereID_offset = 0) {
     // grab the sphere radius
     unsigned int sphereRadius_SU = gran_params->sphereRadius_SU;
 
     // my sphere ID, we're using a 1D thread->sphere map
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    // sphereID_offset allows launching over a sub-range of spheres (multi-GPU decomposition)
+    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x + sphereID_offset;
 
     //    float force_unit = gran_params->MASS_UNIT * gran_params->LENGTH_UNIT / (gran_params->TIME_UNIT *
     //    gran_params->TIME_UNIT);
@@ -939,12 +943,14 @@ static __global__ void computeSphereContactForces_matBased(ChSystemGpu_impl::Gra
                                                            BC_type* bc_type_list,
                                                            BC_params_t<int64_t, int64_t3>* bc_params_list,
                                                            unsigned int nBCs,
-                                                           unsigned int nSpheres) {
+                                                           unsigned int nSpheres,
+                                                           unsigned int sphereID_offset = 0) {
     // grab the sphere radius
     unsigned int sphereRadius_SU = gran_params->sphereRadius_SU;
 
     // my sphere ID, we're using a 1D thread->sphere map
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    // sphereID_offset allows launching over a sub-range of spheres (multi-GPU decomposition)
+    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x + sphereID_offset;
 
     // don't overrun the array
     if (mySphereID < nSpheres) {
@@ -1218,13 +1224,15 @@ static __global__ void computeSphereForces_frictionless_matBased(ChSystemGpu_imp
                                                                  ChSystemGpu_impl::GranParamsPtr gran_params,
                                                                  BC_type* bc_type_list,
                                                                  BC_params_t<int64_t, int64_t3>* bc_params_list,
-                                                                 unsigned int nBCs) {
+                                                                 unsigned int nBCs,
+                                                                 unsigned int thisSD_offset = 0) {
     // store positions relative to *THIS* SD
     __shared__ int3 sphere_pos[MAX_COUNT_OF_SPHERES_PER_SD];
     __shared__ float3 sphere_vel[MAX_COUNT_OF_SPHERES_PER_SD];
     __shared__ not_stupid_bool sphere_fixed[MAX_COUNT_OF_SPHERES_PER_SD];
 
-    unsigned int thisSD = blockIdx.x;
+    // thisSD_offset allows launching over a sub-range of SDs (multi-GPU decomposition)
+    unsigned int thisSD = blockIdx.x + thisSD_offset;
     unsigned int spheresTouchingThisSD = sphere_data->SD_NumSpheresTouching[thisSD];
     unsigned int mySphereID;
     unsigned char bodyB_list[MAX_SPHERES_TOUCHED_BY_SPHERE];
@@ -1348,14 +1356,61 @@ inline __device__ float integrateChung_pos(float stepsize_SU, float vel_old, flo
     return stepsize_SU * (vel_old + stepsize_SU * (acc * beta + acc_old * beta_hat));
 }
 
+/**
+ * Accumulate the net contact force acting on each sphere into the cell of the user-defined force-field grid that
+ * contains the sphere center. This must run after all force kernels have completed, so that the per-sphere
+ * accelerations hold the complete force for this time step; gravity is taken back out so that only contact,
+ * boundary, and cohesive forces are binned. Cells are updated with atomics; only the small grid ever leaves the
+ * device.
+ */
+static __global__ void accumulateForceFieldGrid(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                unsigned int nSpheres,
+                                                ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                unsigned int sphereID_offset = 0) {
+    // sphereID_offset allows launching over a sub-range of spheres (multi-GPU decomposition)
+    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x + sphereID_offset;
+    if (mySphereID >= nSpheres || sphere_data->sphere_fixed[mySphereID])
+        return;
+
+    int3 sphere_pos_local =
+        make_int3(sphere_data->sphere_local_pos_X[mySphereID], sphere_data->sphere_local_pos_Y[mySphereID],
+                  sphere_data->sphere_local_pos_Z[mySphereID]);
+    int64_t3 sphPos_global =
+        convertPosLocalToGlobal(sphere_data->sphere_owner_SDs[mySphereID], sphere_pos_local, gran_params);
+
+    double cell_x = (double)(sphPos_global.x - gran_params->forcefield_origin_X) * gran_params->forcefield_inv_cell_X;
+    double cell_y = (double)(sphPos_global.y - gran_params->forcefield_origin_Y) * gran_params->forcefield_inv_cell_Y;
+    double cell_z = (double)(sphPos_global.z - gran_params->forcefield_origin_Z) * gran_params->forcefield_inv_cell_Z;
+    if (cell_x < 0 || cell_y < 0 || cell_z < 0)
+        return;
+    unsigned int ix = (unsigned int)cell_x;
+    unsigned int iy = (unsigned int)cell_y;
+    unsigned int iz = (unsigned int)cell_z;
+    if (ix >= gran_params->forcefield_cells_X || iy >= gran_params->forcefield_cells_Y ||
+        iz >= gran_params->forcefield_cells_Z)
+        return;
+
+    // Net force on this sphere for this time step (remember the unit SU sphere mass), minus gravity
+    float3 force;
+    force.x = gran_params->sphere_mass_SU * (sphere_data->sphere_acc_X[mySphereID] - gran_params->gravAcc_X_SU);
+    force.y = gran_params->sphere_mass_SU * (sphere_data->sphere_acc_Y[mySphereID] - gran_params->gravAcc_Y_SU);
+    force.z = gran_params->sphere_mass_SU * (sphere_data->sphere_acc_Z[mySphereID] - gran_params->gravAcc_Z_SU);
+
+    size_t cell = ((size_t)iz * gran_params->forcefield_cells_Y + iy) * gran_params->forcefield_cells_X + ix;
+    atomicAdd(&(sphere_data->forcefield_grid[cell].x), force.x);
+    atomicAdd(&(sphere_data->forcefield_grid[cell].y), force.y);
+    atomicAdd(&(sphere_data->forcefield_grid[cell].z), force.z);
+}
+
 /// Numerically integrates force to velocity and velocity to position
 static __global__ void integrateSpheres(const float stepsize_SU,
                                         ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                         unsigned int nSpheres,
-                                        ChSystemGpu_impl::GranParamsPtr gran_params) {
+                                        ChSystemGpu_impl::GranParamsPtr gran_params,
+                                        unsigned int sphereID_offset = 0) {
     // Figure out what sphereID this thread will handle. We work with a 1D block structure and a 1D grid
-    // structure
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    // structure; sphereID_offset allows launching over a sub-range of spheres (multi-GPU decomposition)
+    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x + sphereID_offset;
     // Write back velocity updates
     if (mySphereID < nSpheres && !sphere_data->sphere_fixed[mySphereID]) {
         float curr_acc_X = sphere_data->sphere_acc_X[mySphereID];
@@ -1462,8 +1517,10 @@ static __global__ void integrateSpheres(const float stepsize_SU,
  */
 static __global__ void updateFrictionData(unsigned int frictionHistoryMapSize,
                                           ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                          ChSystemGpu_impl::GranParamsPtr gran_params) {
-    unsigned int offsetInFrictionMap = threadIdx.x + blockIdx.x * blockDim.x;
+                                          ChSystemGpu_impl::GranParamsPtr gran_params,
+                                          unsigned int map_offset = 0) {
+    // map_offset allows launching over a sub-range of the map (multi-GPU decomposition)
+    unsigned int offsetInFrictionMap = threadIdx.x + blockIdx.x * blockDim.x + map_offset;
 
     if (offsetInFrictionMap < frictionHistoryMapSize) {
         // look at this map contact slot and reset it if that slot wasn't active last timestep
@@ -1491,9 +1548,11 @@ static __global__ void updateFrictionData(unsigned int frictionHistoryMapSize,
 static __global__ void updateAngVels(const float stepsize_SU,
                                      ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                      unsigned int nSpheres,
-                                     ChSystemGpu_impl::GranParamsPtr gran_params) {
-    // Figure which sphereID this thread handles. We work with a 1D block structure and a 1D grid structure
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+                                     ChSystemGpu_impl::GranParamsPtr gran_params,
+                                     unsigned int sphereID_offset = 0) {
+    // Figure which sphereID this thread handles. We work with a 1D block structure and a 1D grid structure;
+    // sphereID_offset allows launching over a sub-range of spheres (multi-GPU decomposition)
+    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x + sphereID_offset;
 
     if (mySphereID >= nSpheres || sphere_data->sphere_fixed[mySphereID])
         return;
@@ -155,6 +155,136 @@ __host__ void ChSystemGpuMesh_impl::runTriangleBroadphase() {
     gpuErrchk(cudaDeviceSynchronize());
 }
 
+__host__ void ChSystemGpuMesh_impl::buildMeshBVH() {
+    unsigned int numTriangles = meshSoup->nTrianglesInSoup;
+    unsigned int nblocks = (numTriangles + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+
+    Triangle_AABB_min.resize(numTriangles);
+    Triangle_AABB_max.resize(numTriangles);
+    Triangle_MortonCodes.resize(numTriangles);
+    Triangle_MortonCodes_sorted.resize(numTriangles);
+    BVH_leaf_triangles.resize(numTriangles);
+    unsigned int numNodes = 2 * numTriangles - 1;
+    BVH_node_parent.resize(numNodes);
+    BVH_node_AABB_min.resize(numNodes);
+    BVH_node_AABB_max.resize(numNodes);
+    if (numTriangles > 1) {
+        BVH_node_left.resize(numTriangles - 1);
+        BVH_node_right.resize(numTriangles - 1);
+        BVH_refit_flags.resize(numTriangles - 1);
+    }
+
+    // triangle AABBs and Morton codes of their centroids
+    computeTriangleAABBs<<<nblocks, CUDA_THREADS_PER_BLOCK>>>(meshSoup, Triangle_AABB_min.data(),
+                                                              Triangle_AABB_max.data(), Triangle_MortonCodes.data(),
+                                                              gran_params, tri_params);
+    gpuErrchk(cudaPeekAtLastError());
+    gpuErrchk(cudaDeviceSynchronize());
+
+    // sort triangle IDs by Morton code to obtain the leaf order
+    std::vector<unsigned int, cudallocator<unsigned int>> ids(numTriangles);
+    for (unsigned int i = 0; i < numTriangles; i++) {
+        ids[i] = i;
+    }
+    size_t temp_storage_bytes = 0;
+    cub::DeviceRadixSort::SortPairs(NULL, temp_storage_bytes, Triangle_MortonCodes.data(),
+                                    Triangle_MortonCodes_sorted.data(), ids.data(), BVH_leaf_triangles.data(),
+                                    numTriangles);
+    gpuErrchk(cudaDeviceSynchronize());
+    void* d_scratch_space = (void*)stateOfSolver_resources.pDeviceMemoryScratchSpace(temp_storage_bytes);
+    cub::DeviceRadixSort::SortPairs(d_scratch_space, temp_storage_bytes, Triangle_MortonCodes.data(),
+                                    Triangle_MortonCodes_sorted.data(), ids.data(), BVH_leaf_triangles.data(),
+                                    numTriangles);
+    gpuErrchk(cudaDeviceSynchronize());
+
+    // build the radix tree over the sorted codes; topology survives rigid motion
+    if (numTriangles > 1) {
+        buildMeshBVHTree<<<nblocks, CUDA_THREADS_PER_BLOCK>>>(Triangle_MortonCodes_sorted.data(), numTriangles,
+                                                              BVH_node_left.data(), BVH_node_right.data(),
+                                                              BVH_node_parent.data());
+        gpuErrchk(cudaPeekAtLastError());
+        gpuErrchk(cudaDeviceSynchronize());
+    } else {
+        BVH_node_parent[0] = NULL_CHGPU_ID;
+    }
+
+    mesh_bvh_built = true;
+}
+
+__host__ void ChSystemGpuMesh_impl::refitMeshBVH() {
+    unsigned int numTriangles = meshSoup->nTrianglesInSoup;
+    unsigned int nblocks = (numTriangles + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+
+    // recompute triangle AABBs under the current family frames; the Morton order is kept
+    computeTriangleAABBs<<<nblocks, CUDA_THREADS_PER_BLOCK>>>(meshSoup, Triangle_AABB_min.data(),
+                                                              Triangle_AABB_max.data(), NULL, gran_params, tri_params);
+    gpuErrchk(cudaPeekAtLastError());
+
+    if (numTriangles > 1) {
+        gpuErrchk(cudaMemset(BVH_refit_flags.data(), 0, (numTriangles - 1) * sizeof(unsigned int)));
+    }
+    refitMeshBVHKernel<<<nblocks, CUDA_THREADS_PER_BLOCK>>>(
+        BVH_leaf_triangles.data(), Triangle_AABB_min.data(), Triangle_AABB_max.data(), BVH_node_left.data(),
+        BVH_node_right.data(), BVH_node_parent.data(), BVH_node_AABB_min.data(), BVH_node_AABB_max.data(),
+        BVH_refit_flags.data(), numTriangles);
+    gpuErrchk(cudaPeekAtLastError());
+    gpuErrchk(cudaDeviceSynchronize());
+}
+
+__host__ void ChSystemGpuMesh_impl::runTriangleBroadphaseBVH() {
+    METRICS_PRINTF("Running BVH triangle broadphase!\n");
+
+    if (!mesh_bvh_built) {
+        buildMeshBVH();
+    }
+    refitMeshBVH();
+
+    unsigned int numTriangles = meshSoup->nTrianglesInSoup;
+    unsigned int nblocks = (nSDs + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+
+    // per-SD overlap counts via BVH queries
+    countTrianglesInSDsBVH<<<nblocks, CUDA_THREADS_PER_BLOCK>>>(
+        meshSoup, sphere_data, BVH_leaf_triangles.data(), BVH_node_left.data(), BVH_node_right.data(),
+        BVH_node_AABB_min.data(), BVH_node_AABB_max.data(), numTriangles, SD_numTrianglesTouching.data(), nSDs,
+        gran_params, tri_params);
+    gpuErrchk(cudaPeekAtLastError());
+    gpuErrchk(cudaDeviceSynchronize());
+
+    // Now assert that no SD has over max amount of triangles
+    // If there is one, exit graciously
+    unsigned int* in_ptr = SD_numTrianglesTouching.data();
+    size_t temp_storage_bytes = 0;
+    // Just borrow the first element of SD_TrianglesCompositeOffsets to store the max value
+    unsigned int* maxTriCount = SD_TrianglesCompositeOffsets.data();
+    cub::DeviceReduce::Max(NULL, temp_storage_bytes, in_ptr, maxTriCount, nSDs);
+    gpuErrchk(cudaDeviceSynchronize());
+    void* d_scratch_space = (void*)stateOfSolver_resources.pDeviceMemoryScratchSpace(temp_storage_bytes);
+    cub::DeviceReduce::Max(d_scratch_space, temp_storage_bytes, in_ptr, maxTriCount, nSDs);
+    gpuErrchk(cudaDeviceSynchronize());
+    if (*maxTriCount > MAX_TRIANGLE_COUNT_PER_SD)
+        CHGPU_ERROR("ERROR! %u triangles are found in one of the SDs! The max allowance is %u.\n", *maxTriCount,
+                    MAX_TRIANGLE_COUNT_PER_SD);
+
+    // prefix scan the counts to get the offsets in the big composite array
+    unsigned int* out_ptr = SD_TrianglesCompositeOffsets.data();
+    cub::DeviceScan::ExclusiveSum(NULL, temp_storage_bytes, in_ptr, out_ptr, nSDs);
+    gpuErrchk(cudaDeviceSynchronize());
+    d_scratch_space = (void*)stateOfSolver_resources.pDeviceMemoryScratchSpace(temp_storage_bytes);
+    cub::DeviceScan::ExclusiveSum(d_scratch_space, temp_storage_bytes, in_ptr, out_ptr, nSDs);
+    gpuErrchk(cudaDeviceSynchronize());
+
+    unsigned int numOfTriangleTouchingSD_instances = out_ptr[nSDs - 1] + in_ptr[nSDs - 1];
+    SD_trianglesInEachSD_composite.resize(numOfTriangleTouchingSD_instances);
+
+    // second traversal writes the per-SD triangle lists at those offsets
+    storeTrianglesInSDsBVH<<<nblocks, CUDA_THREADS_PER_BLOCK>>>(
+        meshSoup, sphere_data, BVH_leaf_triangles.data(), BVH_node_left.data(), BVH_node_right.data(),
+        BVH_node_AABB_min.data(), BVH_node_AABB_max.data(), numTriangles, SD_numTrianglesTouching.data(),
+        SD_TrianglesCompositeOffsets.data(), SD_trianglesInEachSD_composite.data(), nSDs, gran_params, tri_params);
+    gpuErrchk(cudaPeekAtLastError());
+    gpuErrchk(cudaDeviceSynchronize());
+}
+
 __global__ void interactionGranMat_TriangleSoup_matBased(ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
                                                          ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                                          const unsigned int* SD_trianglesInEachSD_composite,
@@ -714,6 +844,9 @@ __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
         runSphereBroadphase();
 
         resetSphereAccelerations();
+        if (gran_params->forcefield_enabled) {
+            resetForceFieldGrid();
+        }
         resetBCForces();
         if (meshSoup->nTrianglesInSoup != 0 && mesh_collision_enabled) {
             gpuErrchk(
@@ -723,7 +856,11 @@ __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
         gpuErrchk(cudaDeviceSynchronize());
 
         if (meshSoup->nTrianglesInSoup != 0 && mesh_collision_enabled) {
-            runTriangleBroadphase();
+            if (use_mesh_bvh) {
+                runTriangleBroadphaseBVH();
+            } else {
+                runTriangleBroadphase();
+            }
         }
 
         METRICS_PRINTF("Starting computeSphereForces!\n");
@@ -790,6 +927,12 @@ __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
         gpuErrchk(cudaPeekAtLastError());
         gpuErrchk(cudaDeviceSynchronize());
 
+        if (gran_params->forcefield_enabled) {
+            accumulateForceFieldGrid<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(sphere_data, nSpheres, gran_params);
+            gpuErrchk(cudaPeekAtLastError());
+            gpuErrchk(cudaDeviceSynchronize());
+        }
+
         METRICS_PRINTF("Starting integrateSpheres!\n");
         integrateSpheres<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(stepSize_SU, sphere_data, nSpheres, gran_params);
         gpuErrchk(cudaPeekAtLastError());
@@ -350,4 +350,329 @@ __global__ void finalizeSD_numTrianglesTouching(const unsigned int* d_SDs_touche
     }
 }
 
+// -----------------------------------------------------------------------------
+// Mesh LBVH
+//
+// A linear BVH (Karras-style radix tree over Morton codes) built over the world-frame
+// triangle AABBs. With n triangles there are n leaves and n-1 internal nodes; node
+// indices 0..n-2 are internal (0 is the root) and n-1..2n-2 are leaves, leaf n-1+i
+// holding the triangle with the i-th smallest Morton code. The tree topology depends
+// only on the Morton order, so rigid mesh motion requires just an AABB refit.
+// -----------------------------------------------------------------------------
+
+/// Expand 10 bits into 30 bits by inserting 2 zeros between each bit
+inline __device__ unsigned int bvh_expandBits(unsigned int v) {
+    v = (v * 0x00010001u) & 0xFF0000FFu;
+    v = (v * 0x00000101u) & 0x0F00F00Fu;
+    v = (v * 0x00000011u) & 0xC30C30C3u;
+    v = (v * 0x00000005u) & 0x49249249u;
+    return v;
+}
+
+/// Compute the world-frame (SU) AABB of each triangle, slightly inflated the same way the
+/// binning broadphase inflates its boxes. Optionally also computes the Morton code of the
+/// AABB centroid on the SD grid (pass NULL when only refitting).
+__global__ void computeTriangleAABBs(const ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
+                                     float3* aabb_min,
+                                     float3* aabb_max,
+                                     unsigned int* morton_codes,
+                                     ChSystemGpu_impl::GranParamsPtr gran_params,
+                                     ChSystemGpuMesh_impl::MeshParamsPtr mesh_params) {
+    unsigned int myTriangleID = threadIdx.x + blockIdx.x * blockDim.x;
+    if (myTriangleID >= d_triangleSoup->nTrianglesInSoup) {
+        return;
+    }
+
+    // Transform LRF to GRF, then convert to SU; same chain as triangle_countTouchedSDs
+    unsigned int fam = d_triangleSoup->triangleFamily_ID[myTriangleID];
+    float3 vA =
+        apply_frame_transform<float, float3>(d_triangleSoup->node1[myTriangleID],
+                                             mesh_params->fam_frame_broad[fam].pos,
+                                             mesh_params->fam_frame_broad[fam].rot_mat);
+    float3 vB =
+        apply_frame_transform<float, float3>(d_triangleSoup->node2[myTriangleID],
+                                             mesh_params->fam_frame_broad[fam].pos,
+                                             mesh_params->fam_frame_broad[fam].rot_mat);
+    float3 vC =
+        apply_frame_transform<float, float3>(d_triangleSoup->node3[myTriangleID],
+                                             mesh_params->fam_frame_broad[fam].pos,
+                                             mesh_params->fam_frame_broad[fam].rot_mat);
+
+    convert_pos_UU2SU<float3>(vA, gran_params);
+    convert_pos_UU2SU<float3>(vB, gran_params);
+    convert_pos_UU2SU<float3>(vC, gran_params);
+
+    float3 lo = make_float3(MIN(vA.x, MIN(vB.x, vC.x)), MIN(vA.y, MIN(vB.y, vC.y)), MIN(vA.z, MIN(vB.z, vC.z)));
+    float3 hi = make_float3(MAX(vA.x, MAX(vB.x, vC.x)), MAX(vA.y, MAX(vB.y, vC.y)), MAX(vA.z, MAX(vB.z, vC.z)));
+
+    // Enlarge bounding box, matching triangle_figureOutSDBox
+    lo.x -= (float)(gran_params->SD_size_X_SU / SAFETY_PARAM);
+    lo.y -= (float)(gran_params->SD_size_Y_SU / SAFETY_PARAM);
+    lo.z -= (float)(gran_params->SD_size_Z_SU / SAFETY_PARAM);
+    hi.x += (float)(gran_params->SD_size_X_SU / SAFETY_PARAM);
+    hi.y += (float)(gran_params->SD_size_Y_SU / SAFETY_PARAM);
+    hi.z += (float)(gran_params->SD_size_Z_SU / SAFETY_PARAM);
+
+    aabb_min[myTriangleID] = lo;
+    aabb_max[myTriangleID] = hi;
+
+    if (morton_codes != NULL) {
+        // Morton code of the AABB centroid, normalized over the big domain
+        double cx = ((double)lo.x + (double)hi.x) / 2. - (double)gran_params->BD_frame_X;
+        double cy = ((double)lo.y + (double)hi.y) / 2. - (double)gran_params->BD_frame_Y;
+        double cz = ((double)lo.z + (double)hi.z) / 2. - (double)gran_params->BD_frame_Z;
+        cx = MIN(MAX(cx / (double)gran_params->max_x_pos_unsigned, 0.), 1.);
+        cy = MIN(MAX(cy / (double)gran_params->max_y_pos_unsigned, 0.), 1.);
+        cz = MIN(MAX(cz / (double)gran_params->max_z_pos_unsigned, 0.), 1.);
+        unsigned int ix = bvh_expandBits((unsigned int)(cx * 1023.));
+        unsigned int iy = bvh_expandBits((unsigned int)(cy * 1023.));
+        unsigned int iz = bvh_expandBits((unsigned int)(cz * 1023.));
+        morton_codes[myTriangleID] = ix * 4 + iy * 2 + iz;
+    }
+}
+
+/// Distance metric of the radix tree: length of the common prefix of the (Morton code, leaf
+/// index) keys of leaves i and j; leaf indices break ties between equal codes
+inline __device__ int bvh_commonPrefix(const unsigned int* codes, int n, int i, int j) {
+    if (j < 0 || j >= n) {
+        return -1;
+    }
+    if (codes[i] == codes[j]) {
+        return 32 + __clz((unsigned int)i ^ (unsigned int)j);
+    }
+    return __clz(codes[i] ^ codes[j]);
+}
+
+/// Build the internal nodes of the radix tree over the sorted Morton codes (Karras 2012).
+/// One thread per internal node; also records each child's parent for the refit pass.
+__global__ void buildMeshBVHTree(const unsigned int* sorted_codes,
+                                 unsigned int nTriangles,
+                                 unsigned int* node_left,
+                                 unsigned int* node_right,
+                                 unsigned int* node_parent) {
+    int i = (int)(threadIdx.x + blockIdx.x * blockDim.x);
+    int n = (int)nTriangles;
+    if (i >= n - 1) {
+        return;
+    }
+
+    // direction of the node's range, away from the sibling with the shorter common prefix
+    int d = (bvh_commonPrefix(sorted_codes, n, i, i + 1) - bvh_commonPrefix(sorted_codes, n, i, i - 1)) >= 0 ? 1 : -1;
+    int delta_min = bvh_commonPrefix(sorted_codes, n, i, i - d);
+
+    // find an upper bound on the range length, then binary-search the exact other end j
+    int l_max = 2;
+    while (bvh_commonPrefix(sorted_codes, n, i, i + l_max * d) > delta_min) {
+        l_max *= 2;
+    }
+    int l = 0;
+    for (int t = l_max / 2; t >= 1; t /= 2) {
+        if (bvh_commonPrefix(sorted_codes, n, i, i + (l + t) * d) > delta_min) {
+            l += t;
+        }
+    }
+    int j = i + l * d;
+
+    // binary-search the split position: highest leaf sharing the node's full prefix
+    int delta_node = bvh_commonPrefix(sorted_codes, n, i, j);
+    int s = 0;
+    int t = l;
+    do {
+        t = (t + 1) / 2;
+        if (bvh_commonPrefix(sorted_codes, n, i, i + (s + t) * d) > delta_node) {
+            s += t;
+        }
+    } while (t > 1);
+    int gamma = i + s * d + MIN(d, 0);
+
+    // children cover [min(i,j), gamma] and [gamma+1, max(i,j)]; single-leaf ranges are leaves
+    unsigned int left = (MIN(i, j) == gamma) ? (unsigned int)(n - 1 + gamma) : (unsigned int)gamma;
+    unsigned int right = (MAX(i, j) == gamma + 1) ? (unsigned int)(n - 1 + gamma + 1) : (unsigned int)(gamma + 1);
+
+    node_left[i] = left;
+    node_right[i] = right;
+    node_parent[left] = (unsigned int)i;
+    node_parent[right] = (unsigned int)i;
+    if (i == 0) {
+        node_parent[0] = NULL_CHGPU_ID;
+    }
+}
+
+/// Bottom-up AABB refit: each leaf stores its triangle's AABB, then climbs towards the root;
+/// the second thread to arrive at an internal node merges the AABBs of its two children.
+/// refit_flags must be zeroed beforehand.
+__global__ void refitMeshBVHKernel(const unsigned int* leaf_triangles,
+                                   const float3* tri_aabb_min,
+                                   const float3* tri_aabb_max,
+                                   const unsigned int* node_left,
+                                   const unsigned int* node_right,
+                                   const unsigned int* node_parent,
+                                   float3* node_aabb_min,
+                                   float3* node_aabb_max,
+                                   unsigned int* refit_flags,
+                                   unsigned int nTriangles) {
+    unsigned int i = threadIdx.x + blockIdx.x * blockDim.x;
+    if (i >= nTriangles) {
+        return;
+    }
+
+    unsigned int node = nTriangles - 1 + i;
+    unsigned int tri = leaf_triangles[i];
+    node_aabb_min[node] = tri_aabb_min[tri];
+    node_aabb_max[node] = tri_aabb_max[tri];
+
+    if (nTriangles == 1) {
+        return;  // degenerate tree, single leaf and no internal nodes
+    }
+
+    __threadfence();
+    unsigned int curr = node_parent[node];
+    while (curr != NULL_CHGPU_ID) {
+        // only the thread arriving second may merge, so both children are final
+        if (atomicAdd(refit_flags + curr, 1) == 0) {
+            return;
+        }
+        unsigned int left = node_left[curr];
+        unsigned int right = node_right[curr];
+        float3 lmin = node_aabb_min[left];
+        float3 rmin = node_aabb_min[right];
+        float3 lmax = node_aabb_max[left];
+        float3 rmax = node_aabb_max[right];
+        node_aabb_min[curr] = make_float3(MIN(lmin.x, rmin.x), MIN(lmin.y, rmin.y), MIN(lmin.z, rmin.z));
+        node_aabb_max[curr] = make_float3(MAX(lmax.x, rmax.x), MAX(lmax.y, rmax.y), MAX(lmax.z, rmax.z));
+        __threadfence();
+        curr = node_parent[curr];
+    }
+}
+
+/// Traverse the BVH for one SD and report the triangles whose AABB overlaps the SD, filtered
+/// by the same exact triangle-box test the binning broadphase uses. Writes the triangle IDs to
+/// out_list when non-NULL (sized via a prior counting pass); returns the count either way.
+inline __device__ unsigned int mesh_bvh_querySD(unsigned int thisSD,
+                                                const ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
+                                                const unsigned int* leaf_triangles,
+                                                const unsigned int* node_left,
+                                                const unsigned int* node_right,
+                                                const float3* node_aabb_min,
+                                                const float3* node_aabb_max,
+                                                unsigned int nTriangles,
+                                                ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                ChSystemGpuMesh_impl::MeshParamsPtr mesh_params,
+                                                unsigned int* out_list) {
+    int3 trip = SDIDTriplet(thisSD, gran_params);
+
+    // SD box with the same inflation the binning broadphase applies
+    float SDhalfSizes[3];
+    SDhalfSizes[0] = (gran_params->SD_size_X_SU + gran_params->SD_size_X_SU / SAFETY_PARAM) / 2;
+    SDhalfSizes[1] = (gran_params->SD_size_Y_SU + gran_params->SD_size_Y_SU / SAFETY_PARAM) / 2;
+    SDhalfSizes[2] = (gran_params->SD_size_Z_SU + gran_params->SD_size_Z_SU / SAFETY_PARAM) / 2;
+
+    float SDcenter[3];
+    SDcenter[0] = gran_params->BD_frame_X + (int64_t)(trip.x * 2 + 1) * (int64_t)gran_params->SD_size_X_SU / 2;
+    SDcenter[1] = gran_params->BD_frame_Y + (int64_t)(trip.y * 2 + 1) * (int64_t)gran_params->SD_size_Y_SU / 2;
+    SDcenter[2] = gran_params->BD_frame_Z + (int64_t)(trip.z * 2 + 1) * (int64_t)gran_params->SD_size_Z_SU / 2;
+
+    unsigned int count = 0;
+
+    // explicit traversal stack; tree depth is bounded well below this for any sane mesh
+    unsigned int stack[64];
+    unsigned int stack_size = 0;
+    stack[stack_size++] = 0;  // the root; when n == 1 node 0 is the single leaf
+
+    while (stack_size > 0) {
+        unsigned int node = stack[--stack_size];
+
+        const float3& lo = node_aabb_min[node];
+        const float3& hi = node_aabb_max[node];
+        if (SDcenter[0] + SDhalfSizes[0] < lo.x || hi.x < SDcenter[0] - SDhalfSizes[0] ||
+            SDcenter[1] + SDhalfSizes[1] < lo.y || hi.y < SDcenter[1] - SDhalfSizes[1] ||
+            SDcenter[2] + SDhalfSizes[2] < lo.z || hi.z < SDcenter[2] - SDhalfSizes[2]) {
+            continue;
+        }
+
+        if (nTriangles > 1 && node < nTriangles - 1) {
+            // internal node
+            stack[stack_size++] = node_left[node];
+            stack[stack_size++] = node_right[node];
+            continue;
+        }
+
+        // leaf: run the exact triangle-box test the binning broadphase uses
+        unsigned int triangleID = leaf_triangles[(nTriangles == 1) ? 0 : node - (nTriangles - 1)];
+        unsigned int fam = d_triangleSoup->triangleFamily_ID[triangleID];
+        float3 vA = apply_frame_transform<float, float3>(d_triangleSoup->node1[triangleID],
+                                                         mesh_params->fam_frame_broad[fam].pos,
+                                                         mesh_params->fam_frame_broad[fam].rot_mat);
+        float3 vB = apply_frame_transform<float, float3>(d_triangleSoup->node2[triangleID],
+                                                         mesh_params->fam_frame_broad[fam].pos,
+                                                         mesh_params->fam_frame_broad[fam].rot_mat);
+        float3 vC = apply_frame_transform<float, float3>(d_triangleSoup->node3[triangleID],
+                                                         mesh_params->fam_frame_broad[fam].pos,
+                                                         mesh_params->fam_frame_broad[fam].rot_mat);
+        convert_pos_UU2SU<float3>(vA, gran_params);
+        convert_pos_UU2SU<float3>(vB, gran_params);
+        convert_pos_UU2SU<float3>(vC, gran_params);
+
+        if (check_TriangleBoxOverlap(SDcenter, SDhalfSizes, vA, vB, vC)) {
+            if (out_list != NULL) {
+                out_list[count] = triangleID;
+            }
+            count++;
+        }
+    }
+    return count;
+}
+
+/// Count, for each SD, the triangles overlapping it according to the BVH. SDs without any
+/// spheres are skipped: the downstream narrowphase kernels early-out on them anyway.
+__global__ void countTrianglesInSDsBVH(const ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
+                                       ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                       const unsigned int* leaf_triangles,
+                                       const unsigned int* node_left,
+                                       const unsigned int* node_right,
+                                       const float3* node_aabb_min,
+                                       const float3* node_aabb_max,
+                                       unsigned int nTriangles,
+                                       unsigned int* SD_numTrianglesTouching,
+                                       unsigned int nSDs,
+                                       ChSystemGpu_impl::GranParamsPtr gran_params,
+                                       ChSystemGpuMesh_impl::MeshParamsPtr mesh_params) {
+    unsigned int thisSD = threadIdx.x + blockIdx.x * blockDim.x;
+    if (thisSD >= nSDs) {
+        return;
+    }
+    if (sphere_data->SD_NumSpheresTouching[thisSD] == 0) {
+        SD_numTrianglesTouching[thisSD] = 0;
+        return;
+    }
+    SD_numTrianglesTouching[thisSD] =
+        mesh_bvh_querySD(thisSD, d_triangleSoup, leaf_triangles, node_left, node_right, node_aabb_min, node_aabb_max,
+                         nTriangles, gran_params, mesh_params, NULL);
+}
+
+/// Second pass of the BVH broadphase: write the triangle IDs of each SD into the composite
+/// array at the offsets produced by the prefix scan of the counts.
+__global__ void storeTrianglesInSDsBVH(const ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
+                                       ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                       const unsigned int* leaf_triangles,
+                                       const unsigned int* node_left,
+                                       const unsigned int* node_right,
+                                       const float3* node_aabb_min,
+                                       const float3* node_aabb_max,
+                                       unsigned int nTriangles,
+                                       const unsigned int* SD_numTrianglesTouching,
+                                       const unsigned int* SD_TrianglesCompositeOffsets,
+                                       unsigned int* SD_trianglesInEachSD_composite,
+                                       unsigned int nSDs,
+                                       ChSystemGpu_impl::GranParamsPtr gran_params,
+                                       ChSystemGpuMesh_impl::MeshParamsPtr mesh_params) {
+    unsigned int thisSD = threadIdx.x + blockIdx.x * blockDim.x;
+    if (thisSD >= nSDs || SD_numTrianglesTouching[thisSD] == 0) {
+        return;
+    }
+    mesh_bvh_querySD(thisSD, d_triangleSoup, leaf_triangles, node_left, node_right, node_aabb_min, node_aabb_max,
+                     nTriangles, gran_params, mesh_params,
+                     SD_trianglesInEachSD_composite + SD_TrianglesCompositeOffsets[thisSD]);
+}
+
 /// @} gpu_cuda
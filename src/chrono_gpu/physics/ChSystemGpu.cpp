@@ -48,6 +48,7 @@ ChSystemGpuMesh::ChSystemGpuMesh(const std::string& checkpoint) : mesh_verbosity
 }
 
 ChSystemGpu::~ChSystemGpu() {
+    FlushParticleFileWrites();
     delete m_sys;
 }
 
@@ -71,6 +72,12 @@ void ChSystemGpu::SetBDFixed(bool fixed) {
     m_sys->BD_is_fixed = fixed;
 }
 
+void ChSystemGpu::SetSubdomainSizeFactor(double factor) {
+    if (factor <= 0)
+        CHGPU_ERROR("ERROR! Subdomain size factor must be positive!\n");
+    m_sys->sd_size_factor = factor;
+}
+
 void ChSystemGpu::SetBDCenter(const ChVector<float>& O) {
     m_sys->user_coord_O_X = O.x();
     m_sys->user_coord_O_Y = O.y();
@@ -99,6 +106,22 @@ void ChSystemGpu::SetParticleOutputFlags(unsigned int flags) {
     m_sys->output_flags = flags;
 }
 
+void ChSystemGpu::SetParticleOutputRegion(const ChVector<float>& box_min, const ChVector<float>& box_max) {
+    m_sys->output_region_enabled = true;
+    m_sys->output_region_min = make_float3(box_min.x(), box_min.y(), box_min.z());
+    m_sys->output_region_max = make_float3(box_max.x(), box_max.y(), box_max.z());
+}
+
+void ChSystemGpu::ClearParticleOutputRegion() {
+    m_sys->output_region_enabled = false;
+}
+
+void ChSystemGpu::SetParticleOutputDisplacementThreshold(float threshold) {
+    m_sys->output_min_displacement = threshold;
+    if (threshold <= 0)
+        m_sys->output_last_pos.clear();
+}
+
 void ChSystemGpu::SetFixedStepSize(float size_UU) {
     m_sys->stepSize_UU = size_UU;
 }
@@ -124,6 +147,14 @@ void ChSystemGpu::SetDefragmentOnInitialize(bool defragment) {
     m_sys->defragment_on_start = defragment;
 }
 
+void ChSystemGpu::EnableStepGraphCapture(bool val) {
+    m_sys->use_step_graph = val;
+}
+
+void ChSystemGpu::SetMultiGpuDevices(const std::vector<int>& devices) {
+    m_sys->multigpu_devices = devices;
+}
+
 void ChSystemGpu::SetRecordingContactInfo(bool record) {
     m_sys->gran_params->recording_contactInfo = record;
 }
@@ -428,6 +459,26 @@ bool ChSystemGpu::GetBCReactionForces(size_t BC_id, ChVector<float>& force) cons
     return ret;
 }
 
+void ChSystemGpu::EnableForceFieldGrid(const ChVector<float>& min_corner,
+                                       const ChVector<float>& max_corner,
+                                       const ChVector<int>& num_cells) {
+    m_sys->EnableForceFieldGrid(make_float3(min_corner.x(), min_corner.y(), min_corner.z()),
+                                make_float3(max_corner.x(), max_corner.y(), max_corner.z()),
+                                make_int3(num_cells.x(), num_cells.y(), num_cells.z()));
+}
+
+void ChSystemGpu::DisableForceFieldGrid() {
+    m_sys->DisableForceFieldGrid();
+}
+
+void ChSystemGpu::GetForceFieldGrid(std::vector<ChVector<float>>& forces) const {
+    std::vector<float3> frc;
+    m_sys->GetForceFieldGrid(frc);
+    forces.resize(frc.size());
+    for (size_t i = 0; i < frc.size(); i++)
+        forces[i] = ChVector<float>(frc[i].x, frc[i].y, frc[i].z);
+}
+
 int ChSystemGpu::GetNumContacts() const {
     return m_sys->GetNumContacts();
 }
@@ -449,6 +500,14 @@ ChVector<float> ChSystemGpu::GetParticlePosition(int nSphere) const {
     return ChVector<float>(pos.x, pos.y, pos.z);
 }
 
+void ChSystemGpu::GetParticlePositions(std::vector<ChVector<float>>& positions) const {
+    std::vector<float3> pos;
+    m_sys->GetParticlePositions(pos);
+    positions.resize(pos.size());
+    for (size_t i = 0; i < pos.size(); i++)
+        positions[i] = ChVector<float>(pos[i].x, pos[i].y, pos[i].z);
+}
+
 void ChSystemGpu::SetParticlePosition(int nSphere, const ChVector<double> pos) {
     double3 position = make_double3(pos.x(), pos.y(), pos.z());
     m_sys->SetParticlePosition(nSphere, position);
@@ -507,6 +566,14 @@ size_t ChSystemGpu::EstimateMemUsage() const {
     return m_sys->EstimateMemUsage();
 }
 
+size_t ChSystemGpu::EstimateBroadphaseMemUsage() const {
+    return m_sys->EstimateBroadphaseMemUsage();
+}
+
+size_t ChSystemGpu::EstimateContactMemUsage() const {
+    return m_sys->EstimateContactMemUsage();
+}
+
 // -----------------------------------------------------------------------------
 
 unsigned int ChSystemGpuMesh::AddMesh(std::shared_ptr<geometry::ChTriangleMeshConnected> mesh, float mass) {
@@ -665,6 +732,11 @@ void ChSystemGpuMesh::EnableMeshCollision(bool val) {
     sys_trimesh->mesh_collision_enabled = val;
 }
 
+void ChSystemGpuMesh::EnableMeshBVH(bool val) {
+    ChSystemGpuMesh_impl* sys_trimesh = static_cast<ChSystemGpuMesh_impl*>(m_sys);
+    sys_trimesh->use_mesh_bvh = val;
+}
+
 // -----------------------------------------------------------------------------
 
 static void convertChVector2Float3Vec(const std::vector<ChVector<float>>& points, std::vector<float3>& pointsFloat3) {
@@ -1430,6 +1502,22 @@ void ChSystemGpu::WriteCheckpointFile(const std::string& outfilename) {
     }
 }
 
+void ChSystemGpu::WriteBinaryCheckpointFile(const std::string& outfilename) {
+    printf("Writing binary checkpoint data to file \"%s\"\n", outfilename.c_str());
+    std::ofstream cpFile(outfilename, std::ios::out | std::ios::binary);
+    if (!cpFile.is_open())
+        CHGPU_ERROR("ERROR! Binary checkpoint file did not open successfully!\n");
+    m_sys->WriteRawCheckpoint(cpFile);
+}
+
+void ChSystemGpu::ReadBinaryCheckpointFile(const std::string& infilename) {
+    printf("Reading binary checkpoint data from file \"%s\"\n", infilename.c_str());
+    std::ifstream cpFile(infilename, std::ios::in | std::ios::binary);
+    if (!cpFile.is_open())
+        CHGPU_ERROR("ERROR! Binary checkpoint file did not open successfully!\n");
+    m_sys->ReadRawCheckpoint(cpFile);
+}
+
 void ChSystemGpu::WriteRawParticles(std::ofstream& ptFile) const {
     m_sys->WriteRawParticles(ptFile);
 }
@@ -1469,6 +1557,31 @@ void ChSystemGpu::WriteParticleFile(const std::string& outfilename) const {
     }
 }
 
+void ChSystemGpu::WriteParticleFileAsync(const std::string& outfilename) {
+    // Serialize into the staging buffer not handed to the writer thread; this overlaps with the write of
+    // the previous frame, which uses the other buffer
+    std::vector<char>& staging = m_pt_staging[m_pt_staging_idx];
+    m_sys->SerializeRawParticles(staging);
+
+    // Only one write may be in flight; this blocks only if the previous frame is still being written
+    if (m_pt_writer.joinable())
+        m_pt_writer.join();
+
+    const std::vector<char>* buffer = &staging;
+    std::string filename = outfilename;
+    m_pt_writer = std::thread([buffer, filename]() {
+        std::ofstream ptFile(filename, std::ios::out | std::ios::binary);
+        ptFile.write(buffer->data(), buffer->size());
+    });
+
+    m_pt_staging_idx = 1 - m_pt_staging_idx;
+}
+
+void ChSystemGpu::FlushParticleFileWrites() {
+    if (m_pt_writer.joinable())
+        m_pt_writer.join();
+}
+
 void ChSystemGpu::WriteContactInfoFile(const std::string& outfilename) const {
     m_sys->WriteContactInfoFile(outfilename);
 }
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <thread>
 #include <vector>
 
 #include "chrono_gpu/ChApiGpu.h"
@@ -66,10 +67,22 @@ class CH_GPU_API ChSystemGpu {
     // Read in a (Chrono::Gpu generated) checkpoint file to restart a simulation.
     void ReadCheckpointFile(const std::string& infilename, bool overwrite = false);
 
+    /// Restore the simulation state from a binary checkpoint written by WriteBinaryCheckpointFile().
+    /// Initialize() must have been called first on a system set up with the same particle count and
+    /// friction/rolling/integrator modes; the stored arrays then overwrite the device state in place and the
+    /// simulation resumes warm, with no re-initialization or re-sorting.
+    void ReadBinaryCheckpointFile(const std::string& infilename);
+
     /// Set the big domain to be fixed or not.
     /// If fixed, it will ignore any given position functions.
     void SetBDFixed(bool fixed);
 
+    /// Set a multiplier on the default subdomain edge length used when partitioning the big domain (default: 1).
+    /// The default partition sizes subdomains for a few sphere diameters per edge; simulations whose relevant
+    /// interaction length differs (e.g. mixtures graded around a larger effective size) can coarsen or refine the
+    /// broadphase grid with this factor. Must be called before Initialize().
+    void SetSubdomainSizeFactor(double factor);
+
     /// Set the center of the big box domain, relative to the origin of the coordinate system (default: [0,0,0]).
     /// Note that the domain is always axis-aligned. The user must make sure that all simulation information (particle
     /// locations, boundaries, meshes...) is consistent with this domain.
@@ -93,6 +106,19 @@ class CH_GPU_API ChSystemGpu {
     /// this is by default on, unless the user loads simulation data from files, in which case it gets disabled.
     void SetDefragmentOnInitialize(bool defragment);
 
+    /// If yes, the per-step force computation and integration kernels are launched through a captured CUDA graph
+    /// rather than individually. This reduces kernel launch overhead, which can dominate at very small time steps.
+    /// Off by default.
+    void EnableStepGraphCapture(bool val);
+
+    /// Run the per-step force computation and integration kernels decomposed over the given CUDA devices.
+    /// Each device handles a contiguous slab of the subdomain grid; all state lives in unified memory and the
+    /// halo between neighboring slabs is served by peer-to-peer access, so the devices should be connected by
+    /// NVLink (or otherwise support peer atomics). Broadphase and boundary-condition updates stay on the first
+    /// device listed. Passing fewer than two devices restores single-device operation. Incompatible with
+    /// EnableStepGraphCapture.
+    void SetMultiGpuDevices(const std::vector<int>& devices);
+
     /// Ensure that the deformation-based length unit is used.
     void EnableMinLength(bool useMinLen);
     void DisableMinLength() { EnableMinLength(false); }
@@ -248,6 +274,11 @@ class CH_GPU_API ChSystemGpu {
     /// Return particle position.
     ChVector<float> GetParticlePosition(int nSphere) const;
 
+    /// Return the positions of all particles in one bulk query (resizing the output vector as needed).
+    /// Prefer this over per-particle GetParticlePosition calls when reading back an entire cloud,
+    /// e.g. for visualization or output.
+    void GetParticlePositions(std::vector<ChVector<float>>& positions) const;
+
     /// Set particle position
     void SetParticlePosition(int nSphere, const ChVector<double> pos);
 
@@ -296,6 +327,24 @@ class CH_GPU_API ChSystemGpu {
     /// Get the reaction forces on a boundary by ID, returns false if the forces are invalid (bad BC ID)
     bool GetBCReactionForces(size_t BC_id, ChVector<float>& force) const;
 
+    /// Enable accumulation of contact forces into a device-resident uniform grid.
+    /// At every time step, the net contact force on each particle (gravity excluded) is added on the device to the
+    /// grid cell containing the particle center. For co-simulation force exchange (e.g. tire patches on granular
+    /// terrain), only this small grid needs to be transferred to the host, in place of a full per-particle readback.
+    /// The grid covers the axis-aligned box [min_corner, max_corner] (user units) with num_cells cells per direction;
+    /// particles outside the box are ignored.
+    void EnableForceFieldGrid(const ChVector<float>& min_corner,
+                              const ChVector<float>& max_corner,
+                              const ChVector<int>& num_cells);
+
+    /// Disable force-field grid accumulation.
+    void DisableForceFieldGrid();
+
+    /// Collect the force field accumulated over the last completed time step.
+    /// Forces are expressed in user units; the output vector is resized to the total number of grid cells, with the
+    /// cell X index running fastest. Cells no particle touched are zero.
+    void GetForceFieldGrid(std::vector<ChVector<float>>& forces) const;
+
     /// Return number of particle-particle contacts.
     int GetNumContacts() const;
 
@@ -316,9 +365,38 @@ class CH_GPU_API ChSystemGpu {
     /// All information defining a simulation is in this file.
     void WriteCheckpointFile(const std::string& outfilename);
 
+    /// Write a binary device-state checkpoint file.
+    /// All persistent arrays (positions, velocities, multi-step friction history) are dumped bit-for-bit with a
+    /// version header, allowing an exact warm restart via ReadBinaryCheckpointFile(). Unlike WriteCheckpointFile(),
+    /// no information is lost to text formatting and no re-initialization is needed on restart.
+    void WriteBinaryCheckpointFile(const std::string& outfilename);
+
     /// Write particle positions according to the system output mode.
     void WriteParticleFile(const std::string& outfilename) const;
 
+    /// Write a binary particle frame asynchronously.
+    /// The particle state is snapshotted into a staging buffer on the calling thread (applying the optional
+    /// region and displacement filters) and the file write is performed by a background thread, overlapping
+    /// with the subsequent simulation steps. Two staging buffers alternate, so serializing one frame overlaps
+    /// with writing the previous one; a call blocks only if the write of the frame before last has not
+    /// finished. Frames carry a header with the active output flags and a record count; records hold the
+    /// particle id, position and the flagged velocity fields. Call FlushParticleFileWrites() before reading
+    /// the files back or destroying the system.
+    void WriteParticleFileAsync(const std::string& outfilename);
+
+    /// Block until all asynchronous particle writes issued so far have completed.
+    void FlushParticleFileWrites();
+
+    /// Restrict particle output written by WriteParticleFileAsync to an axis-aligned box (in user units).
+    void SetParticleOutputRegion(const ChVector<float>& box_min, const ChVector<float>& box_max);
+
+    /// Remove the particle output region restriction.
+    void ClearParticleOutputRegion();
+
+    /// Only emit particles that moved farther than the given threshold (in user units) since they were last
+    /// written by WriteParticleFileAsync. A non-positive value (default) disables the filter.
+    void SetParticleOutputDisplacementThreshold(float threshold);
+
     /// Write contact pair history to a file.
     void WriteContactHistoryFile(const std::string& outfilename) const;
 
@@ -328,6 +406,13 @@ class CH_GPU_API ChSystemGpu {
     /// Roughly estimate of the total amount of memory used by the system.
     size_t EstimateMemUsage() const;
 
+    /// Device memory currently held by the broadphase subdomain arrays, including the compacted sphere-subdomain
+    /// adjacency which is rebuilt with exact sizes each step.
+    size_t EstimateBroadphaseMemUsage() const;
+
+    /// Device memory currently held by the contact pair and friction history arrays.
+    size_t EstimateContactMemUsage() const;
+
     /// Get rolling friction torque between body i and j, return 0 if not in contact
     ChVector<float> getRollingFrictionTorque(unsigned int i, unsigned int j);
 
@@ -352,6 +437,10 @@ class CH_GPU_API ChSystemGpu {
 
     ChSystemGpu_impl* m_sys;  ///< underlying system implementation
 
+    std::vector<char> m_pt_staging[2];  ///< alternating staging buffers for asynchronous particle output
+    int m_pt_staging_idx = 0;           ///< staging buffer serialized into next
+    std::thread m_pt_writer;            ///< background thread writing the in-flight particle frame
+
     /// Set particle positions, velocities and angular velocities from a CSV ifstream.
     /// Methods that read sphere position/velocity info from a file serve as its wrapper.
     void ReadCsvParticles(std::ifstream& ifile, unsigned int totRow = UINT_MAX);
@@ -432,6 +521,12 @@ class CH_GPU_API ChSystemGpuMesh : public ChSystemGpu {
     /// Enable/disable mesh collision (for all defined meshes).
     void EnableMeshCollision(bool val);
 
+    /// Enable/disable the BVH-based triangle broadphase. When enabled, a bounding volume
+    /// hierarchy is built over the mesh soup (and refitted each step as the meshes move) and
+    /// queried per subdomain, instead of re-binning every triangle into subdomains each step.
+    /// Recommended for high-resolution meshes. Off by default.
+    void EnableMeshBVH(bool val);
+
     /// Enable/disable mesh normal-based orientation correction.
     void UseMeshNormals(bool val) { use_mesh_normals = val; }
 
@@ -143,6 +143,21 @@ class ChSystemGpuMesh_impl : public ChSystemGpu_impl {
     /// Broadphase CD for triangles
     void runTriangleBroadphase();
 
+    /// Broadphase CD for triangles through the mesh LBVH. Produces the same
+    /// SD_numTrianglesTouching / SD_TrianglesCompositeOffsets / SD_trianglesInEachSD_composite
+    /// arrays as runTriangleBroadphase(), but by querying a bounding volume hierarchy per SD
+    /// instead of re-binning and sorting every triangle each step.
+    void runTriangleBroadphaseBVH();
+
+    /// Build the LBVH over the mesh soup: triangle AABBs, Morton codes, leaf order, radix tree.
+    /// Called once on first use; afterwards only refitMeshBVH() is needed per step since rigid
+    /// motion does not change the tree topology.
+    void buildMeshBVH();
+
+    /// Recompute the world-frame triangle AABBs and propagate them bottom-up through the
+    /// existing tree, following the current family frames.
+    void refitMeshBVH();
+
     virtual double get_max_K() const override;
 
     template <typename T>
@@ -229,6 +244,37 @@ class ChSystemGpuMesh_impl : public ChSystemGpu_impl {
     /// dummy vector used in the broadphase done for the mesh, to understand what SD contains what triangles
     std::vector<unsigned int, cudallocator<unsigned int>> TriangleIDS_ByMultiplicity;
 
+    /// If true, the triangle broadphase is done by querying a BVH over the mesh per SD rather
+    /// than re-binning every triangle into SDs each step. Pays off for high-resolution meshes.
+    bool use_mesh_bvh = false;
+
+    /// Set once buildMeshBVH() has run; afterwards the tree is only refitted each step
+    bool mesh_bvh_built = false;
+
+    /// Per-triangle world-frame AABB corners (SU), indexed by triangle ID
+    std::vector<float3, cudallocator<float3>> Triangle_AABB_min;
+    std::vector<float3, cudallocator<float3>> Triangle_AABB_max;
+
+    /// Morton code of each triangle AABB centroid (and a scratch copy for the sort)
+    std::vector<unsigned int, cudallocator<unsigned int>> Triangle_MortonCodes;
+    std::vector<unsigned int, cudallocator<unsigned int>> Triangle_MortonCodes_sorted;
+
+    /// Triangle IDs in Morton order; entry i is the triangle held by BVH leaf i
+    std::vector<unsigned int, cudallocator<unsigned int>> BVH_leaf_triangles;
+
+    /// BVH node topology. With n leaves there are n-1 internal nodes; node indices
+    /// 0..n-2 are internal (0 is the root) and n-1..2n-2 are the leaves.
+    std::vector<unsigned int, cudallocator<unsigned int>> BVH_node_left;
+    std::vector<unsigned int, cudallocator<unsigned int>> BVH_node_right;
+    std::vector<unsigned int, cudallocator<unsigned int>> BVH_node_parent;
+
+    /// BVH node AABB corners (SU), one entry per node (internal and leaf)
+    std::vector<float3, cudallocator<float3>> BVH_node_AABB_min;
+    std::vector<float3, cudallocator<float3>> BVH_node_AABB_max;
+
+    /// Per-internal-node visit counters used by the bottom-up refit pass
+    std::vector<unsigned int, cudallocator<unsigned int>> BVH_refit_flags;
+
   public:
     /// Get nicer handles to pointer names, enforce const-ness on the mesh params
     typedef const chrono::gpu::ChSystemGpuMesh_impl::MeshParams* MeshParamsPtr;
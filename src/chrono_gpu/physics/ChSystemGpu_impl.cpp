@@ -15,6 +15,9 @@
 #include <cuda.h>
 #include <cuda_runtime.h>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <vector>
 #include <algorithm>
 #include <climits>
@@ -135,6 +138,12 @@ void ChSystemGpu_impl::CreateWallBCs() {
 }
 
 ChSystemGpu_impl::~ChSystemGpu_impl() {
+    if (step_graph_exec != nullptr) {
+        gpuErrchk(cudaGraphExecDestroy(step_graph_exec));
+    }
+    if (step_graph_stream != nullptr) {
+        gpuErrchk(cudaStreamDestroy(step_graph_stream));
+    }
     gpuErrchk(cudaFree(gran_params));
 }
 
@@ -142,6 +151,22 @@ size_t ChSystemGpu_impl::EstimateMemUsage() const {
     return gran_approx_bytes_used;
 }
 
+size_t ChSystemGpu_impl::EstimateBroadphaseMemUsage() const {
+    return SD_NumSpheresTouching.capacity() * sizeof(unsigned int) +
+           SD_SphereCompositeOffsets.capacity() * sizeof(unsigned int) +
+           SD_SphereCompositeOffsets_ScratchPad.capacity() * sizeof(unsigned int) +
+           sphere_owner_SDs.capacity() * sizeof(unsigned int) +
+           spheres_in_SD_composite.capacity() * sizeof(unsigned int);
+}
+
+size_t ChSystemGpu_impl::EstimateContactMemUsage() const {
+    return contact_partners_map.capacity() * sizeof(unsigned int) +
+           contact_active_map.capacity() * sizeof(not_stupid_bool) +
+           contact_history_map.capacity() * sizeof(float3) + contact_duration.capacity() * sizeof(float) +
+           normal_contact_force.capacity() * sizeof(float3) + tangential_friction_force.capacity() * sizeof(float3) +
+           rolling_friction_torque.capacity() * sizeof(float3);
+}
+
 void ChSystemGpu_impl::packSphereDataPointers() {
     // Set data from system
     sphere_data->sphere_local_pos_X = sphere_local_pos_X.data();
@@ -166,6 +191,8 @@ void ChSystemGpu_impl::packSphereDataPointers() {
     sphere_data->sphere_acc_Y = sphere_acc_Y.data();
     sphere_data->sphere_acc_Z = sphere_acc_Z.data();
 
+    sphere_data->forcefield_grid = forcefield_grid.data();
+
     if (time_integrator == CHGPU_TIME_INTEGRATOR::CHUNG) {
         sphere_data->sphere_acc_X_old = sphere_acc_X_old.data();
         sphere_data->sphere_acc_Y_old = sphere_acc_Y_old.data();
@@ -262,6 +289,234 @@ void ChSystemGpu_impl::WriteRawParticles(std::ofstream& ptFile) const {
     }
 }
 
+// Helpers for the serialized particle frame format: 8-byte magic, version, output flags and record count,
+// followed by one fixed-size record per emitted particle
+static const char PT_FRAME_MAGIC[8] = {'C', 'H', 'G', 'P', 'U', 'P', 'T', 'F'};
+static const unsigned int PT_FRAME_VERSION = 1;
+
+template <typename T>
+static void AppendBytes(std::vector<char>& buffer, const T& val) {
+    const char* p = (const char*)&val;
+    buffer.insert(buffer.end(), p, p + sizeof(T));
+}
+
+void ChSystemGpu_impl::SerializeRawParticles(std::vector<char>& buffer) {
+    buffer.clear();
+
+    AppendBytes(buffer, PT_FRAME_MAGIC);
+    AppendBytes(buffer, PT_FRAME_VERSION);
+    AppendBytes(buffer, output_flags);
+
+    // Record count is known only after filtering; patched in place at the end
+    size_t count_offset = buffer.size();
+    unsigned int count = 0;
+    AppendBytes(buffer, count);
+
+    // With the displacement filter active, make sure the reference positions exist; NaN entries compare
+    // false against the threshold, so every particle is emitted on the first frame
+    if (output_min_displacement > 0 && output_last_pos.size() != nSpheres)
+        output_last_pos.assign(nSpheres, make_float3(std::numeric_limits<float>::quiet_NaN(),
+                                                     std::numeric_limits<float>::quiet_NaN(),
+                                                     std::numeric_limits<float>::quiet_NaN()));
+
+    for (unsigned int n = 0; n < nSpheres; n++) {
+        unsigned int ownerSD = sphere_owner_SDs.at(n);
+        int3 ownerSD_trip = getSDTripletFromID(ownerSD);
+        float x_UU = (float)(sphere_local_pos_X[n] * LENGTH_SU2UU);
+        float y_UU = (float)(sphere_local_pos_Y[n] * LENGTH_SU2UU);
+        float z_UU = (float)(sphere_local_pos_Z[n] * LENGTH_SU2UU);
+
+        x_UU += (float)(gran_params->BD_frame_X * LENGTH_SU2UU);
+        y_UU += (float)(gran_params->BD_frame_Y * LENGTH_SU2UU);
+        z_UU += (float)(gran_params->BD_frame_Z * LENGTH_SU2UU);
+
+        x_UU += (float)(((int64_t)ownerSD_trip.x * gran_params->SD_size_X_SU) * LENGTH_SU2UU);
+        y_UU += (float)(((int64_t)ownerSD_trip.y * gran_params->SD_size_Y_SU) * LENGTH_SU2UU);
+        z_UU += (float)(((int64_t)ownerSD_trip.z * gran_params->SD_size_Z_SU) * LENGTH_SU2UU);
+
+        if (output_region_enabled &&
+            (x_UU < output_region_min.x || x_UU > output_region_max.x ||  //
+             y_UU < output_region_min.y || y_UU > output_region_max.y ||  //
+             z_UU < output_region_min.z || z_UU > output_region_max.z))
+            continue;
+
+        if (output_min_displacement > 0) {
+            float dx = x_UU - output_last_pos[n].x;
+            float dy = y_UU - output_last_pos[n].y;
+            float dz = z_UU - output_last_pos[n].z;
+            if (dx * dx + dy * dy + dz * dz < output_min_displacement * output_min_displacement)
+                continue;
+            output_last_pos[n] = make_float3(x_UU, y_UU, z_UU);
+        }
+
+        // Records carry the particle id, since filtering emits a subset
+        AppendBytes(buffer, n);
+        AppendBytes(buffer, x_UU);
+        AppendBytes(buffer, y_UU);
+        AppendBytes(buffer, z_UU);
+
+        if (GET_OUTPUT_SETTING(VEL_COMPONENTS)) {
+            AppendBytes(buffer, (float)(pos_X_dt[n] * LENGTH_SU2UU / TIME_SU2UU));
+            AppendBytes(buffer, (float)(pos_Y_dt[n] * LENGTH_SU2UU / TIME_SU2UU));
+            AppendBytes(buffer, (float)(pos_Z_dt[n] * LENGTH_SU2UU / TIME_SU2UU));
+        }
+
+        if (GET_OUTPUT_SETTING(ABSV)) {
+            float absv = (float)(std::sqrt(pos_X_dt.at(n) * pos_X_dt.at(n) + pos_Y_dt.at(n) * pos_Y_dt.at(n) +
+                                           pos_Z_dt.at(n) * pos_Z_dt.at(n)) *
+                                 VEL_SU2UU);
+            AppendBytes(buffer, absv);
+        }
+
+        if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS && GET_OUTPUT_SETTING(ANG_VEL_COMPONENTS)) {
+            AppendBytes(buffer, (float)(sphere_Omega_X.at(n) / TIME_SU2UU));
+            AppendBytes(buffer, (float)(sphere_Omega_Y.at(n) / TIME_SU2UU));
+            AppendBytes(buffer, (float)(sphere_Omega_Z.at(n) / TIME_SU2UU));
+        }
+
+        count++;
+    }
+
+    std::memcpy(buffer.data() + count_offset, &count, sizeof(unsigned int));
+}
+
+// Helpers for the binary checkpoint format: each array is stored as an element count followed by its raw bytes
+template <typename T, typename A>
+static void WriteBinaryArray(std::ofstream& cpFile, const std::vector<T, A>& vec) {
+    uint64_t count = (uint64_t)vec.size();
+    cpFile.write((const char*)&count, sizeof(uint64_t));
+    if (count > 0)
+        cpFile.write((const char*)vec.data(), count * sizeof(T));
+}
+
+template <typename T, typename A>
+static void ReadBinaryArray(std::ifstream& cpFile, std::vector<T, A>& vec) {
+    uint64_t count = 0;
+    cpFile.read((char*)&count, sizeof(uint64_t));
+    vec.resize((size_t)count);
+    if (count > 0)
+        cpFile.read((char*)vec.data(), count * sizeof(T));
+}
+
+static const char BIN_CHECKPOINT_MAGIC[8] = {'C', 'H', 'G', 'P', 'U', 'B', 'I', 'N'};
+static const unsigned int BIN_CHECKPOINT_VERSION = 1;
+
+void ChSystemGpu_impl::WriteRawCheckpoint(std::ofstream& cpFile) const {
+    // version header, the modes that determine which arrays are meaningful, and the system dimensions
+    cpFile.write(BIN_CHECKPOINT_MAGIC, 8);
+    cpFile.write((const char*)&BIN_CHECKPOINT_VERSION, sizeof(unsigned int));
+    unsigned int friction_mode = (unsigned int)gran_params->friction_mode;
+    unsigned int rolling_mode = (unsigned int)gran_params->rolling_mode;
+    unsigned int integrator = (unsigned int)time_integrator;
+    cpFile.write((const char*)&friction_mode, sizeof(unsigned int));
+    cpFile.write((const char*)&rolling_mode, sizeof(unsigned int));
+    cpFile.write((const char*)&integrator, sizeof(unsigned int));
+    cpFile.write((const char*)&nSpheres, sizeof(unsigned int));
+    cpFile.write((const char*)&nSDs, sizeof(unsigned int));
+    cpFile.write((const char*)&elapsedSimTime, sizeof(float));
+
+    // all persistent per-sphere and per-contact arrays, in SU, bit-for-bit. Arrays not used by the current modes
+    // are empty and only cost their count field
+    WriteBinaryArray(cpFile, sphere_local_pos_X);
+    WriteBinaryArray(cpFile, sphere_local_pos_Y);
+    WriteBinaryArray(cpFile, sphere_local_pos_Z);
+    WriteBinaryArray(cpFile, sphere_owner_SDs);
+    WriteBinaryArray(cpFile, pos_X_dt);
+    WriteBinaryArray(cpFile, pos_Y_dt);
+    WriteBinaryArray(cpFile, pos_Z_dt);
+    WriteBinaryArray(cpFile, sphere_Omega_X);
+    WriteBinaryArray(cpFile, sphere_Omega_Y);
+    WriteBinaryArray(cpFile, sphere_Omega_Z);
+    WriteBinaryArray(cpFile, sphere_acc_X);
+    WriteBinaryArray(cpFile, sphere_acc_Y);
+    WriteBinaryArray(cpFile, sphere_acc_Z);
+    WriteBinaryArray(cpFile, sphere_ang_acc_X);
+    WriteBinaryArray(cpFile, sphere_ang_acc_Y);
+    WriteBinaryArray(cpFile, sphere_ang_acc_Z);
+    WriteBinaryArray(cpFile, sphere_acc_X_old);
+    WriteBinaryArray(cpFile, sphere_acc_Y_old);
+    WriteBinaryArray(cpFile, sphere_acc_Z_old);
+    WriteBinaryArray(cpFile, sphere_ang_acc_X_old);
+    WriteBinaryArray(cpFile, sphere_ang_acc_Y_old);
+    WriteBinaryArray(cpFile, sphere_ang_acc_Z_old);
+    WriteBinaryArray(cpFile, sphere_fixed);
+    WriteBinaryArray(cpFile, contact_partners_map);
+    WriteBinaryArray(cpFile, contact_active_map);
+    WriteBinaryArray(cpFile, contact_history_map);
+    WriteBinaryArray(cpFile, contact_duration);
+    WriteBinaryArray(cpFile, normal_contact_force);
+    WriteBinaryArray(cpFile, tangential_friction_force);
+    WriteBinaryArray(cpFile, rolling_friction_torque);
+}
+
+void ChSystemGpu_impl::ReadRawCheckpoint(std::ifstream& cpFile) {
+    char magic[8];
+    cpFile.read(magic, 8);
+    if (std::memcmp(magic, BIN_CHECKPOINT_MAGIC, 8) != 0)
+        CHGPU_ERROR("ERROR! File is not a Chrono::Gpu binary checkpoint!\n");
+    unsigned int version;
+    cpFile.read((char*)&version, sizeof(unsigned int));
+    if (version != BIN_CHECKPOINT_VERSION)
+        CHGPU_ERROR("ERROR! Binary checkpoint version %u is not supported (expected %u)!\n", version,
+                    BIN_CHECKPOINT_VERSION);
+
+    // the restored arrays are only meaningful if the system was set up with the same modes and particle count
+    unsigned int friction_mode, rolling_mode, integrator, cp_nSpheres, cp_nSDs;
+    cpFile.read((char*)&friction_mode, sizeof(unsigned int));
+    cpFile.read((char*)&rolling_mode, sizeof(unsigned int));
+    cpFile.read((char*)&integrator, sizeof(unsigned int));
+    cpFile.read((char*)&cp_nSpheres, sizeof(unsigned int));
+    cpFile.read((char*)&cp_nSDs, sizeof(unsigned int));
+    if (friction_mode != (unsigned int)gran_params->friction_mode ||
+        rolling_mode != (unsigned int)gran_params->rolling_mode || integrator != (unsigned int)time_integrator)
+        CHGPU_ERROR("ERROR! Binary checkpoint friction/rolling/integrator modes do not match this system!\n");
+    if (cp_nSpheres != nSpheres)
+        CHGPU_ERROR(
+            "ERROR! Binary checkpoint holds %u particles but this system has %u. Initialize() must be called with "
+            "the same setup before restoring!\n",
+            cp_nSpheres, nSpheres);
+    if (cp_nSDs != nSDs)
+        CHGPU_ERROR("ERROR! Binary checkpoint subdomain count does not match this system!\n");
+    cpFile.read((char*)&elapsedSimTime, sizeof(float));
+
+    ReadBinaryArray(cpFile, sphere_local_pos_X);
+    ReadBinaryArray(cpFile, sphere_local_pos_Y);
+    ReadBinaryArray(cpFile, sphere_local_pos_Z);
+    ReadBinaryArray(cpFile, sphere_owner_SDs);
+    ReadBinaryArray(cpFile, pos_X_dt);
+    ReadBinaryArray(cpFile, pos_Y_dt);
+    ReadBinaryArray(cpFile, pos_Z_dt);
+    ReadBinaryArray(cpFile, sphere_Omega_X);
+    ReadBinaryArray(cpFile, sphere_Omega_Y);
+    ReadBinaryArray(cpFile, sphere_Omega_Z);
+    ReadBinaryArray(cpFile, sphere_acc_X);
+    ReadBinaryArray(cpFile, sphere_acc_Y);
+    ReadBinaryArray(cpFile, sphere_acc_Z);
+    ReadBinaryArray(cpFile, sphere_ang_acc_X);
+    ReadBinaryArray(cpFile, sphere_ang_acc_Y);
+    ReadBinaryArray(cpFile, sphere_ang_acc_Z);
+    ReadBinaryArray(cpFile, sphere_acc_X_old);
+    ReadBinaryArray(cpFile, sphere_acc_Y_old);
+    ReadBinaryArray(cpFile, sphere_acc_Z_old);
+    ReadBinaryArray(cpFile, sphere_ang_acc_X_old);
+    ReadBinaryArray(cpFile, sphere_ang_acc_Y_old);
+    ReadBinaryArray(cpFile, sphere_ang_acc_Z_old);
+    ReadBinaryArray(cpFile, sphere_fixed);
+    ReadBinaryArray(cpFile, contact_partners_map);
+    ReadBinaryArray(cpFile, contact_active_map);
+    ReadBinaryArray(cpFile, contact_history_map);
+    ReadBinaryArray(cpFile, contact_duration);
+    ReadBinaryArray(cpFile, normal_contact_force);
+    ReadBinaryArray(cpFile, tangential_friction_force);
+    ReadBinaryArray(cpFile, rolling_friction_torque);
+
+    if (!cpFile.good())
+        CHGPU_ERROR("ERROR! Binary checkpoint file ended prematurely!\n");
+
+    // any resize above may have reallocated the unified-memory buffers
+    packSphereDataPointers();
+}
+
 void ChSystemGpu_impl::WriteCsvParticles(std::ofstream& ptFile) const {
     // Dump to a stream, write to file only at end
     std::ostringstream outstrstream;
@@ -1107,6 +1362,48 @@ bool ChSystemGpu_impl::GetBCReactionForces(size_t BC_id, float3& force) const {
     return true;
 }
 
+void ChSystemGpu_impl::EnableForceFieldGrid(float3 min_corner, float3 max_corner, int3 num_cells) {
+    if (num_cells.x <= 0 || num_cells.y <= 0 || num_cells.z <= 0 ||  //
+        max_corner.x <= min_corner.x || max_corner.y <= min_corner.y || max_corner.z <= min_corner.z) {
+        printf("ERROR: EnableForceFieldGrid called with a degenerate grid\n");
+        return;
+    }
+
+    forcefield_min_UU = min_corner;
+    forcefield_max_UU = max_corner;
+    gran_params->forcefield_cells_X = (unsigned int)num_cells.x;
+    gran_params->forcefield_cells_Y = (unsigned int)num_cells.y;
+    gran_params->forcefield_cells_Z = (unsigned int)num_cells.z;
+
+    size_t num_entries = (size_t)num_cells.x * (size_t)num_cells.y * (size_t)num_cells.z;
+    forcefield_grid.resize(num_entries, make_float3(0.f, 0.f, 0.f));
+    sphere_data->forcefield_grid = forcefield_grid.data();
+
+    // The SU grid parameters are refreshed at every step (the big domain frame can move)
+    gran_params->forcefield_enabled = true;
+}
+
+void ChSystemGpu_impl::DisableForceFieldGrid() {
+    gran_params->forcefield_enabled = false;
+    forcefield_grid.clear();
+    sphere_data->forcefield_grid = nullptr;
+}
+
+void ChSystemGpu_impl::GetForceFieldGrid(std::vector<float3>& forces) const {
+    if (!gran_params->forcefield_enabled) {
+        printf("ERROR: GetForceFieldGrid called with no force-field grid enabled\n");
+        forces.clear();
+        return;
+    }
+
+    forces.resize(forcefield_grid.size());
+    for (size_t i = 0; i < forcefield_grid.size(); i++) {
+        forces[i].x = (float)(forcefield_grid[i].x * FORCE_SU2UU);
+        forces[i].y = (float)(forcefield_grid[i].y * FORCE_SU2UU);
+        forces[i].z = (float)(forcefield_grid[i].z * FORCE_SU2UU);
+    }
+}
+
 void ChSystemGpu_impl::convertBCUnits() {
     for (int i = 0; i < BC_type_list.size(); i++) {
         auto bc_type = BC_type_list.at(i);
@@ -1287,6 +1584,27 @@ float3 ChSystemGpu_impl::GetParticlePosition(int nSphere) const {
     return make_float3(x_UU, y_UU, z_UU);
 }
 
+// return positions of all particles in user units in one bulk pass
+void ChSystemGpu_impl::GetParticlePositions(std::vector<float3>& positions) const {
+    positions.resize(nSpheres);
+    // hoist the quantities that are identical for every sphere out of the loop
+    const float BD_frame_X_UU = (float)(gran_params->BD_frame_X * LENGTH_SU2UU);
+    const float BD_frame_Y_UU = (float)(gran_params->BD_frame_Y * LENGTH_SU2UU);
+    const float BD_frame_Z_UU = (float)(gran_params->BD_frame_Z * LENGTH_SU2UU);
+#pragma omp parallel for
+    for (int nSphere = 0; nSphere < (int)nSpheres; nSphere++) {
+        unsigned int ownerSD = sphere_owner_SDs[nSphere];
+        int3 ownerSD_trip = getSDTripletFromID(ownerSD);
+        float x_UU = (float)(sphere_local_pos_X[nSphere] * LENGTH_SU2UU) + BD_frame_X_UU +
+                     (float)(((int64_t)ownerSD_trip.x * gran_params->SD_size_X_SU) * LENGTH_SU2UU);
+        float y_UU = (float)(sphere_local_pos_Y[nSphere] * LENGTH_SU2UU) + BD_frame_Y_UU +
+                     (float)(((int64_t)ownerSD_trip.y * gran_params->SD_size_Y_SU) * LENGTH_SU2UU);
+        float z_UU = (float)(sphere_local_pos_Z[nSphere] * LENGTH_SU2UU) + BD_frame_Z_UU +
+                     (float)(((int64_t)ownerSD_trip.z * gran_params->SD_size_Z_SU) * LENGTH_SU2UU);
+        positions[nSphere] = make_float3(x_UU, y_UU, z_UU);
+    }
+}
+
 /// Set particle position
 void ChSystemGpu_impl::SetParticlePosition(int nSphere, double3 position) {
     // // convert user unit to simulation unit
@@ -1409,7 +1727,7 @@ void ChSystemGpu_impl::partitionBD() {
     CreateWallBCs();
     setBDWallsMotionFunction(GranPosFunction_default);
 
-    double sd_length_scale = 2.0 * sphere_radius_UU * AVERAGE_SPHERES_PER_SD_X_DIR;
+    double sd_length_scale = 2.0 * sphere_radius_UU * AVERAGE_SPHERES_PER_SD_X_DIR * sd_size_factor;
 
     unsigned int nSDs_X = (unsigned int)(std::ceil(box_size_X / sd_length_scale));
     // work with an even kFac to hit the CM of the box.
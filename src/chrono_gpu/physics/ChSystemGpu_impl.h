@@ -172,6 +172,18 @@ class ChSystemGpu_impl {
         float cohesionAcc_s2s;  ///< Constant acceleration of sphere-to-sphere cohesion
         float adhesionAcc_s2w;  ///< Accleration of adhesion
 
+        /// Whether per-step contact forces are accumulated into the force-field grid (see EnableForceFieldGrid)
+        bool forcefield_enabled = false;
+        unsigned int forcefield_cells_X;  ///< Number of force-field grid cells in the X direction
+        unsigned int forcefield_cells_Y;  ///< Number of force-field grid cells in the Y direction
+        unsigned int forcefield_cells_Z;  ///< Number of force-field grid cells in the Z direction
+        int64_t forcefield_origin_X;      ///< X of the lower grid corner in the big domain frame, expressed in SU
+        int64_t forcefield_origin_Y;      ///< Y of the lower grid corner in the big domain frame, expressed in SU
+        int64_t forcefield_origin_Z;      ///< Z of the lower grid corner in the big domain frame, expressed in SU
+        double forcefield_inv_cell_X;     ///< Reciprocal of the force-field cell X dimension, expressed in SU
+        double forcefield_inv_cell_Y;     ///< Reciprocal of the force-field cell Y dimension, expressed in SU
+        double forcefield_inv_cell_Z;     ///< Reciprocal of the force-field cell Z dimension, expressed in SU
+
         double LENGTH_UNIT;  ///< 1 / C_L. Any length expressed in SU is a multiple of LENGTH_UNIT
         double TIME_UNIT;    ///< 1 / C_T. Any time quantity in SU is measured as a positive multiple of TIME_UNIT
         double MASS_UNIT;    ///< 1 / C_M. Any mass quantity is measured as a positive multiple of MASS_UNIT
@@ -233,6 +245,8 @@ class ChSystemGpu_impl {
         float* char_collision_time;         ///< Track characteristic collision time
         float3* v_rot_array;                ///< Track v_rot array
 
+        float3* forcefield_grid;  ///< Per-cell contact force accumulators of the force-field grid (X index fastest)
+
         unsigned int* SD_NumSpheresTouching;         ///< Number of particles touching each subdomain
         unsigned int* SD_SphereCompositeOffsets;     ///< Offset of each subdomain in the big composite array
         unsigned int* SD_SphereCompositeOffsets_SP;  ///< like SD_SphereCompositeOffsets, scratch pad (SP) used
@@ -359,6 +373,10 @@ class ChSystemGpu_impl {
     /// Return particle position.
     float3 GetParticlePosition(int nSphere) const;
 
+    /// Write the positions of all particles into the provided vector (resized as needed).
+    /// A single bulk pass is much cheaper than querying particles one at a time.
+    void GetParticlePositions(std::vector<float3>& positions) const;
+
     /// Set particle position
     void SetParticlePosition(int nSphere, double3 position);
 
@@ -398,6 +416,18 @@ class ChSystemGpu_impl {
     /// Get the reaction forces on a boundary by ID, returns false if the forces are invalid (bad BC ID)
     bool GetBCReactionForces(size_t BC_id, float3& force) const;
 
+    /// Define a device-resident uniform grid over which contact forces are accumulated at each time step.
+    /// The grid covers the axis-aligned box [min_corner, max_corner] (user units) with the given number of cells
+    /// per direction; particles outside the box are ignored.
+    void EnableForceFieldGrid(float3 min_corner, float3 max_corner, int3 num_cells);
+
+    /// Disable force-field grid accumulation.
+    void DisableForceFieldGrid();
+
+    /// Write the force field accumulated over the last time step into the provided vector (resized as needed).
+    /// Forces are expressed in user units, with the cell X index running fastest.
+    void GetForceFieldGrid(std::vector<float3>& forces) const;
+
     /// Set initial particle positions. MUST be called only once and MUST be called before initialize
     void SetParticles(const std::vector<float3>& points,
                       const std::vector<float3>& vels = std::vector<float3>(),
@@ -412,6 +442,25 @@ class ChSystemGpu_impl {
     /// Requires initialize() to have been called
     virtual double AdvanceSimulation(float duration);
 
+    /// Launch the per-step force computation and integration kernel sequence on the given
+    /// stream. Factored out of AdvanceSimulation() so the same sequence can be captured into a
+    /// CUDA graph; stream ordering replaces the synchronizations of the eager path.
+    void launchStepKernels(cudaStream_t stream);
+
+    /// Make sure the instantiated CUDA graph of the per-step kernel sequence matches the
+    /// current configuration, re-capturing it when a relevant setting has changed.
+    void updateStepGraph();
+
+    /// Launch the per-step force computation and integration kernel sequence decomposed over
+    /// the devices in multigpu_devices. Each device handles a contiguous slab of the SD grid
+    /// (and the corresponding range of sphere indices); halo reads between slabs go through
+    /// unified memory with peer access enabled. Owner-computes force accumulation keeps the
+    /// per-sphere writes of different devices disjoint.
+    void launchStepKernelsMultiGpu();
+
+    /// Enable peer access between all device pairs in multigpu_devices (once).
+    void setupMultiGpu();
+
     /// This method figures out how big a SD is, and how many SDs are going to be necessary
     /// in order to cover the entire BD.
     /// Nomenclature: BD: Big domain, SD: Sub-domain.
@@ -425,6 +474,9 @@ class ChSystemGpu_impl {
     /// Reset sphere accelerations
     void resetSphereAccelerations();
 
+    /// Zero the force-field grid accumulators and refresh the grid parameters in SU (the big domain frame can move)
+    void resetForceFieldGrid();
+
     /// Reset sphere-wall forces
     void resetBCForces();
 
@@ -483,12 +535,28 @@ class ChSystemGpu_impl {
 
     /// Write particle positions, vels and ang vels to a file stream (based on a format)
     void WriteRawParticles(std::ofstream& ptFile) const;
+
+    /// Serialize one particle output frame into the given buffer (cleared first). The frame carries a version
+    /// header, the active output flags and a record count, followed by one fixed-size record (particle id,
+    /// position and the flagged velocity fields) per emitted particle. The optional region and displacement
+    /// filters are applied here; with the displacement filter active, the reference positions of the emitted
+    /// particles are updated.
+    void SerializeRawParticles(std::vector<char>& buffer);
     void WriteCsvParticles(std::ofstream& ptFile) const;
     void WriteChPFParticles(std::ofstream& ptFile) const;
 #ifdef USE_HDF5
     void WriteH5Particles(H5::H5File& ptFile) const;
 #endif
 
+    /// Write all persistent device-state arrays to a stream in raw binary form, with a version header. Unlike the
+    /// ASCII checkpoint this preserves the state bit-for-bit, including the multi-step friction history maps.
+    void WriteRawCheckpoint(std::ofstream& cpFile) const;
+
+    /// Restore all persistent device-state arrays from a stream written by WriteRawCheckpoint. The system must have
+    /// been initialized with the same particle count and friction/rolling/integrator modes; the stored arrays then
+    /// overwrite the device state in place so the simulation resumes warm.
+    void ReadRawCheckpoint(std::ifstream& cpFile);
+
     /// Write contact info file
     void WriteContactInfoFile(const std::string& outfilename) const;
 
@@ -513,6 +581,13 @@ class ChSystemGpu_impl {
     /// Rough estimate of the total amount of memory used by the system.
     size_t EstimateMemUsage() const;
 
+    /// Device memory currently held by the broadphase subdomain arrays (touch counts, offsets and the compacted
+    /// sphere-subdomain adjacency). The adjacency part varies per step with the actual packing.
+    size_t EstimateBroadphaseMemUsage() const;
+
+    /// Device memory currently held by the contact pair and friction history arrays.
+    size_t EstimateContactMemUsage() const;
+
     // Conversion factors from SU to UU
     /// 1 / C_L. Any length expressed in SU is a multiple of SU2UU
     double LENGTH_SU2UU;
@@ -557,6 +632,37 @@ class ChSystemGpu_impl {
     /// each other
     bool defragment_on_start = true;
 
+    /// If true, the per-step force/integration kernel sequence is launched through a captured
+    /// CUDA graph, cutting the per-launch overhead that dominates at very small time steps.
+    /// The graph is re-captured whenever a relevant setting changes.
+    bool use_step_graph = false;
+
+    cudaStream_t step_graph_stream = nullptr;   ///< stream used to capture and launch the step graph
+    cudaGraphExec_t step_graph_exec = nullptr;  ///< instantiated CUDA graph of the step kernel sequence
+
+    /// Configuration signature the step graph was last captured with; a mismatch with the
+    /// current settings triggers a re-capture in updateStepGraph().
+    struct {
+        unsigned int nSpheres = 0;
+        unsigned int nSDs = 0;
+        float stepSize_SU = 0;
+        CHGPU_FRICTION_MODE friction_mode = CHGPU_FRICTION_MODE::FRICTIONLESS;
+        bool use_mat_based = false;
+        size_t num_BCs = 0;
+        const void* BC_params_ptr = nullptr;
+        bool forcefield_enabled = false;
+    } step_graph_config;
+
+    /// Devices used for the per-step kernels. With fewer than two entries the simulation is
+    /// single-device; with two or more, AdvanceSimulation() splits the SD grid (and sphere index
+    /// range) into contiguous slabs, one per device. All state stays in unified memory, so the
+    /// halo exchange between neighboring slabs is handled by peer-to-peer page mapping rather
+    /// than explicit messaging. Broadphase and boundary-condition updates remain on the first
+    /// device listed.
+    std::vector<int> multigpu_devices;
+
+    bool multigpu_peer_enabled = false;  ///< peer access between multigpu_devices established
+
     /// Bit flags indicating what fields to write out during WriteParticleFile
     /// Set with the CHGPU_OUTPUT_FLAGS enum
     unsigned int output_flags;
@@ -565,6 +671,16 @@ class ChSystemGpu_impl {
     /// Default is CSV
     CHGPU_OUTPUT_MODE file_write_mode;
 
+    /// Restrict serialized particle output to an axis-aligned box (in UU)?
+    bool output_region_enabled = false;
+    float3 output_region_min;  ///< lower corner of the output region (UU)
+    float3 output_region_max;  ///< upper corner of the output region (UU)
+
+    /// When positive, serialized output only emits particles that moved farther than this (in UU) since they
+    /// were last written
+    float output_min_displacement = 0;
+    std::vector<float3> output_last_pos;  ///< positions at which each particle was last emitted (UU)
+
     /// Number of discrete elements
     unsigned int nSpheres;
     /// Number of subdomains
@@ -649,6 +765,13 @@ class ChSystemGpu_impl {
     /// Tracks v_rot
     std::vector<float3, cudallocator<float3>> v_rot_array;
 
+    /// Per-cell force accumulators of the optional force-field grid, in unified memory
+    std::vector<float3, cudallocator<float3>> forcefield_grid;
+    /// Lower corner of the force-field grid, in user units
+    float3 forcefield_min_UU;
+    /// Upper corner of the force-field grid, in user units
+    float3 forcefield_max_UU;
+
     /// X gravity in user units
     float X_accGrav;
     /// Y gravity in user units
@@ -792,6 +915,9 @@ class ChSystemGpu_impl {
     /// Allow the user to set the big domain to be fixed, ignoring any given position functions
     bool BD_is_fixed = true;
 
+    /// User multiplier on the default subdomain edge length used by partitionBD()
+    double sd_size_factor = 1.0;
+
   public:
     // Do two things: make the naming nicer and require a const pointer everywhere
 
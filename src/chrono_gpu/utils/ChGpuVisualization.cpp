@@ -120,8 +120,11 @@ bool ChGpuVisualization::Render() {
     m_system->SetChTime(m_systemGPU->GetSimTime());
 
     if (m_vsys->Run()) {
-        for (unsigned int i = 0; i < m_systemGPU->GetNumParticles(); i++) {
-            m_particles->GetParticle(i).SetPos(m_systemGPU->GetParticlePosition(i));
+        // Read back all particle positions in one bulk query, then scatter them into the proxy cloud.
+        m_systemGPU->GetParticlePositions(m_particle_positions);
+#pragma omp parallel for
+        for (int i = 0; i < (int)m_particle_positions.size(); i++) {
+            m_particles->GetParticle(i).SetPos(m_particle_positions[i]);
         }
         m_vsys->Render();
         return true;
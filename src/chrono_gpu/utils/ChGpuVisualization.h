@@ -104,7 +104,8 @@ class CH_GPU_API ChGpuVisualization {
     opengl::ChVisualSystemOpenGL* m_vsys;  ///< OpenGL visualization system
 #endif
 
-    std::shared_ptr<ChParticleCloud> m_particles;  ///< particle cloud proxy for particles
+    std::shared_ptr<ChParticleCloud> m_particles;        ///< particle cloud proxy for particles
+    std::vector<ChVector<float>> m_particle_positions;   ///< scratch buffer for bulk position readback
 };
 
 /// @} gpu_utils
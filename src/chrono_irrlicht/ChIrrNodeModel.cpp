@@ -14,6 +14,7 @@
 #include "chrono/physics/ChParticleCloud.h"
 #include "chrono_irrlicht/ChIrrNodeModel.h"
 #include "chrono_irrlicht/ChIrrNodeShape.h"
+#include "chrono_irrlicht/ChVisualSystemIrrlicht.h"
 
 namespace chrono {
 namespace irrlicht {
@@ -24,7 +25,7 @@ ChIrrNodeModel::ChIrrNodeModel(std::weak_ptr<ChPhysicsItem> physicsitem,
                                scene::ISceneNode* parent,
                                scene::ISceneManager* mgr,
                                s32 id)
-    : ISceneNode(parent, mgr, id), m_physicsitem(physicsitem) {
+    : ISceneNode(parent, mgr, id), m_physicsitem(physicsitem), m_vis(nullptr) {
 #ifdef _DEBUG
     setDebugName("ChIrrNodeModel");
 #endif
@@ -100,6 +101,17 @@ void ChIrrNodeModel::OnAnimate(u32 timeMs) {
     if (IsVisible) {
         // reorient/reposition the scene node
         if (!m_clones) {
+            // If a pose snapshot was acquired for this render frame, align from it rather than from the
+            // live item state (which may be mid-step when the physics loop runs on another thread).
+            const ChVisualSystem::PoseSnapshot* snapshot = m_vis ? m_vis->GetCurrentPoseSnapshot() : nullptr;
+            if (snapshot) {
+                auto pose = snapshot->indices.find(m_physicsitem.lock().get());
+                if (pose != snapshot->indices.end()) {
+                    tools::alignIrrlichtNode(this, snapshot->poses[pose->second].GetCoord());
+                    ISceneNode::OnAnimate(timeMs);
+                    return;
+                }
+            }
             tools::alignIrrlichtNode(this, m_physicsitem.lock()->GetVisualModelFrame().GetCoord());
         } else if (m_physicsitem.lock()->GetNumVisualModelClones() > 0) {
             // check that children clones are already as many as assets frame clones, and adjust if not
@@ -30,6 +30,8 @@ namespace irrlicht {
 /// @addtogroup irrlicht_module
 /// @{
 
+class ChVisualSystemIrrlicht;
+
 /// Irrlicht scene node associated with the visual model of a physics item.
 /// Such a node contains children nodes for each visual shape in the physics item's visual model.
 class ChApiIrr ChIrrNodeModel : public irr::scene::ISceneNode {
@@ -50,6 +52,11 @@ class ChApiIrr ChIrrNodeModel : public irr::scene::ISceneNode {
     /// Get the physics item associated with this scene node.
     std::weak_ptr<ChPhysicsItem> GetPhysicsItem() { return m_physicsitem; }
 
+    /// Set the visualization system managing this scene node.
+    /// When set and pose snapshots are enabled on it, the node is realigned from the snapshot of the current
+    /// render frame instead of the live physics item state.
+    void SetVisualSystem(ChVisualSystemIrrlicht* vis) { m_vis = vis; }
+
     /// Update the chidlren Irrlicht nodes associated with individual visual shapes.
     void UpdateChildren();
 
@@ -69,6 +76,7 @@ class ChApiIrr ChIrrNodeModel : public irr::scene::ISceneNode {
     irr::core::aabbox3d<irr::f32> m_box;
     std::weak_ptr<ChPhysicsItem> m_physicsitem;
     bool m_clones;
+    ChVisualSystemIrrlicht* m_vis;
 };
 
 /// @} irrlicht_module
@@ -229,6 +229,7 @@ void ChVisualSystemIrrlicht::OnUpdate(ChSystem* sys) {
     for (auto& node : m_nodes) {
         node.second->UpdateChildren();
     }
+    PublishPoseSnapshot();
 }
 
 void ChVisualSystemIrrlicht::OnClear(ChSystem* sys) {
@@ -583,6 +584,10 @@ void ChVisualSystemIrrlicht::EndScene() {
 void ChVisualSystemIrrlicht::Render() {
     assert(!m_systems.empty());
 
+    // Acquire the latest pose snapshot once per frame, so that all scene nodes of this frame
+    // are drawn from the same coherent set of poses.
+    m_pose_snapshot = PoseSnapshotsEnabled() ? GetLatestPoseSnapshot() : nullptr;
+
     if (m_use_effects)
         m_effect_handler->update();  // draw 3D scene using Xeffects for shadow maps
     else
@@ -727,6 +732,7 @@ void ChVisualSystemIrrlicht::CreateIrrNode(std::shared_ptr<ChPhysicsItem> item)
 
     // Create a new ChIrrNodeModel and populate it
     auto node = chrono_types::make_shared<ChIrrNodeModel>(item, m_container, GetSceneManager(), 0);
+    node->SetVisualSystem(this);
     bool ok = m_nodes.insert({item.get(), node}).second;
     assert(ok);
 
@@ -229,6 +229,11 @@ class ChApiIrr ChVisualSystemIrrlicht : virtual public ChVisualSystem {
     irr::scene::ICameraSceneNode* GetActiveCamera() { return m_device->getSceneManager()->getActiveCamera(); }
     irr::gui::IGUIEnvironment* GetGUIEnvironment() { return m_device->getGUIEnvironment(); }
 
+    /// Get the pose snapshot acquired for the current render frame (null if pose snapshots are disabled or none
+    /// was published yet). Acquired once at the beginning of Render(), so that all scene nodes of one frame are
+    /// drawn from the same coherent set of poses; consumed by the ChIrrNodeModel scene nodes.
+    const PoseSnapshot* GetCurrentPoseSnapshot() const { return m_pose_snapshot; }
+
     /// Process all visual assets in the associated ChSystem.
     /// This function is called by default by Initialize(), but can also be called later if further modifications to
     /// visualization assets occur.
@@ -346,6 +351,7 @@ class ChApiIrr ChVisualSystemIrrlicht : virtual public ChVisualSystem {
     bool m_use_effects;                                ///< flag to enable/disable effects
     bool m_modal;                                      ///< visualize modal analysis
     bool m_utility_flag = false;                       ///< utility flag that may be accessed from outside
+    const PoseSnapshot* m_pose_snapshot = nullptr;     ///< pose snapshot acquired for the current render frame
 
     // shared meshes
     irr::scene::IAnimatedMesh* sphereMesh;
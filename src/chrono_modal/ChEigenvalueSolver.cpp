@@ -114,47 +114,77 @@ void placeMatrix(Eigen::SparseMatrix<double, Eigen::ColMajor, int>& HCQ, const C
 }
 
 
-bool ChGeneralizedEigenvalueSolverKrylovSchur::Solve(const ChSparseMatrix& M,  ///< input M matrix, n_v x n_v
-        const ChSparseMatrix& K,  ///< input K matrix, n_v x n_v  
-        const ChSparseMatrix& Cq, ///< input Cq matrix of constraint jacobians, n_c x n_v
-        ChMatrixDynamic<std::complex<double>>& V,    ///< output matrix n x n_v with eigenvectors as columns, will be resized
-        ChVectorDynamic<std::complex<double>>& eig,  ///< output vector with n eigenvalues, will be resized.
-        ChVectorDynamic<double>& freq,  ///< output vector with n frequencies [Hz], as f=w/(2*PI), will be resized.
-        ChEigenvalueSolverSettings settings  ///< optional: settings for the solver, or n. of desired lower eigenvalues. If =0, return all eigenvalues.
-) const           
+double ChGeneralizedEigenvalueSolver::BuildUndampedEigenProblemMatrices(
+        const ChSparseMatrix& M,         ///< input M matrix, n_v x n_v
+        const ChSparseMatrix& K,         ///< input K matrix, n_v x n_v
+        const ChSparseMatrix& Cq,        ///< input Cq matrix of constraint jacobians, n_c x n_v
+        Eigen::SparseMatrix<double>& A,  ///< output A matrix, will be resized
+        Eigen::SparseMatrix<double>& B,  ///< output B matrix, will be resized
+        bool scaleCq                     ///< apply scaling to the Cq blocks
+)
 {
-	// Assembly the A and B for the generalized constrained eigenvalue problem. 
+	// Assembly the A and B for the generalized constrained eigenvalue problem.
 	// Note that those sparse matrices must be column-major for better compatibility with Spectra.
 	int n_vars   = M.rows();
 	int n_constr = Cq.rows();
 
-	// Scale constraints matrix
-	double scaling = 0;
-	if (settings.scaleCq) {
+	// Scaling of the constraints jacobians to improve conditioning. The scaling affects only the
+	// Lagrange multiplier part of the eigenvectors, which is discarded, so it is applied while
+	// placing the Cq blocks rather than by modifying the input matrix.
+	double scaling = 1.0;
+	if (scaleCq) {
 		//GetLog() << "Scaling Cq\n";
 		scaling = K.diagonal().mean();
-		for (int k = 0; k < Cq.outerSize(); ++k)
-			for (ChSparseMatrix::InnerIterator it(Cq, k); it; ++it) {
-				it.valueRef() *= scaling;
-			}
 	}
 
 	// A  =  [ -K   -Cq' ]
 	//       [ -Cq    0  ]
-	Eigen::SparseMatrix<double> A(n_vars + n_constr, n_vars + n_constr);
+	A.resize(n_vars + n_constr, n_vars + n_constr);
 	A.setZero();
 	placeMatrix(A, -K, 0, 0);
-	placeMatrix(A, -Cq.transpose(), 0, n_vars);
-	placeMatrix(A, -Cq, n_vars, 0);
+	placeMatrix(A, -scaling * Cq.transpose(), 0, n_vars);
+	placeMatrix(A, -scaling * Cq, n_vars, 0);
 	A.makeCompressed();
 
 	// B  =  [  M     0  ]
 	//       [  0     0  ]
-	Eigen::SparseMatrix<double> B(n_vars + n_constr, n_vars + n_constr);
+	B.resize(n_vars + n_constr, n_vars + n_constr);
 	B.setZero();
 	placeMatrix(B, M, 0, 0);
 	B.makeCompressed();
 
+	return scaling;
+}
+
+
+bool ChGeneralizedEigenvalueSolverKrylovSchur::Solve(const ChSparseMatrix& M,  ///< input M matrix, n_v x n_v
+        const ChSparseMatrix& K,  ///< input K matrix, n_v x n_v
+        const ChSparseMatrix& Cq, ///< input Cq matrix of constraint jacobians, n_c x n_v
+        ChMatrixDynamic<std::complex<double>>& V,    ///< output matrix n x n_v with eigenvectors as columns, will be resized
+        ChVectorDynamic<std::complex<double>>& eig,  ///< output vector with n eigenvalues, will be resized.
+        ChVectorDynamic<double>& freq,  ///< output vector with n frequencies [Hz], as f=w/(2*PI), will be resized.
+        ChEigenvalueSolverSettings settings  ///< optional: settings for the solver, or n. of desired lower eigenvalues. If =0, return all eigenvalues.
+) const
+{
+	Eigen::SparseMatrix<double> A;
+	Eigen::SparseMatrix<double> B;
+	BuildUndampedEigenProblemMatrices(M, K, Cq, A, B, settings.scaleCq);
+
+	return Solve(A, B, (int)M.rows(), V, eig, freq, settings);
+}
+
+
+bool ChGeneralizedEigenvalueSolverKrylovSchur::Solve(const Eigen::SparseMatrix<double>& A,  ///< input A matrix
+        const Eigen::SparseMatrix<double>& B,  ///< input B matrix
+        int n_vars,               ///< number of variables (the rest of A being the constraint block)
+        ChMatrixDynamic<std::complex<double>>& V,    ///< output matrix n x n_v with eigenvectors as columns, will be resized
+        ChVectorDynamic<std::complex<double>>& eig,  ///< output vector with n eigenvalues, will be resized.
+        ChVectorDynamic<double>& freq,  ///< output vector with n frequencies [Hz], as f=w/(2*PI), will be resized.
+        ChEigenvalueSolverSettings settings  ///< optional: settings for the solver, or n. of desired lower eigenvalues. If =0, return all eigenvalues.
+) const
+{
+	int n_constr = (int)A.rows() - n_vars;
+
 	int m = 2 * settings.n_modes >= 30 ? 2 * settings.n_modes : 30;  // minimum subspace size   //**TO DO*** make parametric?
 	if (m > n_vars + n_constr-1)
 		m = n_vars + n_constr-1;
@@ -163,9 +193,9 @@ bool ChGeneralizedEigenvalueSolverKrylovSchur::Solve(const ChSparseMatrix& M,  /
 
 	// Construct matrix operation objects using the wrapper classes
 	using OpType = SymShiftInvert<double, Eigen::Sparse, Eigen::Sparse>;
-    using BOpType = SparseSymMatProd<double>;
-    OpType op(A, B);
-    BOpType Bop(B);
+	using BOpType = SparseSymMatProd<double>;
+	OpType op(A, B);
+	BOpType Bop(B);
 
 	// Dump data for test. ***TODO*** remove when well tested
 	if (false)
@@ -222,7 +252,7 @@ bool ChGeneralizedEigenvalueSolverKrylovSchur::Solve(const ChSparseMatrix& M,  /
 	}
 
     // Return values
-    V.setZero(M.rows(), settings.n_modes);
+    V.setZero(n_vars, settings.n_modes);
     eig.setZero(settings.n_modes);
 	freq.setZero(settings.n_modes);
 
@@ -238,36 +268,34 @@ bool ChGeneralizedEigenvalueSolverKrylovSchur::Solve(const ChSparseMatrix& M,  /
 
 
 bool ChGeneralizedEigenvalueSolverLanczos::Solve(const ChSparseMatrix& M,  ///< input M matrix, n_v x n_v
-        const ChSparseMatrix& K,  ///< input K matrix, n_v x n_v  
+        const ChSparseMatrix& K,  ///< input K matrix, n_v x n_v
         const ChSparseMatrix& Cq, ///< input Cq matrix of constraint jacobians, n_c x n_v
         ChMatrixDynamic<std::complex<double>>& V,    ///< output matrix n x n_v with eigenvectors as columns, will be resized
         ChVectorDynamic<std::complex<double>>& eig,  ///< output vector with n eigenvalues, will be resized.
         ChVectorDynamic<double>& freq,  ///< output vector with n frequencies [Hz], as f=w/(2*PI), will be resized.
-        ChEigenvalueSolverSettings settings ///< optional: settings for the solver, or n. of desired lower eigenvalues. If =0, return all eigenvalues.) 
+        ChEigenvalueSolverSettings settings ///< optional: settings for the solver, or n. of desired lower eigenvalues. If =0, return all eigenvalues.)
 )  const
 {
-	// Assembly the A and B for the generalized constrained eigenvalue problem. 
-	// Note that those sparse matrices must be column-major for better compatibility with Spectra.
-	int n_vars   = M.rows();
-	int n_constr = Cq.rows();
- 
-	// A  =  [ -K   -Cq' ]
-	//       [ -Cq    0  ]
-	Eigen::SparseMatrix<double> A(n_vars + n_constr, n_vars + n_constr);
-	A.setZero();
-	placeMatrix(A, -K, 0, 0);
-	placeMatrix(A, -Cq.transpose(), 0, n_vars);
-	placeMatrix(A, -Cq, n_vars, 0);
-	A.makeCompressed();
+	Eigen::SparseMatrix<double> A;
+	Eigen::SparseMatrix<double> B;
+	BuildUndampedEigenProblemMatrices(M, K, Cq, A, B, false);
 
-	// B  =  [  M     0  ]
-	//       [  0     0  ]
-	Eigen::SparseMatrix<double> B(n_vars + n_constr, n_vars + n_constr);
-	B.setZero();
-	placeMatrix(B, M, 0, 0);
-	B.makeCompressed();
+	return Solve(A, B, (int)M.rows(), V, eig, freq, settings);
+}
 
-	int m = 2 * settings.n_modes >= 20 ? 2 * settings.n_modes : 20;  // minimum subspace size   
+
+bool ChGeneralizedEigenvalueSolverLanczos::Solve(const Eigen::SparseMatrix<double>& A,  ///< input A matrix
+        const Eigen::SparseMatrix<double>& B,  ///< input B matrix
+        int n_vars,               ///< number of variables (the rest of A being the constraint block)
+        ChMatrixDynamic<std::complex<double>>& V,    ///< output matrix n x n_v with eigenvectors as columns, will be resized
+        ChVectorDynamic<std::complex<double>>& eig,  ///< output vector with n eigenvalues, will be resized.
+        ChVectorDynamic<double>& freq,  ///< output vector with n frequencies [Hz], as f=w/(2*PI), will be resized.
+        ChEigenvalueSolverSettings settings ///< optional: settings for the solver, or n. of desired lower eigenvalues. If =0, return all eigenvalues.)
+)  const
+{
+	int n_constr = (int)A.rows() - n_vars;
+
+	int m = 2 * settings.n_modes >= 20 ? 2 * settings.n_modes : 20;  // minimum subspace size
 	if (m > n_vars + n_constr -1)
 		m = n_vars + n_constr -1;
 	if (m <= settings.n_modes)
@@ -313,7 +341,7 @@ bool ChGeneralizedEigenvalueSolverLanczos::Solve(const ChSparseMatrix& M,  ///<
 	Eigen::MatrixXcd eigen_vectors = eigen_solver.eigenvectors();
 
 	// Return values
-    V.setZero(M.rows(), settings.n_modes);
+    V.setZero(n_vars, settings.n_modes);
     eig.setZero(settings.n_modes);
 	freq.setZero(settings.n_modes);
 
@@ -343,25 +371,47 @@ int ChModalSolveUndamped::Solve(
 	eig.resize(0);
 	freq.resize(0);
 
-	// for each freq_spans finds the closest modes to i-th input frequency:
-	for (int i = 0; i < this->freq_spans.size(); ++i) {
+	int n_spans = (int)this->freq_spans.size();
+	int n_vars = (int)M.rows();
+
+	// Assemble the A and B matrices once: the assembly does not depend on the shift, so all the
+	// shift&invert runs below share (and only read) the same matrices.
+	Eigen::SparseMatrix<double> A;
+	Eigen::SparseMatrix<double> B;
+	ChGeneralizedEigenvalueSolver::BuildUndampedEigenProblemMatrices(M, K, Cq, A, B, true);
+
+	std::vector<ChMatrixDynamic<std::complex<double>>> V_spans(n_spans);
+	std::vector<ChVectorDynamic<std::complex<double>>> eig_spans(n_spans);
+	std::vector<ChVectorDynamic<double>> freq_spans_found(n_spans);
+	std::vector<char> ok_spans(n_spans, 0);
+
+	// Each freq_span is an independent shift&invert run that finds the closest modes to its input
+	// frequency. The runs share nothing but the read-only A and B, so they can execute concurrently.
+#pragma omp parallel for schedule(dynamic, 1) if (parallel_shifts && n_spans > 1)
+	for (int i = 0; i < n_spans; ++i) {
 
 		int nmodes_goal_i = this->freq_spans[i].nmodes;
 		double sigma_i = -pow(this->freq_spans[i].freq * CH_C_2PI, 2); // sigma for shift&invert, as lowest eigenvalue, from Hz info
 
-		ChMatrixDynamic<std::complex<double>> V_i;
-		ChVectorDynamic<std::complex<double>> eig_i;
-		ChVectorDynamic<double> freq_i;
-		
-		V_i.setZero(M.rows(), nmodes_goal_i);
-		eig_i.setZero(nmodes_goal_i);
-		freq_i.setZero(nmodes_goal_i);
+		V_spans[i].setZero(n_vars, nmodes_goal_i);
+		eig_spans[i].setZero(nmodes_goal_i);
+		freq_spans_found[i].setZero(nmodes_goal_i);
 
 		ChEigenvalueSolverSettings settings_i (nmodes_goal_i, this->max_iterations, this->tolerance, this->verbose, sigma_i);
 
-		if (!this->msolver.Solve(M, K, Cq, V_i, eig_i, freq_i, settings_i))
+		ok_spans[i] = this->msolver.Solve(A, B, n_vars, V_spans[i], eig_spans[i], freq_spans_found[i], settings_i) ? 1 : 0;
+	}
+
+	// Merge the per-span results in span order, as if the runs had been sequential:
+	for (int i = 0; i < n_spans; ++i) {
+
+		if (!ok_spans[i])
 			return found_eigs;
 
+		ChMatrixDynamic<std::complex<double>>& V_i = V_spans[i];
+		ChVectorDynamic<std::complex<double>>& eig_i = eig_spans[i];
+		ChVectorDynamic<double>& freq_i = freq_spans_found[i];
+
 		// append to list of results
 
 		int nmodes_out_i = eig_i.size();
@@ -72,16 +72,47 @@ public:
     virtual ~ChGeneralizedEigenvalueSolver() {};
 
     /// Solve the constrained eigenvalue problem (-wsquare*M + K)*x = 0 s.t. Cq*x = 0
-    /// If n_modes=0, return all eigenvalues, otherwise only the first lower n_modes. 
+    /// If n_modes=0, return all eigenvalues, otherwise only the first lower n_modes.
     virtual bool Solve(
         const ChSparseMatrix& M,  ///< input M matrix, n_v x n_v
-        const ChSparseMatrix& K,  ///< input K matrix, n_v x n_v  
+        const ChSparseMatrix& K,  ///< input K matrix, n_v x n_v
         const ChSparseMatrix& Cq, ///< input Cq matrix of constraint jacobians, n_c x n_v
         ChMatrixDynamic<std::complex<double>>& V,    ///< output matrix n x n_v with eigenvectors as columns, will be resized
         ChVectorDynamic<std::complex<double>>& eig,  ///< output vector with n eigenvalues, will be resized.
         ChVectorDynamic<double>& freq,  ///< output vector with n frequencies [Hz], as f=w/(2*PI), will be resized.
         ChEigenvalueSolverSettings settings = 0   ///< optional: settings for the solver, or n. of desired lower eigenvalues. If =0, return all eigenvalues.
     ) const = 0;
+
+    /// Solve the constrained eigenvalue problem starting from the already assembled A and B matrices
+    /// (see BuildUndampedEigenProblemMatrices). Since the assembly does not depend on the shift, callers
+    /// performing multiple shift&invert runs (ex. ChModalSolveUndamped with multiple frequency spans)
+    /// can assemble A and B once and reuse them for every shift. The matrices are only read here, so
+    /// concurrent calls sharing the same A and B are allowed.
+    virtual bool Solve(
+        const Eigen::SparseMatrix<double>& A,  ///< input A matrix, (n_v+n_c) x (n_v+n_c)
+        const Eigen::SparseMatrix<double>& B,  ///< input B matrix, (n_v+n_c) x (n_v+n_c)
+        int n_vars,               ///< number of variables n_v (the rest of A being the constraint block)
+        ChMatrixDynamic<std::complex<double>>& V,    ///< output matrix n x n_v with eigenvectors as columns, will be resized
+        ChVectorDynamic<std::complex<double>>& eig,  ///< output vector with n eigenvalues, will be resized.
+        ChVectorDynamic<double>& freq,  ///< output vector with n frequencies [Hz], as f=w/(2*PI), will be resized.
+        ChEigenvalueSolverSettings settings = 0   ///< optional: settings for the solver, or n. of desired lower eigenvalues. If =0, return all eigenvalues.
+    ) const = 0;
+
+    /// Assemble the A and B matrices of the undamped constrained eigenvalue problem,
+    ///   A  =  [ -K   -Cq' ]        B  =  [  M     0  ]
+    ///         [ -Cq    0  ]              [  0     0  ]
+    /// as column-major matrices ready for the shift&invert solvers. If scaleCq, the constraint
+    /// jacobians are scaled by the average diagonal of K to improve conditioning; this affects only
+    /// the Lagrange multiplier part of the eigenvectors, which is discarded anyway.
+    /// Returns the scaling factor that was applied (1 if none).
+    static double BuildUndampedEigenProblemMatrices(
+        const ChSparseMatrix& M,         ///< input M matrix, n_v x n_v
+        const ChSparseMatrix& K,         ///< input K matrix, n_v x n_v
+        const ChSparseMatrix& Cq,        ///< input Cq matrix of constraint jacobians, n_c x n_v
+        Eigen::SparseMatrix<double>& A,  ///< output A matrix, will be resized
+        Eigen::SparseMatrix<double>& B,  ///< output B matrix, will be resized
+        bool scaleCq = true              ///< apply scaling to the Cq blocks
+    );
 };
 
 /// Solves the undamped constrained eigenvalue problem with the Krylov-Schur iterative method.
@@ -104,9 +135,20 @@ public:
         ChEigenvalueSolverSettings settings = 0   ///< optional: settings for the solver, or n. of desired lower eigenvalues. If =0, return all eigenvalues.
     ) const override;
 
+    /// Solve the constrained eigenvalue problem from the already assembled A and B matrices.
+    virtual bool Solve(
+        const Eigen::SparseMatrix<double>& A,  ///< input A matrix, (n_v+n_c) x (n_v+n_c)
+        const Eigen::SparseMatrix<double>& B,  ///< input B matrix, (n_v+n_c) x (n_v+n_c)
+        int n_vars,               ///< number of variables n_v (the rest of A being the constraint block)
+        ChMatrixDynamic<std::complex<double>>& V,    ///< output matrix n x n_v with eigenvectors as columns, will be resized
+        ChVectorDynamic<std::complex<double>>& eig,  ///< output vector with n eigenvalues, will be resized.
+        ChVectorDynamic<double>& freq,  ///< output vector with n frequencies [Hz], as f=w/(2*PI), will be resized.
+        ChEigenvalueSolverSettings settings = 0   ///< optional: settings for the solver, or n. of desired lower eigenvalues. If =0, return all eigenvalues.
+    ) const override;
+
 };
 
-/// Solves the undamped constrained eigenvalue problem with the Lanczos iterative method. 
+/// Solves the undamped constrained eigenvalue problem with the Lanczos iterative method.
 /// It assumes that K and M matrices are symmetric, hence a real eigenvalue problem.
 /// This is an efficient method to compute only the lower n modes, ex. when there are so many degreees of 
 /// freedom that it would make a full solution impossible.
@@ -127,6 +169,17 @@ public:
         ChEigenvalueSolverSettings settings = 0   ///< optional: settings for the solver, or n. of desired lower eigenvalues. If =0, return all eigenvalues.
     ) const  override;
 
+    /// Solve the constrained eigenvalue problem from the already assembled A and B matrices.
+    virtual bool Solve(
+        const Eigen::SparseMatrix<double>& A,  ///< input A matrix, (n_v+n_c) x (n_v+n_c)
+        const Eigen::SparseMatrix<double>& B,  ///< input B matrix, (n_v+n_c) x (n_v+n_c)
+        int n_vars,               ///< number of variables n_v (the rest of A being the constraint block)
+        ChMatrixDynamic<std::complex<double>>& V,    ///< output matrix n x n_v with eigenvectors as columns, will be resized
+        ChVectorDynamic<std::complex<double>>& eig,  ///< output vector with n eigenvalues, will be resized.
+        ChVectorDynamic<double>& freq,  ///< output vector with n frequencies [Hz], as f=w/(2*PI), will be resized.
+        ChEigenvalueSolverSettings settings = 0   ///< optional: settings for the solver, or n. of desired lower eigenvalues. If =0, return all eigenvalues.
+    ) const override;
+
 };
 
 
@@ -206,10 +259,11 @@ public:
 
 
     std::vector< ChFreqSpan > freq_spans;
-    double tolerance = 1e-10;   ///< tolerance for the iterative solver. 
+    double tolerance = 1e-10;   ///< tolerance for the iterative solver.
     int max_iterations = 500;   ///< upper limit for the number of iterations. If too low might not converge.
     bool verbose = false;       ///< turn to true to see some diagnostic.
-    const ChGeneralizedEigenvalueSolver& msolver; 
+    bool parallel_shifts = true; ///< if multiple freq_spans, solve the independent shifts on separate threads (OpenMP)
+    const ChGeneralizedEigenvalueSolver& msolver;
 };
 
 
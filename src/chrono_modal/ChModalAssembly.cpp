@@ -14,6 +14,7 @@
 
 
 #include "chrono_modal/ChModalAssembly.h"
+#include "chrono/core/ChMathematics.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
 #include "chrono/fea/ChNodeFEAxyzrot.h"
@@ -33,7 +34,11 @@ ChModalAssembly::ChModalAssembly()
     : modal_variables(nullptr),
     n_modes_coords_w(0),
     is_modal(false),
-    internal_nodes_update(true)
+    internal_nodes_update(true),
+    modal_R_rayleigh(false),
+    modal_R_alpha(0),
+    modal_R_beta(0),
+    modal_R_use_sparse(false)
 {}
 
 ChModalAssembly::ChModalAssembly(const ChModalAssembly& other) : ChAssembly(other) {
@@ -191,29 +196,47 @@ void ChModalAssembly::SwitchModalReductionON(ChSparseMatrix& full_M, ChSparseMat
     // avoid computing K_IIc^{-1}, effectively do n times a linear solve:
     Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int> >   solver;
     solver.analyzePattern(K_IIc);
-    solver.factorize(K_IIc); 
-    for (int i = 0; i < K_IB.cols(); ++i) { 
-        ChVectorDynamic<> rhs(this->n_internal_coords_w + full_Cq.rows());
-        if (Cq_B.rows())
-            rhs << K_IB.col(i).toDense(), Cq_B.col(i).toDense();
-        else
-            rhs << K_IB.col(i).toDense();
-        ChVectorDynamic<> x = solver.solve(rhs);
-        Psi_S.block(0,i, this->n_internal_coords_w, 1) = -x.head(this->n_internal_coords_w);
-    }
-
-    // Matrix of dynamic modes (V_B and V_I already computed as constrained eigenmodes, 
+    solver.factorize(K_IIc);
+
+    // Solve in blocked panels of right-hand sides rather than column by column. The dense scratch
+    // is bounded to one n_IIc x PSI_BLOCK panel per thread regardless of the number of boundary
+    // coordinates, and the panels are independent so they can be solved on separate threads:
+    // the factorization is only read by solve().
+    const int PSI_BLOCK = 64;
+    int n_IIc = this->n_internal_coords_w + (int)full_Cq.rows();
+    int n_B = this->n_boundary_coords_w;
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int i0 = 0; i0 < n_B; i0 += PSI_BLOCK) {
+        int ncols = ChMin(PSI_BLOCK, n_B - i0);
+        ChMatrixDynamic<> rhs(n_IIc, ncols);
+        for (int i = 0; i < ncols; ++i) {
+            rhs.col(i).head(this->n_internal_coords_w) = K_IB.col(i0 + i).toDense();
+            if (Cq_B.rows())
+                rhs.col(i).tail(Cq_B.rows()) = Cq_B.col(i0 + i).toDense();
+        }
+        ChMatrixDynamic<> x = solver.solve(rhs);
+        Psi_S.middleCols(i0, ncols) = -x.topRows(this->n_internal_coords_w);
+    }
+
+    // Matrix of dynamic modes (V_B and V_I already computed as constrained eigenmodes,
     // but use K_IIc instead of K_II anyway, to reuse K_IIc already factored before)
     //
     // {Psi_D; foo} = - K_IIc^{-1} * {(M_IB * V_B + M_II * V_I) ; 0}
 
     ChMatrixDynamic<> Psi_D(this->n_internal_coords_w, this->n_modes_coords_w);
 
-    for (int i = 0; i < this->n_modes_coords_w; ++i) { 
-        ChVectorDynamic<> rhs(this->n_internal_coords_w + full_Cq.rows());
-        rhs << (M_IB * V_B + M_II * V_I).col(i) , Eigen::VectorXd::Zero(full_Cq.rows()) ;
-        ChVectorDynamic<> x = solver.solve(rhs);
-        Psi_D.block(0,i, this->n_internal_coords_w, 1) = -x.head(this->n_internal_coords_w);
+    // compute the (M_IB * V_B + M_II * V_I) term once, not once per column
+    ChMatrixDynamic<> MV_I = M_IB * V_B + M_II * V_I;
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int i0 = 0; i0 < this->n_modes_coords_w; i0 += PSI_BLOCK) {
+        int ncols = ChMin(PSI_BLOCK, this->n_modes_coords_w - i0);
+        ChMatrixDynamic<> rhs(n_IIc, ncols);
+        rhs.topRows(this->n_internal_coords_w) = MV_I.middleCols(i0, ncols);
+        rhs.bottomRows(full_Cq.rows()).setZero();
+        ChMatrixDynamic<> x = solver.solve(rhs);
+        Psi_D.middleCols(i0, ncols) = -x.topRows(this->n_internal_coords_w);
     }
 
 
@@ -226,15 +249,52 @@ void ChModalAssembly::SwitchModalReductionON(ChSparseMatrix& full_M, ChSparseMat
     Psi << Eigen::MatrixXd::Identity(n_boundary_coords_w, n_boundary_coords_w), Eigen::MatrixXd::Zero(n_boundary_coords_w, n_modes_coords_w),
            Psi_S,                                                               Psi_D;
 
-    // Modal reduction of the M K matrices
-    this->modal_M = Psi.transpose() * full_M * Psi;
-    this->modal_K = Psi.transpose() * full_K * Psi;
+    // Modal reduction of the M K matrices.
+    // Compute Psi' * (full * Psi) one panel of columns at a time: the intermediate product is
+    // then bounded to one (n_B+n_I) x PSI_BLOCK panel per thread instead of a full
+    // (n_B+n_I) x (n_B+n_m) temporary, and the panels are independent across threads.
+    int n_red = this->n_boundary_coords_w + this->n_modes_coords_w;
+    this->modal_M.setZero(n_red, n_red);
+    this->modal_K.setZero(n_red, n_red);
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int i0 = 0; i0 < n_red; i0 += PSI_BLOCK) {
+        int ncols = ChMin(PSI_BLOCK, n_red - i0);
+        ChMatrixDynamic<> scratch = full_M * Psi.middleCols(i0, ncols);
+        this->modal_M.middleCols(i0, ncols) = Psi.transpose() * scratch;
+        scratch = full_K * Psi.middleCols(i0, ncols);
+        this->modal_K.middleCols(i0, ncols) = Psi.transpose() * scratch;
+    }
 
     this->modal_R.setZero(modal_M.rows(), modal_M.cols()); // default R=0 , zero damping
     
-    // Modal reduction of R damping matrix: compute using user-provided damping model 
+    // Modal reduction of R damping matrix: compute using user-provided damping model
     damping_model.ComputeR(*this, this->modal_M, this->modal_K, Psi, this->modal_R);
 
+    // Build a structured representation of the reduced damping matrix, used in IntLoadResidual_F to apply the
+    // damping forces matrix-free: the dense product modal_R * v scales quadratically with the number of modes and
+    // at large mode counts rivals the stiffness work, while most damping models produce either a Rayleigh
+    // combination of the already stored M^ and K^, or a mostly-zero matrix (diagonal damping factors, possibly
+    // plus a boundary block, or a user-provided sparse matrix).
+    this->modal_R_rayleigh = damping_model.GetRayleighCoefficients(this->modal_R_alpha, this->modal_R_beta);
+    this->modal_R_use_sparse = false;
+    this->modal_R_sparse.resize(0, 0);
+    if (!this->modal_R_rayleigh) {
+        // Entries below this tolerance are structural zeros left by the damping model
+        double rtol = 1e-12 * this->modal_R.cwiseAbs().maxCoeff();
+        std::vector<Eigen::Triplet<double>> triplets;
+        for (int i = 0; i < n_red; ++i)
+            for (int j = 0; j < n_red; ++j)
+                if (std::abs(this->modal_R(i, j)) > rtol)
+                    triplets.push_back(Eigen::Triplet<double>(i, j, this->modal_R(i, j)));
+        // Keep the dense product only when the matrix is effectively full
+        if ((double)triplets.size() < 0.25 * n_red * n_red) {
+            this->modal_R_sparse.resize(n_red, n_red);
+            this->modal_R_sparse.setFromTriplets(triplets.begin(), triplets.end());
+            this->modal_R_use_sparse = true;
+        }
+    }
+
 
     // Reset to zero all the atomic masses of the boundary nodes because now their mass is represented by  this->modal_M
     // NOTE! this should be made more generic and future-proof by implementing a virtual method ex. RemoveMass() in all ChPhysicsItem 
@@ -1506,7 +1566,19 @@ void ChModalAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in
         ChStateDelta v_local(this->n_boundary_coords_w + this->n_modes_coords_w, nullptr);
         this->GetStateLocal(Dx_local, v_local);
 
-        R.segment(off, this->n_boundary_coords_w + this->n_modes_coords_w) -= c * (this->modal_K * Dx_local + this->modal_R * v_local); //  note -= sign
+        int n_red = this->n_boundary_coords_w + this->n_modes_coords_w;
+        if (this->modal_R_rayleigh) {
+            // Rayleigh damping R^ = alpha*M^ + beta*K^: fold the stiffness-proportional term into the stiffness
+            // product and apply the mass-proportional term through modal_M, skipping the dense modal_R entirely
+            ChVectorDynamic<> mFv = this->modal_K * (Dx_local + this->modal_R_beta * v_local);
+            if (this->modal_R_alpha != 0)
+                mFv += this->modal_R_alpha * (this->modal_M * v_local);
+            R.segment(off, n_red) -= c * mFv;  //  note -= sign
+        } else if (this->modal_R_use_sparse) {
+            R.segment(off, n_red) -= c * (this->modal_K * Dx_local + this->modal_R_sparse * v_local);  //  note -= sign
+        } else {
+            R.segment(off, n_red) -= c * (this->modal_K * Dx_local + this->modal_R * v_local);  //  note -= sign
+        }
 
         // 2-
         // Add custom forces (in modal coordinates)
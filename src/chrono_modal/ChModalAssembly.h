@@ -538,6 +538,14 @@ public:
     ChMatrixDynamic<> modal_M;
     ChMatrixDynamic<> modal_K;
     ChMatrixDynamic<> modal_R;
+
+    // Structured form of modal_R, used for matrix-free application of the damping forces during integration.
+    // The dense modal_R above is still assembled, for jacobians and for inspection.
+    bool modal_R_rayleigh;          // modal_R = alpha*M^ + beta*K^ : apply through modal_M and modal_K
+    double modal_R_alpha;           // mass-proportional Rayleigh coefficient (if modal_R_rayleigh)
+    double modal_R_beta;            // stiffness-proportional Rayleigh coefficient (if modal_R_rayleigh)
+    bool modal_R_use_sparse;        // modal_R is mostly zero (ex. diagonal damping factors): apply in sparse form
+    ChSparseMatrix modal_R_sparse;  // sparse copy of modal_R, built only if sufficiently sparse
     ChMatrixDynamic<> Psi; //***TODO*** maybe prefer sparse Psi matrix, especially for upper blocks...
     ChState           assembly_x0;      // state snapshot of full not reduced assembly at the time of SwitchModalReductionON()
 
@@ -33,12 +33,19 @@ class ChApiModal ChModalDamping {
 public:
     virtual ~ChModalDamping() {};
 
-    // child class inherits this. They must compute the reduced R. 
+    // child class inherits this. They must compute the reduced R.
     virtual void ComputeR(ChModalAssembly& assembly,
-        const ChMatrixDynamic<>& modal_M, 
-        const ChMatrixDynamic<>& modal_K, 
-        const ChMatrixDynamic<>& Psi, 
+        const ChMatrixDynamic<>& modal_M,
+        const ChMatrixDynamic<>& modal_K,
+        const ChMatrixDynamic<>& Psi,
         ChMatrixDynamic<>& modal_R) const = 0;
+
+    /// If the reduced damping matrix has pure Rayleigh form  R^ = alpha*M^ + beta*K^, return true and set the two
+    /// coefficients. ChModalAssembly then applies the damping forces matrix-free through the reduced mass and
+    /// stiffness matrices during integration, instead of multiplying by a second dense matrix. For damping models
+    /// that are not of Rayleigh form but leave most of R^ zero (ex. diagonal modal damping factors, or a
+    /// user-provided sparse matrix), ChModalAssembly instead applies a sparse copy of R^.
+    virtual bool GetRayleighCoefficients(double& malpha, double& mbeta) const { return false; }
 };
 
 /// Class for no damping model
@@ -52,6 +59,12 @@ public:
 
         modal_R.setZero(modal_M.rows(), modal_M.cols());
     }
+
+    virtual bool GetRayleighCoefficients(double& malpha, double& mbeta) const {
+        malpha = 0;
+        mbeta = 0;
+        return true;
+    }
 };
 
 /// Class for simple Rayleigh damping model
@@ -72,6 +85,12 @@ public:
 
         modal_R = alpha * modal_M + beta * modal_K;
     }
+
+    virtual bool GetRayleighCoefficients(double& malpha, double& mbeta) const {
+        malpha = alpha;
+        mbeta = beta;
+        return true;
+    }
 };
 
 /// Class for setting the damping via N damping factors z_i of the internal mode coordinates.
@@ -24,6 +24,7 @@
 #include <memory>
 
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/utils/ChOpenMP.h"
 #include "chrono/multicore_math/ChMulticoreMath.h"
 #include "chrono/collision/chrono/ChCollisionData.h"
 
@@ -79,6 +80,48 @@ typedef blaze::Submatrix<const CompressedMatrix<real>> ConstSubMatrixType;
 typedef blaze::Subvector<const DynamicVector<real>> ConstSubVectorType;
 #endif
 
+/// Resize a data array using parallel first-touch initialization.
+/// When the array grows into a fresh allocation, the new pages are touched in parallel with a
+/// static schedule before the elements are constructed. Under the first-touch page placement
+/// policy of the OS, this distributes the pages of large arrays over the NUMA nodes of the worker
+/// threads that will later stream through them (with the same static partition), instead of
+/// committing everything to the node of the allocating thread. Works for both custom_vector and
+/// blaze::DynamicVector, whose resize preserves existing elements. Arrays below one page per
+/// thread are not worth distributing and are resized directly.
+template <typename VectorType>
+inline void ResizeFirstTouch(VectorType& vec, size_t n) {
+    const size_t page_size = 4096;
+    const size_t elem_size = sizeof(*vec.data());
+
+    if (n > vec.capacity() && n * elem_size > page_size * (size_t)ChOMP::GetMaxThreads()) {
+        vec.reserve(n);
+        // Touch one byte per page of the region past the preserved elements. Writing into the
+        // reserved-but-unconstructed tail is safe for the trivially copyable element types used
+        // in the data manager; the subsequent resize overwrites these bytes anyway.
+        char* bytes = reinterpret_cast<char*>(vec.data());
+        long long first = (long long)(vec.size() * elem_size);
+        long long nbytes = (long long)(n * elem_size);
+#pragma omp parallel for schedule(static)
+        for (long long b = first; b < nbytes; b += (long long)page_size) {
+            bytes[b] = 0;
+        }
+    }
+    vec.resize(n);
+}
+
+/// Reserve capacity for appending to a data array, growing geometrically.
+/// Injection phases (e.g. adding fluid particles every few steps) append small batches to arrays that can be
+/// gigabytes in size; growing the array to the exact new size on every batch reallocates and copies the whole
+/// array each time. This helper grows the capacity by at least half whenever a reallocation is needed, so the
+/// copy cost is amortized over many injections.
+template <typename VectorType>
+inline void ReserveAmortized(VectorType& vec, size_t n) {
+    if (n > vec.capacity()) {
+        size_t grown = vec.capacity() + vec.capacity() / 2;
+        vec.reserve(n > grown ? n : grown);
+    }
+}
+
 // These defines are used in the submatrix calls below to keep them concise
 // They aren't names to be easy to understand, but for length
 #define _num_dof_ data_manager->num_dof
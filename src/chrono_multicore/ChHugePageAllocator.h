@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: allocator with transparent-huge-page backing for the large data
+// arrays of the multicore data manager.
+//
+// =============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#ifdef __linux__
+    #include <sys/mman.h>
+#endif
+
+namespace chrono {
+
+/// @addtogroup multicore_module
+/// @{
+
+/// Allocator with transparent-huge-page backing for large blocks.
+///
+/// The body and contact arrays of the multicore data manager can reach gigabytes; with standard 4 KB pages, the
+/// streaming kernels (broadphase counting in particular) spend a measurable fraction of their time in TLB misses.
+/// Allocations of at least one huge page are therefore memory-mapped and flagged with MADV_HUGEPAGE, asking the
+/// kernel to back the region with 2 MB pages; smaller blocks fall back to the regular heap. The mapped pages are
+/// not committed until first touched, so page placement on NUMA systems still follows the first-touch policy and
+/// remains compatible with the parallel first-touch initialization performed by ResizeFirstTouch (ChDataManager.h).
+///
+/// On platforms without madvise the allocator degenerates to the regular heap. Huge-page backing for the data
+/// manager arrays is opt-in: define CHRONO_MULTICORE_USE_HUGE_PAGES to make custom_vector use this allocator
+/// (see ChMulticoreDefines.h).
+template <typename T>
+class ChHugePageAllocator {
+  public:
+    typedef T value_type;
+
+    /// Block size from which allocations are memory-mapped and huge-page backed (one 2 MB huge page).
+    static const std::size_t huge_page_size = (std::size_t)2 * 1024 * 1024;
+
+    ChHugePageAllocator() noexcept {}
+    template <typename U>
+    ChHugePageAllocator(const ChHugePageAllocator<U>&) noexcept {}
+
+    template <typename U>
+    struct rebind {
+        typedef ChHugePageAllocator<U> other;
+    };
+
+    T* allocate(std::size_t n) {
+        std::size_t bytes = n * sizeof(T);
+#ifdef __linux__
+        if (bytes >= huge_page_size) {
+            void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED)
+                throw std::bad_alloc();
+            ::madvise(p, bytes, MADV_HUGEPAGE);
+            return static_cast<T*>(p);
+        }
+#endif
+        return static_cast<T*>(::operator new(bytes));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+#ifdef __linux__
+        std::size_t bytes = n * sizeof(T);
+        if (bytes >= huge_page_size) {
+            ::munmap(p, bytes);
+            return;
+        }
+#endif
+        ::operator delete(p);
+    }
+};
+
+template <typename T, typename U>
+inline bool operator==(const ChHugePageAllocator<T>&, const ChHugePageAllocator<U>&) noexcept {
+    return true;
+}
+template <typename T, typename U>
+inline bool operator!=(const ChHugePageAllocator<T>&, const ChHugePageAllocator<U>&) noexcept {
+    return false;
+}
+
+/// Vector backed by the huge-page allocator (what custom_vector expands to when
+/// CHRONO_MULTICORE_USE_HUGE_PAGES is defined).
+template <typename T>
+using hp_vector = std::vector<T, ChHugePageAllocator<T>>;
+
+/// @} multicore_module
+
+}  // end namespace chrono
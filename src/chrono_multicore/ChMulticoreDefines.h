@@ -19,11 +19,14 @@
 #pragma once
 
 #include "chrono_multicore/ChApiMulticore.h"
+#include "chrono_multicore/ChHugePageAllocator.h"
 
 #ifdef __CDT_PARSER__
     #define BLAZE_SERIAL_SECTION
     #define CH_MULTICORE_API
     #define custom_vector std::vector
+#elif defined(CHRONO_MULTICORE_USE_HUGE_PAGES)
+    #define custom_vector chrono::hp_vector
 #else
     #define custom_vector std::vector
 #endif
@@ -49,6 +52,7 @@ enum class SolverType {
     GAUSS_SEIDEL,                ///< Gauss-Seidel
     PDIP,                        ///< Primal-Dual Interior Point
     BB,                          ///< Barzilai-Borwein
+    BB_GPU,                      ///< Barzilai-Borwein, running on the GPU (CPU fallback without CUDA)
     SPGQP                        ///< Spectral Projected Gradient (QP projection)
 };
 
@@ -36,11 +36,60 @@ void ChContactContainerMulticoreNSC::BeginAddContact() {
     data_manager->host_data.fric_rigid_rigid.resize(num_contacts);
     data_manager->host_data.coh_rigid_rigid.resize(num_contacts);
     data_manager->host_data.compliance_rigid_rigid.resize(num_contacts);
+
+    m_staged.clear();
 }
 
 void ChContactContainerMulticoreNSC::EndAddContact() {
     ChContactContainerMulticore::EndAddContact();
-    //// Anything else here?!?
+
+    if (m_staged.empty())
+        return;
+
+    // Scatter contacts staged during the add phase.
+    // All global SoA arrays are sized exactly once, then filled in parallel; in particular, the
+    // composite material creation (the expensive part of the fill) runs across threads.
+    auto& cd_data = data_manager->cd_data;
+
+    uint base = cd_data->num_rigid_contacts;
+    uint num_contacts = base + (uint)m_staged.size();
+
+    cd_data->norm_rigid_rigid.resize(num_contacts);
+    cd_data->cpta_rigid_rigid.resize(num_contacts);
+    cd_data->cptb_rigid_rigid.resize(num_contacts);
+    cd_data->dpth_rigid_rigid.resize(num_contacts);
+    cd_data->erad_rigid_rigid.resize(num_contacts);
+    cd_data->bids_rigid_rigid.resize(num_contacts);
+
+    data_manager->host_data.fric_rigid_rigid.resize(num_contacts);
+    data_manager->host_data.coh_rigid_rigid.resize(num_contacts);
+    data_manager->host_data.compliance_rigid_rigid.resize(num_contacts);
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)m_staged.size(); i++) {
+        const auto& staged = m_staged[i];
+        uint index = base + i;
+
+        cd_data->norm_rigid_rigid[index] = staged.norm;
+        cd_data->cpta_rigid_rigid[index] = staged.cpta;
+        cd_data->cptb_rigid_rigid[index] = staged.cptb;
+        cd_data->dpth_rigid_rigid[index] = staged.depth;
+        cd_data->erad_rigid_rigid[index] = staged.erad;
+        cd_data->bids_rigid_rigid[index] = staged.bids;
+
+        // Composite material for the contact (if the materials were provided)
+        if (staged.mat1 && staged.mat2) {
+            ChMaterialCompositeNSC cmat(data_manager->composition_strategy.get(), staged.mat1, staged.mat2);
+            data_manager->host_data.fric_rigid_rigid[index] =
+                real3(cmat.sliding_friction, cmat.rolling_friction, cmat.spinning_friction);
+            data_manager->host_data.coh_rigid_rigid[index] = cmat.cohesion;
+            data_manager->host_data.compliance_rigid_rigid[index] =
+                real4(cmat.compliance, cmat.complianceT, cmat.complianceRoll, cmat.complianceSpin);
+        }
+    }
+
+    cd_data->num_rigid_contacts = num_contacts;
+    m_staged.clear();
 }
 
 void ChContactContainerMulticoreNSC::AddContact(const collision::ChCollisionInfo& cinfo,
@@ -56,47 +105,38 @@ void ChContactContainerMulticoreNSC::AddContact(const collision::ChCollisionInfo
     if (inactiveA && inactiveB)
         return;
 
-    auto& cd_data = data_manager->cd_data;  // collision system data
-
     // Currently, we only consider contacts between rigid bodies
     ChContactable_1vars<6>* mmboA = dynamic_cast<ChContactable_1vars<6>*>(cinfo.modelA->GetContactable());
     ChContactable_1vars<6>* mmboB = dynamic_cast<ChContactable_1vars<6>*>(cinfo.modelB->GetContactable());
 
     if (mmboA && mmboB) {
+        // Stage the contact; the global SoA arrays are filled all at once in EndAddContact().
         // Geometric information for added contact. Make sure body IDs are ordered smallest first!
+        StagedContact staged;
         int b1 = ((ChBody*)(cinfo.modelA->GetPhysicsItem()))->GetId();
         int b2 = ((ChBody*)(cinfo.modelB->GetPhysicsItem()))->GetId();
         if (b1 < b2) {
-            cd_data->norm_rigid_rigid.push_back(real3(cinfo.vN.x(), cinfo.vN.y(), cinfo.vN.z()));
-            cd_data->cpta_rigid_rigid.push_back(real3(cinfo.vpA.x(), cinfo.vpA.y(), cinfo.vpA.z()));
-            cd_data->cptb_rigid_rigid.push_back(real3(cinfo.vpB.x(), cinfo.vpB.y(), cinfo.vpB.z()));
-            cd_data->dpth_rigid_rigid.push_back(cinfo.distance);
-            cd_data->erad_rigid_rigid.push_back(cinfo.eff_radius);  // not really needed here
-            cd_data->bids_rigid_rigid.push_back(vec2(b1, b2));
+            staged.norm = real3(cinfo.vN.x(), cinfo.vN.y(), cinfo.vN.z());
+            staged.cpta = real3(cinfo.vpA.x(), cinfo.vpA.y(), cinfo.vpA.z());
+            staged.cptb = real3(cinfo.vpB.x(), cinfo.vpB.y(), cinfo.vpB.z());
+            staged.depth = cinfo.distance;
+            staged.erad = cinfo.eff_radius;  // not really needed here
+            staged.bids = vec2(b1, b2);
         } else {
             ChCollisionInfo cinfoS(cinfo, true);  // swap information in cinfo
-            cd_data->norm_rigid_rigid.push_back(real3(cinfoS.vN.x(), cinfoS.vN.y(), cinfoS.vN.z()));
-            cd_data->cpta_rigid_rigid.push_back(real3(cinfoS.vpA.x(), cinfoS.vpA.y(), cinfoS.vpA.z()));
-            cd_data->cptb_rigid_rigid.push_back(real3(cinfoS.vpB.x(), cinfoS.vpB.y(), cinfoS.vpB.z()));
-            cd_data->dpth_rigid_rigid.push_back(cinfoS.distance);
-            cd_data->erad_rigid_rigid.push_back(cinfoS.eff_radius);  // not really needed here
-            cd_data->bids_rigid_rigid.push_back(vec2(b2, b1));
+            staged.norm = real3(cinfoS.vN.x(), cinfoS.vN.y(), cinfoS.vN.z());
+            staged.cpta = real3(cinfoS.vpA.x(), cinfoS.vpA.y(), cinfoS.vpA.z());
+            staged.cptb = real3(cinfoS.vpB.x(), cinfoS.vpB.y(), cinfoS.vpB.z());
+            staged.depth = cinfoS.distance;
+            staged.erad = cinfoS.eff_radius;  // not really needed here
+            staged.bids = vec2(b2, b1);
         }
 
-        // Composite material for added contact
-        ChMaterialCompositeNSC cmat(data_manager->composition_strategy.get(),
-                                    std::static_pointer_cast<ChMaterialSurfaceNSC>(mat1),
-                                    std::static_pointer_cast<ChMaterialSurfaceNSC>(mat2));
+        // Materials for the contact (the composite material is created during the scatter)
+        staged.mat1 = std::static_pointer_cast<ChMaterialSurfaceNSC>(mat1);
+        staged.mat2 = std::static_pointer_cast<ChMaterialSurfaceNSC>(mat2);
 
-        // Load composite material properties in global data structure
-        data_manager->host_data.fric_rigid_rigid.push_back(
-            real3(cmat.sliding_friction, cmat.rolling_friction, cmat.spinning_friction));
-        data_manager->host_data.coh_rigid_rigid.push_back(cmat.cohesion);
-        data_manager->host_data.compliance_rigid_rigid.push_back(
-            real4(cmat.compliance, cmat.complianceT, cmat.complianceRoll, cmat.complianceSpin));
-
-        // Increment number of contacts
-        cd_data->num_rigid_contacts++;
+        m_staged.push_back(staged);
     }
 }
 
@@ -111,21 +151,22 @@ void ChContactContainerMulticoreNSC::AddContact(const collision::ChCollisionInfo
     if (inactiveA && inactiveB)
         return;
 
-    auto& cd_data = data_manager->cd_data;  // collision system data
-
     // Currently, we only consider contacts between rigid bodies
     ChContactable_1vars<6>* mmboA = dynamic_cast<ChContactable_1vars<6>*>(cinfo.modelA->GetContactable());
     ChContactable_1vars<6>* mmboB = dynamic_cast<ChContactable_1vars<6>*>(cinfo.modelB->GetContactable());
 
     if (mmboA && mmboB) {
-        cd_data->norm_rigid_rigid.push_back(real3(cinfo.vN.x(), cinfo.vN.y(), cinfo.vN.z()));
-        cd_data->cpta_rigid_rigid.push_back(real3(cinfo.vpA.x(), cinfo.vpA.y(), cinfo.vpA.z()));
-        cd_data->cptb_rigid_rigid.push_back(real3(cinfo.vpB.x(), cinfo.vpB.y(), cinfo.vpB.z()));
-        cd_data->dpth_rigid_rigid.push_back(cinfo.distance);
-        cd_data->erad_rigid_rigid.push_back(cinfo.eff_radius);
-        cd_data->bids_rigid_rigid.push_back(vec2(((ChBody*)(cinfo.modelA->GetPhysicsItem()))->GetId(),
-                                                 ((ChBody*)(cinfo.modelB->GetPhysicsItem()))->GetId()));
-        cd_data->num_rigid_contacts++;
+        // Stage the contact (no materials); the global SoA arrays are filled in EndAddContact().
+        StagedContact staged;
+        staged.norm = real3(cinfo.vN.x(), cinfo.vN.y(), cinfo.vN.z());
+        staged.cpta = real3(cinfo.vpA.x(), cinfo.vpA.y(), cinfo.vpA.z());
+        staged.cptb = real3(cinfo.vpB.x(), cinfo.vpB.y(), cinfo.vpB.z());
+        staged.depth = cinfo.distance;
+        staged.erad = cinfo.eff_radius;
+        staged.bids = vec2(((ChBody*)(cinfo.modelA->GetPhysicsItem()))->GetId(),
+                           ((ChBody*)(cinfo.modelB->GetPhysicsItem()))->GetId());
+
+        m_staged.push_back(staged);
     }
 }
 
@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChMaterialSurfaceNSC.h"
 #include "chrono_multicore/collision/ChContactContainerMulticore.h"
 
 namespace chrono {
@@ -48,6 +52,24 @@ class CH_MULTICORE_API ChContactContainerMulticoreNSC : public ChContactContaine
     /// Process the contact between the two specified collision shapes on the two specified bodies
     /// (compute composite material properties and load in global data structure).
     virtual void AddContact(int index, int b1, int s1, int b2, int s2) override;
+
+  private:
+    /// Contact staged by one of the AddContact functions, to be scattered in EndAddContact().
+    /// Contacts reported one at a time (e.g. by the Bullet collision system) are only recorded
+    /// during the add phase; the global SoA arrays are then sized exactly once and filled in a
+    /// parallel scatter, instead of growing all arrays contact by contact.
+    struct StagedContact {
+        real3 norm;                                ///< contact normal
+        real3 cpta;                                ///< contact point on first shape
+        real3 cptb;                                ///< contact point on second shape
+        real depth;                                ///< penetration depth
+        real erad;                                 ///< effective contact radius
+        vec2 bids;                                 ///< IDs of bodies in contact (smallest first)
+        std::shared_ptr<ChMaterialSurfaceNSC> mat1;  ///< material of first shape (may be null)
+        std::shared_ptr<ChMaterialSurfaceNSC> mat2;  ///< material of second shape (may be null)
+    };
+
+    std::vector<StagedContact> m_staged;  ///< contacts staged since BeginAddContact()
 };
 
 /// @} multicore_colision
@@ -0,0 +1,353 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: GPU solver for the cone-complementarity problem. Barzilai-
+// Borwein projected gradient iteration operating either on the assembled Schur
+// complement matrix in CSR form or, in matrix-free mode, on the Jacobian and
+// inverse-mass products from which N*x is evaluated on the fly. The iterate
+// stays resident on the device across iterations; only the scalar residual
+// travels back per iteration.
+//
+// =============================================================================
+
+#include "chrono_multicore/cuda/ChSolverGPU.cuh"
+#include "chrono_multicore/cuda/ChCudaHelper.cuh"
+#include "chrono_multicore/cuda/ChGPUVector.cuh"
+#include <cub/cub.cuh>
+
+namespace chrono {
+
+// Problem dimensions, mirrored in constant memory.
+struct ConeSolverDims {
+    unsigned int size;
+    unsigned int num_contacts;
+    unsigned int num_unilaterals;
+    int sliding;
+};
+
+// GPU Things
+// Device buffers are kept alive across time steps so repeated solves reuse the allocations.
+gpu_vector<int> cone_N_rows, cone_N_cols;
+gpu_vector<real> cone_N_vals, cone_E, cone_r, cone_friction, cone_cohesion;
+gpu_vector<int> cone_DT_rows, cone_DT_cols, cone_MinvD_rows, cone_MinvD_cols;
+gpu_vector<real> cone_DT_vals, cone_MinvD_vals, cone_tmp;
+gpu_vector<real> cone_gamma, cone_gamma_best, cone_ml, cone_mg, cone_ml_p, cone_mg_p;
+gpu_vector<real> cone_dot_diff_norm;
+
+CUDA_CONSTANT ConeSolverDims cone_dims;
+
+/////// BB Constants
+__device__ real cone_alpha = real(0.0001);
+__device__ real cone_dot_ms_ms = 0;
+__device__ real cone_dot_ms_my = 0;
+__device__ real cone_dot_my_my = 0;
+
+#define cone_a_min real(1e-13)
+#define cone_a_max real(1e13)
+#define cone_neg_BB1_fallback real(0.11)
+#define cone_neg_BB2_fallback real(0.12)
+
+// Sparse matrix-vector product out = A*y, with A in CSR form (one thread per row).
+CUDA_GLOBAL void kConeSpMV(int num_rows, const int* rows, const int* cols, const real* vals, const real* y, real* out) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < num_rows) {
+        real sum = 0;
+        const int row_end = rows[i + 1];
+        for (int j = rows[i]; j < row_end; j++) {
+            sum += vals[j] * y[cols[j]];
+        }
+        out[i] = sum;
+    }
+}
+
+// Gradient of the quadratic objective: g = A*y + E.*x - r, with A in CSR form and the
+// compliance diagonal E applied on the fly. In assembled mode A = N and y = x; in
+// matrix-free mode A = D_T and y = M_invD * x.
+CUDA_GLOBAL void kConeGradient(const int* rows,
+                               const int* cols,
+                               const real* vals,
+                               const real* E,
+                               const real* r,
+                               const real* y,
+                               const real* x,
+                               real* g) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < cone_dims.size) {
+        real sum = 0;
+        const int row_end = rows[i + 1];
+        for (int j = rows[i]; j < row_end; j++) {
+            sum += vals[j] * y[cols[j]];
+        }
+        g[i] = sum + E[i] * x[i] - r[i];
+    }
+}
+
+// Project the multipliers of one contact onto the friction cone. Device version of
+// ChConstraintRigidRigid::func_Project_normal / func_Project_sliding; bilateral multipliers
+// (past num_unilaterals) are left untouched.
+CUDA_GLOBAL void kConeProject(const real* friction, const real* cohesion, real* gamma) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= cone_dims.num_contacts) {
+        return;
+    }
+    const unsigned int num_contacts = cone_dims.num_contacts;
+    real coh = cohesion[i];
+    real gamma_n = gamma[i];
+
+    if (!cone_dims.sliding) {
+        gamma[i] = (gamma_n < -coh) ? -coh : gamma_n;
+        return;
+    }
+
+    real mu = friction[i];
+    if (mu == 0) {
+        gamma[i] = (gamma_n < -coh) ? -coh : gamma_n;
+        gamma[num_contacts + i * 2 + 0] = 0;
+        gamma[num_contacts + i * 2 + 1] = 0;
+        return;
+    }
+
+    real gamma_u = gamma[num_contacts + i * 2 + 0];
+    real gamma_v = gamma[num_contacts + i * 2 + 1];
+    gamma_n += coh;
+
+    real f_tang = sqrt(gamma_u * gamma_u + gamma_v * gamma_v);
+    if (f_tang < (mu * gamma_n)) {
+        // inside upper cone? keep untouched!
+    } else if ((f_tang) < -(1 / mu) * gamma_n || (fabs(gamma_n) < 10e-15)) {
+        // inside lower cone? reset normal,u,v to zero!
+        gamma_n = 0;
+        gamma_u = 0;
+        gamma_v = 0;
+    } else {
+        // remaining case: project orthogonally to generator segment of upper cone
+        gamma_n = (f_tang * mu + gamma_n) / (mu * mu + 1);
+        real tproj_div_t = (gamma_n * mu) / f_tang;
+        gamma_u *= tproj_div_t;
+        gamma_v *= tproj_div_t;
+    }
+
+    gamma[i] = gamma_n - coh;
+    gamma[num_contacts + i * 2 + 0] = gamma_u;
+    gamma[num_contacts + i * 2 + 1] = gamma_v;
+}
+
+template <bool inner>
+CUDA_GLOBAL void kConeResetGlobals() {
+    if (inner) {
+        cone_dot_ms_ms = 0;
+        cone_dot_ms_my = 0;
+        cone_dot_my_my = 0;
+    } else {
+        cone_alpha = real(0.0001);
+    }
+}
+
+CUDA_GLOBAL void kConeCandidate(int num_items, const real* ml, const real* mg, real* ml_p) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < num_items) {
+        ml_p[i] = ml[i] - cone_alpha * mg[i];
+    }
+}
+
+template <bool even>
+CUDA_GLOBAL void kConeUpdateAlpha(int num_items, const real* ml_p, const real* ml, const real* mg_p, const real* mg) {
+    typedef cub::BlockReduce<real, num_threads_per_block> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    const int block_start = blockDim.x * blockIdx.x;
+    const int num_valid = min(num_items - block_start, blockDim.x);
+
+    const int tid = block_start + threadIdx.x;
+    if (tid < num_items) {
+        real data, block_sum;
+        real ms = ml_p[tid] - ml[tid];
+        real my = mg_p[tid] - mg[tid];
+
+        if (even) {
+            data = ms * ms;
+            block_sum = BlockReduce(temp_storage).Reduce(data, cub::Sum(), num_valid);
+            if (threadIdx.x == 0) {
+                ATOMIC_ADD(&cone_dot_ms_ms, block_sum);
+            }
+        } else {
+            data = my * my;
+            block_sum = BlockReduce(temp_storage).Reduce(data, cub::Sum(), num_valid);
+            if (threadIdx.x == 0) {
+                ATOMIC_ADD(&cone_dot_my_my, block_sum);
+            }
+        }
+        __syncthreads();
+        data = ms * my;
+        block_sum = BlockReduce(temp_storage).Reduce(data, cub::Sum(), num_valid);
+
+        if (threadIdx.x == 0) {
+            ATOMIC_ADD(&cone_dot_ms_my, block_sum);
+        }
+    }
+}
+
+template <bool even>
+CUDA_GLOBAL void kConeAlpha() {
+    if (even) {
+        if (cone_dot_ms_my <= 0) {
+            cone_alpha = cone_neg_BB1_fallback;
+        } else {
+            cone_alpha = fmin(cone_a_max, fmax(cone_a_min, cone_dot_ms_ms / cone_dot_ms_my));
+        }
+    } else {
+        if (cone_dot_ms_my <= 0) {
+            cone_alpha = cone_neg_BB2_fallback;
+        } else {
+            cone_alpha = fmin(cone_a_max, fmax(cone_a_min, cone_dot_ms_my / cone_dot_my_my));
+        }
+    }
+}
+
+CUDA_GLOBAL void kConeResidual(int num_items, const real* ml_p, const real* ml, real* dot_diff_norm) {
+    typedef cub::BlockReduce<real, num_threads_per_block> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    const int block_start = blockDim.x * blockIdx.x;
+    const int num_valid = min(num_items - block_start, blockDim.x);
+    const int tid = block_start + threadIdx.x;
+    if (tid < num_items) {
+        real data = ml_p[tid] - ml[tid];
+        data = data * data;
+
+        real block_sum = BlockReduce(temp_storage).Reduce(data, cub::Sum(), num_valid);
+
+        if (threadIdx.x == 0) {
+            ATOMIC_ADD(&dot_diff_norm[0], block_sum);
+        }
+    }
+}
+
+unsigned int ConeSolverBB(ConeSolverProblem& problem, std::vector<real>& gamma, real& residual) {
+    const unsigned int size = problem.size;
+    const unsigned int num_contacts = problem.num_contacts;
+
+    ConeSolverDims dims;
+    dims.size = problem.size;
+    dims.num_contacts = problem.num_contacts;
+    dims.num_unilaterals = problem.num_unilaterals;
+    dims.sliding = problem.sliding ? 1 : 0;
+    cudaCheck(cudaMemcpyToSymbol(cone_dims, &dims, sizeof(ConeSolverDims)));
+
+    // Upload the problem, once per solve.
+    if (problem.matrix_free) {
+        cone_DT_rows.getHost() = problem.D_T_rows;
+        cone_DT_rows.copyHostToDevice();
+        cone_DT_cols.getHost() = problem.D_T_cols;
+        cone_DT_cols.copyHostToDevice();
+        cone_DT_vals.getHost() = problem.D_T_vals;
+        cone_DT_vals.copyHostToDevice();
+        cone_MinvD_rows.getHost() = problem.M_invD_rows;
+        cone_MinvD_rows.copyHostToDevice();
+        cone_MinvD_cols.getHost() = problem.M_invD_cols;
+        cone_MinvD_cols.copyHostToDevice();
+        cone_MinvD_vals.getHost() = problem.M_invD_vals;
+        cone_MinvD_vals.copyHostToDevice();
+        cone_tmp.resize(problem.num_dof);
+    } else {
+        cone_N_rows.getHost() = problem.N_rows;
+        cone_N_rows.copyHostToDevice();
+        cone_N_cols.getHost() = problem.N_cols;
+        cone_N_cols.copyHostToDevice();
+        cone_N_vals.getHost() = problem.N_vals;
+        cone_N_vals.copyHostToDevice();
+    }
+    cone_E.getHost() = problem.E;
+    cone_E.copyHostToDevice();
+    cone_r.getHost() = problem.r;
+    cone_r.copyHostToDevice();
+    cone_friction.getHost() = problem.friction;
+    cone_friction.copyHostToDevice();
+    cone_cohesion.getHost() = problem.cohesion;
+    cone_cohesion.copyHostToDevice();
+    cone_gamma.getHost() = gamma;
+    cone_gamma.copyHostToDevice();
+
+    cone_ml.resize(size);
+    cone_mg.resize(size);
+    cone_ml_p.resize(size);
+    cone_mg_p.resize(size);
+    cone_gamma_best.resize(size);
+    cone_dot_diff_norm.resize(1);
+
+    // Evaluate the gradient g = N*x + E.*x - r at the given iterate; in matrix-free mode,
+    // N*x is computed as D_T * (M_invD * x) with a device-resident intermediate.
+    const unsigned int num_dof = problem.num_dof;
+    auto eval_gradient = [&](gpu_vector<real>& x, gpu_vector<real>& g) {
+        if (problem.matrix_free) {
+            kConeSpMV<<<CONFIG(num_dof)>>>(num_dof, cone_MinvD_rows.data_d, cone_MinvD_cols.data_d,
+                                           cone_MinvD_vals.data_d, x.data_d, cone_tmp.data_d);
+            kConeGradient<<<CONFIG(size)>>>(cone_DT_rows.data_d, cone_DT_cols.data_d, cone_DT_vals.data_d,
+                                            cone_E.data_d, cone_r.data_d, cone_tmp.data_d, x.data_d, g.data_d);
+        } else {
+            kConeGradient<<<CONFIG(size)>>>(cone_N_rows.data_d, cone_N_cols.data_d, cone_N_vals.data_d, cone_E.data_d,
+                                            cone_r.data_d, x.data_d, x.data_d, g.data_d);
+        }
+    };
+
+    // ml = Project(gamma_warm_start); mg = gradient at ml
+    cone_ml = cone_gamma;
+    kConeProject<<<CONFIG(num_contacts)>>>(cone_friction.data_d, cone_cohesion.data_d, cone_ml.data_d);
+    eval_gradient(cone_ml, cone_mg);
+    cone_gamma_best = cone_ml;
+    kConeResetGlobals<false><<<1, 1>>>();
+
+    real lastgoodres = real(10e30);
+    unsigned int current_iteration = 0;
+    for (; current_iteration < problem.max_iterations; current_iteration++) {
+        kConeResetGlobals<true><<<1, 1>>>();
+        kConeCandidate<<<CONFIG(size)>>>(size, cone_ml.data_d, cone_mg.data_d, cone_ml_p.data_d);
+        kConeProject<<<CONFIG(num_contacts)>>>(cone_friction.data_d, cone_cohesion.data_d, cone_ml_p.data_d);
+        eval_gradient(cone_ml_p, cone_mg_p);
+
+        if (current_iteration % 2 == 0) {
+            kConeUpdateAlpha<true><<<CONFIG(size)>>>(size, cone_ml_p.data_d, cone_ml.data_d, cone_mg_p.data_d,
+                                                     cone_mg.data_d);
+            kConeAlpha<true><<<1, 1>>>();
+        } else {
+            kConeUpdateAlpha<false><<<CONFIG(size)>>>(size, cone_ml_p.data_d, cone_ml.data_d, cone_mg_p.data_d,
+                                                      cone_mg.data_d);
+            kConeAlpha<false><<<1, 1>>>();
+        }
+
+        // Residual: norm of the step between consecutive projected iterates.
+        cone_dot_diff_norm = 0;
+        kConeResidual<<<CONFIG(size)>>>(size, cone_ml_p.data_d, cone_ml.data_d, cone_dot_diff_norm.data_d);
+        cone_dot_diff_norm.copyDeviceToHost();
+        real res = sqrt(cone_dot_diff_norm.data_h[0]);
+
+        cone_ml = cone_ml_p;
+        cone_mg = cone_mg_p;
+
+        if (res < lastgoodres) {
+            lastgoodres = res;
+            cone_gamma_best = cone_ml;
+        }
+        if (res < problem.tolerance) {
+            current_iteration++;
+            break;
+        }
+    }
+    cudaCheck(cudaPeekAtLastError());
+    cudaCheck(cudaDeviceSynchronize());
+
+    cone_gamma_best.copyDeviceToHost();
+    gamma.assign(cone_gamma_best.data_h.begin(), cone_gamma_best.data_h.begin() + size);
+    residual = lastgoodres;
+
+    return current_iteration;
+}
+
+}  // end namespace chrono
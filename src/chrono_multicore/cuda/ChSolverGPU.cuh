@@ -0,0 +1,65 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: GPU solver for the cone-complementarity problem. Takes either
+// the assembled Schur complement matrix or, in matrix-free mode, the Jacobian
+// and inverse-mass products from which N*x is evaluated on the fly. Outputs
+// the Lagrange multipliers. The multipliers stay resident on the device across
+// the solver iterations; only scalar residuals travel back per iteration.
+//
+// =============================================================================
+
+#pragma once
+
+#include <vector>
+
+#include "chrono/multicore_math/real.h"
+
+namespace chrono {
+
+/// Host-side description of the cone-complementarity problem handed to the GPU solver.
+/// The Schur complement matrix N is given either assembled in CSR form, or implicitly
+/// (matrix-free mode) through the constraint Jacobian D_T and the product M_invD = M^-1 * D,
+/// in which case N*x is evaluated on the device as D_T * (M_invD * x). The compliance
+/// diagonal E is kept separate and applied on the fly during the matrix-vector product.
+struct ConeSolverProblem {
+    unsigned int size;             ///< total number of unknowns
+    unsigned int num_contacts;     ///< number of rigid contacts
+    unsigned int num_unilaterals;  ///< number of unilateral unknowns (bilaterals follow, unprojected)
+    bool sliding;                  ///< project on the friction cone (SLIDING) or normal impulses only
+    bool matrix_free;              ///< evaluate N*x from D_T and M_invD (the N_* arrays are unused)
+    unsigned int num_dof;          ///< number of generalized velocities (matrix-free mode)
+    unsigned int max_iterations;   ///< maximum number of solver iterations
+    real tolerance;                ///< exit threshold on the residual
+
+    std::vector<int> N_rows;      ///< CSR row offsets of N (size + 1 entries)
+    std::vector<int> N_cols;      ///< CSR column indices of N
+    std::vector<real> N_vals;     ///< CSR values of N
+    std::vector<int> D_T_rows;    ///< CSR row offsets of D_T (matrix-free mode; size + 1 entries)
+    std::vector<int> D_T_cols;    ///< CSR column indices of D_T
+    std::vector<real> D_T_vals;   ///< CSR values of D_T
+    std::vector<int> M_invD_rows; ///< CSR row offsets of M_invD (matrix-free mode; num_dof + 1 entries)
+    std::vector<int> M_invD_cols; ///< CSR column indices of M_invD
+    std::vector<real> M_invD_vals;///< CSR values of M_invD
+    std::vector<real> E;          ///< compliance diagonal
+    std::vector<real> r;          ///< right-hand side
+    std::vector<real> friction;   ///< sliding friction coefficient per contact
+    std::vector<real> cohesion;   ///< cohesion per contact
+};
+
+/// Solve the given problem with a Barzilai-Borwein projected gradient iteration on the GPU.
+/// The problem data are uploaded once; gamma (warm start on input, solution on output) is
+/// resident on the device across iterations. Returns the number of iterations performed and
+/// the achieved residual through the output parameter.
+unsigned int ConeSolverBB(ConeSolverProblem& problem, std::vector<real>& gamma, real& residual);
+
+}  // end namespace chrono
@@ -48,7 +48,7 @@ Ch3DOFContainer::Ch3DOFContainer()
       num_motors(0),
       alpha(0) {
     family.x = 1;
-    family.y = 0x7FFF;
+    family.y = 0x7FFFFFFF;
 }
 
 Ch3DOFContainer::Ch3DOFContainer(const Ch3DOFContainer& other) : ChPhysicsItem(other) {
@@ -91,7 +91,7 @@ void Ch3DOFContainer::Setup3DOF(int start_constraint) {
     }
 }
 
-void Ch3DOFContainer::SetFamily(short mfamily, short mask_no_collision) {
+void Ch3DOFContainer::SetFamily(int mfamily, int mask_no_collision) {
     family.x = (1 << mfamily);
     family.y &= ~(1 << mask_no_collision);
 }
@@ -76,7 +76,7 @@ class CH_MULTICORE_API Ch3DOFContainer : public ChPhysicsItem {
     // After Solve
     virtual void UpdatePosition(double ChTime) {}
     virtual void PostSolve() {}
-    void SetFamily(short family, short mask_no_collision);
+    void SetFamily(int family, int mask_no_collision);
 
     // Helper Functions
     uint GetNumParticles() const { return num_fluid_bodies; }
@@ -110,7 +110,7 @@ class CH_MULTICORE_API Ch3DOFContainer : public ChPhysicsItem {
     // Store boundary forces here for rigid bodies
     DynamicVector<real> contact_forces;
     DynamicVector<real> gamma_old;
-    short2 family;
+    vec2 family;
 
   protected:
     ChMulticoreDataManager* data_manager;
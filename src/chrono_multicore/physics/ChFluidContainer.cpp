@@ -65,6 +65,8 @@ void ChFluidContainer::AddBodies(const std::vector<real3>& positions, const std:
     custom_vector<real3>& pos_fluid = data_manager->host_data.pos_3dof;
     custom_vector<real3>& vel_fluid = data_manager->host_data.vel_3dof;
 
+    ReserveAmortized(pos_fluid, pos_fluid.size() + positions.size());
+    ReserveAmortized(vel_fluid, pos_fluid.size() + positions.size());
     pos_fluid.insert(pos_fluid.end(), positions.begin(), positions.end());
     vel_fluid.insert(vel_fluid.end(), velocities.begin(), velocities.end());
     // In case the number of velocities provided were not enough, resize to the number of fluid bodies
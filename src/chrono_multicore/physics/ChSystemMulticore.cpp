@@ -33,6 +33,7 @@
 #include "chrono_multicore/solver/ChSolverMulticore.h"
 #include "chrono_multicore/solver/ChSystemDescriptorMulticore.h"
 
+#include <algorithm>
 #include <numeric>
 
 using namespace chrono::collision;
@@ -60,6 +61,15 @@ ChSystemMulticore::ChSystemMulticore() : ChSystem() {
     detect_optimal_bins = false;
     current_threads = 2;
 
+    do_body_reorder = false;
+    body_reorder_frequency = 100;
+    body_reorder_frame = 0;
+
+    do_pipeline = false;
+    pipeline_margin = 0;
+    speculation_in_flight = false;
+    speculative_contacts_ready = false;
+
     data_manager->system_timer.AddTimer("step");
     data_manager->system_timer.AddTimer("update");
     data_manager->system_timer.AddTimer("advance");
@@ -103,6 +113,15 @@ ChBodyAuxRef* ChSystemMulticore::NewBodyAuxRef() {
 }
 
 bool ChSystemMulticore::Integrate_Y() {
+    // Join the collision detection run launched asynchronously at the end of the previous step,
+    // before anything below touches the collision data. Whether its results can be used is
+    // decided in the collision phase, once the data arrays have been repopulated.
+    if (speculation_in_flight) {
+        speculative_collision.wait();
+        speculation_in_flight = false;
+        speculative_contacts_ready = true;
+    }
+
     ResetTimers();
     timer_step.start();  // time elapsed for step (for RTF calculation)
 
@@ -115,6 +134,12 @@ bool ChSystemMulticore::Integrate_Y() {
     data_manager->system_timer.Reset();
     data_manager->system_timer.start("step");
 
+    // Periodically re-sort the bodies along a Morton curve, before the data arrays are
+    // repopulated and before collision detection (so contact indices need no remapping).
+    if (do_body_reorder && (body_reorder_frame++ % body_reorder_frequency == 0)) {
+        ReorderBodiesSpatially();
+    }
+
     Setup();
 
     data_manager->system_timer.start("update");
@@ -123,7 +148,10 @@ bool ChSystemMulticore::Integrate_Y() {
 
     data_manager->system_timer.start("collision");
     collision_system->PreProcess();
-    collision_system->Run();
+    if (!speculative_contacts_ready || !ValidateSpeculativeCollision()) {
+        collision_system->Run();
+    }
+    speculative_contacts_ready = false;
     collision_system->PostProcess();
     collision_system->ReportContacts(this->contact_container.get());
     for (size_t ic = 0; ic < collision_callbacks.size(); ic++) {
@@ -219,6 +247,16 @@ bool ChSystemMulticore::Integrate_Y() {
     data_manager->node_container->UpdatePosition(ch_time);
     data_manager->system_timer.stop("update");
 
+    // Launch collision detection for the next step asynchronously: all positions for the next
+    // step are final at this point, so the run overlaps the remaining host work and any
+    // application code executed between steps. The results are picked up (and validated against
+    // position changes made by the application) at the beginning of the next step.
+    if (do_pipeline && collision_system_type == ChCollisionSystemType::CHRONO) {
+        speculative_pos = data_manager->host_data.pos_rigid;
+        speculative_collision = std::async(std::launch::async, [this] { collision_system->Run(); });
+        speculation_in_flight = true;
+    }
+
     //=============================================================================================
     ch_time += GetStep();
     data_manager->system_timer.stop("step");
@@ -341,9 +379,11 @@ void ChSystemMulticore::Update() {
     // Clear the forces for all variables
     ClearForceVariables();
 
-    // Allocate space for the velocities and forces for all objects
-    data_manager->host_data.v.resize(data_manager->num_dof);
-    data_manager->host_data.hf.resize(data_manager->num_dof);
+    // Allocate space for the velocities and forces for all objects.
+    // Use first-touch resizing so that, on NUMA hardware, the pages of these large vectors
+    // end up distributed over the nodes of the threads that operate on them.
+    ResizeFirstTouch(data_manager->host_data.v, data_manager->num_dof);
+    ResizeFirstTouch(data_manager->host_data.hf, data_manager->num_dof);
 
     // Clear system-wide vectors for bilateral constraints
     data_manager->host_data.bilateral_mapping.clear();
@@ -664,6 +704,124 @@ void ChSystemMulticore::RecomputeThreads() {
 #endif
 }
 
+void ChSystemMulticore::EnableBodyReordering(bool enable, int frequency) {
+    do_body_reorder = enable;
+    body_reorder_frequency = frequency;
+}
+
+void ChSystemMulticore::EnableCollisionSolverPipelining(bool enable, real margin) {
+    do_pipeline = enable;
+    pipeline_margin = margin;
+}
+
+// Check whether the contacts from the speculative collision run are still valid: the set of
+// bodies must be unchanged and no body may have moved by more than the pipelining margin
+// (application code may have repositioned bodies between steps).
+bool ChSystemMulticore::ValidateSpeculativeCollision() {
+    uint num_bodies = data_manager->num_rigid_bodies;
+    if (speculative_pos.size() != num_bodies)
+        return false;
+
+    const custom_vector<real3>& position = data_manager->host_data.pos_rigid;
+    real margin_sq = pipeline_margin * pipeline_margin;
+    for (uint i = 0; i < num_bodies; i++) {
+        real3 delta = position[i] - speculative_pos[i];
+        if (Dot(delta, delta) > margin_sq)
+            return false;
+    }
+    return true;
+}
+
+// Interleave the lower 10 bits of the given value with two zero bits
+// (component of a 30-bit 3D Morton code).
+static inline uint SplitBy3(uint v) {
+    v &= 0x3ff;
+    v = (v | (v << 16)) & 0x030000FF;
+    v = (v | (v << 8)) & 0x0300F00F;
+    v = (v | (v << 4)) & 0x030C30C3;
+    v = (v | (v << 2)) & 0x09249249;
+    return v;
+}
+
+void ChSystemMulticore::ReorderBodiesSpatially() {
+    uint num_bodies = data_manager->num_rigid_bodies;
+    if (num_bodies < 2)
+        return;
+
+    // Contacts from a speculative collision run refer to the pre-permutation body indices.
+    speculative_contacts_ready = false;
+
+    custom_vector<real3>& position = data_manager->host_data.pos_rigid;
+
+    // Bounding box of the current body positions.
+    real3 pmin = position[0];
+    real3 pmax = position[0];
+    for (uint i = 1; i < num_bodies; i++) {
+        pmin = Min(pmin, position[i]);
+        pmax = Max(pmax, position[i]);
+    }
+    real3 extent = pmax - pmin;
+    real3 fac(extent.x > 0 ? real(1023.0) / extent.x : 0,  //
+              extent.y > 0 ? real(1023.0) / extent.y : 0,  //
+              extent.z > 0 ? real(1023.0) / extent.z : 0);
+
+    // Morton code for each body from its position quantized on a 1024^3 grid.
+    // Sorting (code, index) pairs keeps the permutation deterministic for equal codes.
+    std::vector<std::pair<uint, uint>> order(num_bodies);
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_bodies; i++) {
+        uint ix = (uint)((position[i].x - pmin.x) * fac.x);
+        uint iy = (uint)((position[i].y - pmin.y) * fac.y);
+        uint iz = (uint)((position[i].z - pmin.z) * fac.z);
+        uint code = SplitBy3(ix) | (SplitBy3(iy) << 1) | (SplitBy3(iz) << 2);
+        order[i] = std::make_pair(code, (uint)i);
+    }
+    std::sort(order.begin(), order.end());
+
+    // Old-to-new index map.
+    std::vector<uint> new_index(num_bodies);
+    for (uint ni = 0; ni < num_bodies; ni++) {
+        new_index[order[ni].second] = ni;
+    }
+
+    // Permute the body list and reassign the body identifiers. All per-body data arrays are
+    // rebuilt in body-list order during the subsequent update, so they need no permutation here.
+    std::vector<std::shared_ptr<ChBody>> sorted_bodies(num_bodies);
+    for (uint ni = 0; ni < num_bodies; ni++) {
+        sorted_bodies[ni] = assembly.bodylist[order[ni].second];
+        sorted_bodies[ni]->SetId(ni);
+    }
+    assembly.bodylist.swap(sorted_bodies);
+
+    // Remap the body indices baked into the collision shapes at the time they were added.
+    for (auto& id : data_manager->cd_data->shape_data.id_rigid) {
+        if (id < num_bodies)
+            id = new_index[id];
+    }
+
+    // The SMC contact history is the only per-body data that must survive the reordering:
+    // permute the per-body neighbor blocks and remap the neighbor body indices they store.
+    custom_vector<vec3>& shear_neigh = data_manager->host_data.shear_neigh;
+    if (shear_neigh.size() == (size_t)num_bodies * max_shear) {
+        custom_vector<real3>& shear_disp = data_manager->host_data.shear_disp;
+        custom_vector<vec3> sorted_neigh(shear_neigh.size());
+        custom_vector<real3> sorted_disp(shear_disp.size());
+#pragma omp parallel for
+        for (int oi = 0; oi < (signed)num_bodies; oi++) {
+            uint ni = new_index[oi];
+            for (int k = 0; k < max_shear; k++) {
+                vec3 entry = shear_neigh[oi * max_shear + k];
+                if (entry.x >= 0)
+                    entry.x = new_index[entry.x];
+                sorted_neigh[ni * max_shear + k] = entry;
+                sorted_disp[ni * max_shear + k] = shear_disp[oi * max_shear + k];
+            }
+        }
+        shear_neigh.swap(sorted_neigh);
+        shear_disp.swap(sorted_disp);
+    }
+}
+
 void ChSystemMulticore::SetCollisionSystemType(ChCollisionSystemType type) {
     assert(assembly.GetNbodies() == 0);
 
@@ -22,6 +22,7 @@
 
 #include <cstdlib>
 #include <cfloat>
+#include <future>
 #include <memory>
 #include <algorithm>
 
@@ -73,6 +74,23 @@ class CH_MULTICORE_API ChSystemMulticore : public ChSystem {
     virtual void Update3DOFBodies();
     void RecomputeThreads();
 
+    /// Enable periodic spatial reordering of the bodies (default: disabled).
+    /// Every 'frequency' steps, the bodies are re-sorted along a Morton (Z-order) space-filling
+    /// curve so that spatially neighboring bodies are also adjacent in the system-wide data
+    /// arrays. Granular flows churn the original insertion order over time, degrading the cache
+    /// behavior of the force and solver kernels; periodic re-sorting restores streaming access.
+    void EnableBodyReordering(bool enable, int frequency = 100);
+
+    /// Enable pipelining of collision detection with the host-side end of the step (default: disabled).
+    /// When enabled, collision detection for the next step is launched asynchronously as soon as
+    /// the new body positions are available, overlapping it with the remaining host work and with
+    /// any application code executed between steps. The speculative contacts are used at the next
+    /// step only if no body position changed by more than 'margin' in the meantime (e.g. by
+    /// application code repositioning bodies); otherwise collision detection is re-run.
+    /// Only supported with the Chrono collision system type. While enabled, contact data must
+    /// not be queried between steps, since the asynchronous run may still be writing it.
+    void EnableCollisionSolverPipelining(bool enable, real margin = 0);
+
     virtual ChBody* NewBody() override;
     virtual ChBodyAuxRef* NewBodyAuxRef() override;
 
@@ -185,9 +203,30 @@ class CH_MULTICORE_API ChSystemMulticore : public ChSystem {
     int current_threads;
 
   protected:
+    /// Re-sort the bodies along a Morton curve computed from their current positions.
+    /// Permutes the body list (per-body data arrays are rebuilt from it in the subsequent
+    /// update) and remaps the body indices stored in the collision shapes and in the SMC
+    /// contact history.
+    virtual void ReorderBodiesSpatially();
+
+    /// Check whether the contacts produced by the asynchronous collision run are still valid
+    /// (unchanged body set, no body moved beyond the pipelining margin).
+    bool ValidateSpeculativeCollision();
+
     double old_timer, old_timer_cd;
     bool detect_optimal_threads;
 
+    bool do_body_reorder;        ///< periodically re-sort bodies along a Morton curve?
+    int body_reorder_frequency;  ///< number of steps between body reordering passes
+    uint body_reorder_frame;     ///< frame counter for the reordering pass
+
+    bool do_pipeline;                        ///< overlap collision detection with end-of-step work?
+    real pipeline_margin;                    ///< max position change before speculative contacts are discarded
+    bool speculation_in_flight;              ///< is an asynchronous collision run pending?
+    bool speculative_contacts_ready;         ///< are the speculative contacts usable this step?
+    std::future<void> speculative_collision; ///< handle of the asynchronous collision run
+    custom_vector<real3> speculative_pos;    ///< body positions used by the speculative run
+
     int detect_optimal_bins;
     std::vector<double> timer_accumulator, cd_accumulator;
     uint frame_threads, frame_bins, counter;
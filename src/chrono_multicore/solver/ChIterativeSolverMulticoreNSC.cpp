@@ -399,6 +399,9 @@ void ChIterativeSolverMulticoreNSC::ChangeSolverType(SolverType type) {
         case SolverType::BB:
             solver = new ChSolverMulticoreBB();
             break;
+        case SolverType::BB_GPU:
+            solver = new ChSolverMulticoreBBGPU();
+            break;
         case SolverType::SPGQP:
             solver = new ChSolverMulticoreSPGQP();
             break;
@@ -703,8 +703,8 @@ void ChIterativeSolverMulticoreSMC::ProcessContacts() {
     custom_vector<real3>& ct_body_force = data_manager->host_data.ct_body_force;
     custom_vector<real3>& ct_body_torque = data_manager->host_data.ct_body_torque;
 
-    ct_body_force.resize(data_manager->num_rigid_bodies);
-    ct_body_torque.resize(data_manager->num_rigid_bodies);
+    ResizeFirstTouch(ct_body_force, data_manager->num_rigid_bodies);
+    ResizeFirstTouch(ct_body_torque, data_manager->num_rigid_bodies);
 
     // Reduce contact forces from all contacts and count bodies currently involved
     // in contact. We do this simultaneously for contact forces and torques, using
@@ -795,7 +795,7 @@ void ChIterativeSolverMulticoreSMC::RunTimeStep() {
     data_manager->num_unilaterals = 0;
 
     // Calculate contact forces (impulses) and append them to the body forces
-    data_manager->host_data.ct_body_map.resize(data_manager->num_rigid_bodies);
+    ResizeFirstTouch(data_manager->host_data.ct_body_map, data_manager->num_rigid_bodies);
     Thrust_Fill(data_manager->host_data.ct_body_map, -1);
 
     if (data_manager->cd_data->num_rigid_contacts > 0) {
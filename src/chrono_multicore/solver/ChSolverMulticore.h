@@ -61,12 +61,17 @@ class CH_MULTICORE_API ChShurProduct {
     ChShurProduct();
     virtual ~ChShurProduct() {}
 
-    virtual void Setup(ChMulticoreDataManager* data_container_) { data_manager = data_container_; }
+    virtual void Setup(ChMulticoreDataManager* data_container_);
 
     //. Perform the Shur Product.
     virtual void operator()(const DynamicVector<real>& x, DynamicVector<real>& AX);
 
     ChMulticoreDataManager* data_manager;  ///< Pointer to the system's data manager
+
+  protected:
+    /// Names of the per-thread busy-time timers ("ShurProduct_thread_<i>"), registered with the
+    /// system timer collection in Setup.
+    std::vector<std::string> thread_timer_names;
 };
 
 /// Functor class for performing the Shur product of the matrix of bilateral constraints.
@@ -207,6 +212,29 @@ class CH_MULTICORE_API ChSolverMulticoreBB : public ChSolverMulticore {
     DynamicVector<real> mD, invmD;
 };
 
+/// Barzilai-Borwein solver running on the GPU.
+/// Operates on the assembled Schur complement matrix (requires compute_N); the problem data are
+/// uploaded once per solve and the multipliers stay resident on the device across iterations.
+class CH_MULTICORE_API ChSolverMulticoreBBGPU : public ChSolverMulticore {
+  public:
+    ChSolverMulticoreBBGPU() {}
+    ~ChSolverMulticoreBBGPU() {}
+
+    /// Solve using the BB method on the GPU. Falls back to the CPU BB solver when CUDA support
+    /// is not compiled in or the problem configuration is not supported on the device (N not
+    /// precomputed, partial solver modes, or spinning contacts).
+    uint Solve(ChShurProduct& ShurProduct,    ///< Schur product
+               ChProjectConstraints& Project, ///< Constraints
+               const uint max_iter,           ///< Maximum number of iterations
+               const uint size,               ///< Number of unknowns
+               const DynamicVector<real>& b,  ///< Rhs vector
+               DynamicVector<real>& x         ///< The vector of unknowns
+               );
+
+  private:
+    ChSolverMulticoreBB cpu_solver;  ///< fallback CPU solver
+};
+
 /// MINRES solver.
 class CH_MULTICORE_API ChSolverMulticoreMinRes : public ChSolverMulticore {
   public:
@@ -0,0 +1,121 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono_multicore/ChConfigMulticore.h"
+#include "chrono_multicore/solver/ChSolverMulticore.h"
+
+#ifdef CHRONO_MULTICORE_USE_CUDA
+    #include "chrono_multicore/cuda/ChSolverGPU.cuh"
+#endif
+
+using namespace chrono;
+
+uint ChSolverMulticoreBBGPU::Solve(ChShurProduct& ShurProduct,
+                                   ChProjectConstraints& Project,
+                                   const uint max_iter,
+                                   const uint size,
+                                   const DynamicVector<real>& r,
+                                   DynamicVector<real>& gamma) {
+    if (size == 0) {
+        return 0;
+    }
+
+#ifdef CHRONO_MULTICORE_USE_CUDA
+    const solver_settings& settings = data_manager->settings.solver;
+
+    // The GPU path projects normal and sliding friction multipliers. With compute_N it operates
+    // on the assembled Schur complement matrix; otherwise it runs matrix-free from the Jacobian
+    // and inverse-mass products, with no host-side N assembly. Anything else (partial solver
+    // modes, spinning contacts) is handled by the CPU solver.
+    if (settings.local_solver_mode == settings.solver_mode &&
+        (settings.solver_mode == SolverMode::NORMAL || settings.solver_mode == SolverMode::SLIDING)) {
+        const DynamicVector<real>& E = data_manager->host_data.E;
+        uint num_contacts = data_manager->cd_data->num_rigid_contacts;
+
+        ConeSolverProblem problem;
+        problem.size = size;
+        problem.num_contacts = num_contacts;
+        problem.num_unilaterals = data_manager->num_unilaterals;
+        problem.sliding = settings.solver_mode == SolverMode::SLIDING;
+        problem.matrix_free = !settings.compute_N;
+        problem.num_dof = 0;
+        problem.max_iterations = max_iter;
+        problem.tolerance = settings.tolerance;
+
+        // Flatten a blaze sparse matrix into CSR form.
+        auto flatten = [](const CompressedMatrix<real>& M, std::vector<int>& rows, std::vector<int>& cols,
+                          std::vector<real>& vals) {
+            size_t num_rows = M.rows();
+            rows.resize(num_rows + 1);
+            cols.clear();
+            vals.clear();
+            cols.reserve(M.nonZeros());
+            vals.reserve(M.nonZeros());
+            rows[0] = 0;
+            for (size_t i = 0; i < num_rows; i++) {
+                for (auto it = M.begin(i); it != M.end(i); ++it) {
+                    cols.push_back((int)it->index());
+                    vals.push_back(it->value());
+                }
+                rows[i + 1] = (int)cols.size();
+            }
+        };
+
+        // The compliance diagonal stays separate and is applied on the fly in the device
+        // matrix-vector product.
+        if (settings.compute_N) {
+            flatten(data_manager->host_data.Nshur, problem.N_rows, problem.N_cols, problem.N_vals);
+        } else {
+            const CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
+            const CompressedMatrix<real>& M_invD = data_manager->host_data.M_invD;
+            problem.num_dof = (unsigned int)D_T.columns();
+            flatten(D_T, problem.D_T_rows, problem.D_T_cols, problem.D_T_vals);
+            flatten(M_invD, problem.M_invD_rows, problem.M_invD_cols, problem.M_invD_vals);
+        }
+
+        problem.E.resize(size);
+        problem.r.resize(size);
+        for (uint i = 0; i < size; i++) {
+            problem.E[i] = E[i];
+            problem.r[i] = r[i];
+        }
+
+        problem.friction.resize(num_contacts);
+        problem.cohesion.resize(num_contacts);
+        for (uint i = 0; i < num_contacts; i++) {
+            problem.friction[i] = data_manager->host_data.fric_rigid_rigid[i].x;
+            problem.cohesion[i] = data_manager->host_data.coh_rigid_rigid[i];
+        }
+
+        std::vector<real> gamma_host(size);
+        for (uint i = 0; i < size; i++) {
+            gamma_host[i] = gamma[i];
+        }
+
+        real residual;
+        uint iterations = ConeSolverBB(problem, gamma_host, residual);
+
+        for (uint i = 0; i < size; i++) {
+            gamma[i] = gamma_host[i];
+        }
+        data_manager->measures.solver.residual = residual;
+        current_iteration = (int)iterations;
+
+        return iterations;
+    }
+#endif
+
+    cpu_solver.Setup(data_manager);
+    uint iterations = cpu_solver.Solve(ShurProduct, Project, max_iter, size, r, gamma);
+    current_iteration = cpu_solver.current_iteration;
+    return iterations;
+}
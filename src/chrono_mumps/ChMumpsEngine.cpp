@@ -74,6 +74,23 @@ void ChMumpsEngine::SetMatrix(const ChSparseMatrix& Z) {
     mumps_id.a = m_a.data();
 }
 
+bool ChMumpsEngine::SetMatrixValues(const ChSparseMatrix& Z) {
+    if ((int)Z.rows() != mumps_id.n || (int)Z.nonZeros() != mumps_id.nz)
+        return false;
+
+    // Rewrite the nonzero values only, traversing the matrix in the same order used by SetMatrix so that each value
+    // lands in the COO slot matching its stored row/column indices.
+    int i = 0;
+    for (int k = 0; k < Z.outerSize(); ++k) {
+        for (ChSparseMatrix::InnerIterator it(Z, k); it; ++it) {
+            m_a[i] = it.value();
+            i++;
+        }
+    }
+
+    return true;
+}
+
 void ChMumpsEngine::SetMatrixSymmetry(mumps_SYM mat_type) {
     mumps_id.sym = mat_type;
 }
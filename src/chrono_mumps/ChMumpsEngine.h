@@ -60,6 +60,13 @@ class ChApiMumps ChMumpsEngine {
     /// Set the problem matrix.
     void SetMatrix(const ChSparseMatrix& Z);
 
+    /// Refresh only the numeric values of a previously set problem matrix.
+    /// The sparsity pattern of Z must be identical to that of the matrix passed to the last call to SetMatrix: the
+    /// stored COO index arrays and any MUMPS analysis data remain valid and only the nonzero values are rewritten.
+    /// Return false (leaving the stored matrix unchanged) if the dimension or nonzero count do not match, in which
+    /// case the caller must fall back to a full SetMatrix.
+    bool SetMatrixValues(const ChSparseMatrix& Z);
+
     /// Informs MUMPS of the matrix symmetry type.
     void SetMatrixSymmetry(mumps_SYM symmetry);
 
@@ -49,6 +49,18 @@ void ChSolverMumps::SetMatrixSymmetryType(MatrixSymmetryType symmetry) {
 bool ChSolverMumps::FactorizeMatrix() {
     m_engine.SetMatrix(m_mat);
     auto mumps_err = m_engine.MumpsCall(ChMumpsEngine::mumps_JOB::ANALYZE_FACTORIZE);
+    m_analyzed = (mumps_err == 0);
+    return (mumps_err == 0);
+}
+
+bool ChSolverMumps::FactorizeMatrixNumeric() {
+    // Reuse the analysis data from the previous factorization: push only the new numeric values to Mumps and
+    // run a numeric-only factorization. Fall back to a full analyze+factorize if no valid analysis is available
+    // or the matrix structure does not match the stored one.
+    if (!m_analyzed || !m_engine.SetMatrixValues(m_mat))
+        return FactorizeMatrix();
+
+    auto mumps_err = m_engine.MumpsCall(ChMumpsEngine::mumps_JOB::FACTORIZE);
     return (mumps_err == 0);
 }
 
@@ -70,6 +70,10 @@ class ChApiMumps ChSolverMumps : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Refactorize the matrix reusing the analysis data from the previous factorization.
+    /// Only the numeric values are pushed to Mumps and the (expensive) analysis phase is skipped.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -78,7 +82,8 @@ class ChApiMumps ChSolverMumps : public ChDirectSolverLS {
     /// This function is only called if Factorize or Solve returned false.
     virtual void PrintErrorMessage() override;
 
-    ChMumpsEngine m_engine;  ///< interface to Mumps solver
+    ChMumpsEngine m_engine;    ///< interface to Mumps solver
+    bool m_analyzed = false;   ///< is a valid Mumps analysis available for numeric-only refactorization?
 };
 
 /// @} mumps_module
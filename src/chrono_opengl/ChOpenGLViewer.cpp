@@ -626,10 +626,20 @@ void ChOpenGLViewer::RenderParticles() {
                     continue;
 
                 size_t n = 0;
-                for (int i = 0; i < pcloud->GetNparticles(); i++) {
-                    const auto& pos = pcloud->GetParticle(i).GetPos();
-                    if (!m_vis->particle_selector || m_vis->particle_selector->Render(pos)) {
-                        particle_data[num_particles + n++] = glm::vec3(pos.x(), pos.y(), pos.z());
+                if (!m_vis->particle_selector) {
+                    // No filtering: every particle is rendered, so the fill can proceed in parallel.
+                    n = pcloud->GetNparticles();
+#pragma omp parallel for
+                    for (int i = 0; i < pcloud->GetNparticles(); i++) {
+                        const auto& pos = pcloud->GetParticle(i).GetPos();
+                        particle_data[num_particles + i] = glm::vec3(pos.x(), pos.y(), pos.z());
+                    }
+                } else {
+                    for (int i = 0; i < pcloud->GetNparticles(); i++) {
+                        const auto& pos = pcloud->GetParticle(i).GetPos();
+                        if (m_vis->particle_selector->Render(pos)) {
+                            particle_data[num_particles + n++] = glm::vec3(pos.x(), pos.y(), pos.z());
+                        }
                     }
                 }
 
@@ -23,7 +23,7 @@ using namespace glm;
 namespace chrono {
 namespace opengl {
 
-ChOpenGLMesh::ChOpenGLMesh() : ChOpenGLObject() {}
+ChOpenGLMesh::ChOpenGLMesh() : ChOpenGLObject(), size(0) {}
 
 bool ChOpenGLMesh::Initialize(std::vector<glm::vec3>& vertices,
                               std::vector<glm::vec3>& normals,
@@ -198,17 +198,17 @@ void ChOpenGLMesh::TakeDown() {
  bytes.
  */
 void ChOpenGLMesh::Update(std::vector<glm::mat4>& model) {
-    std::vector<glm::vec3> a(model.size()), d(model.size()), s(model.size());
-    for (int i = 0; i < model.size(); i++) {
-        a[i] = ambient;
-        d[i] = diffuse;
-    }
+    // The per-instance colors are constant across frames; only re-upload them when the instance
+    // count changes. The per-instance transforms are re-uploaded every frame.
+    if (size != (int)model.size()) {
+        std::vector<glm::vec3> a(model.size(), ambient), d(model.size(), diffuse);
 
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_ambient_handle);
-    glBufferData(GL_ARRAY_BUFFER, a.size() * sizeof(vec3), &a[0], GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_ambient_handle);
+        glBufferData(GL_ARRAY_BUFFER, a.size() * sizeof(vec3), &a[0], GL_DYNAMIC_DRAW);
 
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_diffuse_handle);
-    glBufferData(GL_ARRAY_BUFFER, d.size() * sizeof(vec3), &d[0], GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_diffuse_handle);
+        glBufferData(GL_ARRAY_BUFFER, d.size() * sizeof(vec3), &d[0], GL_DYNAMIC_DRAW);
+    }
 
     glBindBuffer(GL_ARRAY_BUFFER, vertex_model_handle);
     glBufferData(GL_ARRAY_BUFFER, model.size() * sizeof(mat4), &model[0], GL_DYNAMIC_DRAW);
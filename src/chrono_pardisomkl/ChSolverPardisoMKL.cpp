@@ -24,6 +24,17 @@ ChSolverPardisoMKL::ChSolverPardisoMKL(int num_threads) {
 
 bool ChSolverPardisoMKL::FactorizeMatrix() {
     m_engine.compute(m_mat);
+    m_analyzed = (m_engine.info() == Eigen::Success);
+    return (m_engine.info() == Eigen::Success);
+}
+
+bool ChSolverPardisoMKL::FactorizeMatrixNumeric() {
+    // Reuse the symbolic analysis from the previous factorization and re-run only the numeric phase of Pardiso.
+    // Fall back to a full compute (analyze + factorize) if no valid analysis is available.
+    if (!m_analyzed)
+        return FactorizeMatrix();
+
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -61,6 +72,17 @@ ChSolverComplexPardisoMKL::ChSolverComplexPardisoMKL(int num_threads) {
 
 bool ChSolverComplexPardisoMKL::FactorizeMatrix() {
     m_engine.compute(m_mat);
+    m_analyzed = (m_engine.info() == Eigen::Success);
+    return (m_engine.info() == Eigen::Success);
+}
+
+bool ChSolverComplexPardisoMKL::FactorizeMatrixNumeric() {
+    // Reuse the symbolic analysis from the previous factorization and re-run only the numeric phase of Pardiso.
+    // Fall back to a full compute (analyze + factorize) if no valid analysis is available.
+    if (!m_analyzed)
+        return FactorizeMatrix();
+
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
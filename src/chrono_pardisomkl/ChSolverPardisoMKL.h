@@ -70,6 +70,10 @@ class ChApiPardisoMKL ChSolverPardisoMKL : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Refactorize the matrix reusing the symbolic analysis from the previous factorization.
+    /// Only the numeric phase of Pardiso is re-run.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -79,6 +83,7 @@ class ChApiPardisoMKL ChSolverPardisoMKL : public ChDirectSolverLS {
     virtual void PrintErrorMessage() override;
 
     Eigen::PardisoLU<ChSparseMatrix> m_engine;  ///< underlying Eigen Pardiso interface
+    bool m_analyzed = false;                    ///< is a valid symbolic analysis available for numeric-only refactorization?
 };
 
 
@@ -96,6 +101,10 @@ class ChApiPardisoMKL ChSolverComplexPardisoMKL : public ChDirectSolverLScomplex
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Refactorize the matrix reusing the symbolic analysis from the previous factorization.
+    /// Only the numeric phase of Pardiso is re-run.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem(const ChVectorDynamic<std::complex<double>>& b) override;
@@ -105,6 +114,7 @@ class ChApiPardisoMKL ChSolverComplexPardisoMKL : public ChDirectSolverLScomplex
     virtual void PrintErrorMessage() override;
 
     Eigen::PardisoLU<Eigen::SparseMatrix<std::complex<double>, Eigen::ColMajor>> m_engine;  ///< underlying Eigen Pardiso interface
+    bool m_analyzed = false;  ///< is a valid symbolic analysis available for numeric-only refactorization?
 };
 
 
@@ -21,6 +21,8 @@
 #include <fstream>
 #include <iostream>
 #include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 #include "chrono_parsers/ChParserURDF.h"
 
@@ -49,28 +51,59 @@ using std::endl;
 // Threshold for identifying bodies with zero inertia properties.
 const double inertia_threshold = 1e-6;
 
+// Caches shared across all parser instances, so that re-creating a parser for the same URDF file (e.g., when
+// resetting a simulation environment) does not re-parse the XML nor re-load collision meshes from disk.
+// The cached model trees and meshes are shared and treated as immutable; per-instance settings (actuation,
+// contact materials, collision types) are kept in the parser object itself.
+static std::mutex urdf_model_cache_mutex;
+static std::unordered_map<std::string, urdf::ModelInterfaceSharedPtr> urdf_model_cache;
+
+static std::mutex urdf_mesh_cache_mutex;
+static std::unordered_map<std::string, std::shared_ptr<geometry::ChTriangleMeshConnected>> urdf_mesh_cache;
+
 ChParserURDF::ChParserURDF(const std::string& filename) : m_filename(filename), m_vis_collision(false), m_sys(nullptr) {
-    // Read input file into XML string
-    std::string xml_string;
-    std::fstream xml_file(filename, std::fstream::in);
-    while (xml_file.good()) {
-        std::string line;
-        std::getline(xml_file, line);
-        xml_string += (line + "\n");
-    }
-    xml_file.close();
-
-    // Parse XML string
-    m_model = urdf::parseURDF(xml_string);
+    {
+        std::lock_guard<std::mutex> lock(urdf_model_cache_mutex);
+        auto it = urdf_model_cache.find(filename);
+        if (it != urdf_model_cache.end())
+            m_model = it->second;
+    }
+
     if (!m_model) {
-        cerr << "ERROR: parsing the URDF file " << filename << " failed." << endl;
-        return;
+        // Read input file into XML string
+        std::string xml_string;
+        std::fstream xml_file(filename, std::fstream::in);
+        while (xml_file.good()) {
+            std::string line;
+            std::getline(xml_file, line);
+            xml_string += (line + "\n");
+        }
+        xml_file.close();
+
+        // Parse XML string
+        m_model = urdf::parseURDF(xml_string);
+        if (!m_model) {
+            cerr << "ERROR: parsing the URDF file " << filename << " failed." << endl;
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(urdf_model_cache_mutex);
+        urdf_model_cache.insert(std::make_pair(filename, m_model));
     }
 
     // Cache path to the URDF model file
     m_filepath = filesystem::path(filename).parent_path().str();
 }
 
+void ChParserURDF::ClearCache() {
+    {
+        std::lock_guard<std::mutex> lock(urdf_model_cache_mutex);
+        urdf_model_cache.clear();
+    }
+    std::lock_guard<std::mutex> lock(urdf_mesh_cache_mutex);
+    urdf_mesh_cache.clear();
+}
+
 void ChParserURDF::SetRootInitPose(const ChFrame<>& init_pose) {
     if (m_sys) {
         cerr << "WARNING: SetRootInitPose must be called before PopulateSystem." << endl;
@@ -344,10 +377,24 @@ void ChParserURDF::attachCollision(std::shared_ptr<ChBody> body,
                     auto ext = filesystem::path(mesh->filename).extension();
 
                     std::shared_ptr<geometry::ChTriangleMeshConnected> trimesh;
-                    if (ext == "obj" || ext == "OBJ")
-                        trimesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(mesh_filename, false);
-                    else if (ext == "stl" || ext == "STL")
-                        trimesh = geometry::ChTriangleMeshConnected::CreateFromSTLFile(mesh_filename, true);
+                    {
+                        std::lock_guard<std::mutex> lock(urdf_mesh_cache_mutex);
+                        auto it = urdf_mesh_cache.find(mesh_filename);
+                        if (it != urdf_mesh_cache.end())
+                            trimesh = it->second;
+                    }
+
+                    if (!trimesh) {
+                        if (ext == "obj" || ext == "OBJ")
+                            trimesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(mesh_filename, false);
+                        else if (ext == "stl" || ext == "STL")
+                            trimesh = geometry::ChTriangleMeshConnected::CreateFromSTLFile(mesh_filename, true);
+
+                        if (trimesh) {
+                            std::lock_guard<std::mutex> lock(urdf_mesh_cache_mutex);
+                            urdf_mesh_cache.insert(std::make_pair(mesh_filename, trimesh));
+                        }
+                    }
 
                     if (!trimesh) {
                         cout << "Warning: Unsupported format for collision mesh file <" << mesh_filename << ">." << endl;
@@ -53,8 +53,14 @@ class ChApiParsers ChParserURDF {
     };
 
     /// Construct a Chrono parser for the specified URDF file.
+    /// The parsed URDF model tree and any collision meshes it references are kept in a process-wide cache, so that
+    /// subsequent parsers created for the same file (e.g., when resetting a simulation environment) reuse them
+    /// without re-parsing the XML or re-loading mesh data from disk.
     ChParserURDF(const std::string& filename);
 
+    /// Clear the process-wide cache of parsed URDF models and collision meshes.
+    static void ClearCache();
+
     /// Get the URDF model name.
     const std::string& GetModelName() const { return m_model->getName(); }
 
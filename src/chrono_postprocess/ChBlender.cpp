@@ -86,10 +86,80 @@ ChBlender::ChBlender(ChSystem* system) : ChPostProcessBase(system) {
     wireframe_thickness = 0.001;
     single_asset_file = true;
     rank = -1;
+    async_export = false;
+    async_max_pending = 4;
+    async_stop = false;
+    async_write_error = false;
 
     SetBlenderUp_is_ChronoY();
 }
 
+ChBlender::~ChBlender() {
+    if (async_writer.joinable()) {
+        FlushAsyncExport();
+        {
+            std::lock_guard<std::mutex> lock(async_mutex);
+            async_stop = true;
+        }
+        async_cv.notify_all();
+        async_writer.join();
+    }
+}
+
+void ChBlender::SetAsyncExport(bool enable, unsigned int max_pending_frames) {
+    std::lock_guard<std::mutex> lock(async_mutex);
+    async_export = enable;
+    async_max_pending = (max_pending_frames > 0) ? max_pending_frames : 1;
+}
+
+void ChBlender::FlushAsyncExport() {
+    std::unique_lock<std::mutex> lock(async_mutex);
+    async_cv.wait(lock, [this] { return async_queue.empty(); });
+}
+
+// Body of the background writer thread: pop queued frames in order and write their buffers to disk.
+// Started lazily by the first asynchronous ExportData(), stopped and joined by the destructor.
+void ChBlender::AsyncWriterLoop() {
+    while (true) {
+        AsyncFrameJob job;
+        {
+            std::unique_lock<std::mutex> lock(async_mutex);
+            async_cv.wait(lock, [this] { return !async_queue.empty() || async_stop; });
+            if (async_queue.empty())
+                return;
+            job = std::move(async_queue.front());
+            // the job is removed from the queue only after it has been written, so that
+            // FlushAsyncExport() does not return while a write is still in progress
+        }
+
+        bool ok = true;
+        {
+            std::ofstream assets_file(job.assets_name.c_str(), std::ios::app);
+            if (!job.assets_text.empty())
+                assets_file.write(&job.assets_text[0], job.assets_text.size());
+            ok = ok && (bool)assets_file;
+        }
+        {
+            std::ofstream state_file(job.state_name.c_str());
+            if (!job.state_text.empty())
+                state_file.write(&job.state_text[0], job.state_text.size());
+            ok = ok && (bool)state_file;
+        }
+        {
+            std::ofstream data_file(job.data_name.c_str());
+            ok = ok && (bool)data_file;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(async_mutex);
+            if (!ok)
+                async_write_error = true;
+            async_queue.pop_front();
+        }
+        async_cv.notify_all();
+    }
+}
+
 void ChBlender::Add(std::shared_ptr<ChPhysicsItem> item) {
     m_items.insert(item);
 }
@@ -359,15 +429,15 @@ void ChBlender::ExportScript(const std::string& filename) {
     this->framenumber--;  // so that it starts again from 0 when calling ExportData() in the simulation while() loop:
 }
 
-void ChBlender::ExportAssets(ChStreamOutAsciiFile& assets_file, ChStreamOutAsciiFile& state_file) {
+void ChBlender::ExportAssets(ChStreamOutAscii& assets_file, ChStreamOutAscii& state_file) {
     for (const auto& item : m_items) {
         ExportShapes(assets_file, state_file, item);
     }
 }
 
 // Write geometries and materials in the Blender assets script for all physics items with a visual model
-void ChBlender::ExportShapes(ChStreamOutAsciiFile& assets_file,
-                             ChStreamOutAsciiFile& state_file,
+void ChBlender::ExportShapes(ChStreamOutAscii& assets_file,
+                             ChStreamOutAscii& state_file,
                              std::shared_ptr<ChPhysicsItem> item) {
     // Nothing to do if the item does not have a visual model
     if (!item->GetVisualModel())
@@ -377,7 +447,7 @@ void ChBlender::ExportShapes(ChStreamOutAsciiFile& assets_file,
     for (const auto& shape_instance : item->GetVisualModel()->GetShapes()) {
         const auto& shape = shape_instance.first;
 
-        ChStreamOutAsciiFile* mfile;
+        ChStreamOutAscii* mfile;
         std::unordered_map<size_t, std::shared_ptr<ChVisualShape>>* m_shapes;
         std::unordered_map<size_t, std::shared_ptr<ChVisualMaterial>>* m_materials;
         std::string collection;
@@ -893,7 +963,7 @@ void ChBlender::ExportShapes(ChStreamOutAsciiFile& assets_file,
         if (this->m_blender_cameras.find((size_t)camera_instance.get()) != this->m_blender_cameras.end())
             continue;
 
-        ChStreamOutAsciiFile* mfile;
+        ChStreamOutAscii* mfile;
         mfile = &assets_file;
 
         std::string cameraname("camera_" + unique_bl_id((size_t)camera_instance.get()));
@@ -918,7 +988,7 @@ void ChBlender::ExportShapes(ChStreamOutAsciiFile& assets_file,
     }
 }
 
-void ChBlender::ExportMaterials(ChStreamOutAsciiFile& mfile,
+void ChBlender::ExportMaterials(ChStreamOutAscii& mfile,
                                 std::unordered_map<size_t, std::shared_ptr<ChVisualMaterial>>& m_materials,
                                 const std::vector<std::shared_ptr<ChVisualMaterial>>& materials,
                                 bool per_frame,
@@ -983,7 +1053,7 @@ void ChBlender::ExportMaterials(ChStreamOutAsciiFile& mfile,
     }
 }
 
-void ChBlender::ExportItemState(ChStreamOutAsciiFile& state_file,
+void ChBlender::ExportItemState(ChStreamOutAscii& state_file,
                                 std::shared_ptr<ChPhysicsItem> item,
                                 const ChFrame<>& parentframe) {
     auto vis_model = item->GetVisualModel();
@@ -1139,15 +1209,64 @@ void ChBlender::ExportData(const std::string& filename) {
     // Regenerate the list of objects that need POV rendering
     UpdateRenderList();
 
-    // Open the non-mutable single assets file in "append" mode:
     std::string assets_filename = out_script_filename + ".assets.py";
-    ChStreamOutAsciiFile assets_file((base_path + assets_filename).c_str(), std::ios::app);
 
-    // Generate the nnnnn.dat and nnnnn.py files:
-    try {
-        ChStreamOutAsciiFile data_file((base_path + filename + ".dat").c_str());
-        ChStreamOutAsciiFile state_file((base_path + filename + ".py").c_str());
+    if (async_export) {
+        // If the background writing of a previous frame failed, report it here on the simulation thread
+        {
+            std::lock_guard<std::mutex> lock(async_mutex);
+            if (async_write_error) {
+                async_write_error = false;
+                throw(ChException("Can't save data of a previous frame (background write failed)"));
+            }
+        }
+
+        // Format the whole frame into in-memory buffers, then hand them to the writer thread.
+        AsyncFrameJob job;
+        job.assets_name = base_path + assets_filename;
+        job.state_name = base_path + filename + ".py";
+        job.data_name = base_path + filename + ".dat";
+        {
+            ChStreamOutAsciiVector assets_file(&job.assets_text);
+            ChStreamOutAsciiVector state_file(&job.state_text);
+            ExportFrame(assets_file, state_file);
+        }
+
+        std::unique_lock<std::mutex> lock(async_mutex);
+        if (!async_writer.joinable())
+            async_writer = std::thread(&ChBlender::AsyncWriterLoop, this);
+        // back-pressure: wait only if the writer has fallen more than async_max_pending frames behind
+        async_cv.wait(lock, [this] { return async_queue.size() < async_max_pending; });
+        async_queue.push_back(std::move(job));
+        lock.unlock();
+        async_cv.notify_all();
+    } else {
+        // Open the non-mutable single assets file in "append" mode:
+        ChStreamOutAsciiFile assets_file((base_path + assets_filename).c_str(), std::ios::app);
+
+        // Generate the nnnnn.dat and nnnnn.py files:
+        try {
+            ChStreamOutAsciiFile data_file((base_path + filename + ".dat").c_str());
+            ChStreamOutAsciiFile state_file((base_path + filename + ".py").c_str());
+
+            ExportFrame(assets_file, state_file);
+        } catch (const ChException&) {
+            char error[400];
+            sprintf(error, "Can't save data into file %s.py (or .dat)", filename.c_str());
+            throw(ChException(error));
+        }
+    }
+
+    // Increment the number of the frame.
+    framenumber++;
+}
 
+// Format one frame of the animation into the given output streams: the non-mutable assets that are not yet
+// in the assets cache go into 'assets_file', everything else (mutable assets, item states, contacts) goes
+// into 'state_file'. Factored out of ExportData() so that it can target either the output files directly
+// (synchronous export) or in-memory buffers (asynchronous export).
+void ChBlender::ExportFrame(ChStreamOutAscii& assets_file, ChStreamOutAscii& state_file) {
+    {
         // reset the maps of mutable (per-frame) assets, so that these will be saved at ExportAssets()
         m_blender_frame_shapes.clear();
         m_blender_frame_materials.clear();
@@ -1260,7 +1379,7 @@ void ChBlender::ExportData(const std::string& filename) {
                     return true;  // to continue scanning contacts
                 }
                 // Data
-                ChStreamOutAsciiFile* mfile;
+                ChStreamOutAscii* mfile;
             };
 
             state_file << "if chrono_view_contacts:\n";
@@ -1335,14 +1454,7 @@ void ChBlender::ExportData(const std::string& filename) {
             state_file << "\t\t) \n";
         }
 
-    } catch (const ChException&) {
-        char error[400];
-        sprintf(error, "Can't save data into file %s.py (or .dat)", filename.c_str());
-        throw(ChException(error));
     }
-
-    // Increment the number of the frame.
-    framenumber++;
 }
 
 }  // end namespace postprocess
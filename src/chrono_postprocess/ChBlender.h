@@ -15,11 +15,16 @@
 #ifndef CHBLENDER_H
 #define CHBLENDER_H
 
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <unordered_map>
+#include <vector>
 
 #include "chrono/assets/ChVisualShape.h"
 #include "chrono/physics/ChSystem.h"
@@ -34,7 +39,7 @@ namespace postprocess {
 class ChApiPostProcess ChBlender : public ChPostProcessBase {
   public:
     ChBlender(ChSystem* system);
-    ~ChBlender() {}
+    ~ChBlender();
 
     /// Modes for type of vector arrow length
     enum class ContactSymbolType {
@@ -233,6 +238,20 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
     /// would allow assets whose settings change during time (ex time-changing colors)
     void SetUseSingleAssetFile(bool use) { single_asset_file = use; }
 
+    /// Enable/disable asynchronous export. When enabled, ExportData() formats the frame into in-memory
+    /// buffers and returns immediately, while a background thread takes care of writing the buffers to disk;
+    /// this hides the file i/o latency from the simulation loop, which is useful in batch renderings where
+    /// the output goes to slow or network storage. Up to 'max_pending_frames' frames can be queued for
+    /// writing; if the queue is full, ExportData() blocks until the writer catches up (back-pressure).
+    /// Note that the formatting itself still happens on the calling thread, because it reads the live state
+    /// of the physics items. Files are written in frame order. Default: disabled.
+    void SetAsyncExport(bool enable, unsigned int max_pending_frames = 4);
+
+    /// Wait until all frames queued by ExportData() in asynchronous mode have been written to disk.
+    /// Call this before reading the output files or before destroying the exported ChSystem.
+    /// Automatically called by the destructor. No effect if asynchronous export is disabled.
+    void FlushAsyncExport();
+
     /// Se the rank of this process. This is useful when doing parallel simulations on multiple computing
     /// nodes, each with its own ChBlender exporter, each generating .py files in different directories, and later
     /// you want to load all them in a single Blender project: this is possible tanks to the "Merge" mode
@@ -246,21 +265,33 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
 
   private:
     void UpdateRenderList();
-    void ExportAssets(ChStreamOutAsciiFile& assets_file, ChStreamOutAsciiFile& state_file);
-    void ExportShapes(ChStreamOutAsciiFile& assets_file,
-                      ChStreamOutAsciiFile& state_file,
+    void ExportFrame(ChStreamOutAscii& assets_file, ChStreamOutAscii& state_file);
+    void ExportAssets(ChStreamOutAscii& assets_file, ChStreamOutAscii& state_file);
+    void ExportShapes(ChStreamOutAscii& assets_file,
+                      ChStreamOutAscii& state_file,
                       std::shared_ptr<ChPhysicsItem> item);
-    void ExportMaterials(ChStreamOutAsciiFile& mfile,
+    void ExportMaterials(ChStreamOutAscii& mfile,
                          std::unordered_map<size_t, std::shared_ptr<ChVisualMaterial>>& m_materials,
                          const std::vector<std::shared_ptr<ChVisualMaterial>>& materials,
                          bool per_frame,
                          std::shared_ptr<ChVisualShape> mshape);
-    void ExportItemState(ChStreamOutAsciiFile& state_file,
+    void ExportItemState(ChStreamOutAscii& state_file,
                          std::shared_ptr<ChPhysicsItem> item,
                          const ChFrame<>& parentframe);
 
     const std::string unique_bl_id(size_t mpointer) const;
 
+    /// A frame whose formatted text is waiting to be written to disk by the background writer thread.
+    struct AsyncFrameJob {
+        std::string assets_name;         ///< path of the shared assets file (appended to)
+        std::string state_name;          ///< path of the stateNNNNN.py file
+        std::string data_name;           ///< path of the stateNNNNN.dat file
+        std::vector<char> assets_text;   ///< text to append to the assets file
+        std::vector<char> state_text;    ///< text of the state file
+    };
+
+    void AsyncWriterLoop();
+
     /// List of physics items in the rendering list.
     std::unordered_set<std::shared_ptr<ChPhysicsItem>> m_items;
 
@@ -339,6 +370,15 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
     bool single_asset_file;
 
     int rank;
+
+    bool async_export;
+    unsigned int async_max_pending;
+    std::deque<AsyncFrameJob> async_queue;
+    std::mutex async_mutex;
+    std::condition_variable async_cv;
+    std::thread async_writer;
+    bool async_stop;
+    bool async_write_error;
 };
 
 }  // end namespace postprocess
@@ -0,0 +1,105 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// =============================================================================
+
+#include <cuda.h>
+#include <curand.h>
+#include <curand_kernel.h>
+
+#include "curand_utils.cuh"
+#include "image_fuse.cuh"
+
+#include "chrono_sensor/optix/shaders/device_utils.h"
+
+namespace chrono {
+namespace sensor {
+
+// Applies a chain of pointwise operations to each pixel with a single load and a single store. The operation
+// descriptors are passed by value so they reside in constant kernel parameter space.
+__global__ void image_pointwise_fused_kernel(void* bufIn,
+                                             void* bufOut,
+                                             int N,
+                                             bool half4_in,
+                                             bool r8_out,
+                                             FusedImageOps ops,
+                                             curandState_t* rng_states) {
+    int index = blockDim.x * blockIdx.x + threadIdx.x;
+    if (index >= N)
+        return;
+
+    // load the pixel once, normalized to [0,1] floats
+    float r, g, b, a;
+    if (half4_in) {
+        __half* in = (__half*)bufIn;
+        r = clamp(__half2float(in[index * 4]), 0.f, 1.f);
+        g = clamp(__half2float(in[index * 4 + 1]), 0.f, 1.f);
+        b = clamp(__half2float(in[index * 4 + 2]), 0.f, 1.f);
+        a = clamp(__half2float(in[index * 4 + 3]), 0.f, 1.f);
+    } else {
+        unsigned char* in = (unsigned char*)bufIn;
+        r = ((float)in[index * 4]) / 255.f;
+        g = ((float)in[index * 4 + 1]) / 255.f;
+        b = ((float)in[index * 4 + 2]) / 255.f;
+        a = ((float)in[index * 4 + 3]) / 255.f;
+    }
+
+    // apply the chain of pointwise operations in registers
+    for (int i = 0; i < ops.num_ops; i++) {
+        switch (ops.op[i]) {
+            case FUSED_NOISE_CONST_NORMAL: {
+                r = clamp(r + curand_normal(&rng_states[index]) * ops.b[i] + ops.a[i], 0.f, 1.f);
+                g = clamp(g + curand_normal(&rng_states[index]) * ops.b[i] + ops.a[i], 0.f, 1.f);
+                b = clamp(b + curand_normal(&rng_states[index]) * ops.b[i] + ops.a[i], 0.f, 1.f);
+            } break;
+            case FUSED_NOISE_PIX_DEP: {
+                float stdev_r = sqrtf(r * ops.a[i] + ops.b[i]);
+                float stdev_g = sqrtf(g * ops.a[i] + ops.b[i]);
+                float stdev_b = sqrtf(b * ops.a[i] + ops.b[i]);
+                r = clamp(r + curand_normal(&rng_states[index]) * stdev_r, 0.f, 1.f);
+                g = clamp(g + curand_normal(&rng_states[index]) * stdev_g, 0.f, 1.f);
+                b = clamp(b + curand_normal(&rng_states[index]) * stdev_b, 0.f, 1.f);
+            } break;
+        }
+    }
+
+    // store the pixel once
+    if (r8_out) {
+        ((char*)bufOut)[index] = (char)(clamp((r + g + b) / 3.f, 0.f, 1.f) * 255.999f);
+    } else {
+        unsigned char* out = (unsigned char*)bufOut;
+        out[index * 4] = (unsigned char)(r * 255.999f);
+        out[index * 4 + 1] = (unsigned char)(g * 255.999f);
+        out[index * 4 + 2] = (unsigned char)(b * 255.999f);
+        out[index * 4 + 3] = (unsigned char)(a * 255.999f);
+    }
+}
+
+void cuda_image_pointwise_fused(void* bufIn,
+                                void* bufOut,
+                                int w,
+                                int h,
+                                bool half4_in,
+                                bool r8_out,
+                                const FusedImageOps& ops,
+                                curandState_t* rng,
+                                CUstream& stream) {
+    int numPixels = w * h;
+    const int nThreads = 512;
+    int nBlocks = (numPixels + nThreads - 1) / nThreads;
+
+    image_pointwise_fused_kernel<<<nBlocks, nThreads, 0, stream>>>(bufIn, bufOut, numPixels, half4_in, r8_out, ops,
+                                                                   rng);
+}
+
+}  // namespace sensor
+}  // namespace chrono
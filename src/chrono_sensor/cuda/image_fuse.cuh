@@ -0,0 +1,62 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// =============================================================================
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cuda
+/// @{
+
+/// Maximum number of pointwise stages that can be fused into a single kernel launch.
+#define FUSED_IMAGE_MAX_OPS 4
+
+/// Identifiers for the pointwise operations supported by the fused image kernel.
+enum FusedImageOp {
+    FUSED_NOISE_CONST_NORMAL = 0,  ///< Gaussian noise with constant mean and standard deviation
+    FUSED_NOISE_PIX_DEP = 1        ///< pixel-dependent Gaussian noise
+};
+
+/// Description of a chain of pointwise operations to be applied by a single fused kernel.
+struct FusedImageOps {
+    int num_ops;                   ///< number of fused operations
+    int op[FUSED_IMAGE_MAX_OPS];   ///< operation identifiers (FusedImageOp), applied in order
+    float a[FUSED_IMAGE_MAX_OPS];  ///< first parameter of each operation (mean or variance slope)
+    float b[FUSED_IMAGE_MAX_OPS];  ///< second parameter of each operation (stdev or variance intercept)
+};
+
+/// Fused pointwise image kernel. Each pixel is loaded once, the full chain of operations is applied in registers,
+/// and the result is written once, instead of one global memory round trip per filter stage.
+/// @param bufIn Device pointer to the input image (half4 or RGBA8, row major and contiguous).
+/// @param bufOut Device pointer to the output image (RGBA8, or R8 when the chain ends in a grayscale stage).
+/// @param w The width of the image in pixels.
+/// @param h The height of the image in pixels.
+/// @param half4_in Whether the input image is in half4 format rather than RGBA8.
+/// @param r8_out Whether the chain ends in a grayscale stage and outputs an R8 image.
+/// @param ops The chain of pointwise operations to apply.
+/// @param rng The states to be randomly generated (only accessed when the chain contains a noise operation).
+/// @param stream The cuda stream for the kernel launch.
+void cuda_image_pointwise_fused(void* bufIn,
+                                void* bufOut,
+                                int w,
+                                int h,
+                                bool half4_in,
+                                bool r8_out,
+                                const FusedImageOps& ops,
+                                curandState_t* rng,
+                                CUstream& stream);
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
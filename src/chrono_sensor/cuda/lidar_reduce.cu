@@ -15,6 +15,7 @@
 // =============================================================================
 
 #include <cuda.h>
+#include <cuda_fp16.h>
 #include "grayscale.cuh"
 #include <iostream>
 
@@ -22,7 +23,8 @@ namespace chrono {
 namespace sensor {
 
 // Converts 32bpp ARGB imgIn pixels to 8bpp Grayscale imgOut pixels
-__global__ void mean_reduce_kernel(float* bufIn, float* bufOut, int w, int h, int r) {
+template <typename OutT>
+__global__ void mean_reduce_kernel(float* bufIn, OutT* bufOut, int w, int h, int r) {
     int out_index = (blockDim.x * blockIdx.x + threadIdx.x);  // index into output buffer
 
     int out_hIndex = out_index % w;
@@ -32,8 +34,8 @@ __global__ void mean_reduce_kernel(float* bufIn, float* bufOut, int w, int h, in
 
     if (out_index < w * h) {
         // reset buffer to zeros
-        bufOut[2 * out_index] = 0;
-        bufOut[2 * out_index + 1] = 0;
+        bufOut[2 * out_index] = (OutT)0.f;
+        bufOut[2 * out_index + 1] = (OutT)0.f;
 
         float sum_range = 0.f;
         float sum_intensity = 0.f;
@@ -50,14 +52,15 @@ __global__ void mean_reduce_kernel(float* bufIn, float* bufOut, int w, int h, in
             }
         }
         if (n_contributing > 0) {
-            bufOut[2 * out_index] = sum_range / (n_contributing);
-            bufOut[2 * out_index + 1] = sum_intensity / (d * d);
+            bufOut[2 * out_index] = (OutT)(sum_range / (n_contributing));
+            bufOut[2 * out_index + 1] = (OutT)(sum_intensity / (d * d));
         }
     }
 }
 
 // Converts 32bpp ARGB imgIn pixels to 8bpp Grayscale imgOut pixels
-__global__ void strong_reduce_kernel(float* bufIn, float* bufOut, int w, int h, int r) {
+template <typename OutT>
+__global__ void strong_reduce_kernel(float* bufIn, OutT* bufOut, int w, int h, int r) {
     int out_index = (blockDim.x * blockIdx.x + threadIdx.x);  // index into output buffer
 
     int out_hIndex = out_index % w;
@@ -108,13 +111,14 @@ __global__ void strong_reduce_kernel(float* bufIn, float* bufOut, int w, int h,
 
             }
         }
-        bufOut[2 * out_index] = strongest;
-        bufOut[2 * out_index + 1] = intensity_at_strongest;
+        bufOut[2 * out_index] = (OutT)strongest;
+        bufOut[2 * out_index + 1] = (OutT)intensity_at_strongest;
     }
 
 }
 
-__global__ void first_reduce_kernel(float* bufIn, float* bufOut, int w, int h, int r) {
+template <typename OutT>
+__global__ void first_reduce_kernel(float* bufIn, OutT* bufOut, int w, int h, int r) {
     int out_index = (blockDim.x * blockIdx.x + threadIdx.x);  // index into output buffer
 
     int out_hIndex = out_index % w;
@@ -159,12 +163,13 @@ __global__ void first_reduce_kernel(float* bufIn, float* bufOut, int w, int h, i
                 }
             }
         }
-        bufOut[2 * out_index] = shortest;
-        bufOut[2 * out_index + 1] = intensity_at_shortest;
+        bufOut[2 * out_index] = (OutT)shortest;
+        bufOut[2 * out_index + 1] = (OutT)intensity_at_shortest;
     }
 }
 
-__global__ void dual_reduce_kernel(float* bufIn, float* bufOut, int w, int h, int r) {
+template <typename OutT>
+__global__ void dual_reduce_kernel(float* bufIn, OutT* bufOut, int w, int h, int r) {
     int out_index = (blockDim.x * blockIdx.x + threadIdx.x);  // index into output buffer
 
     int out_hIndex = out_index % w;
@@ -215,10 +220,10 @@ __global__ void dual_reduce_kernel(float* bufIn, float* bufOut, int w, int h, in
                 }
             }
         }
-        bufOut[4 * out_index] = strongest;
-        bufOut[4 * out_index + 1] = intensity_at_strongest;
-        bufOut[4 * out_index + 2] = shortest;
-        bufOut[4 * out_index + 3] = intensity_at_shortest;
+        bufOut[4 * out_index] = (OutT)strongest;
+        bufOut[4 * out_index + 1] = (OutT)intensity_at_strongest;
+        bufOut[4 * out_index + 2] = (OutT)shortest;
+        bufOut[4 * out_index + 3] = (OutT)intensity_at_shortest;
     }
 }
 
@@ -231,6 +236,15 @@ void cuda_lidar_mean_reduce(void* bufIn, void* bufOut, int width, int height, in
     mean_reduce_kernel<<<nBlocks, nThreads, 0, stream>>>((float*)bufIn, (float*)bufOut, w, h, radius);
 }
 
+void cuda_lidar_mean_reduce_half(void* bufIn, void* bufOut, int width, int height, int radius, CUstream& stream) {
+    int w = width / (radius * 2 - 1);
+    int h = height / (radius * 2 - 1);
+    int numPixels = w * h;
+    const int nThreads = 512;
+    int nBlocks = (numPixels + nThreads - 1) / nThreads;
+    mean_reduce_kernel<<<nBlocks, nThreads, 0, stream>>>((float*)bufIn, (__half*)bufOut, w, h, radius);
+}
+
 void cuda_lidar_strong_reduce(void* bufIn, void* bufOut, int width, int height, int radius, CUstream& stream) {
     int w = width / (radius * 2 - 1);
     int h = height / (radius * 2 - 1);
@@ -240,6 +254,15 @@ void cuda_lidar_strong_reduce(void* bufIn, void* bufOut, int width, int height,
     strong_reduce_kernel<<<nBlocks, nThreads, 0, stream>>>((float*)bufIn, (float*)bufOut, w, h, radius);
 }
 
+void cuda_lidar_strong_reduce_half(void* bufIn, void* bufOut, int width, int height, int radius, CUstream& stream) {
+    int w = width / (radius * 2 - 1);
+    int h = height / (radius * 2 - 1);
+    int numPixels = w * h;
+    const int nThreads = 512;
+    int nBlocks = (numPixels + nThreads - 1) / nThreads;
+    strong_reduce_kernel<<<nBlocks, nThreads, 0, stream>>>((float*)bufIn, (__half*)bufOut, w, h, radius);
+}
+
 void cuda_lidar_first_reduce(void* bufIn, void* bufOut, int width, int height, int radius, CUstream& stream) {
     int w = width / (radius * 2 - 1);
     int h = height / (radius * 2 - 1);
@@ -249,6 +272,15 @@ void cuda_lidar_first_reduce(void* bufIn, void* bufOut, int width, int height, i
     first_reduce_kernel<<<nBlocks, nThreads, 0, stream>>>((float*)bufIn, (float*)bufOut, w, h, radius);
 }
 
+void cuda_lidar_first_reduce_half(void* bufIn, void* bufOut, int width, int height, int radius, CUstream& stream) {
+    int w = width / (radius * 2 - 1);
+    int h = height / (radius * 2 - 1);
+    int numPixels = w * h;
+    const int nThreads = 512;
+    int nBlocks = (numPixels + nThreads - 1) / nThreads;
+    first_reduce_kernel<<<nBlocks, nThreads, 0, stream>>>((float*)bufIn, (__half*)bufOut, w, h, radius);
+}
+
 void cuda_lidar_dual_reduce(void* bufIn, void* bufOut, int width, int height, int radius, CUstream& stream) {
     int w = width / (radius * 2 - 1);
     int h = height / (radius * 2 - 1);
@@ -258,5 +290,14 @@ void cuda_lidar_dual_reduce(void* bufIn, void* bufOut, int width, int height, in
     dual_reduce_kernel<<<nBlocks, nThreads, 0, stream>>>((float*)bufIn, (float*)bufOut, w, h, radius);
 }
 
+void cuda_lidar_dual_reduce_half(void* bufIn, void* bufOut, int width, int height, int radius, CUstream& stream) {
+    int w = width / (radius * 2 - 1);
+    int h = height / (radius * 2 - 1);
+    int numPixels = w * h;
+    const int nThreads = 512;
+    int nBlocks = (numPixels + nThreads - 1) / nThreads;
+    dual_reduce_kernel<<<nBlocks, nThreads, 0, stream>>>((float*)bufIn, (__half*)bufOut, w, h, radius);
+}
+
 }  // namespace sensor
 }  // namespace chrono
@@ -60,6 +60,20 @@ void cuda_lidar_first_reduce(void* bufIn, void* bufOut, int width, int height, i
 /// @param stream Cuda stream for launching the kernel
 void cuda_lidar_dual_reduce(void* bufIn, void* bufOut, int width, int height, int radius, CUstream& stream);
 
+/// Half-precision output variants of the beam reduction functions above. The reduction is carried out in single
+/// precision and the conversion to half is fused into the final store, so the processed buffer (and any subsequent
+/// device-to-host transfer of it) is half the size with no extra conversion pass.
+/// @param bufIn Input device pointed to raw lidar data.
+/// @param bufOut Outout device pointer for processed half-precision lidar data.
+/// @param width Width of the input data.
+/// @param height Height of the inpute data.
+/// @param radius Radius in samples of the beam to be reduced.
+/// @param stream Cuda stream for launching the kernel
+void cuda_lidar_mean_reduce_half(void* bufIn, void* bufOut, int width, int height, int radius, CUstream& stream);
+void cuda_lidar_strong_reduce_half(void* bufIn, void* bufOut, int width, int height, int radius, CUstream& stream);
+void cuda_lidar_first_reduce_half(void* bufIn, void* bufOut, int width, int height, int radius, CUstream& stream);
+void cuda_lidar_dual_reduce_half(void* bufIn, void* bufOut, int width, int height, int radius, CUstream& stream);
+
 /// @}
 
 }  // namespace sensor
@@ -0,0 +1,39 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// =============================================================================
+
+#include <cuda.h>
+#include "chrono_sensor/cuda/mesh_update.cuh"
+
+namespace chrono {
+namespace sensor {
+
+__global__ void mesh_update_scatter_kernel(float4* updates, int* indices, float4* buffer, int num_updates) {
+    int index = (blockDim.x * blockIdx.x + threadIdx.x);  // index into the update list
+
+    if (index < num_updates) {
+        buffer[indices[index]] = updates[index];
+    }
+}
+
+void cuda_mesh_update_scatter(void* updates, void* indices, void* buffer, int num_updates, CUstream& stream) {
+    const int nThreads = 512;
+    int nBlocks = (num_updates + nThreads - 1) / nThreads;
+    mesh_update_scatter_kernel<<<nBlocks, nThreads, 0, stream>>>((float4*)updates, (int*)indices, (float4*)buffer,
+                                                                 num_updates);
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,35 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// =============================================================================
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cuda
+/// @{
+
+/// Scatters a compacted set of vertex (or normal) updates into a mesh buffer in place. Used to update deformable
+/// meshes on the device without re-uploading the entire buffer, feeding the in-place OptiX GAS refit.
+/// @param updates Device pointer to num_updates packed float4 values
+/// @param indices Device pointer to num_updates destination indices into the mesh buffer
+/// @param buffer Device pointer to the float4 mesh buffer to be updated in place
+/// @param num_updates Number of entries to scatter
+/// @param stream The cuda stream used for processing the kernel
+void cuda_mesh_update_scatter(void* updates, void* indices, void* buffer, int num_updates, CUstream& stream);
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
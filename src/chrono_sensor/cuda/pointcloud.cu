@@ -15,9 +15,13 @@
 // =============================================================================
 
 #include <cuda.h>
+#include <cuda_fp16.h>
 #include "pointcloud.cuh"
 #include <iostream>
 
+#include <cub/device/device_select.cuh>
+#include <cub/iterator/counting_input_iterator.cuh>
+
 namespace chrono {
 namespace sensor {
 
@@ -121,6 +125,117 @@ void cuda_pointcloud_from_depth(void* bufDI,
                                                                    max_v_angle, min_v_angle);
 }
 
+// Flags each entry as valid when the float at key_index is positive
+__global__ void pointcloud_flag_kernel(float* bufIn, unsigned char* flags, int num_entries, int fpe, int key_index) {
+    int index = blockDim.x * blockIdx.x + threadIdx.x;
+    if (index < num_entries) {
+        flags[index] = bufIn[index * fpe + key_index] > 0.f ? 1 : 0;
+    }
+}
+
+// Gathers the flagged entries into a packed buffer using the index map produced by the device select
+__global__ void pointcloud_gather_kernel(float* bufIn, float* bufOut, int* indices, int* num_valid, int fpe) {
+    int index = blockDim.x * blockIdx.x + threadIdx.x;
+    if (index < (*num_valid) * fpe) {
+        int entry = index / fpe;
+        int component = index % fpe;
+        bufOut[index] = bufIn[indices[entry] * fpe + component];
+    }
+}
+
+// Same gather, but converting each float to half on the fly so the packed buffer is half the size
+__global__ void pointcloud_gather_half_kernel(float* bufIn, __half* bufOut, int* indices, int* num_valid, int fpe) {
+    int index = blockDim.x * blockIdx.x + threadIdx.x;
+    if (index < (*num_valid) * fpe) {
+        int entry = index / fpe;
+        int component = index % fpe;
+        bufOut[index] = __float2half(bufIn[indices[entry] * fpe + component]);
+    }
+}
+
+void cuda_pointcloud_compact(void* bufIn,
+                             void* bufOut,
+                             int num_entries,
+                             int floats_per_entry,
+                             int key_index,
+                             void* indices_out,
+                             void* num_valid,
+                             void** scratch,
+                             size_t* scratch_bytes,
+                             CUstream& stream) {
+    const int nThreads = 512;
+
+    // query how much temporary storage the device select requires
+    cub::CountingInputIterator<int> counting(0);
+    size_t select_bytes = 0;
+    cub::DeviceSelect::Flagged(nullptr, select_bytes, counting, (unsigned char*)nullptr, (int*)indices_out,
+                               (int*)num_valid, num_entries, stream);
+
+    // single scratch block: the flag array followed by the (256-byte aligned) select storage
+    size_t flag_bytes = (num_entries * sizeof(unsigned char) + 255) / 256 * 256;
+    size_t total_bytes = flag_bytes + select_bytes;
+    if (*scratch_bytes < total_bytes) {
+        if (*scratch) {
+            cudaFree(*scratch);
+        }
+        cudaMalloc(scratch, total_bytes);
+        *scratch_bytes = total_bytes;
+    }
+    unsigned char* flags = (unsigned char*)*scratch;
+    void* select_storage = (void*)((char*)*scratch + flag_bytes);
+
+    int nBlocks = (num_entries + nThreads - 1) / nThreads;
+    pointcloud_flag_kernel<<<nBlocks, nThreads, 0, stream>>>((float*)bufIn, flags, num_entries, floats_per_entry,
+                                                             key_index);
+    cub::DeviceSelect::Flagged(select_storage, select_bytes, counting, flags, (int*)indices_out, (int*)num_valid,
+                               num_entries, stream);
+    // launched for the worst case since the valid count only exists on the device at this point
+    int nGatherBlocks = (num_entries * floats_per_entry + nThreads - 1) / nThreads;
+    pointcloud_gather_kernel<<<nGatherBlocks, nThreads, 0, stream>>>((float*)bufIn, (float*)bufOut, (int*)indices_out,
+                                                                     (int*)num_valid, floats_per_entry);
+}
+
+void cuda_pointcloud_compact_half(void* bufIn,
+                                  void* bufOut,
+                                  int num_entries,
+                                  int floats_per_entry,
+                                  int key_index,
+                                  void* indices_out,
+                                  void* num_valid,
+                                  void** scratch,
+                                  size_t* scratch_bytes,
+                                  CUstream& stream) {
+    const int nThreads = 512;
+
+    // query how much temporary storage the device select requires
+    cub::CountingInputIterator<int> counting(0);
+    size_t select_bytes = 0;
+    cub::DeviceSelect::Flagged(nullptr, select_bytes, counting, (unsigned char*)nullptr, (int*)indices_out,
+                               (int*)num_valid, num_entries, stream);
+
+    // single scratch block: the flag array followed by the (256-byte aligned) select storage
+    size_t flag_bytes = (num_entries * sizeof(unsigned char) + 255) / 256 * 256;
+    size_t total_bytes = flag_bytes + select_bytes;
+    if (*scratch_bytes < total_bytes) {
+        if (*scratch) {
+            cudaFree(*scratch);
+        }
+        cudaMalloc(scratch, total_bytes);
+        *scratch_bytes = total_bytes;
+    }
+    unsigned char* flags = (unsigned char*)*scratch;
+    void* select_storage = (void*)((char*)*scratch + flag_bytes);
+
+    int nBlocks = (num_entries + nThreads - 1) / nThreads;
+    pointcloud_flag_kernel<<<nBlocks, nThreads, 0, stream>>>((float*)bufIn, flags, num_entries, floats_per_entry,
+                                                             key_index);
+    cub::DeviceSelect::Flagged(select_storage, select_bytes, counting, flags, (int*)indices_out, (int*)num_valid,
+                               num_entries, stream);
+    // launched for the worst case since the valid count only exists on the device at this point
+    int nGatherBlocks = (num_entries * floats_per_entry + nThreads - 1) / nThreads;
+    pointcloud_gather_half_kernel<<<nGatherBlocks, nThreads, 0, stream>>>(
+        (float*)bufIn, (__half*)bufOut, (int*)indices_out, (int*)num_valid, floats_per_entry);
+}
 
 }  // namespace sensor
 }  // namespace chrono
@@ -56,6 +56,55 @@ void cuda_pointcloud_from_depth_dual_return(void* bufDI,
                                             float min_v_angle,
                                             CUstream& stream);
 
+/// Stream compaction for point cloud buffers, entirely on the device (CUB device select). Entries are fixed-size
+/// groups of floats and an entry is valid when the float at key_index is positive (e.g. the intensity of a PixelXYZI
+/// or the amplitude of a RadarXYZReturn). Valid entries are packed tightly into the output buffer, preserving order,
+/// together with an index map giving each packed entry's index in the input buffer.
+/// @param bufIn A device pointer to the dense input buffer
+/// @param bufOut A device pointer where the packed valid entries will be written
+/// @param num_entries The number of entries in the input buffer
+/// @param floats_per_entry The number of floats making up one entry
+/// @param key_index The index of the float within an entry tested for validity
+/// @param indices_out A device pointer where the index map will be written (capacity num_entries ints)
+/// @param num_valid A device pointer to a single int receiving the number of valid entries
+/// @param scratch In/out device scratch buffer, grown as needed and reused across calls (freed by the caller)
+/// @param scratch_bytes In/out allocated size of the scratch buffer
+/// @param stream The cuda stream for the kernel
+void cuda_pointcloud_compact(void* bufIn,
+                             void* bufOut,
+                             int num_entries,
+                             int floats_per_entry,
+                             int key_index,
+                             void* indices_out,
+                             void* num_valid,
+                             void** scratch,
+                             size_t* scratch_bytes,
+                             CUstream& stream);
+
+/// Variant of cuda_pointcloud_compact whose packed output is half precision. The validity test still reads the dense
+/// float input; the float-to-half conversion is fused into the gather that packs the valid entries, so the compacted
+/// buffer (and any subsequent device-to-host transfer of it) is half the size with no extra conversion pass.
+/// @param bufIn A device pointer to the dense input buffer (floats)
+/// @param bufOut A device pointer where the packed valid entries will be written (halfs)
+/// @param num_entries The number of entries in the input buffer
+/// @param floats_per_entry The number of floats making up one entry
+/// @param key_index The index of the float within an entry tested for validity
+/// @param indices_out A device pointer where the index map will be written (capacity num_entries ints)
+/// @param num_valid A device pointer to a single int receiving the number of valid entries
+/// @param scratch In/out device scratch buffer, grown as needed and reused across calls (freed by the caller)
+/// @param scratch_bytes In/out allocated size of the scratch buffer
+/// @param stream The cuda stream for the kernel
+void cuda_pointcloud_compact_half(void* bufIn,
+                                  void* bufOut,
+                                  int num_entries,
+                                  int floats_per_entry,
+                                  int key_index,
+                                  void* indices_out,
+                                  void* num_valid,
+                                  void** scratch,
+                                  size_t* scratch_bytes,
+                                  CUstream& stream);
+
 /// @}
 }  // namespace sensor
 }  // namespace chrono
@@ -176,6 +176,44 @@ CH_SENSOR_API void ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>::Appl
     }
 }
 
+template <>
+CH_SENSOR_API void ChFilterAccess<SensorHostHalfXYZIBuffer, UserHalfXYZIBufferPtr>::Apply() {
+    // create a new buffer to push to the lag buffer list
+    std::shared_ptr<SensorHostHalfXYZIBuffer> tmp_buffer;
+    if (m_empty_lag_buffers.size() > 0) {
+        tmp_buffer = m_empty_lag_buffers.top();
+        m_empty_lag_buffers.pop();
+    } else {
+        tmp_buffer = chrono_types::make_shared<SensorHostHalfXYZIBuffer>();
+        std::shared_ptr<PixelHalfXYZI[]> b(cudaHostMallocHelper<PixelHalfXYZI>(m_bufferIn->Width * m_bufferIn->Height),
+                                       cudaHostFreeHelper<PixelHalfXYZI>);
+        tmp_buffer->Buffer = std::move(b);
+    }
+
+    tmp_buffer->Width = m_bufferIn->Beam_return_count;
+    tmp_buffer->Height = 1;
+    tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
+    tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
+
+    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelHalfXYZI), cudaMemcpyDeviceToHost, m_cuda_stream);
+
+    {  // lock in this scope before pushing to lag buffer queue
+        std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
+        // push our buffer into the lag queue
+        m_lag_buffers.push(tmp_buffer);
+        // prevent lag buffer overflow - remove any old buffers that have expired. We don't want the lag_buffer to
+        // grow unbounded
+        while (m_lag_buffers.size() > m_max_lag_buffers) {
+            m_empty_lag_buffers.push(
+                m_lag_buffers.front());  // push the buffer back for efficiency if it wasn't given to the user
+            m_lag_buffers.pop();
+        }
+        // synchronize the cuda stream since we moved data to the host
+        cudaStreamSynchronize(m_cuda_stream);
+    }
+}
+
 template <>
 CH_SENSOR_API void ChFilterAccess<SensorHostDIBuffer, UserDIBufferPtr>::Apply() {
     // create a new buffer to push to the lag buffer list
@@ -214,6 +252,44 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDIBuffer, UserDIBufferPtr>::Apply()
     }
 }
 
+template <>
+CH_SENSOR_API void ChFilterAccess<SensorHostHalfDIBuffer, UserHalfDIBufferPtr>::Apply() {
+    // create a new buffer to push to the lag buffer list
+    std::shared_ptr<SensorHostHalfDIBuffer> tmp_buffer;
+    if (m_empty_lag_buffers.size() > 0) {
+        tmp_buffer = m_empty_lag_buffers.top();
+        m_empty_lag_buffers.pop();
+    } else {
+        tmp_buffer = chrono_types::make_shared<SensorHostHalfDIBuffer>();
+        std::shared_ptr<PixelHalfDI[]> b(cudaHostMallocHelper<PixelHalfDI>(m_bufferIn->Width * m_bufferIn->Height),
+                                       cudaHostFreeHelper<PixelHalfDI>);
+        tmp_buffer->Buffer = std::move(b);
+    }
+
+    tmp_buffer->Width = m_bufferIn->Width;
+    tmp_buffer->Height = m_bufferIn->Height;
+    tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
+    tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
+
+    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelHalfDI), cudaMemcpyDeviceToHost, m_cuda_stream);
+
+    {  // lock in this scope before pushing to lag buffer queue
+        std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
+        // push our buffer into the lag queue
+        m_lag_buffers.push(tmp_buffer);
+        // prevent lag buffer overflow - remove any old buffers that have expired. We don't want the lag_buffer to
+        // grow unbounded
+        while (m_lag_buffers.size() > m_max_lag_buffers) {
+            m_empty_lag_buffers.push(
+                m_lag_buffers.front());  // push the buffer back for efficiency if it wasn't given to the user
+            m_lag_buffers.pop();
+        }
+        // synchronize the cuda stream since we moved data to the host
+        cudaStreamSynchronize(m_cuda_stream);
+    }
+}
+
 template <>
 CH_SENSOR_API void ChFilterAccess<SensorHostRadarBuffer, UserRadarBufferPtr>::Apply() {
     // create a new buffer to push to the lag buffer list
@@ -463,6 +539,159 @@ CH_SENSOR_API void ChFilterAccess<SensorHostTachometerBuffer, UserTachometerBuff
 }
 
 
+template <>
+CH_SENSOR_API void ChFilterDeviceAccess<SensorDeviceR8Buffer, UserDeviceR8BufferPtr>::Apply() {
+    // create a new device buffer to push to the lag buffer list
+    std::shared_ptr<SensorDeviceR8Buffer> tmp_buffer;
+    if (m_empty_lag_buffers.size() > 0) {
+        tmp_buffer = m_empty_lag_buffers.top();
+        m_empty_lag_buffers.pop();
+    } else {
+        tmp_buffer = chrono_types::make_shared<SensorDeviceR8Buffer>();
+        DeviceR8BufferPtr b(cudaMallocHelper<char>(m_bufferIn->Width * m_bufferIn->Height), cudaFreeHelper<char>);
+        tmp_buffer->Buffer = std::move(b);
+    }
+
+    tmp_buffer->Width = m_bufferIn->Width;
+    tmp_buffer->Height = m_bufferIn->Height;
+    tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
+    tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
+
+    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(), m_bufferIn->Width * m_bufferIn->Height,
+                    cudaMemcpyDeviceToDevice, m_cuda_stream);
+
+    {  // lock in this scope before pushing to lag buffer queue
+        std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
+        // push our buffer into the lag queue
+        m_lag_buffers.push(tmp_buffer);
+        // prevent lag buffer overflow - remove any old buffers that have expired. We don't want the lag_buffer to
+        // grow unbounded
+        while (m_lag_buffers.size() > m_max_lag_buffers) {
+            m_empty_lag_buffers.push(
+                m_lag_buffers.front());  // push the buffer back for efficiency if it wasn't given to the user
+            m_lag_buffers.pop();
+        }
+        // synchronize the cuda stream so the buffer is consumable from any stream once handed to the user
+        cudaStreamSynchronize(m_cuda_stream);
+    }
+}
+
+template <>
+CH_SENSOR_API void ChFilterDeviceAccess<SensorDeviceRGBA8Buffer, UserDeviceRGBA8BufferPtr>::Apply() {
+    // create a new device buffer to push to the lag buffer list
+    std::shared_ptr<SensorDeviceRGBA8Buffer> tmp_buffer;
+    if (m_empty_lag_buffers.size() > 0) {
+        tmp_buffer = m_empty_lag_buffers.top();
+        m_empty_lag_buffers.pop();
+    } else {
+        tmp_buffer = chrono_types::make_shared<SensorDeviceRGBA8Buffer>();
+        DeviceRGBA8BufferPtr b(cudaMallocHelper<PixelRGBA8>(m_bufferIn->Width * m_bufferIn->Height),
+                               cudaFreeHelper<PixelRGBA8>);
+        tmp_buffer->Buffer = std::move(b);
+    }
+
+    tmp_buffer->Width = m_bufferIn->Width;
+    tmp_buffer->Height = m_bufferIn->Height;
+    tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
+    tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
+
+    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelRGBA8), cudaMemcpyDeviceToDevice,
+                    m_cuda_stream);
+
+    {  // lock in this scope before pushing to lag buffer queue
+        std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
+        // push our buffer into the lag queue
+        m_lag_buffers.push(tmp_buffer);
+        // prevent lag buffer overflow - remove any old buffers that have expired. We don't want the lag_buffer to
+        // grow unbounded
+        while (m_lag_buffers.size() > m_max_lag_buffers) {
+            m_empty_lag_buffers.push(
+                m_lag_buffers.front());  // push the buffer back for efficiency if it wasn't given to the user
+            m_lag_buffers.pop();
+        }
+        // synchronize the cuda stream so the buffer is consumable from any stream once handed to the user
+        cudaStreamSynchronize(m_cuda_stream);
+    }
+}
+
+template <>
+CH_SENSOR_API void ChFilterDeviceAccess<SensorDeviceXYZIBuffer, UserDeviceXYZIBufferPtr>::Apply() {
+    // create a new device buffer to push to the lag buffer list
+    std::shared_ptr<SensorDeviceXYZIBuffer> tmp_buffer;
+    if (m_empty_lag_buffers.size() > 0) {
+        tmp_buffer = m_empty_lag_buffers.top();
+        m_empty_lag_buffers.pop();
+    } else {
+        tmp_buffer = chrono_types::make_shared<SensorDeviceXYZIBuffer>();
+        DeviceXYZIBufferPtr b(cudaMallocHelper<PixelXYZI>(m_bufferIn->Width * m_bufferIn->Height),
+                              cudaFreeHelper<PixelXYZI>);
+        tmp_buffer->Buffer = std::move(b);
+    }
+
+    tmp_buffer->Width = m_bufferIn->Beam_return_count;
+    tmp_buffer->Height = 1;
+    tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
+    tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
+
+    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelXYZI), cudaMemcpyDeviceToDevice,
+                    m_cuda_stream);
+
+    {  // lock in this scope before pushing to lag buffer queue
+        std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
+        // push our buffer into the lag queue
+        m_lag_buffers.push(tmp_buffer);
+        // prevent lag buffer overflow - remove any old buffers that have expired. We don't want the lag_buffer to
+        // grow unbounded
+        while (m_lag_buffers.size() > m_max_lag_buffers) {
+            m_empty_lag_buffers.push(
+                m_lag_buffers.front());  // push the buffer back for efficiency if it wasn't given to the user
+            m_lag_buffers.pop();
+        }
+        // synchronize the cuda stream so the buffer is consumable from any stream once handed to the user
+        cudaStreamSynchronize(m_cuda_stream);
+    }
+}
+
+template <>
+CH_SENSOR_API void ChFilterDeviceAccess<SensorDeviceDIBuffer, UserDeviceDIBufferPtr>::Apply() {
+    // create a new device buffer to push to the lag buffer list
+    std::shared_ptr<SensorDeviceDIBuffer> tmp_buffer;
+    if (m_empty_lag_buffers.size() > 0) {
+        tmp_buffer = m_empty_lag_buffers.top();
+        m_empty_lag_buffers.pop();
+    } else {
+        tmp_buffer = chrono_types::make_shared<SensorDeviceDIBuffer>();
+        DeviceDIBufferPtr b(cudaMallocHelper<PixelDI>(m_bufferIn->Width * m_bufferIn->Height),
+                            cudaFreeHelper<PixelDI>);
+        tmp_buffer->Buffer = std::move(b);
+    }
+
+    tmp_buffer->Width = m_bufferIn->Width;
+    tmp_buffer->Height = m_bufferIn->Height;
+    tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
+    tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
+
+    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelDI), cudaMemcpyDeviceToDevice, m_cuda_stream);
+
+    {  // lock in this scope before pushing to lag buffer queue
+        std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
+        // push our buffer into the lag queue
+        m_lag_buffers.push(tmp_buffer);
+        // prevent lag buffer overflow - remove any old buffers that have expired. We don't want the lag_buffer to
+        // grow unbounded
+        while (m_lag_buffers.size() > m_max_lag_buffers) {
+            m_empty_lag_buffers.push(
+                m_lag_buffers.front());  // push the buffer back for efficiency if it wasn't given to the user
+            m_lag_buffers.pop();
+        }
+        // synchronize the cuda stream so the buffer is consumable from any stream once handed to the user
+        cudaStreamSynchronize(m_cuda_stream);
+    }
+}
+
 // template <>
 // CH_SENSOR_API void ChFilterAccess<SensorHostEncoderBuffer, UserEncoderBufferPtr>::Apply() {
 //     // create a new buffer to push to the lag buffer list
@@ -25,6 +25,7 @@
 #include "chrono_sensor/sensors/ChSensorBuffer.h"
 #include "chrono_sensor/filters/ChFilter.h"
 #include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/utils/ChDLPack.h"
 #include "chrono/physics/ChSystem.h"
 
 #include <typeinfo>
@@ -133,6 +134,153 @@ class CH_SENSOR_API ChFilterAccess : public ChFilter {
     unsigned int m_max_lag_buffers;  ///< maximum number of buffers that could be needed
 };
 
+/// Helpers giving the DLPack element type and innermost dimension for each device pixel format, selected by
+/// overload resolution on the raw buffer pointer.
+inline void DLPackTypeInfo(PixelRGBA8*, DLDataType& dtype, int64_t& channels) {
+    dtype = {kDLUInt, 8, 1};
+    channels = 4;
+}
+inline void DLPackTypeInfo(char*, DLDataType& dtype, int64_t& channels) {
+    dtype = {kDLUInt, 8, 1};
+    channels = 1;
+}
+inline void DLPackTypeInfo(PixelXYZI*, DLDataType& dtype, int64_t& channels) {
+    dtype = {kDLFloat, 32, 1};
+    channels = 4;
+}
+inline void DLPackTypeInfo(PixelDI*, DLDataType& dtype, int64_t& channels) {
+    dtype = {kDLFloat, 32, 1};
+    channels = 2;
+}
+
+/// Filter for device-resident access to sensor data. Follows the same lag-buffer semantics as ChFilterAccess, but
+/// keeps the data on the device: each update is copied device-to-device into a lag buffer and handed to the user as
+/// a device buffer, eliminating the device-host-device round trip when the data is consumed on the GPU (e.g. fed to
+/// an ML framework). The current buffer can be borrowed zero-copy as a DLPack tensor via GetDLPackBuffer().
+template <class BufferType, class UserBufferType>
+class CH_SENSOR_API ChFilterDeviceAccess : public ChFilter {
+  public:
+    /// Class constructor
+    /// @param name String name of the filter. Defaults to empty.
+    ChFilterDeviceAccess(std::string name = {}) : ChFilter(name.length() > 0 ? name : "CopyToDeviceFilter"){};
+
+    /// Virtual class destructor
+    virtual ~ChFilterDeviceAccess() {}
+
+    /// Apply function. Copies data device-to-device into the lag buffer and presents data to the user if the data
+    /// is ready based on the time.
+    virtual void Apply();
+
+    /// Initializes all data needed by the filter access apply function.
+    /// @param pSensor A pointer to the sensor.
+    /// @param bufferInOut the incoming process buffer
+    virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut) {
+        // check the buffer is the correct type
+        if (!bufferInOut) {
+            InvalidFilterGraphNullBuffer(pSensor);
+        }
+        if (auto pBuf = std::dynamic_pointer_cast<BufferType>(bufferInOut)) {
+            m_bufferIn = pBuf;  // save handle to the incoming buffer
+        } else {
+            InvalidFilterGraphBufferTypeMismatch(pSensor);
+        }
+
+        if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
+            m_cuda_stream = pOpx->GetCudaStream();
+        }
+
+        m_sensor = pSensor;  // save handle to the parent sensor (weak ptr to not cause loop dependency)
+        m_max_lag_buffers = 1 + (unsigned int)std::ceil((pSensor->GetLag() + pSensor->GetCollectionWindow()) *
+                                                        pSensor->GetUpdateRate());
+        m_user_buffer = chrono_types::make_shared<BufferType>();
+    }
+
+    /// User calls this to get access and ownership of the buffer memory on the device.
+    /// The returned buffer holds a raw CUDA pointer; the data is ready for consumption on any stream since the
+    /// filter graph synchronizes its stream before releasing the buffer.
+    /// Returns a user buffer that is safe for the user to access from the device.
+    UserBufferType GetBuffer() {
+        // lock the mutex before shifting ownership of the data
+        std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
+
+        // give the user the most recent buffer that qualifies based on time
+        // current time:
+        auto pSensor = m_sensor.lock();
+        float ch_time = (float)pSensor->GetParent()->GetSystem()->GetChTime();
+
+        // pop all the old buffers
+        while (m_lag_buffers.size() > 0 && ch_time > m_lag_buffers.front()->TimeStamp + pSensor->GetLag() - 1e-7) {
+            auto buf = m_lag_buffers.front();
+
+            m_lag_buffers.pop();
+
+            // move the data into our return buffer for the user
+            m_user_buffer->Buffer = std::move(buf->Buffer);
+            m_user_buffer->Width = buf->Width;
+            m_user_buffer->Height = buf->Height;
+            m_user_buffer->TimeStamp = buf->TimeStamp;
+            m_user_buffer->LaunchedCount = buf->LaunchedCount;
+        }
+
+        // return the copied class that now has ownership of the buffer memory
+        return m_user_buffer;
+    }
+
+    /// User calls this to borrow the current device buffer zero-copy as a DLPack tensor of shape
+    /// (height, width, channels). The underlying device memory is kept alive until the consumer invokes the
+    /// tensor's deleter, so it can be handed to any framework implementing the DLPack protocol without a copy.
+    /// Returns a managed DLPack tensor, or NULL if no data has been generated yet.
+    DLManagedTensor* GetDLPackBuffer() {
+        UserBufferType buf = GetBuffer();
+        if (!buf || !buf->Buffer)
+            return nullptr;
+
+        // the holder keeps a reference to the device memory for the lifetime of the exported tensor
+        auto holder = new DLPackHolder();
+        holder->keep_alive = buf;
+        DLDataType dtype;
+        int64_t channels;
+        DLPackTypeInfo(buf->Buffer.get(), dtype, channels);
+        holder->shape[0] = (int64_t)buf->Height;
+        holder->shape[1] = (int64_t)buf->Width;
+        holder->shape[2] = channels;
+
+        cudaPointerAttributes attributes;
+        cudaPointerGetAttributes(&attributes, (void*)buf->Buffer.get());
+
+        holder->tensor.dl_tensor.data = (void*)buf->Buffer.get();
+        holder->tensor.dl_tensor.device = {kDLCUDA, attributes.device};
+        holder->tensor.dl_tensor.ndim = 3;
+        holder->tensor.dl_tensor.dtype = dtype;
+        holder->tensor.dl_tensor.shape = holder->shape;
+        holder->tensor.dl_tensor.strides = nullptr;  // compact row-major
+        holder->tensor.dl_tensor.byte_offset = 0;
+        holder->tensor.manager_ctx = holder;
+        holder->tensor.deleter = [](DLManagedTensor* self) { delete static_cast<DLPackHolder*>(self->manager_ctx); };
+        return &holder->tensor;
+    }
+
+  private:
+    /// ownership context for an exported DLPack tensor
+    struct DLPackHolder {
+        UserBufferType keep_alive;  ///< reference holding the device memory alive while the tensor is borrowed
+        int64_t shape[3];           ///< shape of the exported tensor (height, width, channels)
+        DLManagedTensor tensor;     ///< the managed tensor given to the consumer
+    };
+
+    std::mutex m_mutexBufferAccess;          ///< mutex that is locked when the lag buffer is touched
+    UserBufferType m_user_buffer;            ///< buffer that can be returned
+    std::weak_ptr<ChSensor> m_sensor;        ///< pointer to the sensor to which this filter is attached
+    std::shared_ptr<BufferType> m_bufferIn;  ///< shared pointer to the buffer coming in
+    CUstream m_cuda_stream;                  ///< reference to the cuda stream for device-side buffers
+
+    std::queue<std::shared_ptr<BufferType>>
+        m_lag_buffers;  ///< buffers that are time stamped and held until past their lag time
+    std::stack<std::shared_ptr<BufferType>>
+        m_empty_lag_buffers;         ///< buffers that can be reused rather than allocating new memory each time
+    unsigned int m_max_lag_buffers;  ///< maximum number of buffers that could be needed
+};
+
 // Typedefs for explicit Filters
 /// Access to greyscale data
 using ChFilterR8Access = ChFilterAccess<SensorHostR8Buffer, UserR8BufferPtr>;
@@ -142,8 +290,12 @@ using ChFilterRGBA8Access = ChFilterAccess<SensorHostRGBA8Buffer, UserRGBA8Buffe
 using ChFilterSemanticAccess = ChFilterAccess<SensorHostSemanticBuffer, UserSemanticBufferPtr>;
 /// Access to point cloud data
 using ChFilterXYZIAccess = ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>;
+/// Access to half-precision point cloud data
+using ChFilterHalfXYZIAccess = ChFilterAccess<SensorHostHalfXYZIBuffer, UserHalfXYZIBufferPtr>;
 /// Access to depth/intensity data
 using ChFilterDIAccess = ChFilterAccess<SensorHostDIBuffer, UserDIBufferPtr>;
+/// Access to half-precision depth/intensity data
+using ChFilterHalfDIAccess = ChFilterAccess<SensorHostHalfDIBuffer, UserHalfDIBufferPtr>;
 /// Access to accelerometer data
 using ChFilterAccelAccess = ChFilterAccess<SensorHostAccelBuffer, UserAccelBufferPtr>;
 /// Access to gyroscope data
@@ -161,6 +313,16 @@ using ChFilterTachometerAccess = ChFilterAccess<SensorHostTachometerBuffer, User
 /// Access to Encoder data
 // using ChFilterEncoderAccess = ChFilterAccess<SensorHostEncoderBuffer, UserEncoderBufferPtr>;
 
+// Typedefs for device-resident access filters
+/// Device-side access to greyscale data
+using ChFilterR8DeviceAccess = ChFilterDeviceAccess<SensorDeviceR8Buffer, UserDeviceR8BufferPtr>;
+/// Device-side access to RGBA8 data
+using ChFilterRGBA8DeviceAccess = ChFilterDeviceAccess<SensorDeviceRGBA8Buffer, UserDeviceRGBA8BufferPtr>;
+/// Device-side access to point cloud data
+using ChFilterXYZIDeviceAccess = ChFilterDeviceAccess<SensorDeviceXYZIBuffer, UserDeviceXYZIBufferPtr>;
+/// Device-side access to depth/intensity data
+using ChFilterDIDeviceAccess = ChFilterDeviceAccess<SensorDeviceDIBuffer, UserDeviceDIBufferPtr>;
+
 /// @}
 
 }  // namespace sensor
@@ -47,6 +47,12 @@ class CH_SENSOR_API ChFilterCameraNoiseConstNormal : public ChFilter {
     /// user.
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
+    /// Get the mean value of the Gaussian distribution (used by the image filter fusion pass).
+    float GetMean() const { return m_mean; }
+
+    /// Get the standard deviation of the Gaussian distribution (used by the image filter fusion pass).
+    float GetStdev() const { return m_stdev; }
+
   private:
     float m_mean;                                           ///< mean value of the Guassian distribution
     float m_stdev;                                          ///< standard deviation of the Gaussian distribution
@@ -77,6 +83,12 @@ class CH_SENSOR_API ChFilterCameraNoisePixDep : public ChFilter {
     /// user.
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
+    /// Get the variance of the multiplicative noise (used by the image filter fusion pass).
+    float GetVarianceSlope() const { return m_variance_slope; }
+
+    /// Get the variance of the additive noise (used by the image filter fusion pass).
+    float GetVarianceIntercept() const { return m_variance_intercept; }
+
   private:
     float m_variance_slope;                                 ///< The variance of the multiplicative noise
     float m_variance_intercept;                             ///< The variance of the additive noise
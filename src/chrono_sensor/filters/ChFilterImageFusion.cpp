@@ -0,0 +1,162 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// =============================================================================
+
+#include "chrono_sensor/filters/ChFilterImageFusion.h"
+#include "chrono_sensor/filters/ChFilterCameraNoise.h"
+#include "chrono_sensor/filters/ChFilterGrayscale.h"
+#include "chrono_sensor/filters/ChFilterImageOps.h"
+#include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/cuda/curand_utils.cuh"
+#include "chrono_sensor/utils/CudaMallocHelper.h"
+#include <chrono>
+
+namespace chrono {
+namespace sensor {
+
+ChFilterImagePointwiseFused::ChFilterImagePointwiseFused(const std::vector<std::shared_ptr<ChFilter>>& stages,
+                                                         std::string name)
+    : m_half4_in(false), m_r8_out(false), m_needs_rng(false), ChFilter(name) {
+    // translate each replaced filter into an entry of the fused operation chain
+    m_ops.num_ops = 0;
+    for (const auto& f : stages) {
+        if (std::dynamic_pointer_cast<ChFilterImageHalf4ToRGBA8>(f)) {
+            // input conversion handled by the pixel load
+            m_half4_in = true;
+        } else if (auto noise = std::dynamic_pointer_cast<ChFilterCameraNoiseConstNormal>(f)) {
+            m_ops.op[m_ops.num_ops] = FUSED_NOISE_CONST_NORMAL;
+            m_ops.a[m_ops.num_ops] = noise->GetMean();
+            m_ops.b[m_ops.num_ops] = noise->GetStdev();
+            m_ops.num_ops++;
+            m_needs_rng = true;
+        } else if (auto noise_pd = std::dynamic_pointer_cast<ChFilterCameraNoisePixDep>(f)) {
+            m_ops.op[m_ops.num_ops] = FUSED_NOISE_PIX_DEP;
+            m_ops.a[m_ops.num_ops] = noise_pd->GetVarianceSlope();
+            m_ops.b[m_ops.num_ops] = noise_pd->GetVarianceIntercept();
+            m_ops.num_ops++;
+            m_needs_rng = true;
+        } else if (std::dynamic_pointer_cast<ChFilterGrayscale>(f)) {
+            // grayscale conversion handled by the pixel store
+            m_r8_out = true;
+        }
+    }
+}
+
+CH_SENSOR_API void ChFilterImagePointwiseFused::Initialize(std::shared_ptr<ChSensor> pSensor,
+                                                           std::shared_ptr<SensorBuffer>& bufferInOut) {
+    if (!bufferInOut)
+        InvalidFilterGraphNullBuffer(pSensor);
+    if (m_half4_in) {
+        if (auto pHalf4 = std::dynamic_pointer_cast<SensorDeviceHalf4Buffer>(bufferInOut)) {
+            m_buffer_half4_in = pHalf4;
+        } else {
+            InvalidFilterGraphBufferTypeMismatch(pSensor);
+        }
+    } else {
+        if (auto pRGBA8 = std::dynamic_pointer_cast<SensorDeviceRGBA8Buffer>(bufferInOut)) {
+            m_buffer_rgba8_in = pRGBA8;
+        } else {
+            InvalidFilterGraphBufferTypeMismatch(pSensor);
+        }
+    }
+
+    if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
+        m_cuda_stream = pOpx->GetCudaStream();
+    } else {
+        InvalidFilterGraphSensorTypeMismatch(pSensor);
+    }
+
+    // a single generator state array is shared by all fused noise stages
+    if (m_needs_rng) {
+        m_rng = std::shared_ptr<curandState_t>(
+            cudaMallocHelper<curandState_t>(bufferInOut->Width * bufferInOut->Height), cudaFreeHelper<curandState_t>);
+        init_cuda_rng((unsigned int)(std::chrono::high_resolution_clock::now().time_since_epoch().count()),
+                      m_rng.get(), bufferInOut->Width * bufferInOut->Height);
+    }
+
+    // make new buffer for output
+    if (m_r8_out) {
+        m_buffer_r8_out = chrono_types::make_shared<SensorDeviceR8Buffer>();
+        DeviceR8BufferPtr b(cudaMallocHelper<char>(bufferInOut->Width * bufferInOut->Height), cudaFreeHelper<char>);
+        m_buffer_r8_out->Buffer = std::move(b);
+        m_buffer_r8_out->Width = bufferInOut->Width;
+        m_buffer_r8_out->Height = bufferInOut->Height;
+        m_buffer_r8_out->LaunchedCount = bufferInOut->LaunchedCount;
+        m_buffer_r8_out->TimeStamp = bufferInOut->TimeStamp;
+        bufferInOut = m_buffer_r8_out;
+    } else {
+        m_buffer_rgba8_out = chrono_types::make_shared<SensorDeviceRGBA8Buffer>();
+        DeviceRGBA8BufferPtr b(cudaMallocHelper<PixelRGBA8>(bufferInOut->Width * bufferInOut->Height),
+                               cudaFreeHelper<PixelRGBA8>);
+        m_buffer_rgba8_out->Buffer = std::move(b);
+        m_buffer_rgba8_out->Width = bufferInOut->Width;
+        m_buffer_rgba8_out->Height = bufferInOut->Height;
+        m_buffer_rgba8_out->LaunchedCount = bufferInOut->LaunchedCount;
+        m_buffer_rgba8_out->TimeStamp = bufferInOut->TimeStamp;
+        bufferInOut = m_buffer_rgba8_out;
+    }
+}
+
+CH_SENSOR_API void ChFilterImagePointwiseFused::Apply() {
+    SensorBuffer* buf_in = m_half4_in ? (SensorBuffer*)m_buffer_half4_in.get() : (SensorBuffer*)m_buffer_rgba8_in.get();
+    SensorBuffer* buf_out = m_r8_out ? (SensorBuffer*)m_buffer_r8_out.get() : (SensorBuffer*)m_buffer_rgba8_out.get();
+    buf_out->Width = buf_in->Width;
+    buf_out->Height = buf_in->Height;
+    buf_out->LaunchedCount = buf_in->LaunchedCount;
+    buf_out->TimeStamp = buf_in->TimeStamp;
+
+    void* in_ptr = m_half4_in ? (void*)m_buffer_half4_in->Buffer.get() : (void*)m_buffer_rgba8_in->Buffer.get();
+    void* out_ptr = m_r8_out ? (void*)m_buffer_r8_out->Buffer.get() : (void*)m_buffer_rgba8_out->Buffer.get();
+
+    // apply all fused pointwise operations with a single kernel launch
+    cuda_image_pointwise_fused(in_ptr, out_ptr, (int)buf_in->Width, (int)buf_in->Height, m_half4_in, m_r8_out, m_ops,
+                               m_rng.get(), m_cuda_stream);
+}
+
+CH_SENSOR_API void ChFilterImagePointwiseFused::ApplyFusionPass(std::list<std::shared_ptr<ChFilter>>& filters) {
+    auto it = filters.begin();
+    while (it != filters.end()) {
+        // collect a maximal run of adjacent fusible pointwise filters starting at this position
+        std::vector<std::shared_ptr<ChFilter>> run;
+        auto run_begin = it;
+        bool ends_in_grayscale = false;
+        while (it != filters.end() && !ends_in_grayscale && (int)run.size() < FUSED_IMAGE_MAX_OPS) {
+            auto f = *it;
+            if (std::dynamic_pointer_cast<ChFilterImageHalf4ToRGBA8>(f)) {
+                if (!run.empty())
+                    break;  // the input conversion can only be the first stage of a run
+            } else if (std::dynamic_pointer_cast<ChFilterGrayscale>(f)) {
+                ends_in_grayscale = true;  // output switches to R8, so no further stages can be fused
+            } else if (!std::dynamic_pointer_cast<ChFilterCameraNoiseConstNormal>(f) &&
+                       !std::dynamic_pointer_cast<ChFilterCameraNoisePixDep>(f)) {
+                break;  // not a fusible pointwise filter
+            }
+            run.push_back(f);
+            ++it;
+        }
+
+        if (run.size() >= 2) {
+            // replace the run with a single fused filter
+            auto fused = chrono_types::make_shared<ChFilterImagePointwiseFused>(run);
+            it = filters.erase(run_begin, it);
+            it = filters.insert(it, fused);
+            ++it;
+        } else if (run.empty()) {
+            ++it;  // current filter is not fusible; move past it
+        }
+        // a run of length 1 is left in place (the iterator has already advanced past it)
+    }
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,80 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// =============================================================================
+
+#ifndef CHFILTERIMAGEFUSION_H
+#define CHFILTERIMAGEFUSION_H
+
+#include <list>
+#include <vector>
+
+#include "chrono_sensor/filters/ChFilter.h"
+
+#include <cuda.h>
+#include <curand.h>
+#include <curand_kernel.h>
+
+#include "chrono_sensor/cuda/image_fuse.cuh"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_filters
+/// @{
+
+/// A filter that applies a chain of adjacent pointwise image operations in a single fused kernel.
+/// Instances are created by the fusion pass that runs when a sensor's filter list is locked (see ApplyFusionPass);
+/// they replace runs of adjacent pointwise filters (half4-to-RGBA8 conversion, camera noise, grayscale) so that
+/// each pixel makes one round trip through global memory instead of one per stage.
+class CH_SENSOR_API ChFilterImagePointwiseFused : public ChFilter {
+  public:
+    /// Class constructor.
+    /// @param stages The adjacent pointwise filters this fused filter replaces, in order.
+    /// @param name String name of the filter.
+    ChFilterImagePointwiseFused(const std::vector<std::shared_ptr<ChFilter>>& stages,
+                                std::string name = "ChFilterImagePointwiseFused");
+
+    /// Apply function. Applies the full chain of fused pointwise operations to the image.
+    virtual void Apply();
+
+    /// Initializes all data needed by the filter access apply function.
+    /// @param pSensor A pointer to the sensor on which the filter is attached.
+    /// @param bufferInOut A buffer that is passed into the filter.
+    virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
+
+    /// Fusion pass over a sensor's filter list. Replaces every maximal run of two or more adjacent fusible
+    /// pointwise filters with a single ChFilterImagePointwiseFused instance, cutting global memory traffic
+    /// proportionally to the number of fused stages. Called automatically when the filter list is locked.
+    /// @param filters The sensor's filter list, modified in place.
+    static void ApplyFusionPass(std::list<std::shared_ptr<ChFilter>>& filters);
+
+  private:
+    FusedImageOps m_ops;  ///< chain of pointwise operations performed by the fused kernel
+    bool m_half4_in;      ///< whether the chain starts with a half4-to-RGBA8 conversion stage
+    bool m_r8_out;        ///< whether the chain ends with a grayscale stage and outputs an R8 image
+    bool m_needs_rng;     ///< whether the chain contains a noise stage
+
+    std::shared_ptr<curandState_t> m_rng;                     ///< cuda random number generator
+    std::shared_ptr<SensorDeviceHalf4Buffer> m_buffer_half4_in;  ///< holder of a half4 input image
+    std::shared_ptr<SensorDeviceRGBA8Buffer> m_buffer_rgba8_in;  ///< holder of an RGBA8 input image
+    std::shared_ptr<SensorDeviceRGBA8Buffer> m_buffer_rgba8_out;  ///< holder of an RGBA8 output image
+    std::shared_ptr<SensorDeviceR8Buffer> m_buffer_r8_out;        ///< holder of an R8 output image
+    CUstream m_cuda_stream;  ///< reference to the cuda stream
+};
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -22,8 +22,8 @@
 namespace chrono {
 namespace sensor {
 
-ChFilterLidarReduce::ChFilterLidarReduce(LidarReturnMode ret, int reduce_radius, std::string name)
-    : m_ret(ret), m_reduce_radius(reduce_radius), ChFilter(name) {}
+ChFilterLidarReduce::ChFilterLidarReduce(LidarReturnMode ret, int reduce_radius, std::string name, bool half_output)
+    : m_ret(ret), m_reduce_radius(reduce_radius), m_half_output(half_output), ChFilter(name) {}
 CH_SENSOR_API void ChFilterLidarReduce::Initialize(std::shared_ptr<ChSensor> pSensor,
                                                    std::shared_ptr<SensorBuffer>& bufferInOut) {
     if (!bufferInOut)
@@ -39,55 +39,74 @@ CH_SENSOR_API void ChFilterLidarReduce::Initialize(std::shared_ptr<ChSensor> pSe
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
 
-    switch (m_ret) {
-        case LidarReturnMode::DUAL_RETURN: {
-            m_buffer_out = chrono_types::make_shared<SensorDeviceDIBuffer>();
-            DeviceDIBufferPtr b(cudaMallocHelper<PixelDI>(m_buffer_in->Width * m_buffer_in->Height * 2 /
-                                                          ((m_reduce_radius * 2 - 1) * (m_reduce_radius * 2 - 1))),
-                                cudaFreeHelper<PixelDI>);
-            m_buffer_out->Buffer = std::move(b);
-            m_buffer_out->Width = m_buffer_in->Width / (m_reduce_radius * 2 - 1);
-            m_buffer_out->Height = m_buffer_in->Height / (m_reduce_radius * 2 - 1);
-            m_buffer_out->Dual_return = true;
-            break;
-        }
+    bool dual = (m_ret == LidarReturnMode::DUAL_RETURN);  // all other returns are single, regardless of type
+    unsigned int num_entries = m_buffer_in->Width * m_buffer_in->Height * (dual ? 2 : 1) /
+                               ((m_reduce_radius * 2 - 1) * (m_reduce_radius * 2 - 1));
 
-        default: {  // all other returns are single, regardless of type
-            m_buffer_out = chrono_types::make_shared<SensorDeviceDIBuffer>();
-            DeviceDIBufferPtr b(cudaMallocHelper<PixelDI>(m_buffer_in->Width * m_buffer_in->Height /
-                                                          ((m_reduce_radius * 2 - 1) * (m_reduce_radius * 2 - 1))),
-                                cudaFreeHelper<PixelDI>);
-            m_buffer_out->Buffer = std::move(b);
-            m_buffer_out->Width = m_buffer_in->Width / (m_reduce_radius * 2 - 1);
-            m_buffer_out->Height = m_buffer_in->Height / (m_reduce_radius * 2 - 1);
-            m_buffer_out->Dual_return = false;
-        }
+    if (m_half_output) {
+        m_buffer_out_half = chrono_types::make_shared<SensorDeviceHalfDIBuffer>();
+        DeviceHalfDIBufferPtr b(cudaMallocHelper<PixelHalfDI>(num_entries), cudaFreeHelper<PixelHalfDI>);
+        m_buffer_out_half->Buffer = std::move(b);
+        m_buffer_out_half->Width = m_buffer_in->Width / (m_reduce_radius * 2 - 1);
+        m_buffer_out_half->Height = m_buffer_in->Height / (m_reduce_radius * 2 - 1);
+        m_buffer_out_half->Dual_return = dual;
+        bufferInOut = m_buffer_out_half;
+    } else {
+        m_buffer_out = chrono_types::make_shared<SensorDeviceDIBuffer>();
+        DeviceDIBufferPtr b(cudaMallocHelper<PixelDI>(num_entries), cudaFreeHelper<PixelDI>);
+        m_buffer_out->Buffer = std::move(b);
+        m_buffer_out->Width = m_buffer_in->Width / (m_reduce_radius * 2 - 1);
+        m_buffer_out->Height = m_buffer_in->Height / (m_reduce_radius * 2 - 1);
+        m_buffer_out->Dual_return = dual;
+        bufferInOut = m_buffer_out;
     }
-    bufferInOut = m_buffer_out;
 }
 
 CH_SENSOR_API void ChFilterLidarReduce::Apply() {
+    void* buf_out = m_half_output ? (void*)m_buffer_out_half->Buffer.get() : (void*)m_buffer_out->Buffer.get();
+
     switch (m_ret) {
         case LidarReturnMode::DUAL_RETURN:
-            cuda_lidar_dual_reduce(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
-                                   (int)m_buffer_in->Height, m_reduce_radius, m_cuda_stream);
+            if (m_half_output)
+                cuda_lidar_dual_reduce_half(m_buffer_in->Buffer.get(), buf_out, (int)m_buffer_in->Width,
+                                            (int)m_buffer_in->Height, m_reduce_radius, m_cuda_stream);
+            else
+                cuda_lidar_dual_reduce(m_buffer_in->Buffer.get(), buf_out, (int)m_buffer_in->Width,
+                                       (int)m_buffer_in->Height, m_reduce_radius, m_cuda_stream);
             break;
         case LidarReturnMode::STRONGEST_RETURN:
-            cuda_lidar_strong_reduce(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
-                                     (int)m_buffer_in->Height, m_reduce_radius, m_cuda_stream);
+            if (m_half_output)
+                cuda_lidar_strong_reduce_half(m_buffer_in->Buffer.get(), buf_out, (int)m_buffer_in->Width,
+                                              (int)m_buffer_in->Height, m_reduce_radius, m_cuda_stream);
+            else
+                cuda_lidar_strong_reduce(m_buffer_in->Buffer.get(), buf_out, (int)m_buffer_in->Width,
+                                         (int)m_buffer_in->Height, m_reduce_radius, m_cuda_stream);
             break;
         case LidarReturnMode::FIRST_RETURN:
-            cuda_lidar_first_reduce(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
-                                    (int)m_buffer_in->Height, m_reduce_radius, m_cuda_stream);
+            if (m_half_output)
+                cuda_lidar_first_reduce_half(m_buffer_in->Buffer.get(), buf_out, (int)m_buffer_in->Width,
+                                             (int)m_buffer_in->Height, m_reduce_radius, m_cuda_stream);
+            else
+                cuda_lidar_first_reduce(m_buffer_in->Buffer.get(), buf_out, (int)m_buffer_in->Width,
+                                        (int)m_buffer_in->Height, m_reduce_radius, m_cuda_stream);
             break;
         default:  // LidarReturnMode::MEAN_RETURN:
-            cuda_lidar_mean_reduce(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
-                                   (int)m_buffer_in->Height, m_reduce_radius, m_cuda_stream);
+            if (m_half_output)
+                cuda_lidar_mean_reduce_half(m_buffer_in->Buffer.get(), buf_out, (int)m_buffer_in->Width,
+                                            (int)m_buffer_in->Height, m_reduce_radius, m_cuda_stream);
+            else
+                cuda_lidar_mean_reduce(m_buffer_in->Buffer.get(), buf_out, (int)m_buffer_in->Width,
+                                       (int)m_buffer_in->Height, m_reduce_radius, m_cuda_stream);
             break;
     }
 
-    m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
-    m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+    if (m_half_output) {
+        m_buffer_out_half->LaunchedCount = m_buffer_in->LaunchedCount;
+        m_buffer_out_half->TimeStamp = m_buffer_in->TimeStamp;
+    } else {
+        m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
+        m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+    }
 }
 
 }  // namespace sensor
@@ -36,7 +36,13 @@ class CH_SENSOR_API ChFilterLidarReduce : public ChFilter {
     /// @param ret The return mode of the lidar sensor (STRONGEST, FIRST, LAST, etc)
     /// @param reduce_radius The radius of samples per beam
     /// @param name The string name of the filter
-    ChFilterLidarReduce(LidarReturnMode ret, int reduce_radius, std::string name = "ChFilterLidarReduce");
+    /// @param half_output When true, the reduced buffer is half precision (PixelHalfDI), halving its size and the
+    /// size of any subsequent device-to-host transfer; the conversion is fused into the reduction kernel. Filters
+    /// placed downstream must then accept a half-precision depth-intensity buffer.
+    ChFilterLidarReduce(LidarReturnMode ret,
+                        int reduce_radius,
+                        std::string name = "ChFilterLidarReduce",
+                        bool half_output = false);
 
     /// Apply function. Reduces lidar data from raw to processed.
     virtual void Apply();
@@ -47,11 +53,13 @@ class CH_SENSOR_API ChFilterLidarReduce : public ChFilter {
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
   private:
-    std::shared_ptr<SensorDeviceDIBuffer> m_buffer_in;   ///< for holding the input buffer
-    std::shared_ptr<SensorDeviceDIBuffer> m_buffer_out;  ///< for holding the output buffer
-    LidarReturnMode m_ret;                               ///< for holding the return mode
-    int m_reduce_radius;                                 ///< for holding the sample radius
-    CUstream m_cuda_stream;                              ///< reference to the cuda stream
+    std::shared_ptr<SensorDeviceDIBuffer> m_buffer_in;             ///< for holding the input buffer
+    std::shared_ptr<SensorDeviceDIBuffer> m_buffer_out;            ///< for holding the output buffer
+    std::shared_ptr<SensorDeviceHalfDIBuffer> m_buffer_out_half;   ///< for holding the half-precision output buffer
+    LidarReturnMode m_ret;                                         ///< for holding the return mode
+    int m_reduce_radius;                                           ///< for holding the sample radius
+    bool m_half_output;                                            ///< produce a half-precision output buffer
+    CUstream m_cuda_stream;                                        ///< reference to the cuda stream
 };
 
 /// @}
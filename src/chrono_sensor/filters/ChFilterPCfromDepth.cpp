@@ -24,7 +24,14 @@
 namespace chrono {
 namespace sensor {
 
-ChFilterPCfromDepth::ChFilterPCfromDepth(std::string name) : ChFilter(name) {}
+ChFilterPCfromDepth::ChFilterPCfromDepth(std::string name, bool half_output)
+    : m_half_output(half_output), ChFilter(name) {}
+
+ChFilterPCfromDepth::~ChFilterPCfromDepth() {
+    if (m_compact_scratch) {
+        cudaFree(m_compact_scratch);
+    }
+}
 
 CH_SENSOR_API void ChFilterPCfromDepth::Initialize(std::shared_ptr<ChSensor> pSensor,
                                                    std::shared_ptr<SensorBuffer>& bufferInOut) {
@@ -41,48 +48,70 @@ CH_SENSOR_API void ChFilterPCfromDepth::Initialize(std::shared_ptr<ChSensor> pSe
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
 
+    unsigned int num_entries = m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1);
+
     // allocate output buffer
-    m_buffer_out = chrono_types::make_shared<SensorDeviceXYZIBuffer>();
-    DeviceXYZIBufferPtr b(
-        cudaMallocHelper<PixelXYZI>(m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1)),
-        cudaFreeHelper<PixelXYZI>);
-    m_buffer_out->Buffer = std::move(b);
-    m_buffer_out->Width = m_buffer_in->Width;
-    m_buffer_out->Height = m_buffer_in->Height;
-    m_buffer_out->Dual_return = m_buffer_in->Dual_return;
-    bufferInOut = m_buffer_out;
+    if (m_half_output) {
+        m_buffer_out_half = chrono_types::make_shared<SensorDeviceHalfXYZIBuffer>();
+        DeviceHalfXYZIBufferPtr b(cudaMallocHelper<PixelHalfXYZI>(num_entries), cudaFreeHelper<PixelHalfXYZI>);
+        m_buffer_out_half->Buffer = std::move(b);
+        m_buffer_out_half->Width = m_buffer_in->Width;
+        m_buffer_out_half->Height = m_buffer_in->Height;
+        m_buffer_out_half->Dual_return = m_buffer_in->Dual_return;
+        bufferInOut = m_buffer_out_half;
+    } else {
+        m_buffer_out = chrono_types::make_shared<SensorDeviceXYZIBuffer>();
+        DeviceXYZIBufferPtr b(cudaMallocHelper<PixelXYZI>(num_entries), cudaFreeHelper<PixelXYZI>);
+        m_buffer_out->Buffer = std::move(b);
+        m_buffer_out->Width = m_buffer_in->Width;
+        m_buffer_out->Height = m_buffer_in->Height;
+        m_buffer_out->Dual_return = m_buffer_in->Dual_return;
+        bufferInOut = m_buffer_out;
+    }
+
+    // allocate the intermediate dense point cloud and the compaction outputs
+    m_dense_buffer =
+        std::shared_ptr<PixelXYZI[]>(cudaMallocHelper<PixelXYZI>(num_entries), cudaFreeHelper<PixelXYZI>);
+    m_index_map = std::shared_ptr<int[]>(cudaMallocHelper<int>(num_entries), cudaFreeHelper<int>);
+    m_num_valid = std::shared_ptr<int[]>(cudaMallocHelper<int>(1), cudaFreeHelper<int>);
 }
 
 CH_SENSOR_API void ChFilterPCfromDepth::Apply() {
-    // carry out the conversion from depth to point cloud
+    // carry out the conversion from depth to point cloud into the dense intermediate buffer
     if (m_buffer_in->Dual_return) {
-        cuda_pointcloud_from_depth_dual_return(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(),
+        cuda_pointcloud_from_depth_dual_return(m_buffer_in->Buffer.get(), m_dense_buffer.get(),
                                                (int)m_buffer_in->Width, (int)m_buffer_in->Height, m_hFOV,
                                                m_max_vert_angle, m_min_vert_angle, m_cuda_stream);
 
     } else {
-        cuda_pointcloud_from_depth(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
+        cuda_pointcloud_from_depth(m_buffer_in->Buffer.get(), m_dense_buffer.get(), (int)m_buffer_in->Width,
                                    (int)m_buffer_in->Height, m_hFOV, m_max_vert_angle, m_min_vert_angle, m_cuda_stream);
     }
 
-    // counter for beam returns
-    m_buffer_out->Beam_return_count = 0;
-    auto buf = std::vector<PixelXYZI>(m_buffer_out->Width * m_buffer_out->Height * (m_buffer_out->Dual_return + 1));
-    auto processed_buffer = std::vector<PixelXYZI>(m_buffer_out->Width * m_buffer_out->Height * (m_buffer_out->Dual_return + 1));
-    cudaMemcpyAsync(buf.data(), m_buffer_out->Buffer.get(), buf.size() * sizeof(PixelXYZI), cudaMemcpyDeviceToHost,
-                    m_cuda_stream);
-    cudaStreamSynchronize(m_cuda_stream);
-    for (unsigned int i = 0; i < buf.size(); i++) {
-        if (buf[i].intensity > 0) {
-            processed_buffer[m_buffer_out->Beam_return_count] = buf[i];
-            m_buffer_out->Beam_return_count++;
-        }
+    // drop zero-intensity returns on the device, packing the valid points into the output buffer; only the valid
+    // count crosses back to the host
+    int num_entries = (int)(m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1));
+    if (m_half_output) {
+        cuda_pointcloud_compact_half(m_dense_buffer.get(), m_buffer_out_half->Buffer.get(), num_entries, 4, 3,
+                                     m_index_map.get(), m_num_valid.get(), &m_compact_scratch,
+                                     &m_compact_scratch_bytes, m_cuda_stream);
+    } else {
+        cuda_pointcloud_compact(m_dense_buffer.get(), m_buffer_out->Buffer.get(), num_entries, 4, 3, m_index_map.get(),
+                                m_num_valid.get(), &m_compact_scratch, &m_compact_scratch_bytes, m_cuda_stream);
     }
-    cudaMemcpyAsync(m_buffer_out->Buffer.get(), processed_buffer.data(), m_buffer_out->Beam_return_count * sizeof(PixelXYZI),
-                    cudaMemcpyHostToDevice, m_cuda_stream);
+    int num_valid;
+    cudaMemcpyAsync(&num_valid, m_num_valid.get(), sizeof(int), cudaMemcpyDeviceToHost, m_cuda_stream);
+    cudaStreamSynchronize(m_cuda_stream);
 
-    m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
-    m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+    if (m_half_output) {
+        m_buffer_out_half->Beam_return_count = (unsigned int)num_valid;
+        m_buffer_out_half->LaunchedCount = m_buffer_in->LaunchedCount;
+        m_buffer_out_half->TimeStamp = m_buffer_in->TimeStamp;
+    } else {
+        m_buffer_out->Beam_return_count = (unsigned int)num_valid;
+        m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
+        m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+    }
 }
 }  // namespace sensor
 }  // namespace chrono
@@ -34,7 +34,13 @@ class CH_SENSOR_API ChFilterPCfromDepth : public ChFilter {
   public:
     /// Class constructor
     /// @param name String name of the filter
-    ChFilterPCfromDepth(std::string name = {});
+    /// @param half_output When true, the packed point cloud is half precision (PixelHalfXYZI), halving its size and
+    /// the size of any subsequent device-to-host transfer; the conversion is fused into the kernel that packs the
+    /// valid returns. Filters placed downstream must then accept a half-precision point cloud buffer.
+    ChFilterPCfromDepth(std::string name = {}, bool half_output = false);
+
+    /// Class destructor
+    ~ChFilterPCfromDepth();
 
     /// Apply function. Converts data from depth/intensity to point cloud data
     virtual void Apply();
@@ -49,8 +55,15 @@ class CH_SENSOR_API ChFilterPCfromDepth : public ChFilter {
     float m_min_vert_angle;                                ///< mimimum vertical angle of parent lidar
     float m_max_vert_angle;                                ///< maximum vetical angle of parent lidar
     CUstream m_cuda_stream;                                ///< reference to the cuda stream
+    bool m_half_output;                                    ///< produce a half-precision output buffer
     std::shared_ptr<SensorDeviceDIBuffer> m_buffer_in;     ///< holder of the input buffer
     std::shared_ptr<SensorDeviceXYZIBuffer> m_buffer_out;  ///< holder of the output buffer
+    std::shared_ptr<SensorDeviceHalfXYZIBuffer> m_buffer_out_half;  ///< holder of the half-precision output buffer
+    std::shared_ptr<PixelXYZI[]> m_dense_buffer;           ///< dense point cloud before device compaction
+    std::shared_ptr<int[]> m_index_map;  ///< for each packed point, its index in the dense buffer (device)
+    std::shared_ptr<int[]> m_num_valid;  ///< number of valid returns (single int, device)
+    void* m_compact_scratch = nullptr;   ///< scratch space for the device compaction, grown as needed
+    size_t m_compact_scratch_bytes = 0;  ///< allocated size of the compaction scratch space
 };
 
 /// @}
@@ -17,6 +17,7 @@
 #include "chrono_sensor/filters/ChFilterRadarProcess.h"
 #include "chrono_sensor/utils/CudaMallocHelper.h"
 #include "chrono_sensor/cuda/radarprocess.cuh"
+#include "chrono_sensor/cuda/pointcloud.cuh"
 #include "chrono_sensor/utils/Dbscan.h"
 #include <random>
 
@@ -25,6 +26,12 @@ namespace sensor {
 
 ChFilterRadarProcess::ChFilterRadarProcess(std::string name) : ChFilter(name) {}
 
+ChFilterRadarProcess::~ChFilterRadarProcess() {
+    if (m_compact_scratch) {
+        cudaFree(m_compact_scratch);
+    }
+}
+
 CH_SENSOR_API void ChFilterRadarProcess::Initialize(std::shared_ptr<ChSensor> pSensor,
                                                     std::shared_ptr<SensorBuffer>& bufferInOut) {
     if (!bufferInOut)
@@ -51,19 +58,35 @@ CH_SENSOR_API void ChFilterRadarProcess::Initialize(std::shared_ptr<ChSensor> pS
     m_buffer_out->Width = bufferInOut->Width;
     m_buffer_out->Height = bufferInOut->Height;
     bufferInOut = m_buffer_out;
+
+    // allocate the intermediate device buffers for the point cloud conversion and compaction
+    unsigned int num_entries = m_buffer_in->Width * m_buffer_in->Height;
+    m_dense_buffer = DeviceRadarXYZBufferPtr(cudaMallocHelper<RadarXYZReturn>(num_entries),
+                                             cudaFreeHelper<RadarXYZReturn>);
+    m_packed_buffer = DeviceRadarXYZBufferPtr(cudaMallocHelper<RadarXYZReturn>(num_entries),
+                                              cudaFreeHelper<RadarXYZReturn>);
+    m_index_map = std::shared_ptr<int[]>(cudaMallocHelper<int>(num_entries), cudaFreeHelper<int>);
+    m_num_valid = std::shared_ptr<int[]>(cudaMallocHelper<int>(1), cudaFreeHelper<int>);
 }
 
 
 CH_SENSOR_API void ChFilterRadarProcess::Apply() {
     // converts azimuth and elevation to XYZ Coordinates in device
-    cuda_radar_pointcloud_from_angles(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), 
+    cuda_radar_pointcloud_from_angles(m_buffer_in->Buffer.get(), m_dense_buffer.get(),
                                       (int)m_buffer_in->Width, (int)m_buffer_in->Height, m_hFOV, m_vFOV,
                                       m_cuda_stream);
 
-    // Transfer pointcloud to host
-    auto buf = std::vector<RadarXYZReturn>(m_buffer_out->Width * m_buffer_out->Height);
-    cudaMemcpyAsync(buf.data(), m_buffer_out->Buffer.get(),
-                    m_buffer_out->Width * m_buffer_out->Height * sizeof(RadarXYZReturn), cudaMemcpyDeviceToHost,
+    // drop rays with no returns on the device so that only the valid returns cross the PCIe bus
+    int num_entries = (int)(m_buffer_in->Width * m_buffer_in->Height);
+    cuda_pointcloud_compact(m_dense_buffer.get(), m_packed_buffer.get(), num_entries, 8, 6, m_index_map.get(),
+                            m_num_valid.get(), &m_compact_scratch, &m_compact_scratch_bytes, m_cuda_stream);
+    int num_valid;
+    cudaMemcpyAsync(&num_valid, m_num_valid.get(), sizeof(int), cudaMemcpyDeviceToHost, m_cuda_stream);
+    cudaStreamSynchronize(m_cuda_stream);
+
+    // Transfer the packed pointcloud to host
+    auto buf = std::vector<RadarXYZReturn>(num_valid);
+    cudaMemcpyAsync(buf.data(), m_packed_buffer.get(), num_valid * sizeof(RadarXYZReturn), cudaMemcpyDeviceToHost,
                     m_cuda_stream);
     cudaStreamSynchronize(m_cuda_stream);
 
@@ -71,14 +94,11 @@ CH_SENSOR_API void ChFilterRadarProcess::Apply() {
     // sort returns to bins by objectId
     auto bins = std::vector<std::vector<RadarXYZReturn>>();
     for (RadarXYZReturn point : buf){
-        // remove rays with no returns
-        if (point.amplitude > 0){
-            // tries to add the return to the bin, if bin doesnt exist, add the bin
-            while (bins.size() <= point.objectId){
-                bins.push_back(std::vector<RadarXYZReturn>());
-            }
-            bins[point.objectId].push_back(point);
+        // tries to add the return to the bin, if bin doesnt exist, add the bin
+        while (bins.size() <= point.objectId){
+            bins.push_back(std::vector<RadarXYZReturn>());
         }
+        bins[point.objectId].push_back(point);
     }
 
 #if PROFILE
@@ -40,6 +40,9 @@ class CH_SENSOR_API ChFilterRadarProcess : public ChFilter {
     /// @param name String name of the filter
     ChFilterRadarProcess(std::string name = "ChFilterRadarProcess");
 
+    /// Class destructor
+    ~ChFilterRadarProcess();
+
     /// Apply function. Converts depth to PC, clusters, and calculate centroid and avg velocity of each cluster
     virtual void Apply();
 
@@ -53,6 +56,12 @@ class CH_SENSOR_API ChFilterRadarProcess : public ChFilter {
     std::shared_ptr<SensorDeviceRadarBuffer> m_buffer_in;          /// holder of the input buffer
     std::shared_ptr<SensorHostRadarXYZBuffer> m_buffer_out;  /// holder of the output buffer
     CUstream m_cuda_stream;                                        /// reference to the cuda stream
+    DeviceRadarXYZBufferPtr m_dense_buffer;   /// dense point cloud before device compaction
+    DeviceRadarXYZBufferPtr m_packed_buffer;  /// valid returns packed on the device
+    std::shared_ptr<int[]> m_index_map;       /// for each packed return, its index in the dense buffer (device)
+    std::shared_ptr<int[]> m_num_valid;       /// number of valid returns (single int, device)
+    void* m_compact_scratch = nullptr;        /// scratch space for the device compaction, grown as needed
+    size_t m_compact_scratch_bytes = 0;       /// allocated size of the compaction scratch space
     float m_hFOV;                                                  /// horizontal field of view of the radar
     float m_vFOV;                                        /// mimimum vertical angle of the radar
     #if PROFILE
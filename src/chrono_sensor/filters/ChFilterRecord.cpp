@@ -0,0 +1,213 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+//
+// =============================================================================
+
+#include "chrono_sensor/filters/ChFilterRecord.h"
+#include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/utils/CudaMallocHelper.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+namespace chrono {
+namespace sensor {
+
+// Container layout: header, raw frames, index of (frame number, byte offset) pairs, footer locating the index
+static const char REC_MAGIC[8] = {'C', 'H', 'S', 'E', 'N', 'R', 'E', 'C'};
+static const uint32_t REC_VERSION = 1;
+enum REC_FORMAT : uint32_t { REC_R8 = 1, REC_RGBA8 = 2, REC_SEMANTIC = 3 };
+
+CH_SENSOR_API ChFilterRecord::ChFilterRecord(std::string file_path, int ring_frames, std::string name)
+    : ChFilter(name), m_path(file_path), m_ring_frames(ring_frames > 2 ? ring_frames : 2) {}
+
+CH_SENSOR_API ChFilterRecord::~ChFilterRecord() {
+    if (m_writer.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_writer.join();
+    }
+
+    if (m_file.is_open()) {
+        // Append the frame index and a footer locating it
+        uint64_t index_offset = (uint64_t)m_file.tellp();
+        for (const auto& entry : m_index) {
+            m_file.write((const char*)&entry.first, sizeof(uint32_t));
+            m_file.write((const char*)&entry.second, sizeof(uint64_t));
+        }
+        uint32_t index_count = (uint32_t)m_index.size();
+        m_file.write((const char*)&index_offset, sizeof(uint64_t));
+        m_file.write((const char*)&index_count, sizeof(uint32_t));
+        m_file.write(REC_MAGIC, 8);
+        m_file.close();
+    }
+
+    for (auto event : m_copy_events)
+        cudaEventDestroy(event);
+}
+
+CH_SENSOR_API void ChFilterRecord::Apply() {
+    const void* src = nullptr;
+    if (m_r8_in)
+        src = m_r8_in->Buffer.get();
+    else if (m_rgba8_in)
+        src = m_rgba8_in->Buffer.get();
+    else if (m_semantic_in)
+        src = m_semantic_in->Buffer.get();
+
+    // Claim a free ring slot; blocks only when every slot is still in flight
+    int slot = -1;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this, &slot] {
+            for (int i = 0; i < m_ring_frames; i++) {
+                if (!m_slot_busy[i]) {
+                    slot = i;
+                    return true;
+                }
+            }
+            return false;
+        });
+        m_slot_busy[slot] = true;
+    }
+
+    // Stage the frame asynchronously on the sensor's stream; the writer waits on the event before touching
+    // the slot, so no synchronization with the device is needed here
+    cudaMemcpyAsync(m_ring[slot].get(), src, m_frame_size, cudaMemcpyDeviceToHost, m_cuda_stream);
+    cudaEventRecord(m_copy_events[slot], m_cuda_stream);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back({slot, m_frame_number});
+    }
+    m_cv.notify_all();
+
+    m_frame_number++;
+}
+
+void ChFilterRecord::WriterLoop() {
+    while (true) {
+        int slot;
+        unsigned int frame;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] { return !m_queue.empty() || m_stop; });
+            if (m_queue.empty())
+                return;
+            slot = m_queue.front().first;
+            frame = m_queue.front().second;
+            m_queue.pop_front();
+        }
+
+        // Wait for the staging copy of this frame to complete, then persist it
+        cudaEventSynchronize(m_copy_events[slot]);
+        uint64_t offset = (uint64_t)m_file.tellp();
+        m_file.write(m_ring[slot].get(), m_frame_size);
+        m_index.push_back({frame, offset});
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_slot_busy[slot] = false;
+        }
+        m_cv.notify_all();
+    }
+}
+
+CH_SENSOR_API void ChFilterRecord::Initialize(std::shared_ptr<ChSensor> pSensor,
+                                              std::shared_ptr<SensorBuffer>& bufferInOut) {
+    if (!bufferInOut)
+        InvalidFilterGraphNullBuffer(pSensor);
+
+    uint32_t format;
+    if (auto pR8 = std::dynamic_pointer_cast<SensorDeviceR8Buffer>(bufferInOut)) {
+        m_r8_in = pR8;
+        m_frame_size = pR8->Width * pR8->Height * sizeof(char);
+        m_width = pR8->Width;
+        m_height = pR8->Height;
+        format = REC_R8;
+    } else if (auto pRGBA8 = std::dynamic_pointer_cast<SensorDeviceRGBA8Buffer>(bufferInOut)) {
+        m_rgba8_in = pRGBA8;
+        m_frame_size = pRGBA8->Width * pRGBA8->Height * sizeof(PixelRGBA8);
+        m_width = pRGBA8->Width;
+        m_height = pRGBA8->Height;
+        format = REC_RGBA8;
+    } else if (auto pSemantic = std::dynamic_pointer_cast<SensorDeviceSemanticBuffer>(bufferInOut)) {
+        m_semantic_in = pSemantic;
+        m_frame_size = pSemantic->Width * pSemantic->Height * sizeof(PixelSemantic);
+        m_width = pSemantic->Width;
+        m_height = pSemantic->Height;
+        format = REC_SEMANTIC;
+    } else {
+        InvalidFilterGraphBufferTypeMismatch(pSensor);
+    }
+
+    if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
+        m_cuda_stream = pOpx->GetCudaStream();
+    }
+
+    // Create any missing directories on the path to the container file
+    std::vector<std::string> split_string;
+    std::istringstream istring(m_path);
+    std::string substring;
+    while (std::getline(istring, substring, '/')) {
+        split_string.push_back(substring);
+    }
+    std::string partial_path = "";
+    for (size_t i = 0; i + 1 < split_string.size(); i++) {
+        if (split_string[i] != "") {
+            partial_path += split_string[i] + "/";
+            if (!filesystem::path(partial_path).exists()) {
+                if (!filesystem::create_directory(filesystem::path(partial_path))) {
+                    std::cerr << "Could not create directory: " << partial_path << std::endl;
+                } else {
+                    std::cout << "Created directory for sensor data: " << partial_path << std::endl;
+                }
+            }
+        }
+    }
+
+    // Allocate the pinned staging ring
+    m_ring.resize(m_ring_frames);
+    m_copy_events.resize(m_ring_frames);
+    m_slot_busy.assign(m_ring_frames, false);
+    for (int i = 0; i < m_ring_frames; i++) {
+        std::shared_ptr<char[]> b(cudaHostMallocHelper<char>(m_frame_size), cudaHostFreeHelper<char>);
+        m_ring[i] = std::move(b);
+        cudaEventCreateWithFlags(&m_copy_events[i], cudaEventDisableTiming);
+    }
+
+    // Open the container file and write its header
+    m_file.open(m_path, std::ios::out | std::ios::binary);
+    if (!m_file.is_open()) {
+        std::cerr << "Could not open recording file: " << m_path << std::endl;
+        return;
+    }
+    uint64_t frame_size = (uint64_t)m_frame_size;
+    m_file.write(REC_MAGIC, 8);
+    m_file.write((const char*)&REC_VERSION, sizeof(uint32_t));
+    m_file.write((const char*)&format, sizeof(uint32_t));
+    m_file.write((const char*)&m_width, sizeof(uint32_t));
+    m_file.write((const char*)&m_height, sizeof(uint32_t));
+    m_file.write((const char*)&frame_size, sizeof(uint64_t));
+
+    m_writer = std::thread(&ChFilterRecord::WriterLoop, this);
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,102 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+//
+// =============================================================================
+
+#ifndef CHFILTERRECORD_H
+#define CHFILTERRECORD_H
+
+#include "chrono_sensor/filters/ChFilter.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+namespace chrono {
+namespace sensor {
+
+// forward declaration
+class ChSensor;
+
+/// @addtogroup sensor_filters
+/// @{
+
+/// A filter that, when applied to a sensor, records raw frames into a single indexed container file.
+/// Frames are copied asynchronously from the device into a ring of pinned host buffers and persisted by a
+/// background writer thread, so the filter graph is not stalled by disk I/O; Apply() blocks only when every
+/// ring slot is still in flight. The container holds a fixed-size header (format, resolution, bytes per
+/// frame), the raw frames, and a trailing index of (frame number, byte offset) pairs written on destruction.
+class CH_SENSOR_API ChFilterRecord : public ChFilter {
+  public:
+    /// Class constructor
+    /// @param file_path The container file to record into
+    /// @param ring_frames Number of pinned staging frames in the ring
+    /// @param name the name of the filter
+    ChFilterRecord(std::string file_path, int ring_frames = 8, std::string name = "ChFilterRecord");
+
+    /// Class destructor. Drains the ring, writes the frame index and closes the container file.
+    virtual ~ChFilterRecord();
+
+    /// Apply function. Enqueues the current frame for recording.
+    virtual void Apply();
+
+    /// Initializes all data needed by the filter access apply function.
+    /// @param pSensor A pointer to the sensor on which the filter is attached.
+    /// @param bufferInOut A buffer that is passed into the filter.
+    virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
+
+  private:
+    /// Background loop persisting completed frames in submission order.
+    void WriterLoop();
+
+    std::string m_path;               ///< container file to record into
+    unsigned int m_frame_number = 0;  ///< running frame counter
+
+    size_t m_frame_size = 0;    ///< bytes per frame
+    unsigned int m_width = 0;   ///< frame width
+    unsigned int m_height = 0;  ///< frame height
+
+    std::shared_ptr<SensorDeviceRGBA8Buffer> m_rgba8_in;       ///< input buffer for rgba8 image
+    std::shared_ptr<SensorDeviceR8Buffer> m_r8_in;             ///< input buffer for r8 image
+    std::shared_ptr<SensorDeviceSemanticBuffer> m_semantic_in;  ///< input buffer for semantic image
+
+    int m_ring_frames;                                 ///< number of staging slots in the ring
+    std::vector<std::shared_ptr<char[]>> m_ring;       ///< pinned staging frames
+    std::vector<cudaEvent_t> m_copy_events;            ///< per-slot event marking copy completion
+    std::vector<bool> m_slot_busy;                     ///< per-slot in-flight flag
+    std::deque<std::pair<int, unsigned int>> m_queue;  ///< (slot, frame number) pending persistence
+
+    std::ofstream m_file;                               ///< container file stream
+    std::vector<std::pair<uint32_t, uint64_t>> m_index;  ///< (frame number, byte offset) of written frames
+
+    std::thread m_writer;              ///< background writer thread
+    std::mutex m_mutex;                ///< protects the queue and slot flags
+    std::condition_variable m_cv;      ///< signals queued frames and freed slots
+    bool m_stop = false;               ///< writer shutdown flag
+
+    CUstream m_cuda_stream;  ///< reference to the cuda stream
+};
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -42,15 +42,21 @@ CH_SENSOR_API void ChFilterOptixRender::Apply() {
     m_bufferOut->LaunchedCount = pOptixSensor->GetNumLaunches();
     m_bufferOut->TimeStamp = m_time_stamp;
 
-    cudaMemcpyAsync(reinterpret_cast<void*>(m_optix_sbt->raygenRecord), m_raygen_record.get(),
-                    sizeof(Record<RaygenParameters>), cudaMemcpyHostToDevice, m_cuda_stream);
-
-    OPTIX_ERROR_CHECK(optixLaunch(m_optix_pipeline, m_cuda_stream, reinterpret_cast<CUdeviceptr>(m_optix_params),
-                                  sizeof(ContextParameters), m_optix_sbt.get(),
-                                  m_bufferOut->Width,   // launch width
-                                  m_bufferOut->Height,  // launch height
-                                  1                     // launch depth
-                                  ));
+    if (m_batch_prelaunched) {
+        // this sensor was rendered as a slice of a batched launch issued by the engine; its stream already waits on
+        // that launch, so only the downstream filters need to run
+        m_batch_prelaunched = false;
+    } else {
+        cudaMemcpyAsync(reinterpret_cast<void*>(m_optix_sbt->raygenRecord), m_raygen_record.get(),
+                        sizeof(Record<RaygenParameters>), cudaMemcpyHostToDevice, m_cuda_stream);
+
+        OPTIX_ERROR_CHECK(optixLaunch(m_optix_pipeline, m_cuda_stream, reinterpret_cast<CUdeviceptr>(m_optix_params),
+                                      sizeof(ContextParameters), m_optix_sbt.get(),
+                                      m_bufferOut->Width,   // launch width
+                                      m_bufferOut->Height,  // launch height
+                                      1                     // launch depth
+                                      ));
+    }
 
     // run the denoiser if it has been created
     if (m_denoiser) {
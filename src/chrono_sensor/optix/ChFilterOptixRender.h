@@ -95,6 +95,8 @@ class CH_SENSOR_API ChFilterOptixRender : public ChFilter {
     std::shared_ptr<OptixShaderBindingTable> m_optix_sbt;
     std::shared_ptr<Record<RaygenParameters>> m_raygen_record;  ///< ray generation record
     float m_time_stamp;                                         ///< time stamp for when the data (render) was launched
+    bool m_batch_prelaunched = false;  ///< set by the engine when this sensor was rendered as a slice of a batched
+                                       ///< launch, in which case the filter skips its own launch for that frame
 
     friend class ChOptixEngine;  ///< ChOptixEngine is allowed to set and use the private members
 };
@@ -89,6 +89,9 @@ struct LensParams{
     float a8;
 };
 
+// forward declaration so that batched launches can reference per-slice sensor parameters
+struct RaygenParameters;
+
 /// The parameters needed to define a camera
 struct CameraParameters {
     float hFOV;                        ///< horizontal field of view
@@ -103,6 +106,8 @@ struct CameraParameters {
     half4* normal_buffer;  ///< The screen-space normal of the first hit. Only initialized if using global illumination
                            ///< (screenspace normal)
     curandState_t* rng_buffer;  ///< The random number generator object. Only initialized if using global illumination
+    RaygenParameters* batch_params;  ///< per-slice sensor parameters when multiple sensors share one launch (only
+                                     ///< dereferenced when the launch depth is greater than 1)
 };
 
 /// Parameters need to define a camera that generates semantic segmentation data
@@ -112,6 +117,8 @@ struct SemanticCameraParameters {
     LensParams lens_parameters;          ///< lens fitting parameters (if applicable)
     ushort2* frame_buffer;           ///< buffer of class and instance ids
     curandState_t* rng_buffer;       ///< only initialized if using global illumination
+    RaygenParameters* batch_params;  ///< per-slice sensor parameters when multiple sensors share one launch (only
+                                     ///< dereferenced when the launch depth is greater than 1)
 };
 
 /// The shape of a lidar beam
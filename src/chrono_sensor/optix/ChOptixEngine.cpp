@@ -66,6 +66,13 @@ ChOptixEngine::~ChOptixEngine() {
     cudaDeviceSynchronize();
     m_geometry->Cleanup();
     m_pipeline->Cleanup();
+    // cleanup batched launch bookkeeping
+    if (md_batch_params) {
+        cudaFree(reinterpret_cast<void*>(md_batch_params));
+    }
+    for (auto e : m_batch_events) {
+        cudaEventDestroy(e);
+    }
     // cleanup lights
     cudaFree(reinterpret_cast<void*>(md_params));
     // cleanup device context parameters
@@ -173,6 +180,12 @@ void ChOptixEngine::UpdateSensors(std::shared_ptr<ChScene> scene) {
     if (!m_params.root) {
         ConstructScene();
     }
+
+    // collect this step's modified-vertex lists (published e.g. by SCM terrain) so that deformable meshes can be
+    // updated incrementally at the next render frame; these lists are per-step and would be lost if only sampled
+    // when sensors are actually updated
+    m_pipeline->AccumulateDeformableUpdates();
+
     std::vector<int> to_be_updated;
     std::vector<int> to_be_waited_on;
 
@@ -206,7 +219,9 @@ void ChOptixEngine::UpdateSensors(std::shared_ptr<ChScene> scene) {
                 m_sceneThread.cv.wait(lck);
             }
             // m_sceneThread.cv.wait(lck);  // wait for the scene thread to tell us it is done
-            cudaDeviceSynchronize();  // TODO: do we need to synchronize here?
+            // No device-wide synchronization is needed here: every render thread synchronizes its sensor's stream
+            // before signaling completion, and the scene thread waits on all render threads it launched. A
+            // cudaDeviceSynchronize at this point would only stall the filter graphs of sensors not in this batch.
 
             // update the scene for the optix context
             UpdateCameraTransforms(to_be_updated, scene);
@@ -367,6 +382,107 @@ void ChOptixEngine::RenderProcess(RenderThread& tself, std::shared_ptr<ChOptixSe
     }
 }
 
+void ChOptixEngine::LaunchBatchedSensors() {
+    // group the queued sensors by pipeline type and resolution. Only camera and segmentation pipelines can share a
+    // launch (the lidar and radar raygen programs have per-sensor launch shapes) and sensors with a denoiser keep
+    // their own launch since the denoiser runs in their filter graph
+    std::vector<std::vector<unsigned int>> batches;
+    for (auto i : m_renderQueue) {
+        auto sensor = m_assignedSensor[i];
+        PipelineType type = sensor->GetPipelineType();
+        if (type != PipelineType::CAMERA && type != PipelineType::SEGMENTATION)
+            continue;
+        if (m_assignedRenderers[i]->m_denoiser)
+            continue;
+        bool added = false;
+        for (auto& batch : batches) {
+            auto lead = m_assignedSensor[batch[0]];
+            if (lead->GetPipelineType() == type && lead->GetWidth() == sensor->GetWidth() &&
+                lead->GetHeight() == sensor->GetHeight()) {
+                batch.push_back(i);
+                added = true;
+                break;
+            }
+        }
+        if (!added) {
+            batches.push_back(std::vector<unsigned int>(1, i));
+        }
+    }
+
+    // size the per-slice parameter array for all batches with more than one sensor
+    unsigned int total_slices = 0;
+    for (auto& batch : batches) {
+        if (batch.size() > 1)
+            total_slices += static_cast<unsigned int>(batch.size());
+    }
+    if (total_slices == 0)
+        return;
+    if (m_batch_params_capacity < total_slices) {
+        if (md_batch_params) {
+            cudaFree(reinterpret_cast<void*>(md_batch_params));
+        }
+        CUDA_ERROR_CHECK(
+            cudaMalloc(reinterpret_cast<void**>(&md_batch_params), sizeof(RaygenParameters) * total_slices));
+        m_batch_params_capacity = total_slices;
+    }
+    // staging must not reallocate while uploads are in flight
+    m_batch_staging.clear();
+    m_batch_staging.reserve(total_slices);
+
+    unsigned int offset = 0;
+    unsigned int batch_id = 0;
+    for (auto& batch : batches) {
+        if (batch.size() < 2)
+            continue;
+
+        auto leader = m_assignedRenderers[batch[0]];
+        CUstream stream = m_assignedSensor[batch[0]]->GetCudaStream();
+        PipelineType type = m_assignedSensor[batch[0]]->GetPipelineType();
+
+        // pack and upload this batch's per-slice raygen parameters
+        for (auto i : batch) {
+            m_batch_staging.push_back(m_assignedRenderers[i]->m_raygen_record->data);
+        }
+        RaygenParameters* d_slices = reinterpret_cast<RaygenParameters*>(md_batch_params) + offset;
+        cudaMemcpyAsync(d_slices, &m_batch_staging[offset], sizeof(RaygenParameters) * batch.size(),
+                        cudaMemcpyHostToDevice, stream);
+
+        // point the leader's record at the slice array and launch once for the whole batch
+        if (type == PipelineType::CAMERA) {
+            leader->m_raygen_record->data.specific.camera.batch_params = d_slices;
+        } else {
+            leader->m_raygen_record->data.specific.segmentation.batch_params = d_slices;
+        }
+        cudaMemcpyAsync(reinterpret_cast<void*>(leader->m_optix_sbt->raygenRecord), leader->m_raygen_record.get(),
+                        sizeof(Record<RaygenParameters>), cudaMemcpyHostToDevice, stream);
+        OPTIX_ERROR_CHECK(optixLaunch(leader->m_optix_pipeline, stream,
+                                      reinterpret_cast<CUdeviceptr>(leader->m_optix_params), sizeof(ContextParameters),
+                                      leader->m_optix_sbt.get(),
+                                      m_assignedSensor[batch[0]]->GetWidth(),   // launch width
+                                      m_assignedSensor[batch[0]]->GetHeight(),  // launch height
+                                      static_cast<unsigned int>(batch.size())   // one depth slice per sensor
+                                      ));
+
+        // make the follower streams wait on the shared launch so their filter graphs read complete frames; the
+        // render filters themselves then skip their own launch this frame
+        if (batch_id >= m_batch_events.size()) {
+            cudaEvent_t e;
+            cudaEventCreateWithFlags(&e, cudaEventDisableTiming);
+            m_batch_events.push_back(e);
+        }
+        cudaEventRecord(m_batch_events[batch_id], stream);
+        for (auto i : batch) {
+            m_assignedRenderers[i]->m_batch_prelaunched = true;
+            if (i != batch[0]) {
+                cudaStreamWaitEvent(m_assignedSensor[i]->GetCudaStream(), m_batch_events[batch_id], 0);
+            }
+        }
+
+        offset += static_cast<unsigned int>(batch.size());
+        batch_id++;
+    }
+}
+
 void ChOptixEngine::SceneProcess(RenderThread& tself) {
     // continually loop and perform two functions: add filters from sensor to job queue, empty the job queue
 
@@ -390,6 +506,10 @@ void ChOptixEngine::SceneProcess(RenderThread& tself) {
             std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
             std::chrono::duration<double> wall_time =
                 std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+
+            // issue shared launches for sensors that can be batched before waking the render threads
+            LaunchBatchedSensors();
+
             // launch the render threads
             for (auto i : m_renderQueue) {
                 m_renderThreads[i].done = false;
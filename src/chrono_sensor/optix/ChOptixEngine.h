@@ -123,6 +123,11 @@ class CH_SENSOR_API ChOptixEngine {
     void UpdateSceneDescription(
         std::shared_ptr<ChScene> scene);  ///< updates the scene characteristics such as lights, background, etc
 
+    /// Issues a single 3D launch for each group of queued camera/segmentation sensors that share a pipeline type and
+    /// resolution, with one z-slice per sensor. The corresponding render filters then skip their own launch and their
+    /// streams are synchronized on the shared one, so the rest of each filter graph still runs concurrently.
+    void LaunchBatchedSensors();
+
     /// Creates an optix box visualization object from a Chrono box shape
     void boxVisualization(std::shared_ptr<ChBody> body,
                           std::shared_ptr<ChBoxShape> box_shape,
@@ -158,6 +163,12 @@ class CH_SENSOR_API ChOptixEngine {
 
     CUdeviceptr md_lights;  ///< lights on the gpu
 
+    // batched launch bookkeeping
+    CUdeviceptr md_batch_params = {};                 ///< device array of per-slice raygen parameters
+    unsigned int m_batch_params_capacity = 0;         ///< allocated capacity of the per-slice parameter array
+    std::vector<RaygenParameters> m_batch_staging;    ///< host staging for the per-slice parameters
+    std::vector<cudaEvent_t> m_batch_events;          ///< one event per batch, grown as needed
+
     // information that belongs to the rendering concept of this engine
     OptixDeviceContext m_context;  ///< the optix context we use for everything
     ContextParameters m_params;
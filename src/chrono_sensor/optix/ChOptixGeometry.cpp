@@ -83,12 +83,15 @@ void ChOptixGeometry::Cleanup() {
     m_obj_body_frames_start.clear();
     m_obj_body_frames_end.clear();
     m_bodies.clear();
+    m_obj_static.clear();
+    m_static_transforms_packed = false;
 
     // clear out our list of known meshes
     m_known_meshes.clear();
 
     // clear our deformable meshes
     m_deformable_meshes.clear();
+    m_deformable_mesh_sizes.clear();
 
     // clear out index buffers
     m_obj_mat_ids.clear();
@@ -104,6 +107,8 @@ void ChOptixGeometry::AddGenericObject(unsigned int mat_id,
     m_bodies.push_back(body);
     m_obj_body_frames_start.push_back(body->GetFrame_REF_to_abs());
     m_obj_body_frames_end.push_back(body->GetFrame_REF_to_abs());
+    m_obj_static.push_back(body->GetBodyFixed());
+    m_static_transforms_packed = false;
 
     // create the motion transform for this box
     m_motion_transforms.emplace_back();
@@ -404,6 +409,9 @@ void ChOptixGeometry::AddDeformableMesh(CUdeviceptr d_vertices,
     unsigned int mesh_gas_id = BuildTrianglesGAS(mesh_shape, d_vertices, d_indices, false);
     AddGenericObject(mat_id, body, asset_frame, scale, m_gas_handles[mesh_gas_id]);
     m_deformable_meshes.push_back(std::make_tuple(mesh_shape, d_vertices, d_indices, mesh_gas_id));
+    m_deformable_mesh_sizes.push_back(
+        std::make_tuple(static_cast<unsigned int>(mesh_shape->GetMesh()->getCoordsVertices().size()),
+                        static_cast<unsigned int>(mesh_shape->GetMesh()->getIndicesVertexes().size())));
 }
 
 void ChOptixGeometry::UpdateDeformableMeshes() {
@@ -413,8 +421,15 @@ void ChOptixGeometry::UpdateDeformableMeshes() {
         CUdeviceptr d_indices = std::get<2>(m_deformable_meshes[i]);
         unsigned int gas_id = std::get<3>(m_deformable_meshes[i]);
 
-        // perform a rebuild of the triange acceleration structure
-        BuildTrianglesGAS(mesh_shape, d_vertices, d_indices, false, true, gas_id);
+        // refit the triangle acceleration structure in place when the mesh topology is unchanged (the common case
+        // for deformable terrain, where only vertex positions move), falling back to a full rebuild otherwise
+        auto mesh = mesh_shape->GetMesh();
+        unsigned int num_vertices = static_cast<unsigned int>(mesh->getCoordsVertices().size());
+        unsigned int num_triangles = static_cast<unsigned int>(mesh->getIndicesVertexes().size());
+        bool refit = num_vertices == std::get<0>(m_deformable_mesh_sizes[i]) &&
+                     num_triangles == std::get<1>(m_deformable_mesh_sizes[i]);
+        BuildTrianglesGAS(mesh_shape, d_vertices, d_indices, false, true, gas_id, refit);
+        m_deformable_mesh_sizes[i] = std::make_tuple(num_vertices, num_triangles);
     }
 }
 
@@ -423,13 +438,18 @@ unsigned int ChOptixGeometry::BuildTrianglesGAS(std::shared_ptr<ChTriangleMeshSh
                                                 CUdeviceptr d_indices,
                                                 bool compact_no_update,
                                                 bool rebuild,
-                                                unsigned int gas_id) {
+                                                unsigned int gas_id,
+                                                bool refit) {
     auto mesh = mesh_shape->GetMesh();
 
     OptixAccelBuildOptions accel_options = {OPTIX_BUILD_FLAG_ALLOW_COMPACTION, OPTIX_BUILD_OPERATION_BUILD};
     if (!compact_no_update) {
         accel_options.buildFlags = OPTIX_BUILD_FLAG_ALLOW_UPDATE;
         // accel_options.buildFlags = OPTIX_BUILD_FLAG_NONE;
+        if (rebuild && refit) {
+            // refit the existing structure from the new vertex positions rather than building from scratch
+            accel_options.operation = OPTIX_BUILD_OPERATION_UPDATE;
+        }
     }
 
     // uint32_t triangle_flags[] = {OPTIX_GEOMETRY_FLAG_NONE};
@@ -460,8 +480,10 @@ unsigned int ChOptixGeometry::BuildTrianglesGAS(std::shared_ptr<ChTriangleMeshSh
     OPTIX_ERROR_CHECK(optixAccelComputeMemoryUsage(m_context, &accel_options, &mesh_input,
                                                    1,  // num_build_inputs
                                                    &gas_buffer_sizes));
+    size_t temp_size = accel_options.operation == OPTIX_BUILD_OPERATION_UPDATE ? gas_buffer_sizes.tempUpdateSizeInBytes
+                                                                               : gas_buffer_sizes.tempSizeInBytes;
     CUdeviceptr d_temp_buffer_gas;
-    CUDA_ERROR_CHECK(cudaMalloc(reinterpret_cast<void**>(&d_temp_buffer_gas), gas_buffer_sizes.tempSizeInBytes));
+    CUDA_ERROR_CHECK(cudaMalloc(reinterpret_cast<void**>(&d_temp_buffer_gas), temp_size));
 
     unsigned int mesh_gas_id = gas_id;
     if (!rebuild) {
@@ -509,8 +531,8 @@ unsigned int ChOptixGeometry::BuildTrianglesGAS(std::shared_ptr<ChTriangleMeshSh
                 cudaMalloc(reinterpret_cast<void**>(&m_gas_buffers[mesh_gas_id]), gas_buffer_sizes.outputSizeInBytes));
         }
         OPTIX_ERROR_CHECK(optixAccelBuild(m_context, 0, &accel_options, &mesh_input, 1, d_temp_buffer_gas,
-                                          gas_buffer_sizes.tempSizeInBytes, m_gas_buffers[mesh_gas_id],
-                                          gas_buffer_sizes.outputSizeInBytes, &m_gas_handles[mesh_gas_id], nullptr, 0));
+                                          temp_size, m_gas_buffers[mesh_gas_id], gas_buffer_sizes.outputSizeInBytes,
+                                          &m_gas_handles[mesh_gas_id], nullptr, 0));
         CUDA_ERROR_CHECK(cudaFree(reinterpret_cast<void**>(d_temp_buffer_gas)));
     }
 
@@ -606,6 +628,11 @@ void ChOptixGeometry::RebuildRootStructure() {
                      : m_end_time + 1e-2;  // need to ensure start time is at least slightly after end time
 
     for (int i = 0; i < m_motion_transforms.size(); i++) {
+        // objects on fixed bodies do not move, so their transforms only need to be packed once. Since both of their
+        // keyframes hold the same pose, the stale motion time range on their transform is inconsequential
+        if (m_obj_static[i] && m_static_transforms_packed)
+            continue;
+
         // update the motion transforms
         const ChFrame<double> f_start = m_obj_body_frames_start[i] * m_obj_asset_frames[i];
         const ChVector<double> pos_start = f_start.GetPos() - m_origin_offset;
@@ -620,6 +647,7 @@ void ChOptixGeometry::RebuildRootStructure() {
         GetT3x4FromSRT(m_obj_scales[i], rot_mat_start, pos_start, m_motion_transforms[i].transform[0]);
         GetT3x4FromSRT(m_obj_scales[i], rot_mat_end, pos_end, m_motion_transforms[i].transform[1]);
     }
+    m_static_transforms_packed = true;
 
     CUDA_ERROR_CHECK(cudaMemcpy(reinterpret_cast<void*>(md_motion_transforms), m_motion_transforms.data(),
                                 m_motion_transforms.size() * sizeof(OptixMatrixMotionTransform),
@@ -631,24 +659,22 @@ void ChOptixGeometry::RebuildRootStructure() {
     instance_input.instanceArray.numInstances = static_cast<unsigned int>(m_instances.size());
     OptixAccelBuildOptions accel_options = {};
     accel_options.buildFlags = OPTIX_BUILD_FLAG_PREFER_FAST_TRACE;  // | OPTIX_BUILD_FLAG_ALLOW_UPDATE;
+    // NOTE: the instance structure cannot use OPTIX_BUILD_OPERATION_UPDATE since its motion time range changes
+    // every scene update and OptiX requires motion options to be identical between a build and a refit
     accel_options.operation = OPTIX_BUILD_OPERATION_BUILD;
 
     accel_options.motionOptions.numKeys = 2;
     accel_options.motionOptions.timeBegin = m_start_time;
     accel_options.motionOptions.timeEnd = m_end_time;
     accel_options.motionOptions.flags = OPTIX_MOTION_FLAG_NONE;
-    // accel_options.operation = OPTIX_BUILD_OPERATION_UPDATE;
 
-    OptixAccelBufferSizes ias_buffer_sizes;
-    OPTIX_ERROR_CHECK(optixAccelComputeMemoryUsage(m_context, &accel_options, &instance_input,
-                                                   1,  // num build inputs
-                                                   &ias_buffer_sizes));
+    // reuse the buffers sized in CreateRootStructure (instance count and motion keys are unchanged)
     OPTIX_ERROR_CHECK(optixAccelBuild(m_context,
                                       0,  // CUDA stream
                                       &accel_options, &instance_input,
                                       1,  // num build inputs
-                                      md_root_temp_buffer, ias_buffer_sizes.tempSizeInBytes, md_root_output_buffer,
-                                      ias_buffer_sizes.outputSizeInBytes, &m_root,
+                                      md_root_temp_buffer, md_root_temp_buffer_size, md_root_output_buffer,
+                                      md_root_output_buffer_size, &m_root,
                                       nullptr,  // emitted property list
                                       0         // num emitted properties
                                       ));
@@ -149,12 +149,15 @@ class CH_SENSOR_API ChOptixGeometry {
     /// @param compact_no_update if the GAS should be made without updating, and with compaction
     /// @param rebuild whether this is a rebuild, or a first build
     /// @param gas_id the id of the GAS is it has already been made (in case of rebuild)
+    /// @param refit whether the existing GAS should be refit in place rather than rebuilt from scratch. Only valid on a
+    /// rebuild of a GAS first built with compact_no_update=false and whose primitive counts have not changed.
     unsigned int BuildTrianglesGAS(std::shared_ptr<ChTriangleMeshShape> mesh_shape,
                                    CUdeviceptr d_vertices,
                                    CUdeviceptr d_indices,
                                    bool compact_no_update = true,
                                    bool rebuild = false,
-                                   unsigned int gas_id = 0);
+                                   unsigned int gas_id = 0,
+                                   bool refit = false);
 
     /// Function ot convert scale, rotation, translation to top 3 rows of transform matrix
     /// @param[in] s the scale vector
@@ -211,6 +214,8 @@ class CH_SENSOR_API ChOptixGeometry {
     std::vector<ChFrame<double>> m_obj_body_frames_end;    ///< frame at time=end used for the geometry
     std::vector<ChFrame<double>> m_obj_asset_frames;       ///< constant frame used for the geometry
     std::vector<ChVector<double>> m_obj_scales;  ///< asset frame scales since ChFrame makes the Amatrix orthonormal
+    std::vector<bool> m_obj_static;  ///< whether the object sits on a fixed body so its pose can be packed once
+    bool m_static_transforms_packed = false;  ///< whether the fixed-body motion transforms have been packed
     ChVector<float> m_origin_offset;             ///< origin offset for the scene
 
     std::vector<std::tuple<float, float, std::vector<ChFrame<double>>>>
@@ -224,6 +229,10 @@ class CH_SENSOR_API ChOptixGeometry {
     std::vector<std::tuple<std::shared_ptr<ChTriangleMeshShape>, CUdeviceptr, CUdeviceptr, unsigned int>>
         m_deformable_meshes;
 
+    /// vertex and triangle counts of each deformable mesh at its last full build, used to detect topology changes
+    /// that invalidate a refit of the corresponding acceleration structure
+    std::vector<std::tuple<unsigned int, unsigned int>> m_deformable_mesh_sizes;
+
     float m_start_time;  ///< time corresponding to start frame
     float m_end_time;    ///< time corresponding to end frame
 };
@@ -17,6 +17,9 @@
 
 #include "chrono_sensor/optix/ChOptixPipeline.h"
 #include "chrono_sensor/optix/ChOptixUtils.h"
+#include "chrono_sensor/cuda/mesh_update.cuh"
+
+#include <algorithm>
 
 #include "chrono/core/ChGlobal.h"
 #include "chrono_thirdparty/filesystem/path.h"
@@ -200,8 +203,19 @@ void ChOptixPipeline::CleanMaterials() {
     m_mesh_buffers_dptrs.clear();
     m_mesh_pool.clear();
     m_known_meshes.clear();
-    // clear our deformable meshes
+    // clear our deformable meshes and their partial-update bookkeeping
     m_deformable_meshes.clear();
+    m_deformable_dirty.clear();
+    m_deformable_incremental.clear();
+    for (int i = 0; i < m_deformable_staging.size(); i++) {
+        if (std::get<0>(m_deformable_staging[i])) {
+            CUDA_ERROR_CHECK(cudaFree(reinterpret_cast<void*>(std::get<0>(m_deformable_staging[i]))));
+        }
+        if (std::get<1>(m_deformable_staging[i])) {
+            CUDA_ERROR_CHECK(cudaFree(reinterpret_cast<void*>(std::get<1>(m_deformable_staging[i]))));
+        }
+    }
+    m_deformable_staging.clear();
 
     // reset material pool
     if (md_material_pool) {
@@ -420,6 +434,7 @@ void ChOptixPipeline::SpawnPipeline(PipelineType type) {
             raygen_record->data.specific.camera.gamma = 2.2f;          // default value
             raygen_record->data.specific.camera.lens_model = PINHOLE;  // default value
             raygen_record->data.specific.camera.lens_parameters = {};
+            raygen_record->data.specific.camera.batch_params = nullptr;  // default value
             break;
         }
 
@@ -441,6 +456,7 @@ void ChOptixPipeline::SpawnPipeline(PipelineType type) {
             raygen_record->data.specific.segmentation.frame_buffer = {};  // default value
             raygen_record->data.specific.segmentation.lens_model = PINHOLE;     // default value
             raygen_record->data.specific.segmentation.lens_parameters = {};
+            raygen_record->data.specific.segmentation.batch_params = nullptr;  // default value
             break;
         }
 
@@ -990,10 +1006,25 @@ unsigned int ChOptixPipeline::GetDeformableMeshMaterial(CUdeviceptr& d_vertices,
     CUdeviceptr d_normals = reinterpret_cast<CUdeviceptr>(m_mesh_pool[mesh_id].normal_buffer);
     unsigned int num_triangles = static_cast<unsigned int>(mesh_shape->GetMesh()->getIndicesVertexes().size());
     m_deformable_meshes.push_back(std::make_tuple(mesh_shape, d_vertices, d_normals, num_triangles));
+    m_deformable_dirty.push_back(std::vector<int>());
+    m_deformable_incremental.push_back(false);
+    m_deformable_staging.push_back(std::make_tuple(CUdeviceptr{}, CUdeviceptr{}, 0));
 
     return mat_id;
 }
 
+void ChOptixPipeline::AccumulateDeformableUpdates() {
+    for (int i = 0; i < m_deformable_meshes.size(); i++) {
+        // note: the modified-vertex list is also consumed by other visualization systems, so it must not be cleared
+        // here. Duplicate indices accumulated over multiple steps are removed at upload time.
+        const std::vector<int>& modified = std::get<0>(m_deformable_meshes[i])->GetModifiedVertices();
+        if (modified.size() > 0) {
+            m_deformable_incremental[i] = true;
+            m_deformable_dirty[i].insert(m_deformable_dirty[i].end(), modified.begin(), modified.end());
+        }
+    }
+}
+
 void ChOptixPipeline::UpdateDeformableMeshes() {
     for (int i = 0; i < m_deformable_meshes.size(); i++) {
         std::shared_ptr<ChTriangleMeshShape> mesh_shape = std::get<0>(m_deformable_meshes[i]);
@@ -1008,6 +1039,71 @@ void ChOptixPipeline::UpdateDeformableMeshes() {
             throw std::runtime_error("Error: changing mesh size not supported by Chrono::Sensor");
         }
 
+        // meshes that publish modified-vertex lists (e.g. SCM terrain) only get the vertices that actually moved
+        // uploaded and scattered into the device buffers in place, feeding the in-place GAS refit
+        if (m_deformable_incremental[i]) {
+            std::vector<int>& dirty = m_deformable_dirty[i];
+            if (dirty.size() == 0)
+                continue;
+
+            // remove duplicates accumulated over the steps since the last render
+            std::sort(dirty.begin(), dirty.end());
+            dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+            unsigned int num_updates = static_cast<unsigned int>(dirty.size());
+
+            // grow the persistent staging buffers if needed
+            CUdeviceptr& d_values = std::get<0>(m_deformable_staging[i]);
+            CUdeviceptr& d_indices = std::get<1>(m_deformable_staging[i]);
+            unsigned int& capacity = std::get<2>(m_deformable_staging[i]);
+            if (capacity < num_updates) {
+                if (d_values) {
+                    CUDA_ERROR_CHECK(cudaFree(reinterpret_cast<void*>(d_values)));
+                }
+                if (d_indices) {
+                    CUDA_ERROR_CHECK(cudaFree(reinterpret_cast<void*>(d_indices)));
+                }
+                CUDA_ERROR_CHECK(cudaMalloc(reinterpret_cast<void**>(&d_values), sizeof(float4) * num_updates));
+                CUDA_ERROR_CHECK(cudaMalloc(reinterpret_cast<void**>(&d_indices), sizeof(int) * num_updates));
+                capacity = num_updates;
+            }
+
+            CUstream stream = 0;
+            CUDA_ERROR_CHECK(cudaMemcpy(reinterpret_cast<void*>(d_indices), dirty.data(), sizeof(int) * num_updates,
+                                        cudaMemcpyHostToDevice));
+
+            // scatter the modified vertex locations
+            std::vector<float4> value_buffer = std::vector<float4>(num_updates);
+            for (unsigned int j = 0; j < num_updates; j++) {
+                value_buffer[j] = make_float4((float)mesh->getCoordsVertices()[dirty[j]].x(),  //
+                                              (float)mesh->getCoordsVertices()[dirty[j]].y(),  //
+                                              (float)mesh->getCoordsVertices()[dirty[j]].z(),  //
+                                              0.f);                                            // padding for alignment
+            }
+            CUDA_ERROR_CHECK(cudaMemcpy(reinterpret_cast<void*>(d_values), value_buffer.data(),
+                                        sizeof(float4) * num_updates, cudaMemcpyHostToDevice));
+            cuda_mesh_update_scatter(reinterpret_cast<void*>(d_values), reinterpret_cast<void*>(d_indices),
+                                     reinterpret_cast<void*>(d_vertices), num_updates, stream);
+
+            // scatter the modified normals if normals exist (the synchronous memcpy below cannot start until the
+            // vertex scatter has completed, so the staging buffer can be reused immediately)
+            if (mesh->getCoordsNormals().size() > 0) {
+                for (unsigned int j = 0; j < num_updates; j++) {
+                    value_buffer[j] = make_float4((float)mesh->getCoordsNormals()[dirty[j]].x(),  //
+                                                  (float)mesh->getCoordsNormals()[dirty[j]].y(),  //
+                                                  (float)mesh->getCoordsNormals()[dirty[j]].z(),  //
+                                                  0.f);  // padding for alignment
+                }
+                CUDA_ERROR_CHECK(cudaMemcpy(reinterpret_cast<void*>(d_values), value_buffer.data(),
+                                            sizeof(float4) * num_updates, cudaMemcpyHostToDevice));
+                cuda_mesh_update_scatter(reinterpret_cast<void*>(d_values), reinterpret_cast<void*>(d_indices),
+                                         reinterpret_cast<void*>(d_normals), num_updates, stream);
+            }
+
+            CUDA_ERROR_CHECK(cudaStreamSynchronize(stream));
+            dirty.clear();
+            continue;
+        }
+
         // update all the vertex locations
 
         std::vector<float4> vertex_buffer = std::vector<float4>(mesh->getCoordsVertices().size());
@@ -1032,8 +1128,6 @@ void ChOptixPipeline::UpdateDeformableMeshes() {
             CUDA_ERROR_CHECK(cudaMemcpy(reinterpret_cast<void*>(d_normals), normal_buffer.data(),
                                         sizeof(float4) * normal_buffer.size(), cudaMemcpyHostToDevice));
         }
-
-        // TODO: for SCM terrain, make use of the list of modified vertices
     }
 }
 
@@ -116,6 +116,12 @@ class CH_SENSOR_API ChOptixPipeline {
     /// Function to update all the deformable meshes in the optix scene based on their chrono meshes
     void UpdateDeformableMeshes();
 
+    /// Function to collect the modified-vertex lists published by the chrono meshes (e.g. by SCM terrain) since the
+    /// last render. Must be called every simulation step since UpdateDeformableMeshes only runs at render frames; the
+    /// accumulated indices let UpdateDeformableMeshes upload only the vertices that actually moved instead of the
+    /// entire mesh.
+    void AccumulateDeformableUpdates();
+
     /// Function to update all the shader binding tables associated with this optix scene
     void UpdateAllSBTs();
 
@@ -256,6 +262,13 @@ class CH_SENSOR_API ChOptixPipeline {
     std::vector<std::tuple<std::shared_ptr<ChTriangleMeshShape>, CUdeviceptr, CUdeviceptr, unsigned int>>
         m_deformable_meshes;
 
+    /// accumulated modified-vertex indices per deformable mesh (duplicates removed at upload time)
+    std::vector<std::vector<int>> m_deformable_dirty;
+    /// whether each deformable mesh has ever published a modified-vertex list (enables the partial upload path)
+    std::vector<bool> m_deformable_incremental;
+    /// device staging buffers for partial updates <d_values, d_indices, capacity in entries>
+    std::vector<std::tuple<CUdeviceptr, CUdeviceptr, unsigned int>> m_deformable_staging;
+
     // default material in the material pool
     bool m_default_material_inst = false;
     unsigned int m_default_material_id;
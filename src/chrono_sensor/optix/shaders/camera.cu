@@ -47,12 +47,17 @@ __device__ __inline__ float radial_function(const float& rd2, const LensParams&
 /// Camera ray generation program using an FOV lens model
 extern "C" __global__ void __raygen__camera() {
     const RaygenParameters* raygen = (RaygenParameters*)optixGetSbtDataPointer();
-    const CameraParameters& camera = raygen->specific.camera;
 
     const uint3 idx = optixGetLaunchIndex();
     const uint3 screen = optixGetLaunchDimensions();
     const unsigned int image_index = screen.x * idx.y + idx.x;
 
+    // in a batched launch each z-slice renders one sensor from the per-slice parameter array
+    if (screen.z > 1) {
+        raygen = &raygen->specific.camera.batch_params[idx.z];
+    }
+    const CameraParameters& camera = raygen->specific.camera;
+
     float2 d =
         (make_float2(idx.x, idx.y) + make_float2(0.5, 0.5)) / make_float2(screen.x, screen.y) * 2.f - make_float2(1.f);
     d.y *= (float)(screen.y) / (float)(screen.x);  // correct for the aspect ratio
@@ -136,12 +141,17 @@ extern "C" __global__ void __raygen__camera() {
 /// Camera ray generation program using an FOV lens model
 extern "C" __global__ void __raygen__segmentation() {
     const RaygenParameters* raygen = (RaygenParameters*)optixGetSbtDataPointer();
-    const SemanticCameraParameters& camera = raygen->specific.segmentation;
 
     const uint3 idx = optixGetLaunchIndex();
     const uint3 screen = optixGetLaunchDimensions();
     const unsigned int image_index = screen.x * idx.y + idx.x;
 
+    // in a batched launch each z-slice renders one sensor from the per-slice parameter array
+    if (screen.z > 1) {
+        raygen = &raygen->specific.segmentation.batch_params[idx.z];
+    }
+    const SemanticCameraParameters& camera = raygen->specific.segmentation;
+
     float2 d =
         (make_float2(idx.x, idx.y) + make_float2(0.5, 0.5)) / make_float2(screen.x, screen.y) * 2.f - make_float2(1.f);
     d.y *= (float)(screen.y) / (float)(screen.x);  // correct for the aspect ratio
@@ -31,7 +31,9 @@ CH_SENSOR_API ChOptixSensor::ChOptixSensor(std::shared_ptr<chrono::ChBody> paren
                                            unsigned int h)
     : m_width(w), m_height(h), ChSensor(parent, updateRate, offsetPose) {
     // Camera sensor get rendered by Optix, so they must has as their first filter an optix renderer.
-    cudaStreamCreate(&m_cuda_stream);  // all gpu operations will happen on this stream
+    // All gpu operations for this sensor will happen on this stream. The stream is non-blocking so that the filter
+    // graphs of different sensors can execute concurrently instead of serializing through the legacy default stream.
+    cudaStreamCreateWithFlags(&m_cuda_stream, cudaStreamNonBlocking);
 
     // delayed creation of the optix render filter -> ChOptixEngine must do this to properly initialize the optix
     // parameters
@@ -18,6 +18,7 @@
 
 #include "chrono_sensor/sensors/ChSensor.h"
 #include "chrono_sensor/filters/ChFilterAccess.h"
+#include "chrono_sensor/filters/ChFilterImageFusion.h"
 #include "chrono/physics/ChSystem.h"
 #include <iostream>
 
@@ -53,6 +54,14 @@ CH_SENSOR_API void ChSensor::SetCollectionWindow(float t) {
     m_collection_window = ChClamp(t, 0.f, 1 / m_updateRate);
 }
 
+CH_SENSOR_API void ChSensor::LockFilterList() {
+    // fuse adjacent pointwise image filters before the list is frozen and initialized
+    if (!m_filter_list_locked) {
+        ChFilterImagePointwiseFused::ApplyFusionPass(m_filters);
+    }
+    m_filter_list_locked = true;
+}
+
 CH_SENSOR_API void ChSensor::PushFilter(std::shared_ptr<ChFilter> filter) {
     if (!m_filter_list_locked) {
         m_filters.push_back(filter);
@@ -98,6 +107,34 @@ CH_SENSOR_API UserDIBufferPtr ChSensor::GetMostRecentBuffer() {
     return GetMostRecentBufferHelper<UserDIBufferPtr, ChFilterDIAccess, ChFilterDIAccessName>();
 }
 
+// -----------------------------------------------------------------------------
+// retriever functions for device-resident data (buffers stay on the GPU)
+// -----------------------------------------------------------------------------
+template <>
+CH_SENSOR_API UserDeviceR8BufferPtr ChSensor::GetMostRecentBuffer() {
+    // call the templated helper function
+    return GetMostRecentBufferHelper<UserDeviceR8BufferPtr, ChFilterR8DeviceAccess, ChFilterR8DeviceAccessName>();
+}
+
+template <>
+CH_SENSOR_API UserDeviceRGBA8BufferPtr ChSensor::GetMostRecentBuffer() {
+    // call the templated helper function
+    return GetMostRecentBufferHelper<UserDeviceRGBA8BufferPtr, ChFilterRGBA8DeviceAccess,
+                                     ChFilterRGBA8DeviceAccessName>();
+}
+
+template <>
+CH_SENSOR_API UserDeviceDIBufferPtr ChSensor::GetMostRecentBuffer() {
+    // call the templated helper function
+    return GetMostRecentBufferHelper<UserDeviceDIBufferPtr, ChFilterDIDeviceAccess, ChFilterDIDeviceAccessName>();
+}
+
+template <>
+CH_SENSOR_API UserDeviceXYZIBufferPtr ChSensor::GetMostRecentBuffer() {
+    // call the templated helper function
+    return GetMostRecentBufferHelper<UserDeviceXYZIBufferPtr, ChFilterXYZIDeviceAccess, ChFilterXYZIDeviceAccessName>();
+}
+
 // -----------------------------------------------------------------------------
 // retriever function for point cloud data in XYZ-Intensity format
 // -----------------------------------------------------------------------------
@@ -47,6 +47,10 @@ const char ChFilterGPSAccessName[] = "ChFilterGPSAccess";        /// GPS data fo
 const char ChFilterRadarAccessName[] = "ChFilterRadarAccess";
 const char ChFilterRadarXYZAccessName[] = "ChFilterRadarXYZAccess";
 const char ChFilterTachometerAccessName[] = "ChFilterTachometerAccess";
+const char ChFilterR8DeviceAccessName[] = "ChFilterR8DeviceAccess";        /// device-resident 8 bit array
+const char ChFilterRGBA8DeviceAccessName[] = "ChFilterRGBA8DeviceAccess";  /// device-resident 4 channel 8 bit array
+const char ChFilterDIDeviceAccessName[] = "ChFilterDIDeviceAccess";        /// device-resident Depth+Intensity array
+const char ChFilterXYZIDeviceAccessName[] = "ChFilterXYZIDeviceAccess";    /// device-resident XYZ+Intensity array
 
 /// Base class for a chrono sensor. A specific sensor can inherit from here
 class CH_SENSOR_API ChSensor {
@@ -135,8 +139,9 @@ class CH_SENSOR_API ChSensor {
 
     /// Gives ability to lock the filter list to prevent race conditions. This is called automatically when the sensor
     /// is added to the ChSensor manager. This is needed to prevent changing of filters while a worker thread is
-    /// processing the filters. WARNING: this operation cannot be undone.
-    void LockFilterList() { m_filter_list_locked = true; }
+    /// processing the filters. Before locking, a fusion pass replaces runs of adjacent pointwise image filters with
+    /// single fused filters (see ChFilterImagePointwiseFused). WARNING: this operation cannot be undone.
+    void LockFilterList();
 
     /// Get the last filter in the list that matches the template type
     /// @return A shared pointer to a ChSensorBuffer of the templated type.
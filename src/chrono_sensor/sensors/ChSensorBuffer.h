@@ -132,6 +132,8 @@ using DeviceRGBA8BufferPtr = std::shared_ptr<PixelRGBA8[]>;
 using SensorDeviceRGBA8Buffer = SensorBufferT<DeviceRGBA8BufferPtr>;
 /// pointer to an RGBA image on the host that has been moved for safety and can be given to the user
 using UserRGBA8BufferPtr = std::shared_ptr<SensorHostRGBA8Buffer>;
+/// pointer to an RGBA image that stays resident on the device and can be given to the user without a host copy
+using UserDeviceRGBA8BufferPtr = std::shared_ptr<SensorDeviceRGBA8Buffer>;
 
 //===============================================
 // R8 (8-bit Grayscale) Camera Format and Buffers
@@ -145,6 +147,8 @@ using DeviceR8BufferPtr = std::shared_ptr<char[]>;
 using SensorDeviceR8Buffer = SensorBufferT<DeviceR8BufferPtr>;
 /// pointer to a greyscale image on the host that has been moved for safety and can be given to the user
 using UserR8BufferPtr = std::shared_ptr<SensorHostR8Buffer>;
+/// pointer to a greyscale image that stays resident on the device and can be given to the user without a host copy
+using UserDeviceR8BufferPtr = std::shared_ptr<SensorDeviceR8Buffer>;
 
 /// A pixel as defined for semantic segmentation
 struct PixelSemantic {
@@ -215,6 +219,23 @@ using DeviceDIBufferPtr = std::shared_ptr<PixelDI[]>;
 using SensorDeviceDIBuffer = LidarBufferT<DeviceDIBufferPtr>;
 /// pointer to a depth-intensity buffer on the host that has been moved for safety and can be given to the user
 using UserDIBufferPtr = std::shared_ptr<SensorHostDIBuffer>;
+/// pointer to a depth-intensity buffer that stays resident on the device and can be given to the user without a copy
+using UserDeviceDIBufferPtr = std::shared_ptr<SensorDeviceDIBuffer>;
+
+/// Depth and intensity data in half-precision format, halving the device-to-host transfer size of a lidar frame
+struct PixelHalfDI {
+    __half range;      ///< distance measurement of the lidar beam (half precision)
+    __half intensity;  ///< relative intensity of returned laser pulse (half precision)
+};
+/// Half-precision depth-intensity host buffer to be used by lidar filters in the graph
+using SensorHostHalfDIBuffer = LidarBufferT<std::shared_ptr<PixelHalfDI[]>>;
+/// Half-precision depth-intensity device buffer to be used by lidar filters in the graph
+using DeviceHalfDIBufferPtr = std::shared_ptr<PixelHalfDI[]>;
+/// Sensor buffer wrapper of a DeviceHalfDIBufferPtr
+using SensorDeviceHalfDIBuffer = LidarBufferT<DeviceHalfDIBufferPtr>;
+/// pointer to a half-precision depth-intensity buffer on the host that has been moved for safety and can be given to
+/// the user
+using UserHalfDIBufferPtr = std::shared_ptr<SensorHostHalfDIBuffer>;
 
 //===========================================
 // Point Cloud Lidar Data Formats and Buffers
@@ -235,6 +256,25 @@ using DeviceXYZIBufferPtr = std::shared_ptr<PixelXYZI[]>;
 using SensorDeviceXYZIBuffer = LidarBufferT<DeviceXYZIBufferPtr>;
 /// pointer to a point cloud buffer on the host that has been moved for safety and can be given to the user
 using UserXYZIBufferPtr = std::shared_ptr<SensorHostXYZIBuffer>;
+/// pointer to a point cloud buffer that stays resident on the device and can be given to the user without a copy
+using UserDeviceXYZIBufferPtr = std::shared_ptr<SensorDeviceXYZIBuffer>;
+
+/// Point cloud and intensity data in half-precision format, halving the device-to-host transfer size of a lidar frame
+struct PixelHalfXYZI {
+    __half x;          ///< x location of the point in space (half precision)
+    __half y;          ///< y location of the point in space (half precision)
+    __half z;          ///< z location of the point in space (half precision)
+    __half intensity;  ///< intensity of the reflection at the corresponding point (half precision)
+};
+/// Half-precision point cloud host buffer to be used by lidar filters in the graph
+using SensorHostHalfXYZIBuffer = LidarBufferT<std::shared_ptr<PixelHalfXYZI[]>>;
+/// Half-precision point cloud device buffer to be used by lidar filters in the graph
+using DeviceHalfXYZIBufferPtr = std::shared_ptr<PixelHalfXYZI[]>;
+/// Sensor buffer wrapper of a DeviceHalfXYZIBufferPtr
+using SensorDeviceHalfXYZIBuffer = LidarBufferT<DeviceHalfXYZIBufferPtr>;
+/// pointer to a half-precision point cloud buffer on the host that has been moved for safety and can be given to the
+/// user
+using UserHalfXYZIBufferPtr = std::shared_ptr<SensorHostHalfXYZIBuffer>;
 
 //=============================
 // IMU Data Format and Buffers
@@ -0,0 +1,75 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Minimal subset of the DLPack specification (https://github.com/dmlc/dlpack)
+// used to export device-resident sensor buffers to ML frameworks without a
+// copy. The declarations below are ABI-compatible with dlpack.h (v0.8) so a
+// DLManagedTensor produced here can be consumed directly by any framework
+// implementing the DLPack protocol. Guarded with the canonical include guard
+// so that a real dlpack.h, if present, takes precedence.
+//
+// =============================================================================
+
+#ifndef DLPACK_DLPACK_H_
+#define DLPACK_DLPACK_H_
+
+#include <cstdint>
+
+/// The device type in DLDevice.
+typedef enum {
+    kDLCPU = 1,         ///< CPU device
+    kDLCUDA = 2,        ///< CUDA GPU device
+    kDLCUDAHost = 3,    ///< pinned CUDA CPU memory accessible by both CPU and GPU
+    kDLCUDAManaged = 13 ///< CUDA managed/unified memory
+} DLDeviceType;
+
+/// A device for tensor and operator.
+typedef struct {
+    DLDeviceType device_type;  ///< the device type the tensor is stored on
+    int32_t device_id;         ///< the device index (e.g. CUDA device ordinal)
+} DLDevice;
+
+/// The type code options of DLDataType.
+typedef enum {
+    kDLInt = 0,    ///< signed integer
+    kDLUInt = 1,   ///< unsigned integer
+    kDLFloat = 2,  ///< IEEE floating point
+    kDLBfloat = 4  ///< bfloat16
+} DLDataTypeCode;
+
+/// The data type the tensor can hold.
+typedef struct {
+    uint8_t code;   ///< type code of the base type (DLDataTypeCode)
+    uint8_t bits;   ///< number of bits per lane
+    uint16_t lanes; ///< number of lanes in the type, used for vector types
+} DLDataType;
+
+/// Plain C tensor object, does not manage memory.
+typedef struct {
+    void* data;           ///< the data pointer, points to the allocated region
+    DLDevice device;      ///< the device of the tensor
+    int32_t ndim;         ///< number of dimensions
+    DLDataType dtype;     ///< the data type of the tensor
+    int64_t* shape;       ///< the shape of the tensor
+    int64_t* strides;     ///< strides in number of elements, NULL indicates compact row-major layout
+    uint64_t byte_offset; ///< offset in bytes to the beginning of the data
+} DLTensor;
+
+/// C tensor object that manages the memory of a DLTensor. The consumer must call the deleter (if not NULL)
+/// when it no longer needs the tensor.
+typedef struct DLManagedTensor {
+    DLTensor dl_tensor;                           ///< the tensor being managed
+    void* manager_ctx;                            ///< context of the producer that owns the underlying memory
+    void (*deleter)(struct DLManagedTensor* self);///< destructor the consumer calls to release the tensor
+} DLManagedTensor;
+
+#endif
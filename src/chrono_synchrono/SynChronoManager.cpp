@@ -4,6 +4,11 @@
 #include "chrono_synchrono/utils/SynLog.h"
 #include "chrono_synchrono/agent/SynAgentFactory.h"
 #include "chrono_synchrono/flatbuffer/message/SynSimulationMessage.h"
+#include "chrono_synchrono/flatbuffer/message/SynWheeledVehicleMessage.h"
+#include "chrono_synchrono/flatbuffer/message/SynTrackedVehicleMessage.h"
+#include "chrono_synchrono/flatbuffer/message/SynCopterMessage.h"
+
+#include <cmath>
 
 #ifdef CHRONO_FASTDDS
 #undef ALIVE
@@ -195,6 +200,15 @@ void SynChronoManager::Synchronize(double time) {
     // Only add the messages to the communicator which is responsible for commuticating with that node
     m_timer_msg_gather.start();
     SynMessageList messages = GatherMessages();
+
+    // Record the current position of each local agent for interest filtering of the received states
+    if (m_interest_radius > 0) {
+        ChVector<double> pos;
+        for (auto& message : messages)
+            if (GetMessagePosition(message, pos))
+                m_agent_positions[message->GetSourceKey()] = pos;
+    }
+
     m_communicator->AddOutgoingMessages(messages);
     m_timer_msg_gather.stop();
 
@@ -275,12 +289,55 @@ void SynChronoManager::ProcessReceivedMessages() {
             auto sim_msg = std::dynamic_pointer_cast<SynSimulationMessage>(message);
             m_is_ok = !(sim_msg->m_quit_sim);
         } else {
-            for (const auto& agent_pair : m_agents)
+            // When interest filtering is enabled, state messages are only handed to local agents within the
+            // interest radius of the sender. Messages without a pose are always distributed.
+            ChVector<double> pos;
+            bool filter = m_interest_radius > 0 && GetMessagePosition(message, pos);
+
+            for (const auto& agent_pair : m_agents) {
+                if (filter && !IsOfInterest(agent_pair.first, pos))
+                    continue;
                 m_messages[agent_pair.second].push_back(message);
+            }
         }
     }
 }
 
+bool SynChronoManager::GetMessagePosition(std::shared_ptr<SynMessage> message, ChVector<double>& pos) {
+    if (auto wv_state = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message)) {
+        pos = wv_state->chassis.GetFrame().GetPos();
+        return true;
+    }
+    if (auto tv_state = std::dynamic_pointer_cast<SynTrackedVehicleStateMessage>(message)) {
+        pos = tv_state->chassis.GetFrame().GetPos();
+        return true;
+    }
+    if (auto copter_state = std::dynamic_pointer_cast<SynCopterStateMessage>(message)) {
+        pos = copter_state->chassis.GetFrame().GetPos();
+        return true;
+    }
+    return false;
+}
+
+bool SynChronoManager::IsOfInterest(AgentKey agent_key, const ChVector<double>& pos) const {
+    auto it = m_agent_positions.find(agent_key);
+    if (it == m_agent_positions.end())
+        return true;  // position of the local agent is not (yet) known, so do not filter
+
+    // Coarse grid test: with cell size equal to the interest radius, two positions within the radius always
+    // fall in the same or an adjacent cell. A sender more than one cell away in any direction can therefore
+    // be rejected without computing the distance.
+    const ChVector<double>& agent_pos = it->second;
+    for (int i = 0; i < 3; i++) {
+        auto cell_msg = (long long)std::floor(pos[i] / m_interest_radius);
+        auto cell_agent = (long long)std::floor(agent_pos[i] / m_interest_radius);
+        if (cell_msg - cell_agent > 1 || cell_agent - cell_msg > 1)
+            return false;
+    }
+
+    return (agent_pos - pos).Length2() <= m_interest_radius * m_interest_radius;
+}
+
 void SynChronoManager::DistributeMessages() {
     for (auto& message_agent_pair : m_messages) {
         // For readibility
@@ -79,6 +79,21 @@ class SYN_API SynChronoManager {
     ///
     void SetHeartbeat(double heartbeat) { m_heartbeat = heartbeat; }
 
+    ///@brief Set the interest radius used for spatial filtering of state messages.
+    /// When set to a positive value, state messages are only distributed to local agents within the given
+    /// distance of the sending agent. Agents are compared through a grid with cell size equal to the radius,
+    /// so senders more than one cell away are rejected without a distance computation. Handover between
+    /// neighborhoods is automatic since cell membership is recomputed at every synchronization from the
+    /// exchanged states. A non-positive radius (the default) disables filtering and every agent receives
+    /// every state message. Messages that do not carry a pose (e.g. descriptions, SPAT, MAP) are never filtered.
+    ///
+    ///@param radius the interest radius beyond which state messages are dropped
+    void SetInterestRadius(double radius) { m_interest_radius = radius; }
+
+    ///@brief Get the interest radius used for spatial filtering of state messages
+    ///
+    double GetInterestRadius() const { return m_interest_radius; }
+
     /// @brief Should the simulation still be running?
     bool IsOk() { return m_is_ok; }
 
@@ -131,6 +146,20 @@ class SYN_API SynChronoManager {
     ///
     void CreateAgentsFromDescriptions();
 
+    ///@brief Extract the position of the sending agent from a state message
+    /// Returns false for message types that do not carry a pose; those bypass interest filtering
+    ///
+    ///@param message the message to extract the position from
+    ///@param pos filled with the position of the sending agent on success
+    static bool GetMessagePosition(std::shared_ptr<SynMessage> message, ChVector<double>& pos);
+
+    ///@brief Whether a state message sent from the given position is of interest to the local agent with
+    /// the given key, i.e. whether the sender is within the interest radius of that agent
+    ///
+    ///@param agent_key the key of the local agent receiving the message
+    ///@param pos the position of the sending agent
+    bool IsOfInterest(AgentKey agent_key, const ChVector<double>& pos) const;
+
     // --------------------------------------------------------------------------------------------------------------
 
     bool m_is_ok;
@@ -142,6 +171,9 @@ class SYN_API SynChronoManager {
     double m_heartbeat;  ///< Rate at which synchronization between nodes occurs
     double m_next_sync;  ///< Time at which next synchronization between nodes should occur
 
+    double m_interest_radius = 0;  ///< interest radius for spatial filtering of state messages (<= 0: disabled)
+    std::map<AgentKey, ChVector<double>> m_agent_positions;  ///< last known position of each local agent
+
     ChTimer m_timer_update;         ///< timer for agent updates
     ChTimer m_timer_msg_gather;     ///< timer for generating outgoing messages
     ChTimer m_timer_communication;  ///< timer for communication
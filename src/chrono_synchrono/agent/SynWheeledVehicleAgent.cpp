@@ -97,7 +97,9 @@ void SynWheeledVehicleAgent::Update() {
     chassis.GetFrame().SetRot_dt(chassis_abs.GetRot_dt());
     chassis.GetFrame().SetRot_dtdt(chassis_abs.GetRot_dtdt());
 
-    std::vector<SynPose> wheels;
+    // Refill the scratch pose vector in place; its capacity is retained across steps, so after the first
+    // update no allocations are made here
+    m_wheel_poses.clear();
     for (auto axle : m_vehicle->GetAxles()) {
         for (auto wheel : axle->GetWheels()) {
             auto state = wheel->GetState();
@@ -107,12 +109,12 @@ void SynWheeledVehicleAgent::Update() {
             frame.GetFrame().SetPos_dtdt(wheel_abs.GetPos_dtdt());
             frame.GetFrame().SetRot_dt(wheel_abs.GetRot_dt());
             frame.GetFrame().SetRot_dtdt(wheel_abs.GetRot_dtdt());
-            wheels.emplace_back(frame);
+            m_wheel_poses.emplace_back(frame);
         }
     }
 
     auto time = m_vehicle->GetSystem()->GetChTime();
-    m_state->SetState(time, chassis, wheels);
+    m_state->SetState(time, chassis, m_wheel_poses);
 }
 
 // ------------------------------------------------------------------------
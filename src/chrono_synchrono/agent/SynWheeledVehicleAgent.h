@@ -130,6 +130,8 @@ class SYN_API SynWheeledVehicleAgent : public SynAgent {
 
     std::shared_ptr<ChBodyAuxRef> m_zombie_body;              ///< agent's zombie body reference
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_wheel_list;  ///< vector of this agent's zombie wheels
+
+    std::vector<SynPose> m_wheel_poses;  ///< scratch vector of wheel poses, reused across updates
 };
 
 /// @} synchrono_agent
@@ -301,6 +301,13 @@ std::shared_ptr<SynDDSPublisher> SynDDSCommunicator::CreatePublisher(const std::
         return nullptr;
     }
 
+    // Reuse an existing publisher on this topic. The outgoing step buffer is aggregated per node, so a single
+    // writer per topic suffices; a duplicate writer would publish the same buffer once per agent.
+    for (auto& publisher : m_publishers) {
+        if (publisher->GetTopic() && publisher->GetTopic()->GetTopicName() == topic_name)
+            return publisher;
+    }
+
     // Create the topic
     auto topic = this->CreateTopic(topic_name, data_type);
     if (!topic->GetDDSTopic()) {
@@ -89,6 +89,7 @@ class SYN_API SynDDSPublisher {
 
     eprosima::fastdds::dds::Publisher* GetPublisher() { return m_publisher; }
     eprosima::fastdds::dds::DataWriter* GetDataWriter() { return m_writer; }
+    std::shared_ptr<SynDDSTopic> GetTopic() { return m_topic; }
 
   private:
     eprosima::fastdds::dds::Publisher* m_publisher;  ///< FastDDS publisher that handles data writers
@@ -81,11 +81,10 @@ void SynMPICommunicator::Synchronize() {
 }
 
 SynMessageList& SynMPICommunicator::GetMessages() {
+    // deserialize each rank's slice of the gathered buffer in place (no intermediate copy)
     for (int i = 0; i < m_num_ranks; i++) {
         if (i != m_rank) {
-            std::vector<uint8_t> data = std::vector<uint8_t>(m_all_data.data() + m_msg_displs[i],
-                                                             m_all_data.data() + m_msg_displs[i] + m_msg_lengths[i]);
-            m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
+            m_flatbuffers_manager.ProcessBuffer(m_all_data.data() + m_msg_displs[i], m_incoming_messages);
         }
     }
 
@@ -0,0 +1,114 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2020 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// =============================================================================
+//
+// One-sided (RMA) variant of the MPI communicator. Each rank exposes its
+// serialized state in an MPI window; on synchronization a rank publishes its
+// own state locally and reads only the ranks it is interested in with MPI_Get
+// under passive target synchronization. No collective is issued per step.
+//
+// =============================================================================
+
+#include <cstring>
+
+#include "chrono/core/ChException.h"
+
+#include "chrono_synchrono/communication/mpi/SynMPIRMACommunicator.h"
+
+namespace chrono {
+namespace synchrono {
+
+SynMPIRMACommunicator::SynMPIRMACommunicator(int argc, char* argv[], int max_msg_size)
+    : m_max_msg_size(max_msg_size) {
+    // mpi initialization; RMA with passive target synchronization requires a thread-compliant MPI
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    // set rank
+    MPI_Comm_rank(MPI_COMM_WORLD, &m_rank);
+    // set number of ranks in this simulation
+    MPI_Comm_size(MPI_COMM_WORLD, &m_num_ranks);
+
+    // Each rank's window holds the payload length followed by the payload itself
+    MPI_Aint win_size = sizeof(int32_t) + m_max_msg_size;
+    MPI_Win_allocate(win_size, 1, MPI_INFO_NULL, MPI_COMM_WORLD, &m_win_mem, &m_win);
+
+    // Start with an empty published state so that early readers see a valid (zero) length
+    std::memset(m_win_mem, 0, sizeof(int32_t));
+
+    // Default to reading every other rank
+    for (int i = 0; i < m_num_ranks; i++)
+        if (i != m_rank)
+            m_read_ranks.push_back(i);
+
+    m_remote_data.resize(m_max_msg_size);
+
+    // Window creation is collective; all ranks are ready once it returns
+    Barrier();
+}
+
+SynMPIRMACommunicator::~SynMPIRMACommunicator() {
+    MPI_Win_free(&m_win);
+
+    MPI_Finalize();
+}
+
+void SynMPIRMACommunicator::SetReadRanks(const std::vector<int>& ranks) {
+    m_read_ranks.clear();
+    for (int rank : ranks)
+        if (rank != m_rank)
+            m_read_ranks.push_back(rank);
+}
+
+void SynMPIRMACommunicator::Synchronize() {
+    m_flatbuffers_manager.Finish();
+
+    int32_t msg_length = m_flatbuffers_manager.GetSize();
+    if (msg_length > m_max_msg_size) {
+        std::string error = "SynMPIRMACommunicator: serialized state (" + std::to_string(msg_length) +
+                            " bytes) exceeds the window size (" + std::to_string(m_max_msg_size) + " bytes).";
+        throw ChException(error);
+    }
+
+    // Publish this rank's state to its own window. The exclusive lock orders the store against
+    // concurrent remote gets, so readers never observe a partially written buffer.
+    MPI_Win_lock(MPI_LOCK_EXCLUSIVE, m_rank, 0, m_win);
+    std::memcpy(m_win_mem + sizeof(int32_t), m_flatbuffers_manager.GetBufferPointer(), msg_length);
+    std::memcpy(m_win_mem, &msg_length, sizeof(int32_t));
+    MPI_Win_unlock(m_rank, m_win);
+
+    // Read the most recently published state of each rank of interest. Two gets under a shared
+    // lock, with a flush in between so the payload get can use the length just read.
+    for (int target : m_read_ranks) {
+        int32_t remote_length = 0;
+
+        MPI_Win_lock(MPI_LOCK_SHARED, target, 0, m_win);
+        MPI_Get(&remote_length, sizeof(int32_t), MPI_BYTE, target, 0, sizeof(int32_t), MPI_BYTE, m_win);
+        MPI_Win_flush(target, m_win);
+        if (remote_length > 0)
+            MPI_Get(m_remote_data.data(), remote_length, MPI_BYTE, target, sizeof(int32_t), remote_length, MPI_BYTE,
+                    m_win);
+        MPI_Win_unlock(target, m_win);
+
+        if (remote_length > 0)
+            m_flatbuffers_manager.ProcessBuffer(m_remote_data.data(), m_incoming_messages);
+    }
+
+    m_flatbuffers_manager.Reset();
+}
+
+SynMessageList& SynMPIRMACommunicator::GetMessages() {
+    // Remote states were already deserialized during Synchronize
+    return m_incoming_messages;
+}
+
+}  // namespace synchrono
+}  // namespace chrono
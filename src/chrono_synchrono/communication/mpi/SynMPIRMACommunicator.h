@@ -0,0 +1,109 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2020 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// =============================================================================
+//
+// One-sided (RMA) variant of the MPI communicator. Each rank exposes its
+// serialized state in an MPI window; on synchronization a rank publishes its
+// own state locally and reads only the ranks it is interested in with MPI_Get
+// under passive target synchronization. Unlike SynMPICommunicator, no
+// collective is issued per step, so loosely coupled ranks are not held back
+// by the slowest rank (readers may observe the most recently published state
+// of a slower rank rather than a lockstep-consistent one).
+//
+// =============================================================================
+
+#ifndef SYN_MPI_RMA_COMMUNICATOR_H
+#define SYN_MPI_RMA_COMMUNICATOR_H
+
+#include <mpi.h>
+
+#include "chrono_synchrono/communication/SynCommunicator.h"
+
+namespace chrono {
+namespace synchrono {
+
+/// @addtogroup synchrono_communication_mpi
+/// @{
+
+/// Derived communicator that exchanges state through one-sided MPI windows.
+/// Each rank posts its serialized message buffer to its own window and reads the windows of the ranks it cares
+/// about (all other ranks by default, see SetReadRanks). There is no per-step collective or global barrier.
+class SYN_API SynMPIRMACommunicator : public SynCommunicator {
+  public:
+    ///@brief Construct the communicator
+    ///
+    ///@param argc pass-through command line argument count
+    ///@param argv pass-through command line arguments
+    ///@param max_msg_size maximum size (in bytes) of one rank's serialized state; sizes the window
+    SynMPIRMACommunicator(int argc, char** argv, int max_msg_size = 1 << 20);
+
+    ///@brief Destructor
+    ///
+    virtual ~SynMPIRMACommunicator();
+
+    ///@brief Initialization method typically responsible for establishing a connection.
+    ///
+    virtual void Initialize() override{};
+
+    ///@brief Publish this rank's serialized state to its window and read the windows of the ranks of interest.
+    /// Publication and reads use passive target synchronization (exclusive lock for the local store, shared
+    /// locks for remote gets), so torn buffers are never observed, but no rank waits for any other rank to
+    /// reach the same step.
+    ///
+    virtual void Synchronize() override;
+
+    ///@brief This method is responsible for blocking until an action is received or done.
+    ///
+    virtual void Barrier() override { MPI_Barrier(MPI_COMM_WORLD); }
+
+    // -----------------------------------------------------------------------------------------------
+
+    ///@brief Get the messages received by the communicator
+    ///
+    ///@return SynMessageList the received messages
+    virtual SynMessageList& GetMessages() override;
+
+    ///@brief Set the ranks whose state this rank reads on each Synchronize (default: all other ranks).
+    /// This rank's own id is ignored if present.
+    ///
+    ///@param ranks the ranks of interest
+    void SetReadRanks(const std::vector<int>& ranks);
+
+    ///@brief Get the rank for the attached process
+    ///
+    virtual int GetRank() const { return m_rank; }
+
+    ///@brief Get the number of ranks in the MPI world
+    ///
+    virtual int GetNumRanks() const { return m_num_ranks; }
+
+    // -----------------------------------------------------------------------------------------------
+
+  private:
+    int m_rank;
+    int m_num_ranks;
+
+    int m_max_msg_size;  ///< size of each rank's window payload region
+
+    MPI_Win m_win;       ///< window exposing this rank's state
+    uint8_t* m_win_mem;  ///< window memory: int32 payload length followed by the payload
+
+    std::vector<int> m_read_ranks;       ///< ranks whose windows are read on Synchronize
+    std::vector<uint8_t> m_remote_data;  ///< scratch buffer for one remote payload
+};
+
+/// @} synchrono_communication
+
+}  // namespace synchrono
+}  // namespace chrono
+
+#endif
@@ -32,7 +32,11 @@ SynFlatBuffersManager::SynFlatBuffersManager(int msg_length) : m_builder(msg_len
 }
 
 void SynFlatBuffersManager::ProcessBuffer(std::vector<uint8_t>& data, SynMessageList& messages) {
-    auto buffer = flatbuffers::GetSizePrefixedRoot<SynFlatBuffers::Buffer>(data.data());
+    ProcessBuffer(data.data(), messages);
+}
+
+void SynFlatBuffersManager::ProcessBuffer(const uint8_t* data, SynMessageList& messages) {
+    auto buffer = flatbuffers::GetSizePrefixedRoot<SynFlatBuffers::Buffer>(data);
     for (auto message : (*buffer->buffer())) {
         auto msg = SynMessageFactory::GenerateMessage(message);
         messages.push_back(msg);
@@ -54,6 +54,13 @@ class SYN_API SynFlatBuffersManager {
     ///@param messages reference to message list to store the parsed messages
     void ProcessBuffer(std::vector<uint8_t>& data, SynMessageList& messages);
 
+    ///@brief Process a data buffer in place with the assumption it is a SynFlatBuffers::Buffer message.
+    /// Deserializes directly from the passed pointer without copying the buffer first.
+    ///
+    ///@param data pointer to the size-prefixed buffer to process
+    ///@param messages reference to message list to store the parsed messages
+    void ProcessBuffer(const uint8_t* data, SynMessageList& messages);
+
     ///@brief Adds a SynMessage to the flatbuffer message buffer. Will call MessageFromState automatically
     ///
     ///@param message the SynMessage to add
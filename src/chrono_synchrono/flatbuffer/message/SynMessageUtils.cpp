@@ -29,6 +29,8 @@ AgentKey::AgentKey(int node_id, int agent_id) {
 
     // Matthew Szudzik pairing function (Cantor pair would also work)
     m_unique_id = node_id >= agent_id ? (node_id * node_id) + node_id + agent_id : (agent_id * agent_id) + node_id;
+
+    m_flatbuffers_key = SynFlatBuffers::AgentKey(m_node_id, m_agent_id);
 }
 
 std::string AgentKey::GetKeyString() const {
@@ -36,8 +38,8 @@ std::string AgentKey::GetKeyString() const {
 }
 
 const SynFlatBuffers::AgentKey* const AgentKey::GetFlatbuffersKey() const {
-    // This memory is freed when we clear out messages
-    return new SynFlatBuffers::AgentKey(m_node_id, m_agent_id);
+    // The builder copies the struct into its buffer, so a pointer into this object is sufficient
+    return &m_flatbuffers_key;
 }
 
 SynPose::SynPose(const ChVector<>& mv, const ChQuaternion<>& mq) {
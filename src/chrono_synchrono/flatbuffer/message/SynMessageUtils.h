@@ -51,6 +51,8 @@ class SYN_API AgentKey {
     int m_node_id;
     int m_agent_id;
     int m_unique_id;
+
+    SynFlatBuffers::AgentKey m_flatbuffers_key;  ///< flatbuffers struct mirror, referenced during serialization
 };
 
 /// @addtogroup synchrono_flatbuffer
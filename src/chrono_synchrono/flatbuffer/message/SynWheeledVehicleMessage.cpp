@@ -31,7 +31,7 @@ namespace WheeledVehicle = SynFlatBuffers::Agent::WheeledVehicle;
 SynWheeledVehicleStateMessage::SynWheeledVehicleStateMessage(AgentKey source_key, AgentKey destination_key)
     : SynMessage(source_key, destination_key) {}
 
-void SynWheeledVehicleStateMessage::SetState(double time, SynPose chassis, std::vector<SynPose> wheels) {
+void SynWheeledVehicleStateMessage::SetState(double time, const SynPose& chassis, const std::vector<SynPose>& wheels) {
     this->time = time;
     this->chassis = chassis;
     this->wheels = wheels;
@@ -58,7 +58,7 @@ class SYN_API SynWheeledVehicleStateMessage : public SynMessage {
     ///@param time simulation time
     ///@param chassis vehicle's chassis pose
     ///@param wheels vector of the vehicle's wheel poses
-    void SetState(double time, SynPose chassis, std::vector<SynPose> wheels);
+    void SetState(double time, const SynPose& chassis, const std::vector<SynPose>& wheels);
 
     // -------------------------------------------------------------------------------
 
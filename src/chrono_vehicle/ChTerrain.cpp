@@ -42,5 +42,17 @@ void ChTerrain::GetProperties(const ChVector<>& loc, double& height, ChVector<>&
     friction = GetCoefficientFriction(loc);
 }
 
+void ChTerrain::QueryBatch(const std::vector<ChVector<>>& locs,
+                           std::vector<double>& heights,
+                           std::vector<ChVector<>>& normals,
+                           std::vector<float>& frictions) const {
+    heights.resize(locs.size());
+    normals.resize(locs.size());
+    frictions.resize(locs.size());
+
+    for (size_t i = 0; i < locs.size(); i++)
+        GetProperties(locs[i], heights[i], normals[i], frictions[i]);
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
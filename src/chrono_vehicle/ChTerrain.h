@@ -19,6 +19,8 @@
 #ifndef CH_TERRAIN_H
 #define CH_TERRAIN_H
 
+#include <vector>
+
 #include "chrono/core/ChVector.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
@@ -57,6 +59,17 @@ class CH_VEHICLE_API ChTerrain {
     /// Get all terrain characteristics at the point below the specified location.
     virtual void GetProperties(const ChVector<>& loc, double& height, ChVector<>& normal, float& friction) const;
 
+    /// Get all terrain characteristics at the points below a batch of locations.
+    /// The output vectors are resized to the number of query locations. The base class implementation simply invokes
+    /// GetProperties for each location; terrain models for which per-query setup can be amortized, or whose queries
+    /// are safe to evaluate concurrently, should override this function. Callers probing the terrain with many points
+    /// per step (e.g., tire models with a cloud of contact probes) should prefer a single QueryBatch call over
+    /// per-point queries, as this also amortizes the virtual dispatch.
+    virtual void QueryBatch(const std::vector<ChVector<>>& locs,
+                            std::vector<double>& heights,
+                            std::vector<ChVector<>>& normals,
+                            std::vector<float>& frictions) const;
+
     /// Class to be used as a functor interface for location-dependent terrain height.
     class CH_VEHICLE_API HeightFunctor {
       public:
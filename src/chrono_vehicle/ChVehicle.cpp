@@ -29,6 +29,7 @@
 #include "chrono_vehicle/ChVehicleVisualSystem.h"
 
 #include "chrono_vehicle/output/ChVehicleOutputASCII.h"
+#include "chrono_vehicle/output/ChVehicleOutputBIN.h"
 #ifdef CHRONO_HAS_HDF5
     #include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
 #endif
@@ -117,6 +118,9 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
         case ChVehicleOutput::ASCII:
             m_output_db = new ChVehicleOutputASCII(out_dir + "/" + out_name + ".txt");
             break;
+        case ChVehicleOutput::BINARY:
+            m_output_db = new ChVehicleOutputBIN(out_dir + "/" + out_name + ".dat");
+            break;
         case ChVehicleOutput::JSON:
             //// TODO
             break;
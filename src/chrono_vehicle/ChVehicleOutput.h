@@ -44,9 +44,10 @@ namespace vehicle {
 class CH_VEHICLE_API ChVehicleOutput {
   public:
     enum Type {
-        ASCII,  ///< ASCII text
-        JSON,   ///< JSON
-        HDF5    ///< HDF-5
+        ASCII,   ///< ASCII text
+        BINARY,  ///< binary records
+        JSON,    ///< JSON
+        HDF5     ///< HDF-5
     };
 
     ChVehicleOutput() {}
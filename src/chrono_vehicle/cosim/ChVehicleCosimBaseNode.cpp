@@ -19,6 +19,13 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
 #include "chrono_vehicle/cosim/ChVehicleCosimBaseNode.h"
 
 using std::cout;
@@ -36,6 +43,105 @@ namespace cosim {
 
 static MPI_Comm terrain_comm = MPI_COMM_NULL;
 
+// Shared-memory transport between co-located ranks.
+// Each rank owns one single-producer/single-consumer ring buffer per possible consumer on the same host, allocated
+// in an MPI shared-memory window. A message is framed as an 8-byte header (tag and payload size) followed by the
+// raw payload bytes; a payload larger than the channel capacity is flagged in the header and transferred over MPI
+// instead, so that messages between a given pair of ranks are always delivered in order.
+
+static const size_t shm_capacity = 1 << 20;       // payload bytes per directed channel
+static const uint32_t shm_overflow = 0xffffffff;  // header size marker for payloads redirected over MPI
+
+struct ShmChannel {
+    std::atomic<uint64_t> head;                        ///< total number of bytes written by the producer
+    std::atomic<uint64_t> tail;                        ///< total number of bytes consumed by the consumer
+    char pad[64 - 2 * sizeof(std::atomic<uint64_t>)];  ///< keep the counters off the payload cache lines
+    char data[shm_capacity];                           ///< ring buffer payload storage
+};
+
+struct ShmHeader {
+    uint32_t tag;   ///< message tag (as in the equivalent MPI exchange)
+    uint32_t size;  ///< payload size in bytes, or shm_overflow
+};
+
+static MPI_Comm shm_comm = MPI_COMM_NULL;      // communicator of the ranks on this host
+static MPI_Win shm_win = MPI_WIN_NULL;         // shared-memory window holding all channels
+static std::vector<int> shm_local_index;       // world rank -> rank in shm_comm (-1 if on another host)
+static std::vector<ShmChannel*> shm_channels;  // all channels on this host, indexed [producer * size + consumer]
+static int shm_local_size = 0;                 // number of ranks on this host
+
+// Return the channel for messages from world rank 'src' to world rank 'dst', or null if not co-located.
+static ShmChannel* GetChannel(int src, int dst) {
+    if (shm_win == MPI_WIN_NULL)
+        return nullptr;
+    int p = shm_local_index[src];
+    int c = shm_local_index[dst];
+    if (p < 0 || c < 0)
+        return nullptr;
+    return shm_channels[p * shm_local_size + c];
+}
+
+// Append bytes to a channel, blocking while the ring is full.
+static void ChannelWrite(ShmChannel* ch, const void* data, size_t nbytes) {
+    uint64_t head = ch->head.load(std::memory_order_relaxed);
+    while (shm_capacity - (head - ch->tail.load(std::memory_order_acquire)) < nbytes) {
+        // spin until the consumer frees enough space
+    }
+    size_t start = (size_t)(head % shm_capacity);
+    size_t chunk = std::min(nbytes, shm_capacity - start);
+    std::memcpy(ch->data + start, data, chunk);
+    std::memcpy(ch->data, (const char*)data + chunk, nbytes - chunk);
+    ch->head.store(head + nbytes, std::memory_order_release);
+}
+
+// Copy bytes from a channel without consuming them, blocking until they are available.
+static void ChannelPeek(ShmChannel* ch, void* data, size_t nbytes) {
+    uint64_t tail = ch->tail.load(std::memory_order_relaxed);
+    while (ch->head.load(std::memory_order_acquire) - tail < nbytes) {
+        // spin until the producer publishes enough data
+    }
+    size_t start = (size_t)(tail % shm_capacity);
+    size_t chunk = std::min(nbytes, shm_capacity - start);
+    std::memcpy(data, ch->data + start, chunk);
+    std::memcpy((char*)data + chunk, ch->data, nbytes - chunk);
+}
+
+// Consume bytes previously inspected with ChannelPeek.
+static void ChannelPop(ShmChannel* ch, size_t nbytes) {
+    ch->tail.store(ch->tail.load(std::memory_order_relaxed) + nbytes, std::memory_order_release);
+}
+
+// Send a message over a shared-memory channel (with MPI fallback for oversized payloads).
+static void ShmSend(ShmChannel* ch, const void* data, size_t nbytes, int count, MPI_Datatype type, int dest, int tag) {
+    ShmHeader hdr;
+    hdr.tag = (uint32_t)tag;
+    if (sizeof(ShmHeader) + nbytes > shm_capacity) {
+        hdr.size = shm_overflow;
+        ChannelWrite(ch, &hdr, sizeof(hdr));
+        MPI_Send(data, count, type, dest, tag, MPI_COMM_WORLD);
+        return;
+    }
+    hdr.size = (uint32_t)nbytes;
+    ChannelWrite(ch, &hdr, sizeof(hdr));
+    ChannelWrite(ch, data, nbytes);
+}
+
+// Receive a message from a shared-memory channel (counterpart of ShmSend).
+static void ShmRecv(ShmChannel* ch, void* data, size_t nbytes, int count, MPI_Datatype type, int source, int tag) {
+    ShmHeader hdr;
+    ChannelPeek(ch, &hdr, sizeof(hdr));
+    assert(hdr.tag == (uint32_t)tag);
+    ChannelPop(ch, sizeof(hdr));
+    if (hdr.size == shm_overflow) {
+        MPI_Status status;
+        MPI_Recv(data, count, type, source, tag, MPI_COMM_WORLD, &status);
+        return;
+    }
+    assert(hdr.size == nbytes);
+    ChannelPeek(ch, data, nbytes);
+    ChannelPop(ch, nbytes);
+}
+
 int InitializeFramework(int num_tires) {
     int world_size;
     MPI_Comm_size(MPI_COMM_WORLD, &world_size);
@@ -60,6 +166,43 @@ int InitializeFramework(int num_tires) {
     // Create and return a communicator from the terrain group
     MPI_Comm_create(MPI_COMM_WORLD, terrain_group, &terrain_comm);
 
+    // Split off the ranks located on this host and build the map from world rank to local rank
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &shm_comm);
+    MPI_Comm_size(shm_comm, &shm_local_size);
+    int world_rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
+    std::vector<int> world_ranks(shm_local_size);
+    MPI_Allgather(&world_rank, 1, MPI_INT, world_ranks.data(), 1, MPI_INT, shm_comm);
+    shm_local_index.assign(world_size, -1);
+    for (int i = 0; i < shm_local_size; i++)
+        shm_local_index[world_ranks[i]] = i;
+
+    // Set up the shared-memory transport for co-located ranks
+    if (shm_local_size > 1) {
+        // Allocate this rank's channels (one per co-located consumer) in a shared window
+        void* base = nullptr;
+        MPI_Win_allocate_shared(shm_local_size * sizeof(ShmChannel), 1, MPI_INFO_NULL, shm_comm, &base, &shm_win);
+        for (int c = 0; c < shm_local_size; c++) {
+            auto ch = new ((ShmChannel*)base + c) ShmChannel;
+            ch->head.store(0, std::memory_order_relaxed);
+            ch->tail.store(0, std::memory_order_relaxed);
+        }
+
+        // Query the base addresses of the channels owned by the other co-located ranks
+        shm_channels.resize(shm_local_size * shm_local_size, nullptr);
+        for (int p = 0; p < shm_local_size; p++) {
+            MPI_Aint win_size;
+            int disp_unit;
+            void* p_base;
+            MPI_Win_shared_query(shm_win, p, &win_size, &disp_unit, &p_base);
+            for (int c = 0; c < shm_local_size; c++)
+                shm_channels[p * shm_local_size + c] = (ShmChannel*)p_base + c;
+        }
+
+        // Make sure all channels are initialized before any rank starts communicating
+        MPI_Barrier(shm_comm);
+    }
+
     return MPI_SUCCESS;
 }
 
@@ -312,6 +455,82 @@ void ChVehicleCosimBaseNode::Render(double step_size) {
     }
 }
 
+void ChVehicleCosimBaseNode::SendData(const double* data, int count, int dest, int tag) const {
+    auto channel = cosim::GetChannel(m_rank, dest);
+    if (channel)
+        cosim::ShmSend(channel, data, count * sizeof(double), count, MPI_DOUBLE, dest, tag);
+    else
+        MPI_Send(data, count, MPI_DOUBLE, dest, tag, MPI_COMM_WORLD);
+}
+
+void ChVehicleCosimBaseNode::SendData(const int* data, int count, int dest, int tag) const {
+    auto channel = cosim::GetChannel(m_rank, dest);
+    if (channel)
+        cosim::ShmSend(channel, data, count * sizeof(int), count, MPI_INT, dest, tag);
+    else
+        MPI_Send(data, count, MPI_INT, dest, tag, MPI_COMM_WORLD);
+}
+
+void ChVehicleCosimBaseNode::RecvData(double* data, int count, int source, int tag) const {
+    auto channel = cosim::GetChannel(source, m_rank);
+    if (channel) {
+        cosim::ShmRecv(channel, data, count * sizeof(double), count, MPI_DOUBLE, source, tag);
+    } else {
+        MPI_Status status;
+        MPI_Recv(data, count, MPI_DOUBLE, source, tag, MPI_COMM_WORLD, &status);
+    }
+}
+
+void ChVehicleCosimBaseNode::RecvData(int* data, int count, int source, int tag) const {
+    auto channel = cosim::GetChannel(source, m_rank);
+    if (channel) {
+        cosim::ShmRecv(channel, data, count * sizeof(int), count, MPI_INT, source, tag);
+    } else {
+        MPI_Status status;
+        MPI_Recv(data, count, MPI_INT, source, tag, MPI_COMM_WORLD, &status);
+    }
+}
+
+void ChVehicleCosimBaseNode::SendDataAsync(const double* data, int count, int dest, int tag) const {
+    auto channel = cosim::GetChannel(m_rank, dest);
+    if (channel) {
+        // The shared-memory ring write is already decoupled from the receiver; complete the send in place.
+        cosim::ShmSend(channel, data, count * sizeof(double), count, MPI_DOUBLE, dest, tag);
+        return;
+    }
+
+    // Copy into a persistent buffer and post a non-blocking send, completed at the next FlushSends().
+    m_send_bufs.emplace_back(new double[count]);
+    std::copy(data, data + count, m_send_bufs.back().get());
+    m_send_requests.push_back(MPI_Request());
+    MPI_Isend(m_send_bufs.back().get(), count, MPI_DOUBLE, dest, tag, MPI_COMM_WORLD, &m_send_requests.back());
+}
+
+void ChVehicleCosimBaseNode::FlushSends() const {
+    if (m_send_requests.empty())
+        return;
+    MPI_Waitall((int)m_send_requests.size(), m_send_requests.data(), MPI_STATUSES_IGNORE);
+    m_send_requests.clear();
+    m_send_bufs.clear();
+}
+
+int ChVehicleCosimBaseNode::ProbeDataInt(int source, int tag) const {
+    auto channel = cosim::GetChannel(source, m_rank);
+    if (channel) {
+        cosim::ShmHeader hdr;
+        cosim::ChannelPeek(channel, &hdr, sizeof(hdr));
+        assert(hdr.tag == (uint32_t)tag);
+        if (hdr.size != cosim::shm_overflow)
+            return (int)(hdr.size / sizeof(int));
+        // oversized message redirected over MPI; fall through to an MPI probe
+    }
+    MPI_Status status;
+    int count;
+    MPI_Probe(source, tag, MPI_COMM_WORLD, &status);
+    MPI_Get_count(&status, MPI_INT, &count);
+    return count;
+}
+
 void ChVehicleCosimBaseNode::SendGeometry(const ChVehicleGeometry& geom, int dest) const {
     // Send information on number of contact materials and collision shapes of each type
     int dims[] = {
@@ -22,6 +22,7 @@
 #include <fstream>
 #include <string>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include <mpi.h>
@@ -81,6 +82,9 @@ namespace cosim {
 
 /// Initialize the co-simulation framework.
 /// This function creates an MPI communicator that includes all nodes designated of type TERRAIN.
+/// In addition, it sets up a shared-memory transport between ranks located on the same host: per-step data
+/// exchanges between co-located nodes bypass MPI and go through lock-free ring buffers in shared memory
+/// (see ChVehicleCosimBaseNode::SendData).
 /// Calling this framework initialization function is optional. If invoked, it *must* be called on all ranks.
 /// Returns MPI_SUCCESS if successful and MPI_ERR_OTHER if there are not enough ranks.
 CH_VEHICLE_API int InitializeFramework(int num_tires);
@@ -239,6 +243,31 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
     void SendGeometry(const ChVehicleGeometry& geom, int dest) const;
     void RecvGeometry(ChVehicleGeometry& geom, int source) const;
 
+    /// Send an array of doubles to the co-simulation node on the specified rank.
+    /// If the framework was initialized (see cosim::InitializeFramework) and the destination rank resides on the
+    /// same host, the data is written directly into a shared-memory ring buffer with no MPI packing; otherwise,
+    /// this falls back to a blocking MPI send. Must be matched by a RecvData call on the destination node.
+    void SendData(const double* data, int count, int dest, int tag) const;
+    void SendData(const int* data, int count, int dest, int tag) const;
+
+    /// Receive an array of doubles from the co-simulation node on the specified rank (counterpart of SendData).
+    void RecvData(double* data, int count, int source, int tag) const;
+    void RecvData(int* data, int count, int source, int tag) const;
+
+    /// Return the number of integers in the next pending message from the specified node, without receiving it.
+    /// This is a blocking probe, used for exchanges whose length is not known a priori on the receiving side.
+    int ProbeDataInt(int source, int tag) const;
+
+    /// Initiate a non-blocking send of an array of doubles to the co-simulation node on the specified rank.
+    /// The data is copied into an internal buffer, so the caller may reuse its array immediately. When the
+    /// destination resides on the same host, the shared-memory ring write completes the send on the spot;
+    /// otherwise an MPI_Isend is posted and completed at the next call to FlushSends(). Must be matched by a
+    /// RecvData call on the destination node.
+    void SendDataAsync(const double* data, int count, int dest, int tag) const;
+
+    /// Complete all sends initiated with SendDataAsync() that are still in flight.
+    void FlushSends() const;
+
     int m_rank;  ///< MPI rank of this node (in MPI_COMM_WORLD)
 
     double m_step_size;  ///< integration step size
@@ -272,6 +301,9 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
     ChTimer m_timer;  ///< timer for integration cost
     double m_cum_sim_time;    ///< cumulative integration cost
 
+    mutable std::vector<MPI_Request> m_send_requests;             ///< pending non-blocking MPI sends
+    mutable std::vector<std::unique_ptr<double[]>> m_send_bufs;   ///< buffers backing pending sends
+
     bool m_verbose;  ///< verbose messages during simulation?
 
     static const double m_gacc;
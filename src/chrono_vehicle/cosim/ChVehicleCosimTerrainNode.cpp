@@ -46,7 +46,8 @@ ChVehicleCosimTerrainNode::ChVehicleCosimTerrainNode(double length, double width
       m_dimX(length / 2),
       m_dimY(width / 2),
       m_load_mass(50),
-      m_interface_type(InterfaceType::BODY) {}
+      m_interface_type(InterfaceType::BODY),
+      m_num_substeps(1) {}
 
 // -----------------------------------------------------------------------------
 
@@ -60,6 +61,10 @@ void ChVehicleCosimTerrainNode::GetDimensions(double& length, double& width) {
     width = m_dimY;
 }
 
+void ChVehicleCosimTerrainNode::EnableSubstepping(int num_substeps) {
+    m_num_substeps = std::max(1, num_substeps);
+}
+
 // -----------------------------------------------------------------------------
 // Initialization of the terrain node(s):
 // - send terrain height
@@ -223,6 +228,9 @@ void ChVehicleCosimTerrainNode::InitializeTrackData() {
 // Only the main terrain node participates in the co-simulation data exchange.
 // -----------------------------------------------------------------------------
 void ChVehicleCosimTerrainNode::Synchronize(int step_number, double time) {
+    // Complete any force sends still in flight from the previous exchange (no-op unless sub-stepping)
+    FlushSends();
+
     switch (m_interface_type) {
         case InterfaceType::BODY:
             if (m_wheeled)
@@ -246,9 +254,8 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledBody(int step_number, double t
     for (int i = 0; i < m_num_objects; i++) {
         if (m_rank == TERRAIN_NODE_RANK) {
             // Receive rigid body state data for this tire
-            MPI_Status status;
             double state_data[13];
-            MPI_Recv(state_data, 13, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD, &status);
+            RecvData(state_data, 13, TIRE_NODE_RANK(i), step_number);
 
             m_rigid_state[i].pos = ChVector<>(state_data[0], state_data[1], state_data[2]);
             m_rigid_state[i].rot = ChQuaternion<>(state_data[3], state_data[4], state_data[5], state_data[6]);
@@ -274,7 +281,10 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledBody(int step_number, double t
             double force_data[] = {m_rigid_contact[i].force.x(),  m_rigid_contact[i].force.y(),
                                    m_rigid_contact[i].force.z(),  m_rigid_contact[i].moment.x(),
                                    m_rigid_contact[i].moment.y(), m_rigid_contact[i].moment.z()};
-            MPI_Send(force_data, 6, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+            if (m_num_substeps > 1)
+                SendDataAsync(force_data, 6, TIRE_NODE_RANK(i), step_number);
+            else
+                SendData(force_data, 6, TIRE_NODE_RANK(i), step_number);
 
             if (m_verbose)
                 cout << "[Terrain node] Send: spindle force (" << i << ") = " << m_rigid_contact[i].force << endl;
@@ -293,8 +303,7 @@ void ChVehicleCosimTerrainNode::SynchronizeTrackedBody(int step_number, double t
 
     // Receive rigid body data for all track shoes
     if (m_rank == TERRAIN_NODE_RANK) {
-        MPI_Status status;
-        MPI_Recv(all_states.data(), 13 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+        RecvData(all_states.data(), 13 * m_num_objects, MBS_NODE_RANK, step_number);
 
         // Unpack rigid body data
         start_idx = 0;
@@ -336,7 +345,10 @@ void ChVehicleCosimTerrainNode::SynchronizeTrackedBody(int step_number, double t
             start_idx += 6;
         }
 
-        MPI_Send(all_forces.data(), 6 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+        if (m_num_substeps > 1)
+            SendDataAsync(all_forces.data(), 6 * m_num_objects, MBS_NODE_RANK, step_number);
+        else
+            SendData(all_forces.data(), 6 * m_num_objects, MBS_NODE_RANK, step_number);
 
         if (m_verbose)
             cout << "[Terrain node] step number: " << step_number << "  num contacts: " << GetNumContacts() << endl;
@@ -349,10 +361,8 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
             auto nv = m_geometry[i].m_coll_meshes[0].m_trimesh->getNumVertices();
 
             // Receive mesh state data
-            MPI_Status status;
             double* vert_data = new double[2 * 3 * nv];
-            MPI_Recv(vert_data, 2 * 3 * nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD,
-                     &status);
+            RecvData(vert_data, 2 * 3 * nv, TIRE_NODE_RANK(i), step_number);
 
             for (int iv = 0; iv < nv; iv++) {
                 int offset = 3 * iv;
@@ -381,8 +391,7 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
 
         if (m_rank == TERRAIN_NODE_RANK) {
             // Send vertex indices and forces.
-            MPI_Send(m_mesh_contact[i].vidx.data(), m_mesh_contact[i].nv, MPI_INT, TIRE_NODE_RANK(i), step_number,
-                     MPI_COMM_WORLD);
+            SendData(m_mesh_contact[i].vidx.data(), m_mesh_contact[i].nv, TIRE_NODE_RANK(i), step_number);
 
             double* force_data = new double[3 * m_mesh_contact[i].nv];
             for (int iv = 0; iv < m_mesh_contact[i].nv; iv++) {
@@ -390,7 +399,7 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
                 force_data[3 * iv + 1] = m_mesh_contact[i].vforce[iv].y();
                 force_data[3 * iv + 2] = m_mesh_contact[i].vforce[iv].z();
             }
-            MPI_Send(force_data, 3 * m_mesh_contact[i].nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+            SendData(force_data, 3 * m_mesh_contact[i].nv, TIRE_NODE_RANK(i), step_number);
             delete[] force_data;
 
             if (m_verbose)
@@ -411,7 +420,29 @@ void ChVehicleCosimTerrainNode::Advance(double step_size) {
     // Let derived classes advance the terrain state
     m_timer.reset();
     m_timer.start();
-    OnAdvance(step_size);
+    if (m_num_substeps > 1 && m_interface_type == InterfaceType::BODY) {
+        // Sub-stepped scheduler: divide the interval and, before each substep after the first, extrapolate
+        // the proxy states with the (constant) velocities received at the last exchange. The force sends
+        // posted during Synchronize complete in the background while the first substep runs.
+        double h = step_size / m_num_substeps;
+        for (int is = 0; is < m_num_substeps; is++) {
+            if (is > 0) {
+                double t = is * h;
+                for (int i = 0; i < m_num_objects; i++) {
+                    BodyState state = m_rigid_state[i];
+                    state.pos += state.lin_vel * t;
+                    ChQuaternion<> qdt;
+                    qdt.Qdt_from_Wabs(state.ang_vel, state.rot);
+                    state.rot += qdt * t;
+                    state.rot.Normalize();
+                    UpdateRigidProxy(i, state);
+                }
+            }
+            OnAdvance(h);
+        }
+    } else {
+        OnAdvance(step_size);
+    }
     m_timer.stop();
     m_cum_sim_time += m_timer();
 
@@ -65,6 +65,14 @@ class CH_VEHICLE_API ChVehicleCosimTerrainNode : public ChVehicleCosimBaseNode {
     /// Get the terrain patch dimensions.
     void GetDimensions(double& length, double& width);
 
+    /// Enable sub-stepping of the terrain simulation (default: disabled).
+    /// When enabled, each co-simulation interval is divided into the specified number of internal substeps.
+    /// Before every substep after the first, the proxy body states are extrapolated using the velocities
+    /// received at the last data exchange, and the contact forces are sent back asynchronously so that the
+    /// exchange overlaps the terrain integration. This scheduler is only used with the BODY communication
+    /// interface; the setting is ignored with the MESH interface.
+    void EnableSubstepping(int num_substeps);
+
     /// Initialize this node.
     /// This function allows the node to initialize itself and, optionally, perform an
     /// initial data exchange with any other node.
@@ -168,6 +176,7 @@ class CH_VEHICLE_API ChVehicleCosimTerrainNode : public ChVehicleCosimBaseNode {
     bool m_wheeled;                  ///< comm node (true: TIRE nodes, false: tracked MBS node)
     InterfaceType m_interface_type;  ///< communication interface (body or mesh)
     int m_num_objects;               ///< number of interacting objects
+    int m_num_substeps;              ///< number of internal substeps per co-simulation interval
 
     std::vector<ChVehicleGeometry::AABB> m_aabb;  ///< AABB of collision models for interacting objects
     std::vector<ChVehicleGeometry> m_geometry;    ///< contact geometry and materials for interacting objects
@@ -33,6 +33,45 @@
 namespace chrono {
 namespace vehicle {
 
+// -----------------------------------------------------------------------------
+
+ChDriverInputBuffer::ChDriverInputBuffer() : m_head(-1) {
+    for (int i = 0; i < NUM_SLOTS; i++)
+        m_slots[i] = {-1, {0, 0, 0, 0}};
+}
+
+void ChDriverInputBuffer::Push(double time, const DriverInputs& inputs) {
+    int next = (m_head.load(std::memory_order_relaxed) + 1 + NUM_SLOTS) % NUM_SLOTS;
+    m_slots[next] = {time, inputs};
+    m_head.store(next, std::memory_order_release);
+}
+
+bool ChDriverInputBuffer::Evaluate(double time, DriverInputs& inputs) const {
+    int head = m_head.load(std::memory_order_acquire);
+    if (head < 0)
+        return false;
+
+    const Sample& s1 = m_slots[head];
+    const Sample& s0 = m_slots[(head + NUM_SLOTS - 1) % NUM_SLOTS];
+
+    // Hold the newest sample if only one sample is available (or samples coincide in time).
+    if (s0.time < 0 || s1.time <= s0.time) {
+        inputs = s1.inputs;
+        return true;
+    }
+
+    // Interpolate between the two newest samples, extrapolating by at most one sample interval.
+    double t = std::min(std::max(time, s0.time), s1.time + (s1.time - s0.time));
+    double x = (t - s0.time) / (s1.time - s0.time);
+    inputs.m_steering = s0.inputs.m_steering + x * (s1.inputs.m_steering - s0.inputs.m_steering);
+    inputs.m_throttle = s0.inputs.m_throttle + x * (s1.inputs.m_throttle - s0.inputs.m_throttle);
+    inputs.m_braking = s0.inputs.m_braking + x * (s1.inputs.m_braking - s0.inputs.m_braking);
+    inputs.m_clutch = s0.inputs.m_clutch + x * (s1.inputs.m_clutch - s0.inputs.m_clutch);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
 ChInteractiveDriver::ChInteractiveDriver(ChVehicle& vehicle)
     : ChDriver(vehicle),
       m_mode(InputMode::KEYBOARD),
@@ -48,7 +87,8 @@ ChInteractiveDriver::ChInteractiveDriver(ChVehicle& vehicle)
       m_steering_gain(4.0),
       m_throttle_gain(4.0),
       m_braking_gain(4.0),
-      m_clutch_gain(4.0) {}
+      m_clutch_gain(4.0),
+      m_input_interpolation(false) {}
 
 // -----------------------------------------------------------------------------
 
@@ -113,6 +153,19 @@ void ChInteractiveDriver::SetInputDataFile(const std::string& filename) {
 // -----------------------------------------------------------------------------
 
 void ChInteractiveDriver::Synchronize(double time) {
+    // In JOYSTICK mode with input interpolation enabled, evaluate the buffered samples pushed by
+    // the concrete driver at the current physics time.
+    if (m_mode == InputMode::JOYSTICK && m_input_interpolation) {
+        DriverInputs inputs;
+        if (m_input_buffer.Evaluate(time, inputs)) {
+            SetSteering(inputs.m_steering);
+            SetThrottle(inputs.m_throttle);
+            SetBraking(inputs.m_braking);
+            SetClutch(inputs.m_clutch);
+        }
+        return;
+    }
+
     // Do nothing if no embedded DataDriver.
     if (m_mode != InputMode::DATAFILE || !m_data_driver)
         return;
@@ -21,6 +21,7 @@
 #ifndef CH_INTERACTIVE_DRIVER_H
 #define CH_INTERACTIVE_DRIVER_H
 
+#include <atomic>
 #include <string>
 
 #include "chrono_vehicle/ChApiVehicle.h"
@@ -35,6 +36,41 @@ namespace vehicle {
 /// @addtogroup vehicle_driver
 /// @{
 
+/// Latest-value buffer for asynchronously sampled driver inputs.
+/// Single-producer/single-consumer and lock-free: the producer (the window system event loop or a
+/// dedicated input thread) pushes timestamped input samples; the consumer (the driver Synchronize
+/// function, called at the physics rate) evaluates the buffered samples at the current physics
+/// time. Samples are written in a small ring of plain slots with an atomically published head
+/// index, so neither side ever blocks the other. The consumer must complete a read before the
+/// producer laps the ring (i.e., within NUM_SLOTS - 2 pushes), which is guaranteed by construction
+/// for producers running no faster than the physics loop.
+class CH_VEHICLE_API ChDriverInputBuffer {
+  public:
+    ChDriverInputBuffer();
+
+    /// Store a new timestamped input sample (producer side; wait-free).
+    void Push(double time, const DriverInputs& inputs);
+
+    /// Evaluate the buffered inputs at the given time (consumer side).
+    /// Interpolates linearly between the two most recent samples; for query times past the newest
+    /// sample, extrapolates by at most one sample interval and then holds, so that a physics loop
+    /// running faster than the producer sees a ramp instead of a staircase.
+    /// Returns false if no sample was pushed yet.
+    bool Evaluate(double time, DriverInputs& inputs) const;
+
+  private:
+    /// Timestamped input sample.
+    struct Sample {
+        double time;          ///< time at which the inputs were sampled
+        DriverInputs inputs;  ///< sampled driver inputs
+    };
+
+    static const int NUM_SLOTS = 8;  ///< size of the sample ring
+
+    Sample m_slots[NUM_SLOTS];  ///< ring of samples
+    std::atomic<int> m_head;    ///< index of most recent sample (-1 if empty)
+};
+
 /// Interactive driver for the a vehicle.
 /// This class implements the functionality required by the base ChDriver class using keyboard or joystick inputs.
 class CH_VEHICLE_API ChInteractiveDriver : public ChDriver {
@@ -86,9 +122,20 @@ class CH_VEHICLE_API ChInteractiveDriver : public ChDriver {
     /// Set the input file for the underlying data driver.
     void SetInputDataFile(const std::string& filename);
 
+    /// Enable interpolation of asynchronously sampled joystick inputs (default: false).
+    /// When enabled, joystick samples are pushed by the concrete driver into a lock-free
+    /// latest-value buffer as they arrive, and Synchronize() evaluates the buffered samples at the
+    /// current physics time. This decouples the physics rate from the event loop rate: a physics
+    /// loop running much faster than the render-driven event loop sees smoothly interpolated
+    /// inputs instead of a staircase, without any low-pass filtering on the application side.
+    void SetInputInterpolation(bool val) { m_input_interpolation = val; }
+
   protected:
     InputMode m_mode;  ///< current mode of the driver
 
+    bool m_input_interpolation;        ///< interpolate buffered joystick samples in Synchronize()
+    ChDriverInputBuffer m_input_buffer;  ///< latest-value buffer of joystick input samples
+
     // Variables for mode=KEYBOARD
     double m_steering_target;  ///< current target value for steering input
     double m_throttle_target;  ///< current target value for throttle input
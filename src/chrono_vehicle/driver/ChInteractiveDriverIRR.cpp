@@ -120,19 +120,31 @@ bool ChInteractiveDriverIRR::OnEvent(const SEvent& event) {
 }
 
 bool ChInteractiveDriverIRR::ProcessJoystickEvents(const SEvent& event) {
-    // Driver only handles input every 16 ticks (~60 Hz)
-    if (m_joystick_proccess_frame < JoystickProcessFrequency) {
-        m_joystick_proccess_frame++;
-        return true;
+    // Driver only handles input every 16 ticks (~60 Hz), unless input interpolation is enabled,
+    // in which case every event is sampled into the latest-value buffer.
+    if (!m_input_interpolation) {
+        if (m_joystick_proccess_frame < JoystickProcessFrequency) {
+            m_joystick_proccess_frame++;
+            return true;
+        }
+        m_joystick_proccess_frame = 0;
     }
 
-    m_joystick_proccess_frame = 0;
-
     // Update steering, throttle and brake axes...
-    SetSteering(steerAxis.GetValue(event.JoystickEvent));
-    SetThrottle(throttleAxis.GetValue(event.JoystickEvent));
-    SetBraking(brakeAxis.GetValue(event.JoystickEvent));
-    SetClutch(clutchAxis.GetValue(event.JoystickEvent));
+    if (m_input_interpolation) {
+        // Stage the timestamped sample; Synchronize() evaluates the buffer at physics time.
+        DriverInputs inputs;
+        inputs.m_steering = steerAxis.GetValue(event.JoystickEvent);
+        inputs.m_throttle = throttleAxis.GetValue(event.JoystickEvent);
+        inputs.m_braking = brakeAxis.GetValue(event.JoystickEvent);
+        inputs.m_clutch = clutchAxis.GetValue(event.JoystickEvent);
+        m_input_buffer.Push(m_vehicle.GetSystem()->GetChTime(), inputs);
+    } else {
+        SetSteering(steerAxis.GetValue(event.JoystickEvent));
+        SetThrottle(throttleAxis.GetValue(event.JoystickEvent));
+        SetBraking(brakeAxis.GetValue(event.JoystickEvent));
+        SetClutch(clutchAxis.GetValue(event.JoystickEvent));
+    }
 
     // joystick callback
     if (m_callback_button > -1 && m_callback_function != nullptr &&
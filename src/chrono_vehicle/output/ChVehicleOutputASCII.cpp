@@ -16,6 +16,7 @@
 //
 // =============================================================================
 
+#include <cmath>
 #include <iostream>
 
 #include "chrono/physics/ChLinkLock.h"
@@ -27,7 +28,36 @@
 namespace chrono {
 namespace vehicle {
 
-ChVehicleOutputASCII::ChVehicleOutputASCII(const std::string& filename) {
+namespace {
+
+// Collect channel values for change detection.
+void append(std::vector<double>& vals, double v) {
+    vals.push_back(v);
+}
+
+void append(std::vector<double>& vals, const ChVector<>& v) {
+    vals.push_back(v.x());
+    vals.push_back(v.y());
+    vals.push_back(v.z());
+}
+
+void append(std::vector<double>& vals, const ChQuaternion<>& q) {
+    vals.push_back(q.e0());
+    vals.push_back(q.e1());
+    vals.push_back(q.e2());
+    vals.push_back(q.e3());
+}
+
+}  // namespace
+
+ChVehicleOutputASCII::ChVehicleOutputASCII(const std::string& filename)
+    : m_on_change(false),
+      m_threshold(0),
+      m_max_interval(1),
+      m_frame(0),
+      m_time_pending(false),
+      m_section_pending(false),
+      m_time(0) {
     m_stream.open(filename, std::ios_base::out);
 }
 
@@ -35,17 +65,94 @@ ChVehicleOutputASCII::~ChVehicleOutputASCII() {
     m_stream.close();
 }
 
+void ChVehicleOutputASCII::SetOutputOnChange(double threshold, int max_interval) {
+    m_on_change = true;
+    m_threshold = threshold;
+    m_max_interval = max_interval;
+}
+
+bool ChVehicleOutputASCII::ShouldWrite(const std::string& key, const std::vector<double>& values) {
+    if (!m_on_change)
+        return true;
+
+    auto it = m_last.find(key);
+    if (it == m_last.end()) {
+        m_last.insert({key, {m_frame, values}});
+        return true;
+    }
+
+    auto& last = it->second;
+
+    // Write if the maximum interval elapsed or if any channel changed significantly
+    bool write = (m_frame - last.first >= m_max_interval) || (last.second.size() != values.size());
+    if (!write) {
+        for (size_t i = 0; i < values.size(); i++) {
+            if (std::abs(values[i] - last.second[i]) > m_threshold * std::max(1.0, std::abs(last.second[i]))) {
+                write = true;
+                break;
+            }
+        }
+    }
+
+    if (write) {
+        last.first = m_frame;
+        last.second = values;
+    }
+    return write;
+}
+
+void ChVehicleOutputASCII::FlushHeaders() {
+    if (m_time_pending) {
+        m_stream << "=====================================\n";
+        m_stream << "Time: " << m_time << std::endl;
+        m_time_pending = false;
+    }
+    if (m_section_pending) {
+        m_stream << "  \"" << m_section << "\"" << std::endl;
+        m_section_pending = false;
+    }
+}
+
 void ChVehicleOutputASCII::WriteTime(int frame, double time) {
+    m_frame = frame;
+    m_time = time;
+
+    // With event-based output, defer the header until an item line is actually written
+    if (m_on_change) {
+        m_time_pending = true;
+        return;
+    }
+
     m_stream << "=====================================\n";
     m_stream << "Time: " << time << std::endl;
 }
 
 void ChVehicleOutputASCII::WriteSection(const std::string& name) {
+    m_section = name;
+
+    if (m_on_change) {
+        m_section_pending = true;
+        return;
+    }
+
     m_stream << "  \"" << name << "\"" << std::endl;
 }
 
 void ChVehicleOutputASCII::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
     for (auto body : bodies) {
+        if (m_on_change) {
+            std::vector<double> vals;
+            append(vals, body->GetPos());
+            append(vals, body->GetRot());
+            append(vals, body->GetPos_dt());
+            append(vals, body->GetWvel_par());
+            append(vals, body->GetPos_dtdt());
+            append(vals, body->GetWacc_par());
+            if (!ShouldWrite(m_section + "|body|" + std::to_string(body->GetIdentifier()), vals))
+                continue;
+        }
+        FlushHeaders();
+
         m_stream << "    body: " << body->GetIdentifier() << " \"" << body->GetNameString() << "\" ";
         m_stream << body->GetPos() << " " << body->GetRot() << " ";
         m_stream << body->GetPos_dt() << " " << body->GetWvel_par() << " ";
@@ -61,6 +168,22 @@ void ChVehicleOutputASCII::WriteAuxRefBodies(const std::vector<std::shared_ptr<C
         auto& ref_vel = body->GetFrame_REF_to_abs().GetPos_dt();
         auto& ref_acc = body->GetFrame_REF_to_abs().GetPos_dtdt();
 
+        if (m_on_change) {
+            std::vector<double> vals;
+            append(vals, body->GetPos());
+            append(vals, body->GetRot());
+            append(vals, body->GetPos_dt());
+            append(vals, body->GetWvel_par());
+            append(vals, body->GetPos_dtdt());
+            append(vals, body->GetWacc_par());
+            append(vals, ref_pos);
+            append(vals, ref_vel);
+            append(vals, ref_acc);
+            if (!ShouldWrite(m_section + "|body auxref|" + std::to_string(body->GetIdentifier()), vals))
+                continue;
+        }
+        FlushHeaders();
+
         m_stream << "    body auxref: " << body->GetIdentifier() << " \"" << body->GetNameString() << "\" ";
         m_stream << body->GetPos() << " " << body->GetRot() << " ";
         m_stream << body->GetPos_dt() << " " << body->GetWvel_par() << " ";
@@ -73,6 +196,16 @@ void ChVehicleOutputASCII::WriteAuxRefBodies(const std::vector<std::shared_ptr<C
 
 void ChVehicleOutputASCII::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
     for (auto marker : markers) {
+        if (m_on_change) {
+            std::vector<double> vals;
+            append(vals, marker->GetAbsCoord().pos);
+            append(vals, marker->GetAbsCoord_dt().pos);
+            append(vals, marker->GetAbsCoord_dtdt().pos);
+            if (!ShouldWrite(m_section + "|marker|" + std::to_string(marker->GetIdentifier()), vals))
+                continue;
+        }
+        FlushHeaders();
+
         m_stream << "    marker: " << marker->GetIdentifier() << " \"" << marker->GetNameString() << "\" ";
         m_stream << marker->GetAbsCoord().pos << " ";
         m_stream << marker->GetAbsCoord_dt().pos << " ";
@@ -84,6 +217,17 @@ void ChVehicleOutputASCII::WriteMarkers(const std::vector<std::shared_ptr<ChMark
 
 void ChVehicleOutputASCII::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
     for (auto shaft : shafts) {
+        if (m_on_change) {
+            std::vector<double> vals;
+            append(vals, shaft->GetPos());
+            append(vals, shaft->GetPos_dt());
+            append(vals, shaft->GetPos_dtdt());
+            append(vals, shaft->GetAppliedTorque());
+            if (!ShouldWrite(m_section + "|shaft|" + std::to_string(shaft->GetIdentifier()), vals))
+                continue;
+        }
+        FlushHeaders();
+
         m_stream << "    shaft: " << shaft->GetIdentifier() << " \"" << shaft->GetNameString() << "\" ";
         m_stream << shaft->GetPos() << " " << shaft->GetPos_dt() << " " << shaft->GetPos_dtdt() << " ";
         m_stream << shaft->GetAppliedTorque() << " ";
@@ -99,6 +243,17 @@ void ChVehicleOutputASCII::WriteJoints(const std::vector<std::shared_ptr<ChLink>
         for (int i = 0; i < C.size(); i++)
             violations.push_back(C(i));
 
+        if (m_on_change) {
+            std::vector<double> vals;
+            append(vals, joint->Get_react_force());
+            append(vals, joint->Get_react_torque());
+            for (const auto& val : violations)
+                append(vals, val);
+            if (!ShouldWrite(m_section + "|joint|" + std::to_string(joint->GetIdentifier()), vals))
+                continue;
+        }
+        FlushHeaders();
+
         m_stream << "    joint: " << joint->GetIdentifier() << " \"" << joint->GetNameString() << "\" ";
         m_stream << joint->Get_react_force() << " " << joint->Get_react_torque() << " ";
         for (const auto& val : violations) {
@@ -111,6 +266,18 @@ void ChVehicleOutputASCII::WriteJoints(const std::vector<std::shared_ptr<ChLink>
 
 void ChVehicleOutputASCII::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
     for (auto couple : couples) {
+        if (m_on_change) {
+            std::vector<double> vals;
+            append(vals, couple->GetRelativeRotation());
+            append(vals, couple->GetRelativeRotation_dt());
+            append(vals, couple->GetRelativeRotation_dtdt());
+            append(vals, couple->GetTorqueReactionOn1());
+            append(vals, couple->GetTorqueReactionOn2());
+            if (!ShouldWrite(m_section + "|couple|" + std::to_string(couple->GetIdentifier()), vals))
+                continue;
+        }
+        FlushHeaders();
+
         m_stream << "    couple: " << couple->GetIdentifier() << " \"" << couple->GetNameString() << "\" ";
         m_stream << couple->GetRelativeRotation() << " " << couple->GetRelativeRotation_dt() << " "
                  << couple->GetRelativeRotation_dtdt() << " ";
@@ -122,6 +289,18 @@ void ChVehicleOutputASCII::WriteCouples(const std::vector<std::shared_ptr<ChShaf
 
 void ChVehicleOutputASCII::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
     for (auto spring : springs) {
+        if (m_on_change) {
+            std::vector<double> vals;
+            append(vals, spring->GetPoint1Abs());
+            append(vals, spring->GetPoint2Abs());
+            append(vals, spring->GetLength());
+            append(vals, spring->GetVelocity());
+            append(vals, spring->GetForce());
+            if (!ShouldWrite(m_section + "|lin spring|" + std::to_string(spring->GetIdentifier()), vals))
+                continue;
+        }
+        FlushHeaders();
+
         m_stream << "    lin spring: " << spring->GetIdentifier() << " \"" << spring->GetNameString() << "\" ";
         m_stream << spring->GetPoint1Abs() << " " << spring->GetPoint2Abs() << " ";
         m_stream << spring->GetLength() << " " << spring->GetVelocity() << " ";
@@ -133,6 +312,16 @@ void ChVehicleOutputASCII::WriteLinSprings(const std::vector<std::shared_ptr<ChL
 
 void ChVehicleOutputASCII::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
     for (auto spring : springs) {
+        if (m_on_change) {
+            std::vector<double> vals;
+            append(vals, spring->GetAngle());
+            append(vals, spring->GetVelocity());
+            append(vals, spring->GetTorque());
+            if (!ShouldWrite(m_section + "|rot spring|" + std::to_string(spring->GetIdentifier()), vals))
+                continue;
+        }
+        FlushHeaders();
+
         m_stream << "    rot spring: " << spring->GetIdentifier() << " \"" << spring->GetNameString() << "\" ";
         m_stream << spring->GetAngle() << " " << spring->GetVelocity() << " ";
         m_stream << spring->GetTorque() << " ";
@@ -143,6 +332,15 @@ void ChVehicleOutputASCII::WriteRotSprings(const std::vector<std::shared_ptr<ChL
 
 void ChVehicleOutputASCII::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
     for (auto load : loads) {
+        if (m_on_change) {
+            std::vector<double> vals;
+            append(vals, load->GetForce());
+            append(vals, load->GetTorque());
+            if (!ShouldWrite(m_section + "|body-body load|" + std::to_string(load->GetIdentifier()), vals))
+                continue;
+        }
+        FlushHeaders();
+
         m_stream << "    body-body load: " << load->GetIdentifier() << " \"" << load->GetNameString() << "\" ";
         m_stream << load->GetForce() << " " << load->GetTorque() << " ";
         m_stream << std::endl;
@@ -21,6 +21,9 @@
 
 #include <string>
 #include <fstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "chrono_vehicle/ChVehicleOutput.h"
 
@@ -36,7 +39,23 @@ class CH_VEHICLE_API ChVehicleOutputASCII : public ChVehicleOutput {
     ChVehicleOutputASCII(const std::string& filename);
     ~ChVehicleOutputASCII();
 
+    /// Enable event-based output with change detection (default: disabled, all items written every frame).
+    /// When enabled, an item line is written only if at least one of its channel values differs from the
+    /// last written value by more than the given threshold (relative to the magnitude of that value, with
+    /// an absolute floor of the threshold itself), or if the item has not been written for 'max_interval'
+    /// consecutive output frames. Mostly-constant channels then cost one line per max_interval frames
+    /// instead of one per frame.
+    void SetOutputOnChange(double threshold, int max_interval);
+
   private:
+    /// Decide whether the item with the given key must be written, given its current channel values.
+    /// Updates the change-detection state when the decision is positive.
+    bool ShouldWrite(const std::string& key, const std::vector<double>& values);
+
+    /// Write any pending time and section headers (deferred until an item line is actually written,
+    /// so that frames with no changes cost nothing).
+    void FlushHeaders();
+
     virtual void WriteTime(int frame, double time) override;
     virtual void WriteSection(const std::string& name) override;
 
@@ -51,6 +70,18 @@ class CH_VEHICLE_API ChVehicleOutputASCII : public ChVehicleOutput {
     virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
 
     std::ofstream m_stream;
+
+    bool m_on_change;        ///< event-based output enabled
+    double m_threshold;      ///< per-channel relative change threshold
+    int m_max_interval;      ///< maximum number of output frames between writes of the same item
+    int m_frame;             ///< current output frame
+    std::string m_section;   ///< current section name
+    bool m_time_pending;     ///< time header not written yet for the current frame
+    bool m_section_pending;  ///< section header not written yet for the current section
+    double m_time;           ///< current output time
+
+    /// Last written values per item: output frame and channel values at the last write.
+    std::unordered_map<std::string, std::pair<int, std::vector<double>>> m_last;
 };
 
 /// @} vehicle
@@ -0,0 +1,193 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Binary vehicle output database.
+//
+// =============================================================================
+
+#include <cstdint>
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkUniversal.h"
+#include "chrono/physics/ChLinkDistance.h"
+
+#include "chrono_vehicle/output/ChVehicleOutputBIN.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChVehicleOutputBIN::ChVehicleOutputBIN(const std::string& filename) {
+    m_stream.open(filename, std::ios_base::out | std::ios_base::binary);
+    m_stream.write("CHVOBIN1", 8);
+}
+
+ChVehicleOutputBIN::~ChVehicleOutputBIN() {
+    m_stream.close();
+}
+
+void ChVehicleOutputBIN::WriteTag(char tag, size_t count) {
+    uint32_t n = (uint32_t)count;
+    m_stream.write(&tag, 1);
+    m_stream.write(reinterpret_cast<const char*>(&n), sizeof(n));
+}
+
+void ChVehicleOutputBIN::WriteItem(int id, const std::string& name) {
+    int32_t val = (int32_t)id;
+    uint32_t len = (uint32_t)name.size();
+    m_stream.write(reinterpret_cast<const char*>(&val), sizeof(val));
+    m_stream.write(reinterpret_cast<const char*>(&len), sizeof(len));
+    m_stream.write(name.data(), len);
+}
+
+void ChVehicleOutputBIN::WriteValue(double val) {
+    m_stream.write(reinterpret_cast<const char*>(&val), sizeof(val));
+}
+
+void ChVehicleOutputBIN::WriteVector(const ChVector<>& v) {
+    WriteValue(v.x());
+    WriteValue(v.y());
+    WriteValue(v.z());
+}
+
+void ChVehicleOutputBIN::WriteQuaternion(const ChQuaternion<>& q) {
+    WriteValue(q.e0());
+    WriteValue(q.e1());
+    WriteValue(q.e2());
+    WriteValue(q.e3());
+}
+
+void ChVehicleOutputBIN::WriteTime(int frame, double time) {
+    int32_t val = (int32_t)frame;
+    WriteTag('T', 1);
+    m_stream.write(reinterpret_cast<const char*>(&val), sizeof(val));
+    WriteValue(time);
+}
+
+void ChVehicleOutputBIN::WriteSection(const std::string& name) {
+    uint32_t len = (uint32_t)name.size();
+    WriteTag('S', 1);
+    m_stream.write(reinterpret_cast<const char*>(&len), sizeof(len));
+    m_stream.write(name.data(), len);
+}
+
+void ChVehicleOutputBIN::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    WriteTag('B', bodies.size());
+    for (auto body : bodies) {
+        WriteItem(body->GetIdentifier(), body->GetNameString());
+        WriteVector(body->GetPos());
+        WriteQuaternion(body->GetRot());
+        WriteVector(body->GetPos_dt());
+        WriteVector(body->GetWvel_par());
+        WriteVector(body->GetPos_dtdt());
+        WriteVector(body->GetWacc_par());
+    }
+}
+
+void ChVehicleOutputBIN::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
+    WriteTag('A', bodies.size());
+    for (auto body : bodies) {
+        WriteItem(body->GetIdentifier(), body->GetNameString());
+        WriteVector(body->GetPos());
+        WriteQuaternion(body->GetRot());
+        WriteVector(body->GetPos_dt());
+        WriteVector(body->GetWvel_par());
+        WriteVector(body->GetPos_dtdt());
+        WriteVector(body->GetWacc_par());
+        WriteVector(body->GetFrame_REF_to_abs().GetPos());
+        WriteVector(body->GetFrame_REF_to_abs().GetPos_dt());
+        WriteVector(body->GetFrame_REF_to_abs().GetPos_dtdt());
+    }
+}
+
+void ChVehicleOutputBIN::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
+    WriteTag('M', markers.size());
+    for (auto marker : markers) {
+        WriteItem(marker->GetIdentifier(), marker->GetNameString());
+        WriteVector(marker->GetAbsCoord().pos);
+        WriteVector(marker->GetAbsCoord_dt().pos);
+        WriteVector(marker->GetAbsCoord_dtdt().pos);
+    }
+}
+
+void ChVehicleOutputBIN::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    WriteTag('H', shafts.size());
+    for (auto shaft : shafts) {
+        WriteItem(shaft->GetIdentifier(), shaft->GetNameString());
+        WriteValue(shaft->GetPos());
+        WriteValue(shaft->GetPos_dt());
+        WriteValue(shaft->GetPos_dtdt());
+        WriteValue(shaft->GetAppliedTorque());
+    }
+}
+
+void ChVehicleOutputBIN::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+    WriteTag('J', joints.size());
+    for (const auto& joint : joints) {
+        auto C = joint->GetConstraintViolation();
+        uint32_t nviol = (uint32_t)C.size();
+
+        WriteItem(joint->GetIdentifier(), joint->GetNameString());
+        WriteVector(joint->Get_react_force());
+        WriteVector(joint->Get_react_torque());
+        m_stream.write(reinterpret_cast<const char*>(&nviol), sizeof(nviol));
+        for (int i = 0; i < C.size(); i++)
+            WriteValue(C(i));
+    }
+}
+
+void ChVehicleOutputBIN::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
+    WriteTag('C', couples.size());
+    for (auto couple : couples) {
+        WriteItem(couple->GetIdentifier(), couple->GetNameString());
+        WriteValue(couple->GetRelativeRotation());
+        WriteValue(couple->GetRelativeRotation_dt());
+        WriteValue(couple->GetRelativeRotation_dtdt());
+        WriteValue(couple->GetTorqueReactionOn1());
+        WriteValue(couple->GetTorqueReactionOn2());
+    }
+}
+
+void ChVehicleOutputBIN::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
+    WriteTag('L', springs.size());
+    for (auto spring : springs) {
+        WriteItem(spring->GetIdentifier(), spring->GetNameString());
+        WriteVector(spring->GetPoint1Abs());
+        WriteVector(spring->GetPoint2Abs());
+        WriteValue(spring->GetLength());
+        WriteValue(spring->GetVelocity());
+        WriteValue(spring->GetForce());
+    }
+}
+
+void ChVehicleOutputBIN::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
+    WriteTag('R', springs.size());
+    for (auto spring : springs) {
+        WriteItem(spring->GetIdentifier(), spring->GetNameString());
+        WriteValue(spring->GetAngle());
+        WriteValue(spring->GetVelocity());
+        WriteValue(spring->GetTorque());
+    }
+}
+
+void ChVehicleOutputBIN::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
+    WriteTag('F', loads.size());
+    for (auto load : loads) {
+        WriteItem(load->GetIdentifier(), load->GetNameString());
+        WriteVector(load->GetForce());
+        WriteVector(load->GetTorque());
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,73 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Binary vehicle output database.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_OUTPUT_BIN_H
+#define CH_VEHICLE_OUTPUT_BIN_H
+
+#include <string>
+#include <fstream>
+
+#include "chrono_vehicle/ChVehicleOutput.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Binary vehicle output database.
+/// Writes the same quantities as ChVehicleOutputASCII, but as raw little-endian binary records, avoiding the
+/// iostream formatting cost and producing files that can be parsed back without text conversion. The file
+/// starts with the 8-character magic "CHVOBIN1"; each subsequent record is a 1-character tag followed by its
+/// payload. Section records ('B' bodies, 'A' aux-ref bodies, 'M' markers, 'H' shafts, 'J' joints, 'C' couples,
+/// 'L' lin springs, 'R' rot springs, 'F' body loads) carry a uint32 item count followed by the items; strings
+/// are written as a uint32 length followed by the characters; vectors and quaternions as 3 and 4 doubles.
+class CH_VEHICLE_API ChVehicleOutputBIN : public ChVehicleOutput {
+  public:
+    ChVehicleOutputBIN(const std::string& filename);
+    ~ChVehicleOutputBIN();
+
+  private:
+    virtual void WriteTime(int frame, double time) override;
+    virtual void WriteSection(const std::string& name) override;
+
+    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
+    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
+    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
+    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
+    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
+    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
+    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) override;
+    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) override;
+    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+
+    void WriteTag(char tag, size_t count);
+    void WriteItem(int id, const std::string& name);
+    void WriteValue(double val);
+    void WriteVector(const ChVector<>& v);
+    void WriteQuaternion(const ChQuaternion<>& q);
+
+    std::ofstream m_stream;
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
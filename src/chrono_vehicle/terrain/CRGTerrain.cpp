@@ -31,6 +31,8 @@
 //==============================================================================
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include "chrono/core/ChLog.h"
 #include "chrono/assets/ChPathShape.h"
@@ -66,7 +68,12 @@ CRGTerrain::CRGTerrain(ChSystem* system)
       m_friction(0.8f),
       m_dataSetId(0),
       m_cpId(0),
-      m_isClosed(false) {
+      m_isClosed(false),
+      m_hf_nx(0),
+      m_hf_ny(0),
+      m_hf_x0(0),
+      m_hf_y0(0),
+      m_hf_spacing(0) {
     m_ground = std::shared_ptr<ChBody>(system->NewBody());
     m_ground->SetName("ground");
     m_ground->SetPos(ChVector<>(0, 0, 0));
@@ -260,8 +267,128 @@ ChCoordsys<> CRGTerrain::GetStartPosition() {
     return ChCoordsys<>(ChVector<>(x, y, z), Q_from_AngZ(GetStartHeading()));
 }
 
+void CRGTerrain::EnableHeightFieldCache(double spacing) {
+    if (spacing <= 0) {
+        GetLog() << "CRGTerrain::EnableHeightFieldCache(): spacing must be positive\n";
+        return;
+    }
+
+    // Determine the Cartesian bounding box of the road by walking its two lateral boundaries.
+    double uinc = (m_uinc > 0) ? m_uinc : (m_uend - m_ubeg) / 1000;
+    double xmin = std::numeric_limits<double>::max();
+    double xmax = -std::numeric_limits<double>::max();
+    double ymin = std::numeric_limits<double>::max();
+    double ymax = -std::numeric_limits<double>::max();
+    for (double u = m_ubeg; u <= m_uend + 0.5 * uinc; u += uinc) {
+        double x, y;
+        for (double v : {m_vbeg, m_vend}) {
+            if (crgEvaluv2xy(m_cpId, std::min(u, m_uend), v, &x, &y) == 1) {
+                xmin = std::min(xmin, x);
+                xmax = std::max(xmax, x);
+                ymin = std::min(ymin, y);
+                ymax = std::max(ymax, y);
+            }
+        }
+    }
+
+    m_hf_spacing = spacing;
+    m_hf_x0 = xmin;
+    m_hf_y0 = ymin;
+    m_hf_nx = std::max((int)std::ceil((xmax - xmin) / spacing) + 1, 2);
+    m_hf_ny = std::max((int)std::ceil((ymax - ymin) / spacing) + 1, 2);
+
+    // Sample the CRG surface once at every grid node (with the same u/v clamping as GetHeight, so nodes outside
+    // the road carry the height of the nearest road point and queries off the road remain well defined).
+    m_hf_z.resize((size_t)m_hf_nx * m_hf_ny);
+    for (int iy = 0; iy < m_hf_ny; iy++) {
+        for (int ix = 0; ix < m_hf_nx; ix++) {
+            double u, v;
+            double z = 0;
+            if (crgEvalxy2uv(m_cpId, m_hf_x0 + ix * spacing, m_hf_y0 + iy * spacing, &u, &v) == 1) {
+                ChClampValue(u, m_ubeg, m_uend);
+                ChClampValue(v, m_vbeg, m_vend);
+                crgEvaluv2z(m_cpId, u, v, &z);
+            }
+            m_hf_z[(size_t)iy * m_hf_nx + ix] = z;
+        }
+    }
+}
+
+double CRGTerrain::SampleCache(double x, double y) const {
+    // Bilinear interpolation, clamped to the grid bounds.
+    double gx = (x - m_hf_x0) / m_hf_spacing;
+    double gy = (y - m_hf_y0) / m_hf_spacing;
+    ChClampValue(gx, 0.0, (double)(m_hf_nx - 1));
+    ChClampValue(gy, 0.0, (double)(m_hf_ny - 1));
+    int ix = std::min((int)gx, m_hf_nx - 2);
+    int iy = std::min((int)gy, m_hf_ny - 2);
+    double fx = gx - ix;
+    double fy = gy - iy;
+    const double* row0 = &m_hf_z[(size_t)iy * m_hf_nx + ix];
+    const double* row1 = row0 + m_hf_nx;
+    double z0 = row0[0] + fx * (row0[1] - row0[0]);
+    double z1 = row1[0] + fx * (row1[1] - row1[0]);
+    return z0 + fy * (z1 - z0);
+}
+
+void CRGTerrain::GetHeights(const std::vector<ChVector<>>& locs, std::vector<double>& heights) const {
+    heights.resize(locs.size());
+
+    if (!m_hf_z.empty()) {
+        // The cache is immutable after construction, so the probes can be evaluated concurrently.
+#pragma omp parallel for
+        for (int i = 0; i < (int)locs.size(); i++) {
+            ChVector<> loc_ISO = ChWorldFrame::ToISO(locs[i]);
+            heights[i] = SampleCache(loc_ISO.x(), loc_ISO.y());
+        }
+        return;
+    }
+
+    // Without the cache, fall back to serial evaluation (the CRG contact point is not thread-safe).
+    for (size_t i = 0; i < locs.size(); i++)
+        heights[i] = GetHeight(locs[i]);
+}
+
+void CRGTerrain::QueryBatch(const std::vector<ChVector<>>& locs,
+                            std::vector<double>& heights,
+                            std::vector<ChVector<>>& normals,
+                            std::vector<float>& frictions) const {
+    int np = (int)locs.size();
+    heights.resize(np);
+    normals.resize(np);
+    frictions.resize(np);
+
+    if (!m_hf_z.empty()) {
+        // With the height-field cache, both the height and the (finite-difference) normal queries only read the
+        // immutable cache, so the probes can be evaluated concurrently.
+#pragma omp parallel for
+        for (int i = 0; i < np; i++) {
+            ChVector<> loc_ISO = ChWorldFrame::ToISO(locs[i]);
+            heights[i] = SampleCache(loc_ISO.x(), loc_ISO.y());
+            normals[i] = GetNormal(locs[i]);
+        }
+    } else {
+        // Without the cache, fall back to serial evaluation (the CRG contact point is not thread-safe)
+        for (int i = 0; i < np; i++) {
+            heights[i] = GetHeight(locs[i]);
+            normals[i] = GetNormal(locs[i]);
+        }
+    }
+
+    if (m_friction_fun) {
+        for (int i = 0; i < np; i++)
+            frictions[i] = (*m_friction_fun)(locs[i]);
+    } else {
+        std::fill(frictions.begin(), frictions.end(), m_friction);
+    }
+}
+
 double CRGTerrain::GetHeight(const ChVector<>& loc) const {
     ChVector<> loc_ISO = ChWorldFrame::ToISO(loc);
+
+    if (!m_hf_z.empty())
+        return SampleCache(loc_ISO.x(), loc_ISO.y());
+
     double u, v, z;
     int uv_ok = crgEvalxy2uv(m_cpId, loc_ISO.x(), loc_ISO.y(), &u, &v);
     if (uv_ok != 1) {
@@ -77,12 +77,36 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
 
     ~CRGTerrain();
 
+    /// Build a regular height-field cache of the road surface (optional; call after Initialize).
+    /// The CRG surface is sampled once on a regular Cartesian grid with the given spacing, covering the road
+    /// bounding box. Subsequent height queries are answered by bilinear interpolation in this grid instead of
+    /// going through the OpenCRG evaluation chain; this is considerably faster for query-heavy consumers (tire
+    /// models probing many contact patch points per step) and makes the queries thread-safe. Heights are exact at
+    /// the grid nodes and interpolated in between, so the spacing should be chosen comparable to the CRG u/v
+    /// increments. Memory use is one double per grid node.
+    void EnableHeightFieldCache(double spacing);
+
     /// Get the terrain height below the specified location.
     virtual double GetHeight(const ChVector<>& loc) const override;
 
     /// Get the terrain normal at the point below the specified location.
     virtual ChVector<> GetNormal(const ChVector<>& loc) const override;
 
+    /// Get the terrain height below each of the specified locations.
+    /// The output vector is resized as needed. If the height-field cache is enabled (see EnableHeightFieldCache),
+    /// the probes are evaluated in parallel over OpenMP threads; otherwise this falls back to serial OpenCRG
+    /// evaluation, equivalent to calling GetHeight per location.
+    void GetHeights(const std::vector<ChVector<>>& locs, std::vector<double>& heights) const;
+
+    /// Get all terrain characteristics at the points below a batch of locations.
+    /// If the height-field cache is enabled (see EnableHeightFieldCache), height and normal probes are evaluated in
+    /// parallel over OpenMP threads; otherwise the batch falls back to serial OpenCRG evaluation (the CRG contact
+    /// point is not thread-safe). Friction coefficients are evaluated sequentially if a user functor was registered.
+    virtual void QueryBatch(const std::vector<ChVector<>>& locs,
+                            std::vector<double>& heights,
+                            std::vector<ChVector<>>& normals,
+                            std::vector<float>& frictions) const override;
+
     /// Get the terrain coefficient of friction at the point below the specified location.
     /// This coefficient of friction value may be used by certain tire models to modify
     /// the tire characteristics, but it will have no effect on the interaction of the terrain
@@ -178,6 +202,14 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     double m_vinc, m_vbeg, m_vend;  // increment, begin , end of lateral road coordinates
 
     std::vector<double> m_v;  // vector with distinct v values, if m_vinc <= 0.01 m
+
+    /// Sample the height-field cache with bilinear interpolation (cache must be enabled).
+    double SampleCache(double x, double y) const;
+
+    std::vector<double> m_hf_z;      // height-field cache (row-major, ny rows of nx samples); empty if disabled
+    int m_hf_nx, m_hf_ny;            // height-field cache resolution
+    double m_hf_x0, m_hf_y0;         // ISO coordinates of the first cache sample
+    double m_hf_spacing;             // cache grid spacing
 };
 
 /// @} vehicle_terrain
@@ -18,6 +18,7 @@
 
 #include <limits>
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstdio>
 
@@ -234,8 +235,27 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
     AddPatch(patch, position, material);
     patch->m_visualize = visualization;
 
+    // Cache mesh specification (needed for lazily-loaded patches)
+    patch->m_mesh_file = mesh_file;
+    patch->m_material = material;
+    patch->m_connected_mesh = connected_mesh;
+    patch->m_sweep_sphere_radius = sweep_sphere_radius;
+    patch->m_mesh_name = filesystem::path(mesh_file).stem();
+    patch->m_type = PatchType::MESH;
+
+    // If patch streaming is enabled, defer mesh loading and contact model construction until a tracked body
+    // approaches this patch (see Synchronize). Until then, keep the patch out of the collision system.
+    if (!m_stream_refs.empty()) {
+        patch->m_loaded = false;
+        patch->m_radius = 0;
+        patch->m_body->SetCollide(false);
+        return patch;
+    }
+
     // Load mesh from file
     patch->m_trimesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(mesh_file, true, true);
+    if (!connected_mesh)
+        patch->m_trimesh_s = geometry::ChTriangleMeshSoup::CreateFromWavefrontFile(mesh_file);
 
     // Create the collision model
     patch->m_body->GetCollisionModel()->ClearModel();
@@ -243,14 +263,11 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
         patch->m_body->GetCollisionModel()->AddTriangleMesh(material, patch->m_trimesh, true, false, VNULL,
                                                             ChMatrix33<>(1), sweep_sphere_radius);
     } else {
-        patch->m_trimesh_s = geometry::ChTriangleMeshSoup::CreateFromWavefrontFile(mesh_file);
         patch->m_body->GetCollisionModel()->AddTriangleMesh(material, patch->m_trimesh_s, true, false, VNULL,
                                                             ChMatrix33<>(1), sweep_sphere_radius);
     }
     patch->m_body->GetCollisionModel()->BuildModel();
 
-    auto mesh_name = filesystem::path(mesh_file).stem();
-
     // Cache patch parameters
     patch->m_radius =
         std::max_element(patch->m_trimesh->getCoordsVertices().begin(),                                      //
@@ -259,9 +276,6 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
                          )
             ->Length();
 
-    patch->m_mesh_name = mesh_name;
-    patch->m_type = PatchType::MESH;
-
     return patch;
 }
 
@@ -535,7 +549,7 @@ void RigidTerrain::BoxPatch::Initialize() {
 }
 
 void RigidTerrain::MeshPatch::Initialize() {
-    if (m_visualize) {
+    if (m_visualize && m_trimesh) {
         m_body->AddVisualModel(chrono_types::make_shared<ChVisualModel>());
         auto trimesh_shape = chrono_types::make_shared<ChTriangleMeshShape>();
         trimesh_shape->AddMaterial(m_vis_mat);
@@ -546,6 +560,94 @@ void RigidTerrain::MeshPatch::Initialize() {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Proximity-based streaming of patch collision models
+// -----------------------------------------------------------------------------
+
+void RigidTerrain::EnablePatchStreaming(std::shared_ptr<ChBody> body, double distance) {
+    m_stream_refs.push_back(std::make_pair(body, distance));
+}
+
+// Launch loading of the patch mesh on a background thread.
+// Only the mesh objects are touched by the worker; they are read on the simulation thread
+// exclusively after the future completes (in CompleteLoad).
+void RigidTerrain::MeshPatch::StartLoad() {
+    m_load_result = std::async(std::launch::async, [this]() {
+        m_trimesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(m_mesh_file, true, true);
+        if (!m_connected_mesh)
+            m_trimesh_s = geometry::ChTriangleMeshSoup::CreateFromWavefrontFile(m_mesh_file);
+    });
+}
+
+// Construct the patch contact model from the loaded mesh.
+// This must be called on the simulation thread, with the load future completed.
+void RigidTerrain::MeshPatch::CompleteLoad(int collision_family) {
+    m_load_result.get();
+
+    m_body->GetCollisionModel()->ClearModel();
+    if (m_connected_mesh) {
+        m_body->GetCollisionModel()->AddTriangleMesh(m_material, m_trimesh, true, false, VNULL, ChMatrix33<>(1),
+                                                     m_sweep_sphere_radius);
+    } else {
+        m_body->GetCollisionModel()->AddTriangleMesh(m_material, m_trimesh_s, true, false, VNULL, ChMatrix33<>(1),
+                                                     m_sweep_sphere_radius);
+    }
+    m_body->GetCollisionModel()->BuildModel();
+    m_body->GetCollisionModel()->SetFamily(collision_family);
+    m_body->GetCollisionModel()->SetFamilyMaskNoCollisionWithFamily(collision_family);
+
+    m_radius =
+        std::max_element(m_trimesh->getCoordsVertices().begin(),                                             //
+                         m_trimesh->getCoordsVertices().end(),                                               //
+                         [](const ChVector<>& a, const ChVector<>& b) { return a.Length2() < b.Length2(); }  //
+                         )
+            ->Length();
+
+    // Create the (deferred) visualization assets
+    Initialize();
+
+    m_loaded = true;
+}
+
+void RigidTerrain::Synchronize(double time) {
+    if (m_stream_refs.empty())
+        return;
+
+    for (auto& patch : m_patches) {
+        // Distance from the nearest tracked body to the patch bounding sphere, offset by the
+        // activation distance associated with that body (resident if negative)
+        double sep = std::numeric_limits<double>::max();
+        for (const auto& ref : m_stream_refs) {
+            double d = (ref.first->GetPos() - patch->m_body->GetPos()).Length() - patch->m_radius - ref.second;
+            sep = std::min(sep, d);
+        }
+
+        // Manage lazily-loaded mesh patches: prefetch within twice the activation distance, so that the
+        // background load typically completes before the patch must become resident; a patch with a load
+        // still in flight simply stays out of the collision system until the load completes.
+        auto mpatch = std::dynamic_pointer_cast<MeshPatch>(patch);
+        if (mpatch && !mpatch->m_loaded) {
+            if (!mpatch->m_load_result.valid()) {
+                double prefetch = std::numeric_limits<double>::max();
+                for (const auto& ref : m_stream_refs)
+                    prefetch = std::min(
+                        prefetch, (ref.first->GetPos() - patch->m_body->GetPos()).Length() - 2 * ref.second);
+                if (prefetch <= 0)
+                    mpatch->StartLoad();
+            } else if (mpatch->m_load_result.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                mpatch->CompleteLoad(m_collision_family);
+            }
+            if (!mpatch->m_loaded)
+                continue;
+        }
+
+        // Register/unregister the patch collision model based on proximity
+        bool resident = sep <= 0;
+        if (patch->m_body->GetCollide() != resident)
+            patch->m_body->SetCollide(resident);
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Functions for obtaining the terrain height, normal, and coefficient of
 // friction  at the specified location.
@@ -615,6 +717,36 @@ void RigidTerrain::GetProperties(const ChVector<>& loc, double& height, ChVector
         friction = (*m_friction_fun)(loc);
 }
 
+void RigidTerrain::QueryBatch(const std::vector<ChVector<>>& locs,
+                              std::vector<double>& heights,
+                              std::vector<ChVector<>>& normals,
+                              std::vector<float>& frictions) const {
+    int np = (int)locs.size();
+    heights.resize(np);
+    normals.resize(np);
+    frictions.resize(np);
+
+    // Box patch queries are purely analytic (a plane intersection per patch) and can be evaluated concurrently.
+    // Mesh and height-map patches resolve queries through collision system ray casts; play it safe and keep those
+    // sequential. User-registered functors may not be re-entrant either.
+    bool analytic = !m_height_fun && !m_normal_fun && !m_friction_fun;
+    for (const auto& patch : m_patches) {
+        if (patch->m_type != PatchType::BOX)
+            analytic = false;
+    }
+
+    if (analytic) {
+#pragma omp parallel for
+        for (int i = 0; i < np; i++) {
+            GetProperties(locs[i], heights[i], normals[i], frictions[i]);
+        }
+        return;
+    }
+
+    for (int i = 0; i < np; i++)
+        GetProperties(locs[i], heights[i], normals[i], frictions[i]);
+}
+
 bool RigidTerrain::FindPoint(const ChVector<> loc, double& height, ChVector<>& normal, float& friction) const {
     bool hit = false;
     height = std::numeric_limits<double>::lowest();
@@ -653,6 +785,9 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector<>& loc, double& height, Ch
 }
 
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    if (!m_loaded)
+        return false;
+
     ChVector<> from = loc;
     ChVector<> to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
@@ -680,11 +815,15 @@ void RigidTerrain::ExportMeshWavefront(const std::string& out_dir) {
 }
 
 void RigidTerrain::MeshPatch::ExportMeshPovray(const std::string& out_dir, bool smoothed) {
+    if (!m_trimesh)
+        return;
     utils::WriteMeshPovray(*m_trimesh, m_mesh_name, out_dir, ChColor(1, 1, 1), ChVector<>(0, 0, 0),
                            ChQuaternion<>(1, 0, 0, 0), smoothed);
 }
 
 void RigidTerrain::MeshPatch::ExportMeshWavefront(const std::string& out_dir) {
+    if (!m_trimesh)
+        return;
     std::string obj_filename = out_dir + "/" + m_mesh_name + ".obj";
     std::vector<geometry::ChTriangleMeshConnected> meshes = {*m_trimesh};
     std::cout << "Exporting to " << obj_filename << std::endl;
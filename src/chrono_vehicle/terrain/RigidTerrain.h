@@ -19,7 +19,9 @@
 #ifndef RIGID_TERRAIN_H
 #define RIGID_TERRAIN_H
 
+#include <future>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "chrono/assets/ChColor.h"
@@ -190,6 +192,15 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
                                ChVector<>& normal,
                                float& friction) const override;
 
+    /// Get all terrain characteristics at the points below a batch of locations.
+    /// If the terrain consists of box patches only, the queries are purely analytic and are evaluated concurrently;
+    /// otherwise (mesh or height-map patches, which resolve queries through collision system ray casts) the batch is
+    /// processed sequentially, still amortizing the per-call overhead for the caller.
+    virtual void QueryBatch(const std::vector<ChVector<>>& locs,
+                            std::vector<double>& heights,
+                            std::vector<ChVector<>>& normals,
+                            std::vector<float>& frictions) const override;
+
     /// Export all patch meshes as macros in PovRay include files.
     void ExportMeshPovray(const std::string& out_dir, bool smoothed = false);
 
@@ -206,6 +217,22 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// Collision is disabled with all other objects in this family.
     void SetCollisionFamily(int family) { m_collision_family = family; }
 
+    /// Enable proximity-based streaming of patch collision models (default: disabled).
+    /// A patch is registered with the collision system only while the position of at least one tracked body is within
+    /// the given distance from the patch bounding sphere; patches outside this range are removed from the broadphase.
+    /// In addition, mesh patches from Wavefront files added after this call are loaded lazily: the mesh file is read
+    /// and the contact mesh constructed on a background thread as a tracked body approaches the patch, so that large
+    /// tiled terrains do not pay the full load cost up front and the simulation never blocks on a tile load.
+    /// This function may be called more than once to track multiple bodies and must be called before Initialize.
+    /// Note that height, normal, and friction queries only consider patches whose mesh is currently loaded.
+    void EnablePatchStreaming(std::shared_ptr<ChBody> body,  ///< [in] tracked body (typically a vehicle chassis)
+                              double distance                ///< [in] activation distance from patch bounding sphere
+    );
+
+    /// Update the set of resident patches based on current tracked body positions.
+    /// This function is a no-op unless patch streaming was enabled.
+    virtual void Synchronize(double time) override;
+
   private:
     /// Patch represented as a box domain.
     struct CH_VEHICLE_API BoxPatch : public Patch {
@@ -220,9 +247,18 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
 
     /// Patch represented as a mesh.
     struct CH_VEHICLE_API MeshPatch : public Patch {
+        MeshPatch() : m_loaded(true), m_connected_mesh(true), m_sweep_sphere_radius(0) {}
         std::shared_ptr<geometry::ChTriangleMeshConnected> m_trimesh;  ///< associated mesh (contact and visualization)
         std::shared_ptr<geometry::ChTriangleMeshSoup> m_trimesh_s;     ///< associated contact mesh soup
         std::string m_mesh_name;                                       ///< name of associated mesh
+        bool m_loaded;                                                 ///< mesh and contact model currently available?
+        std::string m_mesh_file;                                       ///< mesh filename (for lazily-loaded patches)
+        std::shared_ptr<ChMaterialSurface> m_material;                 ///< contact material (for lazily-loaded patches)
+        bool m_connected_mesh;                                         ///< use connected contact mesh?
+        double m_sweep_sphere_radius;                                  ///< radius of sweep sphere
+        std::future<void> m_load_result;                               ///< handle for in-flight background mesh load
+        void StartLoad();                                              ///< launch mesh load on a background thread
+        void CompleteLoad(int collision_family);                       ///< build contact model from loaded mesh
         virtual void Initialize() override;
         virtual bool FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const override;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
@@ -241,6 +277,8 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     void LoadPatch(const rapidjson::Value& a);
 
     int m_collision_family;
+
+    std::vector<std::pair<std::shared_ptr<ChBody>, double>> m_stream_refs;  ///< tracked bodies and their distances
 };
 
 /// @} vehicle_terrain
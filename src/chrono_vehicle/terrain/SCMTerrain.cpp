@@ -17,6 +17,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
 #include <queue>
@@ -75,6 +76,31 @@ float SCMTerrain::GetCoefficientFriction(const ChVector<>& loc) const {
     return m_friction_fun ? (*m_friction_fun)(loc) : 0.8f;
 }
 
+// Get all terrain characteristics at the points below a batch of locations.
+void SCMTerrain::QueryBatch(const std::vector<ChVector<>>& locs,
+                            std::vector<double>& heights,
+                            std::vector<ChVector<>>& normals,
+                            std::vector<float>& frictions) const {
+    int np = (int)locs.size();
+    heights.resize(np);
+    normals.resize(np);
+    frictions.resize(np);
+
+    // Height and normal queries only read the SCM grid map, so the probes can be evaluated concurrently.
+#pragma omp parallel for
+    for (int i = 0; i < np; i++) {
+        heights[i] = m_loader->GetHeight(locs[i]);
+        normals[i] = m_loader->GetNormal(locs[i]);
+    }
+
+    if (m_friction_fun) {
+        for (int i = 0; i < np; i++)
+            frictions[i] = (*m_friction_fun)(locs[i]);
+    } else {
+        std::fill(frictions.begin(), frictions.end(), 0.8f);
+    }
+}
+
 // Get SCM information at the node closest to the specified location.
 SCMTerrain::NodeInfo SCMTerrain::GetNodeInfo(const ChVector<>& loc) const {
     return m_loader->GetNodeInfo(loc);
@@ -196,6 +222,30 @@ void SCMTerrain::AddMovingPatch(std::shared_ptr<ChBody> body,
     m_loader->m_moving_patch = true;
 }
 
+// Enable coarsening of the stored soil state away from the moving patches.
+void SCMTerrain::EnableGridCoarsening(double distance, int factor) {
+    // Snap the aggregation factor to a divisor of the grid tile size
+    int tile_size = SCMLoader::GridMap::GetTileSize();
+    factor = std::max(2, std::min(factor, tile_size));
+    while (tile_size % factor != 0)
+        factor--;
+
+    m_loader->m_coarsen_distance = distance;
+
+    // When a coarsened tile is refined back, rebase each aggregated record onto the exact undeformed
+    // height and normal at the covered fine nodes, reapplying the aggregated sinkage.
+    SCMLoader* loader = m_loader.get();
+    m_loader->m_grid_map.EnableCoarsening(
+        factor, [loader](const ChVector2<int>& ij, const SCMLoader::NodeRecord& coarse) {
+            double z = loader->GetInitHeight(ij);
+            SCMLoader::NodeRecord nr = coarse;
+            nr.level_initial = z;
+            nr.level = z - coarse.sinkage;
+            nr.normal = loader->GetInitNormal(ij);
+            return nr;
+        });
+}
+
 // Set user-supplied callback for evaluating location-dependent soil parameters.
 void SCMTerrain::RegisterSoilParametersCallback(std::shared_ptr<SoilParametersCallback> cb) {
     m_loader->m_soil_fun = cb;
@@ -221,6 +271,14 @@ void SCMTerrain::Initialize(const std::string& mesh_file, double delta) {
     m_loader->Initialize(mesh_file, delta);
 }
 
+// Initialize the terrain from a user height callback (sampled lazily, in tiles).
+void SCMTerrain::Initialize(std::function<double(double, double)> height_fun,
+                            double sizeX,
+                            double sizeY,
+                            double delta) {
+    m_loader->Initialize(height_fun, sizeX, sizeY, delta);
+}
+
 // Get the heights of modified grid nodes.
 std::vector<SCMTerrain::NodeLevel> SCMTerrain::GetModifiedNodes(bool all_nodes) const {
     return m_loader->GetModifiedNodes(all_nodes);
@@ -347,6 +405,9 @@ SCMLoader::SCMLoader(ChSystem* system, bool visualization_mesh) : m_soil_fun(nul
     m_erosion_iterations = 3;
     m_erosion_propagations = 10;
 
+    // Grid coarsening away from moving patches
+    m_coarsen_distance = 0;
+
     // Default soil parameters
     m_Bekker_Kphi = 2e6;
     m_Bekker_Kc = 0;
@@ -556,6 +617,71 @@ void SCMLoader::Initialize(const std::string& mesh_file, double delta) {
     this->AddVisualShape(m_trimesh_shape);
 }
 
+// Initialize the terrain from a user height callback.
+// No heights are sampled here: tiles of the grid are filled on first access (see SampledHeight),
+// so arbitrarily large patches can be declared without bounding memory use.
+void SCMLoader::Initialize(std::function<double(double, double)> height_fun,
+                           double sizeX,
+                           double sizeY,
+                           double delta) {
+    m_type = PatchType::HEIGHT_FUNCTION;
+
+    m_nx = static_cast<int>(std::ceil((sizeX / 2) / delta));  // half number of divisions in X direction
+    m_ny = static_cast<int>(std::ceil((sizeY / 2) / delta));  // number of divisions in Y direction
+
+    m_delta = sizeX / (2.0 * m_nx);  // grid spacing
+    m_area = std::pow(m_delta, 2);   // area of a cell
+
+    m_height_fun = height_fun;
+    m_height_tiles.clear();
+
+    // Return now if no visualization.
+    // Note that the visualization mesh spans the entire patch and therefore samples the full grid
+    // eagerly, which defeats lazy sampling for huge patches.
+    if (!m_trimesh_shape)
+        return;
+
+    CreateVisualizationMesh(sizeX, sizeY);
+    this->AddVisualShape(m_trimesh_shape);
+}
+
+// Tile bookkeeping for the lazily sampled height source.
+static int htile_floordiv(int i, int size) {
+    return (i >= 0) ? i / size : -((-i - 1) / size) - 1;
+}
+static uint64_t htile_key(int tx, int ty) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(tx)) << 32) | static_cast<uint32_t>(ty);
+}
+
+// Get the lazily sampled height at the specified grid node.
+double SCMLoader::SampledHeight(const ChVector2<int>& loc) const {
+    int tx = htile_floordiv(loc.x(), m_htile_size);
+    int ty = htile_floordiv(loc.y(), m_htile_size);
+    uint64_t key = htile_key(tx, ty);
+
+    auto t = m_height_tiles.find(key);
+    if (t == m_height_tiles.end()) {
+        // Keep the resident set bounded (re-sampling an evicted tile costs only callback calls).
+        if (m_height_tiles.size() >= m_htile_capacity)
+            m_height_tiles.erase(m_height_tiles.begin());
+
+        // Sample the callback at every node of the tile.
+        auto tile = std::unique_ptr<HeightTile>(new HeightTile);
+        for (int iy = 0; iy < m_htile_size; iy++) {
+            double y = (ty * m_htile_size + iy) * m_delta;
+            for (int ix = 0; ix < m_htile_size; ix++) {
+                double x = (tx * m_htile_size + ix) * m_delta;
+                tile->heights[iy * m_htile_size + ix] = m_height_fun(x, y);
+            }
+        }
+        t = m_height_tiles.insert(std::make_pair(key, std::move(tile))).first;
+    }
+
+    int ix = loc.x() - tx * m_htile_size;
+    int iy = loc.y() - ty * m_htile_size;
+    return t->second->heights[iy * m_htile_size + ix];
+}
+
 void SCMLoader::CreateVisualizationMesh(double sizeX, double sizeY) {
     int nvx = 2 * m_nx + 1;                     // number of grid vertices in X direction
     int nvy = 2 * m_ny + 1;                     // number of grid vertices in Y direction
@@ -598,7 +724,10 @@ void SCMLoader::CreateVisualizationMesh(double sizeX, double sizeY) {
                 normals[iv] = m_plane.TransformDirectionLocalToParent(ChVector<>(0, 0, 1));
             } else {
                 // Set vertex location
-                vertices[iv] = m_plane * ChVector<>(x, y, m_heights(ix, iy));
+                double h = (m_type == PatchType::HEIGHT_FUNCTION)
+                               ? SampledHeight(ChVector2<int>(ix - m_nx, iy - m_ny))
+                               : m_heights(ix, iy);
+                vertices[iv] = m_plane * ChVector<>(x, y, h);
                 // Initialize vertex normal to zero (will be set later)
                 normals[iv] = ChVector<>(0, 0, 0);
             }
@@ -678,16 +807,16 @@ SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector<>& loc) const {
     int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
     ChVector2<int> ij(i, j);
 
-    // First query the hash-map
-    auto p = m_grid_map.find(ij);
-    if (p != m_grid_map.end()) {
-        ni.sinkage = p->second.sinkage;
-        ni.sinkage_plastic = p->second.sinkage_plastic;
-        ni.sinkage_elastic = p->second.sinkage_elastic;
-        ni.sigma = p->second.sigma;
-        ni.sigma_yield = p->second.sigma_yield;
-        ni.kshear = p->second.kshear;
-        ni.tau = p->second.tau;
+    // First query the grid map
+    const auto* p = m_grid_map.Find(ij);
+    if (p) {
+        ni.sinkage = p->sinkage;
+        ni.sinkage_plastic = p->sinkage_plastic;
+        ni.sinkage_elastic = p->sinkage_elastic;
+        ni.sigma = p->sigma;
+        ni.sigma_yield = p->sigma_yield;
+        ni.kshear = p->kshear;
+        ni.tau = p->tau;
         return ni;
     }
 
@@ -746,6 +875,11 @@ double SCMLoader::GetInitHeight(const ChVector2<int>& loc) const {
             auto y = ChClamp(loc.y(), -m_ny, +m_ny);
             return m_heights(x + m_nx, y + m_ny);
         }
+        case PatchType::HEIGHT_FUNCTION: {
+            auto x = ChClamp(loc.x(), -m_nx, +m_nx);
+            auto y = ChClamp(loc.y(), -m_ny, +m_ny);
+            return SampledHeight(ChVector2<int>(x, y));
+        }
         default:
             return 0;
     }
@@ -755,7 +889,8 @@ double SCMLoader::GetInitHeight(const ChVector2<int>& loc) const {
 ChVector<> SCMLoader::GetInitNormal(const ChVector2<int>& loc) const {
     switch (m_type) {
         case PatchType::HEIGHT_MAP:
-        case PatchType::TRI_MESH: {
+        case PatchType::TRI_MESH:
+        case PatchType::HEIGHT_FUNCTION: {
             // Average normals of 4 triangular faces incident to given grid node
             auto hE = GetInitHeight(loc + ChVector2<int>(1, 0));  // east
             auto hW = GetInitHeight(loc - ChVector2<int>(1, 0));  // west
@@ -771,10 +906,10 @@ ChVector<> SCMLoader::GetInitNormal(const ChVector2<int>& loc) const {
 
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMLoader::GetHeight(const ChVector2<int>& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the grid map
+    const auto* p = m_grid_map.Find(loc);
+    if (p)
+        return p->level;
 
     // Else return undeformed height
     return GetInitHeight(loc);
@@ -784,7 +919,8 @@ double SCMLoader::GetHeight(const ChVector2<int>& loc) const {
 ChVector<> SCMLoader::GetNormal(const ChVector2<>& loc) const {
     switch (m_type) {
         case PatchType::HEIGHT_MAP:
-        case PatchType::TRI_MESH: {
+        case PatchType::TRI_MESH:
+        case PatchType::HEIGHT_FUNCTION: {
             // Average normals of 4 triangular faces incident to given grid node
             auto hE = GetHeight(loc + ChVector2<int>(1, 0));  // east
             auto hW = GetHeight(loc - ChVector2<int>(1, 0));  // west
@@ -862,6 +998,7 @@ ChVector<> SCMLoader::GetNormal(const ChVector<>& loc) const {
 void SCMLoader::UpdateMovingPatch(MovingPatchInfo& p, const ChVector<>& Z) {
     ChVector2<> p_min(+std::numeric_limits<double>::max());
     ChVector2<> p_max(-std::numeric_limits<double>::max());
+    std::vector<ChVector2<>> corners(8);
 
     // Loop over all corners of the OOBB
     for (int j = 0; j < 8; j++) {
@@ -881,6 +1018,8 @@ void SCMLoader::UpdateMovingPatch(MovingPatchInfo& p, const ChVector<>& Z) {
         p_min.y() = std::min(p_min.y(), c_scm.y());
         p_max.x() = std::max(p_max.x(), c_scm.x());
         p_max.y() = std::max(p_max.y(), c_scm.y());
+
+        corners[j] = ChVector2<>(c_scm.x(), c_scm.y());
     }
 
     // Find index ranges for grid vertices contained in the patch projection AABB
@@ -891,10 +1030,49 @@ void SCMLoader::UpdateMovingPatch(MovingPatchInfo& p, const ChVector<>& Z) {
     int n_x = x_max - x_min + 1;
     int n_y = y_max - y_min + 1;
 
-    p.m_range.resize(n_x * n_y);
-    for (int i = 0; i < n_x; i++) {
+    // Rays are cast along the SCM plane normal, so only grid vertices inside the
+    // projection of the OOBB onto the SCM plane can produce a hit. Prune the AABB
+    // node range against the convex hull of the projected OOBB corners (inflated
+    // by one grid cell), so that the per-vertex work in the ray-casting loop is
+    // not wasted on the AABB/projection slack of a rotated patch body.
+    utils::ChConvexHull2D ch(corners);
+    const auto& hull = ch.GetHull();
+    size_t nh = hull.size();
+
+    p.m_range.clear();
+    p.m_range.reserve(n_x * n_y);
+    if (nh < 3) {
+        // Degenerate projection; keep all nodes in the AABB
+        p.m_range.resize(n_x * n_y);
+        for (int i = 0; i < n_x; i++) {
+            for (int j = 0; j < n_y; j++) {
+                p.m_range[j * n_x + i] = ChVector2<int>(i + x_min, j + y_min);
+            }
+        }
+    } else {
+        // Precompute hull edge vectors and lengths (hull points are in CCW order)
+        std::vector<ChVector2<>> edge(nh);
+        std::vector<double> edge_len(nh);
+        for (size_t e = 0; e < nh; e++) {
+            edge[e] = hull[(e + 1) % nh] - hull[e];
+            edge_len[e] = std::sqrt(edge[e].x() * edge[e].x() + edge[e].y() * edge[e].y());
+        }
+
         for (int j = 0; j < n_y; j++) {
-            p.m_range[j * n_x + i] = ChVector2<int>(i + x_min, j + y_min);
+            for (int i = 0; i < n_x; i++) {
+                ChVector2<> v((i + x_min) * m_delta, (j + y_min) * m_delta);
+                bool inside = true;
+                for (size_t e = 0; e < nh; e++) {
+                    // Signed distance of node from hull edge (negative = outside)
+                    double cross = edge[e].x() * (v.y() - hull[e].y()) - edge[e].y() * (v.x() - hull[e].x());
+                    if (cross < -m_delta * edge_len[e]) {
+                        inside = false;
+                        break;
+                    }
+                }
+                if (inside)
+                    p.m_range.push_back(ChVector2<int>(i + x_min, j + y_min));
+            }
         }
     }
 
@@ -1004,7 +1182,7 @@ void SCMLoader::ComputeInternalForces() {
     // Reset quantities at grid nodes modified over previous step
     // (required for bulldozing effects and for proper visualization coloring)
     for (const auto& ij : m_modified_nodes) {
-        auto& nr = m_grid_map.at(ij);
+        auto& nr = m_grid_map.At(ij);
         nr.sigma = 0;
         nr.sinkage_elastic = 0;
         nr.step_plastic_flow = 0;
@@ -1052,6 +1230,29 @@ void SCMLoader::ComputeInternalForces() {
         UpdateFixedPatch(m_patches[0]);
     }
 
+    // Coarsen the stored soil state of grid tiles away from all moving patches
+    // (coarsened tiles are refined back on first access when a monitored body returns)
+    if (m_coarsen_distance > 0 && m_moving_patch) {
+        std::vector<ChVector2<>> centers;
+        for (const auto& p : m_patches) {
+            ChVector<> loc = m_plane.TransformPointParentToLocal(p.m_body->GetFrame_REF_to_abs().GetPos());
+            centers.push_back(ChVector2<>(loc.x(), loc.y()));
+        }
+        // Enlarge the distance threshold by the tile half-diagonal, so that a tile is coarsened only
+        // when it lies entirely beyond the specified distance from every monitored body
+        double buffer = 0.5 * std::sqrt(2.0) * m_delta * GridMap::GetTileSize();
+        double dist2 = (m_coarsen_distance + buffer) * (m_coarsen_distance + buffer);
+        m_grid_map.CoarsenTiles([&](const ChVector2<int>& ij) {
+            for (const auto& c : centers) {
+                double dx = ij.x() * m_delta - c.x();
+                double dy = ij.y() * m_delta - c.y();
+                if (dx * dx + dy * dy < dist2)
+                    return false;
+            }
+            return true;
+        });
+    }
+
     m_timer_moving_patches.stop();
 
     // -------------------------
@@ -1111,8 +1312,8 @@ void SCMLoader::ComputeInternalForces() {
     #pragma omp critical(SCM_ray_casting)
                 {
                     // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
+                    if (!m_grid_map.Find(ij)) {
+                        m_grid_map.Insert(ij, NodeRecord(z, z, GetInitNormal(ij)));
                     }
 
                     // Add to our map of hits to process
@@ -1134,61 +1335,106 @@ void SCMLoader::ComputeInternalForces() {
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
-        m_timer_ray_testing.start();
+        // Cast rays from the given list of grid nodes and merge any hits into the global map,
+        // recording the hit nodes as this patch's warm-start seed for the next step.
+        auto cast_rays = [&](const std::vector<ChVector2<int>>& node_list) {
+            m_timer_ray_testing.start();
 
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
+            // Loop through all vertices in the node list
+            int num_ray_casts = 0;
     #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            int t_num = ChOMP::GetThreadNum();
-            ChVector2<int> ij = p.m_range[k];
+            for (int k = 0; k < node_list.size(); k++) {
+                int t_num = ChOMP::GetThreadNum();
+                ChVector2<int> ij = node_list[k];
 
-            // Move from (i, j) to (x, y, z) representation in the world frame
-            double x = ij.x() * m_delta;
-            double y = ij.y() * m_delta;
-            double z = GetHeight(ij);
+                // Move from (i, j) to (x, y, z) representation in the world frame
+                double x = ij.x() * m_delta;
+                double y = ij.y() * m_delta;
+                double z = GetHeight(ij);
 
-            ChVector<> vertex_abs = m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
+                ChVector<> vertex_abs = m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
 
-            // Create ray at current grid location
-            collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector<> to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector<> from = to - m_Z * m_test_offset_down;
+                // Create ray at current grid location
+                collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
+                ChVector<> to = vertex_abs + m_Z * m_test_offset_up;
+                ChVector<> from = to - m_Z * m_test_offset_down;
 
-            // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
+                // Ray-OBB test (quick rejection)
+                if (m_moving_patch && !RayOBBtest(p, from, m_Z))
+                    continue;
 
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
+                // Cast ray into collision system
+                GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
+                num_ray_casts++;
 
-            if (mrayhit_result.hit) {
-                // Add to our map of hits to process
-                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
+                if (mrayhit_result.hit) {
+                    // Add to our map of hits to process
+                    HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
+                    t_hits[t_num].insert(std::make_pair(ij, record));
+                }
             }
-        }
 
-        m_timer_ray_testing.stop();
+            m_timer_ray_testing.stop();
 
-        m_num_ray_casts += num_ray_casts;
+            m_num_ray_casts += num_ray_casts;
 
-        // Sequential insertion in global hits
-        for (int t_num = 0; t_num < nthreads; t_num++) {
-            for (auto& h : t_hits[t_num]) {
-                // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
-                    double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
+            // Sequential insertion in global hits
+            for (int t_num = 0; t_num < nthreads; t_num++) {
+                for (auto& h : t_hits[t_num]) {
+                    // If this is the first hit from this node, initialize the node record
+                    if (!m_grid_map.Find(h.first)) {
+                        double z = GetInitHeight(h.first);
+                        m_grid_map.Insert(h.first, NodeRecord(z, z, GetInitNormal(h.first)));
+                    }
+                    if (hits.insert(h).second)
+                        p.m_last_hits.push_back(h.first);
+                }
+
+                t_hits[t_num].clear();
+            }
+            m_num_ray_hits = (int)hits.size();
+        };
+
+        // Warm start from the contact patch tracked at the previous step: seed ray casting with the
+        // last-step hit nodes dilated by a safety margin (only for moving patches, whose Ray-OBB test
+        // rejects seed nodes that drifted outside the patch).
+        constexpr int margin = 3;
+        std::vector<ChVector2<int>> seed_nodes;
+        std::unordered_set<ChVector2<int>, CoordHash> seed_inner;
+        if (m_moving_patch && !p.m_last_hits.empty()) {
+            std::unordered_set<ChVector2<int>, CoordHash> seed_set;
+            for (const auto& ij : p.m_last_hits) {
+                for (int di = -margin; di <= margin; di++) {
+                    for (int dj = -margin; dj <= margin; dj++) {
+                        ChVector2<int> nbr(ij.x() + di, ij.y() + dj);
+                        if (seed_set.insert(nbr).second)
+                            seed_nodes.push_back(nbr);
+                        if (std::max(std::abs(di), std::abs(dj)) < margin)
+                            seed_inner.insert(nbr);
+                    }
                 }
-                ////hits.insert(h);
             }
+        }
 
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
-            t_hits[t_num].clear();
+        p.m_last_hits.clear();
+
+        if (seed_nodes.empty()) {
+            cast_rays(p.m_range);
+        } else {
+            cast_rays(seed_nodes);
+
+            // If the patch reached the outermost dilation ring, the seed may have clipped it:
+            // fall back to the full patch range (previously cast nodes are not duplicated).
+            bool escaped = false;
+            for (const auto& ij : p.m_last_hits) {
+                if (seed_inner.find(ij) == seed_inner.end()) {
+                    escaped = true;
+                    break;
+                }
+            }
+            if (escaped)
+                cast_rays(p.m_range);
         }
-        m_num_ray_hits = (int)hits.size();
     }
 
 #endif
@@ -1294,7 +1540,7 @@ void SCMLoader::ComputeInternalForces() {
     for (auto& h : hits) {
         ChVector2<> ij = h.first;
 
-        auto& nr = m_grid_map.at(ij);      // node record
+        auto& nr = m_grid_map.At(ij);      // node record
         const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
 
         ChContactable* contactable = h.second.contactable;
@@ -1454,7 +1700,7 @@ void SCMLoader::ComputeInternalForces() {
             // Calculate the displaced material from all touched nodes and identify boundary
             double tot_step_flow = 0;
             for (const auto& ij : p.nodes) {                     // for each node in contact patch
-                const auto& nr = m_grid_map.at(ij);              //   get node record
+                const auto& nr = m_grid_map.At(ij);              //   get node record
                 if (nr.sigma <= 0)                               //   if node not touched
                     continue;                                    //     skip (not in effective patch)
                 tot_step_flow += nr.step_plastic_flow;           //   accumulate displaced material
@@ -1462,10 +1708,11 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
                     ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
+                    const auto* nbr_nr = m_grid_map.Find(nbr_ij);  //     neighbor node record
+                    if (!nbr_nr)                                   //     if neighbor not yet recorded
+                        p_boundary.insert(nbr_ij);                 //       set neighbor as boundary
+                    else if (nbr_nr->sigma <= 0)                   //     if neighbor not touched
+                        p_boundary.insert(nbr_ij);                 //       set neighbor as boundary
                 }
             }
             tot_step_flow *= GetSystem()->GetStep();
@@ -1476,13 +1723,13 @@ void SCMLoader::ComputeInternalForces() {
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
             for (const auto& ij : p_boundary) {                                  // for each node in bndry
                 m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
-                    double z = GetInitHeight(ij);                                //     undeformed height
-                    const ChVector<>& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
-                    m_modified_nodes.push_back(ij);                              //     mark as modified
-                }                                                                //
-                auto& nr = m_grid_map.at(ij);                                    //   node record
+                if (!m_grid_map.Find(ij)) {                       //   if not yet recorded
+                    double z = GetInitHeight(ij);                 //     undeformed height
+                    const ChVector<>& n = GetInitNormal(ij);      //     terrain normal
+                    m_grid_map.Insert(ij, NodeRecord(z, z, n));   //     add new node record
+                    m_modified_nodes.push_back(ij);               //     mark as modified
+                }                                                 //
+                auto& nr = m_grid_map.At(ij);                     //   node record
                 nr.erosion = true;                                               //   add to erosion domain
                 AddMaterialToNode(diff, nr);                                     //   add raise amount
             }
@@ -1499,6 +1746,18 @@ void SCMLoader::ComputeInternalForces() {
 
         NodeSet erosion_domain = boundary;
         NodeSet erosion_front = boundary;  // initialize erosion front to boundary nodes
+
+        // Add nodes left with unsettled material by previous steps, so that their remainder keeps relaxing
+        // even after the contact patch has moved away
+        for (const auto& ij : m_unsettled_nodes) {
+            if (erosion_domain.insert(ij).second) {
+                auto& nr = m_grid_map.At(ij);  // node record exists (node was modified when material was deposited)
+                nr.erosion = true;
+                erosion_front.insert(ij);
+                m_modified_nodes.push_back(ij);
+            }
+        }
+
         for (int i = 0; i < m_erosion_propagations; i++) {
             NodeSet front;                                       // new erosion front
             for (const auto& ij : erosion_front) {               // for each node in current erosion front
@@ -1506,20 +1765,21 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
                     ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
-                        double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
-                        const ChVector<>& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
-                        NodeRecord nr(z, z, n);                         //     create new record
-                        nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
-                        front.insert(nbr_ij);                           //     add neighbor to new front
-                        m_modified_nodes.push_back(nbr_ij);             //     mark as modified
-                    } else {                                            //   if neighbor previously recorded
-                        NodeRecord& nr = m_grid_map.at(nbr_ij);         //     get existing record
-                        if (!nr.erosion && nr.sigma <= 0) {             //     if neighbor not touched
-                            nr.erosion = true;                          //       include in erosion domain
-                            front.insert(nbr_ij);                       //       add neighbor to new front
-                            m_modified_nodes.push_back(nbr_ij);         //       mark as modified
+                    NodeRecord* rec = m_grid_map.Find(nbr_ij);        //   neighbor node record
+                    if (!rec) {                                       //   if neighbor not yet recorded
+                        double z = GetInitHeight(nbr_ij);             //     undeformed height at neighbor location
+                        const ChVector<>& n = GetInitNormal(nbr_ij);  //     terrain normal at neighbor location
+                        NodeRecord nr(z, z, n);                       //     create new record
+                        nr.erosion = true;                            //     include in erosion domain
+                        m_grid_map.Insert(nbr_ij, nr);                //     add new node record
+                        front.insert(nbr_ij);                         //     add neighbor to new front
+                        m_modified_nodes.push_back(nbr_ij);           //     mark as modified
+                    } else {                                          //   if neighbor previously recorded
+                        NodeRecord& nr = *rec;                        //     get existing record
+                        if (!nr.erosion && nr.sigma <= 0) {           //     if neighbor not touched
+                            nr.erosion = true;                        //       include in erosion domain
+                            front.insert(nbr_ij);                     //       add neighbor to new front
+                            m_modified_nodes.push_back(nbr_ij);       //       mark as modified
                         }
                     }
                 }
@@ -1534,15 +1794,21 @@ void SCMLoader::ComputeInternalForces() {
         // (3) Erosion algorithm on domain
         m_timer_bulldozing_erosion.start();
 
+        // Order the domain nodes row-major, so that the relaxation sweeps traverse each storage tile contiguously
+        std::vector<ChVector2<int>> erosion_nodes(erosion_domain.begin(), erosion_domain.end());
+        std::sort(erosion_nodes.begin(), erosion_nodes.end(), [](const ChVector2<int>& a, const ChVector2<int>& b) {
+            return (a.y() < b.y()) || (a.y() == b.y() && a.x() < b.x());
+        });
+
         for (int iter = 0; iter < m_erosion_iterations; iter++) {
-            for (const auto& ij : erosion_domain) {
-                auto& nr = m_grid_map.at(ij);
+            for (const auto& ij : erosion_nodes) {
+                auto& nr = m_grid_map.At(ij);
                 for (int k = 0; k < 4; k++) {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];
-                    auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
+                    auto* rec = m_grid_map.Find(nbr_ij);
+                    if (!rec)
                         continue;
-                    auto& nbr_nr = rec->second;
+                    auto& nbr_nr = *rec;
 
                     // (3.1) Flow remaining material to neighbor
                     double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
@@ -1569,6 +1835,14 @@ void SCMLoader::ComputeInternalForces() {
             }
         }
 
+        // Update the set of unsettled nodes: keep only domain nodes which still carry remainder material
+        for (const auto& ij : erosion_nodes) {
+            if (m_grid_map.At(ij).massremainder > 0)
+                m_unsettled_nodes.insert(ij);
+            else
+                m_unsettled_nodes.erase(ij);
+        }
+
         m_timer_bulldozing_erosion.stop();
 
     }  // end do_bulldozing
@@ -1587,7 +1861,7 @@ void SCMLoader::ComputeInternalForces() {
         for (const auto& ij : m_modified_nodes) {
             if (!CheckMeshBounds(ij))                 // if node outside mesh
                 continue;                             //   do nothing
-            const auto& nr = m_grid_map.at(ij);       // grid node record
+            const auto& nr = m_grid_map.At(ij);       // grid node record
             int iv = GetMeshVertexIndex(ij);          // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
             modified_vertices.push_back(iv);          // cache in list of modified mesh vertices
@@ -1710,14 +1984,14 @@ void SCMLoader::UpdateMeshVertexNormal(const ChVector2<int> ij, int iv) {
 std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMTerrain::NodeLevel> nodes;
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
-        }
+        m_grid_map.ForEach([&nodes](const ChVector2<int>& ij, const NodeRecord& nr) {
+            nodes.push_back(std::make_pair(ij, nr.level));
+        });
     } else {
         for (const auto& ij : m_modified_nodes) {
-            auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
+            const auto* rec = m_grid_map.Find(ij);
+            assert(rec);
+            nodes.push_back(std::make_pair(ij, rec->level));
         }
     }
     return nodes;
@@ -1729,7 +2003,7 @@ std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) c
 void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes) {
     for (const auto& n : nodes) {
         // Modify existing entry in grid map or insert new one
-        m_grid_map[n.first] = SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first));
+        m_grid_map.Insert(n.first, SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first)));
     }
 
     // Update visualization
@@ -1738,7 +2012,7 @@ void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes
             auto ij = n.first;                           // grid location
             if (!CheckMeshBounds(ij))                    // if outside mesh
                 continue;                                //   do nothing
-            const auto& nr = m_grid_map.at(ij);          // grid node record
+            const auto& nr = m_grid_map.At(ij);          // grid node record
             int iv = GetMeshVertexIndex(ij);             // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);     // update vertex coordinates and color
             if (!m_trimesh_shape->IsWireframe())         // if not in wireframe mode
@@ -20,9 +20,15 @@
 #ifndef SCM_TERRAIN_H
 #define SCM_TERRAIN_H
 
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
 #include <ostream>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "chrono/assets/ChTriangleMeshShape.h"
 #include "chrono/physics/ChBody.h"
@@ -156,6 +162,18 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
                         const ChVector<>& OOBB_dims     ///< [in] OOBB dimensions
     );
 
+    /// Enable coarsening of deformed terrain state away from all moving patches.
+    /// Soil state is maintained at full grid resolution only for tiles within the given distance of a moving patch
+    /// body; farther tiles are coarsened by replacing each factor x factor block of node records with a single
+    /// aggregated record (averaged levels and plastic state; per-step transient quantities are dropped). Coarsened
+    /// tiles are transparently refined back, rebased on the exact undeformed terrain height, when a monitored body
+    /// returns. Height queries in coarsened areas return the aggregated levels. This bounds full-resolution storage
+    /// by the neighborhood of the moving patches instead of the length of the traveled course.
+    /// Requires at least one moving patch (see AddMovingPatch). The factor must divide the grid tile size (32).
+    void EnableGridCoarsening(double distance,  ///< [in] distance from a monitored body beyond which tiles coarsen
+                              int factor = 8    ///< [in] linear aggregation factor for coarsened tiles
+    );
+
     /// Class to be used as a callback interface for location-dependent soil parameters.
     /// A derived class must implement Set() and set *all* soil parameters (no defaults are provided).
     class CH_VEHICLE_API SoilParametersCallback {
@@ -202,6 +220,15 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value of 0.8.
     virtual float GetCoefficientFriction(const ChVector<>& loc) const override;
 
+    /// Get all terrain characteristics at the points below a batch of locations.
+    /// Height and normal queries are read-only lookups in the SCM grid map and are evaluated concurrently.
+    /// Friction coefficients are evaluated sequentially if a ChTerrain::FrictionFunctor was registered (the functor
+    /// is not required to be re-entrant); otherwise the constant value of 0.8 is used.
+    virtual void QueryBatch(const std::vector<ChVector<>>& locs,
+                            std::vector<double>& heights,
+                            std::vector<ChVector<>>& normals,
+                            std::vector<float>& frictions) const override;
+
     /// Get SCM information at the node closest to the specified location.
     NodeInfo GetNodeInfo(const ChVector<>& loc) const;
 
@@ -249,6 +276,21 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
                     double delta                   ///< [in] grid spacing (may be slightly decreased)
     );
 
+    /// Initialize the terrain system (height function).
+    /// The initial undeformed terrain profile is provided via a user callback, invoked with the (x,y) point
+    /// coordinates in the SCM frame and returning the height at that point. Unlike the height-map version, which
+    /// decodes the entire image and stores all grid heights eagerly, heights are sampled lazily, in square tiles,
+    /// on first access; only tiles visited by the simulation are resident and the resident set is bounded, so the
+    /// patch extent does not bound memory use. This is intended for very large rasters: the callback can window-read
+    /// from a tiled format (e.g. a GeoTIFF, through any external raster library) and only the windows under the
+    /// active contact patches are ever decoded. Note that enabling the visualization mesh forces an eager sampling
+    /// of the full grid, which defeats the purpose for huge patches.
+    void Initialize(std::function<double(double x, double y)> height_fun,  ///< [in] height callback
+                    double sizeX,                                          ///< [in] terrain dimension in the X direction
+                    double sizeY,                                          ///< [in] terrain dimension in the Y direction
+                    double delta                                           ///< [in] grid spacing (may be slightly decreased)
+    );
+
     /// Node height level at a given grid location.
     typedef std::pair<ChVector2<int>, double> NodeLevel;
 
@@ -343,12 +385,21 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
                     double delta                   ///< [in] grid spacing (may be slightly decreased)
     );
 
+    /// Initialize the terrain system (height function).
+    /// The initial undeformed terrain profile is provided via a user callback, sampled lazily in tiles.
+    void Initialize(std::function<double(double x, double y)> height_fun,  ///< [in] height callback
+                    double sizeX,                                          ///< [in] terrain dimension in the X direction
+                    double sizeY,                                          ///< [in] terrain dimension in the Y direction
+                    double delta                                           ///< [in] grid spacing (may be slightly decreased)
+    );
+
   private:
     // SCM patch type
     enum class PatchType {
-        FLAT,        // flat patch
-        HEIGHT_MAP,  // triangular mesh (generated from a gray-scale image height-map)
-        TRI_MESH     // triangular mesh (provided through an OBJ file)
+        FLAT,            // flat patch
+        HEIGHT_MAP,      // triangular mesh (generated from a gray-scale image height-map)
+        TRI_MESH,        // triangular mesh (provided through an OBJ file)
+        HEIGHT_FUNCTION  // user callback, sampled lazily in tiles
     };
 
     // Moving patch parameters
@@ -358,6 +409,12 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         ChVector<> m_hdims;                   // OOBB half-dimensions
         std::vector<ChVector2<int>> m_range;  // current grid nodes covered by the patch
         ChVector<> m_ooN;                     // current inverse of SCM normal in body frame
+
+        // Grid nodes hit at the previous step, used to warm-start ray casting. In steady rolling the
+        // contact patch moves by a small fraction of a grid cell per step, so rays need only be cast
+        // from the last-step hit nodes (dilated by a safety margin); the full patch range is used as a
+        // fallback whenever the patch grows beyond that margin.
+        std::vector<ChVector2<int>> m_last_hits;
     };
 
     // Information at contacted node
@@ -404,6 +461,252 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         std::size_t operator()(const ChVector2<int>& p) const { return p.x() * 31 + p.y(); }
     };
 
+    // Tiled storage for the records of modified grid nodes.
+    // Nodes are grouped in square tiles allocated on first touch. Accessing a node record costs a
+    // single hash lookup to resolve the tile, followed by direct index math within the tile; node
+    // records are stored contiguously within each tile, which benefits the repeated neighbor
+    // accesses of the bulldozing and erosion passes as well as full traversals.
+    // When coarsening is enabled, tiles away from all moving patches can trade their per-node
+    // records for one aggregated record per factor x factor block (see CoarsenTiles); coarsened
+    // tiles answer read-only queries with the aggregated records and are refined back to full
+    // resolution on any mutating access.
+    class GridMap {
+      public:
+        // Enable tile coarsening with the given linear aggregation factor (must divide the tile
+        // size). The rebase function maps an aggregated record to the record reconstructed at a
+        // specific fine node during refinement (ex. to restore the exact undeformed height).
+        void EnableCoarsening(int factor,
+                              std::function<NodeRecord(const ChVector2<int>&, const NodeRecord&)> rebase) {
+            assert(factor > 1 && m_tile_size % factor == 0);
+            m_factor = factor;
+            m_rebase = rebase;
+        }
+
+        // Nodes per tile side.
+        static int GetTileSize() { return m_tile_size; }
+
+        // Find the record at the given grid location (null if the node was never modified).
+        // A coarsened tile is refined back to full resolution, since the caller may modify the record.
+        NodeRecord* Find(const ChVector2<int>& loc) {
+            uint64_t key = TileKey(loc);
+            auto t = m_tiles.find(key);
+            if (t == m_tiles.end()) {
+                if (!RefineTile(key))
+                    return nullptr;
+                t = m_tiles.find(key);
+            }
+            int k = NodeIndex(loc);
+            return t->second->used[k] ? &t->second->records[k] : nullptr;
+        }
+        const NodeRecord* Find(const ChVector2<int>& loc) const {
+            auto t = m_tiles.find(TileKey(loc));
+            if (t != m_tiles.end()) {
+                int k = NodeIndex(loc);
+                return t->second->used[k] ? &t->second->records[k] : nullptr;
+            }
+            // The tile may be coarsened: answer with the aggregated record covering this node.
+            auto c = m_coarse.find(TileKey(loc));
+            if (c == m_coarse.end())
+                return nullptr;
+            int k = CoarseIndex(loc);
+            return c->second->used[k] ? &c->second->records[k] : nullptr;
+        }
+
+        // Return the record at the given grid location, which must exist.
+        NodeRecord& At(const ChVector2<int>& loc) {
+            NodeRecord* record = Find(loc);
+            assert(record);
+            return *record;
+        }
+        const NodeRecord& At(const ChVector2<int>& loc) const {
+            const NodeRecord* record = Find(loc);
+            assert(record);
+            return *record;
+        }
+
+        // Insert a record at the given grid location, overwriting any existing one.
+        void Insert(const ChVector2<int>& loc, const NodeRecord& record) {
+            uint64_t key = TileKey(loc);
+            if (m_tiles.find(key) == m_tiles.end())
+                RefineTile(key);
+            auto& tile = m_tiles[key];
+            if (!tile)
+                tile = std::unique_ptr<Tile>(new Tile);
+            int k = NodeIndex(loc);
+            tile->records[k] = record;
+            tile->used[k] = true;
+        }
+
+        // Invoke the given function with the location and record of every stored node.
+        // For coarsened tiles, every fine node covered by an aggregated record reports that record.
+        template <typename Function>
+        void ForEach(Function f) const {
+            for (const auto& t : m_tiles) {
+                int tx = static_cast<int>(static_cast<int32_t>(t.first >> 32));
+                int ty = static_cast<int>(static_cast<int32_t>(t.first & 0xffffffff));
+                for (int k = 0; k < m_tile_size * m_tile_size; k++) {
+                    if (t.second->used[k]) {
+                        ChVector2<int> loc(tx * m_tile_size + k % m_tile_size,
+                                           ty * m_tile_size + k / m_tile_size);
+                        f(loc, t.second->records[k]);
+                    }
+                }
+            }
+            int ncells = m_tile_size / m_factor;
+            for (const auto& c : m_coarse) {
+                int tx = static_cast<int>(static_cast<int32_t>(c.first >> 32));
+                int ty = static_cast<int>(static_cast<int32_t>(c.first & 0xffffffff));
+                for (int k = 0; k < ncells * ncells; k++) {
+                    if (!c.second->used[k])
+                        continue;
+                    for (int dy = 0; dy < m_factor; dy++) {
+                        for (int dx = 0; dx < m_factor; dx++) {
+                            ChVector2<int> loc(tx * m_tile_size + (k % ncells) * m_factor + dx,
+                                               ty * m_tile_size + (k / ncells) * m_factor + dy);
+                            f(loc, c.second->records[k]);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Coarsen all full-resolution tiles whose center node satisfies the given predicate,
+        // replacing each factor x factor block of node records with a single aggregated record
+        // (averaged levels, normals, and plastic state; per-step transient quantities are dropped).
+        // No-op unless coarsening was enabled.
+        template <typename Predicate>
+        void CoarsenTiles(Predicate is_far) {
+            if (m_factor <= 1)
+                return;
+            int ncells = m_tile_size / m_factor;
+            for (auto t = m_tiles.begin(); t != m_tiles.end();) {
+                int tx = static_cast<int>(static_cast<int32_t>(t->first >> 32));
+                int ty = static_cast<int>(static_cast<int32_t>(t->first & 0xffffffff));
+                ChVector2<int> center(tx * m_tile_size + m_tile_size / 2, ty * m_tile_size + m_tile_size / 2);
+                if (!is_far(center)) {
+                    ++t;
+                    continue;
+                }
+                auto coarse = std::unique_ptr<CoarseTile>(new CoarseTile);
+                coarse->records.resize(ncells * ncells);
+                coarse->used.resize(ncells * ncells, false);
+                for (int k = 0; k < ncells * ncells; k++) {
+                    int num_used = 0;
+                    double level_initial = 0;
+                    double level = 0;
+                    ChVector<> normal(0);
+                    double sinkage_plastic = 0;
+                    double sigma_yield = 0;
+                    double kshear = 0;
+                    double massremainder = 0;
+                    for (int dy = 0; dy < m_factor; dy++) {
+                        for (int dx = 0; dx < m_factor; dx++) {
+                            int ix = (k % ncells) * m_factor + dx;
+                            int iy = (k / ncells) * m_factor + dy;
+                            if (!t->second->used[iy * m_tile_size + ix])
+                                continue;
+                            const NodeRecord& nr = t->second->records[iy * m_tile_size + ix];
+                            num_used++;
+                            level_initial += nr.level_initial;
+                            level += nr.level;
+                            normal += nr.normal;
+                            sinkage_plastic += nr.sinkage_plastic;
+                            sigma_yield += nr.sigma_yield;
+                            kshear += nr.kshear;
+                            massremainder += nr.massremainder;
+                        }
+                    }
+                    if (num_used == 0)
+                        continue;
+                    double oon = 1.0 / num_used;
+                    NodeRecord nr(level_initial * oon, level * oon, normal.GetNormalized());
+                    nr.sinkage_plastic = sinkage_plastic * oon;
+                    nr.sigma_yield = sigma_yield * oon;
+                    nr.kshear = kshear * oon;
+                    nr.massremainder = massremainder * oon;
+                    coarse->records[k] = nr;
+                    coarse->used[k] = true;
+                }
+                m_coarse[t->first] = std::move(coarse);
+                t = m_tiles.erase(t);
+            }
+        }
+
+      private:
+        static const int m_tile_size = 32;  // nodes per tile side
+
+        struct Tile {
+            std::array<NodeRecord, m_tile_size * m_tile_size> records;  // node records in row-major order
+            std::array<bool, m_tile_size * m_tile_size> used = {};      // per-node occupancy flags
+        };
+
+        // Aggregated records of a coarsened tile (one per factor x factor block, in row-major order).
+        struct CoarseTile {
+            std::vector<NodeRecord> records;  // aggregated records
+            std::vector<bool> used;           // per-block occupancy flags
+        };
+
+        // Restore full resolution for a coarsened tile, reconstructing the record at every fine node
+        // covered by an aggregated record. Return false if the tile is not coarsened.
+        bool RefineTile(uint64_t key) {
+            if (m_coarse.empty())
+                return false;
+            auto c = m_coarse.find(key);
+            if (c == m_coarse.end())
+                return false;
+            int tx = static_cast<int>(static_cast<int32_t>(key >> 32));
+            int ty = static_cast<int>(static_cast<int32_t>(key & 0xffffffff));
+            auto tile = std::unique_ptr<Tile>(new Tile);
+            int ncells = m_tile_size / m_factor;
+            for (int k = 0; k < ncells * ncells; k++) {
+                if (!c->second->used[k])
+                    continue;
+                for (int dy = 0; dy < m_factor; dy++) {
+                    for (int dx = 0; dx < m_factor; dx++) {
+                        ChVector2<int> loc(tx * m_tile_size + (k % ncells) * m_factor + dx,
+                                           ty * m_tile_size + (k / ncells) * m_factor + dy);
+                        int n = NodeIndex(loc);
+                        tile->records[n] = m_rebase ? m_rebase(loc, c->second->records[k]) : c->second->records[k];
+                        tile->used[n] = true;
+                    }
+                }
+            }
+            m_tiles[key] = std::move(tile);
+            m_coarse.erase(c);
+            return true;
+        }
+
+        // Pack the tile coordinates of the given grid location into the dictionary key.
+        static uint64_t TileKey(const ChVector2<int>& loc) {
+            int tx = FloorDiv(loc.x());
+            int ty = FloorDiv(loc.y());
+            return (static_cast<uint64_t>(static_cast<uint32_t>(tx)) << 32) | static_cast<uint32_t>(ty);
+        }
+
+        // Index of the given grid location within its tile.
+        static int NodeIndex(const ChVector2<int>& loc) {
+            int ix = loc.x() - FloorDiv(loc.x()) * m_tile_size;
+            int iy = loc.y() - FloorDiv(loc.y()) * m_tile_size;
+            return iy * m_tile_size + ix;
+        }
+
+        // Index of the aggregated record covering the given grid location within its coarsened tile.
+        int CoarseIndex(const ChVector2<int>& loc) const {
+            int ix = (loc.x() - FloorDiv(loc.x()) * m_tile_size) / m_factor;
+            int iy = (loc.y() - FloorDiv(loc.y()) * m_tile_size) / m_factor;
+            return iy * (m_tile_size / m_factor) + ix;
+        }
+
+        // Floor division of a grid coordinate by the tile size.
+        static int FloorDiv(int c) { return (c >= 0) ? c / m_tile_size : -((-c - 1) / m_tile_size + 1); }
+
+        std::unordered_map<uint64_t, std::unique_ptr<Tile>> m_tiles;         // tile dictionary
+        std::unordered_map<uint64_t, std::unique_ptr<CoarseTile>> m_coarse;  // coarsened tile dictionary
+
+        int m_factor = 1;  // linear aggregation factor (1: coarsening disabled)
+        std::function<NodeRecord(const ChVector2<int>&, const NodeRecord&)> m_rebase;  // refinement rebase function
+    };
+
     // Create visualization mesh
     void CreateVisualizationMesh(double sizeX, double sizeY);
 
@@ -512,12 +815,33 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
 
     ChMatrixDynamic<> m_heights;  // (base) grid heights (when initializing from height-field map)
 
-    std::unordered_map<ChVector2<int>, NodeRecord, CoordHash> m_grid_map;  // modified grid nodes (persistent)
+    // Lazily sampled height source (when initializing from a height function).
+    // Heights are obtained in square tiles, each filled on first access by invoking the user callback at
+    // every node of the tile; only tiles visited by the simulation are resident, so the patch extent does
+    // not bound memory use. The resident set is capped; on overflow an arbitrary tile is evicted (an
+    // evicted tile is simply re-sampled if visited again).
+    static const int m_htile_size = 32;        // nodes per height tile side
+    static const size_t m_htile_capacity = 1024;  // maximum number of resident height tiles (8 MB)
+
+    struct HeightTile {
+        std::array<double, m_htile_size * m_htile_size> heights;  // sampled heights in row-major order
+    };
+
+    // Get the lazily sampled height at the specified grid node (samples the node's tile if not resident).
+    double SampledHeight(const ChVector2<int>& loc) const;
+
+    std::function<double(double, double)> m_height_fun;                                // height callback
+    mutable std::unordered_map<uint64_t, std::unique_ptr<HeightTile>> m_height_tiles;  // resident height tiles
+
+    GridMap m_grid_map;  // modified grid nodes (persistent)
     std::vector<ChVector2<int>> m_modified_nodes;                          // modified grid nodes (current)
+    std::unordered_set<ChVector2<int>, CoordHash> m_unsettled_nodes;       // nodes with leftover bulldozed material
 
     std::vector<MovingPatchInfo> m_patches;  // set of active moving patches
     bool m_moving_patch;                     // user-specified moving patches?
 
+    double m_coarsen_distance;  // distance from a patch body beyond which tiles coarsen (0: disabled)
+
     double m_test_offset_down;  // offset for ray start
     double m_test_offset_up;    // offset for ray end
 
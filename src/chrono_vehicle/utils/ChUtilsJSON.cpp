@@ -16,6 +16,10 @@
 //
 // =============================================================================
 
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
 #include <fstream>
 #include <vector>
 #include <utility>
@@ -100,17 +104,78 @@ namespace vehicle {
 
 // -----------------------------------------------------------------------------
 
+// Cache of raw specification file contents, so that repeated reads of the same file parse from memory.
+static std::mutex json_file_cache_mutex;
+static std::unordered_map<std::string, std::shared_ptr<const std::string>> json_file_cache;
+
 void ReadFileJSON(const std::string& filename, Document& d) {
-    std::ifstream ifs(filename);
-    if (!ifs.good()) {
-        GetLog() << "ERROR: Could not open JSON file: " << filename << "\n";
-    } else {
-        IStreamWrapper isw(ifs);
-        d.ParseStream<ParseFlag::kParseCommentsFlag>(isw);
-        if (d.IsNull()) {
-            GetLog() << "ERROR: Invalid JSON file: " << filename << "\n";
+    std::shared_ptr<const std::string> content;
+
+    {
+        std::lock_guard<std::mutex> lock(json_file_cache_mutex);
+        auto it = json_file_cache.find(filename);
+        if (it != json_file_cache.end())
+            content = it->second;
+    }
+
+    if (!content) {
+        std::ifstream ifs(filename);
+        if (!ifs.good()) {
+            GetLog() << "ERROR: Could not open JSON file: " << filename << "\n";
+            return;
         }
+        std::stringstream ss;
+        ss << ifs.rdbuf();
+        content = std::make_shared<const std::string>(ss.str());
+
+        std::lock_guard<std::mutex> lock(json_file_cache_mutex);
+        auto it = json_file_cache.find(filename);
+        if (it != json_file_cache.end())
+            content = it->second;
+        else
+            json_file_cache[filename] = content;
+    }
+
+    d.Parse<ParseFlag::kParseCommentsFlag>(content->c_str());
+    if (d.IsNull()) {
+        GetLog() << "ERROR: Invalid JSON file: " << filename << "\n";
+    }
+}
+
+// Cache of parsed specification documents, so that repeated loads of the same file skip parsing entirely.
+static std::mutex json_doc_cache_mutex;
+static std::unordered_map<std::string, std::shared_ptr<const Document>> json_doc_cache;
+
+std::shared_ptr<const rapidjson::Document> ReadCachedFileJSON(const std::string& filename) {
+    {
+        std::lock_guard<std::mutex> lock(json_doc_cache_mutex);
+        auto it = json_doc_cache.find(filename);
+        if (it != json_doc_cache.end())
+            return it->second;
+    }
+
+    auto d = std::make_shared<Document>();
+    ReadFileJSON(filename, *d);
+    if (d->IsNull())
+        return nullptr;
+
+    std::shared_ptr<const Document> doc = d;
+
+    std::lock_guard<std::mutex> lock(json_doc_cache_mutex);
+    auto it = json_doc_cache.find(filename);
+    if (it != json_doc_cache.end())
+        return it->second;
+    json_doc_cache[filename] = doc;
+    return doc;
+}
+
+void ClearFileCacheJSON() {
+    {
+        std::lock_guard<std::mutex> lock(json_doc_cache_mutex);
+        json_doc_cache.clear();
     }
+    std::lock_guard<std::mutex> lock(json_file_cache_mutex);
+    json_file_cache.clear();
 }
 
 // -----------------------------------------------------------------------------
@@ -631,10 +696,10 @@ std::shared_ptr<ChLinkRSDA::TorqueFunctor> ReadRSDAFunctorJSON(const rapidjson::
 std::shared_ptr<ChChassis> ReadChassisJSON(const std::string& filename) {
     std::shared_ptr<ChChassis> chassis;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a chassis specification file.
     assert(d.HasMember("Type"));
@@ -658,10 +723,10 @@ std::shared_ptr<ChChassis> ReadChassisJSON(const std::string& filename) {
 std::shared_ptr<ChChassisRear> ReadChassisRearJSON(const std::string& filename) {
     std::shared_ptr<ChChassisRear> chassis;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a rear chassis specification file.
     assert(d.HasMember("Type"));
@@ -685,10 +750,10 @@ std::shared_ptr<ChChassisRear> ReadChassisRearJSON(const std::string& filename)
 std::shared_ptr<ChChassisConnector> ReadChassisConnectorJSON(const std::string& filename) {
     std::shared_ptr<ChChassisConnector> connector;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a chassis connector specification file.
     assert(d.HasMember("Type"));
@@ -716,10 +781,10 @@ std::shared_ptr<ChChassisConnector> ReadChassisConnectorJSON(const std::string&
 std::shared_ptr<ChEngine> ReadEngineJSON(const std::string& filename) {
     std::shared_ptr<ChEngine> engine;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is an engine specification file.
     assert(d.HasMember("Type"));
@@ -747,10 +812,10 @@ std::shared_ptr<ChEngine> ReadEngineJSON(const std::string& filename) {
 std::shared_ptr<ChTransmission> ReadTransmissionJSON(const std::string& filename) {
     std::shared_ptr<ChTransmission> transmission;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a transmission specification file.
     assert(d.HasMember("Type"));
@@ -780,10 +845,10 @@ std::shared_ptr<ChTransmission> ReadTransmissionJSON(const std::string& filename
 std::shared_ptr<ChSuspension> ReadSuspensionJSON(const std::string& filename) {
     std::shared_ptr<ChSuspension> suspension;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a suspension specification file.
     assert(d.HasMember("Type"));
@@ -843,10 +908,10 @@ std::shared_ptr<ChSuspension> ReadSuspensionJSON(const std::string& filename) {
 std::shared_ptr<ChSteering> ReadSteeringJSON(const std::string& filename) {
     std::shared_ptr<ChSteering> steering;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a steering specification file.
     assert(d.HasMember("Type"));
@@ -874,10 +939,10 @@ std::shared_ptr<ChSteering> ReadSteeringJSON(const std::string& filename) {
 std::shared_ptr<ChDrivelineWV> ReadDrivelineWVJSON(const std::string& filename) {
     std::shared_ptr<ChDrivelineWV> driveline;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a driveline specification file.
     assert(d.HasMember("Type"));
@@ -907,10 +972,10 @@ std::shared_ptr<ChDrivelineWV> ReadDrivelineWVJSON(const std::string& filename)
 std::shared_ptr<ChAntirollBar> ReadAntirollbarJSON(const std::string& filename) {
     std::shared_ptr<ChAntirollBar> antirollbar;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is an antirollbar specification file.
     assert(d.HasMember("Type"));
@@ -934,10 +999,10 @@ std::shared_ptr<ChAntirollBar> ReadAntirollbarJSON(const std::string& filename)
 std::shared_ptr<ChWheel> ReadWheelJSON(const std::string& filename) {
     std::shared_ptr<ChWheel> wheel;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a wheel specification file.
     assert(d.HasMember("Type"));
@@ -961,10 +1026,10 @@ std::shared_ptr<ChWheel> ReadWheelJSON(const std::string& filename) {
 std::shared_ptr<ChSubchassis> ReadSubchassisJSON(const std::string& filename) {
     std::shared_ptr<ChSubchassis> chassis;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a wheel specification file.
     assert(d.HasMember("Type"));
@@ -988,10 +1053,10 @@ std::shared_ptr<ChSubchassis> ReadSubchassisJSON(const std::string& filename) {
 std::shared_ptr<ChBrake> ReadBrakeJSON(const std::string& filename) {
     std::shared_ptr<ChBrake> brake;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a brake specification file.
     assert(d.HasMember("Type"));
@@ -1017,10 +1082,10 @@ std::shared_ptr<ChBrake> ReadBrakeJSON(const std::string& filename) {
 std::shared_ptr<ChTire> ReadTireJSON(const std::string& filename) {
     std::shared_ptr<ChTire> tire;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a tire specification file.
     assert(d.HasMember("Type"));
@@ -1062,10 +1127,10 @@ std::shared_ptr<ChTire> ReadTireJSON(const std::string& filename) {
 std::shared_ptr<ChTrackAssembly> ReadTrackAssemblyJSON(const std::string& filename) {
     std::shared_ptr<ChTrackAssembly> track;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a steering specification file.
     assert(d.HasMember("Type"));
@@ -1095,10 +1160,10 @@ std::shared_ptr<ChTrackAssembly> ReadTrackAssemblyJSON(const std::string& filena
 std::shared_ptr<ChDrivelineTV> ReadDrivelineTVJSON(const std::string& filename) {
     std::shared_ptr<ChDrivelineTV> driveline;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a driveline specification file.
     assert(d.HasMember("Type"));
@@ -1124,10 +1189,10 @@ std::shared_ptr<ChDrivelineTV> ReadDrivelineTVJSON(const std::string& filename)
 std::shared_ptr<ChTrackBrake> ReadTrackBrakeJSON(const std::string& filename) {
     std::shared_ptr<ChTrackBrake> brake;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a brake specification file.
     assert(d.HasMember("Type"));
@@ -1153,10 +1218,10 @@ std::shared_ptr<ChTrackBrake> ReadTrackBrakeJSON(const std::string& filename) {
 std::shared_ptr<ChIdler> ReadIdlerJSON(const std::string& filename) {
     std::shared_ptr<ChIdler> idler;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is an idler specification file.
     assert(d.HasMember("Type"));
@@ -1182,10 +1247,10 @@ std::shared_ptr<ChIdler> ReadIdlerJSON(const std::string& filename) {
 std::shared_ptr<ChTrackSuspension> ReadTrackSuspensionJSON(const std::string& filename, bool has_shock, bool lock_arm) {
     std::shared_ptr<ChTrackSuspension> suspension;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a track suspension specification file.
     assert(d.HasMember("Type"));
@@ -1211,10 +1276,10 @@ std::shared_ptr<ChTrackSuspension> ReadTrackSuspensionJSON(const std::string& fi
 std::shared_ptr<ChTrackWheel> ReadTrackWheelJSON(const std::string& filename) {
     std::shared_ptr<ChTrackWheel> wheel;
 
-    Document d;
-    ReadFileJSON(filename, d);
-    if (d.IsNull())
+    auto doc = ReadCachedFileJSON(filename);
+    if (!doc)
         return nullptr;
+    const Document& d = *doc;
 
     // Check that the given file is a road-wheel specification file.
     assert(d.HasMember("Type"));
@@ -19,6 +19,7 @@
 #ifndef CH_JSON_UTILS_H
 #define CH_JSON_UTILS_H
 
+#include <memory>
 #include <vector>
 
 #include "chrono/assets/ChColor.h"
@@ -53,8 +54,20 @@ namespace vehicle {
 
 /// Load and return a RapidJSON document from the specified file.
 /// A Null document is returned if the file cannot be opened.
+/// The raw file contents are kept in an internal cache, so that repeated reads of the same specification file (e.g.
+/// when constructing many identical vehicles) parse from memory. This function is thread-safe.
 CH_VEHICLE_API void ReadFileJSON(const std::string& filename, rapidjson::Document& d);
 
+/// Load and return a shared RapidJSON document for the specified file.
+/// Each specification file is parsed at most once per process; subsequent calls return the cached document.
+/// An empty pointer is returned if the file cannot be opened or is not valid JSON.
+/// The returned document is shared between callers and must not be modified. This function is thread-safe.
+CH_VEHICLE_API std::shared_ptr<const rapidjson::Document> ReadCachedFileJSON(const std::string& filename);
+
+/// Clear the caches of specification file contents and parsed documents used by ReadFileJSON() and
+/// ReadCachedFileJSON().
+CH_VEHICLE_API void ClearFileCacheJSON();
+
 // -----------------------------------------------------------------------------
 
 /// Load and return a ChVector from the specified JSON array
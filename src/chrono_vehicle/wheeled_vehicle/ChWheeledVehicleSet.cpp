@@ -0,0 +1,91 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Manager for a set of wheeled vehicles simulated in a single Chrono system
+//
+// =============================================================================
+
+#include <cassert>
+
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicleSet.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChWheeledVehicleSet::ChWheeledVehicleSet(ChSystem* system) : m_system(system) {}
+
+void ChWheeledVehicleSet::AddVehicle(std::shared_ptr<ChWheeledVehicle> vehicle) {
+    assert(vehicle->GetSystem() == m_system);
+    m_vehicles.push_back(vehicle);
+}
+
+void ChWheeledVehicleSet::EnableBatchedTireForces(bool val) {
+    m_batch_tires.clear();
+    if (!val)
+        return;
+
+    // Collect all TMsimple tires in the set
+    for (const auto& vehicle : m_vehicles) {
+        for (const auto& axle : vehicle->GetAxles()) {
+            for (const auto& wheel : axle->GetWheels()) {
+                if (auto tire = std::dynamic_pointer_cast<ChTMsimpleTire>(wheel->GetTire()))
+                    m_batch_tires.push_back(tire.get());
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Update the state of all managed vehicles at the current time.
+// Vehicles are processed in parallel: each worker thread updates the subsystems
+// of a different vehicle, so that tire force evaluations (and the terrain
+// queries they perform) overlap across vehicles. This is safe because vehicle
+// subsystems only modify state of their own vehicle and terrain queries are
+// read-only.
+// -----------------------------------------------------------------------------
+void ChWheeledVehicleSet::Synchronize(double time, const std::vector<DriverInputs>& driver_inputs, const ChTerrain& terrain) {
+    assert(driver_inputs.size() == m_vehicles.size());
+
+    int nv = (int)m_vehicles.size();
+    int nthreads = m_system->GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (int i = 0; i < nv; i++) {
+        m_vehicles[i]->Synchronize(time, driver_inputs[i], terrain);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Advance the state of all managed vehicles by the specified time step.
+// Tire and powertrain internal dynamics are advanced in parallel across
+// vehicles; since no managed vehicle owns the underlying system, the multibody
+// system is then stepped once for the entire set.
+// -----------------------------------------------------------------------------
+void ChWheeledVehicleSet::Advance(double step) {
+    int nv = (int)m_vehicles.size();
+    int nthreads = m_system->GetNumThreadsChrono();
+
+    // Evaluate TMsimple tire forces for the entire set in one vectorized sweep (if enabled).
+    // The tires cache their forces and skip the calculation in their individual Advance calls below.
+    if (!m_batch_tires.empty())
+        ChTMsimpleTire::AdvanceBatch(m_batch_tires, step);
+
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (int i = 0; i < nv; i++) {
+        m_vehicles[i]->Advance(step);
+    }
+
+    m_system->DoStepDynamics(step);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,76 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Manager for a set of wheeled vehicles simulated in a single Chrono system
+//
+// =============================================================================
+
+#ifndef CH_WHEELED_VEHICLE_SET_H
+#define CH_WHEELED_VEHICLE_SET_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicle.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChTMsimpleTire.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled
+/// @{
+
+/// Manager for a set of wheeled vehicles simulated in a single Chrono system.
+/// This class batches the per-step vehicle updates for scenarios with many vehicles (e.g., traffic simulation):
+/// vehicle subsystems and tires are synchronized and advanced in parallel across vehicles, while the underlying
+/// multibody system is stepped once for the entire set. All managed vehicles must have been constructed with the
+/// shared Chrono system passed to this manager (so that no vehicle steps the system on its own in Advance).
+class CH_VEHICLE_API ChWheeledVehicleSet {
+  public:
+    ChWheeledVehicleSet(ChSystem* system);
+
+    /// Add a vehicle to the set.
+    /// The vehicle must have been constructed with the system associated with this manager.
+    void AddVehicle(std::shared_ptr<ChWheeledVehicle> vehicle);
+
+    /// Get the vehicles currently managed by this set.
+    const std::vector<std::shared_ptr<ChWheeledVehicle>>& GetVehicles() const { return m_vehicles; }
+
+    /// Enable batched evaluation of TMsimple tire forces (default: false).
+    /// If enabled, the force calculations of all TMsimple tires in the set are performed in a single vectorized
+    /// sweep at the beginning of Advance (see ChTMsimpleTire::AdvanceBatch). Tires of other types are unaffected.
+    /// This function must be called after all vehicles were added and their tires initialized.
+    void EnableBatchedTireForces(bool val);
+
+    /// Update the state of all managed vehicles at the current time.
+    /// The number of driver input structures must match the number of managed vehicles. Vehicles are processed
+    /// concurrently (one per worker thread); in particular, the tire force evaluations of different vehicles
+    /// overlap, together with their terrain queries.
+    void Synchronize(double time, const std::vector<DriverInputs>& driver_inputs, const ChTerrain& terrain);
+
+    /// Advance the state of all managed vehicles by the specified time step.
+    /// Tire and powertrain internal dynamics are advanced concurrently across vehicles, after which the shared
+    /// multibody system is stepped once.
+    void Advance(double step);
+
+  private:
+    ChSystem* m_system;                                         ///< shared multibody system
+    std::vector<std::shared_ptr<ChWheeledVehicle>> m_vehicles;  ///< managed vehicles
+    std::vector<ChTMsimpleTire*> m_batch_tires;                 ///< TMsimple tires evaluated in a batched sweep
+};
+
+/// @} vehicle_wheeled
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -88,6 +88,12 @@ void ANCFTire::ProcessJSON(const rapidjson::Document& d) {
     // Default tire pressure
     m_default_pressure = d["Default Pressure"].GetDouble();
 
+    // Optional modal reduction of the FEA model (requires the Chrono::Modal module)
+    if (d.HasMember("Modal Reduction")) {
+        int num_modes = d["Modal Reduction"]["Number of Modes"].GetInt();
+        EnableModalReduction(num_modes);
+    }
+
     // Read layer information for the Bead Section
     m_bead.num_divs = d["Bead Section"]["Number Elements"].GetInt();
     m_bead.num_layers = d["Bead Section"]["Layer Thickness"].Size();
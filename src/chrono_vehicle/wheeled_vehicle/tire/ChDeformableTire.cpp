@@ -20,7 +20,19 @@
 //// extend this and derived classes to allow use in a double-wheel setup.
 //// in particular, check how the tire FEA mesh is attached to the rim.
 
+#include "chrono/ChConfig.h"
+
 #include "chrono_vehicle/wheeled_vehicle/tire/ChDeformableTire.h"
+#include "chrono_vehicle/ChWorldFrame.h"
+
+#ifdef CHRONO_MODAL
+    #include <unordered_map>
+
+    #include "chrono/fea/ChNodeFEAxyzrot.h"
+    #include "chrono/physics/ChLoaderUV.h"
+
+    #include "chrono_modal/ChModalAssembly.h"
+#endif
 
 namespace chrono {
 namespace vehicle {
@@ -33,26 +45,151 @@ ChDeformableTire::ChDeformableTire(const std::string& name)
       m_connection_enabled(true),
       m_pressure_enabled(true),
       m_contact_enabled(true),
+      m_modal_enabled(false),
+      m_num_modes(0),
       m_contact_type(ContactSurfaceType::NODE_CLOUD),
       m_contact_node_radius(0.001),
-      m_contact_face_thickness(0.0) {}
+      m_contact_face_thickness(0.0),
+      m_terrain(nullptr) {}
 
 ChDeformableTire::~ChDeformableTire() {
     auto sys = m_mesh->GetSystem();
     if (sys) {
-        sys->Remove(m_mesh);
-        sys->Remove(m_load_container);
-        for (size_t i = 0; i < m_connections.size(); i++) {
-            sys->Remove(m_connections[i]);
+        if (m_modal_assembly) {
+            // The mesh, load container, and rim connections are all owned by the modal assembly.
+            sys->Remove(m_modal_assembly);
+            if (m_rim_weld)
+                sys->Remove(m_rim_weld);
+        } else {
+            sys->Remove(m_mesh);
+            sys->Remove(m_load_container);
+            for (size_t i = 0; i < m_connections.size(); i++) {
+                sys->Remove(m_connections[i]);
+            }
+            for (size_t i = 0; i < m_connectionsD.size(); i++) {
+                sys->Remove(m_connectionsD[i]);
+            }
+            for (size_t i = 0; i < m_connectionsF.size(); i++) {
+                sys->Remove(m_connectionsF[i]);
+            }
         }
-        for (size_t i = 0; i < m_connectionsD.size(); i++) {
-            sys->Remove(m_connectionsD[i]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+#ifdef CHRONO_MODAL
+
+/// Callback for evaluating the force loads of a modally-reduced deformable tire.
+/// Pressure loads and nodal tire-terrain contact forces are evaluated on the full FEA mesh, at the current
+/// configuration which the modal assembly keeps updated from the modal coordinates, and are written into the
+/// full-coordinate force vector; the modal assembly then projects this vector onto the reduced coordinates
+/// through the modal basis.
+class DeformableTireModalForce : public modal::ChModalAssembly::CustomForceFullCallback {
+  public:
+    DeformableTireModalForce(ChDeformableTire* tire) : m_tire(tire) {}
+
+    virtual void evaluate(ChVectorDynamic<>& computed_custom_F_full, const modal::ChModalAssembly& assembly) override {
+        computed_custom_F_full.setZero();
+
+        if (m_var_rows.empty())
+            MapNodeRows();
+
+        // Pressure loads, re-evaluated at the current mesh configuration.
+        for (const auto& load : m_tire->m_load_container->GetLoadList()) {
+            auto pload = std::dynamic_pointer_cast<ChLoad<ChLoaderPressure>>(load);
+            if (!pload)
+                continue;
+            pload->loader.ComputeQ(nullptr, nullptr);
+            std::vector<ChVariables*> vars;
+            pload->loader.GetLoadable()->LoadableGetVariables(vars);
+            int qoff = 0;
+            for (const auto& var : vars) {
+                auto it = m_var_rows.find(var);
+                if (it != m_var_rows.end())
+                    computed_custom_F_full.segment(it->second, var->Get_ndof()) +=
+                        pload->loader.Q.segment(qoff, var->Get_ndof());
+                qoff += var->Get_ndof();
+            }
         }
-        for (size_t i = 0; i < m_connectionsF.size(); i++) {
-            sys->Remove(m_connectionsF[i]);
+
+        // Nodal tire-terrain contact forces (penalty formulation with the tire contact material coefficients).
+        if (!m_tire->m_contact_enabled || !m_tire->m_terrain)
+            return;
+
+        const ChTerrain* terrain = m_tire->m_terrain;
+        double radius = m_tire->m_contact_node_radius;
+        double kn = m_tire->m_contact_mat->GetKn();
+        double gn = m_tire->m_contact_mat->GetGn();
+        double gt = m_tire->m_contact_mat->GetGt();
+
+        for (const auto& cn : m_contact_nodes) {
+            ChVector<> pos = cn.xyz ? cn.xyz->GetPos() : cn.xyzrot->GetPos();
+            ChVector<> vel = cn.xyz ? cn.xyz->GetPos_dt() : cn.xyzrot->GetPos_dt();
+
+            ChVector<> normal = terrain->GetNormal(pos);
+            double depth =
+                (terrain->GetHeight(pos) - ChWorldFrame::Height(pos) + radius) * Vdot(ChWorldFrame::Vertical(), normal);
+            if (depth <= 0)
+                continue;
+
+            // Normal force (spring-damper, clamped to compression)
+            double vn = Vdot(vel, normal);
+            double Fn = kn * depth - gn * vn;
+            if (Fn <= 0)
+                continue;
+
+            // Tangential force (viscous, capped by Coulomb friction)
+            double mu = 0.5 * (m_tire->m_contact_mat->GetSfriction() + terrain->GetCoefficientFriction(pos));
+            ChVector<> vt = vel - vn * normal;
+            double vt_mag = vt.Length();
+            ChVector<> force = Fn * normal;
+            if (vt_mag > 1e-6)
+                force -= (std::min(gt * vt_mag, mu * Fn) / vt_mag) * vt;
+
+            computed_custom_F_full.segment(cn.row, 3) += force.eigen();
         }
     }
-}
+
+  private:
+    struct ContactNode {
+        fea::ChNodeFEAxyz* xyz;        ///< node with translational coordinates first (or null)
+        fea::ChNodeFEAxyzrot* xyzrot;  ///< node with a full frame (or null)
+        int row;                       ///< row of the node translational coordinates in the full force vector
+    };
+
+    /// Map the state variables of the mesh nodes to their rows in the full-coordinate force vector of the modal
+    /// assembly (boundary coordinates first, then internal coordinates, in assembly setup order).
+    void MapNodeRows() {
+        auto mesh = m_tire->m_mesh;
+        int row = (int)mesh->GetOffset_w() - (int)m_tire->m_modal_assembly->GetOffset_w();
+        for (unsigned int in = 0; in < mesh->GetNnodes(); in++) {
+            auto node = std::dynamic_pointer_cast<fea::ChNodeFEAbase>(mesh->GetNode(in));
+            if (!node || node->IsFixed())
+                continue;
+            if (auto loadable = std::dynamic_pointer_cast<ChLoadable>(node)) {
+                std::vector<ChVariables*> vars;
+                loadable->LoadableGetVariables(vars);
+                int r = row;
+                for (const auto& var : vars) {
+                    m_var_rows[var] = r;
+                    r += var->Get_ndof();
+                }
+            }
+            if (auto xyz = std::dynamic_pointer_cast<fea::ChNodeFEAxyz>(node))
+                m_contact_nodes.push_back({xyz.get(), nullptr, row});
+            else if (auto xyzrot = std::dynamic_pointer_cast<fea::ChNodeFEAxyzrot>(node))
+                m_contact_nodes.push_back({nullptr, xyzrot.get(), row});
+            row += node->GetNdofW_active();
+        }
+    }
+
+    ChDeformableTire* m_tire;                           ///< associated tire
+    std::unordered_map<ChVariables*, int> m_var_rows;   ///< map of node variables to force vector rows
+    std::vector<ContactNode> m_contact_nodes;           ///< mesh nodes tested for contact with the terrain
+};
+
+#endif  // CHRONO_MODAL
 
 // -----------------------------------------------------------------------------
 void ChDeformableTire::Initialize(std::shared_ptr<ChWheel> wheel) {
@@ -61,16 +198,42 @@ void ChDeformableTire::Initialize(std::shared_ptr<ChWheel> wheel) {
     ChSystemSMC* system = dynamic_cast<ChSystemSMC*>(wheel->GetSpindle()->GetSystem());
     assert(system);
 
-    // Create the tire mesh
+#ifndef CHRONO_MODAL
+    if (m_modal_enabled) {
+        std::cerr << "WARNING: Modal tire reduction requires the Chrono::Modal module. Using the full FEA model."
+                  << std::endl;
+        m_modal_enabled = false;
+    }
+#endif
+
+    // Create the tire mesh.
+    // If modal reduction is enabled, the mesh is created as the internal part of a modal assembly, so that its
+    // nodes can be condensed to modal coordinates; otherwise, it is added directly to the system.
     m_mesh = chrono_types::make_shared<ChMesh>();
-    system->Add(m_mesh);
+#ifdef CHRONO_MODAL
+    std::shared_ptr<modal::ChModalAssembly> modal_assembly;
+    if (m_modal_enabled) {
+        modal_assembly = chrono_types::make_shared<modal::ChModalAssembly>();
+        modal_assembly->SetInternalNodesUpdate(true);
+        system->Add(modal_assembly);
+        modal_assembly->AddInternalMesh(m_mesh);
+        m_modal_assembly = modal_assembly;
+    }
+#endif
+    if (!m_modal_assembly)
+        system->Add(m_mesh);
 
     // Create the FEA nodes and elements
     CreateMesh(*(wheel->GetSpindle().get()), wheel->GetSide());
 
     // Create a load container
     m_load_container = chrono_types::make_shared<ChLoadContainer>();
-    system->Add(m_load_container);
+#ifdef CHRONO_MODAL
+    if (modal_assembly)
+        modal_assembly->AddInternal(m_load_container);
+#endif
+    if (!m_modal_assembly)
+        system->Add(m_load_container);
 
     // Enable tire pressure
     if (m_pressure_enabled) {
@@ -85,16 +248,72 @@ void ChDeformableTire::Initialize(std::shared_ptr<ChWheel> wheel) {
     // Enable tire contact
     if (m_contact_enabled) {
         // Let the derived class create the contact surface and add it to the mesh.
+        // In the modal case, no contact surface is created: the collision system cannot act on the condensed mesh
+        // nodes, so tire-terrain contact is evaluated in the custom force callback instead.
         CreateContactMaterial();
         assert(m_contact_mat && m_contact_mat->GetContactMethod() == ChContactMethod::SMC);
-        CreateContactSurface();
+        if (!m_modal_enabled)
+            CreateContactSurface();
     }
 
     // Enable tire connection to rim
     if (m_connection_enabled) {
+#ifdef CHRONO_MODAL
+        if (modal_assembly) {
+            // Create a rim interface body, welded to the spindle, as the boundary of the modal assembly. The rim
+            // connections are created against this body and condensed together with the mesh, so that the reduced
+            // tire interacts with the rest of the vehicle only through the (fully retained) interface body.
+            m_rim_body = chrono_types::make_shared<ChBody>();
+            m_rim_body->SetPos(wheel->GetSpindle()->GetPos());
+            m_rim_body->SetRot(wheel->GetSpindle()->GetRot());
+            m_rim_body->SetMass(1e-3);
+            m_rim_body->SetInertiaXX(ChVector<>(1e-5, 1e-5, 1e-5));
+            modal_assembly->Add(m_rim_body);
+
+            m_rim_weld = chrono_types::make_shared<ChLinkMateFix>();
+            m_rim_weld->Initialize(m_rim_body, wheel->GetSpindle());
+            system->Add(m_rim_weld);
+
+            // Let the derived class create the constraints; these are added to the system, so move them into the
+            // modal assembly as internal links.
+            CreateRimConnections(m_rim_body);
+            for (const auto& link : m_connections) {
+                system->Remove(link);
+                modal_assembly->AddInternalLink(link);
+            }
+            for (const auto& link : m_connectionsD) {
+                system->Remove(link);
+                modal_assembly->AddInternalLink(link);
+            }
+            for (const auto& link : m_connectionsF) {
+                system->Remove(link);
+                modal_assembly->AddInternalLink(link);
+            }
+        } else {
+            // Let the derived class create the constraints and add them to the system.
+            CreateRimConnections(wheel->GetSpindle());
+        }
+#else
         // Let the derived class create the constraints and add them to the system.
         CreateRimConnections(wheel->GetSpindle());
+#endif
+    }
+
+#ifdef CHRONO_MODAL
+    // Perform the modal reduction
+    if (modal_assembly) {
+        // Register the callback which evaluates pressure and contact forces on the full mesh; the modal assembly
+        // projects these onto the reduced coordinates through the modal basis.
+        modal_assembly->RegisterCallback_CustomForceFull(chrono_types::make_shared<DeformableTireModalForce>(this));
+
+        // Condense the mesh to the requested number of modal coordinates, transforming the structural damping of
+        // the full model onto the reduced coordinates.
+        system->Setup();
+        system->Update();
+        modal_assembly->SwitchModalReductionON(modal::ChModalSolveUndamped(m_num_modes),
+                                               modal::ChModalDampingReductionR(*modal_assembly));
     }
+#endif
 }
 
 void ChDeformableTire::AddVisualizationAssets(VisualizationType vis) {
@@ -116,7 +335,7 @@ void ChDeformableTire::RemoveVisualizationAssets() {
 
 // -----------------------------------------------------------------------------
 std::shared_ptr<ChContactSurface> ChDeformableTire::GetContactSurface() const {
-    if (m_contact_enabled) {
+    if (m_contact_enabled && !m_modal_enabled) {
         return m_mesh->GetContactSurface(0);
     }
 
@@ -166,6 +385,19 @@ TerrainForce ChDeformableTire::ReportTireForce(ChTerrain* terrain) const {
     // These encapsulate the tire-terrain interaction forces and the inertia of the tire itself.
     ChVector<> force;
     ChVector<> moment;
+
+    // For a modally-reduced tire, the rim connections are condensed with the mesh and all tire-wheel interaction
+    // is transmitted through the weld joint between the rim interface body and the spindle.
+    if (m_rim_weld) {
+        ChCoordsys<> csys = m_rim_weld->GetLinkAbsoluteCoords();
+        ChVector<> react = csys.TransformDirectionLocalToParent(m_rim_weld->Get_react_force());
+        m_wheel->GetSpindle()->To_abs_forcetorque(react, csys.pos, false, force, moment);
+        tire_force.force += force;
+        tire_force.moment += moment;
+        ChVector<> reactMoment = csys.TransformDirectionLocalToParent(m_rim_weld->Get_react_torque());
+        tire_force.moment += reactMoment;
+        return tire_force;
+    }
     for (size_t ic = 0; ic < m_connections.size(); ic++) {
         ChCoordsys<> csys = m_connections[ic]->GetLinkAbsoluteCoords();
         ChVector<> react = csys.TransformDirectionLocalToParent(m_connections[ic]->GetReactionOnBody());
@@ -87,6 +87,20 @@ class CH_VEHICLE_API ChDeformableTire : public ChTire {
     void EnableRimConnection(bool val) { m_connection_enabled = val; }
     bool IsRimConnectionEnabled() const { return m_connection_enabled; }
 
+    /// Enable modal reduction of the tire FEA model, retaining the specified number of modes (default: disabled).
+    /// If enabled, the tire mesh is created as the internal part of a modal assembly which is condensed at
+    /// initialization to the given number of modal coordinates, with the rim interface retained as boundary.
+    /// Pressure and tire-terrain contact forces are evaluated on the full mesh (kept updated from the modal
+    /// coordinates) and mapped onto the reduced coordinates through the modal basis; contact uses a nodal penalty
+    /// formulation with the coefficients of the tire contact material, against the terrain specified at Synchronize.
+    /// This feature requires the Chrono::Modal module; if Chrono was built without it, the full FEA model is used
+    /// and a warning is issued.
+    void EnableModalReduction(int num_modes) {
+        m_modal_enabled = true;
+        m_num_modes = num_modes;
+    }
+    bool IsModalReductionEnabled() const { return m_modal_enabled; }
+
     /// Get a handle to the mesh visualization.
     ChVisualShapeFEA* GetMeshVisualization() const { return m_visualization.get(); }
 
@@ -114,6 +128,11 @@ class CH_VEHICLE_API ChDeformableTire : public ChTire {
     /// Currently *NOT IMPLEMENTED*.
     virtual TerrainForce ReportTireForce(ChTerrain* terrain, ChCoordsys<>& tire_frame) const override;
 
+    /// Update the state of this tire system at the current time.
+    /// A deformable tire interacts with the terrain through the collision system, so no tire forces are calculated
+    /// here; however, a modally-reduced tire caches the terrain for contact evaluation in its force callback.
+    virtual void Synchronize(double time, const ChTerrain& terrain) override { m_terrain = &terrain; }
+
     /// Add visualization assets for the rigid tire subsystem.
     virtual void AddVisualizationAssets(VisualizationType vis) override final;
 
@@ -160,6 +179,13 @@ class CH_VEHICLE_API ChDeformableTire : public ChTire {
     bool m_pressure_enabled;    ///< enable internal tire pressure
     bool m_contact_enabled;     ///< enable tire-terrain contact
 
+    bool m_modal_enabled;                          ///< use a modally-reduced FEA model
+    int m_num_modes;                               ///< number of modes retained in the modal reduction
+    std::shared_ptr<ChAssembly> m_modal_assembly;  ///< modal assembly (only if modal reduction enabled)
+    std::shared_ptr<ChBody> m_rim_body;            ///< rim interface body (only if modal reduction enabled)
+    std::shared_ptr<ChLinkMateFix> m_rim_weld;     ///< connection of the rim interface body to the spindle
+    const ChTerrain* m_terrain;                    ///< terrain (cached at Synchronize, for modal contact)
+
     ContactSurfaceType m_contact_type;  ///< type of contact surface model (node cloud or mesh)
     double m_contact_node_radius;       ///< node radius (for node cloud contact surface)
     double m_contact_face_thickness;    ///< face thickness (for mesh contact surface)
@@ -185,6 +211,8 @@ class CH_VEHICLE_API ChDeformableTire : public ChTire {
     /// A ChDeformableTire always returns zero forces and moments since tire forces
     /// are implicitly applied to the associated wheel through the tire-wheel connections.
     virtual TerrainForce GetTireForce() const override final;
+
+    friend class DeformableTireModalForce;
 };
 
 /// @} vehicle_wheeled_tire
@@ -67,7 +67,13 @@ ChTMeasyTire::ChTMeasyTire(const std::string& name)
       m_frblend_begin(1.0),
       m_frblend_end(3.0),
       m_bottom_radius(0.0),
-      m_bottom_stiffness(0.0) {
+      m_bottom_stiffness(0.0),
+      m_use_lut(false),
+      m_lut_nq(0),
+      m_lut_ns(0),
+      m_lut_na(0),
+      m_lut_qmax(0),
+      m_lut_smax(0) {
     m_tireforce.force = ChVector<>(0, 0, 0);
     m_tireforce.point = ChVector<>(0, 0, 0);
     m_tireforce.moment = ChVector<>(0, 0, 0);
@@ -226,16 +232,26 @@ void ChTMeasyTire::Advance(double step) {
         salpha = sqrt(2.0) / 2.0;
     }
 
-    // Calculate resultant Curve Parameters
-    double df0 = hypot(m_states.dfx0 * calpha, m_states.dfy0 * salpha);
-    double fm = m_states.muscale * hypot(m_states.fxm * calpha, m_states.fym * salpha);
-    double sm = m_states.muscale * hypot(m_states.sxm * calpha, m_states.sym * salpha);
-    double fs = m_states.muscale * hypot(m_states.fxs * calpha, m_states.fys * salpha);
-    double ss = m_states.muscale * hypot(m_states.sxs * calpha, m_states.sys * salpha);
     double f = 0.0;
     double fos = 0.0;
 
-    tmxy_combined(f, fos, sc, df0, sm, fm, ss, fs);
+    if (m_use_lut) {
+        // The force response only depends on the slip direction through squared direction cosines, so the
+        // table covers alpha in [0, pi/2]. It is built at nominal road friction; deviations of the local
+        // friction coefficient are applied as a multiplicative scaling (exact at mu_0).
+        SampleForceLUT(m_states.q, sc, std::atan2(std::abs(sy), std::abs(sx)), f, fos);
+        f *= m_states.muscale;
+        fos *= m_states.muscale;
+    } else {
+        // Calculate resultant Curve Parameters
+        double df0 = hypot(m_states.dfx0 * calpha, m_states.dfy0 * salpha);
+        double fm = m_states.muscale * hypot(m_states.fxm * calpha, m_states.fym * salpha);
+        double sm = m_states.muscale * hypot(m_states.sxm * calpha, m_states.sym * salpha);
+        double fs = m_states.muscale * hypot(m_states.fxs * calpha, m_states.fys * salpha);
+        double ss = m_states.muscale * hypot(m_states.sxs * calpha, m_states.sys * salpha);
+
+        tmxy_combined(f, fos, sc, df0, sm, fm, ss, fs);
+    }
     if (sc > 0.0) {
         Fx = f * sx / sc;
         Fy = f * sy / sc;
@@ -364,6 +380,93 @@ double ChTMeasyTire::AlignmentTorque(double fy) {
 
 // -----------------------------------------------------------------------------
 
+void ChTMeasyTire::EnableForceLUT(int num_load, int num_slip, int num_dir) {
+    assert(m_par.pn > 0);  // tire parameters must be set (call after Initialize)
+
+    m_lut_nq = std::max(num_load, 2);
+    m_lut_ns = std::max(num_slip, 2);
+    m_lut_na = std::max(num_dir, 2);
+    m_lut_qmax = m_par.pn_max / m_par.pn;
+
+    // Local interpolation helpers over the normalized load (the member versions read m_states.q).
+    auto interpL = [](double q, double w1, double w2) { return w1 + (w2 - w1) * (q - 1.0); };
+    auto interpQ = [](double q, double w1, double w2) { return q * (2.0 * w1 - 0.5 * w2 - (w1 - 0.5 * w2) * q); };
+
+    // Cover the slip range up to the largest full-sliding slip over the tabulated load range (the sliding
+    // slips vary linearly with load, so checking the interval ends suffices), with some headroom. For any
+    // larger slip the clamped lookup returns the constant full-sliding force.
+    double smax = 0;
+    for (double q : {0.0, m_lut_qmax}) {
+        smax = std::max(smax, interpL(q, m_par.sxs_pn, m_par.sxs_p2n));
+        smax = std::max(smax, interpL(q, m_par.sys_pn, m_par.sys_p2n));
+    }
+    m_lut_smax = 1.25 * smax;
+
+    m_lut_f.resize((size_t)m_lut_nq * m_lut_na * m_lut_ns);
+    m_lut_fos.resize((size_t)m_lut_nq * m_lut_na * m_lut_ns);
+
+    // Tabulate the master equation at nominal road friction (muscale = 1). tmxy_combined only operates on
+    // its arguments, so the grid nodes can be filled concurrently.
+#pragma omp parallel for
+    for (int iq = 0; iq < m_lut_nq; iq++) {
+        double q = m_lut_qmax * iq / (m_lut_nq - 1);
+        double dfx0 = interpQ(q, m_par.dfx0_pn, m_par.dfx0_p2n);
+        double sxm = interpL(q, m_par.sxm_pn, m_par.sxm_p2n);
+        double fxm = interpQ(q, m_par.fxm_pn, m_par.fxm_p2n);
+        double sxs = interpL(q, m_par.sxs_pn, m_par.sxs_p2n);
+        double fxs = interpQ(q, m_par.fxs_pn, m_par.fxs_p2n);
+        double dfy0 = interpQ(q, m_par.dfy0_pn, m_par.dfy0_p2n);
+        double sym = interpL(q, m_par.sym_pn, m_par.sym_p2n);
+        double fym = interpQ(q, m_par.fym_pn, m_par.fym_p2n);
+        double sys = interpL(q, m_par.sys_pn, m_par.sys_p2n);
+        double fys = interpQ(q, m_par.fys_pn, m_par.fys_p2n);
+        for (int ia = 0; ia < m_lut_na; ia++) {
+            double alpha = CH_C_PI_2 * ia / (m_lut_na - 1);
+            double calpha = std::cos(alpha);
+            double salpha = std::sin(alpha);
+            double df0 = hypot(dfx0 * calpha, dfy0 * salpha);
+            double fm = hypot(fxm * calpha, fym * salpha);
+            double sm = hypot(sxm * calpha, sym * salpha);
+            double fs = hypot(fxs * calpha, fys * salpha);
+            double ss = hypot(sxs * calpha, sys * salpha);
+            for (int is = 0; is < m_lut_ns; is++) {
+                double s = m_lut_smax * is / (m_lut_ns - 1);
+                size_t idx = ((size_t)iq * m_lut_na + ia) * m_lut_ns + is;
+                tmxy_combined(m_lut_f[idx], m_lut_fos[idx], s, df0, sm, fm, ss, fs);
+            }
+        }
+    }
+
+    m_use_lut = true;
+}
+
+void ChTMeasyTire::SampleForceLUT(double q, double sc, double alpha, double& f, double& fos) const {
+    double gq = ChClamp(q / m_lut_qmax, 0.0, 1.0) * (m_lut_nq - 1);
+    double ga = ChClamp(alpha / CH_C_PI_2, 0.0, 1.0) * (m_lut_na - 1);
+    double gs = ChClamp(sc / m_lut_smax, 0.0, 1.0) * (m_lut_ns - 1);
+    int iq = std::min((int)gq, m_lut_nq - 2);
+    int ia = std::min((int)ga, m_lut_na - 2);
+    int is = std::min((int)gs, m_lut_ns - 2);
+    double wq = gq - iq;
+    double wa = ga - ia;
+    double ws = gs - is;
+
+    f = 0;
+    fos = 0;
+    for (int dq = 0; dq < 2; dq++) {
+        for (int da = 0; da < 2; da++) {
+            for (int ds = 0; ds < 2; ds++) {
+                double w = (dq ? wq : 1.0 - wq) * (da ? wa : 1.0 - wa) * (ds ? ws : 1.0 - ws);
+                size_t idx = ((size_t)(iq + dq) * m_lut_na + (ia + da)) * m_lut_ns + (is + ds);
+                f += w * m_lut_f[idx];
+                fos += w * m_lut_fos[idx];
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 double ChTMeasyTire::GetNormalStiffnessForce(double depth) const {
     double F = depth * m_d1 + depth * depth * m_d2;  // tire force
     double free_depth = m_unloaded_radius - m_bottom_radius;
@@ -92,6 +92,16 @@ class CH_VEHICLE_API ChTMeasyTire : public ChForceElementTire {
 
     double GetTireOmega() { return m_states.omega; }
 
+    /// Precompute a lookup table of the combined slip force response (optional; call after Initialize).
+    /// The TMeasy force characteristics are evaluated once on a regular grid over (normalized vertical load,
+    /// combined slip magnitude, slip direction) and stored; Advance then answers by trilinear interpolation
+    /// instead of re-evaluating the curve parameters and the combined characteristic at every step. The table is
+    /// built in parallel over OpenMP threads at the nominal road friction mu_0; at runtime, deviations of the
+    /// local road friction are applied as a multiplicative scaling of the interpolated force, which is exact at
+    /// mu_0 and a good approximation for the small friction variations of paved roads. Intended as a calibrated
+    /// fast mode for real-time and HIL use on paved roads.
+    void EnableForceLUT(int num_load = 16, int num_slip = 64, int num_dir = 16);
+
     /// Get maximum tire load from Load Index (LI) in N [0:279].
     static double GetTireMaxLoad(unsigned int li);
 
@@ -275,6 +285,18 @@ class CH_VEHICLE_API ChTMeasyTire : public ChForceElementTire {
         ChVector<> disc_normal;  // (temporary for debug)
     };
 
+    /// Sample the force lookup table with trilinear interpolation (LUT must be enabled).
+    void SampleForceLUT(double q, double sc, double alpha, double& f, double& fos) const;
+
+    bool m_use_lut;                 ///< answer Advance from the precomputed force lookup table?
+    int m_lut_nq;                   ///< number of load samples
+    int m_lut_ns;                   ///< number of slip magnitude samples
+    int m_lut_na;                   ///< number of slip direction samples
+    double m_lut_qmax;              ///< largest tabulated normalized load
+    double m_lut_smax;              ///< largest tabulated slip magnitude
+    std::vector<double> m_lut_f;    ///< tabulated combined force magnitudes
+    std::vector<double> m_lut_fos;  ///< tabulated force/slip ratios
+
     TireStates m_states;
     std::shared_ptr<ChVisualShape> m_cyl_shape;  ///< visualization cylinder asset
 };
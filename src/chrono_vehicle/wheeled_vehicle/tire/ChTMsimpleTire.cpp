@@ -53,7 +53,8 @@ ChTMsimpleTire::ChTMsimpleTire(const std::string& name)
       m_frblend_begin(1.0),
       m_frblend_end(3.0),
       m_bottom_radius(0.0),
-      m_bottom_stiffness(0.0) {
+      m_bottom_stiffness(0.0),
+      m_batch_evaluated(false) {
     m_tireforce.force = ChVector<>(0, 0, 0);
     m_tireforce.point = ChVector<>(0, 0, 0);
     m_tireforce.moment = ChVector<>(0, 0, 0);
@@ -155,6 +156,12 @@ void ChTMsimpleTire::Synchronize(double time, const ChTerrain& terrain) {
 }
 
 void ChTMsimpleTire::Advance(double step) {
+    // If this tire was processed in a batched sweep, its forces are already current
+    if (m_batch_evaluated) {
+        m_batch_evaluated = false;
+        return;
+    }
+
     // Set tire forces to zero.
     m_tireforce.force = ChVector<>(0, 0, 0);
     m_tireforce.moment = ChVector<>(0, 0, 0);
@@ -253,6 +260,136 @@ void ChTMsimpleTire::TMcombinedForces(double& fx, double& fy, double sx, double
     fy = Fa * sbeta;
 }
 
+// -----------------------------------------------------------------------------
+// Batched evaluation of the tire forces for a set of TMsimple tires.
+// The scalar calculations of Advance, CombinedCoulombForces, and TMcombinedForces are replicated here in
+// structure-of-arrays form over all in-contact tires, with branches expressed as selects so that the sweep can be
+// vectorized. Any change to the scalar path must be mirrored here.
+// -----------------------------------------------------------------------------
+void ChTMsimpleTire::AdvanceBatch(const std::vector<ChTMsimpleTire*>& tires, double step) {
+    size_t num_tires = tires.size();
+
+    // Gather the in-contact tires; airborne tires get zero forces directly
+    std::vector<ChTMsimpleTire*> active;
+    active.reserve(num_tires);
+    for (auto tire : tires) {
+        if (tire->m_data.in_contact) {
+            active.push_back(tire);
+        } else {
+            tire->m_tireforce.force = ChVector<>(0, 0, 0);
+            tire->m_tireforce.moment = ChVector<>(0, 0, 0);
+            tire->m_batch_evaluated = true;
+        }
+    }
+    size_t n = active.size();
+    if (n == 0)
+        return;
+
+    // Pack slip states and model coefficients into contiguous arrays
+    std::vector<double> Fn(n), Fz(n), sx(n), sy(n), vsx(n), vsy(n), omega(n), gamma(n), depth(n), R_eff(n);
+    std::vector<double> mu(n), frblend(n), startup(n);
+    std::vector<double> ax1(n), ax2(n), ay1(n), ay2(n), bx1(n), bx2(n), by1(n), by2(n);
+    std::vector<double> cx1(n), cx2(n), cy1(n), cy2(n);
+    std::vector<double> pn(n), vcoulomb(n), d1(n), d2(n), width(n), roll_res(n), radius(n);
+    std::vector<double> Fx_out(n), Fy_out(n), Mx_out(n), My_out(n);
+
+    for (size_t i = 0; i < n; i++) {
+        const auto t = active[i];
+        Fn[i] = t->m_data.normal_force;
+        Fz[i] = std::min(t->m_data.normal_force, t->m_par.pn_max);
+        sx[i] = t->m_states.sx;
+        sy[i] = t->m_states.sy;
+        vsx[i] = t->m_states.vsx;
+        vsy[i] = t->m_states.vsy;
+        omega[i] = t->m_states.omega;
+        gamma[i] = t->m_states.gamma;
+        depth[i] = t->m_data.depth;
+        R_eff[i] = t->m_states.R_eff;
+        mu[i] = t->m_states.muscale;
+        frblend[i] = ChSineStep(t->m_data.vel.x(), t->m_frblend_begin, 0.0, t->m_frblend_end, 1.0);
+        startup[i] = t->m_use_startup_transition
+                         ? ChSineStep(t->m_time, t->m_begin_start_transition, 0.0, t->m_end_start_transition, 1.0)
+                         : 1.0;
+        ax1[i] = t->m_ax1;
+        ax2[i] = t->m_ax2;
+        ay1[i] = t->m_ay1;
+        ay2[i] = t->m_ay2;
+        bx1[i] = t->m_bx1;
+        bx2[i] = t->m_bx2;
+        by1[i] = t->m_by1;
+        by2[i] = t->m_by2;
+        cx1[i] = t->m_cx1;
+        cx2[i] = t->m_cx2;
+        cy1[i] = t->m_cy1;
+        cy2[i] = t->m_cy2;
+        pn[i] = t->m_par.pn;
+        vcoulomb[i] = t->m_vcoulomb;
+        d1[i] = t->m_d1;
+        d2[i] = t->m_d2;
+        width[i] = t->m_width;
+        roll_res[i] = t->m_rolling_resistance;
+        radius[i] = t->m_unloaded_radius;
+    }
+
+    // Vectorizable sweep over all in-contact tires
+#pragma omp simd
+    for (size_t i = 0; i < n; i++) {
+        double fzmu = Fz[i] * mu[i];
+
+        // Coulomb forces (see CombinedCoulombForces)
+        double fcx = std::tanh(-2.0 * vsx[i] / vcoulomb[i]) * fzmu;
+        double fcy = std::tanh(-2.0 * vsy[i] / vcoulomb[i]) * fzmu;
+        double fc_len = std::sqrt(fcx * fcx + fcy * fcy);
+        double fc_scale = (fc_len > fzmu) ? fzmu / fc_len : 1.0;
+        fcx *= fc_scale;
+        fcy *= fc_scale;
+
+        // Combined forces (see TMcombinedForces)
+        double q = Fz[i] / pn[i];
+        double q2 = q * q;
+        double Fx_max = ax1[i] * q + ax2[i] * q2;
+        double Fy_max = ay1[i] * q + ay2[i] * q2;
+        double dFx0 = bx1[i] * q + bx2[i] * q2;
+        double dFy0 = by1[i] * q + by2[i] * q2;
+        double Fxs = cx1[i] * q + cx2[i] * q2;
+        double Fys = cy1[i] * q + cy2[i] * q2;
+
+        double s = std::sqrt(sx[i] * sx[i] + sy[i] * sy[i]);
+        bool stopped = (vsx[i] == 0.0 && omega[i] * R_eff[i] == 0.0 && s == 0.0);
+        double cbeta = stopped ? 0.5 * std::sqrt(2.0) : sx[i] / s;
+        double sbeta = stopped ? 0.5 * std::sqrt(2.0) : sy[i] / s;
+
+        double F_max = std::sqrt(Fx_max * cbeta * Fx_max * cbeta + Fy_max * sbeta * Fy_max * sbeta);
+        double dF0 = std::sqrt(dFx0 * cbeta * dFx0 * cbeta + dFy0 * sbeta * dFy0 * sbeta);
+        double Fs = std::sqrt(Fxs * cbeta * Fxs * cbeta + Fys * sbeta * Fys * sbeta);
+
+        double Qcrit = ChClamp(Fs / F_max, -1.0, 1.0);
+        double B = CH_C_PI - std::asin(Qcrit);
+        double A = F_max * B / dF0;
+        double Fa = F_max * std::sin(B * (1.0 - std::exp(-s / A)));
+
+        double fx = Fa * cbeta;
+        double fy = Fa * sbeta;
+
+        // Blend Coulomb and combined forces
+        Fx_out[i] = (1.0 - frblend[i]) * fcx + frblend[i] * fx;
+        Fy_out[i] = (1.0 - frblend[i]) * fcy + frblend[i] * fy;
+
+        // Rolling resistance and overturning torques
+        My_out[i] = -roll_res[i] * Fn[i] * radius[i] * std::tanh(omega[i]);
+        double cg = width[i] * width[i] * (d1[i] + 2.0 * d2[i] * depth[i]) / 12.0;
+        Mx_out[i] = -cg * gamma[i];
+    }
+
+    // Scatter results back to the tires
+    for (size_t i = 0; i < n; i++) {
+        auto t = active[i];
+        t->m_tireforce.force = ChVector<>(startup[i] * Fx_out[i], startup[i] * Fy_out[i], Fn[i]);
+        t->m_tireforce.moment = startup[i] * ChVector<>(Mx_out[i], My_out[i], 0.0);
+        t->m_batch_evaluated = true;
+    }
+}
+
 // -----------------------------------------------------------------------------
 
 double ChTMsimpleTire::GetNormalStiffnessForce(double depth) const {
@@ -150,6 +150,13 @@ class CH_VEHICLE_API ChTMsimpleTire : public ChForceElementTire {
     /// Simple parameter consistency test.
     bool CheckParameters();
 
+    /// Batched evaluation of the tire forces for a set of TMsimple tires.
+    /// The slip states and model coefficients of all in-contact tires are packed into contiguous arrays and the
+    /// combined force calculation is performed in a single vectorizable sweep, instead of one scalar evaluation per
+    /// tire. Each processed tire caches its resulting force and skips the calculation in its subsequent Advance call,
+    /// so this function can be invoked before the regular per-vehicle update (see ChWheeledVehicleSet).
+    static void AdvanceBatch(const std::vector<ChTMsimpleTire*>& tires, double step);
+
   protected:
     /// Set the parameters in the TMsimple model.
     virtual void SetTMsimpleParams() = 0;
@@ -249,6 +256,7 @@ class CH_VEHICLE_API ChTMsimpleTire : public ChForceElementTire {
     };
 
     TireStates m_states;
+    bool m_batch_evaluated;                      ///< forces already computed in a batched sweep?
     std::shared_ptr<ChVisualShape> m_cyl_shape;  ///< visualization cylinder asset
 };
 
@@ -219,6 +219,9 @@ void WheeledVehicle::Create(const std::string& filename, bool create_powertrain,
     // Create tires (if specified)
     // ---------------------------------------------------
 
+    // Axles are independent until Initialize() and each iteration writes only to its own slots, so the subsystem
+    // specification files can be parsed concurrently (ReadFileJSON is thread-safe).
+#pragma omp parallel for schedule(dynamic)
     for (int i = 0; i < m_num_axles; i++) {
         m_axles[i] = chrono_types::make_shared<ChAxle>();
 
@@ -17,6 +17,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <cctype>
+#include <fstream>
+#include <sstream>
 
 #include "chrono_vsg/ChVisualSystemVSG.h"
 #include "chrono_vsg/utils/ChConversionsVSG.h"
@@ -920,9 +922,10 @@ void ChVisualSystemVSG::Render() {
     // Dynamic data transfer CPU->GPU for point clouds
     for (const auto& cloud : m_clouds) {
         if (cloud.dynamic_positions) {
-            unsigned int k = 0;
-            for (auto& p : *cloud.positions)
-                p = vsg::vec3CH(cloud.pcloud->GetParticle(k++).GetPos());
+            int num_particles = (int)cloud.positions->size();
+#pragma omp parallel for
+            for (int k = 0; k < num_particles; k++)
+                cloud.positions->set(k, vsg::vec3CH(cloud.pcloud->GetParticle(k).GetPos()));
             cloud.positions->dirty();
         }
         if (cloud.dynamic_colors) {
@@ -1135,20 +1138,17 @@ void ChVisualSystemVSG::PopulateGroup(vsg::ref_ptr<vsg::Group> group,
             auto transform = vsg::MatrixTransform::create();
             transform->matrix = vsg::dmat4CH(ChFrame<>(X_SM.GetPos(), X_SM.GetRot() * Q_from_AngX(-CH_C_PI_2)), 1.0);
             grp->addChild(transform);
-            // needed, when BindAll() is called after Initialization
-            // vsg::observer_ptr<vsg::Viewer> observer_viewer(m_viewer);
-            // m_loadThreads->add(LoadOperation::create(observer_viewer, transform, objFilename, m_options));
-            map<size_t, vsg::ref_ptr<vsg::Node>>::iterator objIt;
-            objIt = m_objCache.find(objHashValue);
-            if (objIt == m_objCache.end()) {
-                auto node = vsg::read_cast<vsg::Node>(objFilename, m_options);
-                if (node) {
-                    transform->addChild(node);
-                    group->addChild(grp);
-                    m_objCache[objHashValue] = node;
-                }
-            } else {
-                transform->addChild(m_objCache[objHashValue]);
+            bool cached;
+            {
+                std::lock_guard<std::mutex> lock(m_objCacheMutex);
+                cached = m_objCache.find(objHashValue) != m_objCache.end();
+            }
+            if (!cached && m_deferred_model_loading && m_loadThreads && m_viewer && m_viewer->compileManager) {
+                // Decode and compile on the loader threads; the subgraph is attached when ready
+                m_loadThreads->add(LoadOperation::create(m_viewer, transform, objFilename, m_options));
+                group->addChild(grp);
+            } else if (auto node = LoadModelFile(objFilename)) {
+                transform->addChild(node);
                 group->addChild(grp);
             }
         } else if (auto line = std::dynamic_pointer_cast<ChLineShape>(shape)) {
@@ -1531,7 +1531,91 @@ void ChVisualSystemVSG::BindItem(std::shared_ptr<ChPhysicsItem> item) {
     }
 }
 
+vsg::ref_ptr<vsg::Node> ChVisualSystemVSG::LoadModelFile(const std::string& filename) {
+    size_t hashValue = m_stringHash(filename);
+
+    {
+        std::lock_guard<std::mutex> lock(m_objCacheMutex);
+        auto objIt = m_objCache.find(hashValue);
+        if (objIt != m_objCache.end())
+            return objIt->second;
+    }
+
+    vsg::ref_ptr<vsg::Node> node;
+    vsg::Path cacheFile;
+
+    if (!m_model_cache_dir.empty()) {
+        // Key the binary cache entry by the content hash of the source file (FNV-1a), so that edited models are
+        // re-converted and renamed copies of the same model share one entry.
+        std::ifstream file(filename, std::ios::binary);
+        if (file) {
+            uint64_t contentHash = 14695981039346656037ull;
+            char buffer[4096];
+            while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+                for (std::streamsize c = 0; c < file.gcount(); c++) {
+                    contentHash ^= (unsigned char)buffer[c];
+                    contentHash *= 1099511628211ull;
+                }
+            }
+            std::ostringstream name;
+            name << std::hex << contentHash << ".vsgb";
+            cacheFile = vsg::Path(m_model_cache_dir + "/" + name.str());
+            if (vsg::fileExists(cacheFile))
+                node = vsg::read_cast<vsg::Node>(cacheFile, m_options);
+        }
+    }
+
+    if (!node) {
+        node = vsg::read_cast<vsg::Node>(filename, m_options);
+        if (node && !cacheFile.empty())
+            vsg::write(node, cacheFile, m_options);
+    }
+
+    if (!node)
+        return node;
+
+    std::lock_guard<std::mutex> lock(m_objCacheMutex);
+    auto objIt = m_objCache.find(hashValue);
+    if (objIt != m_objCache.end())
+        return objIt->second;
+    m_objCache[hashValue] = node;
+    return node;
+}
+
+void ChVisualSystemVSG::PreloadModelFiles() {
+    // Collect the unique model files referenced by the visual models of all physics items
+    std::vector<std::string> filenames;
+    auto collect = [&filenames](const std::shared_ptr<ChPhysicsItem>& item) {
+        if (!item->GetVisualModel())
+            return;
+        for (const auto& shape_instance : item->GetVisualModel()->GetShapes()) {
+            if (auto obj = std::dynamic_pointer_cast<ChModelFileShape>(shape_instance.first)) {
+                if (std::find(filenames.begin(), filenames.end(), obj->GetFilename()) == filenames.end())
+                    filenames.push_back(obj->GetFilename());
+            }
+        }
+    };
+    for (auto sys : m_systems) {
+        for (const auto& body : sys->GetAssembly().Get_bodylist())
+            collect(body);
+        for (const auto& link : sys->Get_linklist())
+            collect(link);
+        for (const auto& mesh : sys->GetAssembly().Get_meshlist())
+            collect(mesh);
+        for (const auto& item : sys->Get_otherphysicslist())
+            collect(item);
+    }
+
+    // Decode the files in parallel into the model cache; binding then only performs cache hits
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < (int)filenames.size(); i++) {
+        LoadModelFile(filenames[i]);
+    }
+}
+
 void ChVisualSystemVSG::BindAll() {
+    PreloadModelFiles();
+
     for (auto sys : m_systems) {
         // Bind visual models associated with bodies in the system
         for (const auto& body : sys->GetAssembly().Get_bodylist()) {
@@ -1566,6 +1650,10 @@ void ChVisualSystemVSG::BindAll() {
 // -----------------------------------------------------------------------------
 
 void ChVisualSystemVSG::UpdateFromMBS() {
+    // Acquire the latest pose snapshot once per frame, so that all transforms of this frame are taken
+    // from the same coherent set of poses (published by the physics thread at its own rate).
+    const PoseSnapshot* snapshot = PoseSnapshotsEnabled() ? GetLatestPoseSnapshot() : nullptr;
+
     // Update VSG nodes for body COG frame visualization
     if (m_show_cog_frames) {
         for (auto& child : m_cogFrameScene->children) {
@@ -1612,6 +1700,13 @@ void ChVisualSystemVSG::UpdateFromMBS() {
             continue;
         if (!child->getValue("Transform", transform))
             continue;
+        if (snapshot) {
+            auto pose = snapshot->indices.find(body.get());
+            if (pose != snapshot->indices.end()) {
+                transform->matrix = vsg::dmat4CH(snapshot->poses[pose->second], 1.0);
+                continue;
+            }
+        }
         transform->matrix = vsg::dmat4CH(body->GetVisualModelFrame(), 1.0);
     }
 
@@ -16,6 +16,7 @@
 #define CH_VISUAL_SYSTEM_VSG_H
 
 #include <iostream>
+#include <mutex>
 #include <string>
 
 #include <vsg/all.h>
@@ -125,6 +126,16 @@ class CH_VSG_API ChVisualSystemVSG : virtual public ChVisualSystem {
     /// Draw the scene objects as wireframes.
     void SetWireFrameMode(bool mode = true) { m_wireframe = mode; }
 
+    /// Set a directory used as a binary cache for preprocessed model files (default: none).
+    /// When set, model files referenced by ChModelFileShape assets are converted once to VSG binary form, keyed by
+    /// the content hash of the source file, and subsequent runs load the (much faster to parse) binary version.
+    void SetModelFileCacheDir(const std::string& dir) { m_model_cache_dir = dir; }
+
+    /// Enable deferred loading of model files referenced by shapes bound after initialization (default: false).
+    /// When enabled, such models are decoded and compiled on the background loader threads and attached to the scene
+    /// when ready, so that the simulation proceeds while the assets stream in.
+    void EnableDeferredModelLoading(bool val = true) { m_deferred_model_loading = val; }
+
     /// Set the camera up vector (default: Z).
     void SetCameraVertical(CameraVerticalDir upDir);
 
@@ -309,8 +320,18 @@ class CH_VSG_API ChVisualSystemVSG : virtual public ChVisualSystem {
                        std::shared_ptr<ChVisualModel> model,
                        std::shared_ptr<ChPhysicsItem> phitem);
 
+    /// Load a model file into a VSG subgraph, going through the in-memory cache and (if enabled) the binary
+    /// preprocessed cache on disk. Thread-safe.
+    vsg::ref_ptr<vsg::Node> LoadModelFile(const std::string& filename);
+
+    /// Decode all model files referenced by the attached systems in parallel, warming the model cache.
+    void PreloadModelFiles();
+
     std::map<std::size_t, vsg::ref_ptr<vsg::Node>> m_objCache;
     std::hash<std::string> m_stringHash;
+    std::mutex m_objCacheMutex;
+    std::string m_model_cache_dir;
+    bool m_deferred_model_loading = false;
     int m_windowWidth = 800;
     int m_windowHeight = 600;
     int m_windowX = 0;
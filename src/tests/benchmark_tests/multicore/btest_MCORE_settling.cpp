@@ -161,7 +161,9 @@ BENCHMARK_DEFINE_F(TEST_NAME, Settle)(benchmark::State& st) {
     Reset(NUM_SKIP_STEPS);
     m_test->SetNumthreads((int)st.range(0));
     while (st.KeepRunning()) {
+        StartCounters();
         m_test->Simulate(NUM_SIM_STEPS);
+        StopCounters();
     }
     Report(st);
     std::cout << "Simulated " << m_test->GetNumParticles() << " particles ";
@@ -0,0 +1,158 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for a system mixing bilateral joints and NSC frictional
+// contacts. The solver time of this test is dominated by the per-iteration
+// constraint operations (jacobian apply and its transpose), so it measures
+// the efficiency of the fixed-size constraint kernels.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+
+#ifdef CHRONO_IRRLICHT
+    #include "chrono_irrlicht/ChVisualSystemIrrlicht.h"
+#endif
+
+using namespace chrono;
+
+// =============================================================================
+
+// N chains of hinged boxes dropped in a container: each chain contributes a set
+// of revolute joints (bilateral constraints) and, once settled, the chains and
+// the container walls generate a large number of frictional contacts.
+template <int N>
+class ChainDropTestNSC : public utils::ChBenchmarkTest {
+  public:
+    ChainDropTestNSC();
+    ~ChainDropTestNSC() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+    void SimulateVis();
+
+  private:
+    static const int m_links = 8;  // number of boxes per chain
+    ChSystemNSC* m_system;
+    double m_step;
+};
+
+template <int N>
+ChainDropTestNSC<N>::ChainDropTestNSC() : m_system(new ChSystemNSC()), m_step(0.01) {
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    double length = 0.5;
+    double width = 0.2;
+
+    // Create the chains of hinged boxes
+    for (int ic = 0; ic < N; ic++) {
+        double x0 = -0.5 * m_links * length + 0.1 * (ic % 5);
+        double y0 = 2 + 0.5 * ic;
+        double z0 = -2 + 4.0 * (ic % 3) / 2.0;
+
+        std::shared_ptr<ChBody> prev;
+        for (int ib = 0; ib < m_links; ib++) {
+            auto box = chrono_types::make_shared<ChBodyEasyBox>(length, width, width, 1000, true, true, mat);
+            box->SetPos(ChVector<>(x0 + (ib + 0.5) * length, y0, z0));
+            m_system->AddBody(box);
+
+            if (prev) {
+                auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+                rev->Initialize(box, prev, ChCoordsys<>(ChVector<>(x0 + ib * length, y0, z0)));
+                m_system->AddLink(rev);
+            }
+            prev = box;
+        }
+    }
+
+    // Create the container
+    auto floor = chrono_types::make_shared<ChBodyEasyBox>(12, 1, 12, 1000, true, true, mat);
+    floor->SetPos(ChVector<>(0, -0.5, 0));
+    floor->SetBodyFixed(true);
+    m_system->AddBody(floor);
+
+    auto wall1 = chrono_types::make_shared<ChBodyEasyBox>(1, 4, 12, 1000, true, true, mat);
+    wall1->SetPos(ChVector<>(-6, 2, 0));
+    wall1->SetBodyFixed(true);
+    m_system->AddBody(wall1);
+
+    auto wall2 = chrono_types::make_shared<ChBodyEasyBox>(1, 4, 12, 1000, true, true, mat);
+    wall2->SetPos(ChVector<>(6, 2, 0));
+    wall2->SetBodyFixed(true);
+    m_system->AddBody(wall2);
+
+    auto wall3 = chrono_types::make_shared<ChBodyEasyBox>(12, 4, 1, 1000, true, true, mat);
+    wall3->SetPos(ChVector<>(0, 2, -6));
+    wall3->SetBodyFixed(true);
+    m_system->AddBody(wall3);
+
+    auto wall4 = chrono_types::make_shared<ChBodyEasyBox>(12, 4, 1, 1000, true, true, mat);
+    wall4->SetPos(ChVector<>(0, 2, 6));
+    wall4->SetBodyFixed(true);
+    m_system->AddBody(wall4);
+
+    m_system->SetSolverMaxIterations(100);
+}
+
+template <int N>
+void ChainDropTestNSC<N>::SimulateVis() {
+#ifdef CHRONO_IRRLICHT
+    // Create the Irrlicht visualization system
+    auto vis = chrono_types::make_shared<irrlicht::ChVisualSystemIrrlicht>();
+    vis->AttachSystem(m_system);
+    vis->SetWindowSize(800, 600);
+    vis->SetWindowTitle("Joints + contacts");
+    vis->Initialize();
+    vis->AddLogo();
+    vis->AddSkyBox();
+    vis->AddTypicalLights();
+    vis->AddCamera(ChVector<>(0, 10, -14), ChVector<>(0, 0, 0));
+
+    while (vis->Run()) {
+        vis->BeginScene();
+        vis->Render();
+        ExecuteStep();
+        vis->EndScene();
+    }
+#endif
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 500  // number of steps for hot start
+#define NUM_SIM_STEPS 500   // number of simulation steps for each benchmark
+
+CH_BM_SIMULATION_LOOP(ChainDropNSC016, ChainDropTestNSC<16>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ChainDropNSC032, ChainDropTestNSC<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+
+#ifdef CHRONO_IRRLICHT
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        ChainDropTestNSC<32> test;
+        test.SimulateVis();
+        return 0;
+    }
+#endif
+
+    ::benchmark::RunSpecifiedBenchmarks();
+}
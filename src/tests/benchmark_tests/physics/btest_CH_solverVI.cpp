@@ -0,0 +1,199 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark of the memory-bound kernels at the heart of the VI solvers:
+// ChSystemDescriptor::ShurComplementProduct, the descriptor gather/scatter
+// transfers, and full ChSolverAPGD iterations, on synthetic problems of
+// controlled size (1k to 1M scalar constraints).
+//
+// A STREAM-style triad over an equivalent memory footprint is included as the
+// attainable-bandwidth baseline: each kernel benchmark reports an estimated
+// bytes-processed counter (a lower bound that counts jacobians, multipliers,
+// and variable accumulators once per product), so the GB/s column can be read
+// directly against the triad to judge bandwidth utilization.
+//
+// =============================================================================
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "chrono/solver/ChConstraintTwoGeneric.h"
+#include "chrono/solver/ChSolverAPGD.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChVariablesGeneric.h"
+
+using namespace chrono;
+
+// Number of scalar states per variable block (rigid body-like)
+static const int block_dof = 6;
+
+// Fixed APGD iteration count, so that timings scale linearly with problem size
+static const int apgd_iterations = 50;
+
+// Benchmarking fixture: synthetic VI problem with controlled size and sparsity.
+// Each scalar constraint couples two distinct 6-DOF variable blocks; with two
+// variable blocks per constraint and nv = nc/2 blocks, every block is touched
+// by 4 constraints on average, mimicking the fill of a dense granular packing.
+class SolverVIFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        nc = (int)st.range(0);
+        nv = nc / 2;
+
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        std::uniform_int_distribution<int> pick(0, nv - 1);
+
+        descriptor = std::unique_ptr<ChSystemDescriptor>(new ChSystemDescriptor);
+        descriptor->BeginInsertion();
+
+        variables.resize(nv);
+        for (int i = 0; i < nv; i++) {
+            variables[i] = std::unique_ptr<ChVariablesGeneric>(new ChVariablesGeneric(block_dof));
+            variables[i]->GetMass().setIdentity(block_dof, block_dof);
+            variables[i]->GetMass() *= 2.0;
+            variables[i]->GetInvMass().setIdentity(block_dof, block_dof);
+            variables[i]->GetInvMass() *= 0.5;
+            for (int k = 0; k < block_dof; k++)
+                variables[i]->Get_fb()(k) = dist(gen);
+            descriptor->InsertVariables(variables[i].get());
+        }
+
+        constraints.resize(nc);
+        for (int i = 0; i < nc; i++) {
+            int va = pick(gen);
+            int vb = pick(gen);
+            if (vb == va)
+                vb = (va + 1) % nv;
+            constraints[i] =
+                std::unique_ptr<ChConstraintTwoGeneric>(new ChConstraintTwoGeneric(variables[va].get(), variables[vb].get()));
+            for (int k = 0; k < block_dof; k++) {
+                constraints[i]->Get_Cq_a()(k) = dist(gen);
+                constraints[i]->Get_Cq_b()(k) = dist(gen);
+            }
+            // Half bilateral, half unilateral, so the APGD projection is exercised
+            constraints[i]->SetMode((i % 2 == 0) ? CONSTRAINT_LOCK : CONSTRAINT_UNILATERAL);
+            constraints[i]->Set_b_i(dist(gen));
+            constraints[i]->Update_auxiliary();
+            descriptor->InsertConstraint(constraints[i].get());
+        }
+
+        descriptor->EndInsertion();
+
+        l.setRandom(nc);
+        result.setZero(nc);
+        q.setZero(descriptor->CountActiveVariables());
+    }
+
+    void TearDown(const ::benchmark::State&) override {
+        constraints.clear();
+        variables.clear();
+        descriptor.reset();
+    }
+
+    // Estimated bytes touched by one Shur complement product N*l (lower bound):
+    // per constraint, the two jacobians and the two Eq vectors plus l_i and the
+    // result entry; per variable block, one read+write of the qb accumulator.
+    int64_t ShurBytes() const {
+        return (int64_t)nc * (4 * block_dof + 2) * sizeof(double) + (int64_t)nv * 2 * block_dof * sizeof(double);
+    }
+
+    int nc;
+    int nv;
+    std::unique_ptr<ChSystemDescriptor> descriptor;
+    std::vector<std::unique_ptr<ChVariablesGeneric>> variables;
+    std::vector<std::unique_ptr<ChConstraintTwoGeneric>> constraints;
+    ChVectorDynamic<> l;
+    ChVectorDynamic<> result;
+    ChVectorDynamic<> q;
+};
+
+// Shur complement product  result = N(l) = Cq*invM*Cq'*l
+BENCHMARK_DEFINE_F(SolverVIFixture, ShurComplementProduct)(benchmark::State& st) {
+    for (auto _ : st) {
+        descriptor->ShurComplementProduct(result, l);
+        benchmark::DoNotOptimize(result.data());
+    }
+    st.SetItemsProcessed(st.iterations() * nc);
+    st.SetBytesProcessed(st.iterations() * ShurBytes());
+}
+BENCHMARK_REGISTER_F(SolverVIFixture, ShurComplementProduct)
+    ->RangeMultiplier(8)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+// Descriptor gather/scatter of the constraint multipliers
+BENCHMARK_DEFINE_F(SolverVIFixture, ConstraintGatherScatter)(benchmark::State& st) {
+    for (auto _ : st) {
+        descriptor->FromConstraintsToVector(l, false);
+        descriptor->FromVectorToConstraints(l);
+        benchmark::DoNotOptimize(l.data());
+    }
+    st.SetItemsProcessed(st.iterations() * nc);
+    st.SetBytesProcessed(st.iterations() * (int64_t)nc * 4 * sizeof(double));
+}
+BENCHMARK_REGISTER_F(SolverVIFixture, ConstraintGatherScatter)
+    ->RangeMultiplier(8)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+// Descriptor gather/scatter of the variable states
+BENCHMARK_DEFINE_F(SolverVIFixture, VariableGatherScatter)(benchmark::State& st) {
+    for (auto _ : st) {
+        descriptor->FromVariablesToVector(q, false);
+        descriptor->FromVectorToVariables(q);
+        benchmark::DoNotOptimize(q.data());
+    }
+    st.SetItemsProcessed(st.iterations() * nv);
+    st.SetBytesProcessed(st.iterations() * (int64_t)nv * block_dof * 4 * sizeof(double));
+}
+BENCHMARK_REGISTER_F(SolverVIFixture, VariableGatherScatter)
+    ->RangeMultiplier(8)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+// Full APGD solve at a fixed iteration count. Bytes estimate: one Shur product
+// plus roughly ten nc-length vector sweeps (gradient, projection, residual)
+// per iteration.
+BENCHMARK_DEFINE_F(SolverVIFixture, SolverAPGD)(benchmark::State& st) {
+    ChSolverAPGD solver;
+    solver.SetMaxIterations(apgd_iterations);
+    solver.SetTolerance(0.0);
+    for (auto _ : st) {
+        solver.Solve(*descriptor);
+    }
+    st.SetItemsProcessed(st.iterations() * nc * apgd_iterations);
+    st.SetBytesProcessed(st.iterations() * apgd_iterations * (ShurBytes() + (int64_t)nc * 10 * sizeof(double)));
+}
+BENCHMARK_REGISTER_F(SolverVIFixture, SolverAPGD)
+    ->RangeMultiplier(8)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+// STREAM-style triad a = b + s*c over the same footprint scale, as the
+// attainable memory bandwidth baseline for the counters above.
+static void BM_StreamTriad(benchmark::State& st) {
+    int n = (int)st.range(0) * (4 * block_dof + 2) / 3;  // match the Shur product footprint
+    std::vector<double> a(n, 1.0), b(n, 2.0), c(n, 3.0);
+    const double s = 0.5;
+    for (auto _ : st) {
+        for (int i = 0; i < n; i++)
+            a[i] = b[i] + s * c[i];
+        benchmark::DoNotOptimize(a.data());
+        benchmark::ClobberMemory();
+    }
+    st.SetBytesProcessed(st.iterations() * (int64_t)n * 3 * sizeof(double));
+}
+BENCHMARK(BM_StreamTriad)->RangeMultiplier(8)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
@@ -74,6 +74,39 @@ TEST(SparseMatrix, pattern_learner) {
 	ASSERT_NEAR(spmat_mirror.valuePtr()[1], 2.1, precision);
 	ASSERT_NEAR(spmat_mirror.valuePtr()[2], 2.2, precision);
 	ASSERT_NEAR(spmat_mirror.valuePtr()[3], 3.3, precision);
-	
 
+
+}
+
+TEST(SparseMatrix, pattern_learner_reset_tail) {
+    ChSparsityPatternLearner spl(4, 4);
+
+    // leading block (kept)
+    spl.SetElement(0, 0, 1.0);
+    spl.SetElement(1, 1, 1.0);
+    // trailing block and coupling entries (dropped by ResetTail)
+    spl.SetElement(0, 3, 1.0);
+    spl.SetElement(3, 0, 1.0);
+    spl.SetElement(3, 3, 1.0);
+
+    spl.ResetTail(2);
+
+    // replay a different trailing block
+    spl.SetElement(1, 2, 1.0);
+    spl.SetElement(2, 1, 1.0);
+    spl.SetElement(2, 2, 1.0);
+
+    ChSparseMatrix spmat_learned;
+    spl.Apply(spmat_learned);
+
+    ASSERT_TRUE(spmat_learned.outerIndexPtr()[0] == 0);
+    ASSERT_TRUE(spmat_learned.outerIndexPtr()[1] == 1);  // row 0: {0}
+    ASSERT_TRUE(spmat_learned.outerIndexPtr()[2] == 3);  // row 1: {1,2}
+    ASSERT_TRUE(spmat_learned.outerIndexPtr()[3] == 5);  // row 2: {1,2}
+    ASSERT_TRUE(spmat_learned.outerIndexPtr()[4] == 5);  // row 3: empty
+    ASSERT_TRUE(spmat_learned.innerIndexPtr()[0] == 0);
+    ASSERT_TRUE(spmat_learned.innerIndexPtr()[1] == 1);
+    ASSERT_TRUE(spmat_learned.innerIndexPtr()[2] == 2);
+    ASSERT_TRUE(spmat_learned.innerIndexPtr()[3] == 1);
+    ASSERT_TRUE(spmat_learned.innerIndexPtr()[4] == 2);
 }
@@ -155,3 +155,49 @@ TEST(CompositeInertia, hollow_sphere) {
     ASSERT_NEAR(c_com.Length(), 0.0, tol);
     ASSERT_NEAR((c_inertia - s_inertia).norm(), 0.0, tol);
 }
+
+// ====================================================================================
+
+TEST(CompositeInertia, assembly) {
+    ChMatrix33<> J1(ChVector<>(1.2, 2.3, 3.1));
+    ChMatrix33<> J2(ChVector<>(0.4, 0.7, 0.9));
+
+    // Two-subtree articulated assembly (boom + jib), with components fixed in their subtree frames
+    utils::CompositeInertiaAssembly assembly;
+    int boom = assembly.AddSubtree();
+    int jib = assembly.AddSubtree();
+
+    ChFrame<> boom_c1(ChVector<>(1, 0, 0.5), Q_from_AngY(0.2));
+    ChFrame<> boom_c2(ChVector<>(2, 0, 1.0), ChQuaternion<>(1, 0, 0, 0));
+    ChFrame<> jib_c1(ChVector<>(0.5, 0.1, 0), Q_from_AngX(0.3));
+
+    assembly.AddComponent(boom, boom_c1, 10.0, J1);
+    assembly.AddComponent(boom, boom_c2, 5.0, J2);
+    assembly.AddComponent(jib, jib_c1, 3.0, J2);
+
+    // The same subtree composites, accumulated once in their own reference frames
+    utils::CompositeInertia boom_comp;
+    boom_comp.AddComponent(boom_c1, 10.0, J1);
+    boom_comp.AddComponent(boom_c2, 5.0, J2);
+
+    utils::CompositeInertia jib_comp;
+    jib_comp.AddComponent(jib_c1, 3.0, J2);
+
+    // Articulate through several configurations and compare the incrementally maintained
+    // assembly properties against a composite rebuilt from scratch
+    for (int i = 0; i < 5; i++) {
+        ChFrame<> boom_frame(ChVector<>(0, 0, 0.1 * i), Q_from_AngZ(0.3 * i));
+        ChFrame<> jib_frame(ChVector<>(3, 0, 0.2 * i), Q_from_AngZ(-0.2 * i));
+
+        assembly.SetSubtreeFrame(boom, boom_frame);
+        assembly.SetSubtreeFrame(jib, jib_frame);
+
+        utils::CompositeInertia ref;
+        ref.AddComposite(boom_frame, boom_comp);
+        ref.AddComposite(jib_frame, jib_comp);
+
+        ASSERT_NEAR(assembly.GetMass(), ref.GetMass(), tol);
+        TestVector(assembly.GetCOM(), ref.GetCOM(), tol);
+        ASSERT_NEAR((assembly.GetInertia() - ref.GetInertia()).norm(), 0.0, tol);
+    }
+}
@@ -20,6 +20,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <vector>
 
 #include "chrono/ChConfig.h"
@@ -186,6 +187,9 @@ TEST_P(ContactForceTest, simulate) {
 
     double rtol = 1e-3;  // validation relative error
 
+    ChContactContainer::ContactSnapshot snapshot;
+    bool tagged = false;
+
     while (system->GetChTime() < end_time) {
         system->DoStepDynamics(time_step);
 
@@ -197,6 +201,29 @@ TEST_P(ContactForceTest, simulate) {
         */
         if (system->GetChTime() > start_time) {
             ASSERT_LT(std::abs(1 - contact_force.z() / total_weight), rtol);
+
+            // The batched SoA snapshot must agree with the per-body accumulated forces
+            system->GetContactContainer()->SnapshotContacts(snapshot);
+            auto ground_ct = static_cast<ChContactable*>(ground.get());
+            double fz = 0;
+            size_t carried = 0;
+            for (size_t i = 0; i < snapshot.Size(); i++) {
+                if (snapshot.obj_A[i] == ground_ct)
+                    fz -= snapshot.force[i].z();
+                else if (snapshot.obj_B[i] == ground_ct)
+                    fz += snapshot.force[i].z();
+                if (snapshot.user_data[i] == 1)
+                    carried++;
+            }
+            ASSERT_LT(std::abs(1 - fz / total_weight), rtol);
+
+            // User data tagged at the previous step must survive on the persistent resting contacts
+            if (tagged)
+                ASSERT_EQ(carried, snapshot.Size());
+
+            std::fill(snapshot.user_data.begin(), snapshot.user_data.end(), 1.0);
+            system->GetContactContainer()->StoreSnapshotUserData(snapshot);
+            tagged = true;
         }
     }
 }
@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Tests for the reduced-coordinate articulated-chain sweep (ChFeatherstoneChain).
+//
+// The joint accelerations produced by the articulated-body algorithm are
+// compared against the equations of motion of single and double pendulums
+// derived independently in minimal coordinates, at several states exercising
+// the gravity, Coriolis, and actuation terms.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChFeatherstoneChain.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+static const double g = 9.8;
+
+// Build a planar chain of num_links bodies hinged about the Z axis, lying along the
+// world X axis, with COM at distance a from the inboard hinge and hinges L apart.
+static std::shared_ptr<ChFeatherstoneChain> BuildChain(ChSystemNSC& sys,
+                                                       int num_links,
+                                                       double m,
+                                                       double J,
+                                                       double a,
+                                                       double L) {
+    sys.Set_G_acc(ChVector<>(0, -g, 0));
+
+    auto base = chrono_types::make_shared<ChBody>();
+    base->SetBodyFixed(true);
+    sys.AddBody(base);
+
+    auto chain = chrono_types::make_shared<ChFeatherstoneChain>();
+    chain->SetBaseBody(base);
+
+    for (int i = 0; i < num_links; i++) {
+        auto link = chrono_types::make_shared<ChBody>();
+        link->SetMass(m);
+        link->SetInertiaXX(ChVector<>(J, J, J));
+        link->SetPos(ChVector<>(i * L + a, 0, 0));
+        sys.AddBody(link);
+
+        // Hinge in parent coordinates: at the base origin for the first link, at distance L - a
+        // from the parent COM otherwise (the parent body frame sits at its COM).
+        ChFrame<> joint_frame(ChVector<>(i == 0 ? 0 : L - a, 0, 0));
+        chain->AddRevoluteJoint(link, joint_frame);
+    }
+
+    chain->Initialize();
+    return chain;
+}
+
+TEST(FeatherstoneChain, single_pendulum_acceleration) {
+    double m = 2.5, J = 0.4, d = 0.7;
+
+    ChSystemNSC sys;
+    auto chain = BuildChain(sys, 1, m, J, d, 2 * d);
+
+    double states[][3] = {{0, 0, 0}, {0.3, 0, 0}, {-1.2, 2.0, 0}, {0.5, -1.0, 1.5}};
+    for (auto& s : states) {
+        chain->SetJointPos(0, s[0]);
+        chain->SetJointVel(0, s[1]);
+        chain->SetJointTorque(0, s[2]);
+        chain->Advance(1e-10);
+
+        // Planar pendulum about a hinge at distance d from the COM, with q measured from the
+        // horizontal: (J + m d^2) qdd = tau - m g d cos(q).
+        double qdd_ref = (s[2] - m * g * d * std::cos(s[0])) / (J + m * d * d);
+        ASSERT_NEAR(chain->GetJointAcc(0), qdd_ref, 1e-8);
+    }
+}
+
+TEST(FeatherstoneChain, double_pendulum_acceleration) {
+    double m = 1.5, J = 0.2, a = 0.4, L = 1.0;
+
+    ChSystemNSC sys;
+    auto chain = BuildChain(sys, 2, m, J, a, L);
+
+    double states[][4] = {{0, 0, 0, 0}, {0.4, -0.7, 0, 0}, {0.4, -0.7, 1.3, -2.1}, {-1.1, 0.6, -0.5, 2.4}};
+    for (auto& s : states) {
+        chain->SetJointPos(0, s[0]);
+        chain->SetJointPos(1, s[1]);
+        chain->SetJointVel(0, s[2]);
+        chain->SetJointVel(1, s[3]);
+        chain->Advance(1e-10);
+
+        // Reference: compound double pendulum in absolute angles t1, t2 (from the horizontal),
+        // with zero joint torques:
+        //   M11 t1dd + M12 t2dd + m L a sin(t1-t2) t2d^2 + (m a + m L) g cos(t1) = 0
+        //   M12 t1dd + M22 t2dd - m L a sin(t1-t2) t1d^2 + m g a cos(t2) = 0
+        double t1 = s[0], t2 = s[0] + s[1];
+        double t1d = s[2], t2d = s[2] + s[3];
+        double M11 = J + m * a * a + m * L * L;
+        double M12 = m * L * a * std::cos(t1 - t2);
+        double M22 = J + m * a * a;
+        double b1 = -m * L * a * std::sin(t1 - t2) * t2d * t2d - (m * a + m * L) * g * std::cos(t1);
+        double b2 = m * L * a * std::sin(t1 - t2) * t1d * t1d - m * g * a * std::cos(t2);
+        double det = M11 * M22 - M12 * M12;
+        double t1dd_ref = (b1 * M22 - b2 * M12) / det;
+        double t2dd_ref = (M11 * b2 - M12 * b1) / det;
+
+        ASSERT_NEAR(chain->GetJointAcc(0), t1dd_ref, 1e-8);
+        ASSERT_NEAR(chain->GetJointAcc(0) + chain->GetJointAcc(1), t2dd_ref, 1e-8);
+    }
+}
+
+TEST(FeatherstoneChain, single_pendulum_trajectory) {
+    double m = 1.0, J = 0.1, d = 0.5;
+    double h = 1e-4;
+    double t_end = 1.0;
+
+    ChSystemNSC sys;
+    auto chain = BuildChain(sys, 1, m, J, d, 2 * d);
+
+    // Reference solution of (J + m d^2) qdd = -m g d cos(q) with RK4 at the same step.
+    double q_ref = 0, qd_ref = 0;
+    auto f = [&](double q) { return -m * g * d * std::cos(q) / (J + m * d * d); };
+    int num_steps = (int)std::round(t_end / h);
+    for (int is = 0; is < num_steps; is++) {
+        chain->Advance(h);
+
+        double k1q = qd_ref, k1v = f(q_ref);
+        double k2q = qd_ref + 0.5 * h * k1v, k2v = f(q_ref + 0.5 * h * k1q);
+        double k3q = qd_ref + 0.5 * h * k2v, k3v = f(q_ref + 0.5 * h * k2q);
+        double k4q = qd_ref + h * k3v, k4v = f(q_ref + h * k3q);
+        q_ref += h / 6 * (k1q + 2 * k2q + 2 * k3q + k4q);
+        qd_ref += h / 6 * (k1v + 2 * k2v + 2 * k3v + k4v);
+    }
+
+    ASSERT_NEAR(chain->GetJointPos(0), q_ref, 1e-2);
+    ASSERT_NEAR(chain->GetJointVel(0), qd_ref, 1e-1);
+
+    // The chain body must track the reduced coordinates.
+    auto body = sys.Get_bodylist()[1];
+    ASSERT_NEAR(body->GetPos().x(), d * std::cos(chain->GetJointPos(0)), 1e-10);
+    ASSERT_NEAR(body->GetPos().y(), d * std::sin(chain->GetJointPos(0)), 1e-10);
+}
@@ -0,0 +1,76 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the state-history ring buffer (ChStateHistory).
+//
+// A free body falls under gravity while a history recorder is attached to the
+// system. The recorded samples and the interpolated queries are checked
+// against the analytical free-fall trajectory, including after the ring
+// buffer has wrapped around.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChStateHistory.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+TEST(ChStateHistory, free_fall) {
+    double g = 9.8;
+    double v0 = 2.0;
+    double step = 1e-2;
+    int capacity = 8;
+    int num_steps = 20;
+
+    ChSystemNSC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, -g));
+
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetPos(ChVector<>(0, 0, 0));
+    body->SetPos_dt(ChVector<>(0, 0, v0));
+    sys.AddBody(body);
+
+    auto history = chrono_types::make_shared<ChStateHistory>(&sys, capacity);
+    sys.SetStateHistory(history);
+
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(step);
+
+    // The ring buffer must have wrapped, retaining the most recent samples
+    ASSERT_EQ(history->GetNumSamples(), capacity);
+    ASSERT_NEAR(history->GetNewestTime(), num_steps * step, 1e-12);
+    ASSERT_NEAR(history->GetOldestTime(), (num_steps - capacity + 1) * step, 1e-12);
+
+    ChState x(&sys);
+    ChStateDelta v(&sys);
+
+    // A query at a sample time must reproduce the recorded state exactly
+    double t_sample = (num_steps - 2) * step;
+    ASSERT_TRUE(history->InterpolateState(t_sample, x, v));
+    ASSERT_NEAR(x(2), v0 * t_sample - 0.5 * g * t_sample * t_sample, 2e-2);
+    ASSERT_NEAR(v(2), v0 - g * t_sample, 1e-10);
+
+    // A query between samples must interpolate the free-fall trajectory
+    double t_mid = (num_steps - 2.5) * step;
+    ASSERT_TRUE(history->InterpolateState(t_mid, x, v));
+    ASSERT_NEAR(x(2), v0 * t_mid - 0.5 * g * t_mid * t_mid, 2e-2);
+    ASSERT_NEAR(v(2), v0 - g * t_mid, 1e-10);
+
+    // Queries outside the recorded range are clamped
+    ASSERT_TRUE(history->InterpolateState(1e6, x, v));
+    ASSERT_NEAR(v(2), v0 - g * history->GetNewestTime(), 1e-10);
+    ASSERT_TRUE(history->InterpolateState(-1e6, x, v));
+    ASSERT_NEAR(v(2), v0 - g * history->GetOldestTime(), 1e-10);
+}
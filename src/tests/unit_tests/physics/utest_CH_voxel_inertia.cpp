@@ -0,0 +1,98 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Tests for voxel-based mass property computation (ChInertiaUtils::VoxelInertia).
+//
+// A box mesh is voxelized and the resulting mass, COM, and inertia tensor are
+// compared against the analytic values, both for the watertight mesh and for a
+// non-watertight copy with one side removed (exercising the majority voting
+// across the three parity sweeps).
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChInertiaUtils.h"
+
+using namespace chrono;
+using namespace chrono::geometry;
+
+// Build a box mesh with the given half-dimensions, centered at the given position.
+static ChTriangleMeshConnected MakeBox(const ChVector<>& hdims, const ChVector<>& center) {
+    ChTriangleMeshConnected mesh;
+    for (int k = 0; k < 8; k++) {
+        ChVector<> corner((k & 1) ? hdims.x() : -hdims.x(),  //
+                          (k & 2) ? hdims.y() : -hdims.y(),  //
+                          (k & 4) ? hdims.z() : -hdims.z());
+        mesh.m_vertices.push_back(center + corner);
+    }
+    int faces[12][3] = {{0, 2, 3}, {0, 3, 1},    // z-
+                        {4, 5, 7}, {4, 7, 6},    // z+
+                        {0, 1, 5}, {0, 5, 4},    // y-
+                        {2, 6, 7}, {2, 7, 3},    // y+
+                        {0, 4, 6}, {0, 6, 2},    // x-
+                        {1, 3, 7}, {1, 7, 5}};   // x+
+    for (auto& f : faces)
+        mesh.m_face_v_indices.push_back(ChVector<int>(f[0], f[1], f[2]));
+    return mesh;
+}
+
+TEST(VoxelInertia, watertight_box) {
+    ChVector<> hdims(1.0, 0.5, 0.25);
+    ChVector<> center(1, -2, 3);
+    double density = 1000;
+
+    auto mesh = MakeBox(hdims, center);
+
+    double mass;
+    ChVector<> com;
+    ChMatrix33<> inertia;
+    ChInertiaUtils::VoxelInertia(mesh, 64, density, mass, com, inertia);
+
+    double mass_ref = density * 8 * hdims.x() * hdims.y() * hdims.z();
+    ASSERT_NEAR(mass, mass_ref, 0.06 * mass_ref);
+    ASSERT_LT((com - center).Length(), 0.05);
+
+    ChVector<> d = 2.0 * hdims;
+    ChVector<> J_ref(mass_ref / 12 * (d.y() * d.y() + d.z() * d.z()),  //
+                     mass_ref / 12 * (d.x() * d.x() + d.z() * d.z()),  //
+                     mass_ref / 12 * (d.x() * d.x() + d.y() * d.y()));
+    ASSERT_NEAR(inertia(0, 0), J_ref.x(), 0.08 * J_ref.x());
+    ASSERT_NEAR(inertia(1, 1), J_ref.y(), 0.08 * J_ref.y());
+    ASSERT_NEAR(inertia(2, 2), J_ref.z(), 0.08 * J_ref.z());
+    ASSERT_NEAR(inertia(0, 1), 0.0, 0.02 * J_ref.x());
+    ASSERT_NEAR(inertia(0, 2), 0.0, 0.02 * J_ref.x());
+    ASSERT_NEAR(inertia(1, 2), 0.0, 0.02 * J_ref.x());
+}
+
+TEST(VoxelInertia, open_box) {
+    ChVector<> hdims(1.0, 0.5, 0.25);
+    ChVector<> center(0, 0, 0);
+    double density = 1000;
+
+    auto mesh = MakeBox(hdims, center);
+    // Remove the z+ side: rays along Z see an odd crossing count, but the X and Y sweeps still
+    // agree on the interior, so the result must only degrade slightly.
+    mesh.m_face_v_indices.erase(mesh.m_face_v_indices.begin() + 2, mesh.m_face_v_indices.begin() + 4);
+
+    double mass;
+    ChVector<> com;
+    ChMatrix33<> inertia;
+    ChInertiaUtils::VoxelInertia(mesh, 64, density, mass, com, inertia);
+
+    double mass_ref = density * 8 * hdims.x() * hdims.y() * hdims.z();
+    ASSERT_NEAR(mass, mass_ref, 0.1 * mass_ref);
+    ASSERT_LT((com - center).Length(), 0.05);
+}
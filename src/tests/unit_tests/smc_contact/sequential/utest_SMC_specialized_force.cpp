@@ -0,0 +1,89 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the compile-time specialized SMC force calculation.
+//
+// For every combination of contact force model, adhesion model, tangential
+// displacement model, and use of material properties, the specialized kernel
+// created by MakeSpecializedContactForceSMC() must reproduce the forces of
+// ChDefaultContactForceSMC exactly.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChContactSMC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+using namespace chrono;
+
+TEST(SMCspecializedForce, matches_default) {
+    ChDefaultContactForceSMC default_algo;
+
+    ChSystemSMC::ContactForceModel force_models[] = {ChSystemSMC::Hooke, ChSystemSMC::Hertz,
+                                                     ChSystemSMC::PlainCoulomb, ChSystemSMC::Flores};
+    ChSystemSMC::AdhesionForceModel adhesion_models[] = {ChSystemSMC::AdhesionForceModel::Constant,
+                                                         ChSystemSMC::AdhesionForceModel::DMT,
+                                                         ChSystemSMC::AdhesionForceModel::Perko};
+    ChSystemSMC::TangentialDisplacementModel tdispl_models[] = {ChSystemSMC::None, ChSystemSMC::OneStep,
+                                                                ChSystemSMC::MultiStep};
+
+    // A handful of synthetic contact states (normal direction, velocities, overlap).
+    struct State {
+        ChVector<> normal;
+        ChVector<> vel1;
+        ChVector<> vel2;
+        double delta;
+    } states[] = {{ChVector<>(0, 0, 1), ChVector<>(0.1, 0, -0.2), ChVector<>(-0.3, 0.2, 0.1), 1e-4},
+                  {ChVector<>(1, 0, 0), ChVector<>(0, 0, 0), ChVector<>(-1.0, 0.5, 0), 1e-3},
+                  {ChVector<>(0, 1, 0), ChVector<>(0, 2.0, 0), ChVector<>(0, -2.0, 0), 5e-5},
+                  {ChVector<>(0, 0, 1), ChVector<>(0, 0, 0), ChVector<>(0, 0, 0), 2e-4}};
+
+    ChMaterialCompositeSMC mat;
+    mat.E_eff = 2e7f;
+    mat.G_eff = 8e6f;
+    mat.mu_eff = 0.4f;
+    mat.cr_eff = 0.6f;
+    mat.adhesion_eff = 0.1f;
+    mat.adhesionMultDMT_eff = 0.02f;
+    mat.kn = 2e5f;
+    mat.kt = 1e5f;
+    mat.gn = 40.0f;
+    mat.gt = 20.0f;
+
+    for (auto use_mat_props : {true, false}) {
+        ChSystemSMC sys(use_mat_props);
+        sys.SetStep(1e-4);
+        for (auto fm : force_models) {
+            for (auto am : adhesion_models) {
+                for (auto tm : tdispl_models) {
+                    sys.SetContactForceModel(fm);
+                    sys.SetAdhesionForceModel(am);
+                    sys.SetTangentialDisplacementModel(tm);
+                    auto specialized = MakeSpecializedContactForceSMC(sys);
+
+                    for (auto& s : states) {
+                        ChVector<> p1(1, 2, 3);
+                        ChVector<> p2 = p1 - s.delta * s.normal;
+                        ChVector<> f_def = default_algo.CalculateForce(sys, s.normal, p1, p2, s.vel1, s.vel2, mat,
+                                                                       s.delta, 0.05, 1.0, 3.0);
+                        ChVector<> f_spec = specialized->CalculateForce(sys, s.normal, p1, p2, s.vel1, s.vel2, mat,
+                                                                        s.delta, 0.05, 1.0, 3.0);
+                        ASSERT_DOUBLE_EQ(f_def.x(), f_spec.x());
+                        ASSERT_DOUBLE_EQ(f_def.y(), f_spec.y());
+                        ASSERT_DOUBLE_EQ(f_def.z(), f_spec.z());
+                    }
+                }
+            }
+        }
+    }
+}